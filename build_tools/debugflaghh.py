@@ -51,6 +51,11 @@ parser.add_argument(
     "components",
     help="components of a compound flag, if applicable, joined with :",
 )
+parser.add_argument(
+    "traced",
+    help="whether the DPRINTFs of the flag are compiled into opt builds "
+    "(True or False)",
+)
 
 args = parser.parse_args()
 
@@ -62,6 +67,10 @@ elif fmt == "false":
 else:
     print(f'Unrecognized "FMT" value {fmt}', file=sys.stderr)
     sys.exit(1)
+traced = args.traced.lower()
+if traced not in ("true", "false"):
+    print(f'Unrecognized "TRACED" value {traced}', file=sys.stderr)
+    sys.exit(1)
 components = args.components.split(":") if args.components else []
 
 code = code_formatter()
@@ -129,6 +138,14 @@ code(
 inline constexpr const auto& ${{args.name}} =
     ::gem5::debug::unions::${{args.name}}.${{args.name}};
 
+namespace traced
+{
+
+/** Whether the DPRINTFs of the flag are compiled into opt builds */
+inline constexpr bool ${{args.name}} = ${{traced}};
+
+} // namespace traced
+
 } // namespace debug
 } // namespace gem5
 
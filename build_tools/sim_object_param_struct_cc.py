@@ -167,6 +167,33 @@ py::module_ m = m_internal.def_submodule("param_${sim_object}");
     for exp in param_exports:
         exp.export(code, f"{sim_object}Params")
 
+    # Bulk setter used by SimObject.getCCParams(). It takes the values of
+    # the params declared at this level, in sorted order, followed by the
+    # connection counts of the ports declared at this level, also sorted,
+    # and stores them with a single call into C++.
+    fields = [k for k, v in sorted(sim_object._params.local.items())] + [
+        f"port_{name}_connection_count" for name in sorted(ports.keys())
+    ]
+    code('.def("_set_local_params",')
+    code.indent()
+    code(
+        "[](${sim_object}Params &p, const py::tuple &v)"
+        + ("" if fields else " {})")
+    )
+    if fields:
+        code("{")
+        code.indent()
+        code("if (v.size() != ${{len(fields)}})")
+        code(
+            '    throw py::value_error("${sim_object}Params: expected '
+            '${{len(fields)}} values");'
+        )
+        for i, field in enumerate(fields):
+            code("p.${field} = v[$i].cast<decltype(p.${field})>();")
+        code.dedent()
+        code("})")
+    code.dedent()
+
     code(";")
     code()
     code.dedent()
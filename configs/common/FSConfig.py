@@ -774,6 +774,9 @@ def makeDistRoot(
     linkspeed,
     linkdelay,
     dumpfile,
+    transport="tcp",
+    batch_packets=False,
+    sync_max_multiple=1,
 ):
     self = Root(full_system=True)
     self.testsys = testSystem
@@ -787,6 +790,9 @@ def makeDistRoot(
         server_port=server_port,
         sync_start=sync_start,
         sync_repeat=sync_repeat,
+        transport=transport,
+        batch_packets=batch_packets,
+        sync_max_multiple=sync_max_multiple,
     )
 
     if hasattr(testSystem, "realview"):
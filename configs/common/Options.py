@@ -429,6 +429,28 @@ def addCommonOptions(parser):
         help="Time to schedule the first dist synchronisation barrier\n"
         "DEFAULT:5200000000000t",
     )
+    parser.add_argument(
+        "--dist-sync-max-multiple",
+        default=1,
+        action="store",
+        type=int,
+        help="Let the dist synchronisation interval grow up to this "
+        "multiple of --dist-sync-repeat while no packets are sent\n"
+        "DEFAULT: 1 (fixed interval)",
+    )
+    parser.add_argument(
+        "--dist-transport",
+        default="tcp",
+        choices=["tcp", "mpi", "shm"],
+        help="Transport between dist-gem5 processes: TCP sockets, an MPI "
+        "job, or shared memory for processes on one host\nDEFAULT: tcp",
+    )
+    parser.add_argument(
+        "--dist-batch-packets",
+        action="store_true",
+        help="Send dist-gem5 data packets along with the sync barriers "
+        "(mpi and shm transports)",
+    )
     parser.add_argument(
         "--ethernet-linkspeed",
         default="10Gbps",
@@ -755,6 +777,21 @@ def addSEOptions(parser):
         action="store_true",
         help="Wait for remote GDB to connect.",
     )
+    parser.add_argument(
+        "--parallel-cpus",
+        default=False,
+        action="store_true",
+        help="Simulate each CPU on its own host thread. Needs an atomic "
+        "CPU model without caches.",
+    )
+    parser.add_argument(
+        "--sim-quantum",
+        type=int,
+        default=int(1e7),
+        help="Ticks between the synchronisations of the host threads "
+        "with --parallel-cpus. Threads are woken and halted by "
+        "other CPUs at the next synchronisation.",
+    )
 
 
 def addFSOptions(parser):
@@ -396,6 +396,9 @@ elif len(bm) == 1 and args.dist:
         args.ethernet_linkspeed,
         args.ethernet_linkdelay,
         args.etherdump,
+        args.dist_transport,
+        args.dist_batch_packets,
+        args.dist_sync_max_multiple,
     )
 elif len(bm) == 1:
     root = Root(full_system=True, system=test_sys)
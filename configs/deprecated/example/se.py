@@ -119,6 +119,22 @@ def get_processes(args):
         return multiprocesses, 1
 
 
+def connect_parallel_cpus(system):
+    """Connect the CPUs to the memory bus through ThreadBridges, so that
+    the event queue partitioner can put each of them on its own event
+    queue"""
+
+    for cpu in system.cpu:
+        cpu.createInterruptController()
+        cpu.mem_bridges = [ThreadBridge() for _ in cpu._cached_ports]
+        for port, bridge in zip(cpu._cached_ports, cpu.mem_bridges):
+            exec(f"cpu.{port} = bridge.in_port")
+            bridge.out_port = system.membus.cpu_side_ports
+        cpu.connectUncachedPorts(
+            system.membus.cpu_side_ports, system.membus.mem_side_ports
+        )
+
+
 warn(
     "The se.py script is deprecated. It will be removed in future releases of "
     " gem5."
@@ -226,6 +242,12 @@ if ObjectList.is_kvm_cpu(CPUClass) or ObjectList.is_kvm_cpu(FutureClass):
         fatal("KvmCPU can only be used in SE mode with x86")
 
 # Sanity check
+if args.parallel_cpus:
+    if args.ruby or args.caches or args.l2cache:
+        fatal("--parallel-cpus doesn't support caches")
+    if test_mem_mode != "atomic" or FutureClass:
+        fatal("--parallel-cpus needs an atomic CPU model")
+
 if args.simpoint_profile:
     if not ObjectList.is_noncaching_cpu(CPUClass):
         fatal("SimPoint/BPProbe should be done with an atomic cpu")
@@ -279,7 +301,10 @@ else:
     MemClass = Simulation.setMemClass(args)
     system.membus = SystemXBar()
     system.system_port = system.membus.cpu_side_ports
-    CacheConfig.config_cache(args, system)
+    if args.parallel_cpus:
+        connect_parallel_cpus(system)
+    else:
+        CacheConfig.config_cache(args, system)
     MemConfig.config_mem(args, system)
     config_filesystem(system, args)
 
@@ -289,4 +314,8 @@ if args.wait_gdb:
     system.workload.wait_for_remote_gdb = True
 
 root = Root(full_system=False, system=system)
+if args.parallel_cpus:
+    # One event queue for each CPU and one for the memory system
+    root.sim_quantum = args.sim_quantum
+    root.eventq_partitions = np + 1
 Simulation.run(args, root, system, FutureClass)
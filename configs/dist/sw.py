@@ -58,6 +58,9 @@ def build_switch(args):
             sync_repeat=args.dist_sync_repeat,
             is_switch=True,
             num_nodes=args.dist_size,
+            transport=args.dist_transport,
+            batch_packets=args.dist_batch_packets,
+            sync_max_multiple=args.dist_sync_max_multiple,
         )
         for i in range(args.dist_size)
     ]
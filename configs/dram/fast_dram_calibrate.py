@@ -0,0 +1,370 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script calibrates the latency curves of a FastDRAMInterface against
+# a detailed DRAMInterface. It sweeps DRAMGen (or DRAMRotGen) traffic over
+# a range of injection rates, for bus utilisation, and sequential strides,
+# for row buffer locality, and records the average read latency and row hit
+# rate of each phase. The row hit and row miss latencies at each
+# utilisation point are then fitted to the phases around it, and written to
+# a file that FastDRAMInterface.from_calibration() reads.
+#
+# With --validate, the same sweep is run against a FastDRAMInterface built
+# from a calibration instead, and the latency of each phase is compared to
+# the one the detailed model measured.
+
+import argparse
+import json
+import math
+
+import m5
+from m5.objects import *
+from m5.util import addToPath, fatal
+
+addToPath("../")
+
+from common import ObjectList
+from common import MemConfig
+
+parser = argparse.ArgumentParser()
+
+dram_generators = {
+    "DRAM": lambda x: x.createDram,
+    "DRAM_ROTATE": lambda x: x.createDramRot,
+}
+
+# Use a single-channel DDR3-1600 x64 (8x8 topology) by default
+parser.add_argument(
+    "--mem-type",
+    default="DDR3_1600_8x8",
+    choices=ObjectList.mem_list.get_names(),
+    help="type of memory to calibrate against",
+)
+
+parser.add_argument(
+    "--mem-ranks",
+    "-r",
+    type=int,
+    default=1,
+    help="Number of ranks to iterate across",
+)
+
+parser.add_argument(
+    "--rd_perc", type=int, default=100, help="Percentage of read commands"
+)
+
+parser.add_argument(
+    "--mode",
+    default="DRAM",
+    choices=list(dram_generators.keys()),
+    help="DRAM: Random traffic; "
+    "DRAM_ROTATE: Traffic rotating across banks and ranks",
+)
+
+parser.add_argument(
+    "--addr-map",
+    choices=ObjectList.dram_addr_map_list.get_names(),
+    default="RoRaBaCoCh",
+    help="DRAM address map policy",
+)
+
+parser.add_argument(
+    "--period",
+    type=int,
+    default=100000000,
+    help="Ticks to warm up, and then to measure, each phase for",
+)
+
+parser.add_argument(
+    "--points",
+    type=int,
+    default=11,
+    help="Number of utilisation points of the curves",
+)
+
+parser.add_argument(
+    "--output",
+    default="fast_dram_calibration.json",
+    help="File to write the calibration to",
+)
+
+parser.add_argument(
+    "--validate",
+    metavar="CALIBRATION",
+    default=None,
+    help="Run the sweep against a FastDRAMInterface built from this "
+    "calibration and compare it to the detailed model",
+)
+
+args = parser.parse_args()
+
+calibration = None
+if args.validate:
+    with open(args.validate) as f:
+        calibration = json.load(f)
+    # sweep the same phases as the calibration did
+    args.mem_type = calibration["mem_type"]
+    args.mem_ranks = calibration["ranks_per_channel"]
+    args.addr_map = calibration["addr_mapping"]
+
+# start with the system itself, using a multi-layer 2.0 GHz
+# crossbar, delivering 64 bytes / 3 cycles (one header cycle)
+# which amounts to 42.7 GByte/s per layer and thus per port
+system = System(membus=IOXBar(width=32))
+system.clk_domain = SrcClockDomain(
+    clock="2.0GHz", voltage_domain=VoltageDomain(voltage="1V")
+)
+
+# we are fine with 256 MB memory for now
+mem_range = AddrRange("256MB")
+system.mem_ranges = [mem_range]
+
+# do not worry about reserving space for the backing store
+system.mmap_using_noreserve = True
+
+# force a single channel to match the assumptions in the DRAM traffic
+# generator
+args.mem_channels = 1
+args.external_memory_system = 0
+args.tlm_memory = 0
+args.elastic_trace_en = 0
+MemConfig.config_mem(args, system)
+
+# the following assumes that we are using the native DRAM
+# controller, check to be sure
+if not isinstance(system.mem_ctrls[0], m5.objects.MemCtrl):
+    fatal("This script assumes the controller is a MemCtrl subclass")
+if not isinstance(system.mem_ctrls[0].dram, m5.objects.DRAMInterface):
+    fatal("This script assumes the memory is a DRAMInterface subclass")
+
+dram = system.mem_ctrls[0].dram
+
+# there is no point slowing things down by saving any data
+dram.null = True
+
+# Set the address mapping based on input argument
+dram.addr_mapping = args.addr_map
+
+nbr_banks = dram.banks_per_rank.value
+
+# determine the burst length in bytes
+burst_size = int(
+    (
+        dram.devices_per_rank.value
+        * dram.device_bus_width.value
+        * dram.burst_length.value
+    )
+    / 8
+)
+
+# next, get the page size in bytes
+page_size = dram.devices_per_rank.value * dram.device_rowbuffer_size.value
+
+# the minimum time between bursts on the data bus, in ticks (ps)
+tburst = dram.tBURST.value * 1000000000000
+itt = getattr(dram.tBURST_MIN, "value", dram.tBURST.value) * 1000000000000
+
+if calibration:
+    system.mem_ctrls[0].dram = FastDRAMInterface.from_calibration(
+        args.validate, range=dram.range, null=True
+    )
+    dram = system.mem_ctrls[0].dram
+
+# the injection rates, relative to the peak bandwidth, and the strides
+# of the phases
+loads = [1.0, 1.1, 1.25, 1.5, 2.0, 2.5, 3.0, 4.0, 6.0, 8.0, 16.0]
+strides = []
+stride_size = burst_size
+while stride_size <= page_size:
+    strides.append(stride_size)
+    stride_size *= 2
+
+phases = [(load, stride) for load in loads for stride in strides]
+
+system.tgen = PyTrafficGen()
+system.tgen.port = system.membus.cpu_side_ports
+
+# connect the system port even if it is not used in this example
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+m5.instantiate()
+
+
+def trace():
+    addr_map = ObjectList.dram_addr_map_list.get(args.addr_map)
+    generator = dram_generators[args.mode](system.tgen)
+    for load, stride in phases:
+        phase_itt = int(itt * load)
+        yield generator(
+            2 * args.period,
+            0,
+            mem_range.end,
+            burst_size,
+            phase_itt,
+            phase_itt,
+            args.rd_perc,
+            0,
+            int(math.ceil(float(stride) / burst_size)),
+            page_size,
+            nbr_banks,
+            nbr_banks,
+            addr_map,
+            args.mem_ranks,
+        )
+    yield system.tgen.createExit(0)
+
+
+system.tgen.start(trace())
+
+
+def stat(name):
+    return dram.resolveStat(name).value
+
+
+samples = []
+for load, stride in phases:
+    # warm up, and then measure the phase
+    m5.simulate(args.period)
+    m5.stats.reset()
+    m5.simulate(args.period)
+
+    reads = stat("readBursts")
+    if reads == 0:
+        continue
+    bursts = (stat("bytesRead") + stat("bytesWritten")) / burst_size
+    samples.append(
+        {
+            "load": load,
+            "stride": stride,
+            "utilization": min(1.0, bursts * tburst / args.period),
+            "row_hit_rate": stat("readRowHits") / reads,
+            # ticks are ps
+            "latency": stat("totMemAccLat") / reads / 1000,
+        }
+    )
+
+
+def fit(point, spacing):
+    """
+    Fit the row hit and row miss latency at a utilisation point to the
+    phases around it, weighting each phase by its distance to the point.
+    """
+    saa = sab = sbb = sal = sbl = sw = swl = 0.0
+    for sample in samples:
+        w = 1.0 - abs(sample["utilization"] - point) / spacing
+        if w <= 0:
+            continue
+        a = sample["row_hit_rate"]
+        b = 1.0 - a
+        latency = sample["latency"]
+        saa += w * a * a
+        sab += w * a * b
+        sbb += w * b * b
+        sal += w * a * latency
+        sbl += w * b * latency
+        sw += w
+        swl += w * latency
+    if sw == 0:
+        return None
+
+    det = saa * sbb - sab * sab
+    if abs(det) < 1e-9 * sw * sw:
+        # no spread in the row hit rate, so no way to tell them apart
+        mean = swl / sw
+        return mean, mean
+    hit = (sal * sbb - sbl * sab) / det
+    miss = (sbl * saa - sal * sab) / det
+    hit = max(0.0, min(hit, miss))
+    return hit, max(miss, hit)
+
+
+if calibration:
+    errors = []
+    print("load stride utilization row_hit_rate latency detailed error")
+    for sample, detailed in zip(samples, calibration["samples"]):
+        error = sample["latency"] / detailed["latency"] - 1
+        errors.append(abs(error))
+        print(
+            "%.2f %d %.3f %.3f %.2fns %.2fns %+.1f%%"
+            % (
+                sample["load"],
+                sample["stride"],
+                sample["utilization"],
+                sample["row_hit_rate"],
+                sample["latency"],
+                detailed["latency"],
+                error * 100,
+            )
+        )
+    if errors:
+        print(
+            "Mean absolute latency error: %.1f%%"
+            % (sum(errors) / len(errors) * 100)
+        )
+else:
+    points = [i / (args.points - 1) for i in range(args.points)]
+    spacing = 1.0 / (args.points - 1)
+    fits = [fit(point, spacing) for point in points]
+    if not any(fits):
+        fatal("No reads were measured in any phase")
+
+    # points beyond the utilisations reached take their nearest fit
+    for i in range(len(fits)):
+        if fits[i] is None:
+            fits[i] = min(
+                (f for f in enumerate(fits) if f[1] is not None),
+                key=lambda f: abs(f[0] - i),
+            )[1]
+
+    # the latencies only grow with the utilisation
+    hit_latency = []
+    miss_latency = []
+    for hit, miss in fits:
+        hit_latency.append(round(max([hit] + hit_latency[-1:]), 3))
+        miss_latency.append(round(max([miss] + miss_latency[-1:]), 3))
+
+    with open(args.output, "w") as f:
+        json.dump(
+            {
+                "mem_type": args.mem_type,
+                "ranks_per_channel": args.mem_ranks,
+                "addr_mapping": args.addr_map,
+                "utilization_points": points,
+                "row_hit_latency": hit_latency,
+                "row_miss_latency": miss_latency,
+                "samples": samples,
+            },
+            f,
+            indent=4,
+        )
+
+    print("utilization row_hit_latency row_miss_latency")
+    for point, hit, miss in zip(points, hit_latency, miss_latency):
+        print("%.2f %.2fns %.2fns" % (point, hit, miss))
+    print("Calibration of %s written to %s" % (args.mem_type, args.output))
@@ -370,6 +370,22 @@ parser.add_argument(
     help="Gfx version for gpuNote: gfx902 is not fully supported by ROCm",
 )
 
+parser.add_argument(
+    "--parallel-cus",
+    type=int,
+    default=0,
+    help="Spread the CUs over this many additional event queues, each "
+    "simulated on its own host thread. The CUs reach Ruby and the TLBs "
+    "through bridges.",
+)
+parser.add_argument(
+    "--cu-bridge-delay",
+    type=str,
+    default="1ns",
+    help="Latency of the bridges between the CUs and the rest of the GPU "
+    "with --parallel-cus. This is the lookahead between the threads.",
+)
+
 Ruby.define_options(parser)
 
 # add TLB options to the parser
@@ -905,6 +921,35 @@ for i in range(args.num_cp):
     ].int_responder = system.piobus.mem_side_ports
     cp_idx = cp_idx + 1
 
+
+
+def bridge_cu_ports(cu):
+    """Put a bridge on every memory and translation port of a CU, so that
+    the event queue partitioner can put the CU on its own event queue"""
+
+    bridges = []
+    for name in (
+        "memory_port",
+        "translation_port",
+        "sqc_port",
+        "sqc_tlb_port",
+        "scalar_port",
+        "scalar_tlb_port",
+    ):
+        port = getattr(cu, name)
+        for ref in getattr(port, "elements", [port]):
+            if ref is None or not ref.peer:
+                continue
+            bridge = Bridge(delay=args.cu_bridge_delay)
+            ref.splice(bridge.cpu_side_port, bridge.mem_side_port)
+            bridges.append(bridge)
+    cu.port_bridges = bridges
+
+
+if args.parallel_cus:
+    for cu in shader.CUs:
+        bridge_cu_ports(cu)
+
 ################# Connect the CPU and GPU via GPU Dispatcher ##################
 # CPU rings the GPU doorbell to notify a pending task
 # using this interface.
@@ -931,6 +976,11 @@ redirect_paths = [
 system.redirect_paths = redirect_paths
 
 root = Root(system=system, full_system=False)
+if args.parallel_cus:
+    # The GPU front end, Ruby and the CPUs stay on the first event queue
+    root.sim_quantum = args.sim_quantum
+    root.conservative_sync = True
+    root.eventq_partitions = args.parallel_cus + 1
 
 # Create the /sys/devices filesystem for the simulator so that the HSA Runtime
 # knows what type of GPU hardware we are simulating
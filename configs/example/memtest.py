@@ -64,6 +64,12 @@ parser.add_argument(
 parser.add_argument(
     "-l", "--maxloads", metavar="N", default=0, help="Stop after N loads"
 )
+parser.add_argument(
+    "--random-seed",
+    type=int,
+    default=None,
+    help="Seed the random number generator of the tester",
+)
 parser.add_argument(
     "-m",
     "--maxtick",
@@ -378,6 +384,13 @@ else:
 # to avoid problems
 root.system.system_port = last_subsys.xbar.cpu_side_ports
 
+# Seed the tester's random number generator, e.g., to reproduce a seed
+# of a parallel soak run
+if args.random_seed is not None:
+    from _m5.core import seedRandom
+
+    seedRandom(args.random_seed)
+
 # Instantiate configuration
 m5.instantiate()
 
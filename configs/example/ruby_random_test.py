@@ -47,6 +47,12 @@ Options.addNoISAOptions(parser)
 parser.add_argument(
     "--maxloads", metavar="N", default=100, help="Stop after N loads"
 )
+parser.add_argument(
+    "--random-seed",
+    type=int,
+    default=None,
+    help="Seed the random number generator of the tester",
+)
 parser.add_argument(
     "-f",
     "--wakeup_freq",
@@ -165,6 +171,13 @@ root.system.mem_mode = "timing"
 # Not much point in this being higher than the L1 latency
 m5.ticks.setGlobalFrequency("1ns")
 
+# Seed the tester's random number generator, e.g., to reproduce a seed
+# of a parallel soak run
+if args.random_seed is not None:
+    from _m5.core import seedRandom
+
+    seedRandom(args.random_seed)
+
 # instantiate configuration
 m5.instantiate()
 
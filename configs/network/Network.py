@@ -50,15 +50,17 @@ def define_options(parser):
     parser.add_argument(
         "--network",
         default="simple",
-        choices=["simple", "garnet"],
-        help="""'simple'|'garnet' (garnet2.0 will be deprecated.)""",
+        choices=["simple", "garnet", "analytical"],
+        help="""'simple'|'garnet'|'analytical' (garnet2.0 will be
+            deprecated.)""",
     )
     parser.add_argument(
         "--router-latency",
         action="store",
         type=int,
         default=1,
-        help="""number of pipeline stages in the garnet router.
+        help="""number of pipeline stages in the garnet router (or the
+            latency of a router in the analytical network).
             Has to be >= 1.
             Can be over-ridden on a per router basis
             in the topology file.""",
@@ -68,7 +70,7 @@ def define_options(parser):
         action="store",
         type=int,
         default=1,
-        help="""latency of each link the simple/garnet networks.
+        help="""latency of each link the simple/garnet/analytical networks.
         Has to be >= 1. Can be over-ridden on a per link basis
         in the topology file.""",
     )
@@ -140,6 +142,13 @@ def create_network(options, ruby):
         RouterClass = GarnetRouter
         InterfaceClass = GarnetNetworkInterface
 
+    elif options.network == "analytical":
+        NetworkClass = AnalyticalNetwork
+        IntLinkClass = BasicIntLink
+        ExtLinkClass = BasicExtLink
+        RouterClass = BasicRouter
+        InterfaceClass = None
+
     else:
         NetworkClass = SimpleNetwork
         IntLinkClass = SimpleIntLink
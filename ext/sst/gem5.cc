@@ -253,7 +253,11 @@ bool
 gem5Component::clockTick(SST::Cycle_t currentCycle)
 {
     // what to do in a SST's cycle
+    systemPort->deliverResponses();
+    cachePort->deliverResponses();
     gem5::GlobalSimLoopExitEvent *event = simulateGem5(currentCycle);
+    systemPort->flushRequests();
+    cachePort->flushRequests();
     clocksProcessed++;
     // gem5 exits due to reasons other than reaching simulation limit
     if (event != gem5::simulate_limit_event) {
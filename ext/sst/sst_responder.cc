@@ -55,6 +55,15 @@ SSTResponder::handleRecvTimingReq(gem5::PacketPtr pkt)
     return owner->handleTimingReq(request);
 }
 
+void
+SSTResponder::handleRecvTimingReqs(const std::vector<gem5::PacketPtr> &pkts)
+{
+    for (auto pkt: pkts) {
+        owner->handleTimingReq(Translator::gem5RequestToSSTRequest(
+            pkt, owner->sstRequestIdToPacketMap));
+    }
+}
+
 void
 SSTResponder::handleRecvRespRetry()
 {
@@ -67,6 +67,8 @@ class SSTResponder: public gem5::SSTResponderInterface
     void setOutputStream(SST::Output* output_);
 
     bool handleRecvTimingReq(gem5::PacketPtr pkt) override;
+    void handleRecvTimingReqs(
+        const std::vector<gem5::PacketPtr> &pkts) override;
     void handleRecvRespRetry() override;
     void handleRecvFunctional(gem5::PacketPtr pkt) override;
 };
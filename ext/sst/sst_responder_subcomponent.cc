@@ -148,8 +148,7 @@ SSTResponderSubComponent::handleSwapReqResponse(
     pkt->setData(request->data.data());
     pkt->makeAtomicResponse();
     pkt->headerDelay = pkt->payloadDelay = 0;
-    if (blocked() || !responseReceiver->sendTimingResp(pkt))
-        responseQueue.push(pkt);
+    queueResponse(pkt);
 
     // step 2
     (*(pkt->getAtomicOp()))(data.data()); // apply the atomic op
@@ -193,8 +192,7 @@ SSTResponderSubComponent::portEventHandler(
 
         Translator::inplaceSSTRequestToGem5PacketPtr(pkt, request);
 
-        if (blocked() || !(responseReceiver->sendTimingResp(pkt)))
-            responseQueue.push(pkt);
+        queueResponse(pkt);
     } else { // we can handle unexpected invalidates, but nothing else.
         SST::Interfaces::SimpleMem::Request::Command cmd = request->cmd;
         if (cmd == SST::Interfaces::SimpleMem::Request::Command::WriteResp)
@@ -219,6 +217,35 @@ SSTResponderSubComponent::portEventHandler(
     delete request;
 }
 
+void
+SSTResponderSubComponent::queueResponse(gem5::PacketPtr pkt)
+{
+    if (responseReceiver->batching())
+        responseBatch.push_back(pkt);
+    else if (blocked() || !(responseReceiver->sendTimingResp(pkt)))
+        responseQueue.push(pkt);
+}
+
+void
+SSTResponderSubComponent::deliverResponses()
+{
+    if (responseBatch.empty())
+        return;
+
+    size_t sent = 0;
+    if (!blocked())
+        sent = responseReceiver->sendTimingResps(responseBatch);
+    for (size_t i = sent; i < responseBatch.size(); i++)
+        responseQueue.push(responseBatch[i]);
+    responseBatch.clear();
+}
+
+void
+SSTResponderSubComponent::flushRequests()
+{
+    responseReceiver->flushRequests();
+}
+
 void
 SSTResponderSubComponent::handleRecvRespRetry()
 {
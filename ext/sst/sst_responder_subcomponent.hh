@@ -64,6 +64,11 @@ class SSTResponderSubComponent: public SST::SubComponent
     SST::Output* output;
     std::queue<gem5::PacketPtr> responseQueue;
 
+    // responses from SST waiting to be handed to gem5 in one batch at the
+    // start of the next SST clock tick, when the bridge batches packets
+    std::vector<gem5::PacketPtr> responseBatch;
+    void queueResponse(gem5::PacketPtr pkt);
+
     std::vector<SST::Interfaces::SimpleMem::Request*> initRequests;
 
     std::string gem5SimObjectName;
@@ -83,6 +88,11 @@ class SSTResponderSubComponent: public SST::SubComponent
     bool blocked();
     void setup();
 
+    // hand the batched responses to gem5 before it runs an SST clock tick
+    void deliverResponses();
+    // forward the requests gem5 made during an SST clock tick to SST
+    void flushRequests();
+
     // return true if the SimObject could be found
     bool findCorrespondingSimObject(gem5::Root* gem5_root);
 
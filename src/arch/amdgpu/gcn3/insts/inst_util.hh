@@ -33,6 +33,7 @@
 #define __ARCH_GCN3_INSTS_INST_UTIL_HH__
 
 #include <cmath>
+#include <cstdint>
 
 #include "arch/amdgpu/gcn3/gpu_registers.hh"
 
@@ -890,6 +891,83 @@ namespace Gcn3ISA
          */
         sdwaInstDstImpl(dst, origDst, clamp, dst_sel, dst_unusedBits_format);
     }
+
+    /**
+     * laneOp and laneCmp implement the lane loop of the common ALU
+     * instructions. the sources are gathered into dense arrays, the op is
+     * computed for all lanes and the exec mask is then applied as a blend
+     * rather than as a branch per lane, which lets the host compiler emit
+     * SIMD code for the whole loop. fn must be free of side effects, as it
+     * is also evaluated for inactive lanes.
+     */
+    template<typename D, typename S0, typename S1, typename Fn>
+    inline void
+    laneOp(uint64_t exec_mask, D &vdst, const S0 &src0, const S1 &src1,
+           Fn fn)
+    {
+        using T = typename D::ElemType;
+        using T0 = typename S0::ElemType;
+        using T1 = typename S1::ElemType;
+
+        T0 a[NumVecElemPerVecReg];
+        T1 b[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+
+        T *dst = &vdst[0];
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            T res = fn(a[lane], b[lane]);
+            dst[lane] = ((exec_mask >> lane) & 1) ? res : dst[lane];
+        }
+    }
+
+    template<typename D, typename S0, typename S1, typename S2, typename Fn>
+    inline void
+    laneOp(uint64_t exec_mask, D &vdst, const S0 &src0, const S1 &src1,
+           const S2 &src2, Fn fn)
+    {
+        using T = typename D::ElemType;
+        using T0 = typename S0::ElemType;
+        using T1 = typename S1::ElemType;
+        using T2 = typename S2::ElemType;
+
+        T0 a[NumVecElemPerVecReg];
+        T1 b[NumVecElemPerVecReg];
+        T2 c[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+        src2.readLanes(c);
+
+        T *dst = &vdst[0];
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            T res = fn(a[lane], b[lane], c[lane]);
+            dst[lane] = ((exec_mask >> lane) & 1) ? res : dst[lane];
+        }
+    }
+
+    /**
+     * evaluate a compare for every lane and return the result as a lane
+     * mask, with the bits of the inactive lanes cleared.
+     */
+    template<typename S0, typename S1, typename Fn>
+    inline uint64_t
+    laneCmp(uint64_t exec_mask, const S0 &src0, const S1 &src1, Fn fn)
+    {
+        using T0 = typename S0::ElemType;
+        using T1 = typename S1::ElemType;
+
+        T0 a[NumVecElemPerVecReg];
+        T1 b[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+
+        uint64_t res = 0;
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            res |= uint64_t(fn(a[lane], b[lane]) ? 1 : 0) << lane;
+        }
+
+        return res & exec_mask;
+    }
 } // namespace Gcn3ISA
 } // namespace gem5
 
@@ -5464,11 +5464,8 @@ namespace Gcn3ISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a + b; });
         }
 
         vdst.write();
@@ -5497,11 +5494,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     }
@@ -5529,11 +5523,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     }
@@ -5561,11 +5552,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     }
@@ -5843,11 +5831,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     }
@@ -5875,11 +5860,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     }
@@ -5906,11 +5888,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -5937,11 +5916,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -5968,11 +5944,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -5999,11 +5972,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -6167,11 +6137,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a & b; });
 
         vdst.write();
     }
@@ -6239,11 +6206,8 @@ namespace Gcn3ISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a | b; });
         }
 
         vdst.write();
@@ -6272,11 +6236,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a ^ b; });
 
         vdst.write();
     }
@@ -6858,11 +6819,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     }
@@ -6889,11 +6847,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     }
@@ -6920,11 +6875,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     }
@@ -6951,11 +6903,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     }
@@ -7113,11 +7062,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -7144,11 +7090,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -7175,11 +7118,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -7206,11 +7146,8 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -10484,11 +10421,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -10516,11 +10451,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -10548,11 +10481,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -10580,11 +10511,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -10645,11 +10574,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -10743,11 +10670,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
     }
@@ -10808,11 +10733,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
     }
@@ -10840,11 +10763,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
     }
@@ -10872,11 +10793,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -10904,11 +10823,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
     }
@@ -10991,11 +10908,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11024,11 +10939,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11057,11 +10970,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11090,11 +11001,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11157,11 +11066,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11260,11 +11167,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11327,11 +11232,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11360,11 +11263,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11393,11 +11294,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a == b); }));
 
         vcc.write();
     }
@@ -11425,11 +11324,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -11513,11 +11410,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -11545,11 +11440,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -11577,11 +11470,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -11609,11 +11500,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -11674,11 +11563,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -11772,11 +11659,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
     }
@@ -11837,11 +11722,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
     }
@@ -11869,11 +11752,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
     }
@@ -11901,11 +11782,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -11933,11 +11812,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
     }
@@ -12020,11 +11897,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12053,11 +11928,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12086,11 +11959,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12119,11 +11990,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12186,11 +12055,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12289,11 +12156,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12356,11 +12221,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12389,11 +12252,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12422,11 +12283,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12455,11 +12314,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -12541,11 +12398,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -12572,11 +12427,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -12603,11 +12456,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -12634,11 +12485,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -12665,11 +12514,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -12696,11 +12543,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -12779,11 +12624,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -12810,11 +12653,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -12841,11 +12682,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -12872,11 +12711,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -12903,11 +12740,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -12934,11 +12769,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -13018,11 +12851,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13050,11 +12881,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13082,11 +12911,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13114,11 +12941,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13146,11 +12971,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13178,11 +13001,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13264,11 +13085,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13296,11 +13115,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13328,11 +13145,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13360,11 +13175,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13392,11 +13205,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13424,11 +13235,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13509,11 +13318,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -13540,11 +13347,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -13571,11 +13376,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -13602,11 +13405,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -13633,11 +13434,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -13664,11 +13463,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -13747,11 +13544,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -13778,11 +13573,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -13809,11 +13602,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -13840,11 +13631,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -13871,11 +13660,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -13902,11 +13689,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -13986,11 +13771,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14018,11 +13801,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14050,11 +13831,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14082,11 +13861,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14114,11 +13891,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14146,11 +13921,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14232,11 +14005,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14264,11 +14035,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14296,11 +14065,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14328,11 +14095,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14360,11 +14125,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14392,11 +14155,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14477,11 +14238,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -14508,11 +14267,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -14539,11 +14296,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -14570,11 +14325,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -14601,11 +14354,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     }
@@ -14632,11 +14383,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -14715,11 +14464,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     }
@@ -14746,11 +14493,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     }
@@ -14777,11 +14522,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     }
@@ -14808,11 +14551,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     }
@@ -14839,12 +14580,10 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
-
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
+
         vcc.write();
     }
 
@@ -14870,11 +14609,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     }
@@ -14954,11 +14691,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14986,11 +14721,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15018,11 +14751,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15050,11 +14781,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15082,11 +14811,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15114,11 +14841,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15200,11 +14925,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15232,11 +14955,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15264,11 +14985,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15296,11 +15015,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15328,11 +15045,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15360,11 +15075,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16662,11 +16375,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -16695,11 +16406,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -16728,11 +16437,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -16761,11 +16468,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -16794,11 +16499,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -16827,11 +16530,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -16926,11 +16627,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         sdst.write();
     }
@@ -16993,11 +16692,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         sdst.write();
     }
@@ -17026,11 +16723,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         sdst.write();
     }
@@ -17059,11 +16754,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -17092,11 +16785,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         sdst.write();
     }
@@ -17182,11 +16873,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17216,11 +16905,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17250,11 +16937,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17284,11 +16969,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17353,11 +17036,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17459,11 +17140,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17528,11 +17207,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17562,11 +17239,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17596,11 +17271,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17630,11 +17303,9 @@ namespace Gcn3ISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -17742,11 +17413,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -17797,11 +17466,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -17852,11 +17519,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -17907,11 +17572,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -18018,11 +17681,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -18183,11 +17844,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         sdst.write();
     }
@@ -18294,11 +17953,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         sdst.write();
     }
@@ -18349,11 +18006,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         sdst.write();
     }
@@ -18404,11 +18059,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -18459,11 +18112,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         sdst.write();
     }
@@ -18571,11 +18222,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18627,11 +18276,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18683,11 +18330,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18739,11 +18384,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18852,11 +18495,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19021,14 +18662,12 @@ namespace Gcn3ISA
         /**
          * input modifiers are supported by FP operations only
          */
-        assert(!(instData.ABS & 0x4));
-        assert(!(extData.NEG & 0x4));
-
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        assert(!(instData.ABS & 0x4));
+        assert(!(extData.NEG & 0x4));
+
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19137,11 +18776,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19193,11 +18830,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19249,11 +18884,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19305,11 +18938,9 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19403,11 +19034,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -19445,11 +19074,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -19487,11 +19114,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -19529,11 +19154,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -19571,11 +19194,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -19613,11 +19234,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -19707,11 +19326,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -19749,11 +19366,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -19791,11 +19406,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -19833,11 +19446,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -19875,11 +19486,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -19917,11 +19526,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -20013,11 +19620,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20056,11 +19661,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20099,11 +19702,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20142,11 +19743,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20185,11 +19784,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20228,11 +19825,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20327,11 +19922,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20370,11 +19963,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20413,11 +20004,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20456,11 +20045,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20499,11 +20086,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20542,11 +20127,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20639,11 +20222,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -20681,11 +20262,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -20723,11 +20302,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -20765,11 +20342,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -20807,11 +20382,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -20849,11 +20422,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -20943,11 +20514,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -20985,11 +20554,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -21027,11 +20594,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -21069,11 +20634,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -21111,11 +20674,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -21153,11 +20714,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -21249,11 +20808,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21292,11 +20849,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21335,11 +20890,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21378,11 +20931,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21421,11 +20972,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21464,11 +21013,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21563,11 +21110,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21606,11 +21151,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21649,11 +21192,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21689,14 +21230,12 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x2));
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x1));
-        assert(!(extData.NEG & 0x2));
-        assert(!(extData.NEG & 0x4));
-
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        assert(!(extData.NEG & 0x2));
+        assert(!(extData.NEG & 0x4));
+
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21735,11 +21274,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21778,11 +21315,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21875,11 +21410,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -21917,11 +21450,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -21959,11 +21490,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -22001,11 +21530,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -22043,11 +21570,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -22085,11 +21610,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -22179,11 +21702,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     }
@@ -22221,11 +21742,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     }
@@ -22263,11 +21782,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     }
@@ -22305,11 +21822,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     }
@@ -22347,11 +21862,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     }
@@ -22389,11 +21902,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     }
@@ -22485,11 +21996,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22528,11 +22037,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22571,11 +22078,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22614,11 +22119,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22657,11 +22160,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22700,11 +22201,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22799,11 +22298,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22842,11 +22339,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22885,11 +22380,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22928,11 +22421,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22971,11 +22462,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23014,11 +22503,9 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23153,11 +22640,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     }
@@ -23207,11 +22691,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     }
@@ -23261,11 +22742,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     }
@@ -23682,11 +23160,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     }
@@ -23736,11 +23211,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     }
@@ -23777,11 +23249,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -23818,11 +23287,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -23859,11 +23325,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -23900,11 +23363,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -24067,11 +23527,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a & b; });
 
         vdst.write();
     }
@@ -24109,11 +23566,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a | b; });
 
         vdst.write();
     }
@@ -24151,11 +23605,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a ^ b; });
 
         vdst.write();
     }
@@ -24632,11 +24083,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     }
@@ -24673,11 +24121,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     }
@@ -24714,11 +24159,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     }
@@ -24755,11 +24197,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     }
@@ -24969,11 +24408,8 @@ namespace Gcn3ISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -25016,11 +24452,8 @@ namespace Gcn3ISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     }
@@ -25063,11 +24496,8 @@ namespace Gcn3ISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -25110,11 +24540,8 @@ namespace Gcn3ISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     }
@@ -27616,11 +27043,8 @@ namespace Gcn3ISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     }
@@ -27675,11 +27099,8 @@ namespace Gcn3ISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     }
@@ -28026,11 +27447,8 @@ namespace Gcn3ISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     }
@@ -28085,11 +27503,8 @@ namespace Gcn3ISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     }
@@ -29289,11 +28704,8 @@ namespace Gcn3ISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         //vdst.write();
     } // execute
@@ -29588,11 +29000,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return a * b + c; });
 
         vdst.write();
     }
@@ -29633,11 +29042,8 @@ namespace Gcn3ISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return a * b + c; });
 
         vdst.write();
     }
@@ -30141,11 +29547,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     }
@@ -30195,11 +29598,8 @@ namespace Gcn3ISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     }
@@ -6103,11 +6103,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a + b; });
         }
 
         vdst.write();
@@ -6139,11 +6136,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -6174,11 +6168,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -6208,11 +6199,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     } // execute
@@ -6505,11 +6493,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     } // execute
@@ -6539,11 +6524,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     } // execute
@@ -6572,11 +6554,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -6605,11 +6584,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -6638,11 +6614,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -6671,11 +6644,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -6875,11 +6845,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] & src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a & b; });
         }
 
         vdst.write();
@@ -6950,11 +6917,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a | b; });
         }
 
         vdst.write();
@@ -6985,11 +6949,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a ^ b; });
 
         vdst.write();
     } // execute
@@ -7622,11 +7583,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     } // execute
@@ -7656,11 +7614,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -7691,11 +7646,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -7725,11 +7677,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     } // execute
@@ -7906,11 +7855,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -7939,11 +7885,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -7972,11 +7915,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -8005,11 +7945,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -8098,11 +8035,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+                   [](auto a, auto b) { return a + b; });
         }
 
         vdst.write();
@@ -8132,11 +8066,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -8165,11 +8096,8 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -11713,11 +11641,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -11747,11 +11673,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -11781,11 +11705,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -11815,11 +11737,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -11884,11 +11804,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -11988,11 +11906,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
     } // execute
@@ -12057,11 +11973,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
     } // execute
@@ -12091,11 +12005,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
     } // execute
@@ -12125,11 +12037,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -12159,11 +12069,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
     } // execute
@@ -12254,11 +12162,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12290,11 +12196,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12326,11 +12230,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12362,11 +12264,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12435,11 +12335,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12547,11 +12445,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12620,11 +12516,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12656,11 +12550,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12692,11 +12584,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a == b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12728,11 +12618,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12823,11 +12711,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -12857,11 +12743,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -12891,11 +12775,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -12925,11 +12807,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -12994,11 +12874,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -13098,11 +12976,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         vcc.write();
     } // execute
@@ -13167,11 +13043,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         vcc.write();
     } // execute
@@ -13201,11 +13075,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         vcc.write();
     } // execute
@@ -13235,11 +13107,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -13269,11 +13139,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         vcc.write();
     } // execute
@@ -13364,11 +13232,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -13400,11 +13266,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -13436,11 +13300,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13472,11 +13334,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13545,11 +13405,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13657,11 +13515,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13730,11 +13586,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13766,11 +13620,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13802,11 +13654,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13838,11 +13688,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13931,11 +13779,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -13964,11 +13810,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -13997,11 +13841,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -14030,11 +13872,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -14063,11 +13903,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -14096,11 +13934,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -14185,11 +14021,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -14218,11 +14052,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -14251,11 +14083,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -14284,11 +14114,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -14317,11 +14145,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -14350,11 +14176,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -14442,11 +14266,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14477,11 +14299,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14512,11 +14332,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14547,11 +14365,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14582,11 +14398,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14617,11 +14431,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14712,11 +14524,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14747,11 +14557,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14782,11 +14590,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14817,11 +14623,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14852,11 +14656,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14887,11 +14689,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14979,11 +14779,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -15012,11 +14810,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -15045,11 +14841,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -15078,11 +14872,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -15111,11 +14903,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -15144,11 +14934,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -15233,11 +15021,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -15266,11 +15052,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -15299,11 +15083,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -15332,11 +15114,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -15365,11 +15145,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -15398,11 +15176,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -15490,11 +15266,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15525,11 +15299,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15560,11 +15332,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15595,11 +15365,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15630,11 +15398,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15665,11 +15431,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15760,11 +15524,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15795,11 +15557,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15830,11 +15590,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15865,11 +15623,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15900,11 +15656,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15935,11 +15689,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16027,11 +15779,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -16060,11 +15810,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -16093,11 +15841,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -16126,11 +15872,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -16159,11 +15903,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -16192,11 +15934,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -16281,11 +16021,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         vcc.write();
     } // execute
@@ -16314,11 +16052,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         vcc.write();
     } // execute
@@ -16347,11 +16083,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         vcc.write();
     } // execute
@@ -16380,11 +16114,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         vcc.write();
     } // execute
@@ -16413,11 +16145,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         vcc.write();
     } // execute
@@ -16446,11 +16176,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         vcc.write();
     } // execute
@@ -16538,11 +16266,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16573,12 +16299,10 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
-
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
+
         wf->execMask() = vcc.rawData();
         vcc.write();
     } // execute
@@ -16608,11 +16332,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16643,11 +16365,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16678,11 +16398,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16713,11 +16431,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16808,11 +16524,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16843,11 +16557,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16878,11 +16590,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16913,11 +16623,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16948,11 +16656,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16983,11 +16689,9 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        vcc.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -18406,11 +18110,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -18441,11 +18143,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -18476,11 +18176,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -18511,11 +18209,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -18546,11 +18242,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -18581,11 +18275,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -18686,11 +18378,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         sdst.write();
     } // execute
@@ -18757,11 +18447,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         sdst.write();
     } // execute
@@ -18792,11 +18480,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         sdst.write();
     } // execute
@@ -18827,11 +18513,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -18862,11 +18546,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         sdst.write();
     } // execute
@@ -18960,11 +18642,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18997,11 +18677,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19034,11 +18712,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19071,11 +18747,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19146,11 +18820,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19261,11 +18933,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19336,11 +19006,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19373,11 +19041,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19410,11 +19076,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19447,11 +19111,9 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19566,11 +19228,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -19623,11 +19283,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -19680,11 +19338,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -19737,11 +19393,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -19852,11 +19506,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -20023,11 +19675,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         sdst.write();
     } // execute
@@ -20138,11 +19788,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         sdst.write();
     } // execute
@@ -20195,11 +19843,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         sdst.write();
     } // execute
@@ -20252,11 +19898,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -20309,11 +19953,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         sdst.write();
     } // execute
@@ -20429,11 +20071,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20488,11 +20128,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20547,11 +20185,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20606,11 +20242,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20725,11 +20359,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20906,11 +20538,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a >= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21025,11 +20655,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a > b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21084,11 +20712,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a <= b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21140,14 +20766,12 @@ namespace VegaISA
         /**
          * input modifiers are supported by FP operations only
          */
-        assert(!(instData.ABS & 0x4));
-        assert(!(extData.NEG & 0x4));
-
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        assert(!(instData.ABS & 0x4));
+        assert(!(extData.NEG & 0x4));
+
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21202,11 +20826,9 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return !(a < b); }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21307,11 +20929,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -21351,11 +20971,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -21395,11 +21013,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -21439,11 +21055,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -21483,11 +21097,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -21527,11 +21139,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -21627,11 +21237,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -21671,11 +21279,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -21715,11 +21321,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -21759,11 +21363,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -21803,11 +21405,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -21847,11 +21447,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -21951,11 +21549,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21997,11 +21593,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22043,11 +21637,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22089,11 +21681,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22135,11 +21725,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22181,11 +21769,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22289,11 +21875,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22335,11 +21919,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22381,11 +21963,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22427,11 +22007,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22473,11 +22051,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22519,11 +22095,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22623,11 +22197,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -22667,11 +22239,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -22711,11 +22281,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -22755,11 +22323,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -22799,11 +22365,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -22843,11 +22407,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -22943,11 +22505,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -22987,11 +22547,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -23031,11 +22589,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -23075,11 +22631,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -23119,11 +22673,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -23163,11 +22715,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -23267,11 +22817,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23313,11 +22861,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23359,11 +22905,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23405,11 +22949,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23451,11 +22993,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23497,11 +23037,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23605,11 +23143,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23651,11 +23187,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23697,11 +23231,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23743,11 +23275,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23789,11 +23319,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23835,11 +23363,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23936,14 +23462,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x2));
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x1));
-        assert(!(extData.NEG & 0x2));
-        assert(!(extData.NEG & 0x4));
-
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        assert(!(extData.NEG & 0x2));
+        assert(!(extData.NEG & 0x4));
+
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -23983,11 +23507,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -24027,11 +23549,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -24071,11 +23591,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -24115,11 +23633,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -24159,11 +23675,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -24259,11 +23773,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         sdst.write();
     } // execute
@@ -24303,11 +23815,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         sdst.write();
     } // execute
@@ -24347,11 +23857,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         sdst.write();
     } // execute
@@ -24391,11 +23899,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         sdst.write();
     } // execute
@@ -24435,11 +23941,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         sdst.write();
     } // execute
@@ -24479,11 +23983,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         sdst.write();
     } // execute
@@ -24583,11 +24085,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24629,11 +24129,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24675,11 +24173,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24721,11 +24217,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24767,11 +24261,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24813,11 +24305,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24921,11 +24411,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a < b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24967,11 +24455,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a == b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25013,11 +24499,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a <= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25059,11 +24543,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a > b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25105,11 +24587,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a != b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25151,11 +24631,9 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        ScalarRegU64 exec_mask = wf->execMask().to_ullong();
+        sdst.setBits(exec_mask, laneCmp(exec_mask, src0, src1,
+            [](auto a, auto b) { return a >= b; }));
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25297,11 +24775,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     } // execute
@@ -25354,11 +24829,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -25411,11 +24883,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -25849,11 +25318,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     } // execute
@@ -25905,11 +25371,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     } // execute
@@ -25948,11 +25411,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -25991,11 +25451,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -26034,11 +25491,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -26077,11 +25531,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -26255,11 +25706,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a & b; });
 
         vdst.write();
     } // execute
@@ -26299,11 +25747,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a | b; });
 
         vdst.write();
     } // execute
@@ -26389,11 +25834,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a ^ b; });
 
         vdst.write();
     } // execute
@@ -26907,11 +26349,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     } // execute
@@ -26951,11 +26390,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -26996,11 +26432,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -27040,11 +26473,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a * b; });
 
         vdst.write();
     } // execute
@@ -27273,11 +26703,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -27322,11 +26749,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -27371,11 +26795,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -27420,11 +26841,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -27483,11 +26901,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a + b; });
 
         vdst.write();
     } // execute
@@ -27526,11 +26941,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -27569,11 +26981,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -30257,11 +29666,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -30318,11 +29724,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -30704,11 +30107,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -30765,11 +30165,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -32016,11 +31413,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         //vdst.write();
     } // execute
@@ -32606,11 +32000,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return a * b + c; });
 
         vdst.write();
     } // execute
@@ -32653,11 +32044,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1, src2,
+               [](auto a, auto b, auto c) { return a * b + c; });
 
         vdst.write();
     } // execute
@@ -33225,11 +32613,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     } // execute
@@ -33281,11 +32666,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        laneOp(wf->execMask().to_ullong(), vdst, src0, src1,
+               [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     } // execute
@@ -104,6 +104,8 @@ namespace VegaISA
             "Incorrect number of DWORDS for VEGA operand.");
 
       public:
+        typedef DataType ElemType;
+
         VecOperand() = delete;
 
         VecOperand(GPUDynInstPtr gpuDynInst, int opIdx)
@@ -300,6 +302,45 @@ namespace VegaISA
             }
         }
 
+        /**
+         * copy the value of every lane, with the source modifiers applied,
+         * into a dense array. the scalar and modifier checks done by the
+         * getter [] operator are hoisted out of the lane loop here, so the
+         * copy can be vectorized by the host compiler.
+         */
+        template<bool Condition = NumDwords == 1 || NumDwords == 2>
+        typename std::enable_if<Condition, void>::type
+        readLanes(DataType *lanes) const
+        {
+            if (scalar) {
+                DataType val = scRegData.rawData();
+                for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                    lanes[lane] = val;
+                }
+            } else {
+                auto vgpr = vecReg.template as<DataType>();
+                for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                    lanes[lane] = vgpr[lane];
+                }
+            }
+
+            if constexpr (std::is_floating_point_v<DataType>) {
+                if (absMod) {
+                    for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                        lanes[lane] = std::fabs(lanes[lane]);
+                    }
+                }
+
+                if (negMod) {
+                    for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                        lanes[lane] = -lanes[lane];
+                    }
+                }
+            } else {
+                assert(!absMod && !negMod);
+            }
+        }
+
         /**
          * setter [] operator. only enable if this operand is non-constant
          * (i.e, a destination operand) and if it can be represented using
@@ -493,6 +534,18 @@ namespace VegaISA
             replaceBits(sgpr, bit, bit_val);
         }
 
+        /**
+         * set all of the bits selected by mask to the corresponding bits
+         * of bit_vals at once, leaving the other bits unchanged.
+         */
+        template<bool Condition = NumDwords == 1 || NumDwords == 2>
+        typename std::enable_if<Condition, void>::type
+        setBits(DataType mask, DataType bit_vals)
+        {
+            DataType &sgpr = *((DataType*)srfData.data());
+            sgpr = (sgpr & ~mask) | (bit_vals & mask);
+        }
+
         template<bool Condition = (NumDwords == 1 || NumDwords == 2) && !Const>
         typename std::enable_if<Condition, ScalarOperand&>::type
         operator=(DataType rhs)
@@ -150,7 +150,7 @@ Walker::WalkerState::initState(BaseMMU::Mode _mode, Addr baseAddr, Addr vaddr,
     // Prepare the read packet that will be used at each level
     Request::Flags flags = Request::PHYSICAL;
 
-    RequestPtr request = std::make_shared<Request>(
+    RequestPtr request = Request::make(
         pde2Addr, dataSize, flags, walker->deviceRequestorId);
 
     read = new Packet(request, MemCmd::ReadReq);
@@ -217,7 +217,7 @@ Walker::WalkerState::stepWalk()
         //If we didn't return, we're setting up another read.
         Request::Flags flags = oldRead->req->getFlags();
         flags.set(Request::UNCACHEABLE, uncacheable);
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             nextRead, oldRead->getSize(), flags, walker->deviceRequestorId);
 
         read = new Packet(request, MemCmd::ReadReq);
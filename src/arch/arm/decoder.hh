@@ -97,6 +97,9 @@ class Decoder : public InstDecoder
     static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
+    /// A small direct-mapped cache in front of defaultCache.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
+
     /**
      * Pre-decode an instruction from the current state of the
      * decoder.
@@ -135,7 +138,9 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+            return defaultCache.decode(this, mach_inst, addr);
+        });
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
@@ -157,18 +162,21 @@ class Decoder : public InstDecoder
     {
         fpscrLen = fpscr.len;
         fpscrStride = fpscr.stride;
+        contextChanged();
     }
 
     void
     setSveLen(uint8_t len)
     {
         sveLen = len;
+        contextChanged();
     }
 
     void
     setSmeLen(uint8_t len)
     {
         smeLen = len;
+        contextChanged();
     }
 };
 
@@ -116,7 +116,8 @@ FsWorkload::initState()
     if (bootldr) {
         bool is_gic_v2 =
             arm_sys->getGIC()->supportsVersion(BaseGic::GicVersion::GIC_V2);
-        bootldr->buildImage().write(system->physProxy);
+        bootldr->buildImage().write(system->getPhysMem(),
+                                    system->physProxy);
 
         inform("Using bootloader at address %#x", bootldr->entryPoint());
 
@@ -39,7 +39,10 @@
 #include <stdint.h>
 
 #include <cassert>
+#include <cfenv>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include "base/logging.hh"
 #include "fplib.hh"
@@ -1911,6 +1914,267 @@ fp64_div(uint64_t a, uint64_t b, int mode, int *flags)
     return fp64_round(x_sgn, x_exp, x_mnt << 1 | !!c, mode, flags);
 }
 
+// Fast paths using the floating point hardware of the host, taken only
+// when it's guaranteed to give the same results and flags as the routines
+// above. That's the case in round to nearest mode when the operands are
+// normal numbers or zeroes, so that neither flushing them to zero nor NaN
+// propagation matters, and when so is the result, away from the lowest
+// binade so that no tiny result can be flushed to zero or raise an
+// underflow, unless it's an exact zero. The inexact flag is recovered
+// from the exact error of the operation, which is also computed by the
+// host, and the slow path is taken when that isn't possible either.
+
+static constexpr bool hostFpIEEE =
+    std::numeric_limits<float>::is_iec559 &&
+    std::numeric_limits<double>::is_iec559;
+
+static inline float
+fp32_to_host(uint32_t x)
+{
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline uint32_t
+fp32_from_host(float f)
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    return x;
+}
+
+static inline double
+fp64_to_host(uint64_t x)
+{
+    double f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline uint64_t
+fp64_from_host(double f)
+{
+    uint64_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    return x;
+}
+
+static inline bool
+fp32_fast_operand(uint32_t x)
+{
+    uint32_t exp = FP32_EXP(x);
+    return (exp && exp != FP32_EXP_INF) || !(x << 1);
+}
+
+static inline bool
+fp64_fast_operand(uint64_t x)
+{
+    uint64_t exp = FP64_EXP(x);
+    return (exp && exp != FP64_EXP_INF) || !(x << 1);
+}
+
+static inline bool
+fp32_fast_result(uint32_t x, bool inexact)
+{
+    uint32_t exp = FP32_EXP(x);
+    return (exp > 1 && exp != FP32_EXP_INF) || (!inexact && !(x << 1));
+}
+
+static inline bool
+fp64_fast_result(uint64_t x, bool inexact)
+{
+    uint64_t exp = FP64_EXP(x);
+    return (exp > 1 && exp != FP64_EXP_INF) || (!inexact && !(x << 1));
+}
+
+static inline bool
+fp_fast_mode(int mode)
+{
+    // The host is expected to be in round to nearest mode, but the VFP
+    // code changes it while emulating some instructions.
+    return hostFpIEEE && (mode & 3) == FPLIB_RN &&
+        std::fegetround() == FE_TONEAREST;
+}
+
+// The error of a rounded sum s = a + b, computed exactly (two-sum).
+template <typename T>
+static inline T
+fp_sum_error(T a, T b, T s)
+{
+    T bb = s - a;
+    return (a - (s - bb)) + (b - bb);
+}
+
+static bool
+fp32_fast_add(uint32_t a, uint32_t b, int neg, int mode, int *flags,
+              uint32_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp32_fast_operand(a) ||
+            !fp32_fast_operand(b)) {
+        return false;
+    }
+
+    float x = fp32_to_host(a);
+    float y = fp32_to_host(b ^ (uint32_t)neg << (FP32_BITS - 1));
+    float s = x + y;
+    bool inexact = fp_sum_error(x, y, s) != 0;
+    uint32_t r = fp32_from_host(s);
+    if (!fp32_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
+static bool
+fp64_fast_add(uint64_t a, uint64_t b, int neg, int mode, int *flags,
+              uint64_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp64_fast_operand(a) ||
+            !fp64_fast_operand(b)) {
+        return false;
+    }
+
+    double x = fp64_to_host(a);
+    double y = fp64_to_host(b ^ (uint64_t)neg << (FP64_BITS - 1));
+    double s = x + y;
+    bool inexact = fp_sum_error(x, y, s) != 0;
+    uint64_t r = fp64_from_host(s);
+    if (!fp64_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
+static bool
+fp32_fast_mul(uint32_t a, uint32_t b, int mode, int *flags,
+              uint32_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp32_fast_operand(a) ||
+            !fp32_fast_operand(b)) {
+        return false;
+    }
+
+    // The product of two singles is exact in double precision.
+    double p = (double)fp32_to_host(a) * fp32_to_host(b);
+    float m = p;
+    bool inexact = m != p;
+    uint32_t r = fp32_from_host(m);
+    if (!fp32_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
+static bool
+fp64_fast_mul(uint64_t a, uint64_t b, int mode, int *flags,
+              uint64_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp64_fast_operand(a) ||
+            !fp64_fast_operand(b)) {
+        return false;
+    }
+
+    double x = fp64_to_host(a);
+    double y = fp64_to_host(b);
+    double m = x * y;
+    uint64_t r = fp64_from_host(m);
+    // A zero product is exact if one of the operands is zero. Otherwise
+    // the error of the product is only exact if it doesn't underflow.
+    bool inexact;
+    if (!(r << 1))
+        inexact = (a << 1) && (b << 1);
+    else if (FP64_EXP(r) <= FP64_MANT_BITS + 1)
+        return false;
+    else
+        inexact = std::fma(x, y, -m) != 0;
+    if (!fp64_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
+static bool
+fp32_fast_muladd(uint32_t a, uint32_t b, uint32_t c, int mode, int *flags,
+                 uint32_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp32_fast_operand(a) ||
+            !fp32_fast_operand(b) || !fp32_fast_operand(c)) {
+        return false;
+    }
+
+    float z = fp32_to_host(a);
+    float x = fp32_to_host(b);
+    float y = fp32_to_host(c);
+    float m = std::fma(x, y, z);
+
+    // The result is exact if the product, which is exact in double
+    // precision, is m - z. That difference is d + e exactly, and the
+    // difference of the product and d is f + g exactly, which can only
+    // be e if g is zero.
+    double p = (double)x * y;
+    double d = (double)m - z;
+    double e = fp_sum_error((double)m, -(double)z, d);
+    double f = p - d;
+    double g = fp_sum_error(p, -d, f);
+    bool inexact = g != 0 || f != e;
+    uint32_t r = fp32_from_host(m);
+    if (!fp32_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
+static bool
+fp64_fast_muladd(uint64_t a, uint64_t b, uint64_t c, int mode, int *flags,
+                 uint64_t *result)
+{
+    if (!fp_fast_mode(mode) || !fp64_fast_operand(a) ||
+            !fp64_fast_operand(b) || !fp64_fast_operand(c)) {
+        return false;
+    }
+
+    double z = fp64_to_host(a);
+    double x = fp64_to_host(b);
+    double y = fp64_to_host(c);
+    double m = std::fma(x, y, z);
+
+    bool inexact;
+    if (!(b << 1) || !(c << 1)) {
+        // A zero product leaves the addend as it is.
+        inexact = false;
+    } else {
+        // The result is exact if the product is m - z. When that
+        // difference d is exact, which it is when m and z are close,
+        // the product is d only if fma(x, y, -d) is zero, provided that
+        // the product isn't too small for any difference to be seen.
+        int exp = FP64_EXP(b) + FP64_EXP(c) - 2 * FP64_EXP_BIAS;
+        if (exp < 1 - FP64_EXP_BIAS + 2 * (FP64_MANT_BITS + 1))
+            return false;
+        double d = m - z;
+        if (fp_sum_error(m, -z, d) != 0)
+            return false;
+        inexact = std::fma(x, y, -d) != 0;
+    }
+    uint64_t r = fp64_from_host(m);
+    if (!fp64_fast_result(r, inexact))
+        return false;
+
+    *flags |= inexact ? FPLIB_IXC : 0;
+    *result = r;
+    return true;
+}
+
 static void
 set_fpscr0(FPSCR &fpscr, int flags)
 {
@@ -2403,7 +2667,10 @@ uint32_t
 fplibAdd(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint32_t result = fp32_add(op1, op2, 0, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint32_t result;
+    if (!fp32_fast_add(op1, op2, 0, mode, &flags, &result))
+        result = fp32_add(op1, op2, 0, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -2413,7 +2680,10 @@ uint64_t
 fplibAdd(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint64_t result = fp64_add(op1, op2, 0, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint64_t result;
+    if (!fp64_fast_add(op1, op2, 0, mode, &flags, &result))
+        result = fp64_add(op1, op2, 0, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -2888,7 +3158,10 @@ uint32_t
 fplibMulAdd(uint32_t addend, uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint32_t result = fp32_muladd(addend, op1, op2, 0, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint32_t result;
+    if (!fp32_fast_muladd(addend, op1, op2, mode, &flags, &result))
+        result = fp32_muladd(addend, op1, op2, 0, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -2898,7 +3171,10 @@ uint64_t
 fplibMulAdd(uint64_t addend, uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint64_t result = fp64_muladd(addend, op1, op2, 0, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint64_t result;
+    if (!fp64_fast_muladd(addend, op1, op2, mode, &flags, &result))
+        result = fp64_muladd(addend, op1, op2, 0, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3378,7 +3654,10 @@ uint32_t
 fplibMul(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint32_t result = fp32_mul(op1, op2, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint32_t result;
+    if (!fp32_fast_mul(op1, op2, mode, &flags, &result))
+        result = fp32_mul(op1, op2, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3388,7 +3667,10 @@ uint64_t
 fplibMul(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint64_t result = fp64_mul(op1, op2, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint64_t result;
+    if (!fp64_fast_mul(op1, op2, mode, &flags, &result))
+        result = fp64_mul(op1, op2, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4348,7 +4630,10 @@ uint32_t
 fplibSub(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint32_t result = fp32_add(op1, op2, 1, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint32_t result;
+    if (!fp32_fast_add(op1, op2, 1, mode, &flags, &result))
+        result = fp32_add(op1, op2, 1, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4358,7 +4643,10 @@ uint64_t
 fplibSub(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
     int flags = 0;
-    uint64_t result = fp64_add(op1, op2, 1, modeConv(fpscr), &flags);
+    int mode = modeConv(fpscr);
+    uint64_t result;
+    if (!fp64_fast_add(op1, op2, 1, mode, &flags, &result))
+        result = fp64_add(op1, op2, 1, mode, &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -49,6 +49,13 @@ class BaseMMU(SimObject):
     itb = Param.BaseTLB("Instruction TLB")
     dtb = Param.BaseTLB("Data TLB")
 
+    translation_cache_size = Param.Unsigned(
+        0,
+        "Entries of the direct mapped cache of translations the atomic "
+        "accesses use before the TLBs, 0 to disable it. It speeds up the "
+        "atomic CPUs, but the TLBs and their stats don't see the hits.",
+    )
+
     @classmethod
     def walkerPorts(cls):
         # This classmethod is used by the BaseCPU. It should return
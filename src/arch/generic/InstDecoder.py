@@ -34,3 +34,8 @@ class InstDecoder(SimObject):
     cxx_class = "gem5::InstDecoder"
 
     isa = Param.BaseISA(NULL, "ISA object for this context")
+    decode_cache_size = Param.Unsigned(
+        0,
+        "Number of entries in the direct-mapped L0 decode cache "
+        "(power of 2, 0 disables it)",
+    )
@@ -49,6 +49,14 @@ class InstDecoder : public SimObject
     bool instDone = false;
     bool outOfBytes = true;
 
+    /**
+     * Version of the decoding context, see contextVersion(). Decoders
+     * must call contextChanged() when their context changes.
+     */
+    uint64_t _contextVersion = 0;
+
+    void contextChanged() { ++_contextVersion; }
+
   public:
     template <typename MoreBytesType>
     InstDecoder(const InstDecoderParams &params, MoreBytesType *mb_buf) :
@@ -90,12 +98,24 @@ class InstDecoder : public SimObject
     {
         instDone = old->instDone;
         outOfBytes = old->outOfBytes;
+        contextChanged();
     }
 
     void *moreBytesPtr() const { return _moreBytesPtr; }
     size_t moreBytesSize() const { return _moreBytesSize; }
     Addr pcMask() const { return _pcMask; }
 
+    /**
+     * Get the version of the decoding context.
+     *
+     * The version changes whenever state outside of the PC and the
+     * instruction bytes that affects decoding (e.g., the execution mode
+     * or the vector length) changes. CPU models that keep decoded
+     * instructions outside of the decoder use it to detect when they
+     * become stale.
+     */
+    uint64_t contextVersion() const { return _contextVersion; }
+
     /**
      * Is an instruction ready to be decoded?
      *
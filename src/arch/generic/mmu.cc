@@ -91,6 +91,8 @@ BaseMMU::flushAll()
     for (auto tlb : unified) {
         tlb->flushAll();
     }
+
+    translationCache.flush();
 }
 
 void
@@ -98,13 +100,42 @@ BaseMMU::demapPage(Addr vaddr, uint64_t asn)
 {
     itb->demapPage(vaddr, asn);
     dtb->demapPage(vaddr, asn);
+    translationCache.invalidate(vaddr);
 }
 
 Fault
 BaseMMU::translateAtomic(const RequestPtr &req, ThreadContext *tc,
                          BaseMMU::Mode mode)
 {
-    return getTlb(mode)->translateAtomic(req, tc, mode);
+    uint64_t context;
+    if (!translationCache.enabled() ||
+            !translationContext(req, tc, mode, context)) {
+        return getTlb(mode)->translateAtomic(req, tc, mode);
+    }
+
+    const Addr vaddr = req->getVaddr();
+    Addr paddr;
+    uint64_t flags;
+    if (translationCache.lookup(vaddr, context, mode, paddr, flags)) {
+        req->setPaddr(paddr);
+        req->setFlags(flags);
+        return NoFault;
+    }
+
+    const uint64_t old_flags = req->getFlags();
+    Fault fault = getTlb(mode)->translateAtomic(req, tc, mode);
+
+    // Leave out the device and special accesses, which aren't frequent
+    // and may be handled outside of the page tables.
+    if (fault == NoFault && !req->isLocalAccess() &&
+            !req->isStrictlyOrdered() &&
+            (req->getPaddr() & TranslationCache::PageMask) ==
+            (vaddr & TranslationCache::PageMask)) {
+        translationCache.insert(vaddr, context, mode, req->getPaddr(),
+                                req->getFlags() & ~old_flags);
+    }
+
+    return fault;
 }
 
 void
@@ -144,7 +175,7 @@ BaseMMU::MMUTranslationGen::translate(Range &range) const
         next += pageBytes;
     range.size = std::min(range.size, next - range.vaddr);
 
-    auto req = std::make_shared<Request>(
+    auto req = Request::make(
             range.vaddr, range.size, flags, Request::funcRequestorId, 0, cid);
 
     range.fault = mmu->translateFunctional(req, tc, mode);
@@ -169,6 +200,8 @@ BaseMMU::takeOverFrom(BaseMMU *old_mmu)
 
     itb->takeOverFrom(old_mmu->itb);
     dtb->takeOverFrom(old_mmu->dtb);
+
+    translationCache.flush();
 }
 
 } // namespace gem5
@@ -40,6 +40,7 @@
 
 #include <set>
 
+#include "arch/generic/translation_cache.hh"
 #include "mem/request.hh"
 #include "mem/translation_gen.hh"
 #include "params/BaseMMU.hh"
@@ -88,7 +89,8 @@ class BaseMMU : public SimObject
     typedef BaseMMUParams Params;
 
     BaseMMU(const Params &p)
-      : SimObject(p), dtb(p.dtb), itb(p.itb)
+      : SimObject(p), dtb(p.dtb), itb(p.itb),
+        translationCache(p.translation_cache_size)
     {}
 
     BaseTLB*
@@ -182,6 +184,30 @@ class BaseMMU : public SimObject
     std::set<BaseTLB*> data;
     std::set<BaseTLB*> unified;
 
+    /**
+     * The translations of the atomic accesses, which skip the TLBs when
+     * they hit. Only the ISAs implementing translationContext() use it.
+     */
+    TranslationCache translationCache;
+
+    /**
+     * Get the context of an access for the translation cache, which must
+     * differ whenever the translation of the same address and mode may
+     * differ, e.g., when the page tables or privilege level change.
+     *
+     * @param req The request to translate.
+     * @param tc The thread context of the access.
+     * @param mode The access mode.
+     * @param context Set to the context of the access.
+     * @return Whether the access may use the translation cache.
+     */
+    virtual bool
+    translationContext(const RequestPtr &req, ThreadContext *tc, Mode mode,
+                       uint64_t &context) const
+    {
+        return false;
+    }
+
 };
 
 } // namespace gem5
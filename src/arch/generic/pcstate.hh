@@ -82,6 +82,15 @@ class PCStateBase : public Serializable
     }
 
     virtual PCStateBase *clone() const = 0;
+
+    /**
+     * Force this PC to reflect a particular value, resetting all its other
+     * fields around it. This is useful for in place (re)initialization.
+     *
+     * @param val The value to set the PC to.
+     */
+    virtual void set(Addr val) = 0;
+
     virtual void
     update(const PCStateBase &other)
     {
@@ -359,7 +368,7 @@ class SimplePCState : public PCStateWithNext
      * @param val The value to set the PC to.
      */
     void
-    set(Addr val)
+    set(Addr val) override
     {
         this->pc(val);
         this->npc(val + InstWidth);
@@ -402,7 +411,7 @@ class UPCState : public SimplePCState<InstWidth>
     }
 
     void
-    set(Addr val)
+    set(Addr val) override
     {
         Base::set(val);
         this->upc(0);
@@ -473,7 +482,7 @@ class DelaySlotPCState : public SimplePCState<InstWidth>
     void nnpc(Addr val) { _nnpc = val; }
 
     void
-    set(Addr val)
+    set(Addr val) override
     {
         Base::set(val);
         nnpc(val + 2 * InstWidth);
@@ -547,7 +556,7 @@ class DelaySlotUPCState : public DelaySlotPCState<InstWidth>
     }
 
     void
-    set(Addr val)
+    set(Addr val) override
     {
         Base::set(val);
         this->upc(0);
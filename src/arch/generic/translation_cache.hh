@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_TRANSLATION_CACHE_HH__
+#define __ARCH_GENERIC_TRANSLATION_CACHE_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A direct mapped cache of translations kept by an MMU in front of its
+ * TLBs, to translate the accesses of the atomic CPUs without going
+ * through the TLB models. The translations are cached per 4KiB page,
+ * which is a part of a page for all the ISAs, and are tagged with the
+ * access mode and a context, a value standing for all the state the
+ * translation depends on besides the address (e.g., the page table base
+ * and privilege level). The cache doesn't know which pages the entries
+ * came from, so it must be flushed whenever the TLBs are.
+ */
+class TranslationCache
+{
+  public:
+    static constexpr unsigned PageShift = 12;
+    static constexpr Addr PageMask = (Addr(1) << PageShift) - 1;
+
+  private:
+    struct Entry
+    {
+        Addr vpn = MaxAddr;
+        uint64_t context = 0;
+        unsigned mode = 0;
+        Addr ppn = 0;
+        uint64_t flags = 0;
+    };
+
+    std::vector<Entry> entries;
+    Addr indexMask;
+
+    /** The number of access modes, which have separate entries. */
+    static constexpr unsigned NumModes = 4;
+
+    Entry &
+    entry(Addr vpn, unsigned mode)
+    {
+        return entries[((vpn ^ (vpn >> 10)) * NumModes + mode) & indexMask];
+    }
+
+  public:
+    /**
+     * @param size The number of entries, a power of 2 or 0 to disable
+     * the cache.
+     */
+    explicit TranslationCache(size_t size)
+        : entries(size), indexMask(size - 1)
+    {
+        fatal_if(size && !isPowerOf2(size),
+                 "The translation cache size (%d) must be a power of 2.",
+                 size);
+    }
+
+    bool enabled() const { return !entries.empty(); }
+
+    /**
+     * Look up the translation of an address.
+     *
+     * @param vaddr The virtual address.
+     * @param context The context of the translation.
+     * @param mode The access mode.
+     * @param paddr Set to the physical address on a hit.
+     * @param flags Set to the request flags the translation sets on a hit.
+     * @return Whether the translation was found.
+     */
+    bool
+    lookup(Addr vaddr, uint64_t context, unsigned mode, Addr &paddr,
+           uint64_t &flags)
+    {
+        const Addr vpn = vaddr >> PageShift;
+        const Entry &e = entry(vpn, mode);
+        if (e.vpn != vpn || e.context != context || e.mode != mode)
+            return false;
+        paddr = (e.ppn << PageShift) | (vaddr & PageMask);
+        flags = e.flags;
+        return true;
+    }
+
+    /**
+     * Cache a translation, replacing the one it conflicts with. The
+     * physical address must be at the same offset in its page as the
+     * virtual address.
+     */
+    void
+    insert(Addr vaddr, uint64_t context, unsigned mode, Addr paddr,
+           uint64_t flags)
+    {
+        assert(mode < NumModes);
+        assert((vaddr & PageMask) == (paddr & PageMask));
+        const Addr vpn = vaddr >> PageShift;
+        entry(vpn, mode) = { vpn, context, mode, paddr >> PageShift, flags };
+    }
+
+    /** Drop the translations of the page of a virtual address. */
+    void
+    invalidate(Addr vaddr)
+    {
+        const Addr vpn = vaddr >> PageShift;
+        for (unsigned mode = 0; mode < NumModes; mode++) {
+            Entry &e = entry(vpn, mode);
+            if (e.vpn == vpn)
+                e = Entry();
+        }
+    }
+
+    /** Drop all the translations. */
+    void
+    flush()
+    {
+        for (auto &e : entries)
+            e = Entry();
+    }
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_TRANSLATION_CACHE_HH__
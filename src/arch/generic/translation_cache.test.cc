@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "arch/generic/translation_cache.hh"
+
+using namespace gem5;
+
+/** A disabled cache has no entries. */
+TEST(TranslationCacheTest, Disabled)
+{
+    TranslationCache cache(0);
+    EXPECT_FALSE(cache.enabled());
+}
+
+/** A cached translation applies to the whole page. */
+TEST(TranslationCacheTest, Hit)
+{
+    TranslationCache cache(64);
+    Addr paddr = 0;
+    uint64_t flags = 0;
+
+    EXPECT_TRUE(cache.enabled());
+    EXPECT_FALSE(cache.lookup(0x7f001234, 1, 0, paddr, flags));
+    cache.insert(0x7f001234, 1, 0, 0x5234, 0x8);
+    ASSERT_TRUE(cache.lookup(0x7f001ff0, 1, 0, paddr, flags));
+    EXPECT_EQ(paddr, 0x5ff0);
+    EXPECT_EQ(flags, 0x8);
+    EXPECT_FALSE(cache.lookup(0x7f002000, 1, 0, paddr, flags));
+}
+
+/** Translations are tagged with their context and mode. */
+TEST(TranslationCacheTest, ContextAndMode)
+{
+    TranslationCache cache(64);
+    Addr paddr = 0;
+    uint64_t flags = 0;
+
+    cache.insert(0x1000, 1, 0, 0x3000, 0);
+    EXPECT_FALSE(cache.lookup(0x1000, 2, 0, paddr, flags));
+    EXPECT_FALSE(cache.lookup(0x1000, 1, 1, paddr, flags));
+
+    cache.insert(0x1000, 1, 1, 0x4000, 0);
+    ASSERT_TRUE(cache.lookup(0x1000, 1, 0, paddr, flags));
+    EXPECT_EQ(paddr, 0x3000);
+    ASSERT_TRUE(cache.lookup(0x1000, 1, 1, paddr, flags));
+    EXPECT_EQ(paddr, 0x4000);
+}
+
+/** Invalidating a page drops all its modes, and flushing everything. */
+TEST(TranslationCacheTest, Invalidate)
+{
+    TranslationCache cache(64);
+    Addr paddr = 0;
+    uint64_t flags = 0;
+
+    cache.insert(0x1000, 1, 0, 0x3000, 0);
+    cache.insert(0x1000, 1, 2, 0x3000, 0);
+    cache.insert(0x2000, 1, 0, 0x4000, 0);
+    cache.invalidate(0x1abc);
+    EXPECT_FALSE(cache.lookup(0x1000, 1, 0, paddr, flags));
+    EXPECT_FALSE(cache.lookup(0x1000, 1, 2, paddr, flags));
+    EXPECT_TRUE(cache.lookup(0x2000, 1, 0, paddr, flags));
+
+    cache.flush();
+    EXPECT_FALSE(cache.lookup(0x2000, 1, 0, paddr, flags));
+}
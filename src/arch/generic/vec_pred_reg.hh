@@ -39,12 +39,14 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 #include "base/cprintf.hh"
 #include "base/types.hh"
+#include "sim/byteswap.hh"
 #include "sim/serialize_handlers.hh"
 
 namespace gem5
@@ -122,6 +124,23 @@ class VecPredRegT
         return container[idx * (Packed ? 1 : sizeof(VecElem))];
     }
 
+    /// Return a mask with all its bits set if an element is active, and
+    /// clear otherwise. The predicate of the element is read as a single
+    /// integer, so that the host compiler can vectorize loops that blend
+    /// their results with the mask.
+    VecElem
+    activeMask(size_t idx) const
+    {
+        static_assert(std::is_integral_v<VecElem> && !Packed,
+                      "Masks are only available for unpacked integers");
+        std::make_unsigned_t<VecElem> bits;
+        std::memcpy(&bits, &container[idx * sizeof(VecElem)],
+                    sizeof(VecElem));
+        constexpr unsigned first = HostByteOrder == ByteOrder::little ?
+            0 : 8 * (sizeof(VecElem) - 1);
+        return -VecElem((bits >> first) & 1);
+    }
+
     /// Return an element of the predicate register as it appears
     /// in the raw (untyped) internal representation
     uint8_t
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_WALK_CACHE_HH__
+#define __ARCH_GENERIC_WALK_CACHE_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A direct mapped cache of the non-leaf entries of a page table level,
+ * a paging-structure cache in x86 terms, which lets a page table walker
+ * skip the levels above it. An entry maps the virtual address bits
+ * translated by the levels down to this one (the tag) to the physical
+ * address of the next level table, and keeps whatever flags the walker
+ * accumulated along the way. The entries are also tagged with a context,
+ * usually the address of the root table. Like the TLBs, the cache isn't
+ * kept coherent with the page tables, so it must be flushed whenever the
+ * TLBs are.
+ */
+class WalkCache
+{
+  private:
+    struct Entry
+    {
+        bool valid = false;
+        Addr tag = 0;
+        uint64_t context = 0;
+        Addr table = 0;
+        uint64_t flags = 0;
+    };
+
+    std::vector<Entry> entries;
+    Addr indexMask;
+
+    const Entry &
+    entry(Addr tag) const
+    {
+        return entries[(tag ^ (tag >> 9)) & indexMask];
+    }
+
+    Entry &
+    entry(Addr tag)
+    {
+        return entries[(tag ^ (tag >> 9)) & indexMask];
+    }
+
+  public:
+    /**
+     * @param size The number of entries, a power of 2 or 0 to disable
+     * the cache.
+     */
+    explicit WalkCache(size_t size)
+        : entries(size), indexMask(size - 1)
+    {
+        fatal_if(size && !isPowerOf2(size),
+                 "The walk cache size (%d) must be a power of 2.", size);
+    }
+
+    bool enabled() const { return !entries.empty(); }
+
+    /**
+     * Look up the next level table of a part of the address space.
+     *
+     * @param tag The virtual address bits translated down to this level.
+     * @param context The context of the walk.
+     * @param table Set to the address of the next level table on a hit.
+     * @param flags Set to the flags of the entry on a hit.
+     * @return Whether the entry was found.
+     */
+    bool
+    lookup(Addr tag, uint64_t context, Addr &table, uint64_t &flags) const
+    {
+        const Entry &e = entry(tag);
+        if (!e.valid || e.tag != tag || e.context != context)
+            return false;
+        table = e.table;
+        flags = e.flags;
+        return true;
+    }
+
+    /** Cache an entry, replacing the one it conflicts with. */
+    void
+    insert(Addr tag, uint64_t context, Addr table, uint64_t flags)
+    {
+        entry(tag) = { true, tag, context, table, flags };
+    }
+
+    /** Drop all the entries. */
+    void
+    flush()
+    {
+        for (auto &e : entries)
+            e = Entry();
+    }
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_WALK_CACHE_HH__
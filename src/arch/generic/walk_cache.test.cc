@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "arch/generic/walk_cache.hh"
+
+using namespace gem5;
+
+/** A disabled cache has no entries. */
+TEST(WalkCacheTest, Disabled)
+{
+    WalkCache cache(0);
+    EXPECT_FALSE(cache.enabled());
+}
+
+/** An entry is found by its tag and context. */
+TEST(WalkCacheTest, Hit)
+{
+    WalkCache cache(16);
+    Addr table = 0;
+    uint64_t flags = 0;
+
+    EXPECT_TRUE(cache.enabled());
+    EXPECT_FALSE(cache.lookup(0x12, 0x1000, table, flags));
+    cache.insert(0x12, 0x1000, 0x5000, 0x3);
+    ASSERT_TRUE(cache.lookup(0x12, 0x1000, table, flags));
+    EXPECT_EQ(table, 0x5000);
+    EXPECT_EQ(flags, 0x3);
+    EXPECT_FALSE(cache.lookup(0x12, 0x2000, table, flags));
+    EXPECT_FALSE(cache.lookup(0x13, 0x1000, table, flags));
+}
+
+/** A tag of zero isn't mistaken for an empty entry. */
+TEST(WalkCacheTest, ZeroTag)
+{
+    WalkCache cache(16);
+    Addr table = 0;
+    uint64_t flags = 0;
+
+    EXPECT_FALSE(cache.lookup(0, 0, table, flags));
+    cache.insert(0, 0, 0x7000, 0);
+    ASSERT_TRUE(cache.lookup(0, 0, table, flags));
+    EXPECT_EQ(table, 0x7000);
+}
+
+/** Conflicting entries replace each other, and flushing drops them all. */
+TEST(WalkCacheTest, ReplaceAndFlush)
+{
+    WalkCache cache(16);
+    Addr table = 0;
+    uint64_t flags = 0;
+
+    cache.insert(0x1, 0, 0x1000, 0);
+    cache.insert(0x11, 0, 0x2000, 0);
+    EXPECT_FALSE(cache.lookup(0x1, 0, table, flags));
+    ASSERT_TRUE(cache.lookup(0x11, 0, table, flags));
+    EXPECT_EQ(table, 0x2000);
+
+    cache.insert(0x2, 0, 0x3000, 0);
+    cache.flush();
+    EXPECT_FALSE(cache.lookup(0x11, 0, table, flags));
+    EXPECT_FALSE(cache.lookup(0x2, 0, table, flags));
+}
@@ -176,6 +176,36 @@ class Template(object):
                     op_wb_str = op_desc.op_wb + op_wb_str
             myDict["op_wb"] = op_wb_str
 
+            # An instruction can define its execute method as a template
+            # on the type of the exec context, executeImpl(XC *xc, ...).
+            # These declare and define the execute methods that call it
+            # for the generic exec context, and for the exec context of
+            # the simple CPUs so that its register accesses are inlined.
+            myDict["exec_variants_decl"] = """
+        template <class XC>
+        Fault executeImpl(XC *, trace::InstRecord *) const;
+        Fault execute(ExecContext *, trace::InstRecord *) const override;
+        Fault executeSimple(SimpleExecContext *,
+                trace::InstRecord *) const override;
+            """
+            myDict["exec_variants"] = """
+    Fault
+    %(class_name)s::execute(ExecContext *xc,
+        trace::InstRecord *traceData) const
+    {
+        return executeImpl(xc, traceData);
+    }
+
+    Fault
+    %(class_name)s::executeSimple(SimpleExecContext *xc,
+        trace::InstRecord *traceData) const
+    {
+        return executeImpl(xc, traceData);
+    }
+            """ % {
+                "class_name": d.class_name
+            }
+
         elif isinstance(d, dict):
             # if the argument is a dictionary, we just use it.
             myDict.update(d)
@@ -720,6 +750,7 @@ class ISAParser(Grammar):
                 assert fn in self.files
                 f.write(f'#include "{fn}"\n')
                 f.write('#include "cpu/exec_context.hh"\n')
+                f.write('#include "cpu/simple/exec_context.hh"\n')
                 f.write('#include "decoder.hh"\n')
 
                 fn = "exec-ns.cc.inc"
@@ -54,7 +54,8 @@ class Decoder : public InstDecoder
     uint32_t machInst;
 
   public:
-    Decoder(const MipsDecoderParams &p) : InstDecoder(p, &machInst)
+    Decoder(const MipsDecoderParams &p) : InstDecoder(p, &machInst),
+        l0Cache(this, p.decode_cache_size)
     {}
 
     //Use this to give data to the decoder. This should be used
@@ -71,6 +72,9 @@ class Decoder : public InstDecoder
     static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
+    /// A small direct-mapped cache in front of defaultCache.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
+
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
     /// Decode a machine instruction.
@@ -79,7 +83,9 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+            return defaultCache.decode(this, mach_inst, addr);
+        });
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
@@ -52,7 +52,9 @@ class Decoder : public InstDecoder
     ExtMachInst emi;
 
   public:
-    Decoder(const PowerDecoderParams &p) : InstDecoder(p, &emi) {}
+    Decoder(const PowerDecoderParams &p) : InstDecoder(p, &emi),
+        l0Cache(this, p.decode_cache_size)
+    {}
 
     // Use this to give data to the predecoder. This should be used
     // when there is control flow.
@@ -68,6 +70,9 @@ class Decoder : public InstDecoder
     static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
+    /// A small direct-mapped cache in front of defaultCache.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
+
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
     /// Decode a machine instruction.
@@ -76,7 +81,9 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+            return defaultCache.decode(this, mach_inst, addr);
+        });
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
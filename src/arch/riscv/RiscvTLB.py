@@ -45,6 +45,17 @@ class RiscvPagetableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         4, "Number of outstanding walks that can be squashed per cycle"
     )
+    level1_cache_entries = Param.Unsigned(
+        0, "Number of cached level 1 PTEs (a power of 2, 0 to disable)"
+    )
+    level2_cache_entries = Param.Unsigned(
+        0, "Number of cached level 2 PTEs (a power of 2, 0 to disable)"
+    )
+    fast_walk = Param.Bool(
+        False,
+        "Walk the page table with functional accesses when the memory "
+        "system is in atomic mode, e.g. while fast-forwarding",
+    )
     # Grab the pma_checker from the MMU
     pma_checker = Param.PMAChecker(Parent.any, "PMA Checker")
     pmp = Param.PMP(Parent.any, "PMP")
@@ -61,7 +61,8 @@ BareMetal::initState()
 {
     Workload::initState();
 
-    warn_if(!bootloader->buildImage().write(system->physProxy),
+    warn_if(!bootloader->buildImage().write(system->getPhysMem(),
+                                              system->physProxy),
             "Could not load sections to memory.");
 
     for (auto *tc: system->threads) {
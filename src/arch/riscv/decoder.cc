@@ -86,9 +86,12 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
-    StaticInstPtr &si = instMap[mach_inst];
-    if (!si)
-        si = decodeInst(mach_inst);
+    StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+        StaticInstPtr &entry = instMap[mach_inst];
+        if (!entry)
+            entry = decodeInst(mach_inst);
+        return entry;
+    });
 
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
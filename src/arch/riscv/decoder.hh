@@ -51,6 +51,8 @@ class Decoder : public InstDecoder
 {
   private:
     decode_cache::InstMap<ExtMachInst> instMap;
+    /// A small direct-mapped cache in front of instMap.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
     bool aligned;
     bool mid;
 
@@ -67,7 +69,8 @@ class Decoder : public InstDecoder
     StaticInstPtr decode(ExtMachInst mach_inst, Addr addr);
 
   public:
-    Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst)
+    Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst),
+        l0Cache(this, p.decode_cache_size)
     {
         reset();
     }
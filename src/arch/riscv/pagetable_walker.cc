@@ -69,6 +69,21 @@ namespace gem5
 
 namespace RiscvISA {
 
+Walker::WalkerStats::WalkerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(walkCacheHits, statistics::units::Count::get(),
+               "Walks started below the root with a cached PTE of a level"),
+      ADD_STAT(walkCacheMisses, statistics::units::Count::get(),
+               "Lookups which missed in the cache of a level")
+{
+    walkCacheHits.init(NumWalkCacheLevels);
+    walkCacheMisses.init(NumWalkCacheLevels);
+    for (auto *stat: {&walkCacheHits, &walkCacheMisses}) {
+        stat->subname(0, "level1");
+        stat->subname(1, "level2");
+    }
+}
+
 Fault
 Walker::start(ThreadContext * _tc, BaseMMU::Translation *_translation,
               const RequestPtr &_req, BaseMMU::Mode _mode)
@@ -245,15 +260,24 @@ Walker::WalkerState::startWalk()
         timingFault = NoFault;
         sendPackets();
     } else {
+        // A fast walk reads the page table straight from wherever its
+        // latest copy is, leaving the state of the caches alone.
         do {
-            walker->port.sendAtomic(read);
+            if (walker->fastWalk)
+                walker->port.sendFunctional(read);
+            else
+                walker->port.sendAtomic(read);
             PacketPtr write = NULL;
             fault = stepWalk(write);
             assert(fault == NoFault || read == NULL);
             state = nextState;
             nextState = Ready;
-            if (write)
-                walker->port.sendAtomic(write);
+            if (write) {
+                if (walker->fastWalk)
+                    walker->port.sendFunctional(write);
+                else
+                    walker->port.sendAtomic(write);
+            }
         } while (read);
         state = Ready;
         nextState = Waiting;
@@ -388,6 +412,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
                     Addr idx = (entry.vaddr >> shift) & LEVEL_MASK;
                     nextRead = (pte.ppn << PageShift) + (idx * sizeof(pte));
                     nextState = Translate;
+                    cacheWalkEntry(pte);
                 }
             }
         }
@@ -424,7 +449,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
     }
     else {
         //If we didn't return, we're setting up another read.
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             nextRead, oldRead->getSize(), flags, walker->requestorId);
 
         delete oldRead;
@@ -448,6 +473,44 @@ Walker::WalkerState::endWalk()
     read = NULL;
 }
 
+void
+Walker::WalkerState::cacheWalkEntry(PTESv39 pte)
+{
+    // The walk has already moved to the level below the entry.
+    const int cached = level + 1;
+    WalkCache &cache = walker->walkCaches[cached - 1];
+    if (functional || !cache.enabled())
+        return;
+
+    Addr shift = PageShift + LEVEL_BITS * cached;
+    cache.insert(entry.vaddr >> shift, satp.ppn, pte.ppn << PageShift, 0);
+}
+
+bool
+Walker::WalkerState::resumeCachedWalk(Addr vaddr, Addr &topAddr)
+{
+    for (int cached = 1; cached <= NumWalkCacheLevels; cached++) {
+        WalkCache &cache = walker->walkCaches[cached - 1];
+        if (!cache.enabled())
+            continue;
+
+        Addr shift = PageShift + LEVEL_BITS * cached;
+        Addr table;
+        uint64_t flags;
+        if (!cache.lookup(vaddr >> shift, satp.ppn, table, flags)) {
+            walker->stats.walkCacheMisses[cached - 1]++;
+            continue;
+        }
+
+        walker->stats.walkCacheHits[cached - 1]++;
+        level = cached - 1;
+        Addr idx = (vaddr >> (shift - LEVEL_BITS)) & LEVEL_MASK;
+        topAddr = table + (idx * sizeof(PTESv39));
+        return true;
+    }
+    return false;
+}
+
 void
 Walker::WalkerState::setupWalk(Addr vaddr)
 {
@@ -457,6 +520,8 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     Addr idx = (vaddr >> shift) & LEVEL_MASK;
     Addr topAddr = (satp.ppn << PageShift) + (idx * sizeof(PTESv39));
     level = 2;
+    if (!functional)
+        resumeCachedWalk(vaddr, topAddr);
 
     DPRINTF(PageTableWalker, "Performing table walk for address %#x\n", vaddr);
     DPRINTF(PageTableWalker, "Loading level%d PTE from %#x\n", level, topAddr);
@@ -467,7 +532,7 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     entry.asid = satp.asid;
 
     Request::Flags flags = Request::PHYSICAL;
-    RequestPtr request = std::make_shared<Request>(
+    RequestPtr request = Request::make(
         topAddr, sizeof(PTESv39), flags, walker->requestorId);
 
     read = new Packet(request, MemCmd::ReadReq);
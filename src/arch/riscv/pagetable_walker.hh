@@ -39,13 +39,16 @@
 #ifndef __ARCH_RISCV_TABLE_WALKER_HH__
 #define __ARCH_RISCV_TABLE_WALKER_HH__
 
+#include <array>
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/walk_cache.hh"
 #include "arch/riscv/pagetable.hh"
 #include "arch/riscv/pma_checker.hh"
 #include "arch/riscv/pmp.hh"
 #include "arch/riscv/tlb.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
 #include "params/RiscvPagetableWalker.hh"
@@ -140,6 +143,8 @@ namespace RiscvISA
 
           private:
             void setupWalk(Addr vaddr);
+            bool resumeCachedWalk(Addr vaddr, Addr &topAddr);
+            void cacheWalkEntry(PTESv39 pte);
             Fault stepWalk(PacketPtr &write);
             void sendPackets();
             void endWalk();
@@ -180,6 +185,26 @@ namespace RiscvISA
         // The number of outstanding walks that can be squashed per cycle.
         unsigned numSquashable;
 
+        // Whether atomic walks use functional accesses.
+        bool fastWalk;
+
+        /**
+         * The caches of the non-leaf PTEs of the levels above the last
+         * one, indexed by the level of the cached PTEs minus one. Each
+         * maps the virtual address bits translated down to its level to
+         * the next level table.
+         */
+        static constexpr int NumWalkCacheLevels = 2;
+        std::array<WalkCache, NumWalkCacheLevels> walkCaches;
+
+        struct WalkerStats : public statistics::Group
+        {
+            WalkerStats(statistics::Group *parent);
+
+            statistics::Vector walkCacheHits;
+            statistics::Vector walkCacheMisses;
+        } stats;
+
         // Wrapper for checking for squashes before starting a translation.
         void startWalkWrapper();
 
@@ -200,6 +225,14 @@ namespace RiscvISA
             tlb = _tlb;
         }
 
+        // Drop the cached PTEs along with the TLB entries.
+        void
+        flushWalkCaches()
+        {
+            for (auto &cache : walkCaches)
+                cache.flush();
+        }
+
         using Params = RiscvPagetableWalkerParams;
 
         Walker(const Params &params) :
@@ -209,6 +242,10 @@ namespace RiscvISA
             pmp(params.pmp),
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
+            fastWalk(params.fast_walk),
+            walkCaches{WalkCache(params.level1_cache_entries),
+                       WalkCache(params.level2_cache_entries)},
+            stats(this),
             startWalkWrapperEvent([this]{ startWalkWrapper(); }, name())
         {
         }
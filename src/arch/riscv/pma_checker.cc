@@ -37,6 +37,9 @@
 
 #include "arch/riscv/pma_checker.hh"
 
+#include <algorithm>
+
+
 #include "base/addr_range.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
@@ -51,6 +54,23 @@ PMAChecker::PMAChecker(const Params &params) :
 SimObject(params),
 uncacheable(params.uncacheable.begin(), params.uncacheable.end())
 {
+    updateUncacheableSpan();
+}
+
+void
+PMAChecker::updateUncacheableSpan()
+{
+    if (uncacheable.empty()) {
+        uncacheableSpan = AddrRange(0, 0);
+        return;
+    }
+
+    Addr start = MaxAddr, end = 0;
+    for (auto const &uncacheable_range: uncacheable) {
+        start = std::min(start, uncacheable_range.start());
+        end = std::max(end, uncacheable_range.end());
+    }
+    uncacheableSpan = AddrRange(start, end);
 }
 
 void
@@ -64,6 +84,9 @@ PMAChecker::check(const RequestPtr &req)
 bool
 PMAChecker::isUncacheable(const AddrRange &range)
 {
+    if (!range.isSubset(uncacheableSpan))
+        return false;
+
     for (auto const &uncacheable_range: uncacheable) {
         if (range.isSubset(uncacheable_range)) {
             return true;
@@ -89,6 +112,7 @@ void
 PMAChecker::takeOverFrom(PMAChecker *old)
 {
     uncacheable = old->uncacheable;
+    updateUncacheableSpan();
 }
 
 } // namespace gem5
@@ -79,6 +79,16 @@ class PMAChecker : public SimObject
     bool isUncacheable(PacketPtr pkt);
 
     void takeOverFrom(PMAChecker *old);
+
+  protected:
+    /**
+     * Smallest address range covering all uncacheable ranges. Most
+     * accesses fall outside of it and are rejected without scanning
+     * the list.
+     */
+    AddrRange uncacheableSpan;
+
+    void updateUncacheableSpan();
 };
 
 } // namespace gem5
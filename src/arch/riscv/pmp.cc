@@ -28,6 +28,9 @@
  */
 
 #include "arch/riscv/pmp.hh"
+
+#include <algorithm>
+
 #include "arch/generic/tlb.hh"
 #include "arch/riscv/faults.hh"
 #include "arch/riscv/isa.hh"
@@ -48,7 +51,9 @@ PMP::PMP(const Params &params) :
     SimObject(params),
     pmpEntries(params.pmp_entries),
     numRules(0),
-    hasLockEntry(false)
+    hasLockEntry(false),
+    pmpRulesValid(false),
+    lastRule(-1)
 {
     pmpTable.resize(pmpEntries);
 }
@@ -71,45 +76,34 @@ PMP::pmpCheck(const RequestPtr &req, BaseMMU::Mode mode,
                 req->getPaddr());
     }
 
-    // match_index will be used to identify the pmp entry
-    // which matched for the given address
-    int match_index = -1;
+    if (!pmpRulesValid)
+        pmpBuildRules();
+
+    // according to specs address is only matched,
+    // when (addr) and (addr + request_size - 1) are both
+    // within the pmp range
+    const Addr first_addr = req->getPaddr();
+    const Addr last_addr = first_addr + req->getSize() - 1;
+    auto matches = [first_addr, last_addr](const PmpRule &rule) {
+        return first_addr >= rule.start && first_addr < rule.end &&
+            last_addr >= rule.start && last_addr < rule.end;
+    };
+
+    // Consecutive accesses tend to hit the same region. The last
+    // rule is only remembered if no other rule can take precedence
+    // over it, so it can be applied without scanning the table.
+    if (lastRule >= 0 && matches(pmpRules[lastRule])) {
+        return pmpApplyRule(pmpRules[lastRule].cfg, req, mode, pmode,
+                            vaddr);
+    }
 
     // all pmp entries need to be looked from the lowest to
     // the highest number
-    for (int i = 0; i < pmpTable.size(); i++) {
-        AddrRange pmp_range = pmpTable[i].pmpAddr;
-        if (pmp_range.contains(req->getPaddr()) &&
-                pmp_range.contains(req->getPaddr() + req->getSize() - 1)) {
-            // according to specs address is only matched,
-            // when (addr) and (addr + request_size - 1) are both
-            // within the pmp range
-            match_index = i;
-        }
-
-        if ((match_index > -1)
-            && (PMP_OFF != pmpGetAField(pmpTable[match_index].pmpCfg))) {
-            uint8_t this_cfg = pmpTable[match_index].pmpCfg;
-
-            if ((pmode == RiscvISA::PrivilegeMode::PRV_M) &&
-                                    (PMP_LOCK & this_cfg) == 0) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Read) &&
-                                        (PMP_READ & this_cfg)) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Write) &&
-                                        (PMP_WRITE & this_cfg)) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Execute) &&
-                                        (PMP_EXEC & this_cfg)) {
-                return NoFault;
-            } else {
-                if (req->hasVaddr()) {
-                    return createAddrfault(req->getVaddr(), mode);
-                } else {
-                    return createAddrfault(vaddr, mode);
-                }
-            }
+    for (size_t i = 0; i < pmpRules.size(); i++) {
+        if (matches(pmpRules[i])) {
+            if (pmpRules[i].isolated)
+                lastRule = i;
+            return pmpApplyRule(pmpRules[i].cfg, req, mode, pmode, vaddr);
         }
     }
     // if no entry matched and we are not in M mode return fault
@@ -122,6 +116,57 @@ PMP::pmpCheck(const RequestPtr &req, BaseMMU::Mode mode,
     }
 }
 
+Fault
+PMP::pmpApplyRule(uint8_t cfg, const RequestPtr &req, BaseMMU::Mode mode,
+                  RiscvISA::PrivilegeMode pmode, Addr vaddr)
+{
+    if ((pmode == RiscvISA::PrivilegeMode::PRV_M) &&
+                            (PMP_LOCK & cfg) == 0) {
+        return NoFault;
+    } else if ((mode == BaseMMU::Mode::Read) &&
+                                (PMP_READ & cfg)) {
+        return NoFault;
+    } else if ((mode == BaseMMU::Mode::Write) &&
+                                (PMP_WRITE & cfg)) {
+        return NoFault;
+    } else if ((mode == BaseMMU::Mode::Execute) &&
+                                (PMP_EXEC & cfg)) {
+        return NoFault;
+    } else if (req->hasVaddr()) {
+        return createAddrfault(req->getVaddr(), mode);
+    } else {
+        return createAddrfault(vaddr, mode);
+    }
+}
+
+void
+PMP::pmpBuildRules()
+{
+    pmpRules.clear();
+    lastRule = -1;
+
+    for (const auto &entry : pmpTable) {
+        if (PMP_OFF == pmpGetAField(entry.pmpCfg))
+            continue;
+
+        PmpRule rule;
+        rule.start = entry.pmpAddr.start();
+        rule.end = entry.pmpAddr.end();
+        rule.cfg = entry.pmpCfg;
+        rule.isolated = true;
+        for (const auto &prev : pmpRules) {
+            if (std::max(prev.start, rule.start) <
+                    std::min(prev.end, rule.end)) {
+                rule.isolated = false;
+                break;
+            }
+        }
+        pmpRules.push_back(rule);
+    }
+
+    pmpRulesValid = true;
+}
+
 Fault
 PMP::createAddrfault(Addr vaddr, BaseMMU::Mode mode)
 {
@@ -209,6 +254,7 @@ PMP::pmpUpdateRule(uint32_t pmp_index)
     }
 
     pmpTable[pmp_index].pmpAddr = this_range;
+    pmpRulesValid = false;
 
     for (int i = 0; i < pmpEntries; i++) {
         const uint8_t a_field = pmpGetAField(pmpTable[i].pmpCfg);
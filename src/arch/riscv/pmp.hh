@@ -112,6 +112,37 @@ class PMP : public SimObject
     /** a table of pmp entries */
     std::vector<PmpEntry> pmpTable;
 
+    /**
+     * An active (not PMP_OFF) pmp entry reduced to what pmpCheck
+     * needs to match an access against it.
+     */
+    struct PmpRule
+    {
+        /** first address of the region */
+        Addr start;
+        /** one past the last address of the region */
+        Addr end;
+        /** pmpcfg reg value of the entry */
+        uint8_t cfg;
+        /**
+         * true if no higher priority rule overlaps this one, so any
+         * access within the region is decided by this rule alone
+         */
+        bool isolated;
+    };
+
+    /**
+     * active rules in priority order, rebuilt lazily from pmpTable
+     * after pmpcfg/pmpaddr updates
+     */
+    std::vector<PmpRule> pmpRules;
+
+    /** true if pmpRules reflects the current pmp table */
+    bool pmpRulesValid;
+
+    /** index in pmpRules of the isolated rule that matched last */
+    int lastRule;
+
   public:
     /**
      * pmpCheck checks if a particular memory access
@@ -177,6 +208,25 @@ class PMP : public SimObject
      */
     Fault createAddrfault(Addr vaddr, BaseMMU::Mode mode);
 
+    /**
+     * pmpBuildRules rebuilds pmpRules from the pmp table.
+     */
+    void pmpBuildRules();
+
+    /**
+     * pmpApplyRule checks an access against the permissions of
+     * the pmp entry that matched it.
+     * @param cfg pmpcfg register value of the matching entry.
+     * @param req memory request.
+     * @param mode mode of request (read, write, execute).
+     * @param pmode current privilege mode of memory (U, S, M).
+     * @param vaddr vaddr of the original request, see pmpCheck().
+     * @return Fault.
+     */
+    Fault pmpApplyRule(uint8_t cfg, const RequestPtr &req,
+                       BaseMMU::Mode mode, RiscvISA::PrivilegeMode pmode,
+                       Addr vaddr);
+
     /**
      * pmpUpdateRule updates the pmp rule for a
      * given pmp entry depending on the value
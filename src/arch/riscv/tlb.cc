@@ -193,6 +193,7 @@ TLB::demapPage(Addr vpn, uint64_t asid)
                 }
             }
         }
+        walker->flushWalkCaches();
     }
 }
 
@@ -204,6 +205,7 @@ TLB::flushAll()
         if (tlb[i].trieHandle)
             remove(i);
     }
+    walker->flushWalkCaches();
 }
 
 void
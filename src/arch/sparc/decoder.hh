@@ -53,7 +53,9 @@ class Decoder : public InstDecoder
     RegVal asi = 0;
 
   public:
-    Decoder(const SparcDecoderParams &p) : InstDecoder(p, &machInst) {}
+    Decoder(const SparcDecoderParams &p) : InstDecoder(p, &machInst),
+        l0Cache(this, p.decode_cache_size)
+    {}
 
     // Use this to give data to the predecoder. This should be used
     // when there is control flow.
@@ -79,6 +81,7 @@ class Decoder : public InstDecoder
     setContext(RegVal _asi)
     {
         asi = _asi;
+        contextChanged();
     }
 
   protected:
@@ -86,6 +89,9 @@ class Decoder : public InstDecoder
     static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
+    /// A small direct-mapped cache in front of defaultCache.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
+
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
     /// Decode a machine instruction.
@@ -94,7 +100,9 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+            return defaultCache.decode(this, mach_inst, addr);
+        });
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
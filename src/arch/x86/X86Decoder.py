@@ -23,6 +23,7 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+from m5.params import *
 from m5.objects.InstDecoder import InstDecoder
 
 
@@ -30,3 +31,9 @@ class X86Decoder(InstDecoder):
     type = "X86Decoder"
     cxx_class = "gem5::X86ISA::Decoder"
     cxx_header = "arch/x86/decoder.hh"
+
+    decode_cache_file = Param.String(
+        "",
+        "File of machine instructions to decode at startup, and to record "
+        "the decoded ones to at exit (empty to disable)",
+    )
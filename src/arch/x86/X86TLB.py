@@ -38,6 +38,8 @@ from m5.proxy import *
 
 from m5.objects.BaseTLB import BaseTLB
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 
 
 class X86PagetableWalker(ClockedObject):
@@ -50,6 +52,20 @@ class X86PagetableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         4, "Number of outstanding walks that can be squashed per cycle"
     )
+    pml4_cache_entries = Param.Unsigned(
+        0, "Number of cached PML4 entries (a power of 2, 0 to disable)"
+    )
+    pdp_cache_entries = Param.Unsigned(
+        0, "Number of cached PDP entries (a power of 2, 0 to disable)"
+    )
+    pd_cache_entries = Param.Unsigned(
+        0, "Number of cached PD entries (a power of 2, 0 to disable)"
+    )
+    fast_walk = Param.Bool(
+        False,
+        "Walk the page table with functional accesses when the memory "
+        "system is in atomic mode, e.g. while fast-forwarding",
+    )
 
 
 class X86TLB(BaseTLB):
@@ -58,6 +74,19 @@ class X86TLB(BaseTLB):
     cxx_header = "arch/x86/tlb.hh"
 
     size = Param.Unsigned(64, "TLB size")
+    assoc = Param.Unsigned(
+        Self.size, "TLB associativity, its size for a fully associative TLB"
+    )
+    indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(entry_size=1, assoc=Parent.assoc, size=Parent.size),
+        "Indexing policy of the TLB",
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of the TLB"
+    )
+    # An X86TLB can also be the next_level of the instruction and data
+    # TLBs, as a second level TLB they share and fill on walks. Its own
+    # walker is then unused.
     system = Param.System(Parent.any, "system object")
     walker = Param.X86PagetableWalker(
         X86PagetableWalker(), "page table walker"
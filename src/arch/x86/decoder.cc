@@ -28,12 +28,18 @@
 
 #include "arch/x86/decoder.hh"
 
+#include <set>
+#include <string>
+#include <vector>
+
 #include "arch/x86/regs/misc.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
+#include "cpu/decode_cache_file.hh"
 #include "debug/Decode.hh"
 #include "debug/Decoder.hh"
+#include "sim/core.hh"
 
 namespace gem5
 {
@@ -674,18 +680,56 @@ Decoder::doImmediateState()
 Decoder::InstBytes Decoder::dummy;
 Decoder::InstCacheMap Decoder::instCacheMap;
 
+void
+Decoder::loadInstFile(const std::string &path)
+{
+    static std::set<std::string> loaded;
+    if (!loaded.insert(path).second)
+        return;
+
+    // The decoder configuration is part of each record, so only the
+    // layout of the machine instructions needs to match
+    struct Record
+    {
+        CacheKey m5Reg;
+        ExtMachInst emi;
+    };
+    static const std::string tag = "x86";
+
+    decode_cache::InstFile file(path, tag, sizeof(Record));
+    for (size_t i = 0; i < file.size(); ++i) {
+        Record record = file.get<Record>(i);
+        auto *&inst_map = instCacheMap[record.m5Reg];
+        if (!inst_map)
+            inst_map = new decode_cache::InstMap<ExtMachInst>;
+        auto &si = (*inst_map)[record.emi];
+        if (!si)
+            si = decodeInst(record.emi);
+    }
+    DPRINTF(Decoder, "Decoded %d instructions from %s.\n",
+            file.size(), path);
+
+    registerExitCallback([path]() {
+        std::vector<Record> records;
+        for (const auto &[m5_reg, inst_map] : instCacheMap) {
+            for (const auto &entry : *inst_map)
+                records.push_back({m5_reg, entry.first});
+        }
+        decode_cache::InstFile::write(path, tag, records);
+    });
+}
+
 StaticInstPtr
 Decoder::decode(ExtMachInst mach_inst, Addr addr)
 {
-    StaticInstPtr si;
-
-    auto iter = instMap->find(mach_inst);
-    if (iter != instMap->end()) {
-        si = iter->second;
-    } else {
-        si = decodeInst(mach_inst);
-        (*instMap)[mach_inst] = si;
-    }
+    StaticInstPtr si = l0Cache.decode(mach_inst, addr, [&]() {
+        auto iter = instMap->find(mach_inst);
+        if (iter != instMap->end())
+            return iter->second;
+        StaticInstPtr decoded = decodeInst(mach_inst);
+        (*instMap)[mach_inst] = decoded;
+        return decoded;
+    });
 
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
@@ -30,6 +30,7 @@
 #define __ARCH_X86_DECODER_HH__
 
 #include <cassert>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -246,8 +247,16 @@ class Decoder : public InstDecoder
             CacheKey, decode_cache::InstMap<ExtMachInst> *> InstCacheMap;
     static InstCacheMap instCacheMap;
 
+    /// A small direct-mapped cache in front of instMap.
+    decode_cache::L0Cache<ExtMachInst> l0Cache;
+
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
+    /// Decode the instructions recorded in a decode cache file, and
+    /// record all the decoded instructions back to it at exit.
+    /// @param path The file, shared by the decoders that name it.
+    void loadInstFile(const std::string &path);
+
     /// Decode a machine instruction.
     /// @param mach_inst The binary instruction to decode.
     /// @retval A pointer to the corresponding StaticInst object.
@@ -256,12 +265,16 @@ class Decoder : public InstDecoder
     void process();
 
   public:
-    Decoder(const X86DecoderParams &p) : InstDecoder(p, &fetchChunk)
+    Decoder(const X86DecoderParams &p) : InstDecoder(p, &fetchChunk),
+        l0Cache(this, p.decode_cache_size)
     {
         emi.reset();
         emi.mode.cpl = cpl;
         emi.mode.mode = mode;
         emi.mode.submode = submode;
+
+        if (!p.decode_cache_file.empty())
+            loadInstFile(p.decode_cache_file);
     }
 
     void
@@ -278,6 +291,7 @@ class Decoder : public InstDecoder
         altAddr = m5Reg.altAddr;
         defAddr = m5Reg.defAddr;
         stack = m5Reg.stack;
+        contextChanged();
 
         AddrCacheMap::iterator amIter = addrCacheMap.find(m5Reg);
         if (amIter != addrCacheMap.end()) {
@@ -287,6 +301,7 @@ class Decoder : public InstDecoder
             addrCacheMap[m5Reg] = decodePages;
         }
 
+        auto *old_inst_map = instMap;
         InstCacheMap::iterator imIter = instCacheMap.find(m5Reg);
         if (imIter != instCacheMap.end()) {
             instMap = imIter->second;
@@ -294,6 +309,10 @@ class Decoder : public InstDecoder
             instMap = new decode_cache::InstMap<ExtMachInst>;
             instCacheMap[m5Reg] = instMap;
         }
+
+        // Instructions decoded in another mode might decode differently.
+        if (instMap != old_inst_map)
+            l0Cache.clear();
     }
 
     void
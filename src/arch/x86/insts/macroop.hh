@@ -65,6 +65,7 @@ class MacroopBase : public X86StaticInst
     {
         assert(numMicroops);
         microops = new StaticInstPtr[numMicroops];
+        setMicroopTable(microops, numMicroops);
         flags[IsMacroop] = true;
     }
 
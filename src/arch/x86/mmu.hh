@@ -39,9 +39,11 @@
 #define __ARCH_X86_MMU_HH__
 
 #include "arch/generic/mmu.hh"
+#include "arch/x86/ldstflags.hh"
 #include "arch/x86/page_size.hh"
+#include "arch/x86/regs/misc.hh"
 #include "arch/x86/tlb.hh"
-
+#include "cpu/thread_context.hh"
 #include "params/X86MMU.hh"
 
 namespace gem5
@@ -61,6 +63,7 @@ class MMU : public BaseMMU
     {
         static_cast<TLB*>(itb)->flushNonGlobal();
         static_cast<TLB*>(dtb)->flushNonGlobal();
+        translationCache.flush();
     }
 
     Walker*
@@ -76,6 +79,35 @@ class MMU : public BaseMMU
         return TranslationGenPtr(new MMUTranslationGen(
                 PageBytes, start, size, tc, this, mode, flags));
     }
+
+  protected:
+    bool
+    translationContext(const RequestPtr &req, ThreadContext *tc, Mode mode,
+                       uint64_t &context) const override
+    {
+        const Request::Flags flags = req->getFlags();
+
+        // Leave out the internal address spaces, and the reads checking
+        // they could write, which fault like writes.
+        if ((flags & SegmentFlagMask) == segment_idx::Ms ||
+                (flags & Request::READ_MODIFY_WRITE)) {
+            return false;
+        }
+
+        // Only 64 bit mode with paging, where there are no segment
+        // checks and the translation only depends on the page tables.
+        HandyM5Reg m5_reg = tc->readMiscRegNoEffect(misc_reg::M5Reg);
+        if (!m5_reg.prot || !m5_reg.paging || m5_reg.mode != LongMode ||
+                m5_reg.submode != SixtyFourBitMode) {
+            return false;
+        }
+
+        const bool in_user = m5_reg.cpl == 3 && !(flags & CPL0FlagBit);
+        CR0 cr0 = tc->readMiscRegNoEffect(misc_reg::Cr0);
+        context = (tc->readMiscRegNoEffect(misc_reg::Cr3) << 2) |
+            (in_user << 1) | cr0.wp;
+        return true;
+    }
 };
 
 } // namespace X86ISA
@@ -68,6 +68,31 @@ namespace gem5
 
 namespace X86ISA {
 
+namespace
+{
+
+// The lowest virtual address bit translated by each cached level.
+constexpr unsigned walkCacheShift[] = { 39, 30, 21 };
+
+} // anonymous namespace
+
+Walker::WalkerStats::WalkerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(walkCacheHits, statistics::units::Count::get(),
+               "Walks started below the root with a cached entry of a "
+               "level"),
+      ADD_STAT(walkCacheMisses, statistics::units::Count::get(),
+               "Lookups which missed in the cache of a level")
+{
+    walkCacheHits.init(NumWalkCacheLevels);
+    walkCacheMisses.init(NumWalkCacheLevels);
+    for (auto *stat: {&walkCacheHits, &walkCacheMisses}) {
+        stat->subname(PML4Level, "pml4");
+        stat->subname(PDPLevel, "pdp");
+        stat->subname(PDLevel, "pd");
+    }
+}
+
 Fault
 Walker::start(ThreadContext * _tc, BaseMMU::Translation *_translation,
               const RequestPtr &_req, BaseMMU::Mode _mode)
@@ -239,15 +264,24 @@ Walker::WalkerState::startWalk()
         timingFault = NoFault;
         sendPackets();
     } else {
+        // A fast walk reads the page table straight from wherever its
+        // latest copy is, leaving the state of the caches alone.
         do {
-            walker->port.sendAtomic(read);
+            if (walker->fastWalk)
+                walker->port.sendFunctional(read);
+            else
+                walker->port.sendAtomic(read);
             PacketPtr write = NULL;
             fault = stepWalk(write);
             assert(fault == NoFault || read == NULL);
             state = nextState;
             nextState = Ready;
-            if (write)
-                walker->port.sendAtomic(write);
+            if (write) {
+                if (walker->fastWalk)
+                    walker->port.sendFunctional(write);
+                else
+                    walker->port.sendAtomic(write);
+            }
         } while (read);
         state = Ready;
         nextState = Waiting;
@@ -312,6 +346,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
         }
         entry.noExec = pte.nx;
         nextState = LongPDP;
+        cacheWalkEntry(PML4Level, pte);
         break;
       case LongPDP:
         DPRINTF(PageTableWalker, "Got long mode PDP entry %#016x.\n", pte);
@@ -326,6 +361,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
             break;
         }
         nextState = LongPD;
+        cacheWalkEntry(PDPLevel, pte);
         break;
       case LongPD:
         DPRINTF(PageTableWalker, "Got long mode PD entry %#016x.\n", pte);
@@ -343,6 +379,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
             entry.logBytes = 12;
             nextRead = mbits(pte, 51, 12) + vaddr.longl1 * dataSize;
             nextState = LongPTE;
+            cacheWalkEntry(PDLevel, pte);
             break;
         } else {
             // 2 MB page
@@ -526,7 +563,7 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
         //If we didn't return, we're setting up another read.
         Request::Flags flags = oldRead->req->getFlags();
         flags.set(Request::UNCACHEABLE, uncacheable);
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             nextRead, oldRead->getSize(), flags, walker->requestorId);
         read = new Packet(request, MemCmd::ReadReq);
         read->allocate();
@@ -555,6 +592,81 @@ Walker::WalkerState::endWalk()
     read = NULL;
 }
 
+void
+Walker::WalkerState::cacheWalkEntry(unsigned level, PageTableEntry pte)
+{
+    anyNX = anyNX || pte.nx;
+
+    WalkCache &cache = walker->walkCaches[level];
+    // Functional walks don't set the accessed bits, which walks starting
+    // from a cached entry would never get to set.
+    if (functional || !cache.enabled())
+        return;
+
+    uint64_t flags = 0;
+    if (entry.writable)
+        flags |= CachedWritable;
+    if (entry.user)
+        flags |= CachedUser;
+    if (entry.noExec)
+        flags |= CachedNoExec;
+    if (anyNX)
+        flags |= CachedAnyNX;
+    if (pte.pcd)
+        flags |= CachedUncacheable;
+    cache.insert(entry.vaddr >> walkCacheShift[level], walkRoot,
+                 mbits(pte, 51, 12), flags);
+}
+
+bool
+Walker::WalkerState::resumeCachedWalk(VAddr addr, Addr &topAddr,
+                                      bool &uncacheable)
+{
+    for (int level = PDLevel; level >= PML4Level; level--) {
+        WalkCache &cache = walker->walkCaches[level];
+        if (!cache.enabled())
+            continue;
+
+        Addr table;
+        uint64_t flags;
+        if (!cache.lookup(addr >> walkCacheShift[level], walkRoot,
+                          table, flags)) {
+            walker->stats.walkCacheMisses[level]++;
+            continue;
+        }
+        // Fetches from no execute pages fault at the level which forbids
+        // them, so walk the whole table to find it.
+        if ((flags & CachedAnyNX) && enableNX && mode == BaseMMU::Execute)
+            return false;
+
+        walker->stats.walkCacheHits[level]++;
+        entry.writable = flags & CachedWritable;
+        entry.user = flags & CachedUser;
+        entry.noExec = flags & CachedNoExec;
+        anyNX = flags & CachedAnyNX;
+        uncacheable = flags & CachedUncacheable;
+        switch (level) {
+          case PML4Level:
+            state = LongPDP;
+            topAddr = table + addr.longl3 * dataSize;
+            break;
+          case PDPLevel:
+            state = LongPD;
+            topAddr = table + addr.longl2 * dataSize;
+            break;
+          default:
+            state = LongPTE;
+            entry.logBytes = 12;
+            topAddr = table + addr.longl1 * dataSize;
+            break;
+        }
+        DPRINTF(PageTableWalker, "Resuming walk of %#x at state %d.\n",
+                addr, state);
+        return true;
+    }
+    return false;
+}
+
 void
 Walker::WalkerState::setupWalk(Addr vaddr)
 {
@@ -565,11 +677,18 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     Efer efer = tc->readMiscRegNoEffect(misc_reg::Efer);
     dataSize = 8;
     Addr topAddr;
+    // PCD can't be used if CR4.PCIDE=1 [sec 2.5
+    // of Intel's Software Developer's manual]
+    bool uncacheable = !cr4.pcide && cr3.pcd;
     if (efer.lma) {
         // Do long mode.
         state = LongPML4;
         topAddr = (cr3.longPdtb << 12) + addr.longl4 * dataSize;
         enableNX = efer.nxe;
+        walkRoot = cr3.longPdtb << 12;
+        anyNX = false;
+        if (!functional)
+            resumeCachedWalk(addr, topAddr, uncacheable);
     } else {
         // We're in some flavor of legacy mode.
         if (cr4.pae) {
@@ -595,13 +714,10 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     entry.vaddr = vaddr;
 
     Request::Flags flags = Request::PHYSICAL;
-
-    // PCD can't be used if CR4.PCIDE=1 [sec 2.5
-    // of Intel's Software Developer's manual]
-    if (!cr4.pcide && cr3.pcd)
+    if (uncacheable)
         flags.set(Request::UNCACHEABLE);
 
-    RequestPtr request = std::make_shared<Request>(
+    RequestPtr request = Request::make(
         topAddr, dataSize, flags, walker->requestorId);
 
     read = new Packet(request, MemCmd::ReadReq);
@@ -38,11 +38,14 @@
 #ifndef __ARCH_X86_PAGE_TABLE_WALKER_HH__
 #define __ARCH_X86_PAGE_TABLE_WALKER_HH__
 
+#include <array>
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/walk_cache.hh"
 #include "arch/x86/pagetable.hh"
 #include "arch/x86/tlb.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
 #include "params/X86PagetableWalker.hh"
@@ -115,6 +118,10 @@ namespace X86ISA
             bool retrying;
             bool started;
             bool squashed;
+            // The root of the long mode page table and whether any of the
+            // entries walked so far were marked no execute.
+            Addr walkRoot;
+            bool anyNX;
           public:
             WalkerState(Walker * _walker, BaseMMU::Translation *_translation,
                         const RequestPtr &_req, bool _isFunctional = false) :
@@ -140,6 +147,9 @@ namespace X86ISA
 
           private:
             void setupWalk(Addr vaddr);
+            bool resumeCachedWalk(VAddr addr, Addr &topAddr,
+                                  bool &uncacheable);
+            void cacheWalkEntry(unsigned level, PageTableEntry pte);
             Fault stepWalk(PacketPtr &write);
             void sendPackets();
             void endWalk();
@@ -178,6 +188,43 @@ namespace X86ISA
         // The number of outstanding walks that can be squashed per cycle.
         unsigned numSquashable;
 
+        // Whether atomic walks use functional accesses.
+        bool fastWalk;
+
+        /**
+         * The paging-structure caches of the long mode page table levels
+         * which point to another table, indexed by the level of the
+         * cached entries. Each maps the virtual address bits translated
+         * down to its level to the next level table.
+         */
+        enum WalkCacheLevel
+        {
+            PML4Level,
+            PDPLevel,
+            PDLevel,
+            NumWalkCacheLevels
+        };
+
+        // The permissions accumulated down to a cached entry.
+        enum WalkCacheFlags : uint64_t
+        {
+            CachedWritable = 0x1,
+            CachedUser = 0x2,
+            CachedNoExec = 0x4,
+            CachedAnyNX = 0x8,
+            CachedUncacheable = 0x10
+        };
+
+        std::array<WalkCache, NumWalkCacheLevels> walkCaches;
+
+        struct WalkerStats : public statistics::Group
+        {
+            WalkerStats(statistics::Group *parent);
+
+            statistics::Vector walkCacheHits;
+            statistics::Vector walkCacheMisses;
+        } stats;
+
         // Wrapper for checking for squashes before starting a translation.
         void startWalkWrapper();
 
@@ -198,6 +245,14 @@ namespace X86ISA
             tlb = _tlb;
         }
 
+        // Drop the cached page table entries along with the TLB entries.
+        void
+        flushWalkCaches()
+        {
+            for (auto &cache : walkCaches)
+                cache.flush();
+        }
+
         using Params = X86PagetableWalkerParams;
 
         Walker(const Params &params) :
@@ -205,6 +260,11 @@ namespace X86ISA
             funcState(this, NULL, NULL, true), tlb(NULL), sys(params.system),
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
+            fastWalk(params.fast_walk),
+            walkCaches{WalkCache(params.pml4_cache_entries),
+                       WalkCache(params.pdp_cache_entries),
+                       WalkCache(params.pd_cache_entries)},
+            stats(this),
             startWalkWrapperEvent([this]{ startWalkWrapper(); }, name())
         {
         }
@@ -50,6 +50,8 @@
 #include "base/trace.hh"
 #include "cpu/thread_context.hh"
 #include "debug/TLB.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/packet_access.hh"
 #include "mem/page_table.hh"
 #include "mem/request.hh"
@@ -64,36 +66,57 @@ namespace X86ISA {
 
 TLB::TLB(const Params &p)
     : BaseTLB(p), configAddress(0), size(p.size),
-      tlb(size), lruSeq(0), m5opRange(p.system->m5opRange()), stats(this)
+      tlb(size), replEntries(size), indexingPolicy(p.indexing_policy),
+      replPolicy(p.replacement_policy), stlb(nullptr), lruSeq(0),
+      m5opRange(p.system->m5opRange()), stats(this)
 {
     if (!size)
         fatal("TLBs must have a non-zero size.\n");
+    fatal_if(!p.assoc || size % p.assoc,
+             "The TLB size (%d) must be a multiple of its associativity "
+             "(%d).", size, p.assoc);
 
     for (int x = 0; x < size; x++) {
         tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
+        indexingPolicy->setEntry(&replEntries[x], x);
+        replEntries[x].replacementData = replPolicy->instantiateEntry();
+    }
+
+    if (p.next_level) {
+        stlb = dynamic_cast<TLB *>(p.next_level);
+        fatal_if(!stlb, "The next level of an X86 TLB must be an X86 TLB.");
     }
 
     walker = p.walker;
     walker->setTLB(this);
 }
 
-void
-TLB::evictLRU()
+TlbEntry *
+TLB::allocate(Addr vpn, unsigned logBytes)
 {
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    unsigned lru = 0;
-    for (unsigned i = 1; i < size; i++) {
-        if (tlb[i].lruSeq < tlb[lru].lruSeq)
-            lru = i;
+    // Spread the pages of every size over the sets, leaving out the PCID
+    // in the low bits of the page number.
+    indexingPolicy->getPossibleEntries(vpn >> logBytes, candidates);
+    for (auto *candidate : candidates) {
+        TlbEntry *entry = &tlb[candidate - replEntries.data()];
+        if (!entry->trieHandle)
+            return entry;
     }
 
-    assert(tlb[lru].trieHandle);
-    trie.remove(tlb[lru].trieHandle);
-    tlb[lru].trieHandle = NULL;
-    freeList.push_back(&tlb[lru]);
+    ReplaceableEntry *victim = replPolicy->getVictim(candidates);
+    TlbEntry *entry = &tlb[victim - replEntries.data()];
+    DPRINTF(TLB, "Replacing the entry of %#x.\n", entry->vaddr);
+    remove(entry);
+    return entry;
+}
+
+void
+TLB::remove(TlbEntry *entry)
+{
+    assert(entry->trieHandle);
+    trie.remove(entry->trieHandle);
+    entry->trieHandle = NULL;
+    replPolicy->invalidate(replEntries[entry - tlb.data()].replacementData);
 }
 
 TlbEntry *
@@ -105,6 +128,15 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
     //virtual addresses
     vpn = concAddrPcid(vpn, pcid);
 
+    // The second level TLB includes all the entries of this one.
+    if (stlb)
+        stlb->fill(vpn, entry);
+    return fill(vpn, entry);
+}
+
+TlbEntry *
+TLB::fill(Addr vpn, const TlbEntry &entry)
+{
     // If somebody beat us to it, just use that existing entry.
     TlbEntry *newEntry = trie.lookup(vpn);
     if (newEntry) {
@@ -112,11 +144,7 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
         return newEntry;
     }
 
-    if (freeList.empty())
-        evictLRU();
-
-    newEntry = freeList.front();
-    freeList.pop_front();
+    newEntry = allocate(vpn, entry.logBytes);
 
     *newEntry = entry;
     newEntry->lruSeq = nextSeq();
@@ -129,6 +157,7 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
         newEntry->trieHandle =
         trie.insert(vpn, TlbEntryTrie::MaxBits, newEntry);
     }
+    replPolicy->reset(replEntries[newEntry - tlb.data()].replacementData);
     return newEntry;
 }
 
@@ -136,22 +165,38 @@ TlbEntry *
 TLB::lookup(Addr va, bool update_lru)
 {
     TlbEntry *entry = trie.lookup(va);
-    if (entry && update_lru)
+    if (entry && update_lru) {
         entry->lruSeq = nextSeq();
+        replPolicy->touch(replEntries[entry - tlb.data()].replacementData);
+    }
     return entry;
 }
 
+TlbEntry *
+TLB::lookupNextLevel(Addr va, BaseMMU::Mode mode)
+{
+    TlbEntry *entry = stlb->lookup(va);
+    if (mode == BaseMMU::Read) {
+        stlb->stats.rdAccesses++;
+        if (!entry)
+            stlb->stats.rdMisses++;
+    } else {
+        stlb->stats.wrAccesses++;
+        if (!entry)
+            stlb->stats.wrMisses++;
+    }
+    return entry ? fill(entry->vaddr, *entry) : nullptr;
+}
+
 void
 TLB::flushAll()
 {
     DPRINTF(TLB, "Invalidating all entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (tlb[i].trieHandle)
+            remove(&tlb[i]);
     }
+    walker->flushWalkCaches();
 }
 
 void
@@ -165,23 +210,25 @@ TLB::flushNonGlobal()
 {
     DPRINTF(TLB, "Invalidating all non global entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle && !tlb[i].global) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (tlb[i].trieHandle && !tlb[i].global)
+            remove(&tlb[i]);
     }
+    if (stlb)
+        stlb->flushNonGlobal();
+    walker->flushWalkCaches();
 }
 
 void
 TLB::demapPage(Addr va, uint64_t asn)
 {
     TlbEntry *entry = trie.lookup(va);
-    if (entry) {
-        trie.remove(entry->trieHandle);
-        entry->trieHandle = NULL;
-        freeList.push_back(entry);
-    }
+    if (entry)
+        remove(entry);
+    if (stlb)
+        stlb->demapPage(va, asn);
+    // Invalidating a page also drops the cached entries of the upper
+    // level tables.
+    walker->flushWalkCaches();
 }
 
 namespace
@@ -432,7 +479,11 @@ TLB::translate(const RequestPtr &req,
                 } else {
                     stats.wrMisses++;
                 }
-                if (FullSystem) {
+                if (stlb)
+                    entry = lookupNextLevel(pageAlignedVaddr, mode);
+                if (entry) {
+                    DPRINTF(TLB, "Miss was serviced by the next level.\n");
+                } else if (FullSystem) {
                     Fault fault = walker->start(tc, translation, req, mode);
                     if (timing || fault != NoFault) {
                         // This gets ignored in atomic mode.
@@ -584,7 +635,11 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = 0;
+    for (uint32_t x = 0; x < size; x++) {
+        if (tlb[x].trieHandle != NULL)
+            _size++;
+    }
     SERIALIZE_SCALAR(_size);
     SERIALIZE_SCALAR(lruSeq);
 
@@ -608,12 +663,16 @@ TLB::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(lruSeq);
 
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
+        TlbEntry entry;
+        entry.unserializeSection(cp, csprintf("Entry%d", x));
 
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
+        // A set may have had more entries in the checkpointed TLB, and
+        // then only the last ones restored are kept.
+        TlbEntry *newEntry = allocate(entry.vaddr, entry.logBytes);
+        *newEntry = entry;
         newEntry->trieHandle = trie.insert(newEntry->vaddr,
             TlbEntryTrie::MaxBits - newEntry->logBytes, newEntry);
+        replPolicy->reset(replEntries[newEntry - tlb.data()].replacementData);
     }
 }
 
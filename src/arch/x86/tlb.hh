@@ -44,6 +44,7 @@
 #include "arch/generic/tlb.hh"
 #include "arch/x86/pagetable.hh"
 #include "base/trie.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/request.hh"
 #include "params/X86TLB.hh"
 #include "sim/stats.hh"
@@ -51,8 +52,14 @@
 namespace gem5
 {
 
+class BaseIndexingPolicy;
 class ThreadContext;
 
+namespace replacement_policy
+{
+    class Base;
+}
+
 namespace X86ISA
 {
     class Walker;
@@ -86,6 +93,12 @@ namespace X86ISA
 
         EntryList::iterator lookupIt(Addr va, bool update_lru = true);
 
+        /**
+         * Look up a translation this TLB missed in the next level TLB,
+         * and copy it into this one if it's found there.
+         */
+        TlbEntry *lookupNextLevel(Addr va, BaseMMU::Mode mode);
+
         Walker * walker;
 
       public:
@@ -102,7 +115,22 @@ namespace X86ISA
 
         std::vector<TlbEntry> tlb;
 
-        EntryList freeList;
+        /**
+         * The positions of the entries in the sets of the TLB and their
+         * replacement data, in the same order as the entries. The entries
+         * are placed by their page number, whatever the size of their
+         * page, and looked up through the trie.
+         */
+        std::vector<ReplaceableEntry> replEntries;
+        BaseIndexingPolicy *indexingPolicy;
+        replacement_policy::Base *replPolicy;
+        std::vector<ReplaceableEntry *> candidates;
+
+        /**
+         * The second level TLB, if any, which is looked up on misses
+         * before walking the page table and filled along with this one.
+         */
+        TLB *stlb;
 
         TlbEntryTrie trie;
         uint64_t lruSeq;
@@ -125,9 +153,18 @@ namespace X86ISA
                 BaseMMU::Translation *translation, BaseMMU::Mode mode,
                 bool &delayedResponse, bool timing);
 
-      public:
+        /**
+         * Pick the entry to fill with a page, replacing an entry of its
+         * set if none of them is free.
+         */
+        TlbEntry *allocate(Addr vpn, unsigned logBytes);
+
+        // Fill this TLB only, with the PCID already in the page number.
+        TlbEntry *fill(Addr vpn, const TlbEntry &entry);
 
-        void evictLRU();
+        void remove(TlbEntry *entry);
+
+      public:
 
         uint64_t
         nextSeq()
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "base/addr_range_map.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A map of num_ranges adjacent 4KiB ranges, like a large memory map. */
+template <int max_cache_size=0>
+AddrRangeMap<int, max_cache_size>
+makeMap(int num_ranges)
+{
+    AddrRangeMap<int, max_cache_size> map;
+    for (int i = 0; i < num_ranges; i++)
+        map.insert(RangeSize(Addr(i) * 0x1000, 0x1000), i);
+    return map;
+}
+
+} // anonymous namespace
+
+/** Look up random addresses, which mostly miss the lookup cache. */
+static void
+BM_AddrRangeMapContainsRandom(benchmark::State &state)
+{
+    const int num_ranges = state.range(0);
+    AddrRangeMap<int> map = makeMap(num_ranges);
+
+    std::mt19937_64 rng(0);
+    std::vector<Addr> addrs(1024);
+    for (auto &addr : addrs)
+        addr = rng() % (Addr(num_ranges) * 0x1000);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addrs[i++ % addrs.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddrRangeMapContainsRandom)->Range(8, 8 << 10);
+
+/** Look up random addresses in a frozen map. */
+static void
+BM_AddrRangeMapContainsRandomFrozen(benchmark::State &state)
+{
+    const int num_ranges = state.range(0);
+    AddrRangeMap<int> map = makeMap(num_ranges);
+    map.freeze();
+
+    std::mt19937_64 rng(0);
+    std::vector<Addr> addrs(1024);
+    for (auto &addr : addrs)
+        addr = rng() % (Addr(num_ranges) * 0x1000);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addrs[i++ % addrs.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddrRangeMapContainsRandomFrozen)->Range(8, 8 << 10);
+
+/**
+ * Look up the same few ranges over and over, as a crossbar typically does,
+ * with the same lookup cache size as the crossbars.
+ */
+static void
+BM_AddrRangeMapContainsHot(benchmark::State &state)
+{
+    AddrRangeMap<int, 3> map = makeMap<3>(state.range(0));
+
+    Addr addr = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addr));
+        addr = (addr + 0x1040) % 0x3000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddrRangeMapContainsHot)->Range(8, 8 << 10);
+
+/** Look up the same few ranges over and over in a frozen map. */
+static void
+BM_AddrRangeMapContainsHotFrozen(benchmark::State &state)
+{
+    AddrRangeMap<int, 3> map = makeMap<3>(state.range(0));
+    map.freeze();
+
+    Addr addr = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addr));
+        addr = (addr + 0x1040) % 0x3000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddrRangeMapContainsHotFrozen)->Range(8, 8 << 10);
+
+/** Insert ranges in a map and then erase them all. */
+static void
+BM_AddrRangeMapInsertErase(benchmark::State &state)
+{
+    const int num_ranges = state.range(0);
+    for (auto _ : state) {
+        AddrRangeMap<int> map = makeMap(num_ranges);
+        while (!map.empty())
+            map.erase(map.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * num_ranges);
+}
+BENCHMARK(BM_AddrRangeMapInsertErase)->Range(8, 8 << 10);
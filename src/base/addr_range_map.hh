@@ -46,6 +46,7 @@
 #include <list>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/types.hh"
@@ -57,6 +58,12 @@ namespace gem5
  * The AddrRangeMap uses an STL map to implement an interval tree for
  * address decoding. The value stored is a template type and can be
  * e.g. a port identifier, or a pointer.
+ *
+ * Once a map is complete, e.g., after all the address ranges of a
+ * crossbar are known, freeze() adds a sorted array of the entries
+ * that lookups binary search instead of walking the tree. Lookups in
+ * a frozen map don't update the lookup cache and are therefore safe
+ * to do from multiple threads. Any change to the map thaws it again.
  */
 template <typename V, int max_cache_size=0>
 class AddrRangeMap
@@ -73,6 +80,57 @@ class AddrRangeMap
     typedef typename RangeMap::const_iterator const_iterator;
     /** @} */ // end of api_addr_range
 
+    AddrRangeMap() = default;
+    AddrRangeMap(AddrRangeMap &&other) = default;
+    AddrRangeMap &operator=(AddrRangeMap &&other) = default;
+
+    /**
+     * Copying a map only copies its entries since the cache and the
+     * frozen array refer to the entries of the other map.
+     */
+    AddrRangeMap(const AddrRangeMap &other) : tree(other.tree)
+    {
+        if (other.frozen())
+            freeze();
+    }
+
+    AddrRangeMap &
+    operator=(const AddrRangeMap &other)
+    {
+        if (this != &other) {
+            clear();
+            tree = other.tree;
+            if (other.frozen())
+                freeze();
+        }
+        return *this;
+    }
+
+    /**
+     * Freeze the map to speed up lookups and make them thread-safe.
+     *
+     * @ingroup api_addr_range
+     */
+    void
+    freeze()
+    {
+        cache.clear();
+        starts.clear();
+        entries.clear();
+        starts.reserve(tree.size());
+        entries.reserve(tree.size());
+        for (auto it = tree.begin(); it != tree.end(); ++it) {
+            starts.push_back(it->first.start());
+            entries.push_back(it);
+        }
+        _frozen = true;
+    }
+
+    /**
+     * @ingroup api_addr_range
+     */
+    bool frozen() const { return _frozen; }
+
     /**
      * Find entry that contains the given address range
      *
@@ -114,11 +172,15 @@ class AddrRangeMap
     const_iterator
     contains(Addr r) const
     {
+        if (_frozen)
+            return const_cast<AddrRangeMap *>(this)->findFrozen(r);
         return contains(RangeSize(r, 1));
     }
     iterator
     contains(Addr r)
     {
+        if (_frozen)
+            return findFrozen(r);
         return contains(RangeSize(r, 1));
     }
     /** @} */ // end of api_addr_range
@@ -157,6 +219,7 @@ class AddrRangeMap
         if (intersects(r) != end())
             return tree.end();
 
+        thaw();
         return tree.insert(std::make_pair(r, d)).first;
     }
 
@@ -166,6 +229,7 @@ class AddrRangeMap
     void
     erase(iterator p)
     {
+        thaw();
         cache.remove(p);
         tree.erase(p);
     }
@@ -176,6 +240,7 @@ class AddrRangeMap
     void
     erase(iterator p, iterator q)
     {
+        thaw();
         for (auto it = p; it != q; it++) {
             cache.remove(p);
         }
@@ -188,6 +253,7 @@ class AddrRangeMap
     void
     clear()
     {
+        thaw();
         cache.erase(cache.begin(), cache.end());
         tree.erase(tree.begin(), tree.end());
     }
@@ -247,6 +313,98 @@ class AddrRangeMap
     }
 
   private:
+    /** Drop the frozen array before the map changes. */
+    void
+    thaw()
+    {
+        if (_frozen) {
+            starts.clear();
+            entries.clear();
+            _frozen = false;
+        }
+    }
+
+    /**
+     * Find the first frozen entry that starts after an address.
+     *
+     * The search narrows the candidates down with conditional moves
+     * rather than branches, which the host can't predict for random
+     * addresses.
+     *
+     * @param addr The address to look for
+     * @return Index of the first entry that starts after addr
+     */
+    std::size_t
+    upperStart(Addr addr) const
+    {
+        std::size_t n = starts.size();
+        if (n == 0)
+            return 0;
+        const Addr *base = starts.data();
+        while (n > 1) {
+            const std::size_t half = n / 2;
+            base = base[half] <= addr ? base + half : base;
+            n -= half;
+        }
+        return (base - starts.data()) + (*base <= addr);
+    }
+
+    /**
+     * Find the entry that contains an address in a frozen map.
+     *
+     * @param addr The address to look for
+     * @return The entry that contains addr, end() if none
+     */
+    iterator
+    findFrozen(Addr addr)
+    {
+        std::size_t i = upperStart(addr);
+        while (i > 0) {
+            const AddrRange &range = entries[--i]->first;
+            if (range.contains(addr))
+                return entries[i];
+            // Keep looking if the previous range merges with this one.
+            if (i == 0 || !entries[i - 1]->first.mergesWith(range))
+                break;
+        }
+        return tree.end();
+    }
+
+    /**
+     * Find an entry that satisfies a condition in a frozen map. This
+     * does the same search as the tree walk in find(), but over the
+     * frozen array and without touching the cache.
+     */
+    iterator
+    findFrozen(const AddrRange &r,
+               const std::function<bool(const AddrRange)> &cond)
+    {
+        // Equivalent of tree.upper_bound(r). Entries that start at the
+        // same address are interleaved and ordered by their match bits.
+        std::size_t next = upperStart(r.start());
+        while (next > 0 && starts[next - 1] == r.start() &&
+               r < entries[next - 1]->first) {
+            next--;
+        }
+
+        if (next != entries.size() && cond(entries[next]->first))
+            return entries[next];
+        if (next == 0)
+            return tree.end();
+        next--;
+
+        std::size_t i;
+        do {
+            i = next;
+            if (cond(entries[i]->first))
+                return entries[i];
+            // Keep looking if the next range merges with the current one.
+        } while (next != 0 &&
+                 entries[--next]->first.mergesWith(entries[i]->first));
+
+        return tree.end();
+    }
+
     /**
      * Add an address range map entry to the cache.
      *
@@ -286,6 +444,9 @@ class AddrRangeMap
     iterator
     find(const AddrRange &r, std::function<bool(const AddrRange)> cond)
     {
+        if (_frozen)
+            return findFrozen(r, cond);
+
         // Check the cache first
         for (auto c = cache.begin(); c != cache.end(); c++) {
             auto it = *c;
@@ -335,6 +496,15 @@ class AddrRangeMap
      * always be valid iterators of the tree.
      */
     mutable std::list<iterator> cache;
+
+    /** Is the map frozen, i.e., are starts and entries valid? */
+    bool _frozen = false;
+
+    /** Start addresses of the entries of a frozen map, in tree order. */
+    std::vector<Addr> starts;
+
+    /** Entries of a frozen map, in tree order. */
+    std::vector<iterator> entries;
 };
 
 } // namespace gem5
@@ -40,6 +40,7 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
 #include <vector>
 
 #include "base/addr_range_map.hh"
@@ -156,3 +157,72 @@ TEST(AddrRangeMapTest, InterleavedTest2)
     // intlvMatch = 2 for start = 0x80000000
     EXPECT_EQ(i->second, 2);
 }
+
+/**
+ * A frozen AddrRangeMap must find the same entries as the tree, both
+ * for plain ranges and for interleaved ranges, and must thaw when it
+ * is changed.
+ */
+TEST(AddrRangeMapTest, FrozenMatchesTree)
+{
+    const auto masks = std::vector<Addr>{0x40, 0x80};
+
+    // The cache changes which of several intersecting entries a lookup
+    // finds, so compare against a map without a cache
+    AddrRangeMap<int> tree;
+    AddrRangeMap<int, 3> frozen;
+    auto insert = [&](const AddrRange &r, int v) {
+        tree.insert(r, v);
+        frozen.insert(r, v);
+    };
+    // Plain ranges with holes between them
+    for (int k = 0; k < 64; k++)
+        insert(RangeSize(Addr(k) * 0x2000, 0x1000), k);
+    // Four-way interleaved ranges above them
+    for (int k = 0; k < 4; k++)
+        insert(AddrRange(0x100000, 0x200000, masks, k), 64 + k);
+
+    EXPECT_FALSE(frozen.frozen());
+    frozen.freeze();
+    EXPECT_TRUE(frozen.frozen());
+    ASSERT_EQ(frozen.size(), tree.size());
+
+    auto value = [](const auto &map, auto it) {
+        return it == map.end() ? -1 : it->second;
+    };
+
+    std::mt19937_64 rng(0);
+    for (int n = 0; n < 10000; n++) {
+        const Addr addr = rng() % 0x220000;
+        EXPECT_EQ(value(frozen, frozen.contains(addr)),
+                  value(tree, tree.contains(addr))) << addr;
+
+        // Interleaved ranges can only be tested against addresses
+        if (addr >= 0xf0000)
+            continue;
+        const AddrRange r = RangeSize(addr, 1 + rng() % 0x1800);
+        EXPECT_EQ(value(frozen, frozen.contains(r)),
+                  value(tree, tree.contains(r))) << r.to_string();
+        EXPECT_EQ(value(frozen, frozen.intersects(r)),
+                  value(tree, tree.intersects(r))) << r.to_string();
+    }
+
+    // Copies of a frozen map are frozen
+    AddrRangeMap<int, 3> copy(frozen);
+    EXPECT_TRUE(copy.frozen());
+    EXPECT_EQ(copy.contains(0x100040)->second, 65);
+
+    // Changing the map thaws it
+    ASSERT_NE(frozen.insert(RangeSize(0x1000, 0x1000), 100), frozen.end());
+    EXPECT_FALSE(frozen.frozen());
+    EXPECT_EQ(frozen.contains(0x1800)->second, 100);
+    frozen.freeze();
+    EXPECT_EQ(frozen.contains(0x1800)->second, 100);
+    frozen.erase(frozen.contains(0x1800));
+    EXPECT_FALSE(frozen.frozen());
+    EXPECT_EQ(frozen.contains(0x1800), frozen.end());
+
+    AddrRangeMap<int> empty;
+    empty.freeze();
+    EXPECT_EQ(empty.contains(0x1000), empty.end());
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/binary_trace.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace trace {
+
+BinaryTraceWriter::BinaryTraceWriter(std::ostream &_stream,
+                                     std::size_t capacity)
+    : stream(_stream),
+      ring(new uint8_t[(std::size_t)1 << ceilLog2(capacity)]),
+      mask(((std::size_t)1 << ceilLog2(capacity)) - 1),
+      head(0), tail(0), closing(false), closed(false)
+{
+    stream.write("gem5btrc", 8);
+    stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+
+    thread = std::thread([this]() { drain(); });
+}
+
+BinaryTraceWriter::~BinaryTraceWriter()
+{
+    close();
+}
+
+void
+BinaryTraceWriter::close()
+{
+    if (closed)
+        return;
+
+    closing.store(true, std::memory_order_release);
+    thread.join();
+    stream.flush();
+    closed = true;
+}
+
+uint32_t
+BinaryTraceWriter::intern(const std::string &str)
+{
+    auto it = strings.find(str);
+    if (it != strings.end())
+        return it->second;
+
+    const uint32_t id = strings.size();
+    strings.emplace(str, id);
+
+    struct GEM5_PACKED
+    {
+        RecordType type;
+        uint32_t id;
+        uint32_t length;
+    } header = { String, id, (uint32_t)str.size() };
+    write(&header, sizeof(header));
+    write(str.data(), str.size());
+
+    return id;
+}
+
+void
+BinaryTraceWriter::write(const void *data, std::size_t size)
+{
+    if (closed)
+        return;
+
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    const std::size_t capacity = mask + 1;
+    while (size) {
+        const std::size_t pos = head.load(std::memory_order_relaxed);
+        std::size_t space;
+        while ((space = capacity -
+                    (pos - tail.load(std::memory_order_acquire))) == 0) {
+            std::this_thread::yield();
+        }
+
+        const std::size_t count =
+            std::min({size, space, capacity - (pos & mask)});
+        std::memcpy(&ring[pos & mask], bytes, count);
+        head.store(pos + count, std::memory_order_release);
+
+        bytes += count;
+        size -= count;
+    }
+}
+
+void
+BinaryTraceWriter::message(Tick when, const std::string &name,
+                           const std::string &flag,
+                           const std::string &message)
+{
+    const uint32_t name_id = intern(name);
+    const uint32_t flag_id = intern(flag);
+
+    struct GEM5_PACKED
+    {
+        RecordType type;
+        Tick tick;
+        uint32_t name;
+        uint32_t flag;
+        uint32_t length;
+    } header = { Message, when, name_id, flag_id, (uint32_t)message.size() };
+    write(&header, sizeof(header));
+    write(message.data(), message.size());
+}
+
+void
+BinaryTraceWriter::drain()
+{
+    const std::size_t capacity = mask + 1;
+    while (true) {
+        const std::size_t pos = tail.load(std::memory_order_relaxed);
+        // Check for closing first, so the records written before the
+        // writer was closed are all seen
+        const bool last = closing.load(std::memory_order_acquire);
+        const std::size_t end = head.load(std::memory_order_acquire);
+
+        if (pos == end) {
+            if (last)
+                break;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            continue;
+        }
+
+        const std::size_t count = std::min(end - pos, capacity - (pos & mask));
+        stream.write(reinterpret_cast<const char *>(&ring[pos & mask]),
+                     count);
+        tail.store(pos + count, std::memory_order_release);
+    }
+}
+
+int
+BinaryLogger::MessageBuf::sync()
+{
+    if (!str().empty()) {
+        logger.writer.message(curTick(), "", "", str());
+        str("");
+    }
+    return 0;
+}
+
+BinaryLogger::BinaryLogger(std::ostream &stream)
+    : writer(stream), buf(*this), ostream(&buf)
+{
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    close();
+}
+
+void
+BinaryLogger::close()
+{
+    ostream.flush();
+    writer.close();
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!isEnabled(name))
+        return;
+
+    writer.message(when, name, flag, message);
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_BINARY_TRACE_HH__
+#define __BASE_BINARY_TRACE_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "base/compiler.hh"
+#include "base/trace.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace trace {
+
+/**
+ * Writer of binary traces. The records are copied into a lock-free ring
+ * by the simulation thread, and written to the stream (e.g., a
+ * compressed output file) by a background thread, so the simulation
+ * thread never formats or writes text. There must be a single thread
+ * writing records. See util/decode_binary_trace.py for a decoder.
+ *
+ * The trace starts with the magic "gem5btrc" and the version as a 32 bit
+ * integer. Each record then starts with its type. All the fields are in
+ * the host byte order. Strings are interned: a String record gives the
+ * id of a string the first time it's used, and the other records refer
+ * to it by its id.
+ */
+class BinaryTraceWriter
+{
+  public:
+    /** Version of the trace format */
+    static constexpr uint32_t version = 1;
+
+    enum RecordType : uint8_t
+    {
+        /** u32 id, u32 length, the string */
+        String = 0,
+        /**
+         * u64 tick (MaxTick without a tick), u32 name, u32 flag,
+         * u32 length, the message
+         */
+        Message = 1,
+        /** An InstData */
+        Inst = 2,
+    };
+
+    /** An executed instruction. */
+    struct GEM5_PACKED InstData
+    {
+        enum Flags : uint8_t
+        {
+            MicroOp = 0x01,
+            MemValid = 0x02,
+            Predicate = 0x04,
+            Faulting = 0x08,
+            FetchSeqValid = 0x10,
+            CPSeqValid = 0x20,
+        };
+
+        RecordType type;
+        Tick tick;
+        uint64_t pc;
+        uint64_t fetchSeq;
+        uint64_t cpSeq;
+        /** The address, if MemValid */
+        uint64_t addr;
+        /** The (last) data written or the register value */
+        uint64_t data;
+        /** The size of the memory access, if MemValid */
+        uint32_t size;
+        /** The name of the CPU */
+        uint32_t cpu;
+        /** The mnemonic of the instruction */
+        uint32_t mnemonic;
+        /** The name of the op class */
+        uint32_t opClass;
+        uint16_t microPC;
+        uint8_t flags;
+        /** The InstRecord::DataStatus of the data */
+        uint8_t dataStatus;
+    };
+
+    /**
+     * @param stream The stream to write the trace to.
+     * @param capacity The size of the ring in bytes, rounded up to a
+     * power of 2.
+     */
+    BinaryTraceWriter(std::ostream &stream, std::size_t capacity = 1 << 22);
+    ~BinaryTraceWriter();
+
+    BinaryTraceWriter(const BinaryTraceWriter &other) = delete;
+    BinaryTraceWriter &operator=(const BinaryTraceWriter &other) = delete;
+
+    /**
+     * Write the records left in the ring and stop the background thread.
+     * The records written after that are dropped.
+     */
+    void close();
+
+    /** @return The id of a string, writing a String record if it's new */
+    uint32_t intern(const std::string &str);
+
+    /** Write the bytes of a record, waiting if the ring is full. */
+    void write(const void *data, std::size_t size);
+
+    /** Write a Message record. */
+    void message(Tick when, const std::string &name, const std::string &flag,
+                 const std::string &message);
+
+  protected:
+    /** Write the ring to the stream until the writer is closed */
+    void drain();
+
+    std::ostream &stream;
+
+    std::unique_ptr<uint8_t[]> ring;
+    const std::size_t mask;
+
+    /** Total bytes written to and read from the ring */
+    std::atomic<std::size_t> head;
+    std::atomic<std::size_t> tail;
+    std::atomic<bool> closing;
+    bool closed;
+
+    std::thread thread;
+
+    std::unordered_map<std::string, uint32_t> strings;
+};
+
+/**
+ * Debug logger writing binary Message records, so DPRINTF messages are
+ * written to the output by a background thread. The messages are still
+ * formatted by the simulation thread.
+ */
+class BinaryLogger : public Logger
+{
+  protected:
+    /** Turns the text written to getOstream() into messages */
+    class MessageBuf : public std::stringbuf
+    {
+      protected:
+        BinaryLogger &logger;
+
+      public:
+        MessageBuf(BinaryLogger &_logger) : logger(_logger) {}
+
+        int sync() override;
+    };
+
+    BinaryTraceWriter writer;
+    MessageBuf buf;
+    std::ostream ostream;
+
+  public:
+    BinaryLogger(std::ostream &stream);
+    ~BinaryLogger();
+
+    /** @sa BinaryTraceWriter::close */
+    void close();
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return ostream; }
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __BASE_BINARY_TRACE_HH__
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/binary_trace.hh"
+#include "base/gtest/cur_tick_fake.hh"
+
+using namespace gem5;
+
+// Instantiate the mock class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+/** A decoded Message record. */
+struct Message
+{
+    Tick tick;
+    std::string name;
+    std::string flag;
+    std::string message;
+};
+
+/** Reads the records of a trace. */
+class TraceReader
+{
+  protected:
+    std::string trace;
+    std::size_t pos = 0;
+
+    template <typename T>
+    T
+    get()
+    {
+        T value;
+        std::memcpy(&value, trace.data() + pos, sizeof(value));
+        pos += sizeof(value);
+        return value;
+    }
+
+    std::string
+    getString(std::size_t length)
+    {
+        std::string str = trace.substr(pos, length);
+        pos += length;
+        return str;
+    }
+
+  public:
+    std::vector<std::string> strings;
+    std::vector<Message> messages;
+    std::vector<trace::BinaryTraceWriter::InstData> insts;
+
+    TraceReader(const std::string &_trace) : trace(_trace)
+    {
+        EXPECT_EQ(getString(8), "gem5btrc");
+        EXPECT_EQ(get<uint32_t>(), trace::BinaryTraceWriter::version);
+
+        while (pos < trace.size()) {
+            auto type = trace::BinaryTraceWriter::RecordType(trace[pos]);
+            if (type == trace::BinaryTraceWriter::String) {
+                pos++;
+                EXPECT_EQ(get<uint32_t>(), strings.size());
+                strings.push_back(getString(get<uint32_t>()));
+            } else if (type == trace::BinaryTraceWriter::Message) {
+                pos++;
+                Message message;
+                message.tick = get<Tick>();
+                message.name = strings.at(get<uint32_t>());
+                message.flag = strings.at(get<uint32_t>());
+                message.message = getString(get<uint32_t>());
+                messages.push_back(message);
+            } else {
+                EXPECT_EQ(type, trace::BinaryTraceWriter::Inst);
+                if (type != trace::BinaryTraceWriter::Inst)
+                    break;
+                insts.push_back(
+                    get<trace::BinaryTraceWriter::InstData>());
+            }
+        }
+        EXPECT_EQ(pos, trace.size());
+    }
+};
+
+/** Test that an empty trace only has the header. */
+TEST(BinaryTraceTest, Empty)
+{
+    std::stringstream ss;
+    trace::BinaryTraceWriter writer(ss);
+    writer.close();
+
+    TraceReader reader(ss.str());
+    EXPECT_TRUE(reader.strings.empty());
+    EXPECT_TRUE(reader.messages.empty());
+}
+
+/** Test that strings are interned once. */
+TEST(BinaryTraceTest, Intern)
+{
+    std::stringstream ss;
+    trace::BinaryTraceWriter writer(ss);
+    EXPECT_EQ(writer.intern("foo"), 0);
+    EXPECT_EQ(writer.intern("bar"), 1);
+    EXPECT_EQ(writer.intern("foo"), 0);
+    writer.close();
+
+    TraceReader reader(ss.str());
+    EXPECT_EQ(reader.strings, std::vector<std::string>({"foo", "bar"}));
+}
+
+/** Test records that wrap around a small ring, mixing record types. */
+TEST(BinaryTraceTest, Records)
+{
+    std::stringstream ss;
+    trace::BinaryTraceWriter writer(ss, 64);
+    for (int i = 0; i < 1000; i++) {
+        writer.message(i, "obj" + std::to_string(i % 3), "Flag",
+                       "message " + std::to_string(i) + "\n");
+
+        trace::BinaryTraceWriter::InstData inst = {};
+        inst.type = trace::BinaryTraceWriter::Inst;
+        inst.tick = i;
+        inst.pc = 0x1000 + 4 * i;
+        inst.cpu = writer.intern("cpu");
+        writer.write(&inst, sizeof(inst));
+    }
+    writer.close();
+
+    TraceReader reader(ss.str());
+    ASSERT_EQ(reader.messages.size(), 1000);
+    ASSERT_EQ(reader.insts.size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(reader.messages[i].tick, i);
+        EXPECT_EQ(reader.messages[i].name, "obj" + std::to_string(i % 3));
+        EXPECT_EQ(reader.messages[i].flag, "Flag");
+        EXPECT_EQ(reader.messages[i].message,
+                  "message " + std::to_string(i) + "\n");
+        EXPECT_EQ(reader.insts[i].tick, i);
+        EXPECT_EQ(reader.insts[i].pc, 0x1000 + 4 * i);
+        EXPECT_EQ(reader.strings.at(reader.insts[i].cpu), "cpu");
+    }
+}
+
+/** Test that nothing is written once the writer is closed. */
+TEST(BinaryTraceTest, Closed)
+{
+    std::stringstream ss;
+    trace::BinaryTraceWriter writer(ss);
+    writer.close();
+    writer.message(0, "obj", "Flag", "message\n");
+
+    TraceReader reader(ss.str());
+    EXPECT_TRUE(reader.messages.empty());
+}
+
+/** Test the messages of the binary logger and of its ostream. */
+TEST(BinaryTraceTest, Logger)
+{
+    std::stringstream ss;
+    trace::BinaryLogger logger(ss);
+    logger.logMessage(100, "obj", "Flag", "message\n");
+    logger.logMessage(MaxTick, "", "", "raw\n");
+    logger.getOstream() << "text" << std::flush;
+    logger.close();
+
+    TraceReader reader(ss.str());
+    ASSERT_EQ(reader.messages.size(), 3);
+    EXPECT_EQ(reader.messages[0].tick, 100);
+    EXPECT_EQ(reader.messages[0].name, "obj");
+    EXPECT_EQ(reader.messages[0].flag, "Flag");
+    EXPECT_EQ(reader.messages[0].message, "message\n");
+    EXPECT_EQ(reader.messages[1].tick, MaxTick);
+    EXPECT_EQ(reader.messages[1].message, "raw\n");
+    EXPECT_EQ(reader.messages[2].tick, 0);
+    EXPECT_EQ(reader.messages[2].message, "text");
+}
+
+/** Test that the logger ignores the objects it should ignore. */
+TEST(BinaryTraceTest, LoggerIgnore)
+{
+    std::stringstream ss;
+    trace::BinaryLogger logger(ss);
+    logger.addIgnore(ObjectMatch("ignored"));
+    logger.logMessage(0, "ignored", "Flag", "message\n");
+    logger.logMessage(0, "obj", "Flag", "message\n");
+    logger.close();
+
+    TraceReader reader(ss.str());
+    ASSERT_EQ(reader.messages.size(), 1);
+    EXPECT_EQ(reader.messages[0].name, "obj");
+}
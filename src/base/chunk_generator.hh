@@ -70,9 +70,9 @@ class ChunkGenerator
     /** The number of bytes remaining in the region after the current chunk. */
     Addr sizeLeft;
     /** The start address so we can calculate offset in writing block. */
-    const Addr startAddr;
+    Addr startAddr;
     /** The maximum chunk size, e.g., the cache block size or page size. */
-    const Addr chunkSize;
+    Addr chunkSize;
 
   public:
     /**
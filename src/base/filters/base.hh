@@ -60,6 +60,21 @@ class Base : public SimObject
     /** Threshold at which a filter entry starts being considered as set. */
     const int setThreshold;
 
+    /** Whether an entry was set while saturated since the last clear. */
+    bool saturated;
+
+    /**
+     * Increment a filter entry, keeping track of whether it saturates.
+     *
+     * @param index The index of the entry.
+     */
+    void
+    increment(int index)
+    {
+        saturated |= filter[index].isSaturated();
+        filter[index]++;
+    }
+
   public:
     /**
      * Create and clear the filter.
@@ -67,7 +82,8 @@ class Base : public SimObject
     Base(const BloomFilterBaseParams &p)
         : SimObject(p), offsetBits(p.offset_bits),
           filter(p.size, SatCounter8(p.num_bits)),
-          sizeBits(floorLog2(p.size)), setThreshold(p.threshold)
+          sizeBits(floorLog2(p.size)), setThreshold(p.threshold),
+          saturated(false)
     {
         clear();
     }
@@ -81,6 +97,7 @@ class Base : public SimObject
         for (auto& entry : filter) {
             entry.reset();
         }
+        saturated = false;
     }
 
     /**
@@ -94,8 +111,11 @@ class Base : public SimObject
     {
         assert(filter.size() == other->filter.size());
         for (int i = 0; i < filter.size(); ++i){
+            const int sum = filter[i] + other->filter[i];
             filter[i] += other->filter[i];
+            saturated |= filter[i] < sum;
         }
+        saturated |= other->hasSaturated();
     }
 
     /**
@@ -136,6 +156,17 @@ class Base : public SimObject
      */
     virtual int getCount(Addr addr) const { return 0; }
 
+    /**
+     * Whether an entry was set while already saturated since the last
+     * clear. The count of such an entry is too low, so unsetting the
+     * addresses that map to it may make isSet() report addresses that
+     * are still set as unset. Until the filter is cleared, only a
+     * positive answer of isSet() can then be trusted.
+     *
+     * @return Whether the filter may give false negatives.
+     */
+    virtual bool hasSaturated() const { return saturated; }
+
     /**
      * Get the total value stored in the filter entries.
      *
@@ -65,7 +65,7 @@ Block::~Block()
 void
 Block::set(Addr addr)
 {
-    filter[hash(addr)]++;
+    increment(hash(addr));
 }
 
 void
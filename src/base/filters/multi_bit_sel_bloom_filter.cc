@@ -60,7 +60,15 @@ void
 MultiBitSel::set(Addr addr)
 {
     for (int i = 0; i < numHashes; i++) {
-        filter[hash(addr, i)]++;
+        increment(hash(addr, i));
+    }
+}
+
+void
+MultiBitSel::unset(Addr addr)
+{
+    for (int i = 0; i < numHashes; i++) {
+        filter[hash(addr, i)]--;
     }
 }
 
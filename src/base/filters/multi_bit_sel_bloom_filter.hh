@@ -51,6 +51,7 @@ class MultiBitSel : public Base
     ~MultiBitSel();
 
     void set(Addr addr) override;
+    void unset(Addr addr) override;
     int getCount(Addr addr) const override;
 
   protected:
@@ -103,6 +103,17 @@ Multi::getCount(Addr addr) const
     return count;
 }
 
+bool
+Multi::hasSaturated() const
+{
+    for (const auto& sub_filter : filters) {
+        if (sub_filter->hasSaturated()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 int
 Multi::getTotalCount() const
 {
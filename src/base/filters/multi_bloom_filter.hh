@@ -60,6 +60,7 @@ class Multi : public Base
     void merge(const Base* other) override;
     bool isSet(Addr addr) const override;
     int getCount(Addr addr) const override;
+    bool hasSaturated() const override;
     int getTotalCount() const override;
 
   private:
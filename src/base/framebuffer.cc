@@ -39,6 +39,9 @@
 
 #include <zlib.h>
 
+#include <algorithm>
+#include <cassert>
+
 #include "base/bitfield.hh"
 
 namespace gem5
@@ -106,19 +109,13 @@ FrameBuffer::clear()
 void
 FrameBuffer::copyIn(const uint8_t *fb, const PixelConverter &conv)
 {
-    for (auto &p : pixels) {
-        p = conv.toPixel(fb);
-        fb += conv.length;
-    }
+    conv.toPixels(pixels.data(), fb, pixels.size());
 }
 
 void
 FrameBuffer::copyOut(uint8_t *fb, const PixelConverter &conv) const
 {
-    for (auto &p : pixels) {
-        conv.fromPixel(fb, p);
-        fb += conv.length;
-    }
+    conv.fromPixels(fb, pixels.data(), pixels.size());
 }
 
 uint64_t
@@ -129,4 +126,34 @@ FrameBuffer::getHash() const
                    area() * sizeof(Pixel));
 }
 
+uint32_t
+FrameBuffer::getLineHash(unsigned y) const
+{
+    assert(y < _height);
+
+    return adler32(0UL,
+                   reinterpret_cast<const Bytef *>(&pixels[y * _width]),
+                   _width * sizeof(Pixel));
+}
+
+std::pair<unsigned, unsigned>
+FrameBuffer::changedLines(std::vector<uint32_t> &line_hashes) const
+{
+    const bool snapshot_valid = line_hashes.size() == _height;
+    line_hashes.resize(_height);
+
+    unsigned first = _height, end = 0;
+    for (unsigned y = 0; y < _height; ++y) {
+        const uint32_t hash = getLineHash(y);
+        if (!snapshot_valid || line_hashes[y] != hash) {
+            line_hashes[y] = hash;
+            first = std::min(first, y);
+            end = y + 1;
+        }
+    }
+
+    return first < end ? std::make_pair(first, end) :
+        std::make_pair(0U, 0U);
+}
+
 } // namespace gem5
@@ -42,6 +42,7 @@
 #include <cstdint>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -183,6 +184,29 @@ class FrameBuffer : public Serializable
      */
     uint64_t getHash() const;
 
+    /**
+     * Create a hash of a single line of the image.
+     *
+     * @param y Distance from the top of the frame.
+     */
+    uint32_t getLineHash(unsigned y) const;
+
+    /**
+     * Find the band of lines that changed since a snapshot.
+     *
+     * Consumers that only need to output what changed (e.g., a VNC
+     * server) keep one hash per line describing what they last
+     * output. The hashes are updated to describe the current image.
+     * A snapshot of the wrong size is treated as if every line has
+     * changed.
+     *
+     * @param line_hashes Per-line hashes of the snapshot.
+     * @return First changed line and one past the last changed line;
+     * both are equal if nothing changed.
+     */
+    std::pair<unsigned, unsigned>
+    changedLines(std::vector<uint32_t> &line_hashes) const;
+
     /**
      * Static "dummy" frame buffer.
      *
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_FREE_LIST_HH__
+#define __BASE_FREE_LIST_HH__
+
+#include <cstddef>
+#include <new>
+
+namespace gem5
+{
+
+/**
+ * Per-thread free list of fixed-size memory blocks.
+ *
+ * Blocks are recycled through a thread-local singly-linked list, so
+ * allocating and releasing a block does not take any lock and does not
+ * go through the system allocator in the common case. A block may be
+ * released by a different thread than the one that allocated it; it
+ * then simply joins the free list of the releasing thread. Each thread
+ * keeps at most MaxFree blocks around, any further blocks are returned
+ * to the system allocator.
+ *
+ * Free blocks are intentionally not returned to the system when a
+ * thread exits. This keeps the per-thread state trivially destructible,
+ * so blocks can still be released during static destruction.
+ *
+ * @tparam Size Size of each block in bytes.
+ * @tparam MaxFree Maximum number of free blocks cached per thread.
+ *
+ * @ingroup api_base_utils
+ */
+template <std::size_t Size, std::size_t MaxFree = 4096>
+class FreeList
+{
+  private:
+    struct Node
+    {
+        Node *next;
+    };
+
+    static_assert(Size >= sizeof(Node), "Blocks must fit a list node");
+
+    struct List
+    {
+        Node *head;
+        std::size_t count;
+    };
+
+    static List &
+    list()
+    {
+        static thread_local List l = {nullptr, 0};
+        return l;
+    }
+
+  public:
+    /** Size of each block in bytes. */
+    static constexpr std::size_t blockSize = Size;
+
+    /**
+     * Get a block of blockSize bytes, aligned for any fundamental type.
+     */
+    static void *
+    allocate()
+    {
+        List &l = list();
+        if (!l.head)
+            return ::operator new(Size);
+
+        Node *n = l.head;
+        l.head = n->next;
+        l.count--;
+        return n;
+    }
+
+    /** Return a block obtained from allocate(). */
+    static void
+    release(void *p)
+    {
+        if (!p)
+            return;
+
+        List &l = list();
+        if (l.count >= MaxFree) {
+            ::operator delete(p);
+            return;
+        }
+
+        Node *n = static_cast<Node *>(p);
+        n->next = l.head;
+        l.head = n;
+        l.count++;
+    }
+
+    /** Number of free blocks cached by the calling thread. */
+    static std::size_t freeBlocks() { return list().count; }
+};
+
+/**
+ * Standard allocator that serves single-object allocations from a
+ * FreeList. Array allocations go to the system allocator. This can be
+ * used with std::allocate_shared to pool both an object and its shared
+ * pointer control block in a single block.
+ *
+ * @ingroup api_base_utils
+ */
+template <typename T>
+class FreeListAllocator
+{
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "Over-aligned types are not supported");
+
+  public:
+    using value_type = T;
+
+    FreeListAllocator() = default;
+
+    template <typename U>
+    FreeListAllocator(const FreeListAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        if (n == 1)
+            return static_cast<T *>(FreeList<sizeof(T)>::allocate());
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (n == 1)
+            FreeList<sizeof(T)>::release(p);
+        else
+            ::operator delete(p);
+    }
+
+    template <typename U>
+    bool operator==(const FreeListAllocator<U> &) const { return true; }
+
+    template <typename U>
+    bool operator!=(const FreeListAllocator<U> &) const { return false; }
+};
+
+} // namespace gem5
+
+#endif // __BASE_FREE_LIST_HH__
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+#include "base/free_list.hh"
+
+using namespace gem5;
+
+/** Released blocks are handed out again in LIFO order. */
+TEST(FreeListTest, Reuse)
+{
+    using List = FreeList<32>;
+    void *a = List::allocate();
+    void *b = List::allocate();
+    const auto cached = List::freeBlocks();
+
+    List::release(a);
+    List::release(b);
+    EXPECT_EQ(List::freeBlocks(), cached + 2);
+
+    EXPECT_EQ(List::allocate(), b);
+    EXPECT_EQ(List::allocate(), a);
+    EXPECT_EQ(List::freeBlocks(), cached);
+
+    List::release(a);
+    List::release(b);
+}
+
+/** Releasing a null pointer is a no-op. */
+TEST(FreeListTest, ReleaseNull)
+{
+    using List = FreeList<24>;
+    const auto cached = List::freeBlocks();
+    List::release(nullptr);
+    EXPECT_EQ(List::freeBlocks(), cached);
+}
+
+/** Each thread caches at most MaxFree blocks. */
+TEST(FreeListTest, Limit)
+{
+    using List = FreeList<16, 2>;
+    void *blocks[3];
+    for (auto &b : blocks)
+        b = List::allocate();
+    for (auto &b : blocks)
+        List::release(b);
+    EXPECT_EQ(List::freeBlocks(), 2);
+}
+
+/** Blocks released by another thread go to that thread's list. */
+TEST(FreeListTest, PerThread)
+{
+    using List = FreeList<48>;
+    void *a = List::allocate();
+    const auto cached = List::freeBlocks();
+
+    std::thread t([a]() {
+        List::release(a);
+        EXPECT_EQ(List::freeBlocks(), 1);
+        EXPECT_EQ(List::allocate(), a);
+        List::release(a);
+    });
+    t.join();
+
+    EXPECT_EQ(List::freeBlocks(), cached);
+}
+
+/** The allocator can pool objects created through allocate_shared. */
+TEST(FreeListTest, AllocateShared)
+{
+    struct Object
+    {
+        int value;
+        Object(int v) : value(v) {}
+    };
+
+    FreeListAllocator<Object> alloc;
+    void *first;
+    {
+        auto p = std::allocate_shared<Object>(alloc, 42);
+        EXPECT_EQ(p->value, 42);
+        first = p.get();
+    }
+
+    // The object and its control block come from the same pooled
+    // block, so the next allocation reuses the same memory.
+    auto q = std::allocate_shared<Object>(alloc, 7);
+    EXPECT_EQ(q.get(), first);
+    EXPECT_EQ(q->value, 7);
+}
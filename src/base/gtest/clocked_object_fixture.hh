@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_GTEST_CLOCKED_OBJECT_FIXTURE_HH__
+#define __BASE_GTEST_CLOCKED_OBJECT_FIXTURE_HH__
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "base/types.hh"
+#include "params/ClockedObject.hh"
+#include "params/SrcClockDomain.hh"
+#include "params/VoltageDomain.hh"
+#include "sim/clock_domain.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+#include "sim/voltage_domain.hh"
+
+namespace gem5
+{
+
+/**
+ * A clocked object, with the clock and voltage domains it needs, for the
+ * tests and benchmarks of objects which can't be created without them.
+ * The objects are created from C++ rather than from a Python config, in
+ * the first event queue. The objects keep references to their params, so
+ * the params of objects created with the fixture must outlive them.
+ */
+class ClockedObjectFixture
+{
+  private:
+    VoltageDomainParams voltageDomainParams;
+    SrcClockDomainParams clockDomainParams;
+    ClockedObjectParams objectParams;
+
+    std::unique_ptr<VoltageDomain> voltageDomain;
+    std::unique_ptr<SrcClockDomain> clockDomain;
+    std::unique_ptr<ClockedObject> object;
+
+  public:
+    /** @param period The clock period of the clock domain. */
+    explicit ClockedObjectFixture(Tick period=1000)
+    {
+        curEventQueue(getEventQueue(0));
+
+        setParams(voltageDomainParams, "voltage_domain");
+        voltageDomainParams.voltage = { 1.0 };
+        voltageDomain.reset(new VoltageDomain(voltageDomainParams));
+
+        setParams(clockDomainParams, "clk_domain");
+        clockDomainParams.clock = { period };
+        clockDomainParams.domain_id = -1;
+        clockDomainParams.init_perf_level = 0;
+        clockDomainParams.voltage_domain = voltageDomain.get();
+        clockDomain.reset(new SrcClockDomain(clockDomainParams));
+
+        setParams(objectParams, "object");
+        object.reset(new ClockedObject(objectParams));
+    }
+
+    /**
+     * Fill in the params all SimObjects have and, for ClockedObjects,
+     * put them in the fixture's clock domain.
+     *
+     * @param p The params to fill in.
+     * @param name The name of the object.
+     */
+    template <class Params>
+    void
+    setParams(Params &p, const std::string &name)
+    {
+        p.name = name;
+        p.eventq_index = 0;
+        if constexpr (std::is_base_of_v<ClockedObjectParams, Params>) {
+            p.clk_domain = clockDomain.get();
+            p.power_state = nullptr;
+        }
+    }
+
+    /** A clocked object in the fixture's clock domain. */
+    ClockedObject *getObject() { return object.get(); }
+};
+
+} // namespace gem5
+
+#endif // __BASE_GTEST_CLOCKED_OBJECT_FIXTURE_HH__
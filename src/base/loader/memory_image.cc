@@ -27,6 +27,7 @@
  */
 
 #include "base/loader/memory_image.hh"
+#include "mem/physical.hh"
 #include "mem/port_proxy.hh"
 
 namespace gem5
@@ -58,6 +59,20 @@ MemoryImage::write(const PortProxy &proxy) const
     return true;
 }
 
+bool
+MemoryImage::write(memory::PhysicalMemory &phys_mem,
+                   const PortProxy &proxy) const
+{
+    for (auto &seg: _segments) {
+        const bool written = seg.data ?
+            phys_mem.writeBacking(seg.base, seg.data, seg.size) :
+            phys_mem.zeroBacking(seg.base, seg.size);
+        if (!written && !writeSegment(seg, proxy))
+            return false;
+    }
+    return true;
+}
+
 MemoryImage &
 MemoryImage::move(std::function<Addr(Addr)> mapper)
 {
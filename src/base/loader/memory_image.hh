@@ -46,6 +46,11 @@ namespace gem5
 
 class PortProxy;
 
+namespace memory
+{
+class PhysicalMemory;
+} // namespace memory
+
 namespace loader
 {
 
@@ -120,6 +125,16 @@ class MemoryImage
     }
 
     bool write(const PortProxy &proxy) const;
+
+    /**
+     * Write the image to physical memory, copying the segments straight
+     * into the backing store of the memories. Only the segments which
+     * aren't backed by it are written through the proxy. This bypasses
+     * the memory system, so it is meant for loading images before the
+     * simulation starts.
+     */
+    bool write(memory::PhysicalMemory &phys_mem,
+               const PortProxy &proxy) const;
     MemoryImage &move(std::function<Addr(Addr)> mapper);
     MemoryImage &
     offset(Addr by)
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "base/parallel.hh"
+
+using namespace gem5;
+
+/** A request for 0 threads picks one per host core. */
+TEST(ParallelTest, HostThreads)
+{
+    EXPECT_EQ(hostThreads(3), 3u);
+    EXPECT_GE(hostThreads(0), 1u);
+}
+
+/** Every index is visited exactly once. */
+TEST(ParallelTest, EachIndexOnce)
+{
+    std::vector<std::atomic<int>> visits(1000);
+    parallelFor(4, visits.size(), [&](std::size_t i) { visits[i]++; });
+    for (auto &v : visits)
+        EXPECT_EQ(v, 1);
+}
+
+/** A single thread runs everything on the calling thread, in order. */
+TEST(ParallelTest, SingleThread)
+{
+    std::vector<std::size_t> order;
+    std::set<std::thread::id> ids;
+    parallelFor(1, 5, [&](std::size_t i) {
+        order.push_back(i);
+        ids.insert(std::this_thread::get_id());
+    });
+    EXPECT_EQ(order, std::vector<std::size_t>({0, 1, 2, 3, 4}));
+    EXPECT_EQ(ids, std::set<std::thread::id>({std::this_thread::get_id()}));
+}
+
+/** Nothing is called for an empty range. */
+TEST(ParallelTest, Empty)
+{
+    bool called = false;
+    parallelFor(4, 0, [&](std::size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
@@ -38,6 +38,7 @@
 #include "base/pixel.hh"
 
 #include <cassert>
+#include <cstring>
 
 #include "base/bitfield.hh"
 
@@ -60,9 +61,23 @@ PixelConverter::PixelConverter(unsigned _length,
       byte_order(_byte_order),
       ch_r(ro, rw),
       ch_g(go, gw),
-      ch_b(bo, bw)
+      ch_b(bo, bw),
+      byte_channels(false),
+      byte_r(0), byte_g(0), byte_b(0)
 {
     assert(length > 1);
+
+    auto byte_index = [this](const Channel &ch, unsigned &index) {
+        if (ch.mask != 0xFF || ch.offset % 8 || ch.offset / 8 >= length)
+            return false;
+        index = byte_order == ByteOrder::little ?
+            ch.offset / 8 : length - 1 - ch.offset / 8;
+        return true;
+    };
+
+    byte_channels = byte_index(ch_r, byte_r) &&
+        byte_index(ch_g, byte_g) &&
+        byte_index(ch_b, byte_b);
 }
 
 PixelConverter::Channel::Channel(unsigned _offset, unsigned width)
@@ -88,6 +103,47 @@ PixelConverter::readWord(const uint8_t *p) const
     return word;
 }
 
+void
+PixelConverter::toPixels(Pixel *dst, const uint8_t *rfb, size_t count) const
+{
+    if (!byte_channels) {
+        for (size_t i = 0; i < count; ++i, rfb += length)
+            dst[i] = toPixel(rfb);
+        return;
+    }
+
+    const unsigned r = byte_r, g = byte_g, b = byte_b;
+    if (length == 4) {
+        // Constant stride lets the compiler turn this into shuffles.
+        for (size_t i = 0; i < count; ++i, rfb += 4)
+            dst[i] = Pixel(rfb[r], rfb[g], rfb[b]);
+    } else {
+        for (size_t i = 0; i < count; ++i, rfb += length)
+            dst[i] = Pixel(rfb[r], rfb[g], rfb[b]);
+    }
+}
+
+void
+PixelConverter::fromPixels(uint8_t *rfb, const Pixel *src,
+                           size_t count) const
+{
+    if (!byte_channels) {
+        for (size_t i = 0; i < count; ++i, rfb += length)
+            fromPixel(rfb, src[i]);
+        return;
+    }
+
+    // Bytes that don't belong to a channel are padding and stored as
+    // zero, just like writeWord() does.
+    std::memset(rfb, 0, count * length);
+    const unsigned r = byte_r, g = byte_g, b = byte_b;
+    for (size_t i = 0; i < count; ++i, rfb += length) {
+        rfb[r] = src[i].red;
+        rfb[g] = src[i].green;
+        rfb[b] = src[i].blue;
+    }
+}
+
 void
 PixelConverter::writeWord(uint8_t *p, uint32_t word) const
 {
@@ -161,6 +161,31 @@ class PixelConverter
         writeWord(rfb, fromPixel(pixel));
     }
 
+    /**
+     * Convert a run of color words stored in memory into Pixels.
+     *
+     * This is equivalent to calling toPixel() once per word, but
+     * formats where every channel is a byte-aligned 8-bit field are
+     * converted with a plain byte gather that the compiler can
+     * vectorize.
+     *
+     * @param dst First Pixel to write.
+     * @param rfb Pointer to the first byte of the first word.
+     * @param count Number of pixels to convert.
+     */
+    void toPixels(Pixel *dst, const uint8_t *rfb, size_t count) const;
+
+    /**
+     * Convert a run of Pixels into color words stored in memory.
+     *
+     * @see toPixels()
+     *
+     * @param rfb Pointer to the first byte in memory.
+     * @param src First Pixel to convert.
+     * @param count Number of pixels to convert.
+     */
+    void fromPixels(uint8_t *rfb, const Pixel *src, size_t count) const;
+
     /**
      * Read a word of a given length and endianness from memory.
      *
@@ -198,6 +223,16 @@ class PixelConverter
     /** Blue channel conversion helper */
     Channel ch_b;
 
+    /**
+     * True if every channel is a byte-aligned 8-bit field, in which
+     * case byte_r, byte_g and byte_b hold the index of each channel's
+     * byte within a stored word.
+     */
+    bool byte_channels;
+    unsigned byte_r;
+    unsigned byte_g;
+    unsigned byte_b;
+
     /** Predefined 32-bit RGB (red in least significant bits, 8
      * bits/channel, little endian) conversion helper */
     static const PixelConverter rgba8888_le;
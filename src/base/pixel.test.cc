@@ -37,6 +37,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "base/pixel.hh"
 
 using namespace gem5;
@@ -119,3 +121,31 @@ TEST(FBTest, MemToPixelRGBA8888BE)
     EXPECT_EQ(PixelConverter::rgba8888_be.toPixel(green), pixel_green);
     EXPECT_EQ(PixelConverter::rgba8888_be.toPixel(blue), pixel_blue);
 }
+
+TEST(FBTest, BulkConversionMatchesScalar)
+{
+    const PixelConverter *convs[] = {
+        &PixelConverter::rgba8888_le, &PixelConverter::rgba8888_be,
+        &PixelConverter::rgb565_le, &PixelConverter::rgb565_be,
+    };
+
+    std::vector<uint8_t> mem(4 * 64);
+    for (size_t i = 0; i < mem.size(); ++i)
+        mem[i] = i * 37 + 11;
+
+    for (const PixelConverter *conv : convs) {
+        const size_t count = mem.size() / conv->length;
+
+        std::vector<Pixel> bulk(count);
+        conv->toPixels(bulk.data(), mem.data(), count);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(bulk[i], conv->toPixel(&mem[i * conv->length]));
+
+        std::vector<uint8_t> bulk_mem(mem.size(), 0xaa);
+        std::vector<uint8_t> scalar_mem(mem.size(), 0xaa);
+        conv->fromPixels(bulk_mem.data(), bulk.data(), count);
+        for (size_t i = 0; i < count; ++i)
+            conv->fromPixel(&scalar_mem[i * conv->length], bulk[i]);
+        EXPECT_EQ(bulk_mem, scalar_mem);
+    }
+}
@@ -41,6 +41,9 @@
 #ifndef __BASE_REFCNT_HH__
 #define __BASE_REFCNT_HH__
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <type_traits>
 
 /**
@@ -107,6 +110,97 @@ class RefCounted
     }
 };
 
+/**
+ * Holds the global setting that decides whether SharedRefCounted
+ * objects update their reference counts atomically.
+ */
+class SharedRefCountMode
+{
+  protected:
+    static inline std::atomic<bool> _atomic{false};
+
+  public:
+    /**
+     * Select atomic reference counting. This must be enabled before
+     * any object is shared between threads, which is the case as long
+     * as it is done before simulation starts.
+     */
+    static void
+    setAtomic(bool atomic)
+    {
+        _atomic.store(atomic, std::memory_order_relaxed);
+    }
+
+    /// Check if reference counts are updated atomically.
+    static bool
+    atomic()
+    {
+        return _atomic.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Reference counted base class for objects that are created and
+ * copied at a very high rate, and may be shared between event queues
+ * when the simulator runs in parallel.
+ *
+ * Unlike RefCounted, the count is only updated with atomic
+ * read-modify-write operations when SharedRefCountMode::atomic() is
+ * set. With a single event queue it is updated with plain loads and
+ * stores, which avoids the cost of locked instructions on every copy
+ * of a pointer. The derived class is passed as a template parameter
+ * so it can be destroyed without a virtual destructor.
+ *
+ * @tparam Derived The class deriving from SharedRefCounted.
+ */
+template <class Derived>
+class SharedRefCounted : public SharedRefCountMode
+{
+  private:
+    /// @see RefCounted::count
+    mutable std::atomic<int> count;
+
+  public:
+    /**
+     * The reference count of a copy starts at zero, the reference
+     * count of the original is never copied.
+     */
+    SharedRefCounted() : count(0) {}
+    SharedRefCounted(const SharedRefCounted &) : count(0) {}
+    SharedRefCounted &operator=(const SharedRefCounted &) { return *this; }
+
+    /// Increment the reference count
+    void
+    incref() const
+    {
+        if (atomic()) {
+            count.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            count.store(count.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+        }
+    }
+
+    /// Decrement the reference count and destroy the object if all
+    /// references are gone.
+    void
+    decref() const
+    {
+        int remaining;
+        if (atomic()) {
+            remaining = count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        } else {
+            remaining = count.load(std::memory_order_relaxed) - 1;
+            count.store(remaining, std::memory_order_relaxed);
+        }
+        if (remaining <= 0)
+            delete static_cast<const Derived *>(this);
+    }
+
+  protected:
+    ~SharedRefCounted() {}
+};
+
 /**
  * If you want a reference counting pointer to a mutable object,
  * create it like this:
@@ -226,6 +320,14 @@ class RefCountingPtr
     /// Directly access the pointer itself without taking a reference.
     T *get() const { return data; }
 
+    /// Drop the reference, leaving the pointer empty.
+    void
+    reset()
+    {
+        del();
+        data = nullptr;
+    }
+
     template <bool B = TisConst>
     operator RefCountingPtr<typename std::enable_if_t<!B, ConstT>>()
     {
@@ -314,6 +416,63 @@ operator!=(const T *l, const RefCountingPtr<T> &r)
     return l != r.get();
 }
 
+/**
+ * Only nullptr itself may use the comparisons against nullptr. A
+ * literal 0 or NULL would otherwise match them as well as the built-in
+ * comparison through operator bool, which makes such comparisons
+ * ambiguous.
+ */
+template<class N>
+using EnableIfNullptr = std::enable_if_t<std::is_null_pointer_v<N>, int>;
+
+/// Check if a reference counting pointer is empty.
+template<class T, class N, EnableIfNullptr<N> = 0>
+inline bool
+operator==(const RefCountingPtr<T> &l, N)
+{
+    return !l;
+}
+
+/// Check if a reference counting pointer is empty.
+template<class T, class N, EnableIfNullptr<N> = 0>
+inline bool
+operator==(N, const RefCountingPtr<T> &r)
+{
+    return !r;
+}
+
+/// Check if a reference counting pointer is non-empty.
+template<class T, class N, EnableIfNullptr<N> = 0>
+inline bool
+operator!=(const RefCountingPtr<T> &l, N)
+{
+    return (bool)l;
+}
+
+/// Check if a reference counting pointer is non-empty.
+template<class T, class N, EnableIfNullptr<N> = 0>
+inline bool
+operator!=(N, const RefCountingPtr<T> &r)
+{
+    return (bool)r;
+}
+
 } // namespace gem5
 
+namespace std
+{
+
+/// Hash reference counting pointers by the address they point to.
+template<class T>
+struct hash<gem5::RefCountingPtr<T>>
+{
+    size_t
+    operator()(const gem5::RefCountingPtr<T> &p) const
+    {
+        return hash<T *>()(p.get());
+    }
+};
+
+} // namespace std
+
 #endif // __BASE_REFCNT_HH__
@@ -172,3 +172,58 @@ TEST(RefcntTest, EqualityOperators)
     EXPECT_TRUE(equalTestAPtr != equalTestB);
     EXPECT_TRUE(equalTestAPtr != equalTestBPtr);
 }
+
+TEST(RefcntTest, NullptrComparison)
+{
+    // Test comparisons against nullptr and reset().
+    Ptr ptr = new TestRC();
+    EXPECT_TRUE(ptr != nullptr);
+    EXPECT_TRUE(nullptr != ptr);
+    EXPECT_FALSE(ptr == nullptr);
+    ptr.reset();
+    EXPECT_TRUE(ptr == nullptr);
+    EXPECT_TRUE(nullptr == ptr);
+    // Comparisons against a literal 0 go through operator bool.
+    EXPECT_TRUE(ptr == 0);
+    EXPECT_FALSE(ptr != 0);
+    EXPECT_EQ(0, liveListSize());
+}
+
+namespace {
+
+class TestSharedRC : public SharedRefCounted<TestSharedRC>
+{
+  public:
+    static int live;
+    TestSharedRC() { live++; }
+    TestSharedRC(const TestSharedRC &other)
+        : SharedRefCounted<TestSharedRC>(other)
+    {
+        live++;
+    }
+    ~TestSharedRC() { live--; }
+};
+int TestSharedRC::live = 0;
+typedef RefCountingPtr<TestSharedRC> SharedPtr;
+
+} // anonymous namespace
+
+TEST(RefcntTest, SharedRefCounted)
+{
+    for (bool atomic : {false, true}) {
+        SharedRefCountMode::setAtomic(atomic);
+        EXPECT_EQ(SharedRefCountMode::atomic(), atomic);
+        {
+            SharedPtr a = new TestSharedRC();
+            SharedPtr b = a;
+            // Copying the object must not copy its reference count.
+            SharedPtr c = new TestSharedRC(*a);
+            EXPECT_EQ(2, TestSharedRC::live);
+            a = nullptr;
+            c = nullptr;
+            EXPECT_EQ(1, TestSharedRC::live);
+        }
+        EXPECT_EQ(0, TestSharedRC::live);
+    }
+    SharedRefCountMode::setAtomic(false);
+}
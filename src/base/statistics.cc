@@ -174,6 +174,7 @@ Formula::operator=(const Temp &r)
 {
     assert(!root && "Can't change formulas");
     root = r.getNodePtr();
+    cacheValid = false;
     setInit();
     assert(size());
     return *this;
@@ -188,6 +189,7 @@ Formula::operator+=(Temp r)
         root = r.getNodePtr();
         setInit();
     }
+    cacheValid = false;
 
     assert(size());
     return *this;
@@ -198,23 +200,44 @@ Formula::operator/=(Temp r)
 {
     assert (root);
     root = NodePtr(new BinaryNode<std::divides<Result> >(root, r));
+    cacheValid = false;
 
     assert(size());
     return *this;
 }
 
 
+void
+Formula::evaluate() const
+{
+    // The operands are cleared after each dump, and the formula is
+    // evaluated when the dump is prepared, so the cache is up to date as
+    // long as none of them changed.
+    if (cacheValid && !root->changed())
+        return;
+
+    cachedResult = root->result();
+    cachedTotal = root->total();
+    cacheValid = true;
+}
+
 void
 Formula::result(VResult &vec) const
 {
-    if (root)
-        vec = root->result();
+    if (root) {
+        evaluate();
+        vec = cachedResult;
+    }
 }
 
 Result
 Formula::total() const
 {
-    return root ? root->total() : 0.0;
+    if (!root)
+        return 0.0;
+
+    evaluate();
+    return cachedTotal;
 }
 
 size_type
@@ -226,6 +249,13 @@ Formula::size() const
         return root->size();
 }
 
+void
+Formula::prepare()
+{
+    if (root)
+        evaluate();
+}
+
 void
 Formula::reset()
 {
@@ -242,6 +272,12 @@ Formula::zero() const
     return true;
 }
 
+bool
+Formula::changed() const
+{
+    return !root || root->changed();
+}
+
 std::string
 Formula::str() const
 {
@@ -250,12 +286,15 @@ Formula::str() const
 
 Handler resetHandler = NULL;
 Handler dumpHandler = NULL;
+Handler snapshotHandler = NULL;
 
 void
-registerHandlers(Handler reset_handler, Handler dump_handler)
+registerHandlers(Handler reset_handler, Handler dump_handler,
+                 Handler snapshot_handler)
 {
     resetHandler = reset_handler;
     dumpHandler = dump_handler;
+    snapshotHandler = snapshot_handler;
 }
 
 CallbackQueue dumpQueue;
@@ -314,6 +353,15 @@ reset()
         fatal("No registered statistics::reset handler");
 }
 
+void
+snapshot()
+{
+    if (snapshotHandler)
+        snapshotHandler();
+    else
+        fatal("No registered statistics::snapshot handler");
+}
+
 const Info *
 resolve(const std::string &name)
 {
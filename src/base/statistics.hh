@@ -60,6 +60,7 @@
 #define __BASE_STATISTICS_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #ifdef __SUNPRO_CC
 #include <math.h>
@@ -112,6 +113,8 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+    bool changed() const { return s.changed(); }
+    void clearChanged() { s.clearChanged(); }
 };
 
 template <class Stat>
@@ -200,9 +203,31 @@ class InfoAccess
     /** Check if the info is new style stats */
     bool newStyleStats() const;
 
+    /**
+     * Has the stat been written since its changes were last cleared. Some
+     * stats (e.g., sharded stats) are written by several threads.
+     */
+    std::atomic<bool> _changed;
+
   public:
     InfoAccess()
-        : _info(nullptr) {};
+        : _info(nullptr), _changed(true) {};
+
+    /** Flag the stat as changed, called by the operators writing it */
+    void markChanged() { _changed.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @return true if the stat has changed since its changes were last
+     * cleared
+     */
+    bool changed() const { return _changed.load(std::memory_order_relaxed); }
+
+    /** Clear the changes of the stat */
+    void
+    clearChanged()
+    {
+        _changed.store(false, std::memory_order_relaxed);
+    }
 
     /**
      * Reset the stat to the default state.
@@ -454,6 +479,7 @@ class DataWrapVec : public DataWrap<Derived, InfoProxyType>
         size_t size = self.size();
         for (off_type i = 0; i < size; ++i)
             self.data(i)->reset(info->getStorageParams());
+        this->markChanged();
     }
 };
 
@@ -572,12 +598,12 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { data()->inc(1); }
+    void operator++() { data()->inc(1); this->markChanged(); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { data()->dec(1); }
+    void operator--() { data()->dec(1); this->markChanged(); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -590,7 +616,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The new value.
      */
     template <typename U>
-    void operator=(const U &v) { data()->set(v); }
+    void operator=(const U &v) { data()->set(v); this->markChanged(); }
 
     /**
      * Increment the stat by the given value. This calls the associated
@@ -598,7 +624,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to add.
      */
     template <typename U>
-    void operator+=(const U &v) { data()->inc(v); }
+    void operator+=(const U &v) { data()->inc(v); this->markChanged(); }
 
     /**
      * Decrement the stat by the given value. This calls the associated
@@ -606,7 +632,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to substract.
      */
     template <typename U>
-    void operator-=(const U &v) { data()->dec(v); }
+    void operator-=(const U &v) { data()->dec(v); this->markChanged(); }
 
     /**
      * Return the number of elements, always 1 for a scalar.
@@ -626,7 +652,13 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     bool zero() const { return result() == 0.0; }
 
-    void reset() { data()->reset(this->info()->getStorageParams()); }
+    void
+    reset()
+    {
+        data()->reset(this->info()->getStorageParams());
+        this->markChanged();
+    }
+
     void prepare() { data()->prepare(this->info()->getStorageParams()); }
 };
 
@@ -779,6 +811,9 @@ class ValueBase : public DataWrap<Derived, ScalarInfoProxy>
     bool check() const { return proxy != NULL; }
     void prepare() { }
     void reset() { }
+
+    /** The value is read from elsewhere, so it may always have changed */
+    bool changed() const { return true; }
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -814,6 +849,12 @@ class ScalarProxy
      */
     Result result() const { return stat.data(index)->result(); }
 
+    /**
+     * @return true if the parent stat has changed since its changes were
+     * last cleared
+     */
+    bool changed() const { return stat.changed(); }
+
   public:
     /**
      * Create and initialize this proxy, do not register it with the database.
@@ -851,12 +892,12 @@ class ScalarProxy
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { stat.data(index)->inc(1); }
+    void operator++() { stat.data(index)->inc(1); stat.markChanged(); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { stat.data(index)->dec(1); }
+    void operator--() { stat.data(index)->dec(1); stat.markChanged(); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -873,6 +914,7 @@ class ScalarProxy
     operator=(const U &v)
     {
         stat.data(index)->set(v);
+        stat.markChanged();
     }
 
     /**
@@ -885,6 +927,7 @@ class ScalarProxy
     operator+=(const U &v)
     {
         stat.data(index)->inc(v);
+        stat.markChanged();
     }
 
     /**
@@ -897,6 +940,7 @@ class ScalarProxy
     operator-=(const U &v)
     {
         stat.data(index)->dec(v);
+        stat.markChanged();
     }
 
     /**
@@ -1229,6 +1273,10 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
     void
     prepare()
     {
+        // The prepared values are still valid if nothing was written
+        if (!this->self().changed())
+            return;
+
         Info *info = this->info();
         size_type size = this->size();
 
@@ -1250,6 +1298,7 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         size_type size = this->size();
         for (off_type i = 0; i < size; ++i)
             data(i)->reset(info->getStorageParams());
+        this->markChanged();
     }
 
     bool
@@ -1324,7 +1373,12 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        data()->sample(v, n);
+        this->markChanged();
+    }
 
     /**
      * Return the number of entries in this stat.
@@ -1340,6 +1394,10 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     void
     prepare()
     {
+        // The prepared data is still valid if nothing was sampled
+        if (!this->self().changed())
+            return;
+
         Info *info = this->info();
         data()->prepare(info->getStorageParams(), info->data);
     }
@@ -1351,12 +1409,18 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     reset()
     {
         data()->reset(this->info()->getStorageParams());
+        this->markChanged();
     }
 
     /**
      *  Add the argument distribution to the this distribution.
      */
-    void add(DistBase &d) { data()->add(d.data()); }
+    void
+    add(DistBase &d)
+    {
+        data()->add(d.data());
+        this->markChanged();
+    }
 };
 
 template <class Stat>
@@ -1441,6 +1505,10 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
     void
     prepare()
     {
+        // The prepared data is still valid if nothing was sampled
+        if (!this->self().changed())
+            return;
+
         Info *info = this->info();
         size_type size = this->size();
         info->data.resize(size);
@@ -1489,6 +1557,7 @@ class DistProxy
     sample(const U &v, int n = 1)
     {
         data()->sample(v, n);
+        stat.markChanged();
     }
 
     size_type
@@ -1538,6 +1607,12 @@ class Node
      */
     virtual Result total() const = 0;
 
+    /**
+     * @return true if any stat in this subtree may have changed since its
+     * changes were last cleared.
+     */
+    virtual bool changed() const = 0;
+
     /**
      *
      */
@@ -1567,6 +1642,8 @@ class ScalarStatNode : public Node
 
     Result total() const { return data->result(); };
 
+    bool changed() const { return data->changed(); }
+
     size_type size() const { return 1; }
 
     /**
@@ -1600,6 +1677,8 @@ class ScalarProxyNode : public Node
         return proxy.result();
     }
 
+    bool changed() const { return proxy.changed(); }
+
     size_type
     size() const
     {
@@ -1626,6 +1705,8 @@ class VectorStatNode : public Node
     const VResult &result() const { return data->result(); }
     Result total() const { return data->total(); };
 
+    bool changed() const { return data->changed(); }
+
     size_type size() const { return data->size(); }
 
     std::string str() const { return data->name; }
@@ -1641,6 +1722,7 @@ class ConstNode : public Node
     ConstNode(T s) : vresult(1, (Result)s) {}
     const VResult &result() const { return vresult; }
     Result total() const { return vresult[0]; };
+    bool changed() const { return false; }
     size_type size() const { return 1; }
     std::string str() const { return std::to_string(vresult[0]); }
 };
@@ -1665,6 +1747,8 @@ class ConstVectorNode : public Node
         return tmp;
     }
 
+    bool changed() const { return false; }
+
     size_type size() const { return vresult.size(); }
     std::string
     str() const
@@ -1755,6 +1839,8 @@ class UnaryNode : public Node
 
     size_type size() const { return l->size(); }
 
+    bool changed() const { return l->changed(); }
+
     std::string
     str() const
     {
@@ -1852,6 +1938,12 @@ class BinaryNode : public Node
         }
     }
 
+    bool
+    changed() const override
+    {
+        return l->changed() || r->changed();
+    }
+
     std::string
     str() const override
     {
@@ -1903,6 +1995,8 @@ class SumNode : public Node
 
     size_type size() const { return 1; }
 
+    bool changed() const { return l->changed(); }
+
     std::string
     str() const
     {
@@ -1950,6 +2044,35 @@ class Scalar : public ScalarBase<Scalar, StatStor>
     }
 };
 
+/**
+ * A scalar counter that can be updated by several host threads, e.g., by
+ * objects on different event queues, without synchronisation.
+ * @sa Stat, ScalarBase, ShardedStor
+ */
+class ShardedScalar : public ScalarBase<ShardedScalar, ShardedStor>
+{
+  public:
+    using ScalarBase<ShardedScalar, ShardedStor>::operator=;
+
+    ShardedScalar(Group *parent = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStor>(
+                parent, nullptr, units::Unspecified::get(), nullptr)
+    {
+    }
+
+    ShardedScalar(Group *parent, const char *name, const char *desc = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStor>(
+                parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    ShardedScalar(Group *parent, const char *name, const units::Base *unit,
+                  const char *desc = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStor>(parent, name, unit, desc)
+    {
+    }
+};
+
 /**
  * A stat that calculates the per tick average of a value.
  * @sa Stat, ScalarBase, AvgStor
@@ -1976,6 +2099,9 @@ class Average : public ScalarBase<Average, AvgStor>
         : ScalarBase<Average, AvgStor>(parent, name, unit, desc)
     {
     }
+
+    /** The average changes with time, even if it isn't written */
+    bool changed() const { return true; }
 };
 
 class Value : public ValueBase<Value>
@@ -2024,6 +2150,32 @@ class Vector : public VectorBase<Vector, StatStor>
     }
 };
 
+/**
+ * A vector of scalar counters that can be updated by several host threads.
+ * @sa Stat, VectorBase, ShardedStor
+ */
+class ShardedVector : public VectorBase<ShardedVector, ShardedStor>
+{
+  public:
+    ShardedVector(Group *parent = nullptr)
+        : VectorBase<ShardedVector, ShardedStor>(
+                parent, nullptr, units::Unspecified::get(), nullptr)
+    {
+    }
+
+    ShardedVector(Group *parent, const char *name, const char *desc = nullptr)
+        : VectorBase<ShardedVector, ShardedStor>(
+                parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    ShardedVector(Group *parent, const char *name, const units::Base *unit,
+                  const char *desc = nullptr)
+        : VectorBase<ShardedVector, ShardedStor>(parent, name, unit, desc)
+    {
+    }
+};
+
 /**
  * A vector of Average stats.
  * @sa Stat, VectorBase, AvgStor
@@ -2048,6 +2200,9 @@ class AverageVector : public VectorBase<AverageVector, AvgStor>
         : VectorBase<AverageVector, AvgStor>(parent, name, unit, desc)
     {
     }
+
+    /** The averages change with time, even if they aren't written */
+    bool changed() const { return true; }
 };
 
 /**
@@ -2235,6 +2390,9 @@ class AverageDeviation : public DistBase<AverageDeviation, AvgSampleStor>
         this->doInit();
         this->setParams(params);
     }
+
+    /** The per tick values change with time, even without samples */
+    bool changed() const { return true; }
 };
 
 /**
@@ -2369,6 +2527,9 @@ class VectorAverageDeviation
         this->setParams(params);
         return this->self();
     }
+
+    /** The per tick values change with time, even without samples */
+    bool changed() const { return true; }
 };
 
 template <class Stat>
@@ -2461,7 +2622,12 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        data()->sample(v, n);
+        this->markChanged();
+    }
 
     /**
      * Return the number of entries in this stat.
@@ -2477,6 +2643,10 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     void
     prepare()
     {
+        // The prepared data is still valid if nothing was sampled
+        if (!this->self().changed())
+            return;
+
         Info *info = this->info();
         data()->prepare(info->getStorageParams(), info->data);
     }
@@ -2488,6 +2658,7 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     reset()
     {
         data()->reset(this->info()->getStorageParams());
+        this->markChanged();
     }
 };
 
@@ -2542,6 +2713,18 @@ class Formula : public DataWrapVec<Formula, FormulaInfoProxy>
     NodePtr root;
     friend class Temp;
 
+    /**
+     * The last result and total of the formula. They are reused while
+     * none of the operands change, so unchanged formulas are only
+     * evaluated once.
+     */
+    mutable VResult cachedResult;
+    mutable Result cachedTotal = 0.0;
+    mutable bool cacheValid = false;
+
+    /** Update the cached result and total if the operands changed */
+    void evaluate() const;
+
   public:
     /**
      * Create and initialize thie formula, and register it with the database.
@@ -2612,7 +2795,11 @@ class Formula : public DataWrapVec<Formula, FormulaInfoProxy>
      */
     size_type size() const;
 
-    void prepare() { }
+    /**
+     * Evaluate the formula if any of its operands changed since it was
+     * last evaluated.
+     */
+    void prepare();
 
     /**
      * Formulas don't need to be reset
@@ -2624,6 +2811,12 @@ class Formula : public DataWrapVec<Formula, FormulaInfoProxy>
      */
     bool zero() const;
 
+    /**
+     * @return true if any of the operands of the formula may have changed
+     * since their changes were last cleared.
+     */
+    bool changed() const;
+
     std::string str() const;
 };
 
@@ -2639,6 +2832,7 @@ class FormulaNode : public Node
     size_type size() const { return formula.size(); }
     const VResult &result() const { formula.result(vec); return vec; }
     Result total() const { return formula.total(); }
+    bool changed() const { return formula.changed(); }
 
     std::string str() const { return formula.str(); }
 };
@@ -2699,6 +2893,14 @@ class Temp
         : node(new ScalarStatNode(s.info()))
     { }
 
+    /**
+     * Create a new ScalarStatNode.
+     * @param s The ScalarStat to place in a node.
+     */
+    Temp(const ShardedScalar &s)
+        : node(new ScalarStatNode(s.info()))
+    { }
+
     /**
      * Create a new VectorStatNode.
      * @param s The VectorStat to place in a node.
@@ -2711,6 +2913,10 @@ class Temp
         : node(new VectorStatNode(s.info()))
     { }
 
+    Temp(const ShardedVector &s)
+        : node(new VectorStatNode(s.info()))
+    { }
+
     /**
      *
      */
@@ -2882,18 +3088,24 @@ sum(Temp val)
 /** Dump all statistics data to the registered outputs */
 void dump();
 void reset();
+/**
+ * Dump a snapshot of the statistics without stopping the other event
+ * queues. Only sharded stats are guaranteed to be read consistently.
+ */
+void snapshot();
 void enable();
 bool enabled();
 const Info* resolve(const std::string &name);
 
 /**
- * Register reset and dump handlers.  These are the functions which
- * will actually perform the whole statistics reset/dump actions
+ * Register reset, dump and snapshot handlers.  These are the functions
+ * which will actually perform the whole statistics reset/dump actions
  * including processing the reset/dump callbacks
  */
 typedef void (*Handler)();
 
-void registerHandlers(Handler reset_handler, Handler dump_handler);
+void registerHandlers(Handler reset_handler, Handler dump_handler,
+                      Handler snapshot_handler=nullptr);
 
 /**
  * Register a callback that should be called whenever statistics are
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/columnar.hh"
+
+#include <cassert>
+#include <iterator>
+#include <sstream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** The header of each record of the data file. */
+struct RecordHeader
+{
+    uint32_t layout;
+    uint32_t reserved;
+    uint64_t tick;
+    uint64_t size;
+};
+
+/** The names of the values of a distribution, before its buckets. */
+const char *const distFields[] = {
+    "samples", "sum", "squares", "logs", "min_value", "max_value",
+    "underflows", "overflows",
+};
+
+constexpr std::size_t numDistFields = std::size(distFields);
+
+/** Write a string as a JSON string. */
+void
+writeString(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+          case '"':
+            os << "\\\"";
+            break;
+          case '\\':
+            os << "\\\\";
+            break;
+          case '\n':
+            os << "\\n";
+            break;
+          case '\t':
+            os << "\\t";
+            break;
+          default:
+            if ((unsigned char)c < 0x20) {
+                static const char hex[] = "0123456789abcdef";
+                os << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+/** Write a JSON array of strings, unless they are all empty. */
+void
+writeStrings(std::ostream &os, const char *key,
+             const std::vector<std::string> &strs)
+{
+    bool empty = true;
+    for (const auto &s : strs) {
+        empty = empty && s.empty();
+    }
+    if (empty) {
+        return;
+    }
+
+    os << ", \"" << key << "\": [";
+    for (std::size_t i = 0; i < strs.size(); i++) {
+        if (i > 0) {
+            os << ", ";
+        }
+        writeString(os, strs[i]);
+    }
+    os << "]";
+}
+
+/** Write the parameters of a distribution. */
+void
+writeDistParams(std::ostream &os, const DistData &data)
+{
+    static const char *const types[] = { "deviation", "dist", "hist" };
+    os << ", \"dist_type\": \"" << types[data.type] << "\""
+       << ", \"min\": " << data.min << ", \"max\": " << data.max
+       << ", \"bucket_size\": " << data.bucket_size
+       << ", \"buckets\": " << data.cvec.size() << ", \"fields\": [";
+    for (std::size_t i = 0; i < numDistFields; i++) {
+        os << (i > 0 ? ", " : "") << '"' << distFields[i] << '"';
+    }
+    os << "]";
+}
+
+} // anonymous namespace
+
+Columnar::Columnar(const std::string &file)
+    : fname(file), stream(file, std::ios::binary | std::ios::trunc),
+      lastLayout(0)
+{
+    if (!valid())
+        fatal("Unable to open statistics file '%s' for writing\n", fname);
+
+    const uint32_t header[4] = {
+        0x356d6567, // "gem5"
+        0x74617473, // "stat"
+        version,
+        sizeof(header),
+    };
+    stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    stream.flush();
+    writeSchema();
+}
+
+void
+Columnar::begin()
+{
+    paths.clear();
+    paths.emplace_back();
+    pathStack = std::stack<std::size_t>();
+    pathStack.push(0);
+    entries.clear();
+    values.clear();
+}
+
+void
+Columnar::end()
+{
+    assert(valid());
+
+    RecordHeader header;
+    header.layout = findLayout();
+    header.reserved = 0;
+    header.tick = curTick();
+    header.size = values.size();
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char *>(values.data()),
+                 values.size() * sizeof(double));
+    stream.flush();
+}
+
+bool
+Columnar::valid() const
+{
+    return stream.good();
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    const std::string &parent = paths[pathStack.top()];
+    paths.push_back(parent.empty() ? name : parent + "." + name);
+    pathStack.push(paths.size() - 1);
+}
+
+void
+Columnar::endGroup()
+{
+    assert(pathStack.size() > 1);
+    pathStack.pop();
+}
+
+void
+Columnar::addEntry(const Info &info, std::size_t size)
+{
+    entries.push_back({&info, pathStack.top(), values.size(), size});
+}
+
+void
+Columnar::appendDist(const DistData &data)
+{
+    values.insert(values.end(), {
+        data.samples, data.sum, data.squares, data.logs, data.min_val,
+        data.max_val, data.underflow, data.overflow,
+    });
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    addEntry(info, 1);
+    values.push_back(info.result());
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    const VResult &vr = info.result();
+    addEntry(info, vr.size());
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    addEntry(info, numDistFields + info.data.cvec.size());
+    appendDist(info.data);
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    std::size_t size = 0;
+    for (const auto &data : info.data) {
+        size += numDistFields + data.cvec.size();
+    }
+    addEntry(info, size);
+    for (const auto &data : info.data) {
+        appendDist(data);
+    }
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    addEntry(info, info.cvec.size());
+    values.insert(values.end(), info.cvec.begin(), info.cvec.end());
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    visit(static_cast<const VectorInfo &>(info));
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    warn_once("Columnar stat files don't support sparse histograms.\n");
+}
+
+uint32_t
+Columnar::findLayout()
+{
+    auto matches = [this](const Layout &layout) {
+        if (layout.infos.size() != entries.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < entries.size(); i++) {
+            if (layout.infos[i] != entries[i].info ||
+                layout.sizes[i] != entries[i].size) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Most of the dumps are of the same stats as the previous one
+    if (lastLayout < layouts.size() && matches(layouts[lastLayout])) {
+        return lastLayout;
+    }
+    for (uint32_t i = 0; i < layouts.size(); i++) {
+        if (matches(layouts[i])) {
+            lastLayout = i;
+            return i;
+        }
+    }
+
+    // A new set of stats, describe it in the schema
+    Layout layout;
+    std::ostringstream os;
+    os << "{\"size\": " << values.size() << ", \"stats\": [";
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        layout.infos.push_back(entries[i].info);
+        layout.sizes.push_back(entries[i].size);
+        os << (i > 0 ? ",\n    " : "\n    ");
+        writeSchemaEntry(os, entries[i]);
+    }
+    os << "]}";
+
+    layouts.push_back(std::move(layout));
+    layoutSchemas.push_back(os.str());
+    writeSchema();
+
+    lastLayout = layouts.size() - 1;
+    return lastLayout;
+}
+
+void
+Columnar::writeSchemaEntry(std::ostream &os, const Entry &entry) const
+{
+    const Info &info = *entry.info;
+    const std::string &path = paths[entry.path];
+
+    os << "{\"name\": ";
+    writeString(os, path.empty() ? info.name : path + "." + info.name);
+    os << ", \"unit\": ";
+    writeString(os, info.unit->getUnitString());
+    os << ", \"desc\": ";
+    writeString(os, info.desc);
+    os << ", \"offset\": " << entry.offset << ", \"size\": " << entry.size;
+
+    if (auto formula = dynamic_cast<const FormulaInfo *>(&info)) {
+        os << ", \"type\": \"formula\", \"equation\": ";
+        writeString(os, formula->str());
+        writeStrings(os, "subnames", formula->subnames);
+        writeStrings(os, "subdescs", formula->subdescs);
+    } else if (auto vector = dynamic_cast<const VectorInfo *>(&info)) {
+        os << ", \"type\": \"vector\"";
+        writeStrings(os, "subnames", vector->subnames);
+        writeStrings(os, "subdescs", vector->subdescs);
+    } else if (auto vector2d = dynamic_cast<const Vector2dInfo *>(&info)) {
+        os << ", \"type\": \"vector2d\", \"x\": " << vector2d->x
+           << ", \"y\": " << vector2d->y;
+        writeStrings(os, "subnames", vector2d->subnames);
+        writeStrings(os, "y_subnames", vector2d->y_subnames);
+        writeStrings(os, "subdescs", vector2d->subdescs);
+    } else if (auto dist = dynamic_cast<const DistInfo *>(&info)) {
+        os << ", \"type\": \"dist\"";
+        writeDistParams(os, dist->data);
+    } else if (auto vdist = dynamic_cast<const VectorDistInfo *>(&info)) {
+        os << ", \"type\": \"vectordist\", \"count\": " << vdist->data.size();
+        if (!vdist->data.empty()) {
+            writeDistParams(os, vdist->data[0]);
+        }
+        writeStrings(os, "subnames", vdist->subnames);
+        writeStrings(os, "subdescs", vdist->subdescs);
+    } else {
+        os << ", \"type\": \"scalar\"";
+    }
+    os << "}";
+}
+
+void
+Columnar::writeSchema() const
+{
+    const std::string schema_name = fname + ".json";
+    std::ofstream schema(schema_name, std::ios::trunc);
+    if (!schema.good())
+        fatal("Unable to open statistics schema '%s' for writing\n",
+              schema_name);
+
+    schema << "{\"version\": " << version << ", \"layouts\": [";
+    for (std::size_t i = 0; i < layoutSchemas.size(); i++) {
+        schema << (i > 0 ? ",\n  " : "\n  ") << layoutSchemas[i];
+    }
+    schema << "]}\n";
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename)
+{
+    return std::unique_ptr<Output>(new Columnar(simout.resolve(filename)));
+}
+
+} // namespace statistics
+} // namespace gem5
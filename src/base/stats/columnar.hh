@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Info;
+
+/**
+ * A binary, columnar stats output. The values of every dump are appended
+ * as a raw array of doubles, so a dump does not format any text, and the
+ * file can be mapped by the readers. The names, units and descriptions of
+ * the stats are written once, in a JSON schema next to the data file.
+ *
+ * The data file starts with a header holding the magic bytes "gem5stat",
+ * the format version and the size of the header, each as a 32-bit value.
+ * Each dump then appends a record header, holding the layout of the dump,
+ * its tick and its number of values, followed by its values in visit
+ * order. All the values are in the host byte order.
+ *
+ * The layouts are the different sets of stats dumped, e.g., when only
+ * some subtrees are dumped, and the schema describes where each stat is
+ * in the values of the records of each layout. See m5.stats.columnar for
+ * the reader.
+ */
+class Columnar : public Output
+{
+  public:
+    /** Version of the file format */
+    static constexpr uint32_t version = 1;
+
+    /**
+     * @param file The path of the data file. The schema is written to the
+     *             same path with a ".json" suffix.
+     */
+    Columnar(const std::string &file);
+
+    Columnar() = delete;
+    Columnar(const Columnar &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** A stat of the current dump. */
+    struct Entry
+    {
+        /** The stat */
+        const Info *info;
+        /** Index of the group path of the stat in the current dump */
+        std::size_t path;
+        /** Offset of the values of the stat in the record */
+        std::size_t offset;
+        /** Number of values of the stat */
+        std::size_t size;
+    };
+
+    /** A set of stats dumped, in visit order. */
+    struct Layout
+    {
+        std::vector<const Info *> infos;
+        std::vector<std::size_t> sizes;
+    };
+
+    /**
+     * Add an entry for a stat to the current dump.
+     *
+     * @param info The stat.
+     * @param size The number of values of the stat.
+     */
+    void addEntry(const Info &info, std::size_t size);
+
+    /**
+     * Append the values of a distribution to the current dump.
+     */
+    void appendDist(const DistData &data);
+
+    /**
+     * Find the layout of the current dump, adding it to the schema if it
+     * has not been dumped before.
+     *
+     * @return The index of the layout.
+     */
+    uint32_t findLayout();
+
+    /** Write a schema entry for a stat. */
+    void writeSchemaEntry(std::ostream &os, const Entry &entry) const;
+
+    /** Rewrite the schema with all the layouts. */
+    void writeSchema() const;
+
+  protected:
+    const std::string fname;
+    std::ofstream stream;
+
+    /** The group paths of the current dump */
+    std::vector<std::string> paths;
+    std::stack<std::size_t> pathStack;
+
+    /** The stats and values of the current dump */
+    std::vector<Entry> entries;
+    std::vector<double> values;
+
+    /** The layouts dumped so far, and their schemas */
+    std::vector<Layout> layouts;
+    std::vector<std::string> layoutSchemas;
+
+    /** The layout of the previous dump */
+    uint32_t lastLayout;
+};
+
+std::unique_ptr<Output> initColumnar(const std::string &filename);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/columnar.hh"
+#include "base/stats/info.hh"
+
+using namespace gem5;
+
+// The columnar output uses curTick() for the ticks of the dumps
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+class TestScalarInfo : public statistics::ScalarInfo
+{
+  public:
+    double val = 0;
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { val = 0; }
+    bool zero() const override { return val == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+class TestVectorInfo : public statistics::VectorInfo
+{
+  public:
+    statistics::VCounter vals;
+    statistics::VResult results;
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::size_type size() const override { return vals.size(); }
+    const statistics::VCounter &value() const override { return vals; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        return results;
+    }
+
+    statistics::Result total() const override { return 0; }
+};
+
+/** The contents of a file. */
+std::string
+readFile(const std::string &path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+/** The record header of a dump. */
+struct Record
+{
+    uint32_t layout;
+    uint32_t reserved;
+    uint64_t tick;
+    uint64_t size;
+};
+
+class StatsColumnarTest : public testing::Test
+{
+  protected:
+    const std::string path = "columnar.test.col";
+
+    TestScalarInfo scalar;
+    TestVectorInfo vector;
+
+    void
+    SetUp() override
+    {
+        scalar.setName("scalar", false);
+        scalar.desc = "A \"scalar\"";
+        vector.setName("vector", false);
+        vector.results = {1, 2, 3};
+        vector.vals = vector.results;
+    }
+
+    void
+    TearDown() override
+    {
+        std::remove(path.c_str());
+        std::remove((path + ".json").c_str());
+    }
+
+    /** Dump the stats, only the scalar if only_scalar is set. */
+    void
+    dump(statistics::Columnar &output, bool only_scalar = false)
+    {
+        output.begin();
+        output.beginGroup("system");
+        scalar.visit(output);
+        if (!only_scalar) {
+            vector.visit(output);
+        }
+        output.endGroup();
+        output.end();
+    }
+};
+
+} // anonymous namespace
+
+/** The header is written when the output is created. */
+TEST_F(StatsColumnarTest, Header)
+{
+    statistics::Columnar output(path);
+    ASSERT_TRUE(output.valid());
+
+    const std::string data = readFile(path);
+    ASSERT_EQ(data.size(), 16);
+    ASSERT_EQ(data.substr(0, 8), "gem5stat");
+
+    uint32_t words[2];
+    std::memcpy(words, data.data() + 8, sizeof(words));
+    ASSERT_EQ(words[0], statistics::Columnar::version);
+    ASSERT_EQ(words[1], 16);
+}
+
+/** Each dump appends its record, in the same layout. */
+TEST_F(StatsColumnarTest, Dumps)
+{
+    statistics::Columnar output(path);
+    tickHandler.setCurTick(100);
+    scalar.val = 5;
+    dump(output);
+    tickHandler.setCurTick(200);
+    scalar.val = 7;
+    dump(output);
+
+    const std::string data = readFile(path);
+    const std::size_t record_size = sizeof(Record) + 4 * sizeof(double);
+    ASSERT_EQ(data.size(), 16 + 2 * record_size);
+
+    const Tick ticks[2] = {100, 200};
+    const double scalars[2] = {5, 7};
+    for (int i = 0; i < 2; i++) {
+        const char *record = data.data() + 16 + i * record_size;
+        Record header;
+        std::memcpy(&header, record, sizeof(header));
+        ASSERT_EQ(header.layout, 0);
+        ASSERT_EQ(header.tick, ticks[i]);
+        ASSERT_EQ(header.size, 4);
+
+        double values[4];
+        std::memcpy(values, record + sizeof(header), sizeof(values));
+        ASSERT_EQ(values[0], scalars[i]);
+        ASSERT_EQ(values[1], 1);
+        ASSERT_EQ(values[2], 2);
+        ASSERT_EQ(values[3], 3);
+    }
+}
+
+/** The schema describes the stats of each layout. */
+TEST_F(StatsColumnarTest, Schema)
+{
+    statistics::Columnar output(path);
+    dump(output);
+
+    const std::string schema = readFile(path + ".json");
+    ASSERT_NE(schema.find("\"name\": \"system.scalar\""), std::string::npos);
+    ASSERT_NE(schema.find("\"desc\": \"A \\\"scalar\\\"\""),
+              std::string::npos);
+    ASSERT_NE(schema.find("\"name\": \"system.vector\""), std::string::npos);
+    ASSERT_NE(schema.find("\"offset\": 1, \"size\": 3, \"type\": \"vector\""),
+              std::string::npos);
+}
+
+/** A dump of other stats adds a layout, and earlier layouts are reused. */
+TEST_F(StatsColumnarTest, Layouts)
+{
+    statistics::Columnar output(path);
+    dump(output);
+    dump(output, true);
+    dump(output);
+
+    const std::string data = readFile(path);
+    const std::size_t sizes[3] = {4, 1, 4};
+    const uint32_t layouts[3] = {0, 1, 0};
+    std::size_t offset = 16;
+    for (int i = 0; i < 3; i++) {
+        Record header;
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        ASSERT_EQ(header.layout, layouts[i]);
+        ASSERT_EQ(header.size, sizes[i]);
+        offset += sizeof(header) + header.size * sizeof(double);
+    }
+    ASSERT_EQ(offset, data.size());
+
+    const std::string schema = readFile(path + ".json");
+    ASSERT_NE(schema.find("{\"size\": 4"), std::string::npos);
+    ASSERT_NE(schema.find("{\"size\": 1"), std::string::npos);
+}
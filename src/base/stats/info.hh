@@ -156,6 +156,18 @@ class Info
      */
     virtual bool zero() const = 0;
 
+    /**
+     * @return true if the stat may have changed since the last time its
+     * changes were cleared. Stats that can't track their changes are
+     * always considered changed.
+     */
+    virtual bool changed() const { return true; }
+
+    /**
+     * Clear the changes of the stat, called after it has been dumped.
+     */
+    virtual void clearChanged() {}
+
     /**
      * Visitor entry for outputing statistics data
      */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/shm_export.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/statistics.hh"
+#include "base/stats/info.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+SharedMemoryExport::SharedMemoryExport(const std::string &_name,
+                                       const std::vector<std::string> &stats)
+    : name(_name), segment(nullptr), segmentSize(0), values(nullptr),
+      numValues(0)
+{
+    std::vector<Entry> entries;
+    std::size_t names_size = 0;
+    for (const auto &stat : stats) {
+        const Info *info = resolve(stat);
+        fatal_if(!info, "Can't export unknown stat '%s'.", stat);
+
+        std::size_t size;
+        if (dynamic_cast<const ScalarInfo *>(info)) {
+            size = 1;
+        } else if (auto *vector = dynamic_cast<const VectorInfo *>(info)) {
+            // Formulas are vectors too
+            size = vector->size();
+        } else {
+            fatal("Can't export '%s', only scalars, vectors and formulas "
+                  "can be exported.", stat);
+        }
+
+        // The stats are prepared before they are read, as for a dump
+        infos.push_back(const_cast<Info *>(info));
+        entries.push_back({(uint32_t)numValues, (uint32_t)size,
+                           (uint32_t)names_size, (uint32_t)stat.size()});
+        numValues += size;
+        names_size += stat.size();
+    }
+
+    const std::size_t table_offset = sizeof(Header);
+    const std::size_t names_offset =
+        table_offset + entries.size() * sizeof(Entry);
+    const std::size_t values_offset =
+        roundUp(names_offset + names_size, sizeof(double));
+    segmentSize = values_offset + numValues * sizeof(double);
+
+    // Replace any stale segment, e.g., from a simulation that crashed
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    fatal_if(fd == -1, "Can't create the shared memory segment '%s': %s",
+             name, strerror(errno));
+    fatal_if(ftruncate(fd, segmentSize) != 0,
+             "Can't resize the shared memory segment '%s': %s", name,
+             strerror(errno));
+
+    void *map = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd, 0);
+    close(fd);
+    fatal_if(map == MAP_FAILED, "Can't map the shared memory segment "
+             "'%s': %s", name, strerror(errno));
+    segment = static_cast<uint8_t *>(map);
+
+    Header *header = new (segment) Header;
+    std::memcpy(header->magic, "gem5live", sizeof(header->magic));
+    header->version = version;
+    header->numStats = entries.size();
+    header->numValues = numValues;
+    header->tableOffset = table_offset;
+    header->valuesOffset = values_offset;
+    header->reserved = 0;
+    header->sequence.store(0, std::memory_order_relaxed);
+    header->tick = 0;
+    header->updates = 0;
+
+    uint8_t *names = segment + names_offset;
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        entries[i].nameOffset += names_offset;
+        std::memcpy(names, stats[i].data(), stats[i].size());
+        names += stats[i].size();
+    }
+    std::memcpy(segment + table_offset, entries.data(),
+                entries.size() * sizeof(Entry));
+
+    values = reinterpret_cast<double *>(segment + values_offset);
+    std::fill(values, values + numValues, 0.0);
+}
+
+SharedMemoryExport::~SharedMemoryExport()
+{
+    munmap(segment, segmentSize);
+    shm_unlink(name.c_str());
+}
+
+void
+SharedMemoryExport::update(Tick tick)
+{
+    // Read the values before the segment is marked as being updated, so
+    // readers only retry while the values are copied.
+    std::vector<double> current;
+    current.reserve(numValues);
+    for (auto *info : infos) {
+        info->prepare();
+        if (auto *scalar = dynamic_cast<const ScalarInfo *>(info)) {
+            current.push_back(scalar->result());
+        } else {
+            auto *vector = static_cast<const VectorInfo *>(info);
+            const VResult &result = vector->result();
+            // The size of the formulas is fixed once they are created,
+            // but don't overrun the segment if a result is shorter
+            const std::size_t size = vector->size();
+            for (std::size_t i = 0; i < size; i++)
+                current.push_back(i < result.size() ? result[i] : 0.0);
+        }
+    }
+    assert(current.size() == numValues);
+
+    Header *header = reinterpret_cast<Header *>(segment);
+    const uint64_t sequence =
+        header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::copy(current.begin(), current.end(), values);
+    header->tick = tick;
+    header->updates++;
+
+    header->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+} // namespace statistics
+} // namespace gem5
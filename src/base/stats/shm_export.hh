@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_SHM_EXPORT_HH__
+#define __BASE_STATS_SHM_EXPORT_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Info;
+
+/**
+ * Export the live values of a set of stats into a POSIX shared memory
+ * segment, so that external monitors can watch them without any stat
+ * dump. Scalars, vectors and formulas can be exported.
+ *
+ * The segment starts with a header (see Header), followed by a table
+ * with the offset, size and name of each stat, the names, and the values
+ * as doubles. All the values are in the host byte order. The segment is
+ * updated in place: the sequence number of the header is odd while the
+ * values are written, so a reader retries if the sequence number was odd
+ * or changed while it copied the values. See util/stats_monitor.py for a
+ * reader.
+ */
+class SharedMemoryExport
+{
+  public:
+    /** Version of the segment layout */
+    static constexpr uint32_t version = 1;
+
+    /** The header of the segment. */
+    struct Header
+    {
+        /** "gem5live" */
+        char magic[8];
+        uint32_t version;
+        /** Number of stats */
+        uint32_t numStats;
+        /** Number of values */
+        uint32_t numValues;
+        /** Offset of the table of stats from the start of the segment */
+        uint32_t tableOffset;
+        /** Offset of the values from the start of the segment */
+        uint32_t valuesOffset;
+        uint32_t reserved;
+        /** The sequence number, odd while the values are updated */
+        std::atomic<uint64_t> sequence;
+        /** The tick of the last update */
+        uint64_t tick;
+        /** The number of updates */
+        uint64_t updates;
+    };
+
+    /** An entry of the table of stats. */
+    struct Entry
+    {
+        /** Index of the first value of the stat */
+        uint32_t offset;
+        /** Number of values of the stat */
+        uint32_t size;
+        /** Offset of the name from the start of the segment */
+        uint32_t nameOffset;
+        /** Length of the name */
+        uint32_t nameLength;
+    };
+
+    /**
+     * Create the segment, replacing any existing segment of the same
+     * name. The segment is removed when the export is destroyed.
+     *
+     * @param name The name of the segment, e.g., "/gem5-stats".
+     * @param stats The names of the stats to export.
+     */
+    SharedMemoryExport(const std::string &name,
+                       const std::vector<std::string> &stats);
+    ~SharedMemoryExport();
+
+    SharedMemoryExport(const SharedMemoryExport &other) = delete;
+    SharedMemoryExport &operator=(const SharedMemoryExport &other) = delete;
+
+    /** Write the current values of the stats to the segment. */
+    void update(Tick tick);
+
+  protected:
+    const std::string name;
+
+    /** The exported stats */
+    std::vector<Info *> infos;
+
+    /** The segment */
+    uint8_t *segment;
+    std::size_t segmentSize;
+
+    /** The values in the segment */
+    double *values;
+    std::size_t numValues;
+};
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_SHM_EXPORT_HH__
@@ -41,6 +41,7 @@
 
 #include "base/stats/storage.hh"
 
+#include <algorithm>
 #include <cmath>
 
 namespace gem5
@@ -49,6 +50,82 @@ namespace gem5
 namespace statistics
 {
 
+std::vector<std::unique_ptr<ShardedStor::Shard>> ShardedStor::shards;
+std::mutex ShardedStor::shardsMutex;
+std::size_t ShardedStor::numSlots = 0;
+thread_local ShardedStor::Shard *ShardedStor::localShard = nullptr;
+
+ShardedStor::ShardedStor(const StorageParams* const storage_params)
+    : slot([]() {
+          std::lock_guard<std::mutex> lock(shardsMutex);
+          return numSlots++;
+      }())
+{
+}
+
+ShardedStor::Shard &
+ShardedStor::growLocalShard(std::size_t slot)
+{
+    std::lock_guard<std::mutex> lock(shardsMutex);
+    assert(slot < numSlots);
+
+    Shard *shard = localShard;
+    if (!shard) {
+        shards.emplace_back(new Shard);
+        shard = shards.back().get();
+        localShard = shard;
+    }
+
+    // Readers hold the lock, so the counters can be replaced. Allocate
+    // all the slots at once, as stats are usually all created before any
+    // of them is written.
+    auto counters = std::make_unique<std::atomic<Counter>[]>(numSlots);
+    for (std::size_t i = 0; i < numSlots; i++) {
+        counters[i].store(i < shard->size ?
+            shard->counters[i].load(std::memory_order_relaxed) : Counter(),
+            std::memory_order_relaxed);
+    }
+    shard->counters = std::move(counters);
+    shard->size = numSlots;
+
+    return *shard;
+}
+
+void
+ShardedStor::set(Counter val)
+{
+    std::atomic<Counter> &counter = localCounter();
+
+    std::lock_guard<std::mutex> lock(shardsMutex);
+    for (const auto &shard : shards) {
+        if (slot < shard->size && &shard->counters[slot] != &counter)
+            val -= shard->counters[slot].load(std::memory_order_relaxed);
+    }
+    counter.store(val, std::memory_order_relaxed);
+}
+
+Counter
+ShardedStor::value() const
+{
+    std::lock_guard<std::mutex> lock(shardsMutex);
+    Counter total = Counter();
+    for (const auto &shard : shards) {
+        if (slot < shard->size)
+            total += shard->counters[slot].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void
+ShardedStor::reset(const StorageParams* const storage_params)
+{
+    std::lock_guard<std::mutex> lock(shardsMutex);
+    for (const auto &shard : shards) {
+        if (slot < shard->size)
+            shard->counters[slot].store(Counter(), std::memory_order_relaxed);
+    }
+}
+
 void
 DistStor::sample(Counter val, int number)
 {
@@ -57,7 +134,10 @@ DistStor::sample(Counter val, int number)
         underflow += number;
     else if (val > max_track)
         overflow += number;
-    else {
+    else if (bucket_scale != 0) {
+        // The values are not below min_track, so truncating is flooring
+        cvec[(size_type)((val - min_track) * bucket_scale)] += number;
+    } else {
         cvec[std::floor((val - min_track) / bucket_size)] += number;
     }
 
@@ -109,6 +189,7 @@ HistStor::growOut()
     max_bucket *= 2;
     min_bucket *= 2;
     bucket_size *= 2;
+    bucket_scale /= 2;
 }
 
 void
@@ -148,28 +229,37 @@ HistStor::growDown()
 
     // Only update the bucket size once the range has been updated
     bucket_size *= 2;
+    bucket_scale /= 2;
 }
 
 void
-HistStor::growUp()
+HistStor::growUp(int times)
 {
-    int size = cvec.size();
-    int half = (size + 1) / 2; // round up!
-
-    int pair = 0;
-    for (int i = 0; i < half; i++) {
-        cvec[i] = cvec[pair];
-        if (pair + 1 < size)
-            cvec[i] += cvec[pair + 1];
-        pair += 2;
+    assert(times > 0);
+    const size_type size = cvec.size();
+
+    // Each new bucket absorbs 2^times of the current ones
+    const size_type group = times < 32 && (size_type(1) << times) < size ?
+        size_type(1) << times : size;
+    const size_type used = (size + group - 1) / group; // round up!
+
+    size_type first = 0;
+    for (size_type i = 0; i < used; i++) {
+        const size_type last = std::min(first + group, size);
+        Counter total = cvec[first];
+        for (size_type j = first + 1; j < last; j++)
+            total += cvec[j];
+        cvec[i] = total;
+        first = last;
     }
-    assert(pair == size || pair == size + 1);
+    assert(first == size);
 
-    for (int i = half; i < size; i++)
+    for (size_type i = used; i < size; i++)
         cvec[i] = Counter();
 
-    max_bucket *= 2;
-    bucket_size *= 2;
+    max_bucket = std::ldexp(max_bucket, times);
+    bucket_size = std::ldexp(bucket_size, times);
+    bucket_scale = std::ldexp(bucket_scale, -times);
 }
 
 void
@@ -184,8 +274,15 @@ HistStor::sample(Counter val, int number)
             growOut();
     } else if (val >= max_bucket + bucket_size) {
         if (min_bucket == 0) {
-            while (val >= max_bucket + bucket_size)
-                growUp();
+            // The range must be doubled until it exceeds the value; find
+            // the number of doublings from the exponent of their ratio,
+            // correcting it when the division rounded up to a power of 2
+            const Counter top = max_bucket + bucket_size;
+            int times = std::ilogb(val / top) + 1;
+            if (std::ldexp(top, times - 1) > val)
+                times--;
+            growUp(times);
+            assert(val < max_bucket + bucket_size);
         } else {
             while (val >= max_bucket + bucket_size)
                 growOut();
@@ -193,15 +290,19 @@ HistStor::sample(Counter val, int number)
     }
 
     assert(bucket_size > 0);
-    size_type index =
-        (int64_t)std::floor((val - min_bucket) / bucket_size);
+    // The value is not below min_bucket, so truncating is flooring
+    size_type index = (int64_t)((val - min_bucket) * bucket_scale);
 
     assert(index < size());
     cvec[index] += number;
 
     sum += val * number;
     squares += val * val * number;
-    logs += std::log(val) * number;
+    if (val != last_log_val) {
+        last_log_val = val;
+        last_log = std::log(val);
+    }
+    logs += last_log * number;
     samples += number;
 }
 
@@ -217,10 +318,13 @@ HistStor::add(HistStor *hs)
     squares += hs->squares;
     samples += hs->samples;
 
-    while (bucket_size > hs->bucket_size)
-        hs->growUp();
-    while (bucket_size < hs->bucket_size)
-        growUp();
+    // Both bucket sizes are powers of 2, so their exponents tell how many
+    // times the smaller one must be doubled
+    const int times = std::ilogb(bucket_size) - std::ilogb(hs->bucket_size);
+    if (times > 0)
+        hs->growUp(times);
+    else if (times < 0)
+        growUp(-times);
 
     for (uint32_t i = 0; i < b_size; i++)
         cvec[i] += hs->cvec[i];
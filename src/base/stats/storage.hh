@@ -30,8 +30,13 @@
 #ifndef __BASE_STATS_STORAGE_HH__
 #define __BASE_STATS_STORAGE_HH__
 
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
@@ -116,6 +121,113 @@ class StatStor
     bool zero() const { return data == Counter(); }
 };
 
+/**
+ * Storage and interface for a scalar stat written by several host threads.
+ * Each thread updates its own shard of the counter without any
+ * synchronisation, and the shards are combined when the stat is read. The
+ * shards of all the sharded stats of a thread are packed together, so
+ * threads never write to the same cache lines. The shards are read
+ * atomically, so the stat can be read while the other threads update it.
+ */
+class ShardedStor
+{
+  private:
+    /** The counters of one host thread. */
+    struct Shard
+    {
+        /** The counter of each slot. */
+        std::unique_ptr<std::atomic<Counter>[]> counters;
+        /** The number of counters. */
+        std::size_t size = 0;
+    };
+
+    /** The shards of all the threads that wrote a sharded stat. */
+    static std::vector<std::unique_ptr<Shard>> shards;
+    /** Protect the list of shards and the growth of the shards. */
+    static std::mutex shardsMutex;
+    /** The number of slots allocated to sharded stats. */
+    static std::size_t numSlots;
+    /** The shard of the calling thread. */
+    static thread_local Shard *localShard;
+
+    /** The slot of this stat in the shards. */
+    const std::size_t slot;
+
+    /**
+     * Get the shard of the calling thread, creating or growing it if it
+     * doesn't include the slot of this stat.
+     */
+    static Shard &growLocalShard(std::size_t slot);
+
+    /** The counter of this stat in the shard of the calling thread. */
+    std::atomic<Counter> &
+    localCounter()
+    {
+        Shard *shard = localShard;
+        if (GEM5_UNLIKELY(!shard || slot >= shard->size))
+            shard = &growLocalShard(slot);
+        return shard->counters[slot];
+    }
+
+  public:
+    struct Params : public StorageParams {};
+
+    ShardedStor(const StorageParams* const storage_params);
+
+    /**
+     * The the stat to the given value.
+     * @param val The new value.
+     */
+    void set(Counter val);
+
+    /**
+     * Increment the stat by the given value.
+     * @param val The new value.
+     */
+    void
+    inc(Counter val)
+    {
+        // Only this thread writes to its counter, so there is no need for
+        // an atomic read-modify-write.
+        std::atomic<Counter> &counter = localCounter();
+        counter.store(counter.load(std::memory_order_relaxed) + val,
+                      std::memory_order_relaxed);
+    }
+
+    /**
+     * Decrement the stat by the given value.
+     * @param val The new value.
+     */
+    void dec(Counter val) { inc(-val); }
+
+    /**
+     * Return the value of this stat as its base type.
+     * @return The sum of the shards of this stat.
+     */
+    Counter value() const;
+
+    /**
+     * Return the value of this stat as a result type.
+     * @return The value of this stat.
+     */
+    Result result() const { return (Result)value(); }
+
+    /**
+     * Prepare stat data for dumping or serialization
+     */
+    void prepare(const StorageParams* const storage_params) { }
+
+    /**
+     * Reset stat value to default. This must not race with updates.
+     */
+    void reset(const StorageParams* const storage_params);
+
+    /**
+     * @return true if zero value
+     */
+    bool zero() const { return value() == Counter(); }
+};
+
 /**
  * Templatized storage and interface to a per-tick average stat. This keeps
  * a current count and updates a total (count * ticks) when this count
@@ -238,6 +350,12 @@ class DistStor
     Counter max_track;
     /** The number of entries in each bucket. */
     Counter bucket_size;
+    /**
+     * The inverse of the bucket size when it is a power of 2, so that the
+     * bucket index is an exact multiplication instead of a division; zero
+     * otherwise.
+     */
+    Counter bucket_scale;
 
     /** The smallest value sampled. */
     Counter min_val;
@@ -348,6 +466,9 @@ class DistStor
         min_track = params->min;
         max_track = params->max;
         bucket_size = params->bucket_size;
+        int exponent;
+        bucket_scale = std::frexp(bucket_size, &exponent) == 0.5 ?
+            1.0 / bucket_size : 0;
 
         min_val = CounterLimits::max();
         max_val = CounterLimits::min();
@@ -404,11 +525,23 @@ class HistStor
     Counter max_bucket;
     /** The number of entries in each bucket. */
     Counter bucket_size;
+    /**
+     * The inverse of the bucket size. As the bucket size is always a power
+     * of 2 it is exact, and a multiplication by it gives the same bucket
+     * index as a division by the bucket size.
+     */
+    Counter bucket_scale;
 
     /** The current sum. */
     Counter sum;
     /** The sum of logarithm of each sample, used to compute geometric mean. */
     Counter logs;
+    /**
+     * The last sampled value and its logarithm. Latencies tend to repeat,
+     * so this saves most of the calls to std::log.
+     */
+    Counter last_log_val;
+    Counter last_log;
     /** The sum of squares. */
     Counter squares;
     /** The number of samples. */
@@ -418,14 +551,17 @@ class HistStor
 
     /**
      * Given a bucket size B, and a range of values [0, N], this function
-     * doubles the bucket size to double the range of values towards the
-     * positive infinite; that is, double the upper range of this storage
-     * so that the range becomes [0, 2*N].
+     * doubles the bucket size the given number of times to double the range
+     * of values towards the positive infinite; that is, double the upper
+     * range of this storage so that the range becomes [0, 2^times*N].
      *
      * Because the bucket size is doubled, the buckets contents are rearranged,
-     * since the original range of values is mapped to the lower half buckets.
+     * since the original range of values is mapped to the lower buckets. All
+     * the doublings are done in a single pass over the buckets.
+     *
+     * @param times The number of times the bucket size is doubled.
      */
-    void growUp();
+    void growUp(int times = 1);
 
     /**
      * Given a bucket size B, and a range of values [M, N], where M < 0, this
@@ -540,6 +676,9 @@ class HistStor
         min_bucket = 0;
         max_bucket = params->buckets - 1;
         bucket_size = 1;
+        bucket_scale = 1;
+        last_log_val = 1;
+        last_log = 0;
 
         size_type size = cvec.size();
         for (off_type i = 0; i < size; ++i)
@@ -30,6 +30,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <thread>
+#include <vector>
 
 #include "base/gtest/cur_tick_fake.hh"
 #include "base/gtest/logging.hh"
@@ -129,6 +131,95 @@ TEST(StatsStatStorTest, ZeroReset)
     ASSERT_FALSE(stor.zero());
 }
 
+/** Test setting and getting a value to the storage. */
+TEST(StatsShardedStorTest, SetValueResult)
+{
+    statistics::ShardedStor stor(nullptr);
+    statistics::Counter val;
+
+    val = 10;
+    stor.set(val);
+    ASSERT_EQ(stor.value(), val);
+    ASSERT_EQ(stor.result(), statistics::Result(val));
+
+    val = 1234;
+    stor.set(val);
+    ASSERT_EQ(stor.value(), val);
+    ASSERT_EQ(stor.result(), statistics::Result(val));
+}
+
+/** Test whether incrementing and decrementing work as expected. */
+TEST(StatsShardedStorTest, IncDec)
+{
+    statistics::ShardedStor stor(nullptr);
+    statistics::Counter diff_val = 10;
+    statistics::Counter val = 0;
+
+    stor.inc(diff_val);
+    val += diff_val;
+    ASSERT_EQ(stor.value(), val);
+
+    stor.dec(diff_val);
+    val -= diff_val;
+    ASSERT_EQ(stor.value(), val);
+
+    stor.dec(diff_val);
+    val -= diff_val;
+    ASSERT_EQ(stor.value(), val);
+}
+
+/** Test whether zero is correctly set as the reset value. */
+TEST(StatsShardedStorTest, ZeroReset)
+{
+    statistics::ShardedStor stor(nullptr);
+    statistics::Counter val = 10;
+
+    ASSERT_TRUE(stor.zero());
+
+    stor.inc(val);
+    ASSERT_FALSE(stor.zero());
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.zero());
+}
+
+/**
+ * Test that the updates of several threads to several stats are combined,
+ * and that setting the value accounts for the shards of all the threads.
+ */
+TEST(StatsShardedStorTest, Threads)
+{
+    const int num_threads = 4;
+    const int num_incs = 1000;
+
+    statistics::ShardedStor stor0(nullptr);
+    statistics::ShardedStor stor1(nullptr);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < num_incs; j++) {
+                stor0.inc(1);
+                stor1.inc(2);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(stor0.value(), num_threads * num_incs);
+    ASSERT_EQ(stor1.value(), 2 * num_threads * num_incs);
+
+    // The other threads are gone, but their shards remain
+    stor0.set(10);
+    ASSERT_EQ(stor0.value(), 10);
+    stor0.inc(1);
+    ASSERT_EQ(stor0.value(), 11);
+
+    stor1.reset(nullptr);
+    ASSERT_TRUE(stor1.zero());
+}
+
 /** Test setting and getting a value to the storage. */
 TEST(StatsAvgStorTest, SetValueResult)
 {
@@ -434,6 +525,38 @@ TEST(StatsDistStorTest, SamplePrepareMultiple)
     prepareCheckDistStor(params, values, num_values, expected_data);
 }
 
+/**
+ * Test sampling with a bucket size that is a power of 2, including
+ * fractional values and values at the bucket boundaries.
+ */
+TEST(StatsDistStorTest, SamplePreparePowerOf2BucketSize)
+{
+    statistics::DistStor::Params params(-8, 23, 4);
+
+    // There are 8 buckets: [-8,-4[, [-4,0[, [0,4[, ..., [20,24[.
+    ValueSamples values[] = {{-8, 3}, {-4.5, 2}, {-4, 7}, {-0.25, 1},
+        {0, 9}, {3.75, 4}, {4, 6}, {19.5, 8}, {23, 5}, {23.5, 10}};
+    int num_values = sizeof(values) / sizeof(ValueSamples);
+
+    statistics::DistData expected_data;
+    expected_data.type = statistics::Dist;
+    expected_data.min_val = -8;
+    expected_data.max_val = 23.5;
+    expected_data.bucket_size = params.bucket_size;
+    expected_data.underflow = 0;
+    expected_data.overflow = 10;
+    expected_data.cvec.clear();
+    expected_data.cvec.resize(params.buckets);
+    expected_data.cvec[0] = 3+2;
+    expected_data.cvec[1] = 7+1;
+    expected_data.cvec[2] = 9+4;
+    expected_data.cvec[3] = 6;
+    expected_data.cvec[6] = 8;
+    expected_data.cvec[7] = 5;
+
+    prepareCheckDistStor(params, values, num_values, expected_data);
+}
+
 /** Test resetting storage. */
 TEST(StatsDistStorTest, Reset)
 {
@@ -667,6 +790,60 @@ TEST(StatsHistStorTest, SamplePrepareMultipleGrowUp)
     prepareCheckHistStor(params, values, num_values, expected_data);
 }
 
+/**
+ * Test a sample that is many bucket size doublings away from the initial
+ * range, and one at the exact upper bound of the grown range.
+ */
+TEST(StatsHistStorTest, SamplePrepareLargeGrowUp)
+{
+    statistics::HistStor::Params params(3);
+
+    // The range is [0,3[ initially, and must be doubled 10 times to hold
+    // 3071; 3072 then needs another doubling. The final buckets will be
+    // divided at:
+    //   Bkt0=[0,2048[ , Bkt1=[2048,4096[, Bkt2=[4096,6144[
+    ValueSamples values[] = {{1, 5}, {2, 2}, {3071, 3}, {3072, 4},
+        {2047, 1}, {6143, 6}};
+    const int num_values = sizeof(values) / sizeof(ValueSamples);
+    statistics::DistData expected_data;
+    expected_data.type = statistics::Hist;
+    expected_data.bucket_size = 2048;
+    expected_data.min = 0;
+    expected_data.max_val = 4096;
+    expected_data.cvec.clear();
+    expected_data.cvec.resize(params.buckets);
+    expected_data.cvec[0] = 5+2+1;
+    expected_data.cvec[1] = 3+4;
+    expected_data.cvec[2] = 6;
+
+    prepareCheckHistStor(params, values, num_values, expected_data);
+}
+
+/**
+ * Test that the logs of repeated and alternating values are accumulated
+ * as if each were computed on its own.
+ */
+TEST(StatsHistStorTest, SamplePrepareRepeatedLogs)
+{
+    statistics::HistStor::Params params(8);
+
+    ValueSamples values[] = {{3, 1}, {3, 2}, {3, 1}, {5, 4}, {3, 1},
+        {5, 1}, {5, 3}, {7, 2}};
+    const int num_values = sizeof(values) / sizeof(ValueSamples);
+    statistics::DistData expected_data;
+    expected_data.type = statistics::Hist;
+    expected_data.bucket_size = 1;
+    expected_data.min = 0;
+    expected_data.max_val = 7;
+    expected_data.cvec.clear();
+    expected_data.cvec.resize(params.buckets);
+    expected_data.cvec[3] = 1+2+1+1;
+    expected_data.cvec[5] = 4+1+3;
+    expected_data.cvec[7] = 2;
+
+    prepareCheckHistStor(params, values, num_values, expected_data);
+}
+
 /**
  * Test samples that have a negative value, and therefore do not fit in the
  * initial buckets. Since this involves using negative values, the logs
@@ -72,6 +72,8 @@ class Text : public Output
     bool enableUnits;
     bool descriptions;
     bool spaces;
+    /** Only output the stats that changed since the last dump */
+    bool changedOnly;
 
   public:
     Text();
@@ -104,7 +106,8 @@ class Text : public Output
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc, bool spaces);
+Output *initText(const std::string &filename, bool desc, bool spaces,
+                 bool changed_only);
 
 } // namespace statistics
 } // namespace gem5
@@ -173,6 +173,18 @@ struct StringWrap
     const std::string &operator()() const { return str; }
 };
 
+/**
+ * Whether the DPRINTFs of debug flag x are compiled in. Debug builds
+ * have the DPRINTFs of all the flags, while opt builds only have those of
+ * the flags selected with the TRACE_FLAGS build option (all of them by
+ * default). The other DPRINTFs are optimized out, as in fast builds.
+ */
+#ifdef GEM5_DEBUG
+#define GEM5_TRACED(x) true
+#else
+#define GEM5_TRACED(x) ::gem5::debug::traced::x
+#endif
+
 /**
  * DPRINTF is a debugging trace facility that allows one to
  * selectively enable tracing statements.  To use DPRINTF, there must
@@ -202,27 +214,31 @@ struct StringWrap
  */
 
 #define DDUMP(x, data, count) do {               \
-    if (GEM5_UNLIKELY(TRACING_ON && ::gem5::debug::x))     \
+    if (GEM5_UNLIKELY(TRACING_ON && GEM5_TRACED(x) &&    \
+                      ::gem5::debug::x))                 \
         ::gem5::trace::getDebugLogger()->dump(           \
             ::gem5::curTick(), name(), data, count, #x); \
 } while (0)
 
 #define DPRINTF(x, ...) do {                     \
-    if (GEM5_UNLIKELY(TRACING_ON && ::gem5::debug::x)) {   \
+    if (GEM5_UNLIKELY(TRACING_ON && GEM5_TRACED(x) && \
+                      ::gem5::debug::x)) {        \
         ::gem5::trace::getDebugLogger()->dprintf_flag(   \
             ::gem5::curTick(), name(), #x, __VA_ARGS__); \
     }                                            \
 } while (0)
 
 #define DPRINTFS(x, s, ...) do {                        \
-    if (GEM5_UNLIKELY(TRACING_ON && ::gem5::debug::x)) {          \
+    if (GEM5_UNLIKELY(TRACING_ON && GEM5_TRACED(x) &&    \
+                      ::gem5::debug::x)) {               \
         ::gem5::trace::getDebugLogger()->dprintf_flag(          \
                 ::gem5::curTick(), (s)->name(), #x, __VA_ARGS__); \
     }                                                   \
 } while (0)
 
 #define DPRINTFR(x, ...) do {                          \
-    if (GEM5_UNLIKELY(TRACING_ON && ::gem5::debug::x)) {         \
+    if (GEM5_UNLIKELY(TRACING_ON && GEM5_TRACED(x) &&   \
+                      ::gem5::debug::x)) {              \
         ::gem5::trace::getDebugLogger()->dprintf_flag(         \
             (::gem5::Tick)-1, std::string(), #x, __VA_ARGS__); \
     }                                                  \
@@ -55,6 +55,10 @@ namespace debug
 /** Debug flag used for the tests in this file. */
 SimpleFlag TraceTestDebugFlag("TraceTestDebugFlag",
     "Exclusive debug flag for the trace tests");
+namespace traced
+{
+constexpr bool TraceTestDebugFlag = true;
+} // namespace traced
 } // namespace debug
 } // namespace gem5
 
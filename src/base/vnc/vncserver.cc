@@ -469,6 +469,7 @@ VncServer::sendServerInit()
     if (!write(&msg))
         return;
     curState = NormalPhase;
+    clientLineHashes.clear();
 }
 
 void
@@ -556,6 +557,12 @@ VncServer::requestFbUpdate()
     DPRINTF(VNC, " -- x = %d y = %d w = %d h = %d\n", fbr.x, fbr.y, fbr.width,
             fbr.height);
 
+    // The client lost track of the image and wants all of it
+    if (!fbr.incremental) {
+        clientLineHashes.clear();
+        sendUpdate = true;
+    }
+
     sendFrameBufferUpdate();
 }
 
@@ -629,7 +636,16 @@ VncServer::sendFrameBufferUpdate()
     // The client will request data constantly, unless we throttle it
     sendUpdate = false;
 
-    DPRINTF(VNC, "Sending framebuffer update\n");
+    assert(fb);
+
+    const auto lines = fb->changedLines(clientLineHashes);
+    if (lines.first == lines.second) {
+        DPRINTF(VNC, "Frame buffer unchanged, NOT sending update\n");
+        return;
+    }
+
+    DPRINTF(VNC, "Sending framebuffer update, lines %d-%d\n",
+            lines.first, lines.second - 1);
 
     FrameBufferUpdate fbu;
     FrameBufferRect fbr;
@@ -637,9 +653,9 @@ VncServer::sendFrameBufferUpdate()
     fbu.type = ServerFrameBufferUpdate;
     fbu.num_rects = 1;
     fbr.x = 0;
-    fbr.y = 0;
+    fbr.y = lines.first;
     fbr.width = videoWidth();
-    fbr.height = videoHeight();
+    fbr.height = lines.second - lines.first;
     fbr.encoding = EncodingRaw;
 
     // fix up endian
@@ -654,16 +670,11 @@ VncServer::sendFrameBufferUpdate()
     if (!write(&fbu) || !write(&fbr))
         return;
 
-    assert(fb);
-
     std::vector<uint8_t> line_buffer(pixelConverter.length * fb->width());
-    for (int y = 0; y < fb->height(); ++y) {
+    for (unsigned y = lines.first; y < lines.second; ++y) {
         // Convert and send a line at a time
-        uint8_t *raw_pixel(line_buffer.data());
-        for (unsigned x = 0; x < fb->width(); ++x) {
-            pixelConverter.fromPixel(raw_pixel, fb->pixel(x, y));
-            raw_pixel += pixelConverter.length;
-        }
+        pixelConverter.fromPixels(line_buffer.data(), &fb->pixel(0, y),
+                                  fb->width());
 
         if (!write(line_buffer.data(), line_buffer.size()))
             return;
@@ -715,6 +726,7 @@ VncServer::setDirty()
 void
 VncServer::frameBufferResized()
 {
+    clientLineHashes.clear();
     if (dataFd > 0 && curState == NormalPhase) {
         if (supportsResizeEnc)
             sendFrameBufferResized();
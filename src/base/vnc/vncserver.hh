@@ -43,6 +43,7 @@
 #define __BASE_VNC_VNC_SERVER_HH__
 
 #include <iostream>
+#include <vector>
 
 #include "base/circlebuf.hh"
 #include "base/compiler.hh"
@@ -202,6 +203,10 @@ class VncServer : public VncInput
      * client will constantly request data that is pointless */
     bool sendUpdate;
 
+    /** Per-line hashes of the image the client last received. Cleared
+     * to force the next update to contain the entire image. */
+    std::vector<uint32_t> clientLineHashes;
+
     /** The one and only pixel format we support */
     PixelFormat pixelFormat;
 
@@ -281,8 +286,8 @@ class VncServer : public VncInput
      */
     void sendError(std::string error_msg);
 
-    /** Send a updated frame buffer to the client.
-     * @todo this doesn't do anything smart and just sends the entire image
+    /** Send a updated frame buffer to the client. Only the band of
+     * lines that changed since the last update is sent.
      */
     void sendFrameBufferUpdate();
 
@@ -35,6 +35,16 @@ class ExeTracer(InstTracer):
     cxx_header = "cpu/exetrace.hh"
 
 
+class BinaryExeTracer(InstTracer):
+    type = "BinaryExeTracer"
+    cxx_class = "gem5::trace::BinaryExeTracer"
+    cxx_header = "cpu/binary_exetrace.hh"
+    file_name = Param.String(
+        "exetrace.bin.gz",
+        "Instruction trace output file (compressed if it ends with .gz)",
+    )
+
+
 class IntelTrace(InstTracer):
     type = "IntelTrace"
     cxx_class = "gem5::trace::IntelTrace"
@@ -28,6 +28,7 @@
 
 #include "cpu/activity.hh"
 
+#include <algorithm>
 #include <string>
 
 #include "cpu/timebuf.hh"
@@ -87,6 +88,13 @@ ActivityRecorder::advance()
     activityBuffer.advance();
 }
 
+bool
+ActivityRecorder::communicating() const
+{
+    return activityCount >
+        std::count(stageActive, stageActive + numStages, true);
+}
+
 void
 ActivityRecorder::activateStage(const int idx)
 {
@@ -90,6 +90,11 @@ class ActivityRecorder
     /** Returns if the CPU should be active. */
     bool active() { return activityCount; }
 
+    /** Returns if any communication was recorded within the longest
+     *  latency, as opposed to stages merely being marked active.
+     */
+    bool communicating() const;
+
     /** Clears the time buffer and the activity count. */
     void reset();
 
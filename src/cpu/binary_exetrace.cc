@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/binary_exetrace.hh"
+
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "cpu/static_inst.hh"
+#include "cpu/thread_context.hh"
+#include "enums/OpClass.hh"
+#include "sim/core.hh"
+
+namespace gem5
+{
+
+namespace trace {
+
+OutputStream *BinaryExeTracer::traceStream;
+std::unique_ptr<BinaryTraceWriter> BinaryExeTracer::writer;
+
+void
+BinaryExeTracerRecord::dump()
+{
+    BinaryTraceWriter::InstData inst = {};
+    inst.type = BinaryTraceWriter::Inst;
+    inst.tick = when;
+    inst.pc = pc->instAddr();
+    inst.microPC = pc->microPC();
+
+    uint8_t flags = 0;
+    if (staticInst->isMicroop())
+        flags |= BinaryTraceWriter::InstData::MicroOp;
+    if (predicate)
+        flags |= BinaryTraceWriter::InstData::Predicate;
+    if (faulting)
+        flags |= BinaryTraceWriter::InstData::Faulting;
+    if (mem_valid) {
+        flags |= BinaryTraceWriter::InstData::MemValid;
+        inst.addr = addr;
+        inst.size = size;
+    }
+    if (fetch_seq_valid) {
+        flags |= BinaryTraceWriter::InstData::FetchSeqValid;
+        inst.fetchSeq = fetch_seq;
+    }
+    if (cp_seq_valid) {
+        flags |= BinaryTraceWriter::InstData::CPSeqValid;
+        inst.cpSeq = cp_seq;
+    }
+    inst.flags = flags;
+
+    // Only register values that fit in a RegVal are recorded
+    if (dataStatus == DataReg) {
+        if (!data.asReg.isBlob()) {
+            inst.data = data.asReg.asRegVal();
+            inst.dataStatus = DataReg;
+        }
+    } else {
+        inst.data = data.asInt;
+        inst.dataStatus = dataStatus;
+    }
+
+    tracer.traceInst(inst, thread, staticInst);
+}
+
+BinaryExeTracer::BinaryExeTracer(const Params &params)
+    : InstTracer(params)
+{
+    // Since there is only one output file for all tracers check if it exists
+    if (!traceStream) {
+        traceStream = simout.create(params.file_name, true);
+        writer.reset(new BinaryTraceWriter(*traceStream->stream()));
+
+        // get a callback when we exit so we can close the file
+        registerExitCallback([]() { closeStreams(); });
+    }
+
+    for (int i = 0; i < enums::Num_OpClass; i++)
+        opClassNames.push_back(writer->intern(enums::OpClassStrings[i]));
+}
+
+void
+BinaryExeTracer::closeStreams()
+{
+    if (!traceStream)
+        return;
+
+    writer.reset();
+    simout.close(traceStream);
+    traceStream = nullptr;
+}
+
+void
+BinaryExeTracer::traceInst(BinaryTraceWriter::InstData &inst,
+                           ThreadContext *tc, const StaticInstPtr &static_inst)
+{
+    if (!writer)
+        return;
+
+    auto it = cpuNames.find(tc);
+    if (it == cpuNames.end()) {
+        it = cpuNames.emplace(
+            tc, writer->intern(tc->getCpuPtr()->name())).first;
+    }
+    inst.cpu = it->second;
+    inst.mnemonic = writer->intern(static_inst->getName());
+    inst.opClass = opClassNames[static_inst->opClass()];
+
+    writer->write(&inst, sizeof(inst));
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_BINARY_EXETRACE_HH__
+#define __CPU_BINARY_EXETRACE_HH__
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/binary_trace.hh"
+#include "debug/ExecEnable.hh"
+#include "params/BinaryExeTracer.hh"
+#include "sim/insttracer.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+class ThreadContext;
+
+namespace trace {
+
+class BinaryExeTracer;
+
+class BinaryExeTracerRecord : public InstRecord
+{
+  public:
+    BinaryExeTracerRecord(BinaryExeTracer &_tracer, Tick _when,
+               ThreadContext *_thread, const StaticInstPtr _staticInst,
+               const PCStateBase &_pc,
+               const StaticInstPtr _macroStaticInst = NULL)
+        : InstRecord(_when, _thread, _staticInst, _pc, _macroStaticInst),
+          tracer(_tracer)
+    {
+    }
+
+    void dump() override;
+
+  protected:
+    BinaryExeTracer &tracer;
+};
+
+/**
+ * Instruction tracer writing a binary record of each executed
+ * instruction (including the microops) with a BinaryTraceWriter, instead
+ * of formatting it like ExeTracer. The instructions are recorded while
+ * ExecEnable is enabled, and the trace is decoded offline with
+ * util/decode_binary_trace.py. All the tracers share one trace file.
+ */
+class BinaryExeTracer : public InstTracer
+{
+  public:
+    typedef BinaryExeTracerParams Params;
+    BinaryExeTracer(const Params &params);
+
+    InstRecord *
+    getInstRecord(Tick when, ThreadContext *tc,
+            const StaticInstPtr staticInst, const PCStateBase &pc,
+            const StaticInstPtr macroStaticInst=nullptr) override
+    {
+        if (!debug::ExecEnable)
+            return NULL;
+
+        return new BinaryExeTracerRecord(*this, when, tc,
+                staticInst, pc, macroStaticInst);
+    }
+
+  protected:
+    /** The output file and writer shared by all the tracers */
+    static OutputStream *traceStream;
+    static std::unique_ptr<BinaryTraceWriter> writer;
+
+    /** Write the trace and close the file */
+    static void closeStreams();
+
+    /** Interned names of the CPUs of the threads */
+    std::unordered_map<ThreadContext *, uint32_t> cpuNames;
+
+    /** Interned names of the op classes */
+    std::vector<uint32_t> opClassNames;
+
+    /** Fill in the names of an instruction and write its record */
+    void traceInst(BinaryTraceWriter::InstData &inst, ThreadContext *tc,
+                   const StaticInstPtr &static_inst);
+
+    friend class BinaryExeTracerRecord;
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __CPU_BINARY_EXETRACE_HH__
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "arch/generic/decode_cache.hh"
+#include "base/stats/group.hh"
+#include "cpu/decode_cache.hh"
+#include "cpu/nop_static_inst.hh"
+#include "cpu/static_inst.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+typedef uint32_t MachInst;
+
+/** A decoder whose instructions are all nops, so decoding is free. */
+class BenchDecoder
+{
+  public:
+    StaticInstPtr decodeInst(MachInst mach_inst) { return nopStaticInstPtr; }
+};
+
+/**
+ * The fetch addresses and instructions of a loop of num_insts 4 byte
+ * instructions, which all decode differently.
+ */
+struct Loop
+{
+    std::vector<Addr> addrs;
+    std::vector<MachInst> insts;
+
+    Loop(int num_insts)
+    {
+        std::mt19937 rng(0);
+        for (int i = 0; i < num_insts; i++) {
+            addrs.push_back(0x10000 + 4 * i);
+            insts.push_back(rng());
+        }
+    }
+};
+
+} // anonymous namespace
+
+/** Decode the instructions of a loop through the page based decode cache. */
+static void
+BM_BasicDecodeCache(benchmark::State &state)
+{
+    BenchDecoder decoder;
+    GenericISA::BasicDecodeCache<BenchDecoder, MachInst> cache;
+    const Loop loop(state.range(0));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const size_t idx = i++ % loop.addrs.size();
+        benchmark::DoNotOptimize(
+                cache.decode(&decoder, loop.insts[idx], loop.addrs[idx]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BasicDecodeCache)->Range(64, 64 << 10);
+
+/**
+ * Decode the instructions of a loop through the L0 cache in front of the
+ * page based decode cache, as most of the ISAs do.
+ */
+static void
+BM_L0DecodeCache(benchmark::State &state)
+{
+    statistics::Group root(nullptr);
+    BenchDecoder decoder;
+    GenericISA::BasicDecodeCache<BenchDecoder, MachInst> cache;
+    decode_cache::L0Cache<MachInst> l0_cache(&root, 4096);
+    const Loop loop(state.range(0));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const size_t idx = i++ % loop.addrs.size();
+        const MachInst mach_inst = loop.insts[idx];
+        const Addr addr = loop.addrs[idx];
+        benchmark::DoNotOptimize(l0_cache.decode(mach_inst, addr, [&]() {
+            return cache.decode(&decoder, mach_inst, addr);
+        }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_L0DecodeCache)->Range(64, 64 << 10);
+
+/** Look up instructions in the map from instructions to decodings. */
+static void
+BM_InstMapFind(benchmark::State &state)
+{
+    BenchDecoder decoder;
+    decode_cache::InstMap<MachInst> inst_map;
+    const Loop loop(state.range(0));
+    for (MachInst mach_inst : loop.insts)
+        inst_map[mach_inst] = decoder.decodeInst(mach_inst);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                inst_map.find(loop.insts[i++ % loop.insts.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InstMapFind)->Range(64, 64 << 10);
@@ -29,10 +29,15 @@
 #ifndef __CPU_DECODE_CACHE_HH__
 #define __CPU_DECODE_CACHE_HH__
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "base/bitfield.hh"
 #include "base/compiler.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/statistics.hh"
 #include "cpu/static_inst_fwd.hh"
 
 namespace gem5
@@ -135,6 +140,96 @@ class AddrMap
     }
 };
 
+/// A small direct-mapped cache of decoded instructions, meant to sit in
+/// front of the slower decode cache maps. Entries are tagged with both the
+/// address and the machine instruction, so they never need to be
+/// invalidated.
+template <typename EMI>
+class L0Cache
+{
+  protected:
+    struct Entry
+    {
+        Addr addr = MaxAddr;
+        EMI machInst = {};
+        StaticInstPtr inst;
+    };
+
+    std::vector<Entry> entries;
+    Addr indexMask;
+
+    struct L0CacheStats : public statistics::Group
+    {
+        L0CacheStats(statistics::Group *parent)
+            : statistics::Group(parent, "decodeL0Cache"),
+              ADD_STAT(hits, statistics::units::Count::get(),
+                       "Number of L0 decode cache hits"),
+              ADD_STAT(misses, statistics::units::Count::get(),
+                       "Number of L0 decode cache misses"),
+              ADD_STAT(hitRate, statistics::units::Ratio::get(),
+                       "Hit rate of the L0 decode cache",
+                       hits / (hits + misses))
+        {}
+
+        statistics::Scalar hits;
+        statistics::Scalar misses;
+        statistics::Formula hitRate;
+    };
+
+    /// Only registered when the cache is enabled, so a disabled cache
+    /// leaves the stats of its decoder unchanged.
+    std::unique_ptr<L0CacheStats> stats;
+
+  public:
+    /// Constructor
+    /// @param parent The statistics group of the decoder.
+    /// @param size The number of entries, a power of 2 or 0 to disable
+    /// the cache.
+    L0Cache(statistics::Group *parent, size_t size)
+        : entries(size), indexMask(size - 1)
+    {
+        fatal_if(size && !isPowerOf2(size),
+                 "The L0 decode cache size (%d) must be a power of 2.",
+                 size);
+        if (size)
+            stats = std::make_unique<L0CacheStats>(parent);
+    }
+
+    /// Look up a decoded instruction, calling decode_inst() to get it
+    /// and filling it in on a miss.
+    /// @param mach_inst The binary instruction.
+    /// @param addr The address the instruction was fetched from.
+    /// @param decode_inst Callable returning the decoded instruction.
+    template <typename DecodeInst>
+    StaticInstPtr
+    decode(const EMI &mach_inst, Addr addr, DecodeInst &&decode_inst)
+    {
+        if (GEM5_UNLIKELY(entries.empty()))
+            return decode_inst();
+
+        Entry &entry = entries[(addr ^ (addr >> 2)) & indexMask];
+        if (entry.addr == addr && entry.machInst == mach_inst) {
+            ++stats->hits;
+            return entry.inst;
+        }
+
+        ++stats->misses;
+        entry.inst = decode_inst();
+        entry.addr = addr;
+        entry.machInst = mach_inst;
+        return entry.inst;
+    }
+
+    /// Drop all the entries, e.g., when the mapping from machine
+    /// instructions to decoded instructions changes.
+    void
+    clear()
+    {
+        for (auto &entry : entries)
+            entry = Entry();
+    }
+};
+
 } // namespace decode_cache
 } // namespace gem5
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/decode_cache_file.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace decode_cache
+{
+
+InstFile::InstFile(const std::string &path, const std::string &tag,
+                   size_t record_size)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(Header)) {
+        len = st.st_size;
+        void *map = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+        data = map == MAP_FAILED ? nullptr : (uint8_t *)map;
+    }
+    close(fd);
+
+    if (!data) {
+        warn("Failed to map the decode cache file %s.\n", path);
+        return;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 ||
+        header.version != Version || header.recordSize != record_size ||
+        strncmp(header.tag, tag.c_str(), sizeof(header.tag)) != 0 ||
+        header.numRecords > (len - sizeof(Header)) / record_size) {
+        warn("Ignoring the decode cache file %s, it was recorded for "
+             "another configuration.\n", path);
+        return;
+    }
+
+    records = data + sizeof(Header);
+    numRecords = header.numRecords;
+}
+
+InstFile::~InstFile()
+{
+    if (data)
+        munmap(data, len);
+}
+
+void
+InstFile::write(const std::string &path, const std::string &tag,
+                const void *records, size_t record_size, size_t count)
+{
+    Header header = {};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.recordSize = record_size;
+    header.numRecords = count;
+    panic_if(tag.size() >= sizeof(header.tag),
+             "Decode cache tag %s is too long.", tag);
+    std::memcpy(header.tag, tag.c_str(), tag.size());
+
+    std::string tmp = csprintf("%s.%d", path, getpid());
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) {
+        warn("Failed to write the decode cache file %s.\n", tmp);
+        return;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+        fwrite(records, record_size, count, f) == count;
+    ok = fclose(f) == 0 && ok;
+
+    if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+        warn("Failed to write the decode cache file %s.\n", path);
+        unlink(tmp.c_str());
+    }
+}
+
+} // namespace decode_cache
+} // namespace gem5
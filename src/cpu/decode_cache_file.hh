@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_DECODE_CACHE_FILE_HH__
+#define __CPU_DECODE_CACHE_FILE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace gem5
+{
+
+namespace decode_cache
+{
+
+/**
+ * A file of the machine instructions decoders have decoded, so that
+ * another run can decode them ahead of time. The file is mapped into
+ * memory when it is read. It is only used if it was recorded with the
+ * same tag, which names the ISA and decoder configuration, and the same
+ * record size. Records are copied bytewise, so they must not own any
+ * resources.
+ */
+class InstFile
+{
+  public:
+    /**
+     * Map the records of a file in. A missing or mismatching file has
+     * no records.
+     *
+     * @param path The file to read
+     * @param tag The ISA and decoder configuration of the records
+     * @param record_size The size of a record in bytes
+     */
+    InstFile(const std::string &path, const std::string &tag,
+             size_t record_size);
+    ~InstFile();
+
+    InstFile(const InstFile &) = delete;
+    InstFile &operator=(const InstFile &) = delete;
+
+    /** The number of records in the file */
+    size_t size() const { return numRecords; }
+
+    /** Get a copy of a record */
+    template <typename Record>
+    Record
+    get(size_t i) const
+    {
+        static_assert(std::is_trivially_destructible_v<Record>);
+        Record record;
+        std::memcpy(static_cast<void *>(&record),
+                    records + i * sizeof(Record), sizeof(Record));
+        return record;
+    }
+
+    /**
+     * Replace a file with records. The file is written next to its final
+     * path and renamed, so runs that share it never see a partial file.
+     */
+    template <typename Record>
+    static void
+    write(const std::string &path, const std::string &tag,
+          const std::vector<Record> &records)
+    {
+        static_assert(std::is_trivially_destructible_v<Record>);
+        write(path, tag, records.data(), sizeof(Record), records.size());
+    }
+
+  private:
+    static void write(const std::string &path, const std::string &tag,
+                      const void *records, size_t record_size,
+                      size_t count);
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t numRecords;
+        char tag[48];
+    };
+
+    static constexpr char Magic[8] = "gem5dec";
+    static constexpr uint32_t Version = 1;
+
+    /** The mapped file, nullptr if there is none */
+    uint8_t *data = nullptr;
+    size_t len = 0;
+
+    const uint8_t *records = nullptr;
+    size_t numRecords = 0;
+};
+
+} // namespace decode_cache
+} // namespace gem5
+
+#endif // __CPU_DECODE_CACHE_FILE_HH__
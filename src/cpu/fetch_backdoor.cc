@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/fetch_backdoor.hh"
+
+#include <cstring>
+
+#include "mem/physical.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+FetchBackdoor::FetchBackdoor(const System &system)
+{
+    tracking = true;
+
+    for (const auto &store : system.getPhysMem().getBackingStore()) {
+        if (store.pmem && !store.range.interleaved())
+            backdoors.insert(store.range, store.pmem);
+    }
+}
+
+bool
+FetchBackdoor::read(Addr paddr, void *data, unsigned size) const
+{
+    if (isWritten(paddr >> PageShift) ||
+            isWritten((paddr + size - 1) >> PageShift)) {
+        return false;
+    }
+
+    auto it = backdoors.contains(RangeSize(paddr, size));
+    if (it == backdoors.end())
+        return false;
+
+    std::memcpy(data, it->second + (paddr - it->first.start()), size);
+    return true;
+}
+
+} // namespace gem5
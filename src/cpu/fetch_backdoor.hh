@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_FETCH_BACKDOOR_HH__
+#define __CPU_FETCH_BACKDOOR_HH__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "base/addr_range_map.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class System;
+
+/**
+ * Serve instruction fetches straight from the host memory backing the
+ * simulated physical memory, in the same way the KVM CPU maps it, so that
+ * timing CPUs only have to model the latency of the fetch.
+ *
+ * Written data might still be sitting in caches, so every physical page
+ * written through a CPU data port, a DMA port or a functional port proxy is
+ * excluded from the fast path and fetched through the memory system again.
+ * The filter of written pages is shared by all the CPUs of the
+ * simulation.
+ */
+class FetchBackdoor
+{
+  private:
+    static constexpr unsigned PageShift = 12;
+    static constexpr size_t FilterPages = 1 << 20;
+
+    /** Host memory for the physical address ranges. */
+    AddrRangeMap<uint8_t *, 1> backdoors;
+
+    /** Filter of the physical pages that have been written to. */
+    static inline std::array<std::atomic<uint64_t>, FilterPages / 64>
+        writtenPages = {};
+    /** Are there any users of the filter? */
+    static inline std::atomic<bool> tracking = false;
+
+    static bool
+    isWritten(Addr page)
+    {
+        const size_t bit = page % FilterPages;
+        return writtenPages[bit / 64].load(std::memory_order_relaxed) &
+            (1ULL << (bit % 64));
+    }
+
+  public:
+    FetchBackdoor(const System &system);
+
+    /**
+     * Read a fetch straight from host memory.
+     *
+     * @param paddr Physical address of the fetch.
+     * @param data Buffer to read the fetch into.
+     * @param size Size of the fetch.
+     * @return True if the fetch was served, false if it has to go through
+     * the memory system.
+     */
+    bool read(Addr paddr, void *data, unsigned size) const;
+
+    /**
+     * Note a write to physical memory. CPUs call this for all the writes
+     * they issue or snoop, whether or not they fetch through a backdoor,
+     * and DMA ports and port proxies for the writes of devices and
+     * functional accesses.
+     */
+    static void
+    written(Addr paddr, unsigned size)
+    {
+        if (GEM5_LIKELY(!tracking.load(std::memory_order_relaxed)) ||
+                size == 0) {
+            return;
+        }
+        const Addr last = (paddr + size - 1) >> PageShift;
+        for (Addr page = paddr >> PageShift; page <= last; ++page) {
+            const size_t bit = page % FilterPages;
+            writtenPages[bit / 64].fetch_or(1ULL << (bit % 64),
+                                            std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace gem5
+
+#endif // __CPU_FETCH_BACKDOOR_HH__
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_INST_COUNT_EVENT_QUEUE_HH__
+#define __CPU_INST_COUNT_EVENT_QUEUE_HH__
+
+#include <string>
+
+#include "base/compiler.hh"
+#include "base/types.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * An event queue keyed by the number of committed instructions.
+ *
+ * The CPU models report every committed instruction through
+ * serviceEvents(). The instruction count of the earliest event is
+ * cached, so that a commit is a single compare against it. The queue
+ * itself is only touched when an event is actually due.
+ *
+ * Events must be (de)scheduled through this class rather than through
+ * a plain EventQueue reference, otherwise the cached count goes stale.
+ */
+class InstCountEventQueue : public EventQueue
+{
+  public:
+    explicit InstCountEventQueue(const std::string &n)
+        : EventQueue(n), nextEventCount(MaxTick)
+    {}
+
+    void
+    schedule(Event *event, Tick count)
+    {
+        EventQueue::schedule(event, count);
+        updateNextEventCount();
+    }
+
+    void
+    deschedule(Event *event)
+    {
+        EventQueue::deschedule(event);
+        updateNextEventCount();
+    }
+
+    void
+    reschedule(Event *event, Tick count, bool always=false)
+    {
+        EventQueue::reschedule(event, count, always);
+        updateNextEventCount();
+    }
+
+    /**
+     * Update the committed instruction count and service any events
+     * that are due.
+     *
+     * @param count Number of instructions committed so far.
+     */
+    void
+    serviceEvents(Tick count)
+    {
+        if (GEM5_LIKELY(count < nextEventCount)) {
+            setCurTick(count);
+            return;
+        }
+
+        EventQueue::serviceEvents(count);
+        updateNextEventCount();
+    }
+
+  private:
+    void
+    updateNextEventCount()
+    {
+        nextEventCount = empty() ? MaxTick : nextTick();
+    }
+
+    /** Instruction count of the earliest scheduled event */
+    Tick nextEventCount;
+};
+
+} // namespace gem5
+
+#endif // __CPU_INST_COUNT_EVENT_QUEUE_HH__
@@ -71,6 +71,11 @@ class BaseKvmCPU(BaseCPU):
     alwaysSyncTC = Param.Bool(
         False, "Always sync thread contexts on entry/exit"
     )
+    instStopSkid = Param.Counter(
+        0,
+        "Stop this many instructions before instruction events and "
+        "single-step the rest to reach them exactly (0 to disable)",
+    )
 
     hostFreq = Param.Clock("2GHz", "Host clock frequency")
     hostFactor = Param.Float(1.0, "Cycle scale factor")
@@ -37,6 +37,7 @@ from m5.params import *
 from m5.proxy import *
 
 from m5.SimObject import SimObject
+from m5.util.pybind import *
 
 
 class KvmVM(SimObject):
@@ -44,8 +45,16 @@ class KvmVM(SimObject):
     cxx_header = "cpu/kvm/vm.hh"
     cxx_class = "gem5::KvmVM"
 
+    cxx_exports = [PyBindMethod("writtenPages")]
+
     coalescedMMIO = VectorParam.AddrRange(
         [], "memory ranges for coalesced MMIO"
     )
 
     system = Param.System(Parent.any, "system this VM belongs to")
+
+    dirty_log = Param.Bool(
+        False,
+        "Log the pages written by the guest, to get them with writtenPages(), "
+        "e.g., to warm up caches when switching to other CPUs",
+    )
@@ -44,6 +44,7 @@
 
 #include <cerrno>
 #include <csignal>
+#include <cstring>
 #include <ostream>
 
 #include "base/compiler.hh"
@@ -77,6 +78,7 @@ BaseKvmCPU::BaseKvmCPU(const BaseKvmCPUParams &params)
       tickEvent([this]{ tick(); }, "BaseKvmCPU tick",
                 false, Event::CPU_Tick_Pri),
       activeInstPeriod(0),
+      instStopSkid(params.instStopSkid), singleStepping(false),
       perfControlledByTimer(params.usePerfOverflow),
       hostFactor(params.hostFactor), stats(this),
       ctrInsts(0)
@@ -277,7 +279,11 @@ BaseKvmCPU::StatGroup::StatGroup(statistics::Group *parent)
              "number of VM exits due to wait for interrupt instructions"),
     ADD_STAT(numInterrupts, statistics::units::Count::get(),
              "number of interrupts delivered"),
-    ADD_STAT(numHypercalls, statistics::units::Count::get(), "number of hypercalls")
+    ADD_STAT(numHypercalls, statistics::units::Count::get(), "number of hypercalls"),
+    ADD_STAT(numSingleSteps, statistics::units::Count::get(),
+             "number of VM exits due to single-stepping"),
+    ADD_STAT(numInstStopOvershoots, statistics::units::Count::get(),
+             "number of instruction events the guest ran past")
 {
 }
 
@@ -615,6 +621,15 @@ BaseKvmCPU::tick()
           if (ticksToExecute > 0)
               setupInstStop();
 
+          // Remember the PC of the instruction we are about to step
+          // to report it to the RetiredInstsPC probe listeners, e.g.,
+          // the PcCountTrackers.
+          Addr stepPC = 0;
+          if (singleStepping) {
+              syncThreadContext();
+              stepPC = tc->pcState().instAddr();
+          }
+
           DPRINTF(KvmRun, "Entering KVM...\n");
           if (drainState() == DrainState::Draining) {
               // Force an immediate exit from KVM after completing
@@ -649,9 +664,17 @@ BaseKvmCPU::tick()
               _status = Running;
           }
 
+          if (singleStepping && _kvmRun->exit_reason == KVM_EXIT_DEBUG)
+              ppRetiredInstsPC->notify(stepPC);
+
           // Service any pending instruction events. The vCPU should
           // have exited in time for the event using the instruction
           // counter configured by setupInstStop().
+          if (nextInstEvent != MaxTick && ctrInsts > nextInstEvent) {
+              DPRINTF(KvmRun, "KVM: Overshot instruction event by %i "
+                      "instructions\n", ctrInsts - nextInstEvent);
+              ++stats.numInstStopOvershoots;
+          }
           queue.serviceEvents(ctrInsts);
 
           if (tryDrain())
@@ -1022,6 +1045,13 @@ BaseKvmCPU::handleKvmExit()
          * tick. */
         return 0;
 
+      case KVM_EXIT_DEBUG:
+        /* The guest stepped an instruction, setupInstStop() decides
+         * whether to keep stepping in the next tick. */
+        panic_if(!singleStepping, "KVM: Unexpected debug exit\n");
+        ++stats.numSingleSteps;
+        return 0;
+
       case KVM_EXIT_INTERNAL_ERROR:
         panic("KVM: Internal error (suberror: %u)\n",
               _kvmRun->internal.suberror);
@@ -1085,7 +1115,7 @@ BaseKvmCPU::doMMIOAccess(Addr paddr, void *data, int size, bool write)
     ThreadContext *tc(thread->getTC());
     syncThreadContext();
 
-    RequestPtr mmio_req = std::make_shared<Request>(
+    RequestPtr mmio_req = Request::make(
         paddr, size, Request::UNCACHEABLE, dataRequestorId());
 
     mmio_req->setContext(tc->contextId());
@@ -1334,13 +1364,43 @@ BaseKvmCPU::setupInstStop()
 {
     if (thread->comInstEventQueue.empty()) {
         setupInstCounter(0);
+        setSingleStep(false);
     } else {
         Tick next = thread->comInstEventQueue.nextTick();
         assert(next > ctrInsts);
-        setupInstCounter(next - ctrInsts);
+        const uint64_t remaining(next - ctrInsts);
+        if (remaining > instStopSkid) {
+            setupInstCounter(remaining - instStopSkid);
+            setSingleStep(false);
+        } else {
+            // The overflow signal could arrive too late this close to
+            // the event, step the remaining instructions instead.
+            setupInstCounter(0);
+            setSingleStep(true);
+        }
     }
 }
 
+void
+BaseKvmCPU::setSingleStep(bool enable)
+{
+    if (enable == singleStepping)
+        return;
+
+    struct kvm_guest_debug dbg;
+    std::memset(&dbg, 0, sizeof(dbg));
+    if (enable)
+        dbg.control = KVM_GUESTDBG_ENABLE | KVM_GUESTDBG_SINGLESTEP;
+
+    if (ioctl(KVM_SET_GUEST_DEBUG, (void *)&dbg) == -1)
+        panic("KVM: Failed to %s single-stepping (errno: %i)\n",
+              enable ? "enable" : "disable", errno);
+
+    DPRINTF(KvmRun, "KVM: %s single-stepping\n",
+            enable ? "Enabling" : "Disabling");
+    singleStepping = enable;
+}
+
 void
 BaseKvmCPU::setupInstCounter(uint64_t period)
 {
@@ -736,6 +736,16 @@ class BaseKvmCPU : public BaseCPU
      */
     void setupInstStop();
 
+    /**
+     * Enable or disable single-stepping of the guest.
+     *
+     * While single-stepping, every entry into KVM executes at most
+     * one guest instruction and exits with KVM_EXIT_DEBUG.
+     *
+     * @param enable True to single-step, false to run freely.
+     */
+    void setSingleStep(bool enable);
+
     /** @{ */
     /** Setup hardware performance counters */
     void setupCounters();
@@ -755,6 +765,18 @@ class BaseKvmCPU : public BaseCPU
     /** Currently active instruction count breakpoint */
     uint64_t activeInstPeriod;
 
+    /**
+     * Number of instructions before an instruction event at which the
+     * counter overflow stops the guest. The counter overflow signal
+     * is delivered with some skid, so the guest single-steps the rest
+     * of the way to stop exactly at the event. 0 relies on the
+     * overflow alone.
+     */
+    const uint64_t instStopSkid;
+
+    /** Is the guest currently single-stepping? */
+    bool singleStepping;
+
     /**
      * Guest cycle counter.
      *
@@ -813,6 +835,8 @@ class BaseKvmCPU : public BaseCPU
         statistics::Scalar numHalt;
         statistics::Scalar numInterrupts;
         statistics::Scalar numHypercalls;
+        statistics::Scalar numSingleSteps;
+        statistics::Scalar numInstStopOvershoots;
     } stats;
     /* @} */
 
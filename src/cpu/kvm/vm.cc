@@ -48,6 +48,8 @@
 #include <cerrno>
 #include <memory>
 
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
 #include "cpu/kvm/base.hh"
 #include "debug/Kvm.hh"
 #include "mem/physical.hh"
@@ -319,7 +321,9 @@ KvmVM::KvmVM(const KvmVMParams &params)
       vmFD(kvm->createVM()),
       started(false),
       _hasKernelIRQChip(false),
-      nextVCPUID(0)
+      nextVCPUID(0),
+      dirtyLog(params.dirty_log), checkpointLog(false),
+      hostPageShift(floorLog2(sysconf(_SC_PAGESIZE)))
 {
     system->setKvmVM(this);
     maxMemorySlot = kvm->capNumMemSlots();
@@ -367,8 +371,16 @@ KvmVM::cpuStartup()
 void
 KvmVM::delayedStartup()
 {
+    memory::PhysicalMemory &physmem = system->getPhysMem();
     const std::vector<memory::BackingStoreEntry> &memories(
-        system->getPhysMem().getBackingStore());
+        physmem.getBackingStore());
+
+    // The guest writes the memory directly, so the pages it writes are
+    // logged if the physical memory tracks the writes
+    checkpointLog = physmem.trackedWriter([this]() { syncDirtyLog(); });
+    if (!checkpointLog)
+        physmem.untrackedWriter(name());
+    const bool log_dirty = checkpointLog || dirtyLog;
 
     DPRINTF(Kvm, "Mapping %i memory region(s)\n", memories.size());
     for (int slot(0); slot < memories.size(); ++slot) {
@@ -390,7 +402,15 @@ KvmVM::delayedStartup()
             }
 
             const MemSlot slot = allocMemSlot(range.size());
-            setupMemSlot(slot, pmem, range.start(), 0/* flags */);
+            setupMemSlot(slot, pmem, range.start(),
+                         log_dirty ? KVM_MEM_LOG_DIRTY_PAGES : 0);
+            if (log_dirty) {
+                const size_t words =
+                    divCeil(range.size() >> hostPageShift, 64);
+                loggedSlots.push_back({ slot, range,
+                        std::vector<uint64_t>(words),
+                        std::vector<uint64_t>(dirtyLog ? words : 0) });
+            }
         } else {
             DPRINTF(Kvm, "Zero-region not mapped: [0x%llx]\n", range.start());
             hack("KVM: Zero memory handled as IO\n");
@@ -398,6 +418,63 @@ KvmVM::delayedStartup()
     }
 }
 
+void
+KvmVM::syncDirtyLog()
+{
+    if (vmFD == -1)
+        return;
+
+    const memory::PhysicalMemory &physmem = system->getPhysMem();
+    for (auto &logged : loggedSlots) {
+        struct kvm_dirty_log log;
+        memset(&log, 0, sizeof(log));
+        log.slot = logged.slot.num;
+        log.dirty_bitmap = logged.log.data();
+        if (ioctl(KVM_GET_DIRTY_LOG, (void *)&log) == -1)
+            panic("KVM: Failed to get the dirty log (errno: %i)\n", errno);
+
+        for (size_t i = 0; i < logged.log.size(); ++i) {
+            uint64_t word = logged.log[i];
+            if (!word)
+                continue;
+            if (dirtyLog)
+                logged.written[i] |= word;
+            if (!checkpointLog)
+                continue;
+            while (word) {
+                const unsigned bit = ctz64(word);
+                word &= word - 1;
+                physmem.markWritten(logged.range.start() +
+                        ((i * 64 + bit) << hostPageShift),
+                        1ULL << hostPageShift);
+            }
+        }
+    }
+}
+
+std::vector<Addr>
+KvmVM::writtenPages()
+{
+    panic_if(!dirtyLog, "%s: The dirty pages aren't logged.", name());
+
+    syncDirtyLog();
+
+    std::vector<Addr> pages;
+    for (auto &logged : loggedSlots) {
+        for (size_t i = 0; i < logged.written.size(); ++i) {
+            uint64_t word = logged.written[i];
+            while (word) {
+                const unsigned bit = ctz64(word);
+                word &= word - 1;
+                pages.push_back(logged.range.start() +
+                        ((i * 64 + bit) << hostPageShift));
+            }
+            logged.written[i] = 0;
+        }
+    }
+    return pages;
+}
+
 const KvmVM::MemSlot
 KvmVM::allocMemSlot(uint64_t size)
 {
@@ -423,6 +423,16 @@ class KvmVM : public SimObject
     /** Verify gem5 configuration will support KVM emulation */
     bool validEnvironment() const;
 
+    /**
+     * Get the pages written by the guest since the last call, as the
+     * physical addresses of the host pages. The VM must log the dirty
+     * pages (see the dirty_log parameter).
+     *
+     * This can be used, e.g., to warm up the caches when switching from
+     * the KVM CPUs to the timing CPUs.
+     */
+    std::vector<Addr> writtenPages();
+
     /**
       * Get the VCPUID for a given context
       */
@@ -456,6 +466,13 @@ class KvmVM : public SimObject
      */
     void cpuStartup();
 
+    /**
+     * Get the log of the pages the guest wrote since the last time, and
+     * report them to the physical memory if it tracks the writes. This
+     * also clears the log.
+     */
+    void syncDirtyLog();
+
     /**
      * Delayed initialization, executed once before the first CPU
      * starts.
@@ -557,6 +574,24 @@ class KvmVM : public SimObject
     };
     std::vector<MemorySlot> memorySlots;
     uint32_t maxMemorySlot;
+
+    /** Should the pages written by the guest be logged? */
+    const bool dirtyLog;
+    /** Are the writes logged for the delta checkpoints? */
+    bool checkpointLog;
+
+    /** A memory slot logging the pages written by the guest. */
+    struct LoggedSlot
+    {
+        MemSlot slot;
+        AddrRange range;
+        /** The log got from KVM, one bit per host page. */
+        std::vector<uint64_t> log;
+        /** The pages written since the last writtenPages(). */
+        std::vector<uint64_t> written;
+    };
+    std::vector<LoggedSlot> loggedSlots;
+    unsigned hostPageShift;
 };
 
 } // namespace gem5
@@ -348,6 +348,23 @@ class SelfStallingPipeline : public MinorBuffer<ElemType, ReportTraits>
     /** There's data (not a bubble) at the end of the pipe */
     bool isPopable() { return !BubbleTraits::isBubble(front()); }
 
+    /** How many advance()s will it take for the data nearest the end of
+     *  the pipe to reach the end and stall the pipe?  Returns 0 if the
+     *  pipe is already stalled or holds no data */
+    unsigned int
+    advancesBeforeStall() const
+    {
+        if (stalled)
+            return 0;
+
+        for (int i = this->past - 1; i >= 0; i--) {
+            if (!BubbleTraits::isBubble((*this)[-i]))
+                return this->past - i;
+        }
+
+        return 0;
+    }
+
     /** Try to advance the pipeline.  If we're stalled, don't advance.  If
      *  we're not stalled, advance then check to see if we become stalled
      *  (a non-bubble at the end of the pipe) */
@@ -294,7 +294,7 @@ MinorCPU::wakeupOnEvent(unsigned int stage_id)
 
     /* Mark that some activity has taken place and start the pipeline */
     activityRecorder->activateStage(stage_id);
-    pipeline->start();
+    pipeline->wakeup();
 }
 
 Port &
@@ -182,7 +182,7 @@ Decode::evaluate()
                     /* Get the micro-op static instruction from the
                      * static_inst. */
                     static_micro_inst =
-                        static_inst->fetchMicroop(
+                        static_inst->microop(
                                 decode_info.microopPC->microPC());
 
                     output_inst =
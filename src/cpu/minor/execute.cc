@@ -92,7 +92,8 @@ Execute::Execute(const std::string &name_,
             ExecuteThreadInfo(params.executeCommitLimit)),
     interruptPriority(0),
     issuePriority(0),
-    commitPriority(0)
+    commitPriority(0),
+    quiescentCycles(0)
 {
     if (commitLimit < 1) {
         fatal("%s: executeCommitLimit must be >= 1 (%d)\n", name_,
@@ -1521,13 +1522,20 @@ Execute::evaluate()
     }
 
     bool becoming_stalled = true;
+    bool became_stalled = false;
 
     /* Advance the pipelines and note whether they still need to be
      * advanced */
     for (unsigned int i = 0; i < numFuncUnits; i++) {
         FUPipeline *fu = funcUnits[i];
+        bool was_stalled = fu->stalled;
         fu->advance();
 
+        /* An inst. newly arrived at the end of an FU may be committed or
+         *  issued to memory next cycle */
+        if (fu->stalled && !was_stalled)
+            became_stalled = true;
+
         /* If we need to tick again, the pipeline will have been left or set
          * to be unstalled */
         if (fu->occupancy !=0 && !fu->stalled)
@@ -1595,6 +1603,55 @@ Execute::evaluate()
     if (need_to_tick)
         cpu.wakeupOnEvent(Pipeline::ExecuteStageId);
 
+    /* If the only reason to tick is to move insts. down FU pipelines
+     *  which are not yet stalled, and the next insts. to issue can only
+     *  be unblocked by a memory response or a commit, nothing but those
+     *  FUs can change until the first inst. reaches the end of its FU */
+    quiescentCycles = Cycles(0);
+
+    bool only_fus_advance = need_to_tick && num_issued == 0 &&
+        !can_issue_next && !head_inst_might_commit && !became_stalled &&
+        !interrupted && branch.isBubble() && lsq.isQuiescent();
+
+    for (ThreadID tid = 0; only_fus_advance && tid < cpu.numThreads; tid++)
+        only_fus_advance = executeInfo[tid].drainState == NotDraining;
+
+    for (auto inst : next_issuable_insts) {
+        if (!only_fus_advance)
+            break;
+
+        bool fu_can_take_inst = false;
+        for (unsigned int i = 0; i < numFuncUnits; i++) {
+            if (!funcUnits[i]->stalled &&
+                funcUnits[i]->provides(inst->staticInst->opClass()))
+            {
+                fu_can_take_inst = true;
+            }
+        }
+
+        only_fus_advance = !fu_can_take_inst ||
+            scoreboard[inst->id.threadId].waitsOnUnpredictableResult(inst,
+                cpu.getContext(inst->id.threadId));
+    }
+
+    if (only_fus_advance) {
+        unsigned int advances = 0;
+
+        for (unsigned int i = 0; i < numFuncUnits; i++) {
+            unsigned int fu_advances = funcUnits[i]->advancesBeforeStall();
+
+            if (fu_advances != 0 &&
+                (advances == 0 || fu_advances < advances))
+            {
+                advances = fu_advances;
+            }
+        }
+
+        /* The advance which stalls the FU must be a real evaluate */
+        if (advances > 1)
+            quiescentCycles = Cycles(advances - 1);
+    }
+
     /* Note activity of following buffer */
     if (!branch.isBubble())
         cpu.activityRecorder->activity();
@@ -1604,6 +1661,19 @@ Execute::evaluate()
         inputBuffer[inp.outputWire->threadId].pushTail();
 }
 
+void
+Execute::skipCycles(Cycles n)
+{
+    assert(n <= quiescentCycles);
+
+    for (Cycles i(0); i < n; ++i) {
+        for (unsigned int j = 0; j < numFuncUnits; j++)
+            funcUnits[j]->advance();
+    }
+
+    quiescentCycles = Cycles(0);
+}
+
 ThreadID
 Execute::checkInterrupts(BranchData& branch, bool& interrupted)
 {
@@ -210,6 +210,10 @@ class Execute : public Named
     ThreadID issuePriority;
     ThreadID commitPriority;
 
+    /** The number of cycles following the last evaluate in which Execute
+     *  would do nothing but advance its FU pipelines.  Set by evaluate */
+    Cycles quiescentCycles;
+
   protected:
     friend std::ostream &operator <<(std::ostream &os, DrainState state);
 
@@ -349,6 +353,14 @@ class Execute : public Named
 
     void minorTrace() const;
 
+    /** How many of the following cycles can be skipped by the pipeline
+     *  if no other stage has any work to do.  See skipCycles */
+    Cycles getQuiescentCycles() const { return quiescentCycles; }
+
+    /** Bring the FU pipelines up to date with n skipped cycles which
+     *  must be no more than the last getQuiescentCycles */
+    void skipCycles(Cycles n);
+
     /** After thread suspension, has Execute been drained of in-flight
      *  instructions and memory accesses. */
     bool isDrained();
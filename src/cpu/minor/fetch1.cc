@@ -727,6 +727,30 @@ Fetch1::wakeupFetch(ThreadID tid)
     cpu.wakeupOnEvent(Pipeline::Fetch1StageId);
 }
 
+bool
+Fetch1::isQuiescent()
+{
+    if (numInFlightFetches() < fetchLimit) {
+        for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+            if (cpu.getContext(tid)->status() == ThreadContext::Active &&
+                fetchInfo[tid].state == FetchRunning &&
+                nextStageReserve[tid].canReserve())
+            {
+                return false;
+            }
+        }
+    }
+
+    bool requests_waiting = requests.empty() ||
+        icacheState == IcacheNeedsRetry ||
+        requests.front()->state == FetchRequest::InTranslation;
+
+    bool transfers_waiting = transfers.empty() ||
+        !transfers.front()->isComplete();
+
+    return requests_waiting && transfers_waiting;
+}
+
 bool
 Fetch1::isDrained()
 {
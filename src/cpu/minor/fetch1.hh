@@ -182,7 +182,7 @@ class Fetch1 : public Named
             pc(pc_),
             fault(NoFault)
         {
-            request = std::make_shared<Request>();
+            request = Request::make();
         }
 
         ~FetchRequest();
@@ -406,6 +406,11 @@ class Fetch1 : public Named
     /** Is this stage drained?  For Fetch1, draining is initiated by
      *  Execute signalling a branch with the reason HaltFetch */
     bool isDrained();
+
+    /** Will evaluating Fetch1 change nothing until a TLB or memory
+     *  response, a retry or a branch arrives?  True when no new line
+     *  can be fetched and no queued fetch can move on */
+    bool isQuiescent();
 };
 
 } // namespace minor
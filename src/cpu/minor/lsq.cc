@@ -43,6 +43,7 @@
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/minor/exec_context.hh"
 #include "cpu/minor/execute.hh"
 #include "cpu/minor/pipeline.hh"
@@ -71,7 +72,7 @@ LSQ::LSQRequest::LSQRequest(LSQ &port_, MinorDynInstPtr inst_, bool isLoad_,
     isTranslationDelayed(false),
     state(NotIssued)
 {
-    request = std::make_shared<Request>();
+    request = Request::make();
 }
 
 void
@@ -493,7 +494,7 @@ LSQ::SplitDataRequest::makeFragmentRequests()
             }
         }
 
-        RequestPtr fragment = std::make_shared<Request>();
+        RequestPtr fragment = Request::make();
         bool disabled_fragment = false;
 
         fragment->setContext(request->contextId());
@@ -1215,6 +1216,9 @@ LSQ::tryToSend(LSQRequestPtr request)
         } else if (dcachePort.sendTimingReq(packet)) {
             DPRINTF(MinorMem, "Sent data memory request\n");
 
+            if (packet->isWrite())
+                FetchBackdoor::written(packet->getAddr(), packet->getSize());
+
             numAccessesInMemorySystem++;
 
             request->stepToNextPacket();
@@ -1579,6 +1583,19 @@ LSQ::needsToTick()
     return ret;
 }
 
+bool
+LSQ::isQuiescent()
+{
+    /* Nothing can be sent until the retry arrives */
+    if (state == MemoryNeedsRetry)
+        return true;
+
+    bool requests_waiting = requests.empty() ||
+        requests.front()->state == LSQRequest::InTranslation;
+
+    return requests_waiting && storeBuffer.numUnissuedStores() == 0;
+}
+
 Fault
 LSQ::pushRequest(MinorDynInstPtr inst, bool isLoad, uint8_t *data,
                  unsigned int size, Addr addr, Request::Flags flags,
@@ -705,6 +705,10 @@ class LSQ : public Named
      *  an actionable transfers or address translation */
     bool needsToTick();
 
+    /** Is stepping the queues certain to do nothing until a TLB or memory
+     *  response, or a retry, arrives? */
+    bool isQuiescent();
+
     /** Complete a barrier instruction.  Where committed, makes a
      *  BarrierDataRequest and pushed it into the store buffer */
     void completeMemBarrierInst(MinorDynInstPtr inst,
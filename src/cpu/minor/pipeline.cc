@@ -43,6 +43,7 @@
 #include "cpu/minor/execute.hh"
 #include "cpu/minor/fetch1.hh"
 #include "cpu/minor/fetch2.hh"
+#include "cpu/thread_context.hh"
 #include "debug/Drain.hh"
 #include "debug/MinorCPU.hh"
 #include "debug/MinorTrace.hh"
@@ -58,6 +59,9 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
+    allow_skipping(params.numThreads == 1 &&
+        params.threadPolicy != enums::Random),
+    skipping(false),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -124,6 +128,9 @@ Pipeline::minorTrace() const
 void
 Pipeline::evaluate()
 {
+    if (skipping)
+        endSkip();
+
     /** We tick the CPU to update the BaseCPU cycle counters */
     cpu.tick();
 
@@ -154,6 +161,12 @@ Pipeline::evaluate()
         if (!activityRecorder.active() && !needToSignalDrained) {
             DPRINTF(Quiesce, "Suspending as the processor is idle\n");
             stop();
+        } else if (allow_skipping && !needToSignalDrained) {
+            /* Must be decided before the stages are deactivated */
+            Cycles skip = quiescentCycles();
+
+            if (skip != 0)
+                skipCycles(skip);
         }
 
         /* Deactivate all stages.  Note that the stages *could*
@@ -179,6 +192,84 @@ Pipeline::evaluate()
     }
 }
 
+Cycles
+Pipeline::quiescentCycles()
+{
+    /* Only Execute may have work to do... */
+    if (activityRecorder.getStageActive(CPUStageId) ||
+        activityRecorder.getStageActive(Fetch1StageId) ||
+        activityRecorder.getStageActive(Fetch2StageId) ||
+        activityRecorder.getStageActive(DecodeStageId))
+    {
+        return Cycles(0);
+    }
+
+    /* ...nothing may be on its way between the stages... */
+    if (!f1ToF2.empty() || !f2ToF1.empty() || !f2ToD.empty() ||
+        !dToE.empty() || !eToF1.empty())
+    {
+        return Cycles(0);
+    }
+
+    /* ...and Fetch1 must be waiting on the memory system */
+    if (cpu.getContext(0)->status() != ThreadContext::Active ||
+        !fetch1.isQuiescent())
+    {
+        return Cycles(0);
+    }
+
+    return execute.getQuiescentCycles();
+}
+
+void
+Pipeline::skipCycles(Cycles n)
+{
+    DPRINTF(Quiesce, "Skipping %d cycles as only Execute's FUs are"
+        " advancing\n", n);
+
+    /* Like idling, but with the tick event left scheduled for the cycle
+     *  after the skipped ones */
+    stop();
+    skipping = true;
+    object.schedule(event, object.clockEdge(Cycles(n + 1)));
+}
+
+void
+Pipeline::endSkip()
+{
+    /* This evaluate's cycle has already been counted */
+    Cycles skipped = cyclesSinceLastStopped() - Cycles(1);
+
+    DPRINTF(Quiesce, "Catching up with %d skipped cycles\n", skipped);
+
+    numCycles += skipped;
+    execute.skipCycles(skipped);
+
+    /* The inter-stage latches were all empty so only the activity
+     *  recorder's record of past activity needs to age */
+    for (Cycles i(0); i < skipped; ++i)
+        activityRecorder.evaluate();
+
+    skipping = false;
+    running = true;
+}
+
+void
+Pipeline::wakeup()
+{
+    if (!skipping) {
+        start();
+        return;
+    }
+
+    /* Evaluate on the first clock edge not already evaluated */
+    Tick when = object.clockEdge(
+        object.curCycle() > lastStopped ? Cycles(0) : Cycles(1));
+
+    if (when < event.when())
+        object.reschedule(event, when);
+}
+
 MinorCPU::MinorCPUPort &
 Pipeline::getInstPort()
 {
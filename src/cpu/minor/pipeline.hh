@@ -77,6 +77,16 @@ class Pipeline : public Ticked
     /** Allow cycles to be skipped when the pipeline is idle */
     bool allow_idling;
 
+    /** Allow the cycles in which only Execute's FU pipelines would
+     *  advance to be skipped.  Only possible where skipping thread
+     *  selection doesn't change which thread is picked next */
+    bool allow_skipping;
+
+    /** True from skipCycles until the evaluate which catches up with the
+     *  skipped cycles.  The tick event is scheduled for that evaluate and
+     *  running is false while skipping */
+    bool skipping;
+
     Latch<ForwardLineData> f1ToF2;
     Latch<BranchData> f2ToF1;
     Latch<ForwardInstData> f2ToD;
@@ -107,6 +117,18 @@ class Pipeline : public Ticked
     /** True after drain is called but draining isn't complete */
     bool needToSignalDrained;
 
+  protected:
+    /** How many of the following cycles have nothing to do but advance
+     *  Execute's FU pipelines?  0 if the next cycle must be evaluated */
+    Cycles quiescentCycles();
+
+    /** Stop ticking for the next n cycles */
+    void skipCycles(Cycles n);
+
+    /** Bring the pipeline up to date with the cycles skipped since
+     *  skipCycles */
+    void endSkip();
+
   public:
     Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params);
 
@@ -115,6 +137,10 @@ class Pipeline : public Ticked
      *  after quiesce wakeup */
     void wakeupFetch(ThreadID tid);
 
+    /** Make sure the pipeline is evaluated next cycle.  This must be used
+     *  in preference to start as the pipeline may be skipping cycles */
+    void wakeup();
+
     /** Try to drain the CPU */
     bool drain();
 
@@ -275,6 +275,29 @@ Scoreboard::canInstIssue(MinorDynInstPtr inst,
     return ret;
 }
 
+bool
+Scoreboard::waitsOnUnpredictableResult(MinorDynInstPtr inst,
+    ThreadContext *thread_context)
+{
+    if (inst->isFault())
+        return false;
+
+    StaticInstPtr staticInst = inst->staticInst;
+    unsigned int num_srcs = staticInst->numSrcRegs();
+
+    auto *isa = thread_context->getIsaPtr();
+
+    for (unsigned int src_index = 0; src_index < num_srcs; src_index++) {
+        RegId reg = staticInst->srcRegIdx(src_index).flatten(*isa);
+        Index index;
+
+        if (findIndex(reg, index) && numUnpredictableResults[index] != 0)
+            return true;
+    }
+
+    return false;
+}
+
 void
 Scoreboard::minorTrace() const
 {
@@ -158,6 +158,12 @@ class Scoreboard : public Named
         const std::vector<bool> *cant_forward_from_fu_indices,
         Cycles now, ThreadContext *thread_context);
 
+    /** Is any of this instruction's source registers due to be written by
+     *  an in-flight inst. with an unpredictable retire time (e.g. a load)?
+     *  Such an inst. can't become issuable until that inst. completes */
+    bool waitsOnUnpredictableResult(MinorDynInstPtr inst,
+        ThreadContext *thread_context);
+
     /** MinorTraceIF interface */
     void minorTrace() const;
 };
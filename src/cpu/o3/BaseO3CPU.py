@@ -77,6 +77,11 @@ class BaseO3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    skipQuiescentCycles = Param.Bool(
+        False,
+        "Stop ticking while every stage is stalled waiting on an event, "
+        "e.g. a cache miss, and account for the skipped cycles in bulk",
+    )
 
     cacheStorePorts = Param.Unsigned(
         200, "Cache Ports. Constrains stores only."
@@ -89,6 +94,14 @@ class BaseO3CPU(BaseCPU):
     commitToFetchDelay = Param.Cycles(1, "Commit to fetch delay")
     fetchWidth = Param.Unsigned(8, "Fetch width")
     fetchBufferSize = Param.Unsigned(64, "Fetch buffer size in bytes")
+    backdoorFetch = Param.Bool(
+        False,
+        "Read instruction bytes straight from host memory and only model "
+        "the fetch latency, except for pages written by CPUs",
+    )
+    backdoorFetchLatency = Param.Cycles(
+        1, "Latency of instruction fetches served from host memory"
+    )
     fetchQueueSize = Param.Unsigned(
         32, "Fetch queue size in micro-ops per-thread"
     )
@@ -577,6 +577,36 @@ Commit::squashAfter(ThreadID tid, const DynInstPtr &head_inst)
     squashAfterInst[tid] = head_inst;
 }
 
+bool
+Commit::isQuiescent() const
+{
+    if (interrupt != NoFault || ppCommitStall->hasListeners())
+        return false;
+
+    if (FullSystem && cpu->checkInterrupts(0))
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if ((commitStatus[tid] != Running && commitStatus[tid] != Idle) ||
+            trapSquash[tid] || tcSquash[tid] || trapInFlight[tid])
+            return false;
+
+        // Waiting on the head of the ROB to complete.
+        if (rob->isEmpty(tid) || rob->readHeadInst(tid)->readyToCommit())
+            return false;
+    }
+
+    return true;
+}
+
+void
+Commit::skipCycles(Cycles cycles)
+{
+    // Each cycle commit checks whether the head is ready, then gives up.
+    rob->skipHeadReads(cycles);
+    stats.numCommittedDist.sample(0, cycles);
+}
+
 void
 Commit::tick()
 {
@@ -1402,7 +1432,7 @@ Commit::updateComInstStats(const DynInstPtr &inst)
 ThreadID
 Commit::getCommittingThread()
 {
-    if (numThreads > 1) {
+    if (MaxThreads > 1 && numThreads > 1) {
         switch (commitPolicy) {
           case CommitPolicy::RoundRobin:
             return roundRobin();
@@ -205,6 +205,16 @@ class Commit
     /** Ticks the commit stage, which tries to commit instructions. */
     void tick();
 
+    /** Returns if commit can make no progress until the instruction at the
+     * head of the ROB completes.
+     */
+    bool isQuiescent() const;
+
+    /** Updates the stats for cycles the CPU skipped while quiescent, as if
+     * commit had been ticked in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
     /** Handles any squashes that are sent from IEW, and adds instructions
      * to the ROB and tries to commit instructions.
      */
@@ -42,6 +42,8 @@
 
 #include "cpu/o3/cpu.hh"
 
+#include <algorithm>
+
 #include "cpu/activity.hh"
 #include "cpu/checker/cpu.hh"
 #include "cpu/checker/thread_context.hh"
@@ -76,6 +78,7 @@ CPU::CPU(const BaseO3CPUParams &params)
                 false, Event::CPU_Tick_Pri),
       threadExitEvent([this]{ exitThreads(); }, "O3CPU exit threads",
                 false, Event::CPU_Exit_Pri),
+      instPool(new DynInstPool(params.numROBEntries)),
 #ifndef NDEBUG
       instcount(0),
 #endif
@@ -114,6 +117,8 @@ CPU::CPU(const BaseO3CPUParams &params)
       globalSeqNum(1),
       system(params.system),
       lastRunningCycle(curCycle()),
+      canSkipQuiescentCycles(params.skipQuiescentCycles),
+      quiescent(false),
       cpuStats(this)
 {
     fatal_if(FullSystem && params.numThreads > 1,
@@ -184,8 +189,8 @@ CPU::CPU(const BaseO3CPUParams &params)
         active_threads = params.workload.size();
 
         if (active_threads > MaxThreads) {
-            panic("Workload Size too large. Increase the 'MaxThreads' "
-                  "constant in cpu/o3/limits.hh or edit your workload size.");
+            panic("Workload Size too large. Rebuild with a larger "
+                  "O3_MAX_THREADS or edit your workload size.");
         }
     }
 
@@ -318,8 +323,16 @@ CPU::regProbePoints()
     commit.regProbePoints();
 }
 
+CPU::~CPU()
+{
+    // Instructions still referenced by the pipeline are freed after this,
+    // so the pool only goes away once the last of them has been returned.
+    instPool->release();
+}
+
 CPU::CPUStats::CPUStats(CPU *cpu)
     : statistics::Group(cpu),
+      cpu(cpu),
       ADD_STAT(timesIdled, statistics::units::Count::get(),
                "Number of times that the entire CPU went into an idle state "
                "and unscheduled itself"),
@@ -328,7 +341,15 @@ CPU::CPUStats::CPUStats(CPU *cpu)
                "to idling"),
       ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
                "Total number of cycles that CPU has spent quiesced or waiting "
-               "for an interrupt")
+               "for an interrupt"),
+      ADD_STAT(quiescentCycles, statistics::units::Cycle::get(),
+               "Number of cycles skipped while every stage was stalled "
+               "waiting on an event"),
+      ADD_STAT(peakLiveInsts, statistics::units::Count::get(),
+               "Largest number of dynamic instructions alive at once"),
+      ADD_STAT(instPoolHeapAllocs, statistics::units::Count::get(),
+               "Number of dynamic instruction buffers allocated from the "
+               "heap rather than reused")
 {
     // Register any of the O3CPU's stats here.
     timesIdled
@@ -339,6 +360,37 @@ CPU::CPUStats::CPUStats(CPU *cpu)
 
     quiesceCycles
         .prereq(quiesceCycles);
+
+    quiescentCycles
+        .prereq(quiescentCycles);
+
+    peakLiveInsts
+        .functor([cpu]() { return cpu->instPool->peakLiveBuffers(); });
+
+    instPoolHeapAllocs
+        .functor([cpu]() { return cpu->instPool->heapAllocations(); });
+}
+
+void
+CPU::CPUStats::resetStats()
+{
+    statistics::Group::resetStats();
+    cpu->instPool->resetStats();
+}
+
+void
+CPU::CPUStats::preDumpStats()
+{
+    statistics::Group::preDumpStats();
+
+    // Bring the stats up to date with the cycles skipped so far.
+    if (cpu->quiescent) {
+        Cycles cycles(cpu->curCycle() - cpu->lastRunningCycle);
+        if (cycles > 0) {
+            cpu->skipQuiescentCycles(cycles);
+            cpu->lastRunningCycle = cpu->curCycle();
+        }
+    }
 }
 
 void
@@ -348,6 +400,9 @@ CPU::tick()
     assert(!switchedOut());
     assert(drainState() != DrainState::Drained);
 
+    if (quiescent)
+        leaveQuiescence();
+
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -387,6 +442,10 @@ CPU::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             cpuStats.timesIdled++;
+        } else if (canSkipQuiescentCycles && isQuiescent()) {
+            DPRINTF(O3CPU, "Quiescent, waiting for an event!\n");
+            lastRunningCycle = curCycle();
+            quiescent = true;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -1294,9 +1353,75 @@ CPU::wakeDependents(const DynInstPtr &inst)
     iew.wakeDependents(inst);
 }
 */
+bool
+CPU::isQuiescent()
+{
+    // Only the single threaded case is handled, as the SMT fetch and commit
+    // policies consume state every cycle.
+    if (numThreads != 1 || activeThreads.empty() ||
+        drainState() != DrainState::Running ||
+        activityRec.communicating()) {
+        return false;
+    }
+
+    return commit.isQuiescent() && iew.isQuiescent() &&
+        rename.isQuiescent() && decode.isQuiescent() &&
+        fetch.isQuiescent();
+}
+
+void
+CPU::leaveQuiescence()
+{
+    DPRINTF(Activity, "Leaving quiescence\n");
+
+    quiescent = false;
+
+    // The cycle the CPU stopped in was ticked, and so will the current one.
+    Cycles cycles(curCycle() - lastRunningCycle);
+    if (cycles > 1)
+        skipQuiescentCycles(Cycles(cycles - 1));
+}
+
+void
+CPU::skipQuiescentCycles(Cycles cycles)
+{
+    baseStats.numCycles += cycles;
+    cpuStats.quiescentCycles += cycles;
+
+    fetch.skipCycles(cycles);
+    decode.skipCycles(cycles);
+    rename.skipCycles(cycles);
+    iew.skipCycles(cycles);
+    commit.skipCycles(cycles);
+
+    // Nothing was communicated between the stages while quiescent, so once
+    // the time buffers have been advanced through their whole length they
+    // are in the same state as if they had been advanced every cycle.
+    const uint64_t advances = std::min<uint64_t>(cycles,
+                                                 timeBuffer.getSize());
+    for (uint64_t i = 0; i < advances; i++) {
+        timeBuffer.advance();
+        fetchQueue.advance();
+        decodeQueue.advance();
+        renameQueue.advance();
+        iewQueue.advance();
+        activityRec.advance();
+    }
+}
+
 void
 CPU::wakeCPU()
 {
+    if (quiescent) {
+        leaveQuiescence();
+        if (!tickEvent.scheduled()) {
+            // Don't tick twice in the cycle the CPU became quiescent.
+            schedule(tickEvent, curCycle() == lastRunningCycle ?
+                    clockEdge(Cycles(1)) : clockEdge());
+        }
+        return;
+    }
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -1318,6 +1443,11 @@ CPU::wakeCPU()
 void
 CPU::wakeup(ThreadID tid)
 {
+    // Commit has to see a newly posted interrupt even if the pipeline is
+    // stalled.
+    if (quiescent)
+        wakeCPU();
+
     if (thread[tid]->status() != gem5::ThreadContext::Suspended)
         return;
 
@@ -1439,7 +1569,7 @@ CPU::htmSendAbortSignal(ThreadID tid, uint64_t htm_uid,
 
     // notify l1 d-cache (ruby) that core has aborted transaction
     RequestPtr req =
-        std::make_shared<Request>(addr, size, flags, _dataRequestorId);
+        Request::make(addr, size, flags, _dataRequestorId);
 
     req->taskId(taskId());
     req->setContext(thread[tid]->contextId());
@@ -54,6 +54,7 @@
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
 #include "cpu/o3/decode.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
@@ -170,6 +171,8 @@ class CPU : public BaseCPU
     /** Constructs a CPU with the given parameters. */
     CPU(const BaseO3CPUParams &params);
 
+    ~CPU();
+
     ProbePointArg<PacketPtr> *ppInstAccessComplete;
     ProbePointArg<std::pair<DynInstPtr, PacketPtr> > *ppDataAccessComplete;
 
@@ -187,6 +190,22 @@ class CPU : public BaseCPU
      */
     void tick();
 
+    /** Returns if no stage can make progress until it is woken up by an
+     *  event, e.g. a cache response, so the CPU can stop ticking even
+     *  though the stages are still active.
+     */
+    bool isQuiescent();
+
+    /** Starts ticking again after being quiescent, accounting for the
+     *  cycles that were skipped.
+     */
+    void leaveQuiescence();
+
+    /** Updates the stats and time buffers for cycles skipped while
+     *  quiescent, as if the CPU had been ticked in each of them.
+     */
+    void skipQuiescentCycles(Cycles cycles);
+
     /** Initialize the CPU */
     void init() override;
 
@@ -372,6 +391,9 @@ class CPU : public BaseCPU
     void dumpInsts();
 
   public:
+    /** Pool the DynInsts of this CPU are allocated from. */
+    DynInstPool *instPool;
+
 #ifndef NDEBUG
     /** Count of total number of dynamic instructions in flight. */
     int instcount;
@@ -535,6 +557,12 @@ class CPU : public BaseCPU
     /** The cycle that the CPU was last running, used for statistics. */
     Cycles lastRunningCycle;
 
+    /** Whether the CPU may stop ticking while it is quiescent. */
+    const bool canSkipQuiescentCycles;
+
+    /** Set while the CPU isn't ticking because it is quiescent. */
+    bool quiescent;
+
     /** The cycle that the CPU was last activated by a new thread*/
     Tick lastActivatedCycle;
 
@@ -574,6 +602,11 @@ class CPU : public BaseCPU
     {
         CPUStats(CPU *cpu);
 
+        void resetStats() override;
+        void preDumpStats() override;
+
+        CPU *cpu;
+
         /** Stat for total number of times the CPU is descheduled. */
         statistics::Scalar timesIdled;
         /** Stat for total number of cycles the CPU spends descheduled. */
@@ -581,6 +614,14 @@ class CPU : public BaseCPU
         /** Stat for total number of cycles the CPU spends descheduled due to a
          * quiesce operation or waiting for an interrupt. */
         statistics::Scalar quiesceCycles;
+        /** Stat for the number of cycles skipped while every stage was
+         * stalled waiting on an event. */
+        statistics::Scalar quiescentCycles;
+        /** Stat for the largest number of DynInsts alive at once. */
+        statistics::Value peakLiveInsts;
+        /** Stat for the number of DynInst buffers taken from the heap
+         * rather than reused from the CPU's pool. */
+        statistics::Value instPoolHeapAllocs;
     } cpuStats;
 
   public:
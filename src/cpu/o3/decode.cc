@@ -539,6 +539,36 @@ Decode::checkSignalsAndUpdate(ThreadID tid)
     return false;
 }
 
+bool
+Decode::isQuiescent() const
+{
+    for (ThreadID tid : *activeThreads) {
+        if (decodeStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if (decodeStatus[tid] == Running ||
+                   decodeStatus[tid] == Idle) {
+            if (!insts[tid].empty())
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+Decode::skipCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (decodeStatus[tid] == Blocked)
+            stats.blockedCycles += cycles;
+        else
+            stats.idleCycles += cycles;
+    }
+}
+
 void
 Decode::tick()
 {
@@ -136,6 +136,16 @@ class Decode
      */
     void tick();
 
+    /** Returns if decode can make no progress until it receives
+     * instructions or is unblocked by rename.
+     */
+    bool isQuiescent() const;
+
+    /** Updates the stats for cycles the CPU skipped while quiescent, as if
+     * decode had been ticked in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
     /** Determines what to do based on decode's current status.
      * @param status_change decode() sets this variable if there was a status
      * change (ie switching from from blocking to unblocking).
@@ -41,6 +41,9 @@
 #ifndef __CPU_O3_DEP_GRAPH_HH__
 #define __CPU_O3_DEP_GRAPH_HH__
 
+#include <memory>
+#include <vector>
+
 #include "cpu/o3/comm.hh"
 
 namespace gem5
@@ -81,7 +84,8 @@ class DependencyGraph
 
     /** Default construction.  Must call resize() prior to use. */
     DependencyGraph()
-        : numEntries(0), memAllocCounter(0), nodesTraversed(0), nodesRemoved(0)
+        : numEntries(0), freeList(NULL), memAllocCounter(0),
+          nodesTraversed(0), nodesRemoved(0)
     { }
 
     ~DependencyGraph();
@@ -131,6 +135,21 @@ class DependencyGraph
     /** Number of linked lists; identical to the number of registers. */
     int numEntries;
 
+    /** Number of list nodes allocated at a time. */
+    static constexpr int ChunkSize = 256;
+
+    /** Storage of the list nodes, which is never given back. */
+    std::vector<std::unique_ptr<DepEntry[]>> chunks;
+
+    /** Nodes that aren't on any list, linked through their next field. */
+    DepEntry *freeList;
+
+    /** Takes a node from the free list, growing the storage if needed. */
+    DepEntry *allocEntry();
+
+    /** Returns a node to the free list. */
+    void freeEntry(DepEntry *entry);
+
     // Debug variable, remove when done testing.
     unsigned memAllocCounter;
 
@@ -154,6 +173,35 @@ DependencyGraph<DynInstPtr>::resize(int num_entries)
     dependGraph.resize(numEntries);
 }
 
+template <class DynInstPtr>
+typename DependencyGraph<DynInstPtr>::DepEntry *
+DependencyGraph<DynInstPtr>::allocEntry()
+{
+    if (!freeList) {
+        chunks.emplace_back(new DepEntry[ChunkSize]);
+        DepEntry *chunk = chunks.back().get();
+        for (int i = 0; i < ChunkSize; ++i) {
+            chunk[i].next = freeList;
+            freeList = &chunk[i];
+        }
+    }
+
+    DepEntry *entry = freeList;
+    freeList = entry->next;
+    ++memAllocCounter;
+    return entry;
+}
+
+template <class DynInstPtr>
+void
+DependencyGraph<DynInstPtr>::freeEntry(DepEntry *entry)
+{
+    entry->inst = NULL;
+    entry->next = freeList;
+    freeList = entry;
+    --memAllocCounter;
+}
+
 template <class DynInstPtr>
 void
 DependencyGraph<DynInstPtr>::reset()
@@ -166,13 +214,9 @@ DependencyGraph<DynInstPtr>::reset()
         curr = dependGraph[i].next;
 
         while (curr) {
-            memAllocCounter--;
-
             prev = curr;
             curr = prev->next;
-            prev->inst = NULL;
-
-            delete prev;
+            freeEntry(prev);
         }
 
         if (dependGraph[i].inst) {
@@ -192,14 +236,12 @@ DependencyGraph<DynInstPtr>::insert(RegIndex idx, const DynInstPtr &new_inst)
 
     // First create the entry that will be added to the head of the
     // dependency chain.
-    DepEntry *new_entry = new DepEntry;
+    DepEntry *new_entry = allocEntry();
     new_entry->next = dependGraph[idx].next;
     new_entry->inst = new_inst;
 
     // Then actually add it to the chain.
     dependGraph[idx].next = new_entry;
-
-    ++memAllocCounter;
 }
 
 
@@ -233,12 +275,7 @@ DependencyGraph<DynInstPtr>::remove(RegIndex idx,
     // Now remove this instruction from the list.
     prev->next = curr->next;
 
-    --memAllocCounter;
-
-    // Could push this off to the destructor of DependencyEntry
-    curr->inst = NULL;
-
-    delete curr;
+    freeEntry(curr);
 }
 
 template <class DynInstPtr>
@@ -251,9 +288,7 @@ DependencyGraph<DynInstPtr>::pop(RegIndex idx)
     if (node) {
         inst = node->inst;
         dependGraph[idx].next = node->next;
-        node->inst = NULL;
-        memAllocCounter--;
-        delete node;
+        freeEntry(node);
     }
     return inst;
 }
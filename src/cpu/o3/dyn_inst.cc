@@ -135,6 +135,12 @@ DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &_staticInst,
  */
 void *
 DynInst::operator new(size_t count, Arrays &arrays)
+{
+    return operator new(count, arrays, nullptr);
+}
+
+void *
+DynInst::operator new(size_t count, Arrays &arrays, DynInstPool *pool)
 {
     // Convenience variables for brevity.
     const auto num_dests = arrays.numDests;
@@ -167,8 +173,10 @@ DynInst::operator new(size_t count, Arrays &arrays)
     // Figure out how much space we need in total.
     size_t total_size = ready_src_idx + ready_src_idx_size;
 
-    // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    // Actually allocate it. Buffers from a pool are recycled when the
+    // instruction is freed rather than going back to the heap.
+    uint8_t *buf = (uint8_t *)(pool ? pool->allocate(total_size) :
+            DynInstPool::allocateUnpooled(total_size));
 
     // Fill in "arrays" with pointers to all the arrays.
     arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
@@ -189,11 +197,11 @@ DynInst::operator new(size_t count, Arrays &arrays)
 
 // Because of the custom "new" operator that allocates more bytes than the
 // size of the DynInst object, AddressSanitizer throw new-delete-type-mismatch.
-// Adding a custom delete function is enough to shut down this false positive
+// The custom delete function also hands pooled buffers back to their pool.
 void
 DynInst::operator delete(void *ptr)
 {
-    ::operator delete(ptr);
+    DynInstPool::deallocate(ptr);
 }
 
 DynInst::~DynInst()
@@ -56,6 +56,7 @@
 #include "cpu/inst_res.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/cpu.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq_unit.hh"
 #include "cpu/op_class.hh"
@@ -95,6 +96,9 @@ class DynInst : public ExecContext, public RefCounted
     };
 
     static void *operator new(size_t count, Arrays &arrays);
+    /** Allocates the DynInst and its arrays from a CPU's pool. */
+    static void *operator new(size_t count, Arrays &arrays,
+                              DynInstPool *pool);
     static void  operator delete(void* ptr);
 
     /** BaseDynInst constructor given a binary instruction. */
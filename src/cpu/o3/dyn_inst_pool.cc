@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dyn_inst_pool.hh"
+
+#include <new>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+DynInstPool::DynInstPool(size_t num_entries)
+{
+    for (auto &free_list : freeLists)
+        free_list.reserve(num_entries);
+}
+
+DynInstPool::~DynInstPool()
+{
+    for (auto &free_list : freeLists) {
+        for (void *buf : free_list)
+            ::operator delete(buf);
+    }
+}
+
+void *
+DynInstPool::allocate(size_t size)
+{
+    const size_t total = roundUp(sizeof(Header) + size, Granularity);
+    size_t size_class = total / Granularity - 1;
+
+    void *buf;
+    if (size_class >= NumClasses) {
+        // Too big to be worth keeping around, go straight to the heap.
+        buf = ::operator new(sizeof(Header) + size);
+        size_class = Unpooled;
+        heapAllocs++;
+    } else if (freeLists[size_class].empty()) {
+        buf = ::operator new(total);
+        heapAllocs++;
+    } else {
+        buf = freeLists[size_class].back();
+        freeLists[size_class].pop_back();
+    }
+
+    if (++live > peak)
+        peak = live;
+
+    Header *header = static_cast<Header *>(buf);
+    header->pool = this;
+    header->sizeClass = size_class;
+    return header + 1;
+}
+
+void *
+DynInstPool::allocateUnpooled(size_t size)
+{
+    Header *header =
+        static_cast<Header *>(::operator new(sizeof(Header) + size));
+    header->pool = nullptr;
+    header->sizeClass = Unpooled;
+    return header + 1;
+}
+
+void
+DynInstPool::deallocate(void *ptr)
+{
+    Header *header = static_cast<Header *>(ptr) - 1;
+    if (header->pool)
+        header->pool->recycle(header);
+    else
+        ::operator delete(header);
+}
+
+void
+DynInstPool::recycle(Header *header)
+{
+    live--;
+    if (header->sizeClass == Unpooled) {
+        ::operator delete(header);
+    } else {
+        freeLists[header->sizeClass].push_back(header);
+    }
+
+    if (released && live == 0)
+        delete this;
+}
+
+void
+DynInstPool::release()
+{
+    released = true;
+    if (live == 0)
+        delete this;
+}
+
+} // namespace o3
+} // namespace gem5
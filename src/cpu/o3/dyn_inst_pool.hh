@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DYN_INST_POOL_HH__
+#define __CPU_O3_DYN_INST_POOL_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * A per-CPU pool of the buffers DynInsts and their operand arrays are
+ * built in. Freed buffers are kept on free lists bucketed by size, so once
+ * the pipeline has filled up, fetching and retiring instructions no longer
+ * goes to the heap. Buffers are returned to the pool they came from through
+ * a small header in front of each one, so instructions that outlive their
+ * CPU (the pool is released by it) are still freed correctly.
+ */
+class DynInstPool
+{
+  private:
+    /** Size of the buckets buffers are rounded up to. */
+    static constexpr size_t Granularity = 64;
+    /** Number of buckets; larger buffers are not pooled. */
+    static constexpr size_t NumClasses = 64;
+    /** Class of buffers which aren't pooled. */
+    static constexpr uint32_t Unpooled = ~0u;
+
+    struct alignas(alignof(std::max_align_t)) Header
+    {
+        DynInstPool *pool;
+        uint32_t sizeClass;
+    };
+
+    /** Free buffers (including their headers) of each size class. */
+    std::vector<void *> freeLists[NumClasses];
+
+    /** Number of buffers handed out and not yet returned. */
+    size_t live = 0;
+    /** Largest value of live since the stats were last reset. */
+    size_t peak = 0;
+    /** Number of buffers taken from the heap since the stats were last
+     *  reset. */
+    uint64_t heapAllocs = 0;
+    /** Set once the owner no longer needs the pool. */
+    bool released = false;
+
+    ~DynInstPool();
+
+    void recycle(Header *header);
+
+  public:
+    /**
+     * @param num_entries The number of instructions expected to be in
+     *        flight at once, used to size the free lists.
+     */
+    DynInstPool(size_t num_entries);
+
+    /** Returns a buffer of at least size bytes. */
+    void *allocate(size_t size);
+
+    /** Allocates a buffer from the heap which doesn't belong to a pool. */
+    static void *allocateUnpooled(size_t size);
+
+    /** Returns a buffer from allocate() or allocateUnpooled(). */
+    static void deallocate(void *ptr);
+
+    /**
+     * Gives up ownership of the pool. It is destroyed once every buffer
+     * it handed out has been returned.
+     */
+    void release();
+
+    size_t liveBuffers() const { return live; }
+    size_t peakLiveBuffers() const { return peak; }
+    uint64_t heapAllocations() const { return heapAllocs; }
+
+    /** Restarts the peak and heap allocation counts. */
+    void
+    resetStats()
+    {
+        peak = live;
+        heapAllocs = 0;
+    }
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_DYN_INST_POOL_HH__
@@ -95,6 +95,7 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
       cacheBlkSize(cpu->cacheLineSize()),
       fetchBufferSize(params.fetchBufferSize),
       fetchBufferMask(fetchBufferSize - 1),
+      backdoorFetchLatency(params.backdoorFetchLatency),
       fetchQueueSize(params.fetchQueueSize),
       numThreads(params.numThreads),
       numFetchingThreads(params.smtNumFetchingThreads),
@@ -103,7 +104,7 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
 {
     if (numThreads > MaxThreads)
         fatal("numThreads (%d) is larger than compiled limit (%d),\n"
-              "\tincrease MaxThreads in src/cpu/o3/limits.hh\n",
+              "\trebuild with a larger O3_MAX_THREADS\n",
               numThreads, static_cast<int>(MaxThreads));
     if (fetchWidth > MaxWidth)
         fatal("fetchWidth (%d) is larger than compiled limit (%d),\n"
@@ -116,6 +117,9 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
         fatal("cache block (%u bytes) is not a multiple of the "
               "fetch buffer (%u bytes)\n", cacheBlkSize, fetchBufferSize);
 
+    if (params.backdoorFetch)
+        fetchBackdoor = std::make_unique<FetchBackdoor>(*params.system);
+
     for (int i = 0; i < MaxThreads; i++) {
         fetchStatus[i] = Idle;
         decoder[i] = nullptr;
@@ -419,7 +423,7 @@ Fetch::isDrained() const
      * cycle if the finish translation event is scheduled, so make
      * sure that's not the case.
      */
-    return !finishTranslationEvent.scheduled();
+    return !finishTranslationEvent.scheduled() && !backdoorFetchesInFlight;
 }
 
 void
@@ -558,7 +562,7 @@ Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
-    RequestPtr mem_req = std::make_shared<Request>(
+    RequestPtr mem_req = Request::make(
         fetchBufferBlockPC, fetchBufferSize,
         Request::INST_FETCH, cpu->instRequestorId(), pc,
         cpu->thread[tid]->contextId());
@@ -618,8 +622,21 @@ Fetch::finishTranslation(const Fault &fault, const RequestPtr &mem_req)
 
         fetchStats.cacheLines++;
 
-        // Access the cache.
-        if (!icachePort.sendTimingReq(data_pkt)) {
+        // Access the cache, unless the fetch can be served from host
+        // memory, in which case we only model its latency.
+        if (fetchBackdoor && fetchBackdoor->read(mem_req->getPaddr(),
+                    data_pkt->getPtr<uint8_t>(), mem_req->getSize())) {
+            DPRINTF(Fetch, "[tid:%i] Reading from host memory.\n", tid);
+            data_pkt->makeResponse();
+            lastIcacheStall[tid] = curTick();
+            fetchStatus[tid] = IcacheWaitResponse;
+            ++backdoorFetchesInFlight;
+            cpu->schedule(new EventFunctionWrapper([this, data_pkt]{
+                        --backdoorFetchesInFlight;
+                        processCacheCompletion(data_pkt);
+                    }, "Fetch backdoor completion", true),
+                cpu->clockEdge(backdoorFetchLatency));
+        } else if (!icachePort.sendTimingReq(data_pkt)) {
             assert(retryPkt == NULL);
             assert(retryTid == InvalidThreadID);
             DPRINTF(Fetch, "[tid:%i] Out of MSHRs!\n", tid);
@@ -811,6 +828,60 @@ Fetch::squash(const PCStateBase &new_pc, const InstSeqNum seq_num,
     cpu->removeInstsNotInROB(tid);
 }
 
+bool
+Fetch::isQuiescent() const
+{
+    if (interruptPending)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (stalls[tid].drain || issuePipelinedIfetch[tid])
+            return false;
+
+        if (fetchStatus[tid] == Running) {
+            // Fetch keeps running, but with nowhere to put instructions and
+            // everything it needs already in the fetch buffer it does
+            // nothing.
+            if (!stalls[tid].decode ||
+                fetchQueue[tid].size() < fetchQueueSize)
+                return false;
+
+            Addr fetch_addr = (pc[tid]->instAddr() + fetchOffset[tid]) &
+                decoder[tid]->pcMask();
+            if (!(fetchBufferValid[tid] &&
+                  fetchBufferAlignPC(fetch_addr) == fetchBufferPC[tid]) &&
+                !isRomMicroPC(pc[tid]->microPC()) && !macroop[tid])
+                return false;
+        } else if (fetchStatus[tid] == IcacheWaitResponse ||
+                   fetchStatus[tid] == ItlbWait) {
+            if (!stalls[tid].decode && !fetchQueue[tid].empty())
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+Fetch::skipCycles(Cycles cycles)
+{
+    fetchStats.nisnDist.sample(0, cycles);
+
+    for (ThreadID tid : *activeThreads) {
+        if (fetchStatus[tid] == Running) {
+            fetchStats.cycles += cycles;
+        } else if (numThreads == 1) {
+            // Mirrors profileStall().
+            if (fetchStatus[tid] == IcacheWaitResponse)
+                cpu->fetchStats[tid]->icacheStallCycles += cycles;
+            else if (fetchStatus[tid] == ItlbWait)
+                fetchStats.tlbCycles += cycles;
+        }
+    }
+}
+
 void
 Fetch::tick()
 {
@@ -1028,7 +1099,7 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
     arrays.numDests = staticInst->numDestRegs();
 
     // Create a new DynInst from the instruction fetched.
-    DynInstPtr instruction = new (arrays) DynInst(
+    DynInstPtr instruction = new (arrays, cpu->instPool) DynInst(
             arrays, staticInst, curMacroop, this_pc, next_pc, seq, cpu);
     instruction->setTid(tid);
 
@@ -1242,7 +1313,7 @@ Fetch::fetch(bool &status_change)
                     staticInst = dec_ptr->fetchRomMicroop(
                             this_pc.microPC(), curMacroop);
                 } else {
-                    staticInst = curMacroop->fetchMicroop(this_pc.microPC());
+                    staticInst = curMacroop->microop(this_pc.microPC());
                 }
                 newMacro |= staticInst->isLastMicroop();
             }
@@ -1362,7 +1433,7 @@ Fetch::recvReqRetry()
 ThreadID
 Fetch::getFetchingThread()
 {
-    if (numThreads > 1) {
+    if (MaxThreads > 1 && numThreads > 1) {
         switch (fetchPolicy) {
           case SMTFetchPolicy::RoundRobin:
             return roundRobin();
@@ -41,9 +41,12 @@
 #ifndef __CPU_O3_FETCH_HH__
 #define __CPU_O3_FETCH_HH__
 
+#include <memory>
+
 #include "arch/generic/decoder.hh"
 #include "arch/generic/mmu.hh"
 #include "base/statistics.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
@@ -336,6 +339,16 @@ class Fetch
      */
     void tick();
 
+    /** Returns if fetch can make no progress until it is woken up by an
+     * I-cache or ITLB response, or unblocked by decode.
+     */
+    bool isQuiescent() const;
+
+    /** Updates the stats for cycles the CPU skipped while quiescent, as if
+     * fetch had been ticked in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
     /** Checks all input signals and updates the status as necessary.
      *  @return: Returns if the status has changed due to input signals.
      */
@@ -349,7 +362,7 @@ class Fetch
     void fetch(bool &status_change);
 
     /** Align a PC to the start of a fetch buffer block. */
-    Addr fetchBufferAlignPC(Addr addr)
+    Addr fetchBufferAlignPC(Addr addr) const
     {
         return (addr & ~(fetchBufferMask));
     }
@@ -480,6 +493,15 @@ class Fetch
     /** Mask to align a fetch address to a fetch buffer boundary. */
     Addr fetchBufferMask;
 
+    /** Host memory to serve fetches from, if enabled. */
+    std::unique_ptr<FetchBackdoor> fetchBackdoor;
+
+    /** Latency of fetches served from host memory. */
+    const Cycles backdoorFetchLatency;
+
+    /** Number of fetches served from host memory not completed yet. */
+    unsigned backdoorFetchesInFlight = 0;
+
     /** The fetch data that is being fetched and buffered. */
     uint8_t *fetchBuffer[MaxThreads];
 
@@ -45,6 +45,7 @@
 
 #include "cpu/o3/iew.hh"
 
+#include <algorithm>
 #include <queue>
 
 #include "cpu/checker/cpu.hh"
@@ -1389,6 +1390,46 @@ IEW::writebackInsts()
     }
 }
 
+bool
+IEW::isQuiescent()
+{
+    if (exeStatus != Idle || updateLSQNextCycle ||
+        !instQueue.isQuiescent() || ldstQueue.hasStoresToWB())
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if (dispatchStatus[tid] == Running ||
+                   dispatchStatus[tid] == Idle) {
+            if (!insts[tid].empty() || checkStall(tid))
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+IEW::skipCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked)
+            iewStats.blockCycles += cycles;
+    }
+
+    instQueue.skipCycles(cycles);
+
+    // Nothing has been issued, so the queue only has to be cleared out.
+    const uint64_t advances = std::min<uint64_t>(cycles,
+                                                 issueToExecQueue.getSize());
+    for (uint64_t i = 0; i < advances; i++)
+        issueToExecQueue.advance();
+}
+
 void
 IEW::tick()
 {
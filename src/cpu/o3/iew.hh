@@ -292,6 +292,16 @@ class IEW
      */
     void tick();
 
+    /** Returns if IEW can make no progress until an outstanding memory
+     * access or functional unit completes, or more instructions arrive.
+     */
+    bool isQuiescent();
+
+    /** Updates the stats and the issue to execute queue for cycles the CPU
+     * skipped while quiescent, as if IEW had been ticked in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
   private:
     /** Updates execution stats based on the instruction. */
     void updateExeInstStats(const DynInstPtr &inst);
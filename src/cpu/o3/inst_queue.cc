@@ -89,6 +89,9 @@ InstructionQueue::InstructionQueue(CPU *cpu_ptr, IEW *iew_ptr,
     : cpu(cpu_ptr),
       iewStage(iew_ptr),
       fuPool(params.fuPool),
+      instList(MaxThreads, CircularQueue<DynInstPtr>(params.numROBEntries +
+                  params.commitWidth * (params.commitToIEWDelay + 1))),
+      instsToExecute(params.numROBEntries),
       iqPolicy(params.smtIQPolicy),
       numThreads(params.numThreads),
       numEntries(params.numIQEntries),
@@ -396,7 +399,9 @@ InstructionQueue::resetState()
     //Initialize thread IQ counts
     for (ThreadID tid = 0; tid < MaxThreads; tid++) {
         count[tid] = 0;
-        instList[tid].clear();
+        for (auto &inst : instList[tid])
+            inst = nullptr;
+        instList[tid].flush();
     }
 
     // Initialize the number of free IQ entries.
@@ -577,6 +582,7 @@ InstructionQueue::insert(const DynInstPtr &new_inst)
 
     assert(freeEntries != 0);
 
+    assert(!instList[new_inst->threadNumber].full());
     instList[new_inst->threadNumber].push_back(new_inst);
 
     --freeEntries;
@@ -627,6 +633,7 @@ InstructionQueue::insertNonSpec(const DynInstPtr &new_inst)
 
     assert(freeEntries != 0);
 
+    assert(!instList[new_inst->threadNumber].full());
     instList[new_inst->threadNumber].push_back(new_inst);
 
     --freeEntries;
@@ -742,12 +749,27 @@ InstructionQueue::processFUCompletion(const DynInstPtr &inst, int fu_idx)
     // of a cycle, otherwise they could add too many instructions to
     // the queue.
     issueToExecuteQueue->access(-1)->size++;
+    assert(!instsToExecute.full());
     instsToExecute.push_back(inst);
 }
 
 // @todo: Figure out a better way to remove the squashed items from the
 // lists.  Checking the top item of each list to see if it's squashed
 // wastes time and forces jumps.
+bool
+InstructionQueue::isQuiescent() const
+{
+    return listOrder.empty() && instsToExecute.empty() &&
+        deferredMemInsts.empty() && blockedMemInsts.empty() &&
+        retryMemInsts.empty();
+}
+
+void
+InstructionQueue::skipCycles(Cycles cycles)
+{
+    iqStats.numIssuedDist.sample(0, cycles);
+}
+
 void
 InstructionQueue::scheduleReadyInsts()
 {
@@ -835,6 +857,7 @@ InstructionQueue::scheduleReadyInsts()
         if (idx != FUPool::NoFreeFU) {
             if (op_latency == Cycles(1)) {
                 i2e_info->size++;
+                assert(!instsToExecute.full());
                 instsToExecute.push_back(issuing_inst);
 
                 // Add the FU onto the list of FU's to be freed next
@@ -955,7 +978,7 @@ InstructionQueue::commit(const InstSeqNum &inst, ThreadID tid)
 
     while (iq_it != instList[tid].end() &&
            (*iq_it)->seqNum <= inst) {
-        ++iq_it;
+        (iq_it++)->reset();
         instList[tid].pop_front();
     }
 
@@ -1134,7 +1157,7 @@ InstructionQueue::cacheUnblocked()
 DynInstPtr
 InstructionQueue::getDeferredMemInstToExecute()
 {
-    for (ListIt it = deferredMemInsts.begin(); it != deferredMemInsts.end();
+    for (auto it = deferredMemInsts.begin(); it != deferredMemInsts.end();
          ++it) {
         if ((*it)->translationCompleted() || (*it)->isSquashed()) {
             DynInstPtr mem_inst = std::move(*it);
@@ -1184,19 +1207,16 @@ InstructionQueue::squash(ThreadID tid)
 void
 InstructionQueue::doSquash(ThreadID tid)
 {
-    // Start at the tail.
-    ListIt squash_it = instList[tid].end();
-    --squash_it;
-
     DPRINTF(IQ, "[tid:%i] Squashing until sequence number %i!\n",
             tid, squashedSeqNum[tid]);
 
     // Squash any instructions younger than the squashed sequence number
-    // given.
-    while (squash_it != instList[tid].end() &&
-           (*squash_it)->seqNum > squashedSeqNum[tid]) {
+    // given, starting at the tail.
+    while (!instList[tid].empty() &&
+           instList[tid].back()->seqNum > squashedSeqNum[tid]) {
 
-        DynInstPtr squashed_inst = (*squash_it);
+        DynInstPtr squashed_inst = std::move(instList[tid].back());
+        instList[tid].pop_back();
         if (squashed_inst->isFloating()) {
             iqIOStats.fpInstQueueWrites++;
         } else if (squashed_inst->isVector()) {
@@ -1209,7 +1229,6 @@ InstructionQueue::doSquash(ThreadID tid)
         // hasn't already been squashed in the IQ.
         if (squashed_inst->threadNumber != tid ||
             squashed_inst->isSquashedInIQ()) {
-            --squash_it;
             continue;
         }
 
@@ -1318,7 +1337,6 @@ InstructionQueue::doSquash(ThreadID tid)
             assert(dependGraph.empty(dest_reg->flatIndex()));
             dependGraph.clearInst(dest_reg->flatIndex());
         }
-        instList[tid].erase(squash_it--);
         ++iqStats.squashedInstsExamined;
     }
 }
@@ -47,6 +47,7 @@
 #include <queue>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -99,7 +100,7 @@ class InstructionQueue
 {
   public:
     // Typedef of iterator through the list of instructions.
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
+    typedef typename CircularQueue<DynInstPtr>::iterator ListIt;
 
     /** FU completion event class. */
     class FUCompletion : public Event
@@ -226,6 +227,16 @@ class InstructionQueue
      */
     void scheduleReadyInsts();
 
+    /** Returns if there is nothing to issue or replay, so scheduling ready
+     * instructions would do nothing until an instruction is woken up.
+     */
+    bool isQuiescent() const;
+
+    /** Updates the stats for cycles the CPU skipped while quiescent, as if
+     * scheduleReadyInsts() had been called in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
     /** Schedules a single specific non-speculative instruction. */
     void scheduleNonSpec(const InstSeqNum &inst);
 
@@ -317,11 +328,15 @@ class InstructionQueue
     // Instruction lists, ready queues, and ordering
     //////////////////////////////////////
 
-    /** List of all the instructions in the IQ (some of which may be issued). */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** List of all the instructions in the IQ (some of which may be issued).
+     *  Instructions stay on it until commit tells the IQ they have retired,
+     *  so each thread's ring buffer holds a full ROB plus the instructions
+     *  retired while that message is in flight.
+     */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** List of instructions that are ready to be executed. */
-    std::list<DynInstPtr> instsToExecute;
+    CircularQueue<DynInstPtr> instsToExecute;
 
     /** List of instructions waiting for their DTB translation to
      *  complete (hw page table walk in progress).
@@ -28,6 +28,8 @@
 #ifndef __CPU_O3_LIMITS_HH__
 #define __CPU_O3_LIMITS_HH__
 
+#include "config/o3_max_threads.hh"
+
 namespace gem5
 {
 
@@ -35,7 +37,13 @@ namespace o3
 {
 
 static constexpr int MaxWidth = 12;
-static constexpr int MaxThreads = 4;
+
+/**
+ * Maximum number of threads per CPU, set with the O3_MAX_THREADS build
+ * option. Single threaded builds can use MaxThreads == 1 to have the
+ * compiler drop the SMT policies from the per-cycle paths.
+ */
+static constexpr int MaxThreads = O3_MAX_THREADS;
 
 } // namespace o3
 } // namespace gem5
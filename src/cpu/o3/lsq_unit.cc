@@ -44,6 +44,7 @@
 #include "arch/generic/debugfaults.hh"
 #include "base/str.hh"
 #include "cpu/checker/cpu.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/lsq.hh"
@@ -239,6 +240,7 @@ LSQUnit::resetState()
     stalled = false;
 
     cacheBlockMask = ~(cpu->cacheLineSize() - 1);
+    storeFilter.reset(cpu->cacheLineSize());
 }
 
 std::string
@@ -1025,6 +1027,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         // Must delete request now that it wasn't handed off to
         // memory.  This is quite ugly.  @todo: Figure out the proper
         // place to really handle request deletes.
+        unfilterStore(storeQueue.back());
         storeQueue.back().clear();
 
         storeQueue.pop_back();
@@ -1149,6 +1152,7 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx)
     DynInstPtr store_inst = store_idx->instruction();
     if (store_idx == storeQueue.begin()) {
         do {
+            unfilterStore(storeQueue.front());
             storeQueue.front().clear();
             storeQueue.pop_front();
         } while (storeQueue.front().completed() &&
@@ -1217,6 +1221,8 @@ LSQUnit::trySendPacket(bool isLoad, PacketPtr data_pkt)
         if (!isLoad) {
             isStoreBlocked = false;
         }
+        if (data_pkt->isWrite())
+            FetchBackdoor::written(data_pkt->getAddr(), data_pkt->getSize());
         lsq->cachePortBusy(isLoad);
         request->packetSent();
     } else {
@@ -1382,9 +1388,15 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
         return NoFault;
     }
 
-    // Check the SQ for any previous stores that might lead to forwarding
+    // Check the SQ for any previous stores that might lead to forwarding.
+    // The store filter tells if any store in the queue touches one of
+    // the lines of the load, if none does there is nothing to find.
     auto store_it = load_inst->sqIt;
     assert (store_it >= storeWBIt);
+    if (!storeFilter.mayOverlap(request->mainReq()->getVaddr(),
+                                request->mainReq()->getSize())) {
+        store_it = storeWBIt;
+    }
     // End once we've reached the top of the LSQ
     while (store_it != storeWBIt && !load_inst->isDataPrefetch()) {
         // Move the index to one younger
@@ -1611,6 +1623,15 @@ LSQUnit::write(LSQRequest *request, uint8_t *data, ssize_t store_idx)
     storeQueue[store_idx].setRequest(request);
     unsigned size = request->_size;
     storeQueue[store_idx].size() = size;
+
+    // Stores that are executed again replace their previous range.
+    unfilterStore(storeQueue[store_idx]);
+    if (size != 0) {
+        Addr addr = storeQueue[store_idx].instruction()->effAddr;
+        storeFilter.insert(addr, size);
+        storeQueue[store_idx].filterAddr() = addr;
+        storeQueue[store_idx].filterSize() = size;
+    }
     bool store_no_data =
         request->mainReq()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
@@ -43,6 +43,7 @@
 #define __CPU_O3_LSQ_UNIT_HH__
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <map>
 #include <memory>
@@ -51,6 +52,7 @@
 #include "arch/generic/debugfaults.hh"
 #include "arch/generic/vec_reg.hh"
 #include "base/circular_queue.hh"
+#include "base/intmath.hh"
 #include "cpu/base.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/comm.hh"
@@ -162,6 +164,9 @@ class LSQUnit
          * style instructs (ARM DC ZVA; ALPHA WH64)
          */
         bool _isAllZeros = false;
+        /** Address range recorded in the store filter, if any. */
+        Addr _filterAddr = 0;
+        unsigned _filterSize = 0;
 
       public:
         static constexpr size_t DataSize = sizeof(_data);
@@ -178,6 +183,8 @@ class LSQUnit
         {
             LSQEntry::clear();
             _canWB = _completed = _committed = _isAllZeros = false;
+            _filterAddr = 0;
+            _filterSize = 0;
         }
 
         /** Member accessors. */
@@ -190,12 +197,78 @@ class LSQUnit
         const bool& committed() const { return _committed; }
         bool& isAllZeros() { return _isAllZeros; }
         const bool& isAllZeros() const { return _isAllZeros; }
+        Addr& filterAddr() { return _filterAddr; }
+        unsigned& filterSize() { return _filterSize; }
         char* data() { return _data; }
         const char* data() const { return _data; }
         /** @} */
     };
     using LQEntry = LSQEntry;
 
+    /**
+     * Counting filter of the cache lines written by the stores in the
+     * store queue. A load whose lines all map to empty buckets cannot
+     * overlap any of these stores, so it doesn't need to search the
+     * store queue for a forwarding candidate.
+     */
+    class StoreFilter
+    {
+      private:
+        static constexpr size_t NumBuckets = 256;
+        std::array<uint16_t, NumBuckets> counts{};
+        unsigned lineShift = 6;
+
+        size_t
+        bucket(Addr line) const
+        {
+            return (line ^ (line >> 8)) & (NumBuckets - 1);
+        }
+
+        template <typename F>
+        void
+        forEachBucket(Addr addr, unsigned size, F f) const
+        {
+            const Addr last = (addr + size - 1) >> lineShift;
+            for (Addr line = addr >> lineShift; line <= last; ++line)
+                f(bucket(line));
+        }
+
+      public:
+        void
+        reset(unsigned line_size)
+        {
+            counts.fill(0);
+            lineShift = floorLog2(line_size);
+        }
+
+        void
+        insert(Addr addr, unsigned size)
+        {
+            forEachBucket(addr, size, [this](size_t b) { ++counts[b]; });
+        }
+
+        void
+        remove(Addr addr, unsigned size)
+        {
+            forEachBucket(addr, size, [this](size_t b) {
+                assert(counts[b] > 0);
+                --counts[b];
+            });
+        }
+
+        bool
+        mayOverlap(Addr addr, unsigned size) const
+        {
+            // Empty accesses are matched by partial coverage checks
+            if (size == 0)
+                return true;
+            bool hit = false;
+            forEachBucket(addr, size,
+                    [this, &hit](size_t b) { hit |= counts[b] != 0; });
+            return hit;
+        }
+    };
+
     /** Coverage of one address range with another */
     enum class AddrRangeCoverage
     {
@@ -478,6 +551,19 @@ class LSQUnit
     /** Address Mask for a cache block (e.g. ~(cache_block_size-1)) */
     Addr cacheBlockMask;
 
+    /** Lines written by the stores currently in the store queue. */
+    StoreFilter storeFilter;
+
+    /** Remove a store queue entry from the store filter. */
+    void
+    unfilterStore(SQEntry &entry)
+    {
+        if (entry.filterSize()) {
+            storeFilter.remove(entry.filterAddr(), entry.filterSize());
+            entry.filterSize() = 0;
+        }
+    }
+
     /** Wire to read information from the issue stage time queue. */
     typename TimeBuffer<IssueStruct>::wire fromIssue;
 
@@ -36,6 +36,14 @@
 from m5.objects.Probe import *
 
 
+# The file format of the data dependency trace. Protobuf writes a stream of
+# InstDepRecord messages, gzip compressed if the file name ends with .gz.
+# Columnar writes the more compact block based format which the TraceCPU
+# reads ahead on a host thread, and CompressedColumnar deflates its blocks.
+class ElasticTraceFormat(ScopedEnum):
+    vals = ["Protobuf", "Columnar", "CompressedColumnar"]
+
+
 class ElasticTrace(ProbeListenerObject):
     type = "ElasticTrace"
     cxx_class = "gem5::o3::ElasticTrace"
@@ -47,7 +55,10 @@ class ElasticTrace(ProbeListenerObject):
         desc="Protobuf trace file name for instruction fetch tracing"
     )
     dataDepTraceFile = Param.String(
-        desc="Protobuf trace file name for data dependency tracing"
+        desc="Trace file name for data dependency tracing"
+    )
+    dataDepTraceFormat = Param.ElasticTraceFormat(
+        "Protobuf", "File format of the data dependency trace"
     )
     # The dependency window size param must be equal to or greater than the
     # number of entries in the O3CPU ROB, a typical value is 3 times ROB size
@@ -68,3 +79,17 @@ class ElasticTrace(ProbeListenerObject):
     traceVirtAddr = Param.Bool(
         False, "Set to true if virtual addresses are to be traced."
     )
+    # The execution info of the instructions in flight is kept in a ring
+    # indexed by their sequence number, which must cover the sequence numbers
+    # from the oldest instruction in the ROB to the youngest one renamed
+    tempStoreSize = Param.Unsigned(
+        4096,
+        "Number of entries of the ring of in flight "
+        "instructions, a power of 2",
+    )
+    # Encoding and writing the data dependency trace is otherwise done by
+    # the simulation thread
+    writerThread = Param.Bool(
+        True,
+        "Encode and write the data dependency trace on a host thread",
+    )
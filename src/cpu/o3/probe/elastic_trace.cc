@@ -37,12 +37,16 @@
 
 #include "cpu/o3/probe/elastic_trace.hh"
 
+#include <algorithm>
+
 #include "base/callback.hh"
+#include "base/intmath.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/reg_class.hh"
 #include "debug/ElasticTrace.hh"
+#include "enums/ElasticTraceFormat.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -55,9 +59,17 @@ ElasticTrace::ElasticTrace(const ElasticTraceParams &params)
     :  ProbeListenerObject(params),
        regEtraceListenersEvent([this]{ regEtraceListeners(); }, name()),
        firstWin(true),
+       tempStore(params.tempStoreSize),
+       tempStoreOccupancy(0),
        lastClearedSeqNum(0),
+       physRegDepMapSize(0),
+       depTrace(2 * params.depWindowSize),
+       depTraceHead(0),
+       depTraceSize(0),
        depWindowSize(params.depWindowSize),
        dataTraceStream(nullptr),
+       depTraceStream(nullptr),
+       stopWriter(false),
        instTraceStream(nullptr),
        startTraceInst(params.startTraceInst),
        allProbesReg(false),
@@ -72,6 +84,9 @@ ElasticTrace::ElasticTrace(const ElasticTraceParams &params)
     fatal_if(depWindowSize == 0, "depWindowSize parameter must be non-zero. "\
                 "Recommended size is 3x ROB size in the O3CPU.\n");
 
+    fatal_if(!isPowerOf2(tempStore.size()), "tempStoreSize parameter must "
+                "be a power of 2.\n");
+
     fatal_if(cpu->numThreads > 1, "numThreads = %i, %s supports tracing for"\
                 "single-threaded workload only", cpu->numThreads, name());
     // Initialize the protobuf output stream
@@ -83,19 +98,34 @@ ElasticTrace::ElasticTrace(const ElasticTraceParams &params)
                                             params.instFetchTraceFile);
     instTraceStream = new ProtoOutputStream(filename);
     filename = simout.resolve(name() + "." + params.dataDepTraceFile);
-    dataTraceStream = new ProtoOutputStream(filename);
+    if (params.dataDepTraceFormat == ElasticTraceFormat::Protobuf) {
+        dataTraceStream = new ProtoOutputStream(filename);
+    } else {
+        DepTraceHeader header;
+        header.objId = name();
+        header.tickFreq = sim_clock::Frequency;
+        header.windowSize = depWindowSize;
+        depTraceStream = new DepTraceOutputStream(filename, header,
+            params.dataDepTraceFormat ==
+                ElasticTraceFormat::CompressedColumnar);
+    }
     // Create a protobuf message for the header and write it to the stream
     ProtoMessage::PacketHeader inst_pkt_header;
     inst_pkt_header.set_obj_id(name());
     inst_pkt_header.set_tick_freq(sim_clock::Frequency);
     instTraceStream->write(inst_pkt_header);
     // Create a protobuf message for the header and write it to
-    // the stream
-    ProtoMessage::InstDepRecordHeader data_rec_header;
-    data_rec_header.set_obj_id(name());
-    data_rec_header.set_tick_freq(sim_clock::Frequency);
-    data_rec_header.set_window_size(depWindowSize);
-    dataTraceStream->write(data_rec_header);
+    // the stream, the columnar stream having written its own
+    if (dataTraceStream) {
+        ProtoMessage::InstDepRecordHeader data_rec_header;
+        data_rec_header.set_obj_id(name());
+        data_rec_header.set_tick_freq(sim_clock::Frequency);
+        data_rec_header.set_window_size(depWindowSize);
+        dataTraceStream->write(data_rec_header);
+    }
+    traceInfoMap.reserve(depTrace.size());
+    if (params.writerThread)
+        writer = std::thread([this]() { writeBatches(); });
     // Register a callback to flush trace records and close the output streams.
     registerExitCallback([this]() {  flushTraces(); });
 }
@@ -192,18 +222,11 @@ ElasticTrace::recordExecTick(const DynInstConstPtr& dyn_inst)
     // instruction had a register dependency recorded in the rename probe
     // listener before entering execute stage or it will not exist and will
     // need to be created here.
-    InstExecInfo* exec_info_ptr;
-    auto itr_exec_info = tempStore.find(dyn_inst->seqNum);
-    if (itr_exec_info != tempStore.end()) {
-        exec_info_ptr = itr_exec_info->second;
-    } else {
-        exec_info_ptr = new InstExecInfo;
-        tempStore[dyn_inst->seqNum] = exec_info_ptr;
-    }
+    InstExecInfo* exec_info_ptr = findExecInfo(dyn_inst->seqNum);
+    if (!exec_info_ptr)
+        exec_info_ptr = newExecInfo(dyn_inst->seqNum);
 
     exec_info_ptr->executeTick = curTick();
-    stats.maxTempStoreSize = std::max(tempStore.size(),
-                                (std::size_t)stats.maxTempStoreSize.value());
 }
 
 void
@@ -213,8 +236,8 @@ ElasticTrace::recordToCommTick(const DynInstConstPtr& dyn_inst)
     // execution is far enough that we cannot gather info about its past like
     // the tick it started execution. Simply return until we see an instruction
     // that is found in the tempStore.
-    auto itr_exec_info = tempStore.find(dyn_inst->seqNum);
-    if (itr_exec_info == tempStore.end()) {
+    InstExecInfo* exec_info_ptr = findExecInfo(dyn_inst->seqNum);
+    if (!exec_info_ptr) {
         DPRINTFR(ElasticTrace, "recordToCommTick: [sn:%lli] Not in temp store,"
                     " skipping.\n", dyn_inst->seqNum);
         return;
@@ -222,7 +245,6 @@ ElasticTrace::recordToCommTick(const DynInstConstPtr& dyn_inst)
 
     DPRINTFR(ElasticTrace, "[sn:%lli] To Commit Tick = %i\n", dyn_inst->seqNum,
                 curTick());
-    InstExecInfo* exec_info_ptr = itr_exec_info->second;
     exec_info_ptr->toCommitTick = curTick();
 
 }
@@ -238,8 +260,7 @@ ElasticTrace::updateRegDep(const DynInstConstPtr& dyn_inst)
     // Since this is the first probe activated in the pipeline, create
     // a new execution info object to track this instruction as it
     // progresses through the pipeline.
-    InstExecInfo* exec_info_ptr = new InstExecInfo;
-    tempStore[seq_num] = exec_info_ptr;
+    InstExecInfo* exec_info_ptr = newExecInfo(seq_num);
 
     // Loop through the source registers and look up the dependency map. If
     // the source register entry is found in the dependency map, add a
@@ -254,9 +275,10 @@ ElasticTrace::updateRegDep(const DynInstConstPtr& dyn_inst)
             DPRINTFR(ElasticTrace, "[sn:%lli] Check map for src reg"
                      " %i (%s)\n", seq_num,
                      phys_src_reg->flatIndex(), phys_src_reg->className());
-            auto itr_writer = physRegDepMap.find(phys_src_reg->flatIndex());
-            if (itr_writer != physRegDepMap.end()) {
-                InstSeqNum last_writer = itr_writer->second;
+            RegIndex src_idx_flat = phys_src_reg->flatIndex();
+            InstSeqNum last_writer = src_idx_flat < physRegDepMap.size() ?
+                physRegDepMap[src_idx_flat] : 0;
+            if (last_writer != 0) {
                 // Additionally the dependency distance is kept less than the
                 // window size parameter to limit the memory allocation to
                 // nodes in the graph. If the window were tending to infinite
@@ -264,7 +286,11 @@ ElasticTrace::updateRegDep(const DynInstConstPtr& dyn_inst)
                 // replay.
                 if (seq_num - last_writer < depWindowSize) {
                     // Record a physical register dependency.
-                    exec_info_ptr->physRegDepSet.insert(last_writer);
+                    auto &deps = exec_info_ptr->physRegDeps;
+                    auto dep_it = std::lower_bound(deps.begin(), deps.end(),
+                                                   last_writer);
+                    if (dep_it == deps.end() || *dep_it != last_writer)
+                        deps.insert(dep_it, last_writer);
                 }
             }
 
@@ -287,10 +313,15 @@ ElasticTrace::updateRegDep(const DynInstConstPtr& dyn_inst)
             DPRINTFR(ElasticTrace, "[sn:%lli] Update map for dest reg"
                      " %i (%s)\n", seq_num, phys_dest_reg->flatIndex(),
                      dest_reg.className());
-            physRegDepMap[phys_dest_reg->flatIndex()] = seq_num;
+            RegIndex dest_idx_flat = phys_dest_reg->flatIndex();
+            if (dest_idx_flat >= physRegDepMap.size())
+                physRegDepMap.resize(dest_idx_flat + 1, 0);
+            if (physRegDepMap[dest_idx_flat] == 0)
+                ++physRegDepMapSize;
+            physRegDepMap[dest_idx_flat] = seq_num;
         }
     }
-    stats.maxPhysRegDepMapSize = std::max(physRegDepMap.size(),
+    stats.maxPhysRegDepMapSize = std::max(physRegDepMapSize,
                             (std::size_t)stats.maxPhysRegDepMapSize.value());
 }
 
@@ -299,9 +330,11 @@ ElasticTrace::removeRegDepMapEntry(const SeqNumRegPair &inst_reg_pair)
 {
     DPRINTFR(ElasticTrace, "Remove Map entry for Reg %i\n",
             inst_reg_pair.second);
-    auto itr_regdep_map = physRegDepMap.find(inst_reg_pair.second);
-    if (itr_regdep_map != physRegDepMap.end())
-        physRegDepMap.erase(itr_regdep_map);
+    RegIndex idx = inst_reg_pair.second;
+    if (idx < physRegDepMap.size() && physRegDepMap[idx] != 0) {
+        physRegDepMap[idx] = 0;
+        --physRegDepMapSize;
+    }
 }
 
 void
@@ -310,16 +343,14 @@ ElasticTrace::addSquashedInst(const DynInstConstPtr& head_inst)
     // If the squashed instruction was squashed before being processed by
     // execute stage then it will not be in the temporary store. In this case
     // do nothing and return.
-    auto itr_exec_info = tempStore.find(head_inst->seqNum);
-    if (itr_exec_info == tempStore.end())
+    InstExecInfo* exec_info_ptr = findExecInfo(head_inst->seqNum);
+    if (!exec_info_ptr)
         return;
 
     // If there is a squashed load for which a read request was
     // sent before it got squashed then add it to the trace.
     DPRINTFR(ElasticTrace, "Attempt to add squashed inst [sn:%lli]\n",
                 head_inst->seqNum);
-    // Get pointer to the execution info object corresponding to the inst.
-    InstExecInfo* exec_info_ptr = itr_exec_info->second;
     if (head_inst->isLoad() && exec_info_ptr->executeTick != MaxTick &&
         exec_info_ptr->toCommitTick != MaxTick &&
         head_inst->hasRequest() &&
@@ -345,15 +376,13 @@ ElasticTrace::addCommittedInst(const DynInstConstPtr& head_inst)
         // of execution is far enough that we cannot gather info about its past
         // like the tick it started execution. Simply return until we see an
         // instruction that is found in the tempStore.
-        auto itr_temp_store = tempStore.find(head_inst->seqNum);
-        if (itr_temp_store == tempStore.end()) {
+        InstExecInfo* exec_info_ptr = findExecInfo(head_inst->seqNum);
+        if (!exec_info_ptr) {
             DPRINTFR(ElasticTrace, "addCommittedInst: [sn:%lli] Not in temp "
                 "store, skipping.\n", head_inst->seqNum);
             return;
         }
 
-        // Get pointer to the execution info object corresponding to the inst.
-        InstExecInfo* exec_info_ptr = itr_temp_store->second;
         assert(exec_info_ptr->executeTick != MaxTick);
         assert(exec_info_ptr->toCommitTick != MaxTick);
 
@@ -395,8 +424,11 @@ void
 ElasticTrace::addDepTraceRecord(const DynInstConstPtr& head_inst,
                                 InstExecInfo* exec_info_ptr, bool commit)
 {
-    // Create a record to assign dynamic intruction related fields.
-    TraceInfo* new_record = new TraceInfo;
+    // Reuse the next record of the ring to assign dynamic intruction related
+    // fields, it is only added to the trace once it is complete.
+    TraceInfo* new_record = depTraceAt(depTraceSize);
+    new_record->robDepList.clear();
+    new_record->physRegDepList.clear();
     // Add to map for sequence number look up to retrieve the TraceInfo pointer
     traceInfoMap[head_inst->seqNum] = new_record;
 
@@ -429,9 +461,9 @@ ElasticTrace::addDepTraceRecord(const DynInstConstPtr& head_inst,
     // case of adding an ROB dependency by using a reverse iterator is not
     // applicable. Thus, populate the fields of the record corresponding to the
     // first instruction and return.
-    if (depTrace.empty()) {
+    if (depTraceSize == 0) {
         // Store the record in depTrace.
-        depTrace.push_back(new_record);
+        ++depTraceSize;
         DPRINTF(ElasticTrace, "Added first inst record %lli to DepTrace.\n",
                 new_record->instNum);
         return;
@@ -440,13 +472,13 @@ ElasticTrace::addDepTraceRecord(const DynInstConstPtr& head_inst,
     // Clear register dependencies for squashed loads as they may be dependent
     // on squashed instructions and we do not add those to the trace.
     if (head_inst->isLoad() && !commit) {
-         (exec_info_ptr->physRegDepSet).clear();
+         (exec_info_ptr->physRegDeps).clear();
     }
 
     // Assign the register dependencies stored in the execution info object
-    std::set<InstSeqNum>::const_iterator dep_set_it;
-    for (dep_set_it = (exec_info_ptr->physRegDepSet).begin();
-         dep_set_it != (exec_info_ptr->physRegDepSet).end();
+    std::vector<InstSeqNum>::const_iterator dep_set_it;
+    for (dep_set_it = (exec_info_ptr->physRegDeps).begin();
+         dep_set_it != (exec_info_ptr->physRegDeps).end();
          ++dep_set_it) {
         auto trace_info_itr = traceInfoMap.find(*dep_set_it);
         if (trace_info_itr != traceInfoMap.end()) {
@@ -498,14 +530,14 @@ ElasticTrace::addDepTraceRecord(const DynInstConstPtr& head_inst,
     }
 
     // Store the record in depTrace.
-    depTrace.push_back(new_record);
+    ++depTraceSize;
     DPRINTF(ElasticTrace, "Added %s inst %lli to DepTrace.\n",
             (commit ? "committed" : "squashed"), new_record->instNum);
 
     // To process the number of records specified by depWindowSize in the
     // forward direction, the depTrace must have twice as many records
     // to check for dependencies.
-    if (depTrace.size() == 2 * depWindowSize) {
+    if (depTraceSize == depTrace.size()) {
 
         DPRINTF(ElasticTrace, "Writing out trace...\n");
 
@@ -526,15 +558,14 @@ ElasticTrace::updateCommitOrderDep(TraceInfo* new_record,
     assert(new_record->isStore());
     // Iterate in reverse direction to search for the last committed
     // load/store that completed earlier than the new record
-    depTraceRevItr from_itr(depTrace.end());
-    depTraceRevItr until_itr(depTrace.begin());
-    TraceInfo* past_record = *from_itr;
+    size_t from_idx = depTraceSize;
     uint32_t num_go_back = 0;
 
     // The execution time of this store is when it is sent, that is committed
     Tick execute_tick = curTick();
     // Search for store-after-load or store-after-store order dependency
-    while (num_go_back < depWindowSize && from_itr != until_itr) {
+    while (num_go_back < depWindowSize && from_idx != 0) {
+        TraceInfo* past_record = depTraceAt(--from_idx);
         if (find_load_not_store) {
             // Check if previous inst is a load completed earlier by comparing
             // with execute tick
@@ -554,8 +585,6 @@ ElasticTrace::updateCommitOrderDep(TraceInfo* new_record,
                 return;
             }
         }
-        ++from_itr;
-        past_record = *from_itr;
         ++num_go_back;
     }
 }
@@ -565,10 +594,7 @@ ElasticTrace::updateIssueOrderDep(TraceInfo* new_record)
 {
     // Interate in reverse direction to search for the last committed
     // record that completed earlier than the new record
-    depTraceRevItr from_itr(depTrace.end());
-    depTraceRevItr until_itr(depTrace.begin());
-    TraceInfo* past_record = *from_itr;
-
+    size_t from_idx = depTraceSize;
     uint32_t num_go_back = 0;
     Tick execute_tick = 0;
 
@@ -589,7 +615,8 @@ ElasticTrace::updateIssueOrderDep(TraceInfo* new_record)
     // We search if this record has an issue order dependency on a past record.
     // Once we find it, we update both the new record and the record it depends
     // on and return.
-    while (num_go_back < depWindowSize && from_itr != until_itr) {
+    while (num_go_back < depWindowSize && from_idx != 0) {
+        TraceInfo* past_record = depTraceAt(--from_idx);
         // Check if a previous inst is a load sent earlier, or a store sent
         // earlier, or a comp inst completed earlier by comparing with execute
         // tick
@@ -600,8 +627,6 @@ ElasticTrace::updateIssueOrderDep(TraceInfo* new_record)
             assignRobDep(past_record, new_record);
             return;
         }
-        ++from_itr;
-        past_record = *from_itr;
         ++num_go_back;
     }
 }
@@ -658,21 +683,52 @@ ElasticTrace::clearTempStoreUntil(const DynInstConstPtr& head_inst)
 {
     // Clear from temp store starting with the execution info object
     // corresponding the head_inst and continue clearing by decrementing the
-    // sequence number until the last cleared sequence number.
-    InstSeqNum temp_sn = (head_inst->seqNum);
-    while (temp_sn > lastClearedSeqNum) {
-        auto itr_exec_info = tempStore.find(temp_sn);
-        if (itr_exec_info != tempStore.end()) {
-            InstExecInfo* exec_info_ptr = itr_exec_info->second;
-            // Free allocated memory for the info object
-            delete exec_info_ptr;
-            // Remove entry from temporary store
-            tempStore.erase(itr_exec_info);
+    // sequence number until the last cleared sequence number. If there are
+    // more of them than entries, clear every entry of the range instead.
+    InstSeqNum head_sn = head_inst->seqNum;
+    if (head_sn > lastClearedSeqNum &&
+        head_sn - lastClearedSeqNum >= tempStore.size()) {
+        for (auto &info : tempStore) {
+            if (info.seqNum != 0 && info.seqNum <= head_sn) {
+                info.seqNum = 0;
+                --tempStoreOccupancy;
+            }
+        }
+    } else {
+        for (InstSeqNum temp_sn = head_sn; temp_sn > lastClearedSeqNum;
+             temp_sn--) {
+            InstExecInfo* exec_info_ptr = findExecInfo(temp_sn);
+            if (exec_info_ptr) {
+                exec_info_ptr->seqNum = 0;
+                --tempStoreOccupancy;
+            }
         }
-        temp_sn--;
     }
     // Update the last cleared sequence number to that of the head_inst
-    lastClearedSeqNum = head_inst->seqNum;
+    lastClearedSeqNum = head_sn;
+}
+
+ElasticTrace::InstExecInfo *
+ElasticTrace::newExecInfo(InstSeqNum seq_num)
+{
+    InstExecInfo &info = tempStore[seq_num & (tempStore.size() - 1)];
+    if (info.seqNum == 0) {
+        ++tempStoreOccupancy;
+    } else if (info.seqNum != seq_num) {
+        // The other instruction is still in flight, it will be skipped as
+        // if tracing started after it was renamed.
+        warn_once("%s: Instructions are dropped from the trace as more are "
+                  "in flight than the tempStoreSize parameter allows.\n",
+                  name());
+        ++stats.numTempStoreConflicts;
+    }
+    info.seqNum = seq_num;
+    info.executeTick = MaxTick;
+    info.toCommitTick = MaxTick;
+    info.physRegDeps.clear();
+    stats.maxTempStoreSize = std::max(tempStoreOccupancy,
+                                (std::size_t)stats.maxTempStoreSize.value());
+    return &info;
 }
 
 void
@@ -792,10 +848,10 @@ ElasticTrace::writeDepTrace(uint32_t num_to_write)
     // List of physical register RAW dependencies - optional, repeated
     // Weight of a node equal to no. of filtered nodes before it - optional
     uint16_t num_filtered_nodes = 0;
-    depTraceItr dep_trace_itr(depTrace.begin());
-    depTraceItr dep_trace_itr_start = dep_trace_itr;
-    while (num_to_write > 0) {
-        TraceInfo* temp_ptr = *dep_trace_itr;
+    std::unique_ptr<RecordBatch> batch = getBatch();
+    assert(num_to_write <= depTraceSize);
+    for (uint32_t i = 0; i < num_to_write; i++) {
+        TraceInfo* temp_ptr = depTraceAt(i);
         assert(temp_ptr->type != Record::INVALID);
         // If no node dependends on a comp node then there is no reason to
         // track the comp node in the dependency graph. We filter out such
@@ -825,61 +881,170 @@ ElasticTrace::writeDepTrace(uint32_t num_to_write)
             DPRINTFR(ElasticTrace, "\thas computational delay %lli\n",
                      temp_ptr->compDelay);
 
-            // Create a protobuf message for the dependency record
-            ProtoMessage::InstDepRecord dep_pkt;
-            dep_pkt.set_seq_num(temp_ptr->instNum);
-            dep_pkt.set_type(temp_ptr->type);
-            dep_pkt.set_pc(temp_ptr->pc);
-            if (temp_ptr->isLoad() || temp_ptr->isStore()) {
-                dep_pkt.set_flags(temp_ptr->reqFlags);
-                dep_pkt.set_p_addr(temp_ptr->physAddr);
-                // If tracing of virtual addresses is enabled, set the optional
-                // field for it
-                if (traceVirtAddr)
-                    dep_pkt.set_v_addr(temp_ptr->virtAddr);
-                dep_pkt.set_size(temp_ptr->size);
-            }
-            dep_pkt.set_comp_delay(temp_ptr->compDelay);
             if (temp_ptr->robDepList.empty()) {
                 DPRINTFR(ElasticTrace, "\thas no order (rob) dependencies\n");
             }
-            while (!temp_ptr->robDepList.empty()) {
+            for (auto dep : temp_ptr->robDepList) {
                 DPRINTFR(ElasticTrace, "\thas order (rob) dependency on %lli\n",
-                         temp_ptr->robDepList.front());
-                dep_pkt.add_rob_dep(temp_ptr->robDepList.front());
-                temp_ptr->robDepList.pop_front();
+                         dep);
             }
             if (temp_ptr->physRegDepList.empty()) {
                 DPRINTFR(ElasticTrace, "\thas no register dependencies\n");
             }
-            while (!temp_ptr->physRegDepList.empty()) {
+            for (auto dep : temp_ptr->physRegDepList) {
                 DPRINTFR(ElasticTrace, "\thas register dependency on %lli\n",
-                         temp_ptr->physRegDepList.front());
-                dep_pkt.add_reg_dep(temp_ptr->physRegDepList.front());
-                temp_ptr->physRegDepList.pop_front();
-            }
-            if (num_filtered_nodes != 0) {
-                // Set the weight of this node as the no. of filtered nodes
-                // between this node and the last node that we wrote to output
-                // stream. The weight will be used during replay to model ROB
-                // occupancy of filtered nodes.
-                dep_pkt.set_weight(num_filtered_nodes);
-                num_filtered_nodes = 0;
+                         dep);
             }
-            // Write the message to the protobuf output stream
-            dataTraceStream->write(dep_pkt);
+            makeDepRecord(temp_ptr, num_filtered_nodes, batch->next());
+            num_filtered_nodes = 0;
         } else {
             // Don't write the node to the trace but note that we have filtered
             // out a node.
             ++stats.numFilteredNodes;
             ++num_filtered_nodes;
         }
-        dep_trace_itr++;
         traceInfoMap.erase(temp_ptr->instNum);
-        delete temp_ptr;
-        num_to_write--;
     }
-    depTrace.erase(dep_trace_itr_start, dep_trace_itr);
+    depTraceHead = (depTraceHead + num_to_write) % depTrace.size();
+    depTraceSize -= num_to_write;
+    submitBatch(std::move(batch));
+}
+
+void
+ElasticTrace::makeDepRecord(const TraceInfo* node, uint32_t weight,
+                            DepTraceRecord &record) const
+{
+    record.seqNum = node->instNum;
+    record.type = DepTraceRecord::Type(node->type);
+    record.pc = node->pc;
+    if (node->isLoad() || node->isStore()) {
+        record.flags = node->reqFlags;
+        record.pAddr = node->physAddr;
+        record.vAddr = traceVirtAddr ? node->virtAddr : 0;
+        record.size = node->size;
+    } else {
+        record.flags = 0;
+        record.pAddr = 0;
+        record.vAddr = 0;
+        record.size = 0;
+    }
+    record.compDelay = node->compDelay;
+    record.robDep.assign(node->robDepList.begin(), node->robDepList.end());
+    record.regDep.assign(node->physRegDepList.begin(),
+                         node->physRegDepList.end());
+    record.weight = weight;
+}
+
+void
+ElasticTrace::writeDepPkt(const DepTraceRecord &record)
+{
+    // Create a protobuf message for the dependency record
+    ProtoMessage::InstDepRecord dep_pkt;
+    dep_pkt.set_seq_num(record.seqNum);
+    dep_pkt.set_type(RecordType(record.type));
+    dep_pkt.set_pc(record.pc);
+    if (record.isMem()) {
+        dep_pkt.set_flags(record.flags);
+        dep_pkt.set_p_addr(record.pAddr);
+        // If tracing of virtual addresses is enabled, set the optional
+        // field for it
+        if (traceVirtAddr)
+            dep_pkt.set_v_addr(record.vAddr);
+        dep_pkt.set_size(record.size);
+    }
+    dep_pkt.set_comp_delay(record.compDelay);
+    for (auto dep : record.robDep)
+        dep_pkt.add_rob_dep(dep);
+    for (auto dep : record.regDep)
+        dep_pkt.add_reg_dep(dep);
+    if (record.weight != 0) {
+        // Set the weight of this node as the no. of filtered nodes
+        // between this node and the last node that we wrote to output
+        // stream. The weight will be used during replay to model ROB
+        // occupancy of filtered nodes.
+        dep_pkt.set_weight(record.weight);
+    }
+    // Write the message to the protobuf output stream
+    dataTraceStream->write(dep_pkt);
+}
+
+void
+ElasticTrace::writeBatch(const RecordBatch &batch)
+{
+    for (size_t i = 0; i < batch.size; i++) {
+        if (depTraceStream)
+            depTraceStream->write(batch.records[i]);
+        else
+            writeDepPkt(batch.records[i]);
+    }
+}
+
+std::unique_ptr<ElasticTrace::RecordBatch>
+ElasticTrace::getBatch()
+{
+    std::lock_guard<std::mutex> lock(writerMutex);
+    if (freeBatches.empty())
+        return std::make_unique<RecordBatch>();
+    std::unique_ptr<RecordBatch> batch = std::move(freeBatches.back());
+    freeBatches.pop_back();
+    return batch;
+}
+
+void
+ElasticTrace::submitBatch(std::unique_ptr<RecordBatch> batch)
+{
+    if (!writer.joinable()) {
+        writeBatch(*batch);
+        batch->size = 0;
+        freeBatches.push_back(std::move(batch));
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    // Wait for the writer to catch up rather than buffering without bound
+    batchFree.wait(lock, [this]() {
+        return pendingBatches.size() < maxPendingBatches;
+    });
+    pendingBatches.push_back(std::move(batch));
+    batchReady.notify_one();
+}
+
+void
+ElasticTrace::writeBatches()
+{
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true) {
+        batchReady.wait(lock, [this]() {
+            return stopWriter || !pendingBatches.empty();
+        });
+        // Write all the pending batches before stopping
+        if (pendingBatches.empty())
+            return;
+        std::unique_ptr<RecordBatch> batch =
+            std::move(pendingBatches.front());
+        pendingBatches.pop_front();
+        batchFree.notify_one();
+
+        lock.unlock();
+        writeBatch(*batch);
+        batch->size = 0;
+        lock.lock();
+
+        freeBatches.push_back(std::move(batch));
+    }
+}
+
+void
+ElasticTrace::stopWriting()
+{
+    if (!writer.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopWriter = true;
+    }
+    batchReady.notify_one();
+    writer.join();
 }
 
 ElasticTrace::ElasticTraceStats::ElasticTraceStats(statistics::Group *parent)
@@ -905,7 +1070,10 @@ ElasticTrace::ElasticTraceStats::ElasticTraceStats(statistics::Group *parent)
       ADD_STAT(maxTempStoreSize, statistics::units::Count::get(),
                "Maximum size of the temporary store during the run"),
       ADD_STAT(maxPhysRegDepMapSize, statistics::units::Count::get(),
-               "Maximum size of register dependency map")
+               "Maximum size of register dependency map"),
+      ADD_STAT(numTempStoreConflicts, statistics::units::Count::get(),
+               "Number of instructions dropped from the temporary store as "
+               "a younger one took their entry")
 {
 }
 
@@ -919,9 +1087,11 @@ void
 ElasticTrace::flushTraces()
 {
     // Write to trace all records in the depTrace.
-    writeDepTrace(depTrace.size());
+    writeDepTrace(depTraceSize);
+    stopWriting();
     // Delete the stream objects
     delete dataTraceStream;
+    delete depTraceStream;
     delete instTraceStream;
 }
 
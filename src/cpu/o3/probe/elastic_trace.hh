@@ -46,13 +46,19 @@
 #ifndef __CPU_O3_PROBE_ELASTIC_TRACE_HH__
 #define __CPU_O3_PROBE_ELASTIC_TRACE_HH__
 
-#include <set>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/reg_class.hh"
+#include "cpu/trace/dep_trace_io.hh"
 #include "mem/request.hh"
 #include "params/ElasticTrace.hh"
 #include "proto/inst_dep_record.pb.h"
@@ -200,6 +206,8 @@ class ElasticTrace : public ProbeListenerObject
          * @ingroup InstExecInfo
          * @{
          */
+        /** Sequence number of the instruction, 0 if the entry is free */
+        InstSeqNum seqNum;
         /** Timestamp when instruction was first processed by execute stage */
         Tick executeTick;
         /**
@@ -208,15 +216,17 @@ class ElasticTrace : public ProbeListenerObject
          */
         Tick toCommitTick;
         /**
-         * Set of instruction sequence numbers that this instruction depends on
-         * due to Read After Write data dependency based on physical register.
+         * Sorted instruction sequence numbers that this instruction depends
+         * on due to Read After Write data dependency based on physical
+         * register.
          */
-        std::set<InstSeqNum> physRegDepSet;
+        std::vector<InstSeqNum> physRegDeps;
         /** @} */
 
         /** Constructor */
         InstExecInfo()
-          : executeTick(MaxTick),
+          : seqNum(0),
+            executeTick(MaxTick),
             toCommitTick(MaxTick)
         { }
     };
@@ -225,10 +235,36 @@ class ElasticTrace : public ProbeListenerObject
      * Temporary store of InstExecInfo objects. Later on when an instruction
      * is processed for commit or retire, if it is chosen to be written to
      * the output trace then this information is looked up using the instruction
-     * sequence number as the key. If it is not chosen then the entry for it in
-     * the store is cleared.
+     * sequence number. If it is not chosen then the entry for it in
+     * the store is cleared. The store is a ring indexed by the sequence
+     * number modulo its size, whose entries are reused.
+     */
+    std::vector<InstExecInfo> tempStore;
+
+    /** Number of entries of the temporary store in use. */
+    size_t tempStoreOccupancy;
+
+    /**
+     * Look up the execution info of an instruction.
+     *
+     * @param seq_num Sequence number of the instruction
+     * @return The execution info, or nullptr if it isn't in the store
      */
-    std::unordered_map<InstSeqNum, InstExecInfo*> tempStore;
+    InstExecInfo *
+    findExecInfo(InstSeqNum seq_num)
+    {
+        InstExecInfo &info = tempStore[seq_num & (tempStore.size() - 1)];
+        return info.seqNum == seq_num ? &info : nullptr;
+    }
+
+    /**
+     * Start tracking the execution of an instruction, replacing the info
+     * it had if any.
+     *
+     * @param seq_num Sequence number of the instruction
+     * @return The cleared execution info of the instruction
+     */
+    InstExecInfo *newExecInfo(InstSeqNum seq_num);
 
     /**
      * The last cleared instruction sequence number used to free up the memory
@@ -238,10 +274,14 @@ class ElasticTrace : public ProbeListenerObject
 
     /**
      * Map for recording the producer of a physical register to check Read
-     * After Write dependencies. The key is the renamed physical register and
-     * the value is the instruction sequence number of its last producer.
+     * After Write dependencies. It is indexed by the flat index of the
+     * renamed physical register and holds the instruction sequence number
+     * of its last producer, or 0 if there is none.
      */
-    std::unordered_map<RegIndex, InstSeqNum> physRegDepMap;
+    std::vector<InstSeqNum> physRegDepMap;
+
+    /** Number of physical registers with a producer in physRegDepMap. */
+    size_t physRegDepMapSize;
 
     /**
      * @defgroup TraceInfo Struct for a record in the instruction dependency
@@ -272,9 +312,9 @@ class ElasticTrace : public ProbeListenerObject
         /* If instruction was committed, as against squashed. */
         bool commit;
         /* List of order dependencies. */
-        std::list<InstSeqNum> robDepList;
+        std::vector<InstSeqNum> robDepList;
         /* List of physical register RAW dependencies. */
-        std::list<InstSeqNum> physRegDepList;
+        std::vector<InstSeqNum> physRegDepList;
         /**
          * Computational delay after the last dependent inst. completed.
          * A value of -1 which means instruction has no dependencies.
@@ -324,9 +364,23 @@ class ElasticTrace : public ProbeListenerObject
      * dependencies are stored in the graph before  the dependent itself is
      * added. This facilitates creating a tree data structure during replay,
      * i.e. adding children as records are read from the trace in an efficient
-     * manner.
+     * manner. It is a ring of twice the window size whose records, and
+     * their dependency lists, are reused.
      */
-    std::vector<TraceInfo*> depTrace;
+    std::vector<TraceInfo> depTrace;
+
+    /** Position of the oldest record in depTrace. */
+    size_t depTraceHead;
+
+    /** Number of records in depTrace. */
+    size_t depTraceSize;
+
+    /** Get the i-th oldest record of depTrace. */
+    TraceInfo *
+    depTraceAt(size_t i)
+    {
+        return &depTrace[(depTraceHead + i) % depTrace.size()];
+    }
 
     /**
      * Map where the instruction sequence number is mapped to the pointer to
@@ -334,12 +388,6 @@ class ElasticTrace : public ProbeListenerObject
      */
     std::unordered_map<InstSeqNum, TraceInfo*> traceInfoMap;
 
-    /** Typedef of iterator to the instruction dependency trace. */
-    typedef typename std::vector<TraceInfo*>::iterator depTraceItr;
-
-    /** Typedef of the reverse iterator to the instruction dependency trace. */
-    typedef typename std::reverse_iterator<depTraceItr> depTraceRevItr;
-
     /**
      * The maximum distance for a dependency and is set by a top level
      * level parameter. It must be equal to or greater than the number of
@@ -351,6 +399,63 @@ class ElasticTrace : public ProbeListenerObject
     /** Protobuf output stream for data dependency trace */
     ProtoOutputStream* dataTraceStream;
 
+    /**
+     * Columnar output stream for data dependency trace, used instead of
+     * dataTraceStream if the columnar trace format is selected.
+     */
+    DepTraceOutputStream* depTraceStream;
+
+    /** Records of the data dependency trace written together. */
+    struct RecordBatch
+    {
+        /** The records, kept with their dependency vectors for reuse */
+        std::vector<DepTraceRecord> records;
+        /** Number of records in use */
+        size_t size = 0;
+
+        /** Get the next record to fill in, growing the batch if needed */
+        DepTraceRecord &
+        next()
+        {
+            if (size == records.size())
+                records.emplace_back();
+            return records[size++];
+        }
+    };
+
+    /**
+     * The batches of records are encoded and written to the data
+     * dependency trace by a host thread if there is one, so that the
+     * tracing cost on the simulation is mostly building the records.
+     */
+    std::thread writer;
+
+    /** The number of batches to queue for the writer at most. */
+    static const unsigned maxPendingBatches = 4;
+
+    /** Protects the members below, which are shared with the writer. */
+    std::mutex writerMutex;
+    std::condition_variable batchReady;
+    std::condition_variable batchFree;
+    std::deque<std::unique_ptr<RecordBatch>> pendingBatches;
+    std::vector<std::unique_ptr<RecordBatch>> freeBatches;
+    bool stopWriter;
+
+    /** The writer's main loop. */
+    void writeBatches();
+
+    /** Get an empty batch to fill in. */
+    std::unique_ptr<RecordBatch> getBatch();
+
+    /** Hand a batch to the writer, or write it if there is no writer. */
+    void submitBatch(std::unique_ptr<RecordBatch> batch);
+
+    /** Write the records of a batch to the data dependency trace. */
+    void writeBatch(const RecordBatch &batch);
+
+    /** Write the pending batches and stop the writer. */
+    void stopWriting();
+
     /** Protobuf output stream for instruction fetch trace. */
     ProtoOutputStream* instTraceStream;
 
@@ -420,12 +525,29 @@ class ElasticTrace : public ProbeListenerObject
     /**
      * Write out given number of records to the trace starting with the first
      * record in depTrace and iterating through the trace in sequence. A
-     * record is deleted after it is written.
+     * record is removed after it is written.
      *
      * @param num_to_write Number of records to write to the trace
      */
     void writeDepTrace(uint32_t num_to_write);
 
+    /**
+     * Fill in the trace record of a node.
+     *
+     * @param node   The node to write
+     * @param weight Number of filtered nodes preceding the node
+     * @param record The record to fill in
+     */
+    void makeDepRecord(const TraceInfo* node, uint32_t weight,
+                       DepTraceRecord &record) const;
+
+    /**
+     * Write a record to the protobuf data dependency trace.
+     *
+     * @param record The record to write
+     */
+    void writeDepPkt(const DepTraceRecord &record);
+
     /**
      * Reverse iterate through the graph, search for a store-after-store or
      * store-after-load dependency and update the new node's Rob dependency list.
@@ -556,6 +678,12 @@ class ElasticTrace : public ProbeListenerObject
          * register.
          */
         statistics::Scalar maxPhysRegDepMapSize;
+
+        /**
+         * Number of instructions whose execution info was dropped from the
+         * temporary store because a younger one took its entry.
+         */
+        statistics::Scalar numTempStoreConflicts;
     } stats;
 
 };
@@ -388,6 +388,39 @@ Rename::squash(const InstSeqNum &squash_seq_num, ThreadID tid)
     doSquash(squash_seq_num, tid);
 }
 
+bool
+Rename::isQuiescent()
+{
+    if (resumeSerialize || resumeUnblocking)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (renameStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if (renameStatus[tid] == Running ||
+                   renameStatus[tid] == Idle) {
+            if (!insts[tid].empty() || checkStall(tid))
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+Rename::skipCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (renameStatus[tid] == Blocked)
+            stats.blockCycles += cycles;
+        else
+            stats.idleCycles += cycles;
+    }
+}
+
 void
 Rename::tick()
 {
@@ -914,15 +947,13 @@ Rename::unblock(ThreadID tid)
 void
 Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
 {
-    auto hb_it = historyBuffer[tid].begin();
-
     // After a syscall squashes everything, the history buffer may be empty
     // but the ROB may still be squashing instructions.
     // Go through the most recent instructions, undoing the mappings
     // they did and freeing up the registers.
     while (!historyBuffer[tid].empty() &&
-           hb_it->instSeqNum > squashed_seq_num) {
-        assert(hb_it != historyBuffer[tid].end());
+           historyBuffer[tid].back().instSeqNum > squashed_seq_num) {
+        const RenameHistory *hb_it = &historyBuffer[tid].back();
 
         DPRINTF(Rename, "[tid:%i] Removing history entry with sequence "
                 "number %i (archReg: %d, newPhysReg: %d, prevPhysReg: %d).\n",
@@ -946,11 +977,11 @@ Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
 
         // Notify potential listeners that the register mapping needs to be
         // removed because the instruction it was mapped to got squashed. Note
-        // that this is done before hb_it is incremented.
+        // that this is done before the entry is removed.
         ppSquashInRename->notify(std::make_pair(hb_it->instSeqNum,
                                                 hb_it->newPhysReg));
 
-        historyBuffer[tid].erase(hb_it++);
+        historyBuffer[tid].pop_back();
 
         ++stats.undoneMaps;
     }
@@ -963,14 +994,10 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
             "history buffer %u (size=%i), until [sn:%llu].\n",
             tid, tid, historyBuffer[tid].size(), inst_seq_num);
 
-    auto hb_it = historyBuffer[tid].end();
-
-    --hb_it;
-
     if (historyBuffer[tid].empty()) {
         DPRINTF(Rename, "[tid:%i] History buffer is empty.\n", tid);
         return;
-    } else if (hb_it->instSeqNum > inst_seq_num) {
+    } else if (historyBuffer[tid].front().instSeqNum > inst_seq_num) {
         DPRINTF(Rename, "[tid:%i] [sn:%llu] "
                 "Old sequence number encountered. "
                 "Ensure that a syscall happened recently.\n",
@@ -983,8 +1010,8 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
     // rename histories if they did not have destination registers that were
     // renamed.
     while (!historyBuffer[tid].empty() &&
-           hb_it != historyBuffer[tid].end() &&
-           hb_it->instSeqNum <= inst_seq_num) {
+           historyBuffer[tid].front().instSeqNum <= inst_seq_num) {
+        const RenameHistory *hb_it = &historyBuffer[tid].front();
 
         DPRINTF(Rename, "[tid:%i] Freeing up older rename of reg %i (%s), "
                 "[sn:%llu].\n",
@@ -1001,7 +1028,7 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
 
         ++stats.committedMaps;
 
-        historyBuffer[tid].erase(hb_it--);
+        historyBuffer[tid].pop_front();
     }
 }
 
@@ -1112,11 +1139,11 @@ Rename::renameDestRegs(const DynInstPtr &inst, ThreadID tid)
                                rename_result.first,
                                rename_result.second);
 
-        historyBuffer[tid].push_front(hb_entry);
+        historyBuffer[tid].push_back(hb_entry);
 
         DPRINTF(Rename, "[tid:%i] [sn:%llu] "
                 "Adding instruction to history buffer (size=%i).\n",
-                tid,(*historyBuffer[tid].begin()).instSeqNum,
+                tid, historyBuffer[tid].back().instSeqNum,
                 historyBuffer[tid].size());
 
         // Tell the instruction to rename the appropriate destination
@@ -1410,13 +1437,12 @@ Rename::incrFullStat(const FullSource &source)
 void
 Rename::dumpHistory()
 {
-    std::list<RenameHistory>::iterator buf_it;
-
     for (ThreadID tid = 0; tid < numThreads; tid++) {
 
-        buf_it = historyBuffer[tid].begin();
+        // Newest renames first
+        auto buf_it = historyBuffer[tid].rbegin();
 
-        while (buf_it != historyBuffer[tid].end()) {
+        while (buf_it != historyBuffer[tid].rend()) {
             cprintf("Seq num: %i\nArch reg[%s]: %i New phys reg:"
                     " %i[%s] Old phys reg: %i[%s]\n",
                     (*buf_it).instSeqNum,
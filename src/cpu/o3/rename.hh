@@ -42,6 +42,7 @@
 #ifndef __CPU_O3_RENAME_HH__
 #define __CPU_O3_RENAME_HH__
 
+#include <deque>
 #include <list>
 #include <utility>
 
@@ -195,6 +196,16 @@ class Rename
      */
     void tick();
 
+    /** Returns if rename can make no progress until it receives
+     * instructions or the resources it is stalled on are freed.
+     */
+    bool isQuiescent();
+
+    /** Updates the stats for cycles the CPU skipped while quiescent, as if
+     * rename had been ticked in each of them.
+     */
+    void skipCycles(Cycles cycles);
+
     /** Debugging function used to dump history buffer of renamings. */
     void dumpHistory();
 
@@ -315,10 +326,12 @@ class Rename
         PhysRegIdPtr prevPhysReg;
     };
 
-    /** A per-thread list of all destination register renames, used to either
-     * undo rename mappings or free old physical registers.
+    /** A per-thread buffer of all destination register renames, used to
+     * either undo rename mappings or free old physical registers. New
+     * renames are added at the back, so squashes undo them from the back
+     * and commits retire them from the front.
      */
-    std::list<RenameHistory> historyBuffer[MaxThreads];
+    std::deque<RenameHistory> historyBuffer[MaxThreads];
 
     /** Pointer to CPU. */
     CPU *cpu;
@@ -41,10 +41,12 @@
 #ifndef __CPU_O3_ROB_HH__
 #define __CPU_O3_ROB_HH__
 
+#include <list>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -72,7 +74,7 @@ class ROB
 {
   public:
     typedef std::pair<RegIndex, RegIndex> UnmapInfo;
-    typedef typename std::list<DynInstPtr>::iterator InstIt;
+    typedef typename CircularQueue<DynInstPtr>::iterator InstIt;
 
     /** Possible ROB statuses. */
     enum Status
@@ -159,6 +161,11 @@ class ROB
     /** Is the oldest instruction across a particular thread ready. */
     bool isHeadReady(ThreadID tid);
 
+    /** Accounts for the head being read by commit in each cycle the CPU
+     *  skipped while the head wasn't ready.
+     */
+    void skipHeadReads(Cycles cycles) { stats.reads += cycles; }
+
     /** Is there any commitable head instruction across all threads ready. */
     bool canCommit();
 
@@ -285,8 +292,11 @@ class ROB
     /** Max Insts a Thread Can Have in the ROB */
     unsigned maxEntries[MaxThreads];
 
-    /** ROB List of Instructions */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** ROB List of Instructions. Each thread's list is a ring buffer large
+     *  enough to hold the whole ROB, so inserting and retiring never
+     *  allocate.
+     */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** Number of instructions that can be squashed in a single cycle. */
     unsigned squashWidth;
@@ -294,7 +304,8 @@ class ROB
   public:
     /** Iterator pointing to the instruction which is the last instruction
      *  in the ROB.  This may at times be invalid (ie when the ROB is empty),
-     *  however it should never be incorrect.
+     *  however it should never be incorrect.  An invalid iterator is a
+     *  default constructed InstIt.
      */
     InstIt tail;
 
@@ -308,7 +319,8 @@ class ROB
      *  when squashing, the instructions are marked as squashed but not
      *  immediately removed, meaning the tail iterator remains the same before
      *  and after a squash.
-     *  This will always be set to cpu->instList.end() if it is invalid.
+     *  This will always be set to a default constructed InstIt if it is
+     *  invalid.
      */
     InstIt squashIt[MaxThreads];
 
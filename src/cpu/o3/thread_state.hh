@@ -43,6 +43,7 @@
 
 #include <memory>
 
+#include "cpu/inst_count_event_queue.hh"
 #include "cpu/thread_context.hh"
 #include "cpu/thread_state.hh"
 
@@ -71,7 +72,7 @@ class ThreadState : public gem5::ThreadState
      * An instruction-based event queue. Used for scheduling events based on
      * number of instructions committed.
      */
-    EventQueue comInstEventQueue;
+    InstCountEventQueue comInstEventQueue;
 
     /* This variable controls if writes to a thread context should cause a all
      * dynamic/speculative state to be thrown away. Nominally this is the
@@ -41,7 +41,7 @@
 namespace gem5
 {
 
-PCEventQueue::PCEventQueue()
+PCEventQueue::PCEventQueue() : pageFilter(FilterBits / 64, 0)
 {}
 
 PCEventQueue::~PCEventQueue()
@@ -64,14 +64,19 @@ PCEventQueue::remove(PCEvent *event)
         }
     }
 
+    if (removed)
+        rebuildFilter();
+
     return removed > 0;
 }
 
 bool
 PCEventQueue::schedule(PCEvent *event)
 {
-    pcMap.push_back(event);
-    std::sort(pcMap.begin(), pcMap.end(), MapCompare());
+    // Events at the same PC are serviced in the order they were scheduled.
+    pcMap.insert(std::upper_bound(pcMap.begin(), pcMap.end(), event->pc(),
+                                  MapCompare()), event);
+    addToFilter(event->pc());
 
     DPRINTF(PCEvent, "PC based event scheduled for %#x: %s\n",
             event->pc(), event->descr());
@@ -79,6 +84,21 @@ PCEventQueue::schedule(PCEvent *event)
     return true;
 }
 
+void
+PCEventQueue::addToFilter(Addr pc)
+{
+    const unsigned index = filterIndex(pc);
+    pageFilter[index / 64] |= uint64_t(1) << (index % 64);
+}
+
+void
+PCEventQueue::rebuildFilter()
+{
+    std::fill(pageFilter.begin(), pageFilter.end(), 0);
+    for (const auto *event : pcMap)
+        addToFilter(event->pc());
+}
+
 bool
 PCEventQueue::doService(Addr pc, ThreadContext *tc)
 {
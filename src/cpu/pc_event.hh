@@ -29,6 +29,7 @@
 #ifndef __PC_EVENT_HH__
 #define __PC_EVENT_HH__
 
+#include <cstdint>
 #include <vector>
 
 #include "base/logging.hh"
@@ -106,17 +107,49 @@ class PCEventQueue : public PCEventScope
   protected:
     Map pcMap;
 
+    /**
+     * A filter of the pages with events, checked before looking up the
+     * events of a PC. It has one bit per hash of a page number, so a set
+     * bit may mean another page has an event, but a clear bit always
+     * means the page has none. Events are rarely removed, so the filter
+     * is rebuilt from the remaining events when they are.
+     */
+    static constexpr unsigned FilterPageShift = 12;
+    static constexpr unsigned FilterBits = 4096;
+    std::vector<uint64_t> pageFilter;
+
+    static unsigned
+    filterIndex(Addr pc)
+    {
+        const Addr page = pc >> FilterPageShift;
+        return (page ^ (page >> 12) ^ (page >> 24)) & (FilterBits - 1);
+    }
+
+    void addToFilter(Addr pc);
+    void rebuildFilter();
+
     bool doService(Addr pc, ThreadContext *tc);
 
   public:
     PCEventQueue();
     ~PCEventQueue();
 
+    /**
+     * Whether the page of pc may have events. CPUs can use this to skip
+     * looking up the events of the instructions of a page.
+     */
+    bool
+    pageMayHaveEvents(Addr pc) const
+    {
+        const unsigned index = filterIndex(pc);
+        return (pageFilter[index / 64] >> (index % 64)) & 1;
+    }
+
     bool remove(PCEvent *event) override;
     bool schedule(PCEvent *event) override;
     bool service(Addr pc, ThreadContext *tc)
     {
-        if (pcMap.empty())
+        if (!pageMayHaveEvents(pc))
             return false;
 
         return doService(pc, tc);
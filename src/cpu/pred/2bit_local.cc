@@ -140,5 +140,17 @@ LocalBP::uncondBranch(ThreadID tid, Addr pc, void *&bp_history)
 {
 }
 
+void
+LocalBP::saveWarmState(CheckpointOut &cp) const
+{
+    saveWarmCounters(cp, "localCtrs", localCtrs);
+}
+
+void
+LocalBP::loadWarmState(CheckpointIn &cp)
+{
+    loadWarmCounters(cp, "localCtrs", localCtrs);
+}
+
 } // namespace branch_prediction
 } // namespace gem5
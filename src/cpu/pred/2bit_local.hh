@@ -100,6 +100,9 @@ class LocalBP : public BPredUnit
     void squash(ThreadID tid, void *bp_history)
     { assert(bp_history == NULL); }
 
+    void saveWarmState(CheckpointOut &cp) const override;
+    void loadWarmState(CheckpointIn &cp) override;
+
   private:
     /**
      *  Returns the taken/not taken prediction given the value of the
@@ -28,6 +28,7 @@
 from m5.SimObject import SimObject
 from m5.params import *
 from m5.proxy import *
+from m5.objects.ReplacementPolicies import *
 
 
 class IndirectPredictor(SimObject):
@@ -65,6 +66,10 @@ class BranchPredictor(SimObject):
     numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
     BTBEntries = Param.Unsigned(4096, "Number of BTB entries")
     BTBTagSize = Param.Unsigned(16, "Size of the BTB tags, in bits")
+    BTBAssoc = Param.Unsigned(1, "Associativity of the BTB")
+    BTBReplPolicy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of a set associative BTB"
+    )
     RASSize = Param.Unsigned(16, "RAS size")
     instShiftAmt = Param.Unsigned(2, "Number of bits to shift instructions by")
 
@@ -73,6 +78,12 @@ class BranchPredictor(SimObject):
         "Indirect branch predictor, set to NULL to disable indirect predictions",
     )
 
+    shadowPredictors = VectorParam.BranchPredictor(
+        [],
+        "Predictors trained with the committed branches, on helper threads, "
+        "to evaluate them alongside this one",
+    )
+
 
 class LocalBP(BranchPredictor):
     type = "LocalBP"
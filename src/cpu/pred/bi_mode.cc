@@ -224,6 +224,22 @@ BiModeBP::update(ThreadID tid, Addr branchAddr, bool taken, void *bpHistory,
     delete history;
 }
 
+void
+BiModeBP::saveWarmState(CheckpointOut &cp) const
+{
+    saveWarmCounters(cp, "choiceCounters", choiceCounters);
+    saveWarmCounters(cp, "takenCounters", takenCounters);
+    saveWarmCounters(cp, "notTakenCounters", notTakenCounters);
+}
+
+void
+BiModeBP::loadWarmState(CheckpointIn &cp)
+{
+    loadWarmCounters(cp, "choiceCounters", choiceCounters);
+    loadWarmCounters(cp, "takenCounters", takenCounters);
+    loadWarmCounters(cp, "notTakenCounters", notTakenCounters);
+}
+
 void
 BiModeBP::updateGlobalHistReg(ThreadID tid, bool taken)
 {
@@ -68,6 +68,9 @@ class BiModeBP : public BPredUnit
     void update(ThreadID tid, Addr branch_addr, bool taken, void *bp_history,
                 bool squashed, const StaticInstPtr & inst, Addr corrTarget);
 
+    void saveWarmState(CheckpointOut &cp) const override;
+    void loadWarmState(CheckpointIn &cp) override;
+
   private:
     void updateGlobalHistReg(ThreadID tid, bool taken);
 
@@ -46,6 +46,7 @@
 
 #include "arch/generic/pcstate.hh"
 #include "base/compiler.hh"
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/Branch.hh"
 
@@ -62,7 +63,9 @@ BPredUnit::BPredUnit(const Params &params)
       BTB(params.BTBEntries,
           params.BTBTagSize,
           params.instShiftAmt,
-          params.numThreads),
+          params.numThreads,
+          params.BTBAssoc,
+          params.BTBReplPolicy),
       RAS(numThreads),
       iPred(params.indirectBranchPred),
       stats(this),
@@ -70,6 +73,21 @@ BPredUnit::BPredUnit(const Params &params)
 {
     for (auto& r : RAS)
         r.init(params.RASSize);
+
+    if (!params.shadowPredictors.empty()) {
+        for (auto *shadow : params.shadowPredictors) {
+            fatal_if(shadow == this || shadow->shadowOf,
+                     "%s can't be a shadow predictor of %s.",
+                     shadow->name(), name());
+            fatal_if(shadow->shadows,
+                     "Shadow predictor %s has shadow predictors.",
+                     shadow->name());
+            shadow->shadowOf = this;
+            shadow->shadowStats.reset(new ShadowStats(shadow));
+        }
+        shadows.reset(new ShadowPredictors(name() + ".shadows",
+                                           params.shadowPredictors));
+    }
 }
 
 BPredUnit::BPredUnitStats::BPredUnitStats(statistics::Group *parent)
@@ -103,6 +121,22 @@ BPredUnit::BPredUnitStats::BPredUnitStats(statistics::Group *parent)
     BTBHitRatio.precision(6);
 }
 
+BPredUnit::ShadowStats::ShadowStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(committedBranches, statistics::units::Count::get(),
+               "Number of committed branches the shadow predictor was "
+               "trained with"),
+      ADD_STAT(committedMispredicted, statistics::units::Count::get(),
+               "Number of committed branches the shadow predictor would "
+               "have mispredicted"),
+      ADD_STAT(committedMispredictRate, statistics::units::Ratio::get(),
+               "Fraction of committed branches the shadow predictor would "
+               "have mispredicted",
+               committedMispredicted / committedBranches)
+{
+    committedMispredictRate.precision(6);
+}
+
 probing::PMUUPtr
 BPredUnit::pmuProbePoint(const char *name)
 {
@@ -119,6 +153,32 @@ BPredUnit::regProbePoints()
     ppMisses = pmuProbePoint("Misses");
 }
 
+DrainState
+BPredUnit::drain()
+{
+    // The helper threads must not outlive a drain, as the simulator may
+    // be forked or checkpointed
+    if (shadows)
+        shadows->stop();
+    return DrainState::Drained;
+}
+
+void
+BPredUnit::preDumpStats()
+{
+    if (shadows)
+        shadows->flush();
+    SimObject::preDumpStats();
+}
+
+void
+BPredUnit::resetStats()
+{
+    if (shadows)
+        shadows->flush();
+    SimObject::resetStats();
+}
+
 void
 BPredUnit::drainSanityCheck() const
 {
@@ -172,6 +232,8 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
 
     PredictorHistory predict_record(seqNum, pc.instAddr(), pred_taken,
                                     bp_history, indirect_history, tid, inst);
+    if (shadows)
+        set(predict_record.branchPC, pc);
 
     // Now lookup in the BTB or RAS.
     if (pred_taken) {
@@ -284,6 +346,8 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
         inst->advancePC(*target);
     }
     predict_record.target = target->instAddr();
+    if (shadows)
+        set(predict_record.targetPC, *target);
 
     set(pc, *target);
 
@@ -306,6 +370,98 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
     return pred_taken;
 }
 
+bool
+BPredUnit::warmup(const StaticInstPtr &inst, const PCStateBase &pc,
+                  const PCStateBase &target, bool taken, ThreadID tid)
+{
+    assert(predHist[tid].empty());
+
+    // Only this branch is ever in flight
+    const InstSeqNum seq_num = 0;
+    const Addr branch_pc = pc.instAddr();
+    const Addr target_pc = target.instAddr();
+    const bool indirect =
+        iPred && !inst->isReturn() && !inst->isDirectCtrl();
+
+    void *bp_history = NULL;
+    void *indirect_history = NULL;
+
+    bool pred_taken = true;
+    if (inst->isUncondCtrl())
+        uncondBranch(tid, branch_pc, bp_history);
+    else
+        pred_taken = lookup(tid, branch_pc, bp_history);
+
+    // Find the target that would have been predicted, before anything
+    // is trained with the branch
+    bool target_found = pred_taken;
+    Addr pred_target = MaxAddr;
+    if (pred_taken) {
+        std::unique_ptr<PCStateBase> pred_pc(pc.clone());
+        if (inst->isReturn()) {
+            const PCStateBase *ras_top = RAS[tid].top();
+            if (ras_top)
+                set(pred_pc, inst->buildRetPC(pc, *ras_top));
+            else
+                inst->advancePC(*pred_pc);
+        } else if (!indirect) {
+            if (BTB.valid(branch_pc, tid))
+                set(pred_pc, BTB.lookup(branch_pc, tid));
+            else
+                target_found = false;
+        } else if (!iPred->lookup(branch_pc, *pred_pc, tid)) {
+            target_found = false;
+        }
+        pred_target = pred_pc->instAddr();
+    }
+    const bool correct =
+        target_found == taken && (!taken || pred_target == target_pc);
+
+    if (iPred) {
+        iPred->genIndirectInfo(tid, indirect_history);
+        if (indirect && taken) {
+            iPred->recordIndirect(branch_pc, target_pc, seq_num, tid);
+            iPred->recordTarget(seq_num, indirect_history, target, tid);
+        }
+        iPred->updateDirectionInfo(tid, taken);
+    }
+
+    DPRINTF(Branch, "[tid:%i] Warming up with branch %s, taken: %i, "
+            "predicted taken: %i, target: %s\n",
+            tid, pc, taken, pred_taken, target);
+
+    // Correct the speculative state of a mispredicted branch as a
+    // squash would, then commit the branch, which frees bp_history
+    if (pred_taken != taken)
+        update(tid, branch_pc, taken, bp_history, true, inst, target_pc);
+    update(tid, branch_pc, taken, bp_history, false, inst, target_pc);
+
+    if (iPred)
+        iPred->commit(seq_num, tid, indirect_history);
+
+    if (taken) {
+        // Note: The RAS may be both popped and pushed to
+        //       support coroutines.
+        if (inst->isReturn())
+            RAS[tid].pop();
+        if (inst->isCall())
+            RAS[tid].push(pc);
+        if (!inst->isReturn() && !indirect)
+            BTB.update(branch_pc, target, tid);
+    }
+
+    if (shadowStats) {
+        ++shadowStats->committedBranches;
+        if (!correct)
+            ++shadowStats->committedMispredicted;
+    }
+
+    if (shadows)
+        shadows->record(inst, pc, target, taken, tid);
+
+    return correct;
+}
+
 void
 BPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
 {
@@ -314,6 +470,12 @@ BPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
 
     while (!predHist[tid].empty() &&
            predHist[tid].back().seqNum <= done_sn) {
+        if (shadows) {
+            const auto &committed = predHist[tid].back();
+            shadows->record(committed.inst, *committed.branchPC,
+                            *committed.targetPC, committed.predTaken, tid);
+        }
+
         // Update the branch predictor with the correct results.
         update(tid, predHist[tid].back().pc,
                     predHist[tid].back().predTaken,
@@ -448,6 +610,8 @@ BPredUnit::squash(const InstSeqNum &squashed_sn,
         // Remember the correct direction for the update at commit.
         pred_hist.front().predTaken = actually_taken;
         pred_hist.front().target = corr_target.instAddr();
+        if (shadows)
+            set(pred_hist.front().targetPC, corr_target);
 
         update(tid, (*hist_it).pc, actually_taken,
                pred_hist.front().bpHistory, true, pred_hist.front().inst,
@@ -541,5 +705,38 @@ BPredUnit::dump()
     }
 }
 
+void
+BPredUnit::saveWarmCounters(CheckpointOut &cp, const std::string &name,
+                            const std::vector<SatCounter8> &table)
+{
+    std::vector<uint8_t> values(table.begin(), table.end());
+    arrayParamOut(cp, name, values);
+}
+
+void
+BPredUnit::loadWarmCounters(CheckpointIn &cp, const std::string &name,
+                            std::vector<SatCounter8> &table)
+{
+    if (!cp.entryExists(Serializable::currentSection(), name))
+        return;
+
+    std::vector<uint8_t> values;
+    arrayParamIn(cp, name, values);
+
+    if (values.size() != table.size()) {
+        warn("%s: Warm state table %s has %d entries, expected %d. "
+             "Leaving it cold.\n", this->name(), name, values.size(),
+             table.size());
+        return;
+    }
+
+    for (size_t i = 0; i < table.size(); ++i) {
+        // Counters saturate, so clearing and adding back the saved
+        // value clamps it to this table's counter width.
+        table[i] -= uint8_t(table[i]);
+        table[i] += values[i];
+    }
+}
+
 } // namespace branch_prediction
 } // namespace gem5
@@ -43,12 +43,17 @@
 #define __CPU_PRED_BPRED_UNIT_HH__
 
 #include <deque>
+#include <memory>
+#include <string>
+#include <vector>
 
+#include "base/sat_counter.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/pred/btb.hh"
 #include "cpu/pred/indirect.hh"
 #include "cpu/pred/ras.hh"
+#include "cpu/pred/shadow_predictors.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/static_inst.hh"
 #include "params/BranchPredictor.hh"
@@ -76,6 +81,14 @@ class BPredUnit : public SimObject
 
     void regProbePoints() override;
 
+    /** Stop the shadow predictors' helper threads. */
+    DrainState drain() override;
+
+    /** Wait for the shadow predictors to catch up before the stats are
+     * dumped or reset. */
+    void preDumpStats() override;
+    void resetStats() override;
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
@@ -90,6 +103,23 @@ class BPredUnit : public SimObject
     bool predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
                  PCStateBase &pc, ThreadID tid);
 
+    /**
+     * Train the predictor with a committed branch, as when warming it up
+     * functionally. The direction predictor, BTB, RAS and indirect
+     * predictor are updated as if the branch was predicted and committed
+     * right away, without keeping any history for squashes. There must
+     * not be any branches in flight, and the stats are left untouched.
+     * The branch is passed on to the shadow predictors, if any.
+     * @param inst The branch instruction.
+     * @param pc The PC of the branch.
+     * @param target The PC following the branch.
+     * @param taken Whether the branch was taken.
+     * @param tid The thread id.
+     * @return Whether the branch would have been predicted correctly.
+     */
+    bool warmup(const StaticInstPtr &inst, const PCStateBase &pc,
+                const PCStateBase &target, bool taken, ThreadID tid);
+
     // @todo: Rename this function.
     virtual void uncondBranch(ThreadID tid, Addr pc, void * &bp_history) = 0;
 
@@ -223,6 +253,8 @@ class BPredUnit : public SimObject
             target(other.target), inst(other.inst)
         {
             set(RASTarget, other.RASTarget);
+            set(branchPC, other.branchPC);
+            set(targetPC, other.targetPC);
         }
 
         bool
@@ -279,6 +311,11 @@ class BPredUnit : public SimObject
 
         /** The branch instrction */
         const StaticInstPtr inst;
+
+        /** The PC of the branch and the PC following it, only kept for
+         * the shadow predictors. */
+        std::unique_ptr<PCStateBase> branchPC;
+        std::unique_ptr<PCStateBase> targetPC;
     };
 
     typedef std::deque<PredictorHistory> History;
@@ -336,10 +373,54 @@ class BPredUnit : public SimObject
         statistics::Scalar indirectMispredicted;
     } stats;
 
+    /** The shadow predictors trained with the committed branches. */
+    std::unique_ptr<ShadowPredictors> shadows;
+
+    /** The predictor this is a shadow predictor of, if any. */
+    BPredUnit *shadowOf = nullptr;
+
+    struct ShadowStats : public statistics::Group
+    {
+        ShadowStats(statistics::Group *parent);
+
+        /** Stat for number of committed branches trained with. */
+        statistics::Scalar committedBranches;
+        /** Stat for number of those that would have been mispredicted. */
+        statistics::Scalar committedMispredicted;
+        /** Stat for the fraction of committed branches mispredicted. */
+        statistics::Formula committedMispredictRate;
+    };
+
+    /** The stats of a shadow predictor, only created for shadows. */
+    std::unique_ptr<ShadowStats> shadowStats;
+
   protected:
     /** Number of bits to shift instructions by for predictor addresses. */
     const unsigned instShiftAmt;
 
+    /**
+     * Write a table of saturating counters to a warm state snapshot.
+     *
+     * @param cp Snapshot section to write to.
+     * @param name Name of the table within the section.
+     * @param table Counters to save.
+     */
+    static void saveWarmCounters(CheckpointOut &cp, const std::string &name,
+                                 const std::vector<SatCounter8> &table);
+
+    /**
+     * Restore a table of saturating counters from a warm state
+     * snapshot. A table of a different size, e.g. one saved from a
+     * predictor with another geometry, is ignored with a warning and
+     * the counters are left cold.
+     *
+     * @param cp Snapshot section to read from.
+     * @param name Name of the table within the section.
+     * @param table Counters to restore.
+     */
+    void loadWarmCounters(CheckpointIn &cp, const std::string &name,
+                          std::vector<SatCounter8> &table);
+
     /**
      * @{
      * @name PMU Probe points.
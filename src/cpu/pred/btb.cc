@@ -31,6 +31,7 @@
 #include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/Fetch.hh"
+#include "mem/cache/replacement_policies/base.hh"
 
 namespace gem5
 {
@@ -41,8 +42,12 @@ namespace branch_prediction
 DefaultBTB::DefaultBTB(unsigned _numEntries,
                        unsigned _tagBits,
                        unsigned _instShiftAmt,
-                       unsigned _num_threads)
-    : numEntries(_numEntries),
+                       unsigned _num_threads,
+                       unsigned _assoc,
+                       replacement_policy::Base *_repl_policy)
+    : replPolicy(_assoc > 1 ? _repl_policy : nullptr),
+      numEntries(_numEntries),
+      assoc(_assoc),
       tagBits(_tagBits),
       instShiftAmt(_instShiftAmt),
       log2NumThreads(floorLog2(_num_threads))
@@ -53,17 +58,36 @@ DefaultBTB::DefaultBTB(unsigned _numEntries,
         fatal("BTB entries is not a power of 2!");
     }
 
+    if (assoc == 0 || !isPowerOf2(assoc) || assoc > numEntries) {
+        fatal("BTB associativity must be a power of 2 no larger than the "
+              "number of entries!");
+    }
+
+    if (assoc > 1 && !replPolicy) {
+        fatal("A set associative BTB needs a replacement policy!");
+    }
+
     btb.resize(numEntries);
 
     for (unsigned i = 0; i < numEntries; ++i) {
         btb[i].valid = false;
     }
 
-    idxMask = numEntries - 1;
+    numSets = numEntries / assoc;
+
+    if (replPolicy) {
+        replEntries.resize(numEntries);
+        for (unsigned i = 0; i < numEntries; ++i) {
+            replEntries[i].setPosition(i / assoc, i % assoc);
+            replEntries[i].replacementData = replPolicy->instantiateEntry();
+        }
+    }
+
+    idxMask = numSets - 1;
 
     tagMask = (1 << tagBits) - 1;
 
-    tagShiftAmt = instShiftAmt + floorLog2(numEntries);
+    tagShiftAmt = instShiftAmt + floorLog2(numSets);
 }
 
 void
@@ -71,6 +95,9 @@ DefaultBTB::reset()
 {
     for (unsigned i = 0; i < numEntries; ++i) {
         btb[i].valid = false;
+        btb[i].fullTarget.reset();
+        if (replPolicy)
+            replPolicy->invalidate(replEntries[i].replacementData);
     }
 }
 
@@ -91,22 +118,52 @@ DefaultBTB::getTag(Addr instPC)
     return (instPC >> tagShiftAmt) & tagMask;
 }
 
-bool
-DefaultBTB::valid(Addr instPC, ThreadID tid)
+int
+DefaultBTB::findEntry(Addr instPC, ThreadID tid)
 {
-    unsigned btb_idx = getIndex(instPC, tid);
+    const unsigned first = getIndex(instPC, tid) * assoc;
+    const Addr inst_tag = getTag(instPC);
 
-    Addr inst_tag = getTag(instPC);
+    assert(first + assoc <= numEntries);
 
-    assert(btb_idx < numEntries);
+    for (unsigned i = first; i < first + assoc; ++i) {
+        if (btb[i].valid
+            && inst_tag == btb[i].tag
+            && btb[i].tid == tid) {
+            return i;
+        }
+    }
+    return -1;
+}
 
-    if (btb[btb_idx].valid
-        && inst_tag == btb[btb_idx].tag
-        && btb[btb_idx].tid == tid) {
-        return true;
-    } else {
-        return false;
+int
+DefaultBTB::findTemplate(const PCStateBase &target)
+{
+    // Only a target that setting its own address reproduces can be
+    // rebuilt from the address and a template
+    set(scratchTarget, target);
+    scratchTarget->set(target.instAddr());
+    if (!scratchTarget->equals(target))
+        return -1;
+
+    for (unsigned i = 0; i < targetTemplates.size(); ++i) {
+        set(scratchTarget, *targetTemplates[i]);
+        scratchTarget->set(target.instAddr());
+        if (scratchTarget->equals(target))
+            return i;
     }
+
+    if (targetTemplates.size() == maxTargetTemplates)
+        return -1;
+
+    targetTemplates.emplace_back(target.clone());
+    return targetTemplates.size() - 1;
+}
+
+bool
+DefaultBTB::valid(Addr instPC, ThreadID tid)
+{
+    return findEntry(instPC, tid) >= 0;
 }
 
 // @todo Create some sort of return struct that has both whether or not the
@@ -115,32 +172,64 @@ DefaultBTB::valid(Addr instPC, ThreadID tid)
 const PCStateBase *
 DefaultBTB::lookup(Addr inst_pc, ThreadID tid)
 {
-    unsigned btb_idx = getIndex(inst_pc, tid);
+    const int idx = findEntry(inst_pc, tid);
+    if (idx < 0)
+        return nullptr;
 
-    Addr inst_tag = getTag(inst_pc);
+    BTBEntry &entry = btb[idx];
+    if (replPolicy)
+        replPolicy->touch(replEntries[idx].replacementData);
 
-    assert(btb_idx < numEntries);
+    if (entry.fullTarget)
+        return entry.fullTarget.get();
 
-    if (btb[btb_idx].valid
-        && inst_tag == btb[btb_idx].tag
-        && btb[btb_idx].tid == tid) {
-        return btb[btb_idx].target.get();
-    } else {
-        return nullptr;
-    }
+    set(lookupTarget, *targetTemplates[entry.templateIdx]);
+    lookupTarget->set(entry.target);
+    return lookupTarget.get();
 }
 
 void
 DefaultBTB::update(Addr inst_pc, const PCStateBase &target, ThreadID tid)
 {
-    unsigned btb_idx = getIndex(inst_pc, tid);
+    int idx = findEntry(inst_pc, tid);
+
+    if (idx >= 0) {
+        if (replPolicy)
+            replPolicy->touch(replEntries[idx].replacementData);
+    } else {
+        // Fill an invalid way if there is one, otherwise ask the
+        // replacement policy for a victim
+        const unsigned first = getIndex(inst_pc, tid) * assoc;
+        for (unsigned i = first; i < first + assoc && idx < 0; ++i) {
+            if (!btb[i].valid)
+                idx = i;
+        }
+        if (idx < 0) {
+            assert(replPolicy);
+            ReplacementCandidates candidates;
+            for (unsigned i = first; i < first + assoc; ++i)
+                candidates.push_back(&replEntries[i]);
+            idx = first + replPolicy->getVictim(candidates)->getWay();
+        }
+        if (replPolicy)
+            replPolicy->reset(replEntries[idx].replacementData);
+    }
 
-    assert(btb_idx < numEntries);
+    assert(idx >= 0 && idx < numEntries);
 
-    btb[btb_idx].tid = tid;
-    btb[btb_idx].valid = true;
-    set(btb[btb_idx].target, target);
-    btb[btb_idx].tag = getTag(inst_pc);
+    BTBEntry &entry = btb[idx];
+    entry.tid = tid;
+    entry.valid = true;
+    entry.tag = getTag(inst_pc);
+    entry.target = target.instAddr();
+
+    const int template_idx = findTemplate(target);
+    if (template_idx >= 0) {
+        entry.templateIdx = template_idx;
+        entry.fullTarget.reset();
+    } else {
+        set(entry.fullTarget, target);
+    }
 }
 
 } // namespace branch_prediction
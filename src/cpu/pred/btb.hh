@@ -29,13 +29,22 @@
 #ifndef __CPU_PRED_BTB_HH__
 #define __CPU_PRED_BTB_HH__
 
+#include <memory>
+#include <vector>
+
 #include "arch/generic/pcstate.hh"
 #include "base/logging.hh"
 #include "base/types.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 
 namespace gem5
 {
 
+namespace replacement_policy
+{
+    class Base;
+} // namespace replacement_policy
+
 namespace branch_prediction
 {
 
@@ -47,12 +56,21 @@ class DefaultBTB
         /** The entry's tag. */
         Addr tag = 0;
 
-        /** The entry's target. */
-        std::unique_ptr<PCStateBase> target;
+        /** The address of the entry's target. */
+        Addr target = 0;
+
+        /**
+         * The entry's full target, only kept when it can't be rebuilt
+         * from the target address and a target template.
+         */
+        std::unique_ptr<PCStateBase> fullTarget;
 
         /** The entry's thread id. */
         ThreadID tid;
 
+        /** The target template the target is rebuilt from. */
+        uint8_t templateIdx = 0;
+
         /** Whether or not the entry is valid. */
         bool valid = false;
     };
@@ -63,16 +81,21 @@ class DefaultBTB
      *  @param numEntries Number of entries for the BTB.
      *  @param tagBits Number of bits for each tag in the BTB.
      *  @param instShiftAmt Offset amount for instructions to ignore alignment.
+     *  @param assoc Associativity of the BTB.
+     *  @param replPolicy Replacement policy, only used if assoc > 1.
      */
     DefaultBTB(unsigned numEntries, unsigned tagBits,
-               unsigned instShiftAmt, unsigned numThreads);
+               unsigned instShiftAmt, unsigned numThreads,
+               unsigned assoc = 1,
+               replacement_policy::Base *replPolicy = nullptr);
 
     void reset();
 
     /** Looks up an address in the BTB. Must call valid() first on the address.
      *  @param inst_PC The address of the branch to look up.
      *  @param tid The thread id.
-     *  @return Returns the target of the branch.
+     *  @return Returns the target of the branch, which is only valid until
+     *  the next lookup.
      */
     const PCStateBase *lookup(Addr instPC, ThreadID tid);
 
@@ -91,9 +114,9 @@ class DefaultBTB
     void update(Addr inst_pc, const PCStateBase &target_pc, ThreadID tid);
 
   private:
-    /** Returns the index into the BTB, based on the branch's PC.
+    /** Returns the set of the BTB, based on the branch's PC.
      *  @param inst_PC The branch to look up.
-     *  @return Returns the index into the BTB.
+     *  @return Returns the set of the BTB.
      */
     inline unsigned getIndex(Addr instPC, ThreadID tid);
 
@@ -103,12 +126,55 @@ class DefaultBTB
      */
     inline Addr getTag(Addr instPC);
 
-    /** The actual BTB. */
+    /** Returns the valid entry of a branch, if there is one.
+     *  @param inst_PC The branch's address.
+     *  @param tid The thread id.
+     *  @return Returns the entry's position in the BTB, or -1.
+     */
+    int findEntry(Addr instPC, ThreadID tid);
+
+    /** Finds the template a target can be rebuilt from, adding one if
+     *  there is room.
+     *  @param target The target.
+     *  @return Returns the template's index, or -1 if there is none.
+     */
+    int findTemplate(const PCStateBase &target);
+
+    /** The actual BTB, with the ways of each set next to each other. */
     std::vector<BTBEntry> btb;
 
+    /** The replacement data of the entries, if assoc > 1. */
+    std::vector<ReplaceableEntry> replEntries;
+
+    /** The replacement policy, if assoc > 1. */
+    replacement_policy::Base *replPolicy;
+
+    /**
+     * The targets of the entries are rebuilt from their address and one
+     * of these, which only differ in the fields that setting the address
+     * doesn't reset. There are normally only a few, e.g. one per
+     * instruction set.
+     */
+    std::vector<std::unique_ptr<PCStateBase>> targetTemplates;
+
+    /** The maximum number of target templates. */
+    static const unsigned maxTargetTemplates = 256;
+
+    /** Scratch state used to check targets against the templates. */
+    std::unique_ptr<PCStateBase> scratchTarget;
+
+    /** The target rebuilt by the last lookup. */
+    std::unique_ptr<PCStateBase> lookupTarget;
+
     /** The number of entries in the BTB. */
     unsigned numEntries;
 
+    /** The associativity of the BTB. */
+    unsigned assoc;
+
+    /** The number of sets in the BTB. */
+    unsigned numSets;
+
     /** The index mask. */
     unsigned idxMask;
 
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/shadow_predictors.hh"
+
+#include <algorithm>
+
+#include "cpu/pred/bpred_unit.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+ShadowPredictors::ShadowPredictors(const std::string &name,
+                                   const std::vector<BPredUnit *> &shadows)
+    : Named(name)
+{
+    for (auto *shadow : shadows) {
+        workers.emplace_back(new Worker(
+                    shadow->name() + ".shadow_queue", shadow));
+    }
+}
+
+ShadowPredictors::~ShadowPredictors()
+{
+    stop();
+}
+
+void
+ShadowPredictors::record(const StaticInstPtr &inst, const PCStateBase &pc,
+                         const PCStateBase &target, bool taken,
+                         ThreadID tid)
+{
+    if (!batch) {
+        batch.reset(new Batch);
+        batch->branches.reserve(batchSize);
+    }
+
+    batch->branches.push_back(
+        {inst, std::unique_ptr<PCStateBase>(pc.clone()),
+         std::unique_ptr<PCStateBase>(target.clone()), taken, tid});
+    batch->tick = curTick();
+
+    if (batch->branches.size() == batchSize)
+        dispatch();
+}
+
+void
+ShadowPredictors::dispatch()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (auto &worker : workers) {
+        if (!worker->thread.joinable()) {
+            Worker *w = worker.get();
+            worker->thread = std::thread([this, w] { workerLoop(*w); });
+        }
+    }
+
+    // Wait for the workers to catch up if they are too far behind
+    changed.wait(lock, [this] {
+        return std::all_of(workers.begin(), workers.end(),
+                [this](const auto &w) {
+                    return dispatched - w->done < maxInFlight;
+                });
+    });
+
+    inFlight.push_back(std::move(batch));
+    ++dispatched;
+    changed.notify_all();
+
+    release();
+}
+
+void
+ShadowPredictors::release()
+{
+    uint64_t min_done = dispatched;
+    for (auto &worker : workers)
+        min_done = std::min(min_done, worker->done);
+
+    while (released < min_done) {
+        inFlight.pop_front();
+        ++released;
+    }
+}
+
+void
+ShadowPredictors::flush()
+{
+    if (batch && !batch->branches.empty())
+        dispatch();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this] {
+        return std::all_of(workers.begin(), workers.end(),
+                [this](const auto &w) { return w->done == dispatched; });
+    });
+    release();
+}
+
+void
+ShadowPredictors::stop()
+{
+    flush();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+
+    for (auto &worker : workers) {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+    stopping = false;
+}
+
+void
+ShadowPredictors::workerLoop(Worker &worker)
+{
+    // Trace output of the shadows is stamped with the tick the
+    // branches were recorded at
+    curEventQueue(&worker.queue);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        changed.wait(lock, [this, &worker] {
+            return stopping || worker.done < dispatched;
+        });
+        if (worker.done == dispatched)
+            return;
+
+        // The batch can't be freed until this worker is done with it
+        const Batch &batch = *inFlight[worker.done - released];
+        lock.unlock();
+
+        worker.queue.setCurTick(batch.tick);
+        for (const auto &branch : batch.branches) {
+            worker.shadow->warmup(branch.inst, *branch.pc, *branch.target,
+                                  branch.taken, branch.tid);
+        }
+
+        lock.lock();
+        ++worker.done;
+        changed.notify_all();
+    }
+}
+
+} // namespace branch_prediction
+} // namespace gem5
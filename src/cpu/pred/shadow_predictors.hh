@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_SHADOW_PREDICTORS_HH__
+#define __CPU_PRED_SHADOW_PREDICTORS_HH__
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/named.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+class BPredUnit;
+
+/**
+ * The shadow predictors of a branch predictor. They are trained with the
+ * branches the predictor commits, see BPredUnit::warmup(), and only keep
+ * their own stats, so that several predictors can be compared in a
+ * single run. Each shadow is evaluated on its own host thread, with the
+ * branches handed over in batches.
+ *
+ * A batch, and the static instructions it holds on to, is only ever
+ * freed by the simulation thread, as the reference counts are not
+ * atomic. The workers are stopped when the simulation drains, and are
+ * restarted when the next batch is handed over, as a fork only
+ * duplicates the forking thread.
+ */
+class ShadowPredictors : public Named
+{
+  public:
+    ShadowPredictors(const std::string &name,
+                     const std::vector<BPredUnit *> &shadows);
+    ~ShadowPredictors();
+
+    /**
+     * Record a committed branch for the shadows to be trained with.
+     * @param inst The branch instruction.
+     * @param pc The PC of the branch.
+     * @param target The PC following the branch.
+     * @param taken Whether the branch was taken.
+     * @param tid The thread id.
+     */
+    void record(const StaticInstPtr &inst, const PCStateBase &pc,
+                const PCStateBase &target, bool taken, ThreadID tid);
+
+    /** Wait until the shadows have been trained with every branch. */
+    void flush();
+
+    /** Flush, and stop the worker threads until the next batch. */
+    void stop();
+
+  private:
+    struct Branch
+    {
+        StaticInstPtr inst;
+        std::unique_ptr<PCStateBase> pc;
+        std::unique_ptr<PCStateBase> target;
+        bool taken;
+        ThreadID tid;
+    };
+
+    struct Batch
+    {
+        std::vector<Branch> branches;
+
+        /// The tick the last branch was recorded at
+        Tick tick = 0;
+    };
+
+    struct Worker
+    {
+        Worker(const std::string &name, BPredUnit *_shadow)
+            : shadow(_shadow), queue(name)
+        {}
+
+        BPredUnit *shadow;
+
+        /// Number of batches this worker has evaluated
+        uint64_t done = 0;
+
+        /// The queue the worker's curTick() is taken from
+        EventQueue queue;
+
+        std::thread thread;
+    };
+
+    /// Number of branches in a batch
+    static const size_t batchSize = 4096;
+
+    /// Number of batches the workers may be behind by
+    static const size_t maxInFlight = 8;
+
+    /** Hand the current batch over to the workers. */
+    void dispatch();
+
+    /** Free the batches every worker is done with. */
+    void release();
+
+    void workerLoop(Worker &worker);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// The batch being recorded
+    std::unique_ptr<Batch> batch;
+
+    /// The batches handed over and not yet freed, oldest first
+    std::deque<std::unique_ptr<Batch>> inFlight;
+
+    /// Number of batches freed
+    uint64_t released = 0;
+
+    /// Number of batches handed over
+    uint64_t dispatched = 0;
+
+    bool stopping = false;
+
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_SHADOW_PREDICTORS_HH__
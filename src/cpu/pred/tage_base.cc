@@ -37,6 +37,9 @@
 
 #include "cpu/pred/tage_base.hh"
 
+#include <algorithm>
+
+#include "base/bitfield.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "debug/Fetch.hh"
@@ -144,6 +147,30 @@ TAGEBase::init()
 
     tableIndices = new int [nHistoryTables+1];
     tableTags = new int [nHistoryTables+1];
+
+    fatal_if(nHistoryTables >= 64,
+             "TAGE supports at most 63 tagged tables, %d requested\n",
+             nHistoryTables);
+    noSkipMask = 0;
+    for (int i = 1; i <= nHistoryTables; i++) {
+        if (noSkip[i])
+            noSkipMask |= 1ULL << i;
+    }
+
+    indexMasks.resize(nHistoryTables + 1, 0);
+    indexPcShifts.resize(nHistoryTables + 1, 0);
+    indexSizeShifts.resize(nHistoryTables + 1, 0);
+    pathHistMasks.resize(nHistoryTables + 1, 0);
+    tagMasks.resize(nHistoryTables + 1, 0);
+    for (int i = 1; i <= nHistoryTables; i++) {
+        const int hlen = std::min(histLengths[i], (int)pathHistBits);
+        indexMasks[i] = (1ULL << logTagTableSizes[i]) - 1;
+        indexPcShifts[i] = abs(logTagTableSizes[i] - i) + 1;
+        indexSizeShifts[i] = logTagTableSizes[i] - i;
+        pathHistMasks[i] = (1ULL << hlen) - 1;
+        tagMasks[i] = (1ULL << tagTableTagWidths[i]) - 1;
+    }
+
     initialized = true;
 }
 
@@ -340,13 +367,38 @@ void
 TAGEBase::calculateIndicesAndTags(ThreadID tid, Addr branch_pc,
                                   BranchInfo* bi)
 {
-    // computes the table addresses and the partial tags
+    const ThreadHistory &tHist = threadHistory[tid];
+    const unsigned int shifted_pc = branch_pc >> instShiftAmt;
+    const int path_hist = tHist.pathHist;
+
+    // computes the table addresses and the partial tags, as gindex(),
+    // F() and gtag() do, for all the banks at once. There are no calls
+    // or branches in the loop, so the compiler can vectorize it
     for (int i = 1; i <= nHistoryTables; i++) {
-        tableIndices[i] = gindex(tid, branch_pc, i);
-        bi->tableIndices[i] = tableIndices[i];
-        tableTags[i] = gtag(tid, branch_pc, i);
-        bi->tableTags[i] = tableTags[i];
+        const int mask = indexMasks[i];
+        const int size_shift = indexSizeShifts[i];
+
+        int a = path_hist & pathHistMasks[i];
+        int a2 = a >> (size_shift + i);
+        a2 = ((a2 << i) & mask) + (a2 >> size_shift);
+        a = (a & mask) ^ a2;
+        a = ((a << i) & mask) + (a >> size_shift);
+
+        const unsigned int index = shifted_pc ^
+            (shifted_pc >> indexPcShifts[i]) ^
+            tHist.computeIndices[i].comp ^ a;
+        tableIndices[i] = index & mask;
+
+        const unsigned int tag = shifted_pc ^
+            tHist.computeTags[0][i].comp ^
+            (tHist.computeTags[1][i].comp << 1);
+        tableTags[i] = tag & tagMasks[i];
     }
+
+    std::copy(tableIndices + 1, tableIndices + nHistoryTables + 1,
+              bi->tableIndices + 1);
+    std::copy(tableTags + 1, tableTags + nHistoryTables + 1,
+              bi->tableTags + 1);
 }
 
 unsigned
@@ -370,25 +422,27 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
 
         bi->bimodalIndex = bindex(pc);
 
+        // Compare the tags of all the banks at once. The indices of
+        // the skipped banks are in range too, so reading them is fine
+        uint64_t hits = 0;
+        for (int i = 1; i <= nHistoryTables; i++) {
+            hits |= uint64_t(gtable[i][tableIndices[i]].tag ==
+                             tableTags[i]) << i;
+        }
+        hits &= noSkipMask;
+
         bi->hitBank = 0;
         bi->altBank = 0;
         //Look for the bank with longest matching history
-        for (int i = nHistoryTables; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->hitBank = i;
-                bi->hitBankIndex = tableIndices[bi->hitBank];
-                break;
-            }
+        if (hits) {
+            bi->hitBank = findMsbSet(hits);
+            bi->hitBankIndex = tableIndices[bi->hitBank];
+            hits &= ~(1ULL << bi->hitBank);
         }
         //Look for the alternate bank
-        for (int i = bi->hitBank - 1; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->altBank = i;
-                bi->altBankIndex = tableIndices[bi->altBank];
-                break;
-            }
+        if (hits) {
+            bi->altBank = findMsbSet(hits);
+            bi->altBankIndex = tableIndices[bi->altBank];
         }
         //computes the prediction and the alternate prediction
         if (bi->hitBank > 0) {
@@ -361,7 +361,10 @@ class TAGEBase : public SimObject
 
     /**
      * On a prediction, calculates the TAGE indices and tags for
-     * all the different history lengths
+     * all the different history lengths. This base implementation
+     * computes the hashes of gindex(), gtag() and F() for all the banks
+     * in a single loop, rather than calling them bank by bank, so a
+     * class overriding any of them must override this as well.
      */
     virtual void calculateIndicesAndTags(
         ThreadID tid, Addr branch_pc, BranchInfo* bi);
@@ -485,6 +488,22 @@ class TAGEBase : public SimObject
     // Some other classes use this for handling associativity
     std::vector<bool> noSkip;
 
+    /// noSkip as a bit mask, with bit i set if table i is active
+    uint64_t noSkipMask;
+
+    /**
+     * The per bank constants of the index and tag hashes, stored as
+     * arrays for calculateIndicesAndTags() to compute the hashes of
+     * all the banks at once.
+     * @{
+     */
+    std::vector<int> indexMasks;
+    std::vector<int> indexPcShifts;
+    std::vector<int> indexSizeShifts;
+    std::vector<int> pathHistMasks;
+    std::vector<int> tagMasks;
+    /** @} */
+
     const bool speculativeHistUpdate;
 
     const unsigned instShiftAmt;
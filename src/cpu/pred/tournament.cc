@@ -349,6 +349,37 @@ TournamentBP::squash(ThreadID tid, void *bp_history)
     delete history;
 }
 
+void
+TournamentBP::saveWarmState(CheckpointOut &cp) const
+{
+    saveWarmCounters(cp, "localCtrs", localCtrs);
+    saveWarmCounters(cp, "globalCtrs", globalCtrs);
+    saveWarmCounters(cp, "choiceCtrs", choiceCtrs);
+    SERIALIZE_CONTAINER(localHistoryTable);
+}
+
+void
+TournamentBP::loadWarmState(CheckpointIn &cp)
+{
+    loadWarmCounters(cp, "localCtrs", localCtrs);
+    loadWarmCounters(cp, "globalCtrs", globalCtrs);
+    loadWarmCounters(cp, "choiceCtrs", choiceCtrs);
+
+    if (!cp.entryExists(Serializable::currentSection(), "localHistoryTable"))
+        return;
+
+    std::vector<unsigned> local_history;
+    arrayParamIn(cp, "localHistoryTable", local_history);
+    if (local_history.size() == localHistoryTable.size()) {
+        for (size_t i = 0; i < local_history.size(); ++i)
+            localHistoryTable[i] = local_history[i] & localPredictorMask;
+    } else {
+        warn("%s: Warm state local history table has %d entries, "
+             "expected %d. Leaving it cold.\n", name(),
+             local_history.size(), localHistoryTable.size());
+    }
+}
+
 #ifdef GEM5_DEBUG
 int
 TournamentBP::BPHistory::newCount = 0;
@@ -117,6 +117,9 @@ class TournamentBP : public BPredUnit
      */
     void squash(ThreadID tid, void *bp_history);
 
+    void saveWarmState(CheckpointOut &cp) const override;
+    void loadWarmState(CheckpointIn &cp) override;
+
   private:
     /**
      * Returns if the branch should be taken or not, given a counter
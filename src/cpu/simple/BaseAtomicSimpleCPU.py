@@ -61,6 +61,30 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    decoded_block_cache_size = Param.Unsigned(
+        0,
+        "Number of decoded instruction blocks to cache (power of 2, 0 "
+        "disables the cache). Instructions executed from the cache don't "
+        "access the instruction port.",
+    )
+    decoded_block_max_insts = Param.Unsigned(
+        64, "Maximum number of instructions in a decoded block"
+    )
+    threaded_dispatch = Param.Bool(
+        False,
+        "Chain the instructions replayed from the decoded block cache. "
+        "Interrupts and PC events are only checked when the CPU leaves a "
+        "block, and the CPU keeps running without returning to the event "
+        "queue until another event is due. Requires the decoded block "
+        "cache.",
+    )
+    branch_pred_warmup = Param.Bool(
+        False,
+        "Only train the branch predictor with the committed branches, "
+        "rather than predicting every branch and updating or squashing the "
+        "prediction, e.g., to warm it up cheaply while fast-forwarding. The "
+        "branch prediction stats are not updated.",
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
@@ -41,3 +41,12 @@ class BaseTimingSimpleCPU(BaseSimpleCPU):
     @classmethod
     def support_take_over(cls):
         return True
+
+    backdoor_fetch = Param.Bool(
+        False,
+        "Read instruction bytes straight from host memory and only model "
+        "the fetch latency, except for pages written by CPUs",
+    )
+    backdoor_fetch_latency = Param.Cycles(
+        1, "Latency of instruction fetches served from host memory"
+    )
@@ -44,6 +44,7 @@
 #include "arch/generic/decoder.hh"
 #include "base/output.hh"
 #include "cpu/exetrace.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/utils.hh"
 #include "debug/Drain.hh"
 #include "debug/ExecFaulting.hh"
@@ -78,16 +79,25 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      threadedDispatch(p.threaded_dispatch),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
     _status = Idle;
-    ifetch_req = std::make_shared<Request>();
-    data_read_req = std::make_shared<Request>();
-    data_write_req = std::make_shared<Request>();
-    data_amo_req = std::make_shared<Request>();
+    branchPredWarmup = p.branch_pred_warmup;
+    if (p.decoded_block_cache_size) {
+        blockCache = std::make_unique<DecodedBlockCache>(this,
+                p.decoded_block_cache_size, p.decoded_block_max_insts);
+    }
+    fatal_if(threadedDispatch && !blockCache,
+             "%s: Threaded dispatch requires the decoded block cache.",
+             name());
+    ifetch_req = Request::make();
+    data_read_req = Request::make();
+    data_write_req = Request::make();
+    data_amo_req = Request::make();
 }
 
 
@@ -150,6 +160,10 @@ AtomicSimpleCPU::drainResume()
 
     assert(!threadContexts.empty());
 
+    // Memory might have changed behind our back while drained.
+    if (blockCache)
+        blockCache->flush();
+
     _status = BaseSimpleCPU::Idle;
 
     for (ThreadID tid = 0; tid < numThreads; tid++) {
@@ -298,6 +312,8 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
             t_info->thread->getIsaPtr()->handleLockedSnoop(pkt,
                     cacheBlockMask);
         }
+        if (cpu->blockCache)
+            cpu->blockCache->written(pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -325,6 +341,9 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
                     cacheBlockMask);
         }
     }
+
+    if (cpu->blockCache && (pkt->isInvalidate() || pkt->isWrite()))
+        cpu->blockCache->written(pkt->getAddr(), pkt->getSize());
 }
 
 bool
@@ -495,6 +514,10 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                 Packet pkt(req, Packet::makeWriteCmd(req));
                 pkt.dataStatic(data);
 
+                if (blockCache)
+                    blockCache->written(req->getPaddr(), req->getSize());
+                FetchBackdoor::written(req->getPaddr(), req->getSize());
+
                 if (req->isLocalAccess()) {
                     dcache_latency +=
                         req->localAccessor(thread->getTC(), &pkt);
@@ -586,6 +609,10 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
         Packet pkt(req, Packet::makeWriteCmd(req));
         pkt.dataStatic(data);
 
+        if (blockCache)
+            blockCache->written(req->getPaddr(), req->getSize());
+        FetchBackdoor::written(req->getPaddr(), req->getSize());
+
         if (req->isLocalAccess()) {
             dcache_latency += req->localAccessor(thread->getTC(), &pkt);
         } else {
@@ -626,6 +653,51 @@ AtomicSimpleCPU::tick()
     }
 
     SimpleExecContext &t_info = *threadInfo[curThread];
+
+    Tick latency;
+    while (true) {
+        latency = executeCycle(t_info);
+
+        // We must have just got suspended by a PC event
+        if (latency == MaxTick)
+            return;
+
+        if (tryCompleteDrain())
+            return;
+
+        // instruction takes at least one cycle
+        if (latency < clockPeriod())
+            latency = clockPeriod();
+
+        // With threaded dispatch, keep executing the decoded blocks for
+        // as long as no other event is due.
+        if (!canChain(latency))
+            break;
+        setCurTick(curTick() + latency);
+    }
+
+    if (_status != Idle)
+        reschedule(tickEvent, curTick() + latency, true);
+}
+
+bool
+AtomicSimpleCPU::canChain(Tick latency) const
+{
+    if (!threadedDispatch || !blockCache->replaying() ||
+            _status != BaseSimpleCPU::Running || numThreads > 1 ||
+            locked || drainState() != DrainState::Running) {
+        return false;
+    }
+
+    // Only run ahead if nothing else has to happen until then,
+    // including events at the same tick with a higher priority.
+    return eventQueue()->empty() ||
+        curTick() + latency < eventQueue()->nextTick();
+}
+
+Tick
+AtomicSimpleCPU::executeCycle(SimpleExecContext &t_info)
+{
     SimpleThread *thread = t_info.thread;
 
     Tick latency = 0;
@@ -634,15 +706,25 @@ AtomicSimpleCPU::tick()
         baseStats.numCycles++;
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
-        if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
-            checkForInterrupts();
+        // In threaded dispatch, interrupts and PC events are only checked
+        // when entering and leaving decoded blocks. The PC event filter
+        // is still checked, so events in the page of a block are serviced.
+        const bool in_block = threadedDispatch &&
+            blockCache->continues(thread->pcState()) &&
+            !thread->pcEventQueue.pageMayHaveEvents(
+                    thread->pcState().instAddr());
+
+        if (!in_block &&
+                (!curStaticInst || !curStaticInst->isDelayedCommit())) {
+            if (checkForInterrupts() && blockCache)
+                blockCache->stop();
             checkPcEventQueue();
         }
 
         // We must have just got suspended by a PC event
         if (_status == Idle) {
             tryCompleteDrain();
-            return;
+            return MaxTick;
         }
 
         serviceInstCountEvents();
@@ -652,11 +734,25 @@ AtomicSimpleCPU::tick()
         const PCStateBase &pc = thread->pcState();
 
         bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
+        const DecodedBlockCache::Inst *cached_inst = nullptr;
         if (needToFetch) {
-            ifetch_req->taskId(taskId());
-            setupFetchRequest(ifetch_req);
-            fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
-                                                 BaseMMU::Execute);
+            const bool first_fetch = t_info.fetchOffset == 0;
+            if (blockCache && first_fetch) {
+                blockCache->checkDecoder(thread->decoder);
+                cached_inst = blockCache->next(pc);
+            }
+
+            if (!cached_inst) {
+                ifetch_req->taskId(taskId());
+                setupFetchRequest(ifetch_req);
+                fault = thread->mmu->translateAtomic(ifetch_req,
+                        thread->getTC(), BaseMMU::Execute);
+                if (blockCache && fault == NoFault) {
+                    cached_inst = blockCache->fetched(
+                            ifetch_req->getVaddr(), ifetch_req->getPaddr(),
+                            ifetch_req->getSize(), pc, first_fetch);
+                }
+            }
         }
 
         if (fault == NoFault) {
@@ -664,7 +760,7 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            if (needToFetch && !cached_inst) {
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -677,11 +773,20 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (cached_inst) {
+                preExecute(cached_inst->staticInst, *cached_inst->decodedPC);
+            } else {
+                preExecute();
+                if (blockCache && needToFetch && !t_info.stayAtPC) {
+                    blockCache->decoded(thread->pcState(),
+                            curMacroStaticInst ? curMacroStaticInst :
+                                                 curStaticInst);
+                }
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
-                fault = curStaticInst->execute(&t_info, traceData);
+                fault = curStaticInst->executeSimple(&t_info, traceData);
 
                 // keep an instruction count
                 if (fault == NoFault) {
@@ -700,6 +805,11 @@ AtomicSimpleCPU::tick()
                 }
 
                 postExecute();
+
+                if (blockCache && (fault != NoFault ||
+                            DecodedBlockCache::endsBlock(curStaticInst))) {
+                    blockCache->stop();
+                }
             }
 
             // @todo remove me after debugging with legion done
@@ -722,20 +832,14 @@ AtomicSimpleCPU::tick()
                     clockPeriod();
             }
 
+        } else if (blockCache) {
+            blockCache->stop();
         }
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
 
-    if (tryCompleteDrain())
-        return;
-
-    // instruction takes at least one cycle
-    if (latency < clockPeriod())
-        latency = clockPeriod();
-
-    if (_status != Idle)
-        reschedule(tickEvent, curTick() + latency, true);
+    return latency;
 }
 
 Tick
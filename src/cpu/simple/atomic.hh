@@ -41,7 +41,10 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <memory>
+
 #include "cpu/simple/base.hh"
+#include "cpu/simple/decoded_block_cache.hh"
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
@@ -67,9 +70,35 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
 
+    /**
+     * Cache of decoded instruction blocks, if enabled. Instructions
+     * replayed from it skip the fetch from the instruction port.
+     */
+    std::unique_ptr<DecodedBlockCache> blockCache;
+
+    /**
+     * Skip the per instruction checks while replaying decoded blocks,
+     * and keep running them without rescheduling the tick event.
+     */
+    const bool threadedDispatch;
+
     // main simulation loop (one cycle)
     void tick();
 
+    /**
+     * Can the CPU start its next cycle after the given latency right
+     * away, rather than rescheduling its tick event?
+     */
+    bool canChain(Tick latency) const;
+
+    /**
+     * Execute the instructions of one cycle.
+     *
+     * @return The latency of the cycle, or MaxTick if the CPU got
+     * suspended.
+     */
+    Tick executeCycle(SimpleExecContext &t_info);
+
     /**
      * Check if a system is in a drained state.
      *
@@ -141,7 +170,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     {
 
       public:
-        AtomicCPUDPort(const std::string &_name, BaseSimpleCPU *_cpu)
+        AtomicCPUDPort(const std::string &_name, AtomicSimpleCPU *_cpu)
             : AtomicCPUPort(_name), cpu(_cpu)
         {
             cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -151,7 +180,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
         Addr cacheBlockMask;
       protected:
-        BaseSimpleCPU *cpu;
+        AtomicSimpleCPU *cpu;
 
         virtual Tick recvAtomicSnoop(PacketPtr pkt);
         virtual void recvFunctionalSnoop(PacketPtr pkt);
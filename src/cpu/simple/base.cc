@@ -84,6 +84,7 @@ BaseSimpleCPU::BaseSimpleCPU(const BaseSimpleCPUParams &p)
     : BaseCPU(p),
       curThread(0),
       branchPred(p.branchPred),
+      branchPredWarmup(false),
       traceData(NULL),
       _status(Idle)
 {
@@ -269,7 +270,7 @@ BaseSimpleCPU::traceFault()
     }
 }
 
-void
+bool
 BaseSimpleCPU::checkForInterrupts()
 {
     SimpleExecContext&t_info = *threadInfo[curThread];
@@ -288,15 +289,17 @@ BaseSimpleCPU::checkForInterrupts()
                 DPRINTF(HtmCpu, "Deferring pending interrupt - %s -"
                     "due to transactional state\n",
                     interrupt->name());
-                return;
+                return false;
             }
 
             t_info.fetchOffset = 0;
             interrupts[curThread]->updateIntrInfo();
             interrupt->invoke(tc);
             thread->decoder->reset();
+            return true;
         }
     }
+    return false;
 }
 
 
@@ -334,20 +337,20 @@ BaseSimpleCPU::preExecute()
     t_info.setPredicate(true);
     t_info.setMemAccPredicate(true);
 
-    // decode the instruction
-    set(preExecuteTempPC, thread->pcState());
-    auto &pc_state = *preExecuteTempPC;
-
     auto &decoder = thread->decoder;
+    const MicroPC upc = thread->pcState().microPC();
 
-    if (isRomMicroPC(pc_state.microPC())) {
+    if (isRomMicroPC(upc)) {
         t_info.stayAtPC = false;
-        curStaticInst = decoder->fetchRomMicroop(
-                pc_state.microPC(), curMacroStaticInst);
+        curStaticInst = decoder->fetchRomMicroop(upc, curMacroStaticInst);
     } else if (!curMacroStaticInst) {
         //We're not in the middle of a macro instruction
         StaticInstPtr instPtr = NULL;
 
+        // decode the instruction
+        set(preExecuteTempPC, thread->pcState());
+        auto &pc_state = *preExecuteTempPC;
+
         //Predecode, ie bundle up an ExtMachInst
         //If more fetch data is needed, pass it in.
         Addr fetch_pc =
@@ -370,16 +373,48 @@ BaseSimpleCPU::preExecute()
         //out micro ops
         if (instPtr && instPtr->isMacroop()) {
             curMacroStaticInst = instPtr;
-            curStaticInst =
-                curMacroStaticInst->fetchMicroop(pc_state.microPC());
+            curStaticInst = curMacroStaticInst->microop(pc_state.microPC());
         } else {
             curStaticInst = instPtr;
         }
     } else {
         //Read the next micro op from the macro op
-        curStaticInst = curMacroStaticInst->fetchMicroop(pc_state.microPC());
+        curStaticInst = curMacroStaticInst->microop(upc);
     }
 
+    startInst();
+}
+
+void
+BaseSimpleCPU::preExecute(const StaticInstPtr &inst,
+                          const PCStateBase &decoded_pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
+    // resets predicates
+    t_info.setPredicate(true);
+    t_info.setMemAccPredicate(true);
+
+    t_info.stayAtPC = false;
+    thread->pcState(decoded_pc);
+
+    if (inst->isMacroop()) {
+        curMacroStaticInst = inst;
+        curStaticInst = inst->microop(decoded_pc.microPC());
+    } else {
+        curStaticInst = inst;
+    }
+
+    startInst();
+}
+
+void
+BaseSimpleCPU::startInst()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
     //If we decoded an instruction this "tick", record information about it.
     if (curStaticInst) {
 #if TRACING_ON
@@ -394,12 +429,14 @@ BaseSimpleCPU::preExecute()
         // instruction in flight at the same time.
         const InstSeqNum cur_sn(0);
         set(t_info.predPC, thread->pcState());
-        const bool predict_taken(
-            branchPred->predict(curStaticInst, cur_sn, *t_info.predPC,
-                curThread));
+        if (!branchPredWarmup) {
+            const bool predict_taken(
+                branchPred->predict(curStaticInst, cur_sn, *t_info.predPC,
+                    curThread));
 
-        if (predict_taken)
-            ++t_info.execContextStats.numPredictedBranches;
+            if (predict_taken)
+                ++t_info.execContextStats.numPredictedBranches;
+        }
     }
 
     // increment the fetch instruction stat counters
@@ -511,7 +548,15 @@ BaseSimpleCPU::advancePC(const Fault &fault)
         }
     }
 
-    if (branchPred && curStaticInst && curStaticInst->isControl()) {
+    if (branchPred && curStaticInst && curStaticInst->isControl() &&
+        branchPredWarmup) {
+        // The PC of the branch is kept in predPC, and a faulting branch
+        // doesn't commit
+        if (fault == NoFault) {
+            branchPred->warmup(curStaticInst, *t_info.predPC,
+                    thread->pcState(), branching, curThread);
+        }
+    } else if (branchPred && curStaticInst && curStaticInst->isControl()) {
         // Use a fake sequence number since we only have one
         // instruction in flight at the same time.
         const InstSeqNum cur_sn(0);
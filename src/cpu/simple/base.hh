@@ -86,6 +86,12 @@ class BaseSimpleCPU : public BaseCPU
     ThreadID curThread;
     branch_prediction::BPredUnit *branchPred;
 
+    /**
+     * Only train branchPred with the committed branches, see
+     * BPredUnit::warmup(), rather than predicting them.
+     */
+    bool branchPredWarmup;
+
     void checkPcEventQueue();
     void swapActiveThread();
 
@@ -132,11 +138,29 @@ class BaseSimpleCPU : public BaseCPU
 
     std::unique_ptr<PCStateBase> preExecuteTempPC;
 
+    /** Trace, predict and count the instruction about to execute. */
+    void startInst();
+
   public:
-    void checkForInterrupts();
+    /**
+     * Take any pending interrupt.
+     *
+     * @return True if an interrupt was taken.
+     */
+    bool checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
     void preExecute();
+
+    /**
+     * Prepare the execution of an instruction decoded earlier instead of
+     * decoding it from the fetched bytes.
+     *
+     * @param inst The decoded (macro) instruction.
+     * @param decoded_pc The PC state the decoder produced for it.
+     */
+    void preExecute(const StaticInstPtr &inst,
+                    const PCStateBase &decoded_pc);
     void postExecute();
     void advancePC(const Fault &fault);
 
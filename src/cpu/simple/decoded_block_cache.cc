@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/decoded_block_cache.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+DecodedBlockCache::DecodedBlockCache(statistics::Group *parent,
+                                     unsigned num_blocks,
+                                     unsigned max_block_size)
+    : blocks(num_blocks), maxBlockSize(max_block_size), stats(parent)
+{
+    fatal_if(!isPowerOf2(num_blocks),
+             "The number of decoded blocks (%d) must be a power of 2.",
+             num_blocks);
+    fatal_if(max_block_size == 0,
+             "Decoded blocks must hold at least one instruction.");
+}
+
+void
+DecodedBlockCache::flush()
+{
+    ++generation;
+    codePages.reset();
+    stop();
+    ++stats.flushes;
+}
+
+const DecodedBlockCache::Inst *
+DecodedBlockCache::fetched(Addr vaddr, Addr paddr, unsigned size,
+                           const PCStateBase &pc, bool first)
+{
+    replay = nullptr;
+
+    if (record) {
+        if ((vaddr >> PageShift) != record->vpage ||
+                ((vaddr + size - 1) >> PageShift) != record->vpage) {
+            // Crossing into another page, the block ends here.
+            stop();
+        } else if (first) {
+            if (record->insts.size() == record->size)
+                record->insts.emplace_back();
+            set(record->insts[record->size].pc, pc);
+            recordPending = true;
+            return nullptr;
+        } else {
+            return nullptr;
+        }
+    }
+
+    if (!first)
+        return nullptr;
+
+    Block &block = blockFor(paddr);
+    if (block.generation == generation && block.paddr == paddr &&
+            block.size && *block.insts[0].pc == pc) {
+        ++stats.hits;
+        ++stats.replayedInsts;
+        replay = &block;
+        replayIdx = 1;
+        return &block.insts[0];
+    }
+
+    ++stats.misses;
+    // Don't start blocks that would straddle a page boundary.
+    if (((vaddr + size - 1) >> PageShift) != (vaddr >> PageShift))
+        return nullptr;
+
+    block.paddr = paddr;
+    block.vpage = vaddr >> PageShift;
+    block.generation = generation;
+    block.size = 0;
+    if (block.insts.empty())
+        block.insts.emplace_back();
+    set(block.insts[0].pc, pc);
+    codePages.set((paddr >> PageShift) % codePages.size());
+
+    record = &block;
+    recordPending = true;
+    return nullptr;
+}
+
+DecodedBlockCache::DecodedBlockCacheStats::DecodedBlockCacheStats(
+        statistics::Group *parent)
+    : statistics::Group(parent, "decodedBlockCache"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of decoded block lookups that hit"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of decoded block lookups that missed"),
+      ADD_STAT(replayedInsts, statistics::units::Count::get(),
+               "Number of instructions replayed from decoded blocks"),
+      ADD_STAT(flushes, statistics::units::Count::get(),
+               "Number of times the decoded block cache was flushed"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Hit rate of decoded block lookups",
+               hits / (hits + misses))
+{
+}
+
+} // namespace gem5
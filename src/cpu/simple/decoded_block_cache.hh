@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arch/generic/decoder.hh"
+#include "arch/generic/pcstate.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of decoded instruction traces for CPU models that fetch and
+ * execute one instruction at a time.
+ *
+ * A block is a sequence of decoded instructions that were executed one
+ * after the other, starting at a given physical fetch address. Every
+ * instruction is stored together with the PC state it was decoded at,
+ * and replaying a block only continues while the PC state of the thread
+ * matches the one of the next instruction of the block. This makes it
+ * safe for blocks to continue across branches (superblocks). All the
+ * instructions of a block live in the same page as its first one, so a
+ * single translation is needed to start replaying a block.
+ *
+ * The cache is flushed when a write hits a page holding a cached block,
+ * and when the context of the decoder changes.
+ */
+class DecodedBlockCache
+{
+  public:
+    /** Blocks never span more than the smallest supported page. */
+    static constexpr unsigned PageShift = 12;
+
+    struct Inst
+    {
+        /** PC state before decoding the instruction. */
+        std::unique_ptr<PCStateBase> pc;
+        /** PC state the decoder left behind. */
+        std::unique_ptr<PCStateBase> decodedPC;
+        /** The decoded (macro) instruction. */
+        StaticInstPtr staticInst;
+    };
+
+  private:
+    struct Block
+    {
+        /** Physical address of the first fetch of the block. */
+        Addr paddr = MaxAddr;
+        /** Virtual page of the block. */
+        Addr vpage = 0;
+        /** The block is valid if this matches the cache's generation. */
+        uint64_t generation = 0;
+        unsigned size = 0;
+        std::vector<Inst> insts;
+    };
+
+    std::vector<Block> blocks;
+    const unsigned maxBlockSize;
+
+    /** Incremented on flushes to invalidate all the blocks at once. */
+    uint64_t generation = 1;
+
+    /** Decoder and decoding context the blocks were recorded with. */
+    const InstDecoder *decoder = nullptr;
+    uint64_t contextVersion = 0;
+
+    /** Filter of the physical pages that hold cached blocks. */
+    std::bitset<4096> codePages;
+
+    /** Block being replayed and the index of its next instruction. */
+    const Block *replay = nullptr;
+    unsigned replayIdx = 0;
+
+    /** Block being recorded, if any. */
+    Block *record = nullptr;
+    /** Has the PC of the instruction being recorded been captured? */
+    bool recordPending = false;
+
+    struct DecodedBlockCacheStats : public statistics::Group
+    {
+        DecodedBlockCacheStats(statistics::Group *parent);
+
+        statistics::Scalar hits;
+        statistics::Scalar misses;
+        statistics::Scalar replayedInsts;
+        statistics::Scalar flushes;
+        statistics::Formula hitRate;
+    } stats;
+
+    Block &
+    blockFor(Addr paddr)
+    {
+        return blocks[(paddr >> 2 ^ paddr >> PageShift) &
+                      (blocks.size() - 1)];
+    }
+
+  public:
+    /**
+     * @param parent Statistics group of the owning CPU.
+     * @param num_blocks Number of blocks, must be a power of 2.
+     * @param max_block_size Maximum number of instructions in a block.
+     */
+    DecodedBlockCache(statistics::Group *parent, unsigned num_blocks,
+                      unsigned max_block_size);
+
+    /** Invalidate all the blocks. */
+    void flush();
+
+    /**
+     * Make sure the cached blocks were decoded in the context the given
+     * decoder is currently in, and flush them otherwise.
+     */
+    void
+    checkDecoder(const InstDecoder *dec)
+    {
+        if (GEM5_UNLIKELY(dec != decoder ||
+                          dec->contextVersion() != contextVersion)) {
+            flush();
+            decoder = dec;
+            contextVersion = dec->contextVersion();
+        }
+    }
+
+    /**
+     * Get the next instruction of the block being replayed.
+     *
+     * @param pc The current PC state of the thread.
+     * @return The instruction, or nullptr if the thread left the block.
+     */
+    const Inst *
+    next(const PCStateBase &pc)
+    {
+        if (!replay)
+            return nullptr;
+        if (replayIdx < replay->size && *replay->insts[replayIdx].pc == pc) {
+            ++stats.replayedInsts;
+            return &replay->insts[replayIdx++];
+        }
+        replay = nullptr;
+        return nullptr;
+    }
+
+    /**
+     * Will the thread continue replaying the current block, i.e., is
+     * the next instruction of the block at the given PC state?
+     */
+    bool
+    continues(const PCStateBase &pc) const
+    {
+        return replay && replayIdx < replay->size &&
+            *replay->insts[replayIdx].pc == pc;
+    }
+
+    /** Is a block being replayed? */
+    bool replaying() const { return replay; }
+
+    /**
+     * Note an instruction fetch that has been translated. If it starts a
+     * new block, look the block up, and start recording it if it isn't
+     * cached.
+     *
+     * @param vaddr Virtual address of the fetch.
+     * @param paddr Physical address of the fetch.
+     * @param size Size of the fetch.
+     * @param pc The current PC state of the thread.
+     * @param first Is this the first fetch of the instruction?
+     * @return The first instruction of the block on a hit.
+     */
+    const Inst *fetched(Addr vaddr, Addr paddr, unsigned size,
+                        const PCStateBase &pc, bool first);
+
+    /**
+     * Record the instruction at the PC last passed to fetched() once it
+     * has been decoded.
+     *
+     * @param decoded_pc The PC state after decoding.
+     * @param inst The decoded (macro) instruction.
+     */
+    void
+    decoded(const PCStateBase &decoded_pc, const StaticInstPtr &inst)
+    {
+        if (!record || !recordPending)
+            return;
+        Inst &entry = record->insts[record->size++];
+        set(entry.decodedPC, decoded_pc);
+        entry.staticInst = inst;
+        recordPending = false;
+        if (record->size == maxBlockSize)
+            record = nullptr;
+    }
+
+    /**
+     * Stop replaying and recording blocks. This must be called whenever
+     * the thread might not continue with the next instruction in memory
+     * in the same context, e.g., on faults, interrupts or instructions
+     * that serialize the pipeline.
+     */
+    void
+    stop()
+    {
+        replay = nullptr;
+        record = nullptr;
+        recordPending = false;
+    }
+
+    /** Does this instruction have to end the block it is in? */
+    static bool
+    endsBlock(const StaticInstPtr &inst)
+    {
+        return inst->isSerializing() || inst->isNonSpeculative() ||
+            inst->isSquashAfter() ||
+            inst->isSyscall() || inst->isHtmCmd();
+    }
+
+    /**
+     * Handle a write to physical memory, flushing the cache if the write
+     * might have modified a cached block.
+     */
+    void
+    written(Addr paddr, unsigned size)
+    {
+        if (size == 0)
+            return;
+        const Addr last = (paddr + size - 1) >> PageShift;
+        for (Addr page = paddr >> PageShift; page <= last; ++page) {
+            if (codePages[page % codePages.size()]) {
+                flush();
+                return;
+            }
+        }
+    }
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
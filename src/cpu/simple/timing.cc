@@ -76,9 +76,13 @@ TimingSimpleCPU::TimingCPUPort::TickEvent::schedule(PacketPtr _pkt, Tick t)
 TimingSimpleCPU::TimingSimpleCPU(const BaseTimingSimpleCPUParams &p)
     : BaseSimpleCPU(p), fetchTranslation(this), icachePort(this),
       dcachePort(this), ifetch_pkt(NULL), dcache_pkt(NULL), previousCycle(0),
-      fetchEvent([this]{ fetch(); }, name())
+      fetchEvent([this]{ fetch(); }, name()),
+      backdoorFetchLatency(p.backdoor_fetch_latency)
 {
     _status = Idle;
+
+    if (p.backdoor_fetch)
+        fetchBackdoor = std::make_unique<FetchBackdoor>(*p.system);
 }
 
 
@@ -286,6 +290,8 @@ TimingSimpleCPU::handleReadPacket(PacketPtr pkt)
         _status = DcacheRetry;
         dcache_pkt = pkt;
     } else {
+        if (pkt->isWrite())
+            FetchBackdoor::written(pkt->getAddr(), pkt->getSize());
         _status = DcacheWaitResponse;
         // memory system takes ownership of packet
         dcache_pkt = NULL;
@@ -463,7 +469,7 @@ TimingSimpleCPU::initiateMemRead(Addr addr, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId(), pc, thread->contextId());
     req->setByteEnable(byte_enable);
 
@@ -514,6 +520,7 @@ TimingSimpleCPU::handleWritePacket()
     } else if (!dcachePort.sendTimingReq(dcache_pkt)) {
         _status = DcacheRetry;
     } else {
+        FetchBackdoor::written(dcache_pkt->getAddr(), dcache_pkt->getSize());
         _status = DcacheWaitResponse;
         // memory system takes ownership of packet
         dcache_pkt = NULL;
@@ -545,7 +552,7 @@ TimingSimpleCPU::writeMem(uint8_t *data, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId(), pc, thread->contextId());
     req->setByteEnable(byte_enable);
 
@@ -601,7 +608,7 @@ TimingSimpleCPU::initiateMemAMO(Addr addr, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(addr, size, flags,
+    RequestPtr req = Request::make(addr, size, flags,
                             dataRequestorId(), pc, thread->contextId(),
                             std::move(amo_op));
 
@@ -698,7 +705,7 @@ TimingSimpleCPU::fetch()
 
     if (needToFetch) {
         _status = BaseSimpleCPU::Running;
-        RequestPtr ifetch_req = std::make_shared<Request>();
+        RequestPtr ifetch_req = Request::make();
         ifetch_req->taskId(taskId());
         ifetch_req->setContext(thread->contextId());
         setupFetchRequest(ifetch_req);
@@ -728,7 +735,16 @@ TimingSimpleCPU::sendFetch(const Fault &fault, const RequestPtr &req,
         ifetch_pkt->dataStatic(decoder->moreBytesPtr());
         DPRINTF(SimpleCPU, " -- pkt addr: %#x\n", ifetch_pkt->getAddr());
 
-        if (!icachePort.sendTimingReq(ifetch_pkt)) {
+        if (fetchBackdoor && fetchBackdoor->read(req->getPaddr(),
+                    decoder->moreBytesPtr(), req->getSize())) {
+            // The fetch was served from host memory, only model its
+            // latency.
+            ifetch_pkt->makeResponse();
+            _status = IcacheWaitResponse;
+            icachePort.completeLocally(ifetch_pkt,
+                    clockEdge(backdoorFetchLatency));
+            ifetch_pkt = NULL;
+        } else if (!icachePort.sendTimingReq(ifetch_pkt)) {
             // Need to wait for retry
             _status = IcacheRetry;
         } else {
@@ -873,7 +889,7 @@ TimingSimpleCPU::completeIfetch(PacketPtr pkt)
         }
     } else if (curStaticInst) {
         // non-memory instruction: execute completely now
-        Fault fault = curStaticInst->execute(&t_info, traceData);
+        Fault fault = curStaticInst->executeSimple(&t_info, traceData);
 
         // keep an instruction count
         if (fault == NoFault)
@@ -1244,7 +1260,7 @@ TimingSimpleCPU::initiateMemMgmtCmd(Request::Flags flags)
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId());
 
     req->setPC(pc);
@@ -1299,7 +1315,7 @@ TimingSimpleCPU::htmSendAbortSignal(ThreadID tid, uint64_t htm_uid,
 
     // notify l1 d-cache (ruby) that core has aborted transaction
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId());
 
     req->setPC(pc);
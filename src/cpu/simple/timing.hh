@@ -41,7 +41,10 @@
 #ifndef __CPU_SIMPLE_TIMING_HH__
 #define __CPU_SIMPLE_TIMING_HH__
 
+#include <memory>
+
 #include "arch/generic/mmu.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
 #include "cpu/translation.hh"
@@ -211,6 +214,20 @@ class TimingSimpleCPU : public BaseSimpleCPU
 
         ITickEvent tickEvent;
 
+      public:
+        /**
+         * Complete a fetch that was served without going through the
+         * memory system.
+         *
+         * @param pkt The fetch response.
+         * @param when When to deliver the response.
+         */
+        void
+        completeLocally(PacketPtr pkt, Tick when)
+        {
+            assert(!tickEvent.scheduled());
+            tickEvent.schedule(pkt, when);
+        }
     };
 
     class DcachePort : public TimingCPUPort
@@ -334,6 +351,11 @@ class TimingSimpleCPU : public BaseSimpleCPU
 
     EventFunctionWrapper fetchEvent;
 
+    /** Host memory to serve fetches from, if enabled. */
+    std::unique_ptr<FetchBackdoor> fetchBackdoor;
+    /** Latency of fetches served from host memory. */
+    const Cycles backdoorFetchLatency;
+
     struct IprEvent : Event
     {
         Packet *pkt;
@@ -51,6 +51,7 @@
 #include "arch/generic/tlb.hh"
 #include "base/logging.hh"
 #include "base/types.hh"
+#include "cpu/inst_count_event_queue.hh"
 #include "cpu/regfile.hh"
 #include "cpu/thread_context.hh"
 #include "cpu/thread_state.hh"
@@ -90,7 +91,7 @@ class CheckerCPU;
  * examples.
  */
 
-class SimpleThread : public ThreadState, public ThreadContext
+class SimpleThread final : public ThreadState, public ThreadContext
 {
   public:
     typedef ThreadContext::Status Status;
@@ -123,7 +124,7 @@ class SimpleThread : public ThreadState, public ThreadContext
      * An instruction-based event queue. Used for scheduling events based on
      * number of instructions committed.
      */
-    EventQueue comInstEventQueue;
+    InstCountEventQueue comInstEventQueue;
 
     System *system;
 
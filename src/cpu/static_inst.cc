@@ -30,11 +30,19 @@
 
 #include <iostream>
 
+#include "cpu/simple/exec_context.hh"
 #include "cpu/thread_context.hh"
 
 namespace gem5
 {
 
+Fault
+StaticInst::executeSimple(SimpleExecContext *xc,
+                          trace::InstRecord *traceData) const
+{
+    return execute(xc, traceData);
+}
+
 StaticInstPtr
 StaticInst::fetchMicroop(MicroPC upc) const
 {
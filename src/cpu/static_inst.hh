@@ -49,6 +49,7 @@
 #include <string>
 
 #include "arch/generic/pcstate.hh"
+#include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/refcnt.hh"
 #include "cpu/op_class.hh"
@@ -64,6 +65,7 @@ namespace gem5
 class Packet;
 
 class ExecContext;
+class SimpleExecContext;
 class ThreadContext;
 
 namespace loader
@@ -250,6 +252,21 @@ class StaticInst : public RefCounted, public StaticInstFlags
         _destRegIdxPtr = dest;
     }
 
+    /**
+     * Flat table of the microops of a macroop, indexed by micro PC.
+     * Macroops with a fixed sequence of microops install it so that
+     * CPUs can read them with microop() rather than fetchMicroop().
+     */
+    const StaticInstPtr *microopTable = nullptr;
+    unsigned numTableMicroops = 0;
+
+    void
+    setMicroopTable(const StaticInstPtr *table, unsigned num)
+    {
+        microopTable = table;
+        numTableMicroops = num;
+    }
+
     /**
      * Base mnemonic (e.g., "add").  Used by generateDisassembly()
      * methods.  Also useful to readily identify instructions from
@@ -285,6 +302,16 @@ class StaticInst : public RefCounted, public StaticInstFlags
     virtual Fault execute(ExecContext *xc,
             trace::InstRecord *traceData) const = 0;
 
+    /**
+     * Execute the instruction in one of the simple CPUs. Instructions
+     * that define their execute method as a template on the exec
+     * context override this to call it with the concrete exec context,
+     * which lets the compiler inline the register accesses. The others
+     * use the generic execute().
+     */
+    virtual Fault executeSimple(SimpleExecContext *xc,
+            trace::InstRecord *traceData) const;
+
     virtual Fault
     initiateAcc(ExecContext *xc, trace::InstRecord *traceData) const
     {
@@ -313,6 +340,19 @@ class StaticInst : public RefCounted, public StaticInstFlags
      */
     virtual StaticInstPtr fetchMicroop(MicroPC upc) const;
 
+    /**
+     * Return the microop that goes with a particular micropc. This reads
+     * the table of microops of the macroop if it has one, and only falls
+     * back to fetchMicroop() for the micropcs it doesn't cover.
+     */
+    StaticInstPtr
+    microop(MicroPC upc) const
+    {
+        if (GEM5_LIKELY(upc < numTableMicroops))
+            return microopTable[upc];
+        return fetchMicroop(upc);
+    }
+
     /**
      * Return the target address for a PC-relative branch.
      * Invalid if not a PC-relative branch (i.e. isDirectCtrl()
@@ -80,6 +80,7 @@ BaseTrafficGen::BaseTrafficGen(const BaseTrafficGenParams &p)
       retryPkt(NULL),
       retryPktTick(0), blockedWaitingResp(false),
       updateEvent([this]{ update(); }, name()),
+      numWaitingResp(0),
       stats(this),
       requestorId(system->getRequestorId(this)),
       streamGenerator(StreamGen::create(p))
@@ -177,44 +178,20 @@ BaseTrafficGen::update()
         transition();
     } else {
         assert(curTick() >= nextPacketTick);
-        // get the next packet and try to send it
-        PacketPtr pkt = activeGenerator->getNextPacket();
-
-        // If generating stream/substream IDs are enabled,
-        // try to pick and assign them to the new packet
-        if (streamGenerator) {
-            auto sid = streamGenerator->pickStreamID();
-            auto ssid = streamGenerator->pickSubstreamID();
-
-            pkt->req->setStreamId(sid);
-
-            if (streamGenerator->ssidValid()) {
-                pkt->req->setSubstreamId(ssid);
-            }
-        }
-
-        // suppress packets that are not destined for a memory, such as
-        // device accesses that could be part of a trace
-        if (pkt && system->isMemAddr(pkt->getAddr())) {
-            stats.numPackets++;
-            // Only attempts to send if not blocked by pending responses
-            blockedWaitingResp = allocateWaitingRespSlot(pkt);
-            if (blockedWaitingResp || !port.sendTimingReq(pkt)) {
-                retryPkt = pkt;
-                retryPktTick = curTick();
+        sendNextPacket();
+
+        // send the following packets that are due at this tick as well,
+        // e.g. when catching up after back-pressure, rather than going
+        // through an update event for each of them
+        while (retryPkt == NULL) {
+            nextPacketTick = activeGenerator->nextPacketTick(elasticReq, 0);
+            if (nextPacketTick > curTick()) {
+                scheduleUpdate();
+                return;
             }
-        } else if (pkt) {
-            DPRINTF(TrafficGen, "Suppressed packet %s 0x%x\n",
-                    pkt->cmdString(), pkt->getAddr());
-
-            ++stats.numSuppressed;
-            if (!(static_cast<int>(stats.numSuppressed.value()) % 10000))
-                warn("%s suppressed %d packets with non-memory addresses\n",
-                     name(), stats.numSuppressed.value());
-
-            delete pkt;
-            pkt = nullptr;
+            sendNextPacket();
         }
+        return;
     }
 
     // if we are waiting for a retry or for a response, do not schedule any
@@ -226,6 +203,49 @@ BaseTrafficGen::update()
     }
 }
 
+void
+BaseTrafficGen::sendNextPacket()
+{
+    // get the next packet and try to send it
+    PacketPtr pkt = activeGenerator->getNextPacket();
+
+    // If generating stream/substream IDs are enabled,
+    // try to pick and assign them to the new packet
+    if (streamGenerator) {
+        auto sid = streamGenerator->pickStreamID();
+        auto ssid = streamGenerator->pickSubstreamID();
+
+        pkt->req->setStreamId(sid);
+
+        if (streamGenerator->ssidValid()) {
+            pkt->req->setSubstreamId(ssid);
+        }
+    }
+
+    // suppress packets that are not destined for a memory, such as
+    // device accesses that could be part of a trace
+    if (pkt && system->isMemAddr(pkt->getAddr())) {
+        stats.numPackets++;
+        // Only attempts to send if not blocked by pending responses
+        blockedWaitingResp = allocateWaitingRespSlot(pkt);
+        if (blockedWaitingResp || !port.sendTimingReq(pkt)) {
+            retryPkt = pkt;
+            retryPktTick = curTick();
+        }
+    } else if (pkt) {
+        DPRINTF(TrafficGen, "Suppressed packet %s 0x%x\n",
+                pkt->cmdString(), pkt->getAddr());
+
+        ++stats.numSuppressed;
+        if (!(static_cast<int>(stats.numSuppressed.value()) % 10000))
+            warn("%s suppressed %d packets with non-memory addresses\n",
+                 name(), stats.numSuppressed.value());
+
+        delete pkt;
+        pkt = nullptr;
+    }
+}
+
 void
 BaseTrafficGen::transition()
 {
@@ -557,25 +577,24 @@ BaseTrafficGen::createTrace(Tick duration,
 bool
 BaseTrafficGen::recvTimingResp(PacketPtr pkt)
 {
-    auto iter = waitingResp.find(pkt->req);
-
-    panic_if(iter == waitingResp.end(), "%s: "
-            "Received unexpected response [%s reqPtr=%x]\n",
-               pkt->print(), pkt->req);
+    panic_if(numWaitingResp == 0 || pkt->req->requestorId() != requestorId,
+             "%s: Received unexpected response [%s reqPtr=%x]\n",
+             name(), pkt->print(), pkt->req);
 
-    assert(iter->second <= curTick());
+    const Tick issue_tick = pkt->req->time();
+    assert(issue_tick <= curTick());
 
     if (pkt->isWrite()) {
         ++stats.totalWrites;
         stats.bytesWritten += pkt->req->getSize();
-        stats.totalWriteLatency += curTick() - iter->second;
+        stats.totalWriteLatency += curTick() - issue_tick;
     } else {
         ++stats.totalReads;
         stats.bytesRead += pkt->req->getSize();
-        stats.totalReadLatency += curTick() - iter->second;
+        stats.totalReadLatency += curTick() - issue_tick;
     }
 
-    waitingResp.erase(iter);
+    --numWaitingResp;
 
     delete pkt;
 
@@ -40,7 +40,6 @@
 
 #include <memory>
 #include <tuple>
-#include <unordered_map>
 
 #include "base/statistics.hh"
 #include "enums/AddrMap.hh"
@@ -160,6 +159,12 @@ class BaseTrafficGen : public ClockedObject
      */
     void update();
 
+    /**
+     * Get the next packet from the active generator and try to send it.
+     * On failure, the packet is kept as the retry packet.
+     */
+    void sendNextPacket();
+
     /** The instance of request port used by the traffic generator. */
     TrafficGenPort port;
 
@@ -173,26 +178,28 @@ class BaseTrafficGen : public ClockedObject
     bool blockedWaitingResp;
 
     /**
-     * Puts this packet in the waitingResp list and returns true if
+     * Counts this packet as waiting for a response and returns true if
      * we are above the maximum number of oustanding requests.
      */
     bool allocateWaitingRespSlot(PacketPtr pkt)
     {
-        assert(waitingResp.find(pkt->req) == waitingResp.end());
         assert(pkt->needsResponse());
 
-        waitingResp[pkt->req] = curTick();
+        ++numWaitingResp;
 
         return (maxOutstandingReqs > 0) &&
-               (waitingResp.size() > maxOutstandingReqs);
+               (numWaitingResp > maxOutstandingReqs);
     }
 
     /** Event for scheduling updates */
     EventFunctionWrapper updateEvent;
 
   protected: // Stats
-    /** Reqs waiting for response **/
-    std::unordered_map<RequestPtr,Tick> waitingResp;
+    /**
+     * Number of reqs waiting for response. The latency of a req is
+     * measured from its creation time, which is when it was generated.
+     */
+    int numWaitingResp;
 
     struct StatGroup : public statistics::Group
     {
@@ -61,8 +61,20 @@ class TraceCPU(BaseCPU):
     def support_take_over(cls):
         return True
 
-    instTraceFile = Param.String("", "Instruction trace file")
-    dataTraceFile = Param.String("", "Data dependency trace file")
+    instTraceFile = Param.String(
+        "", "Instruction trace file, no instruction fetches if empty"
+    )
+    dataTraceFile = Param.String(
+        "",
+        "Data dependency trace file, either protobuf or columnar, or a "
+        "statistical profile of one",
+    )
+    # A statistical profile synthesizes as many records as requested, with
+    # the same records for the same seed.
+    profileLength = Param.UInt64(
+        1000000, "Number of records synthesized from a data profile"
+    )
+    profileSeed = Param.UInt32(1, "Seed used to synthesize a data profile")
     sizeStoreBuffer = Param.Unsigned(
         16, "Number of entries in the store buffer"
     )
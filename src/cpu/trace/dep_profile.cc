@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/trace/dep_profile.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "base/logging.hh"
+#include "base/str.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** The first word of a profile */
+const std::string profileMagic = "gem5-dep-profile";
+
+const unsigned profileVersion = 1;
+
+} // anonymous namespace
+
+void
+DepProfileDist::add(uint64_t value, uint64_t weight)
+{
+    if (weight == 0)
+        return;
+    values.push_back(value);
+    cumWeights.push_back((cumWeights.empty() ? 0 : cumWeights.back()) +
+                         weight);
+}
+
+uint64_t
+DepProfileDist::sample(Random &rng) const
+{
+    if (values.empty())
+        return 0;
+    const uint64_t pick = rng.random<uint64_t>(0, cumWeights.back() - 1);
+    auto it = std::upper_bound(cumWeights.begin(), cumWeights.end(), pick);
+    return values[it - cumWeights.begin()];
+}
+
+DepProfileInputStream::DepProfileInputStream(const std::string &filename,
+                                             uint64_t num_records,
+                                             uint32_t _seed)
+    : fileName(filename), numRecords(num_records), seed(_seed), rng(_seed)
+{
+    parse();
+}
+
+bool
+DepProfileInputStream::isDepProfile(const std::string &filename)
+{
+    std::ifstream file(filename);
+    std::string word;
+    return (file >> word) && word == profileMagic;
+}
+
+void
+DepProfileInputStream::parse()
+{
+    std::ifstream file(fileName);
+    fatal_if(!file, "Failed to open dependency profile %s\n", fileName);
+
+    std::string line;
+    unsigned line_num = 0;
+    bool versioned = false;
+    bool has_mem = false;
+    while (std::getline(file, line)) {
+        ++line_num;
+        std::istringstream words(line.substr(0, line.find('#')));
+
+        std::string key;
+        if (!(words >> key))
+            continue;
+
+        if (!versioned) {
+            unsigned version = 0;
+            fatal_if(key != profileMagic || !(words >> version) ||
+                     version != profileVersion,
+                     "%s is not a version %d dependency profile\n",
+                     fileName, profileVersion);
+            versioned = true;
+            continue;
+        }
+
+        std::string value_str;
+        fatal_if(!(words >> value_str), "%s:%d: %s lacks a value\n",
+                 fileName, line_num, key);
+
+        uint64_t value = 0;
+        if (key == "mix") {
+            if (value_str == "load") {
+                value = DepTraceRecord::Load;
+            } else if (value_str == "store") {
+                value = DepTraceRecord::Store;
+            } else if (value_str == "comp") {
+                value = DepTraceRecord::Comp;
+            } else {
+                fatal("%s:%d: Unknown record type %s\n", fileName, line_num,
+                      value_str);
+            }
+        } else if (key == "reuse" && value_str == "cold") {
+            value = coldReuse;
+        } else {
+            fatal_if(!to_number(value_str, value),
+                     "%s:%d: Invalid value %s\n", fileName, line_num,
+                     value_str);
+        }
+
+        if (key == "tick_freq") {
+            _header.tickFreq = value;
+            continue;
+        } else if (key == "window") {
+            _header.windowSize = value;
+            continue;
+        } else if (key == "line_size") {
+            lineSize = value;
+            continue;
+        } else if (key == "base_addr") {
+            baseAddr = value;
+            continue;
+        }
+
+        uint64_t weight = 0;
+        fatal_if(!(words >> weight), "%s:%d: %s lacks a weight\n",
+                 fileName, line_num, key);
+
+        if (key == "mix") {
+            mix.add(value, weight);
+            has_mem |= weight && value != DepTraceRecord::Comp;
+        } else if (key == "comp_delay") {
+            compDelay.add(value, weight);
+        } else if (key == "rob_deps") {
+            robDeps.add(value, weight);
+        } else if (key == "rob_dep") {
+            robDep.add(value, weight);
+        } else if (key == "reg_deps") {
+            regDeps.add(value, weight);
+        } else if (key == "reg_dep") {
+            regDep.add(value, weight);
+        } else if (key == "size") {
+            fatal_if(value == 0, "%s:%d: Accesses can't be empty\n",
+                     fileName, line_num);
+            size.add(value, weight);
+        } else if (key == "reuse") {
+            reuse.add(value, weight);
+            if (value != coldReuse && weight)
+                maxReuse = std::max<size_t>(maxReuse, value + 1);
+        } else {
+            fatal("%s:%d: Unknown directive %s\n", fileName, line_num, key);
+        }
+    }
+
+    fatal_if(!versioned, "%s is not a version %d dependency profile\n",
+             fileName, profileVersion);
+    fatal_if(!_header.tickFreq || !_header.windowSize,
+             "%s lacks the tick_freq or the window\n", fileName);
+    fatal_if(lineSize == 0, "%s has an empty line size\n", fileName);
+    fatal_if(mix.empty(), "%s has no instruction mix\n", fileName);
+    fatal_if(has_mem && size.empty(),
+             "%s has loads or stores but no access sizes\n", fileName);
+
+    _header.objId = fileName;
+}
+
+Addr
+DepProfileInputStream::nextLine()
+{
+    const uint64_t distance = reuse.empty() ? coldReuse : reuse.sample(rng);
+
+    Addr line;
+    if (distance >= lruStack.size()) {
+        // The reuse distance reaches beyond the lines accessed so far, so
+        // this is the first access to a line
+        line = nextColdLine++;
+    } else {
+        auto it = lruStack.end() - 1 - distance;
+        line = *it;
+        lruStack.erase(it);
+    }
+    lruStack.push_back(line);
+
+    // Drop the lines no reuse distance reaches, amortizing the erase
+    if (lruStack.size() > 2 * std::max<size_t>(maxReuse, 1))
+        lruStack.erase(lruStack.begin(), lruStack.end() - maxReuse);
+
+    return line;
+}
+
+void
+DepProfileInputStream::addDeps(std::vector<uint64_t> &deps,
+                               const DepProfileDist &count,
+                               const DepProfileDist &distance)
+{
+    deps.clear();
+    const uint64_t num_deps = count.sample(rng);
+    for (uint64_t i = 0; i < num_deps; ++i) {
+        const uint64_t dist = distance.sample(rng);
+        // A record can only depend on the records before it
+        if (dist == 0 || dist >= seqNum)
+            continue;
+        const uint64_t dep = seqNum - dist;
+        if (std::find(deps.begin(), deps.end(), dep) == deps.end())
+            deps.push_back(dep);
+    }
+}
+
+bool
+DepProfileInputStream::read(DepTraceRecord &record)
+{
+    if (seqNum == numRecords)
+        return false;
+
+    ++seqNum;
+    record.seqNum = seqNum;
+    record.type = DepTraceRecord::Type(mix.sample(rng));
+    record.compDelay = compDelay.sample(rng);
+    addDeps(record.robDep, robDeps, robDep);
+    addDeps(record.regDep, regDeps, regDep);
+    record.weight = 0;
+    record.pc = 0;
+    record.flags = 0;
+
+    if (record.isMem()) {
+        record.size = size.sample(rng);
+        record.pAddr = baseAddr + nextLine() * lineSize;
+        record.vAddr = record.pAddr;
+    } else {
+        record.size = 0;
+        record.pAddr = 0;
+        record.vAddr = 0;
+    }
+    return true;
+}
+
+void
+DepProfileInputStream::reset()
+{
+    rng.init(seed);
+    seqNum = 0;
+    nextColdLine = 0;
+    lruStack.clear();
+}
+
+} // namespace gem5
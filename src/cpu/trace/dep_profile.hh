@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * A statistical profile of a data dependency trace, and a stream which
+ * synthesizes the records of a trace from it for the TraceCPU to replay.
+ *
+ * The profile is a text file which starts with the line
+ * "gem5-dep-profile 1" and holds one directive per line, with '#'
+ * starting a comment:
+ *
+ *   tick_freq <ticks per second of the compute delays>
+ *   window <window size of the dependency graph>
+ *   line_size <bytes>
+ *   base_addr <address of the first line>
+ *   mix <load|store|comp> <weight>
+ *   comp_delay <ticks> <weight>
+ *   rob_deps <count> <weight>
+ *   rob_dep <distance> <weight>
+ *   reg_deps <count> <weight>
+ *   reg_dep <distance> <weight>
+ *   size <bytes> <weight>
+ *   reuse <distance|cold> <weight>
+ *
+ * Every directive but the first four adds a value to a distribution. The
+ * dependency distances are in records, and a record samples the number
+ * of its dependencies of each kind, then their distances. The reuse
+ * distance of a load or store is the number of distinct lines accessed
+ * since the last access to its line, and "cold" accesses a line which
+ * hasn't been accessed before. util/dep_trace_profile.py extracts a
+ * profile from an elastic trace.
+ */
+
+#ifndef __CPU_TRACE_DEP_PROFILE_HH__
+#define __CPU_TRACE_DEP_PROFILE_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/random.hh"
+#include "base/types.hh"
+#include "cpu/trace/dep_trace_io.hh"
+
+namespace gem5
+{
+
+/** A discrete distribution of weighted values */
+class DepProfileDist
+{
+  private:
+    std::vector<uint64_t> values;
+
+    /** The running sum of the weights, one per value */
+    std::vector<uint64_t> cumWeights;
+
+  public:
+    void add(uint64_t value, uint64_t weight);
+
+    bool empty() const { return values.empty(); }
+
+    /**
+     * Draw a value, or 0 if the distribution is empty.
+     *
+     * @param rng The random number generator to draw with
+     */
+    uint64_t sample(Random &rng) const;
+};
+
+/**
+ * Synthesize the records of a data dependency trace from a statistical
+ * profile, as a replacement for a DepTraceInputStream.
+ */
+class DepProfileInputStream
+{
+  public:
+    /** The reuse distance of an access to a line never accessed before */
+    static const uint64_t coldReuse = UINT64_MAX;
+
+  private:
+    const std::string fileName;
+
+    DepTraceHeader _header;
+
+    Addr lineSize = 64;
+    Addr baseAddr = 0;
+
+    /** The distribution of the record types, as DepTraceRecord::Type */
+    DepProfileDist mix;
+    DepProfileDist compDelay;
+    DepProfileDist robDeps;
+    DepProfileDist robDep;
+    DepProfileDist regDeps;
+    DepProfileDist regDep;
+    DepProfileDist size;
+    DepProfileDist reuse;
+
+    /** The number of records to synthesize */
+    const uint64_t numRecords;
+
+    const uint32_t seed;
+
+    Random rng;
+
+    uint64_t seqNum = 0;
+
+    /** The next line never accessed before */
+    Addr nextColdLine = 0;
+
+    /**
+     * The lines accessed so far, the most recently accessed last. Lines
+     * further than the largest reuse distance of the profile are only
+     * dropped once they make up half of the stack.
+     */
+    std::vector<Addr> lruStack;
+
+    /** The number of lines of lruStack a reuse distance can reach */
+    size_t maxReuse = 0;
+
+    void parse();
+
+    /** Pick the line of a load or store and update the LRU stack */
+    Addr nextLine();
+
+    /** Add the dependencies of the next record to deps */
+    void addDeps(std::vector<uint64_t> &deps, const DepProfileDist &count,
+                 const DepProfileDist &distance);
+
+  public:
+    /**
+     * Read a profile, fatal-ing if it is malformed.
+     *
+     * @param filename Path to the profile
+     * @param num_records The number of records to synthesize
+     * @param seed Seed of the random number generator
+     */
+    DepProfileInputStream(const std::string &filename,
+                          uint64_t num_records, uint32_t seed);
+
+    /** Does the file start like a profile? */
+    static bool isDepProfile(const std::string &filename);
+
+    const DepTraceHeader &header() const { return _header; }
+
+    /**
+     * Synthesize the next record.
+     *
+     * @return False once numRecords records have been synthesized
+     */
+    bool read(DepTraceRecord &record);
+
+    /** Restart the stream, which synthesizes the same records again */
+    void reset();
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRACE_DEP_PROFILE_HH__
@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/trace/dep_trace_io.hh"
+
+#include <zlib.h>
+
+#include <cassert>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+void
+putVarint(std::vector<uint8_t> &buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    buf.push_back(uint8_t(value));
+}
+
+/** Zigzag encode a difference so that small negative differences also
+ *  make short varints */
+uint64_t
+encodeDelta(uint64_t value, uint64_t base)
+{
+    uint64_t delta = value - base;
+    return (delta << 1) ^ -(delta >> 63);
+}
+
+uint64_t
+decodeDelta(uint64_t encoded, uint64_t base)
+{
+    return base + ((encoded >> 1) ^ -(encoded & 1));
+}
+
+void
+putU32(std::vector<uint8_t> &buf, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        buf.push_back(uint8_t(value >> (8 * i)));
+}
+
+void
+putU64(std::vector<uint8_t> &buf, uint64_t value)
+{
+    for (int i = 0; i < 8; i++)
+        buf.push_back(uint8_t(value >> (8 * i)));
+}
+
+uint32_t
+getU32(const uint8_t *buf)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++)
+        value |= uint32_t(buf[i]) << (8 * i);
+    return value;
+}
+
+uint64_t
+getU64(const uint8_t *buf)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++)
+        value |= uint64_t(buf[i]) << (8 * i);
+    return value;
+}
+
+/** A column being decoded */
+struct ColumnReader
+{
+    const uint8_t *pos = nullptr;
+    const uint8_t *end = nullptr;
+    bool overrun = false;
+
+    uint64_t
+    get()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (pos == end) {
+                overrun = true;
+                return 0;
+            }
+            uint8_t byte = *pos++;
+            value |= uint64_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        overrun = true;
+        return 0;
+    }
+};
+
+const size_t fileHeaderSize = 4 + 4 + 4 + 8 + 4 + 4;
+const size_t blockHeaderSize = 4 + 4 + 4;
+
+} // anonymous namespace
+
+bool
+DepTraceStream::isDepTrace(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    uint8_t magic[4];
+    return file.read(reinterpret_cast<char *>(magic), sizeof(magic)) &&
+        getU32(magic) == magicNumber;
+}
+
+DepTraceOutputStream::DepTraceOutputStream(const std::string &filename,
+                                           const DepTraceHeader &header,
+                                           bool compress)
+    : file(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+      fileName(filename), compress(compress)
+{
+    fatal_if(!file.good(), "Could not open %s for writing\n", filename);
+
+    std::vector<uint8_t> buf;
+    putU32(buf, magicNumber);
+    putU32(buf, version);
+    putU32(buf, compress ? compressedFlag : 0);
+    putU64(buf, header.tickFreq);
+    putU32(buf, header.windowSize);
+    putU32(buf, header.objId.size());
+    buf.insert(buf.end(), header.objId.begin(), header.objId.end());
+
+    file.write(reinterpret_cast<const char *>(buf.data()), buf.size());
+    fatal_if(!file.good(), "Failed to write to %s\n", fileName);
+}
+
+DepTraceOutputStream::~DepTraceOutputStream()
+{
+    writeBlock();
+    file.close();
+}
+
+void
+DepTraceOutputStream::write(const DepTraceRecord &record)
+{
+    putVarint(columns[SeqNumColumn], encodeDelta(record.seqNum, lastSeqNum));
+    lastSeqNum = record.seqNum;
+    columns[TypeColumn].push_back(record.type);
+    putVarint(columns[CompDelayColumn], record.compDelay);
+    putVarint(columns[WeightColumn], record.weight);
+    putVarint(columns[PcColumn], encodeDelta(record.pc, lastPc));
+    lastPc = record.pc;
+
+    if (record.isMem()) {
+        putVarint(columns[AddrColumn], encodeDelta(record.pAddr, lastPAddr));
+        putVarint(columns[AddrColumn], encodeDelta(record.vAddr, lastVAddr));
+        lastPAddr = record.pAddr;
+        lastVAddr = record.vAddr;
+        putVarint(columns[SizeColumn], record.size);
+        putVarint(columns[FlagsColumn], record.flags);
+    }
+
+    // The dependencies are on older records, so close behind this one
+    std::vector<uint8_t> &deps = columns[DepColumn];
+    putVarint(deps, record.robDep.size());
+    putVarint(deps, record.regDep.size());
+    for (auto dep : record.robDep)
+        putVarint(deps, encodeDelta(record.seqNum, dep));
+    for (auto dep : record.regDep)
+        putVarint(deps, encodeDelta(record.seqNum, dep));
+
+    if (++numRecords == recordsPerBlock)
+        writeBlock();
+}
+
+void
+DepTraceOutputStream::writeBlock()
+{
+    if (numRecords == 0)
+        return;
+
+    rawBlock.clear();
+    for (auto &column : columns)
+        putU32(rawBlock, column.size());
+    for (auto &column : columns) {
+        rawBlock.insert(rawBlock.end(), column.begin(), column.end());
+        column.clear();
+    }
+
+    const std::vector<uint8_t> *payload = &rawBlock;
+    if (compress) {
+        uLongf stored_size = compressBound(rawBlock.size());
+        storedBlock.resize(stored_size);
+        int ret = compress2(storedBlock.data(), &stored_size,
+                            rawBlock.data(), rawBlock.size(),
+                            Z_DEFAULT_COMPRESSION);
+        fatal_if(ret != Z_OK, "Failed to compress a block of %s\n",
+                 fileName);
+        storedBlock.resize(stored_size);
+        payload = &storedBlock;
+    }
+
+    std::vector<uint8_t> header;
+    putU32(header, numRecords);
+    putU32(header, rawBlock.size());
+    putU32(header, payload->size());
+
+    file.write(reinterpret_cast<const char *>(header.data()), header.size());
+    file.write(reinterpret_cast<const char *>(payload->data()),
+               payload->size());
+    fatal_if(!file.good(), "Failed to write to %s\n", fileName);
+
+    numRecords = 0;
+    lastSeqNum = 0;
+    lastPc = 0;
+    lastPAddr = 0;
+    lastVAddr = 0;
+}
+
+DepTraceInputStream::DepTraceInputStream(const std::string &filename)
+    : file(filename, std::ios::in | std::ios::binary), fileName(filename)
+{
+    fatal_if(!file.good(), "Could not open %s\n", filename);
+
+    uint8_t buf[fileHeaderSize];
+    panic_if(!file.read(reinterpret_cast<char *>(buf), sizeof(buf)),
+             "Failed to read the header of %s\n", filename);
+    panic_if(getU32(buf) != magicNumber,
+             "%s is not a columnar dependency trace\n", filename);
+    fatal_if(getU32(buf + 4) != version,
+             "%s has unsupported version %d\n", filename, getU32(buf + 4));
+
+    compressed = getU32(buf + 8) & compressedFlag;
+    _header.tickFreq = getU64(buf + 12);
+    _header.windowSize = getU32(buf + 20);
+    _header.objId.resize(getU32(buf + 24));
+    panic_if(!file.read(&_header.objId[0], _header.objId.size()),
+             "Failed to read the header of %s\n", filename);
+
+    firstBlock = file.tellg();
+    startPrefetcher();
+}
+
+DepTraceInputStream::~DepTraceInputStream()
+{
+    stopPrefetcher();
+}
+
+bool
+DepTraceInputStream::readBlock(Block &block)
+{
+    uint8_t header[blockHeaderSize];
+    if (!file.read(reinterpret_cast<char *>(header), sizeof(header))) {
+        if (file.gcount() != 0)
+            block.error = "truncated block header";
+        return file.gcount() != 0;
+    }
+
+    uint32_t num_records = getU32(header);
+    uLongf raw_size = getU32(header + 4);
+    uint32_t stored_size = getU32(header + 8);
+
+    std::vector<uint8_t> stored(stored_size);
+    if (!file.read(reinterpret_cast<char *>(stored.data()), stored_size)) {
+        block.error = "truncated block";
+        return true;
+    }
+
+    std::vector<uint8_t> inflated;
+    const std::vector<uint8_t> *raw = &stored;
+    if (compressed) {
+        inflated.resize(raw_size);
+        uLongf inflated_size = raw_size;
+        if (uncompress(inflated.data(), &inflated_size, stored.data(),
+                       stored_size) != Z_OK || inflated_size != raw_size) {
+            block.error = "failed to decompress a block";
+            return true;
+        }
+        raw = &inflated;
+    } else if (raw_size != stored_size) {
+        block.error = "block size mismatch";
+        return true;
+    }
+
+    // Find the columns
+    ColumnReader columns[NumColumns];
+    size_t offset = 4 * NumColumns;
+    if (raw->size() < offset) {
+        block.error = "truncated column table";
+        return true;
+    }
+    for (int i = 0; i < NumColumns; i++) {
+        size_t size = getU32(raw->data() + 4 * i);
+        if (raw->size() - offset < size) {
+            block.error = "truncated column";
+            return true;
+        }
+        columns[i].pos = raw->data() + offset;
+        columns[i].end = columns[i].pos + size;
+        offset += size;
+    }
+
+    block.records.resize(num_records);
+    uint64_t last_seq_num = 0;
+    uint64_t last_pc = 0;
+    uint64_t last_p_addr = 0;
+    uint64_t last_v_addr = 0;
+    for (auto &record : block.records) {
+        record.seqNum = decodeDelta(columns[SeqNumColumn].get(),
+                                    last_seq_num);
+        last_seq_num = record.seqNum;
+
+        ColumnReader &types = columns[TypeColumn];
+        if (types.pos == types.end) {
+            types.overrun = true;
+            break;
+        }
+        record.type = DepTraceRecord::Type(*types.pos++);
+        record.compDelay = columns[CompDelayColumn].get();
+        record.weight = columns[WeightColumn].get();
+        record.pc = decodeDelta(columns[PcColumn].get(), last_pc);
+        last_pc = record.pc;
+
+        if (record.isMem()) {
+            record.pAddr = decodeDelta(columns[AddrColumn].get(),
+                                       last_p_addr);
+            record.vAddr = decodeDelta(columns[AddrColumn].get(),
+                                       last_v_addr);
+            last_p_addr = record.pAddr;
+            last_v_addr = record.vAddr;
+            record.size = columns[SizeColumn].get();
+            record.flags = columns[FlagsColumn].get();
+        } else {
+            record.pAddr = 0;
+            record.vAddr = 0;
+            record.size = 0;
+            record.flags = 0;
+        }
+
+        ColumnReader &deps = columns[DepColumn];
+        uint64_t num_rob_deps = deps.get();
+        uint64_t num_reg_deps = deps.get();
+        // Every dependency takes at least a byte
+        if (uint64_t(deps.end - deps.pos) < num_rob_deps + num_reg_deps) {
+            deps.overrun = true;
+            break;
+        }
+        record.robDep.resize(num_rob_deps);
+        for (auto &dep : record.robDep)
+            dep = record.seqNum - decodeDelta(deps.get(), 0);
+        record.regDep.resize(num_reg_deps);
+        for (auto &dep : record.regDep)
+            dep = record.seqNum - decodeDelta(deps.get(), 0);
+    }
+
+    for (auto &column : columns) {
+        if (column.overrun) {
+            block.error = "corrupt block";
+            break;
+        }
+    }
+
+    return true;
+}
+
+void
+DepTraceInputStream::prefetch()
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            spaceFree.wait(lock, [this] {
+                return stopping || blocks.size() < prefetchBlocks;
+            });
+            if (stopping)
+                return;
+        }
+
+        auto block = std::make_unique<Block>();
+        bool more = readBlock(*block);
+        bool failed = !block->error.empty();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (more)
+            blocks.push_back(std::move(block));
+        // Stop at the first error, which the reader reports when it gets
+        // to it
+        if (!more || failed)
+            endOfFile = true;
+        blockReady.notify_one();
+        if (endOfFile)
+            return;
+    }
+}
+
+void
+DepTraceInputStream::startPrefetcher()
+{
+    assert(!prefetcher.joinable());
+    prefetcher = std::thread([this] { prefetch(); });
+}
+
+void
+DepTraceInputStream::stopPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    spaceFree.notify_one();
+    if (prefetcher.joinable())
+        prefetcher.join();
+}
+
+bool
+DepTraceInputStream::read(DepTraceRecord &record)
+{
+    while (!current || nextRecord == current->records.size()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        blockReady.wait(lock, [this] { return !blocks.empty() || endOfFile; });
+        if (blocks.empty())
+            return false;
+        current = std::move(blocks.front());
+        blocks.pop_front();
+        nextRecord = 0;
+        lock.unlock();
+        spaceFree.notify_one();
+
+        fatal_if(!current->error.empty(), "Failed to read %s: %s\n",
+                 fileName, current->error);
+    }
+
+    // Hand the record over, leaving the caller's vectors to be freed with
+    // the block
+    std::swap(record, current->records[nextRecord++]);
+    return true;
+}
+
+void
+DepTraceInputStream::reset()
+{
+    stopPrefetcher();
+
+    blocks.clear();
+    current.reset();
+    nextRecord = 0;
+    endOfFile = false;
+    stopping = false;
+
+    file.clear();
+    file.seekg(firstBlock);
+    startPrefetcher();
+}
+
+} // namespace gem5
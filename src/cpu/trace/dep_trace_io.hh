@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * A block based, columnar file format for the data dependency traces
+ * written by the ElasticTrace probe and replayed by the TraceCPU, as a
+ * more compact and faster to parse alternative to a stream of protobuf
+ * InstDepRecord messages.
+ *
+ * The file starts with a header carrying the same information as the
+ * InstDepRecordHeader message, and is followed by blocks of up to
+ * recordsPerBlock records. Within a block each field is stored in its own
+ * column of variable length integers, with the sequence numbers, PCs and
+ * addresses delta encoded against the previous record, and the
+ * dependencies relative to the record's own sequence number. Every block
+ * starts from scratch so it can be decoded on its own, and may optionally
+ * be deflated.
+ */
+
+#ifndef __CPU_TRACE_DEP_TRACE_IO_HH__
+#define __CPU_TRACE_DEP_TRACE_IO_HH__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gem5
+{
+
+/** The header of a data dependency trace */
+struct DepTraceHeader
+{
+    /** The name of the object which captured the trace */
+    std::string objId;
+
+    /** The tick frequency of the simulation the trace was captured in */
+    uint64_t tickFreq = 0;
+
+    /** The window size used to limit the dependencies during capture */
+    uint32_t windowSize = 0;
+};
+
+/**
+ * A record of the data dependency trace. The fields match those of the
+ * InstDepRecord message, with the optional fields being 0 when not set.
+ */
+struct DepTraceRecord
+{
+    /** Record types, numbered as in InstDepRecord::RecordType */
+    enum Type : uint8_t
+    {
+        Invalid = 0,
+        Load = 1,
+        Store = 2,
+        Comp = 3
+    };
+
+    uint64_t seqNum = 0;
+    Type type = Invalid;
+    uint64_t pAddr = 0;
+    uint32_t size = 0;
+    uint32_t flags = 0;
+    std::vector<uint64_t> robDep;
+    uint64_t compDelay = 0;
+    std::vector<uint64_t> regDep;
+    uint32_t weight = 0;
+    uint64_t pc = 0;
+    uint64_t vAddr = 0;
+
+    /** Does the record have the request related fields? */
+    bool isMem() const { return type == Load || type == Store; }
+};
+
+/** The constants shared by the trace writer and reader */
+class DepTraceStream
+{
+  public:
+    /** Is the file a columnar dependency trace rather than a protobuf
+     *  one?  Checks the magic number the file starts with */
+    static bool isDepTrace(const std::string &filename);
+
+  protected:
+    /** The ASCII characters gDTR */
+    static const uint32_t magicNumber = 0x52544467;
+
+    static const uint32_t version = 1;
+
+    /** Header flag set when the blocks are deflated */
+    static const uint32_t compressedFlag = 0x1;
+
+    /** The number of records in every block but the last */
+    static const unsigned recordsPerBlock = 4096;
+
+    /** The columns of a block, in the order they are stored */
+    enum Column
+    {
+        SeqNumColumn,
+        TypeColumn,
+        CompDelayColumn,
+        WeightColumn,
+        PcColumn,
+        /** Load and store records only */
+        AddrColumn,
+        SizeColumn,
+        FlagsColumn,
+        /** The number of rob then reg dependencies, then the
+         *  dependencies */
+        DepColumn,
+        NumColumns
+    };
+};
+
+/**
+ * Write a columnar data dependency trace. The last, partial, block is
+ * written when the stream is destroyed.
+ */
+class DepTraceOutputStream : public DepTraceStream
+{
+  private:
+    std::ofstream file;
+
+    const std::string fileName;
+
+    const bool compress;
+
+    /** The columns of the block being filled */
+    std::vector<uint8_t> columns[NumColumns];
+
+    unsigned numRecords = 0;
+
+    /** The delta encoding state of the block being filled */
+    uint64_t lastSeqNum = 0;
+    uint64_t lastPc = 0;
+    uint64_t lastPAddr = 0;
+    uint64_t lastVAddr = 0;
+
+    /** Scratch space to build and deflate a block in */
+    std::vector<uint8_t> rawBlock;
+    std::vector<uint8_t> storedBlock;
+
+    void writeBlock();
+
+  public:
+    /**
+     * @param filename Path to the file to create or truncate
+     * @param header The trace header
+     * @param compress Deflate the blocks
+     */
+    DepTraceOutputStream(const std::string &filename,
+                         const DepTraceHeader &header, bool compress);
+
+    ~DepTraceOutputStream();
+
+    void write(const DepTraceRecord &record);
+};
+
+/**
+ * Read a columnar data dependency trace. The blocks are read, inflated
+ * and decoded ahead of the reader by a host thread, so that replaying
+ * a trace overlaps with the I/O and decoding of the records to come.
+ */
+class DepTraceInputStream : public DepTraceStream
+{
+  private:
+    /** A decoded block, or the error which stopped the decoding */
+    struct Block
+    {
+        std::vector<DepTraceRecord> records;
+        std::string error;
+    };
+
+    std::ifstream file;
+
+    const std::string fileName;
+
+    DepTraceHeader _header;
+
+    bool compressed = false;
+
+    /** The file offset of the first block */
+    std::streampos firstBlock;
+
+    /** The number of decoded blocks to keep ahead of the reader */
+    static const unsigned prefetchBlocks = 4;
+
+    std::thread prefetcher;
+
+    /** Protects the members below, which are shared with the
+     *  prefetcher */
+    std::mutex mutex;
+    std::condition_variable blockReady;
+    std::condition_variable spaceFree;
+    std::deque<std::unique_ptr<Block>> blocks;
+    bool endOfFile = false;
+    bool stopping = false;
+
+    /** The block being read and the next record in it */
+    std::unique_ptr<Block> current;
+    size_t nextRecord = 0;
+
+    /** The prefetcher's main loop */
+    void prefetch();
+
+    /**
+     * Read and decode the next block of the file.
+     *
+     * @return False at the end of the file
+     */
+    bool readBlock(Block &block);
+
+    void startPrefetcher();
+    void stopPrefetcher();
+
+  public:
+    /**
+     * Open a trace and read its header, panicking if the file isn't a
+     * columnar dependency trace.
+     *
+     * @param filename Path to the file to read from
+     */
+    DepTraceInputStream(const std::string &filename);
+
+    ~DepTraceInputStream();
+
+    const DepTraceHeader &header() const { return _header; }
+
+    /**
+     * Read the next record.
+     *
+     * @param record The record to populate, whose dependency vectors are
+     *               reused
+     * @return False at the end of the trace
+     */
+    bool read(DepTraceRecord &record);
+
+    /** Go back to the first record */
+    void reset();
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRACE_DEP_TRACE_IO_HH__
@@ -111,8 +111,13 @@ TraceCPU::init()
 
     BaseCPU::init();
 
-    // Get the send tick of the first instruction read request
-    Tick first_icache_tick = icacheGen.init();
+    // Get the send tick of the first instruction read request. Without an
+    // instruction trace, the instruction side is complete from the start.
+    Tick first_icache_tick = MaxTick;
+    if (instTraceFile.empty())
+        oneTraceComplete = true;
+    else
+        first_icache_tick = icacheGen.init();
 
     // Get the send tick of the first data read/write request
     Tick first_dcache_tick = dcacheGen.init();
@@ -123,7 +128,8 @@ TraceCPU::init()
             name(), traceOffset);
 
     // Schedule next icache and dcache event by subtracting the offset
-    schedule(icacheNextEvent, first_icache_tick - traceOffset);
+    if (!instTraceFile.empty())
+        schedule(icacheNextEvent, first_icache_tick - traceOffset);
     schedule(dcacheNextEvent, first_dcache_tick - traceOffset);
 
     // Adjust the trace offset for the dcache generator's ready nodes
@@ -599,7 +605,7 @@ TraceCPU::ElasticDataGen::executeMemReq(GraphNode* node_ptr)
     }
 
     // Create a request and the packet containing request
-    auto req = std::make_shared<Request>(
+    auto req = Request::make(
         node_ptr->physAddr, node_ptr->size, node_ptr->flags, requestorId);
     req->setReqInstSeqNum(node_ptr->seqNum);
 
@@ -1090,7 +1096,7 @@ TraceCPU::FixedRetryGen::send(Addr addr, unsigned size, const MemCmd& cmd,
 {
 
     // Create new request
-    auto req = std::make_shared<Request>(addr, size, flags, requestorId);
+    auto req = Request::make(addr, size, flags, requestorId);
     req->setPC(pc);
 
     // If this is not done it triggers assert in L1 cache for invalid contextId
@@ -1195,14 +1201,35 @@ TraceCPU::DcachePort::recvReqRetry()
 }
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
-        const std::string& filename, const double time_multiplier) :
-    trace(filename),
+        const std::string& filename, const double time_multiplier,
+        uint64_t profile_length, uint32_t profile_seed) :
     timeMultiplier(time_multiplier),
     microOpCount(0)
 {
+    if (DepProfileInputStream::isDepProfile(filename)) {
+        profile = std::make_unique<DepProfileInputStream>(
+            filename, profile_length, profile_seed);
+        panic_if(profile->header().tickFreq != sim_clock::Frequency,
+                 "Profile %s was made with a different tick frequency %d\n",
+                 filename, profile->header().tickFreq);
+        windowSize = profile->header().windowSize;
+        return;
+    }
+
+    if (DepTraceStream::isDepTrace(filename)) {
+        depTrace = std::make_unique<DepTraceInputStream>(filename);
+        panic_if(depTrace->header().tickFreq != sim_clock::Frequency,
+                 "Trace %s was recorded with a different tick frequency %d\n",
+                 filename, depTrace->header().tickFreq);
+        windowSize = depTrace->header().windowSize;
+        return;
+    }
+
+    trace = std::make_unique<ProtoInputStream>(filename);
+
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::InstDepRecordHeader header_msg;
-    if (!trace.read(header_msg)) {
+    if (!trace->read(header_msg)) {
         panic("Failed to read packet header from %s\n", filename);
 
         if (header_msg.tick_freq() != sim_clock::Frequency) {
@@ -1219,14 +1246,22 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
-    trace.reset();
+    if (profile)
+        profile->reset();
+    else if (depTrace)
+        depTrace->reset();
+    else
+        trace->reset();
 }
 
 bool
 TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
 {
+    if (depTrace || profile)
+        return readDepRecord(element);
+
     ProtoMessage::InstDepRecord pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (trace->read(pkt_msg)) {
         // Required fields
         element->seqNum = pkt_msg.seq_num();
         element->type = pkt_msg.type();
@@ -1292,6 +1327,49 @@ TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
     return false;
 }
 
+bool
+TraceCPU::ElasticDataGen::InputStream::readDepRecord(GraphNode* element)
+{
+    if (!(profile ? profile->read(depRecord) : depTrace->read(depRecord))) {
+        // We have reached the end of the file
+        return false;
+    }
+
+    element->seqNum = depRecord.seqNum;
+    element->type = RecordType(depRecord.type);
+    // Scale the compute delay to effectively scale the Trace CPU frequency
+    element->compDelay = depRecord.compDelay * timeMultiplier;
+
+    element->robDep.clear();
+    for (auto dep : depRecord.robDep)
+        element->robDep.push_back(dep);
+
+    // As for the protobuf trace, a register dependency which is also an
+    // order dependency is omitted
+    element->regDep.clear();
+    for (auto reg_dep : depRecord.regDep) {
+        bool duplicate = false;
+        for (auto &dep: element->robDep) {
+            duplicate |= (reg_dep == dep);
+        }
+        if (!duplicate)
+            element->regDep.push_back(reg_dep);
+    }
+
+    // The fields which are optional in the protobuf trace are 0 if not set
+    element->physAddr = depRecord.pAddr;
+    element->virtAddr = depRecord.vAddr;
+    element->size = depRecord.size;
+    element->flags = depRecord.flags;
+    element->pc = depRecord.pc;
+
+    // ROB occupancy number
+    ++microOpCount;
+    microOpCount += depRecord.weight;
+    element->robNum = microOpCount;
+    return true;
+}
+
 bool
 TraceCPU::ElasticDataGen::GraphNode::removeRegDep(NodeSeqNum reg_dep)
 {
@@ -1379,11 +1457,14 @@ TraceCPU::ElasticDataGen::GraphNode::typeToStr() const
 }
 
 TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
-    : trace(filename)
 {
+    if (filename.empty())
+        return;
+    trace = std::make_unique<ProtoInputStream>(filename);
+
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::PacketHeader header_msg;
-    if (!trace.read(header_msg)) {
+    if (!trace->read(header_msg)) {
         panic("Failed to read packet header from %s\n", filename);
 
         if (header_msg.tick_freq() != sim_clock::Frequency) {
@@ -1396,14 +1477,15 @@ TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
 void
 TraceCPU::FixedRetryGen::InputStream::reset()
 {
-    trace.reset();
+    if (trace)
+        trace->reset();
 }
 
 bool
 TraceCPU::FixedRetryGen::InputStream::read(TraceElement* element)
 {
     ProtoMessage::Packet pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (trace && trace->read(pkt_msg)) {
         element->cmd = pkt_msg.cmd();
         element->addr = pkt_msg.addr();
         element->blocksize = pkt_msg.size();
@@ -40,12 +40,15 @@
 
 #include <cstdint>
 #include <list>
+#include <memory>
 #include <queue>
 #include <set>
 #include <unordered_map>
 
 #include "base/statistics.hh"
 #include "cpu/base.hh"
+#include "cpu/trace/dep_profile.hh"
+#include "cpu/trace/dep_trace_io.hh"
 #include "debug/TraceCPUData.hh"
 #include "debug/TraceCPUInst.hh"
 #include "params/TraceCPU.hh"
@@ -137,6 +140,13 @@ namespace gem5
  * A CountedExitEvent that contains a static int belonging to the Trace CPU
  * class as a down counter is used to implement multi Trace CPU simulation
  * exit.
+ *
+ * Instead of a data trace, the Trace CPU can replay a statistical profile of
+ * one (see DepProfileInputStream), which holds the instruction mix and the
+ * dependency distance, compute delay, access size and reuse distance
+ * distributions. The records are synthesized from the profile as they are
+ * read, and issued by the same dependency graph engine as a trace. Without an
+ * instruction trace, the Trace CPU does not fetch.
  */
 
 class TraceCPU : public BaseCPU
@@ -374,14 +384,15 @@ class TraceCPU : public BaseCPU
         class InputStream
         {
           private:
-            // Input file stream for the protobuf trace
-            ProtoInputStream trace;
+            // Input file stream for the protobuf trace, null without one
+            std::unique_ptr<ProtoInputStream> trace;
 
           public:
             /**
              * Create a trace input stream for a given file name.
              *
-             * @param filename Path to the file to read from
+             * @param filename Path to the file to read from, or empty to
+             *                 read nothing
              */
             InputStream(const std::string& filename);
 
@@ -762,7 +773,22 @@ class TraceCPU : public BaseCPU
         {
           private:
             /** Input file stream for the protobuf trace */
-            ProtoInputStream trace;
+            std::unique_ptr<ProtoInputStream> trace;
+
+            /**
+             * Input file stream for the columnar trace, used instead of
+             * trace if the file is one
+             */
+            std::unique_ptr<DepTraceInputStream> depTrace;
+
+            /**
+             * The statistical profile synthesizing the records, used instead
+             * of trace if the file is one
+             */
+            std::unique_ptr<DepProfileInputStream> profile;
+
+            /** Record reused to read from depTrace or profile */
+            DepTraceRecord depRecord;
 
             /**
              * A multiplier for the compute delays in the trace to modulate
@@ -787,9 +813,13 @@ class TraceCPU : public BaseCPU
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param profile_length number of records synthesized if the
+             *                       file is a statistical profile
+             * @param profile_seed seed used to synthesize the records
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier,
+                        uint64_t profile_length, uint32_t profile_seed);
 
             /**
              * Reset the stream such that it can be played once
@@ -808,6 +838,14 @@ class TraceCPU : public BaseCPU
              */
             bool read(GraphNode* element);
 
+            /**
+             * Read a trace element from the columnar trace or the profile.
+             *
+             * @param element Trace element to populate
+             * @return True if an element could be read successfully
+             */
+            bool readDepRecord(GraphNode* element);
+
             /** Get window size from trace */
             uint32_t getWindowSize() const { return windowSize; }
 
@@ -824,7 +862,8 @@ class TraceCPU : public BaseCPU
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file, 1.0 / params.freqMultiplier),
+            trace(trace_file, 1.0 / params.freqMultiplier,
+                  params.profileLength, params.profileSeed),
             genName(owner.name() + ".elastic." + _name),
             retryPkt(nullptr),
             traceComplete(false),
@@ -111,6 +111,12 @@ class DmaDevice(PioDevice):
         "Substream identifier used by an IOMMU to distinguish amongst "
         "several devices attached to it",
     )
+    dma_burst_size = Param.MemorySize32(
+        "0B",
+        "Largest DMA packet, a power of two, 0 to use the cache line size. "
+        "Bursts larger than a line must only be used when the DMA path "
+        "has no caches, bursts are then issued one line per cycle",
+    )
 
     def addIommuProperty(self, state, node):
         """
@@ -281,8 +281,8 @@ AMDGPUDevice::readFrame(PacketPtr pkt, Addr offset)
      * because this method is called by the PCIDevice::read method which
      * is a non-timing read.
      */
-    RequestPtr req = std::make_shared<Request>(offset, pkt->getSize(), 0,
-                                               vramRequestorId());
+    RequestPtr req = Request::make(offset, pkt->getSize(), 0,
+                                   vramRequestorId());
     PacketPtr readPkt = Packet::createRead(req);
     uint8_t *dataPtr = new uint8_t[pkt->getSize()];
     readPkt->dataDynamic(dataPtr);
@@ -653,7 +653,10 @@ class HDLcd(AmbaDmaDevice):
     pixel_buffer_size = Param.MemorySize32("2KiB", "Size of address range")
 
     pxl_clk = Param.ClockDomain("Pixel clock source")
-    pixel_chunk = Param.Unsigned(32, "Number of pixels to handle in one batch")
+    pixel_chunk = Param.Unsigned(
+        32,
+        "Number of pixels to handle in one batch, 0 to handle a whole line",
+    )
     virt_refresh_rate = Param.Frequency(
         "20Hz", "Frame refresh rate in KVM mode"
     )
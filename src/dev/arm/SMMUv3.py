@@ -118,6 +118,11 @@ class SMMUv3(ClockedObject):
     # SMMU parameters
     xlate_slots = Param.Unsigned(64, "SMMU translation slots")
     ptw_slots = Param.Unsigned(16, "SMMU page table walk slots")
+    ptw_coalesce = Param.Bool(
+        False,
+        "Coalesce concurrent main TLB misses to the same page coming "
+        "from different device interfaces into a single table walk",
+    )
 
     request_port_width = Param.Unsigned(
         16, "Request port width in bytes (= 1 beat)"
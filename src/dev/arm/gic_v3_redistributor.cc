@@ -40,7 +40,10 @@
 
 #include "dev/arm/gic_v3_redistributor.hh"
 
+#include <vector>
+
 #include "arch/arm/utility.hh"
+#include "base/bitfield.hh"
 #include "base/compiler.hh"
 #include "debug/GIC.hh"
 #include "dev/arm/gic_v3_cpu_interface.hh"
@@ -77,6 +80,7 @@ Gicv3Redistributor::Gicv3Redistributor(Gicv3 * gic, uint32_t cpu_id)
       lpiConfigurationTablePtr(0),
       lpiIDBits(0),
       lpiPendingTablePtr(0),
+      pendingLPIsValid(false),
       addrRangeSize(gic->params().gicv4 ? 0x40000 : 0x20000)
 {
 }
@@ -414,6 +418,7 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
       case GICR_CTLR: {
           // GICR_TYPER.LPIS is 0 so EnableLPIs is RES0
           EnableLPIs = data & GICR_CTLR_ENABLE_LPIS;
+          invalidatePendingLPIs();
           DPG1S = data & GICR_CTLR_DPG1S;
           DPG1NS = data & GICR_CTLR_DPG1NS;
           DPG0 = data & GICR_CTLR_DPG0;
@@ -674,6 +679,7 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
               lpiIDBits = 0xf;
           }
 
+          invalidatePendingLPIs();
           break;
       }
 
@@ -691,6 +697,7 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
         // InnerCache, bits [9:7]
         //   000 Device-nGnRnE
         lpiPendingTablePtr = data & 0xFFFFFFFFF0000;
+        invalidatePendingLPIs();
         break;
 
       case GICR_INVLPIR: { // Redistributor Invalidate LPI Register
@@ -829,38 +836,31 @@ Gicv3Redistributor::update()
     if (EnableLPIs) {
 
         const uint32_t largest_lpi_id = 1 << (lpiIDBits + 1);
-        const uint32_t number_lpis = largest_lpi_id - SMALLEST_LPI_ID + 1;
-
-        uint8_t lpi_pending_table[largest_lpi_id / 8];
-        uint8_t lpi_config_table[number_lpis];
 
-        memProxy->readBlob(lpiPendingTablePtr,
-                           lpi_pending_table,
-                           sizeof(lpi_pending_table));
+        // LPIs are always Non-secure Group 1 interrupts,
+        // in a system where two Security states are enabled.
+        Gicv3::GroupId lpi_group = Gicv3::G1NS;
+        bool group_enabled = distributor->groupEnabled(lpi_group);
 
-        memProxy->readBlob(lpiConfigurationTablePtr,
-                           lpi_config_table,
-                           sizeof(lpi_config_table));
+        if (!pendingLPIsValid)
+            rebuildPendingLPIs();
 
-        for (int lpi_id = SMALLEST_LPI_ID; lpi_id < largest_lpi_id;
-             lpi_id++) {
-            uint32_t lpi_pending_entry_byte = lpi_id / 8;
-            uint8_t lpi_pending_entry_bit_position = lpi_id % 8;
-            bool lpi_is_pending = lpi_pending_table[lpi_pending_entry_byte] &
-                                  1 << lpi_pending_entry_bit_position;
+        // Only pending LPIs can be selected: skip reading and scanning
+        // the whole pending and configuration tables.
+        for (auto it = pendingLPIs.begin();
+             group_enabled && it != pendingLPIs.end() &&
+             *it < largest_lpi_id; ++it) {
+            const uint32_t lpi_id = *it;
             uint32_t lpi_configuration_entry_index = lpi_id - SMALLEST_LPI_ID;
 
-            LPIConfigurationTableEntry config_entry =
-                lpi_config_table[lpi_configuration_entry_index];
+            LPIConfigurationTableEntry config_entry = 0;
+            memProxy->readBlob(
+                lpiConfigurationTablePtr + lpi_configuration_entry_index,
+                &config_entry, sizeof(config_entry));
 
             bool lpi_is_enable = config_entry.enable;
 
-            // LPIs are always Non-secure Group 1 interrupts,
-            // in a system where two Security states are enabled.
-            Gicv3::GroupId lpi_group = Gicv3::G1NS;
-            bool group_enabled = distributor->groupEnabled(lpi_group);
-
-            if (lpi_is_pending && lpi_is_enable && group_enabled) {
+            if (lpi_is_enable) {
                 uint8_t lpi_priority = config_entry.priority << 2;
 
                 if ((lpi_priority < cpuInterface->hppi.prio) ||
@@ -884,6 +884,31 @@ Gicv3Redistributor::update()
     }
 }
 
+void
+Gicv3Redistributor::rebuildPendingLPIs()
+{
+    pendingLPIs.clear();
+    pendingLPIsValid = true;
+
+    if (!EnableLPIs)
+        return;
+
+    const uint32_t largest_lpi_id = 1 << (lpiIDBits + 1);
+    if (largest_lpi_id <= SMALLEST_LPI_ID)
+        return;
+
+    std::vector<uint8_t> lpi_pending_table(largest_lpi_id / 8);
+    memProxy->readBlob(lpiPendingTablePtr,
+                       lpi_pending_table.data(),
+                       lpi_pending_table.size());
+
+    for (uint32_t byte = SMALLEST_LPI_ID / 8;
+         byte < lpi_pending_table.size(); byte++) {
+        for (uint8_t bits = lpi_pending_table[byte]; bits; bits &= bits - 1)
+            pendingLPIs.insert(byte * 8 + findLsbSet(bits));
+    }
+}
+
 uint8_t
 Gicv3Redistributor::readEntryLPI(uint32_t lpi_id)
 {
@@ -951,6 +976,7 @@ Gicv3Redistributor::setClrLPI(uint64_t data, bool set)
         }
 
         lpi_pending_entry |= 1 << (lpi_pending_entry_bit_position);
+        pendingLPIs.insert(lpi_id);
     } else {
         if (!is_set) {
             // Writes to GICR_SETLPIR have not effect if the pINTID field
@@ -959,6 +985,7 @@ Gicv3Redistributor::setClrLPI(uint64_t data, bool set)
         }
 
         lpi_pending_entry &= ~(1 << (lpi_pending_entry_bit_position));
+        pendingLPIs.erase(lpi_id);
 
         // Remove the pending state from the cpu interface
         cpuInterface->resetHppi(lpi_id);
@@ -1113,6 +1140,9 @@ Gicv3Redistributor::unserialize(CheckpointIn & cp)
     UNSERIALIZE_SCALAR(lpiConfigurationTablePtr);
     UNSERIALIZE_SCALAR(lpiIDBits);
     UNSERIALIZE_SCALAR(lpiPendingTablePtr);
+
+    // Memory may not be restored yet: read the pending table lazily
+    invalidatePendingLPIs();
 }
 
 } // namespace gem5
@@ -41,6 +41,8 @@
 #ifndef __DEV_ARM_GICV3_REDISTRIBUTOR_H__
 #define __DEV_ARM_GICV3_REDISTRIBUTOR_H__
 
+#include <set>
+
 #include "base/addr_range.hh"
 #include "dev/arm/gic_v3.hh"
 #include "sim/serialize.hh"
@@ -175,6 +177,18 @@ class Gicv3Redistributor : public Serializable
     uint8_t lpiIDBits;
     Addr lpiPendingTablePtr;
 
+    /**
+     * Shadow copy of the pending LPIs in the in-memory pending table,
+     * so that update() only visits pending LPIs instead of reading and
+     * scanning the whole table. It is rebuilt from memory whenever
+     * the table may have changed behind our back.
+     */
+    std::set<uint32_t> pendingLPIs;
+    bool pendingLPIsValid;
+
+    void invalidatePendingLPIs() { pendingLPIsValid = false; }
+    void rebuildPendingLPIs();
+
     BitUnion8(LPIConfigurationTableEntry)
         Bitfield<7, 2> priority;
         Bitfield<1> res1;
@@ -37,6 +37,8 @@
 
 #include "dev/arm/hdlcd.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
@@ -508,6 +510,23 @@ HDLcd::pxlNext(Pixel &p)
     }
 }
 
+size_t
+HDLcd::pxlNextChunk(std::vector<Pixel>::iterator pixel_it, size_t count)
+{
+    // Pull as many whole pixels as the FIFO holds in one go rather
+    // than one pixel at a time. Anything short of count is an
+    // underrun that the pixel pump handles.
+    const size_t avail = std::min(count, dmaEngine->size() / conv.length);
+    if (!avail)
+        return 0;
+
+    lineBuffer.resize(avail * conv.length);
+    dmaEngine->get(lineBuffer.data(), lineBuffer.size());
+    conv.toPixels(&*pixel_it, lineBuffer.data(), avail);
+
+    return avail;
+}
+
 size_t
 HDLcd::lineNext(std::vector<Pixel>::iterator pixel_it, size_t line_length)
 {
@@ -518,11 +537,7 @@ HDLcd::lineNext(std::vector<Pixel>::iterator pixel_it, size_t line_length)
 
     bypassLineAddress += fb_line_pitch;
 
-    uint8_t *bufPtr = lineBuffer.data();
-    for (size_t i = 0; i < line_length; i++) {
-        *pixel_it++ = conv.toPixel(bufPtr);
-        bufPtr += conv.length;
-    }
+    conv.toPixels(&*pixel_it, lineBuffer.data(), line_length);
 
     return line_length;
 }
@@ -570,7 +585,10 @@ HDLcd::pxlFrameDone()
     if (vnc)
         vnc->setDirty();
 
-    if (enableCapture) {
+    // The capture only holds the latest frame, so there is nothing
+    // to do unless the image changed.
+    const uint64_t hash = enableCapture ? pixelPump.fb.getHash() : 0;
+    if (enableCapture && (!pic || hash != picHash)) {
         if (!pic) {
             pic = simout.create(
                 csprintf("%s.framebuffer.%s",
@@ -581,6 +599,7 @@ HDLcd::pxlFrameDone()
         assert(pic);
         pic->stream()->seekp(0);
         imgWriter->write(*pic->stream());
+        picHash = hash;
     }
 }
 
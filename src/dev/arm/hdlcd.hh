@@ -274,6 +274,7 @@ class HDLcd: public AmbaDmaDevice
 
   public: // Pixel pump callbacks
     bool pxlNext(Pixel &p);
+    size_t pxlNextChunk(std::vector<Pixel>::iterator pixel_it, size_t count);
     size_t lineNext(std::vector<Pixel>::iterator pixel_it, size_t line_length);
     void pxlVSyncBegin();
     void pxlVSyncEnd();
@@ -342,6 +343,12 @@ class HDLcd: public AmbaDmaDevice
       protected:
         bool nextPixel(Pixel &p) override { return parent.pxlNext(p); }
         size_t
+        nextPixels(std::vector<Pixel>::iterator pixel_it,
+                   size_t count) override
+        {
+            return parent.pxlNextChunk(pixel_it, count);
+        }
+        size_t
         nextLine(std::vector<Pixel>::iterator pixel_it,
                  size_t line_length) override
         {
@@ -378,6 +385,9 @@ class HDLcd: public AmbaDmaDevice
     /** Picture of what the current frame buffer looks like */
     OutputStream *pic = nullptr;
 
+    /** Hash of the frame last written to pic */
+    uint64_t picHash = 0;
+
     /** Cached pixel converter, set when the converter is enabled. */
     PixelConverter conv = PixelConverter::rgba8888_le;
 
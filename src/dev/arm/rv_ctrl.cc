@@ -275,11 +275,7 @@ RealViewOsc::clockPeriod(Tick clock_period)
 {
     panic_if(clock_period == 0, "%s has a clock period of zero\n", name());
 
-    // Align all members to the current tick
-    for (auto m : members)
-        m->updateClockPeriod();
-
-    _clockPeriod = clock_period;
+    changeClockPeriod(clock_period);
 
     // inform any derived clocks they need to updated their period
     for (auto m : children)
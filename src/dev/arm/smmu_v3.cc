@@ -75,6 +75,7 @@ SMMUv3::SMMUv3(const SMMUv3Params &params) :
     configCacheEnable(params.cfg_enable),
     ipaCacheEnable(params.ipa_enable),
     walkCacheEnable(params.walk_enable),
+    ptwCoalesceEnable(params.ptw_coalesce),
     tableWalkPortEnable(false),
     walkCacheNonfinalEnable(params.wc_nonfinal_enable),
     walkCacheS1Levels(params.wc_s1_levels),
@@ -741,7 +742,9 @@ SMMUv3::SMMUv3Stats::SMMUv3Stats(statistics::Group *parent)
     ADD_STAT(translationTimeDist, statistics::units::Tick::get(),
         "Time to translate address"),
     ADD_STAT(ptwTimeDist, statistics::units::Tick::get(),
-        "Time to walk page tables")
+        "Time to walk page tables"),
+    ADD_STAT(coalescedWalks, statistics::units::Count::get(),
+        "Table walks avoided by waiting on an identical walk")
 {
     using namespace statistics;
 
@@ -764,6 +767,9 @@ SMMUv3::SMMUv3Stats::SMMUv3Stats(statistics::Group *parent)
     ptwTimeDist
         .init(0, 2000000, 2000)
         .flags(pdf);
+
+    coalescedWalks
+        .flags(pdf);
 }
 
 DrainState
@@ -108,6 +108,7 @@ class SMMUv3 : public ClockedObject
     const bool configCacheEnable;
     const bool ipaCacheEnable;
     const bool walkCacheEnable;
+    const bool ptwCoalesceEnable;
     bool tableWalkPortEnable;
 
     const bool walkCacheNonfinalEnable;
@@ -127,6 +128,11 @@ class SMMUv3 : public ClockedObject
     SMMUSemaphore ptwSem; // max N concurrent PTWs
     SMMUSemaphore cycleSem; // max 1 table walk per cycle
 
+    // Main TLB misses being walked, used to coalesce identical walks
+    // issued by different device interfaces
+    std::list<SMMUTranslationProcess *> pendingWalks;
+    SMMUSignal pendingWalkRemoved;
+
     // Timing parameters
     const Cycles tlbLat;
     const Cycles ifcSmmuLat;
@@ -145,6 +151,7 @@ class SMMUv3 : public ClockedObject
         statistics::Scalar cdFetches;
         statistics::Distribution translationTimeDist;
         statistics::Distribution ptwTimeDist;
+        statistics::Scalar coalescedWalks;
     } stats;
 
     std::vector<SMMUv3DeviceInterface *> deviceInterfaces;
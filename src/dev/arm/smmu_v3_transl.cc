@@ -37,7 +37,10 @@
 
 #include "dev/arm/smmu_v3_transl.hh"
 
+#include <algorithm>
+
 #include "arch/arm/pagetable.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "debug/SMMUv3.hh"
 #include "debug/SMMUv3Hazard.hh"
 #include "dev/arm/amba.hh"
@@ -274,8 +277,17 @@ SMMUTranslationProcess::smmuTranslation(Yield &yield)
         }
     }
 
-    if (haveConfig && !smmuTLBLookup(yield, tr)) {
+    bool tlbHit = haveConfig && smmuTLBLookup(yield, tr);
+
+    // Another interface may already be walking the same page
+    if (haveConfig && !tlbHit && smmu.ptwCoalesceEnable && smmu.tlbEnable)
+        tlbHit = walkCoalesceHold(yield, tr);
+
+    if (haveConfig && !tlbHit) {
         // SMMU main TLB miss
+        bool coalesce = smmu.ptwCoalesceEnable && smmu.tlbEnable;
+        if (coalesce)
+            walkCoalesceRegister();
 
         // Need PTW slot to proceed
         doSemaphoreDown(yield, smmu.ptwSem);
@@ -299,6 +311,9 @@ SMMUTranslationProcess::smmuTranslation(Yield &yield)
 
         if (tr.fault == FAULT_NONE)
             smmuTLBUpdate(yield, tr);
+
+        if (coalesce)
+            walkCoalesceRelease();
     }
 
     // Simulate pipelined SMMU->RESPONSE INTERFACE link
@@ -1132,6 +1147,74 @@ SMMUTranslationProcess::hazard4kRelease()
     doBroadcastSignal(ifc.duplicateReqRemoved);
 }
 
+bool
+SMMUTranslationProcess::walkCoalesceHold(Yield &yield, TranslResult &tr)
+{
+    Addr addr4k = request.addr & ~0xfffULL;
+
+    bool found_walk;
+
+    do {
+        found_walk = false;
+
+        for (auto *other : smmu.pendingWalks) {
+            if (other->request.sid != request.sid ||
+                other->request.ssid != request.ssid ||
+                other->context.asid != context.asid ||
+                other->context.vmid != context.vmid ||
+                (other->request.addr & ~0xfffULL) != addr4k)
+                continue;
+
+            DPRINTF(SMMUv3Hazard, "PTWHold: p=%p a4k=%#x WAIT on p=%p\n",
+                    this, addr4k, other);
+
+            doWaitForSignal(yield, smmu.pendingWalkRemoved);
+
+            DPRINTF(SMMUv3Hazard, "PTWHold: p=%p a4k=%#x RESUME\n",
+                    this, addr4k);
+
+            // The walk we waited on is either in the main TLB now or
+            // it faulted, in which case we walk ourselves.
+            if (smmuTLBLookup(yield, tr)) {
+                smmu.stats.coalescedWalks++;
+                return true;
+            }
+
+            // The list may have changed while we were waiting.
+            found_walk = true;
+            break;
+        }
+    } while (found_walk);
+
+    return false;
+}
+
+void
+SMMUTranslationProcess::walkCoalesceRegister()
+{
+    DPRINTF(SMMUv3Hazard, "PTWReg: p=%p a4k=%#x\n",
+            this, request.addr & ~0xfffULL);
+
+    smmu.pendingWalks.push_back(this);
+}
+
+void
+SMMUTranslationProcess::walkCoalesceRelease()
+{
+    DPRINTF(SMMUv3Hazard, "PTWRel: p=%p a4k=%#x\n",
+            this, request.addr & ~0xfffULL);
+
+    auto it = std::find(smmu.pendingWalks.begin(),
+                        smmu.pendingWalks.end(), this);
+
+    if (it == smmu.pendingWalks.end())
+        panic("walkCoalesceRelease: request not found");
+
+    smmu.pendingWalks.erase(it);
+
+    doBroadcastSignal(smmu.pendingWalkRemoved);
+}
+
 void
 SMMUTranslationProcess::hazardIdRegister()
 {
@@ -1277,6 +1360,10 @@ SMMUTranslationProcess::completeTransaction(Yield &yield,
     a.pkt->setAddr(tr.addr);
     a.pkt->req->setPaddr(tr.addr);
 
+    // The DMA port only saw the untranslated address of a write
+    if (a.pkt->isWrite())
+        FetchBackdoor::written(tr.addr, a.pkt->getSize());
+
     yield(a);
 
     if (!request.isAtsRequest) {
@@ -156,6 +156,15 @@ class SMMUTranslationProcess : public SMMUProcess
     void hazard4kHold(Yield &yield);
     void hazard4kRelease();
 
+    /**
+     * Used to coalesce main TLB misses with the same
+     * (SID, SSID, ASID, VMID, 4k page) coming from different
+     * device interfaces into a single page-table walk.
+     */
+    bool walkCoalesceHold(Yield &yield, TranslResult &tr);
+    void walkCoalesceRegister();
+    void walkCoalesceRelease();
+
     /**
      * Used to force ordering on transactions with the same orderId.
      * This attempts to model AXI IDs.
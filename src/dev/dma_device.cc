@@ -47,6 +47,7 @@
 
 #include "base/logging.hh"
 #include "base/trace.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "debug/DMA.hh"
 #include "debug/Drain.hh"
 #include "sim/clocked_object.hh"
@@ -56,12 +57,17 @@ namespace gem5
 {
 
 DmaPort::DmaPort(ClockedObject *dev, System *s,
-                 uint32_t sid, uint32_t ssid)
+                 uint32_t sid, uint32_t ssid, Addr burst_size)
     : RequestPort(dev->name() + ".dma"),
       device(dev), sys(s), requestorId(s->getRequestorId(dev)),
       sendEvent([this]{ sendDma(); }, dev->name()),
-      defaultSid(sid), defaultSSid(ssid), cacheLineSize(s->cacheLineSize())
-{ }
+      defaultSid(sid), defaultSSid(ssid), cacheLineSize(s->cacheLineSize()),
+      burstSize(burst_size ? burst_size : cacheLineSize)
+{
+    fatal_if(!isPowerOf2(burstSize),
+             "%s: DMA burst size %d is not a power of two.",
+             dev->name(), burstSize);
+}
 
 void
 DmaPort::handleRespPacket(PacketPtr pkt, Tick delay)
@@ -123,10 +129,54 @@ DmaPort::handleResp(DmaReqState *state, Addr addr, Addr size, Tick delay)
         signalDrainDone();
 }
 
+namespace
+{
+
+Addr
+totalSize(const DmaPort::SegmentList &segments)
+{
+    Addr total = 0;
+    for (const auto &seg: segments)
+        total += seg.size;
+    return total;
+}
+
+} // anonymous namespace
+
+DmaPort::DmaReqState::DmaReqState(Packet::Command _cmd,
+        SegmentList _segments, Addr chunk_sz, uint8_t *_data,
+        Request::Flags _flags, RequestorID _id, uint32_t _sid,
+        uint32_t _ssid, Event *ce, Tick _delay)
+    : completionEvent(ce), abortEvent(nullptr),
+      totBytes(totalSize(_segments)), delay(_delay),
+      gen(_segments.empty() ? 0 : _segments.front().addr,
+          _segments.empty() ? 0 : _segments.front().size, chunk_sz),
+      segments(std::move(_segments)), chunkSize(chunk_sz), data(_data),
+      flags(_flags), id(_id), sid(_sid), ssid(_ssid), cmd(_cmd)
+{
+    if (segments.empty())
+        segments.push_back({0, 0});
+}
+
+bool
+DmaPort::DmaReqState::next()
+{
+    if (gen.next())
+        return true;
+    if (segment + 1 == segments.size())
+        return false;
+
+    segmentStart += segments[segment].size;
+    segment++;
+    gen = ChunkGenerator(segments[segment].addr, segments[segment].size,
+                         chunkSize);
+    return true;
+}
+
 PacketPtr
 DmaPort::DmaReqState::createPacket()
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
             gen.addr(), gen.size(), flags, id);
     req->setStreamId(sid);
     req->setSubstreamId(ssid);
@@ -134,8 +184,13 @@ DmaPort::DmaReqState::createPacket()
 
     PacketPtr pkt = new Packet(req, cmd);
 
+    // The written data may sit in caches rather than in memory, so it
+    // must not be fetched through a fetch backdoor
+    if (pkt->isWrite())
+        FetchBackdoor::written(gen.addr(), gen.size());
+
     if (data)
-        pkt->dataStatic(data + gen.complete());
+        pkt->dataStatic(data + complete());
 
     pkt->senderState = this;
     return pkt;
@@ -154,7 +209,7 @@ DmaPort::recvTimingResp(PacketPtr pkt)
 }
 
 DmaDevice::DmaDevice(const Params &p)
-    : PioDevice(p), dmaPort(this, sys, p.sid, p.ssid)
+    : PioDevice(p), dmaPort(this, sys, p.sid, p.ssid, p.dma_burst_size)
 { }
 
 void
@@ -193,10 +248,10 @@ DmaPort::dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
             event ? event->scheduled() : -1);
 
     // One DMA request sender state for every action, that is then
-    // split into many requests and packets based on the block size,
-    // i.e. cache line size.
+    // split into many requests and packets based on the burst size,
+    // i.e. cache line size unless configured otherwise.
     transmitList.push_back(
-            new DmaReqState(cmd, addr, cacheLineSize, size,
+            new DmaReqState(cmd, addr, burstSize, size,
                 data, flag, requestorId, sid, ssid, event, delay));
 
     // In zero time, also initiate the sending of the packets for the request
@@ -213,6 +268,38 @@ DmaPort::dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
               defaultSid, defaultSSid, delay, flag);
 }
 
+void
+DmaPort::dmaAction(Packet::Command cmd, const SegmentList &segments,
+                   Event *event, uint8_t *data, uint32_t sid, uint32_t ssid,
+                   Tick delay, Request::Flags flag)
+{
+    // Empty pieces would never produce a packet, and so a response.
+    SegmentList pieces;
+    pieces.reserve(segments.size());
+    for (const auto &seg: segments) {
+        if (seg.size)
+            pieces.push_back(seg);
+    }
+
+    DPRINTF(DMA, "Starting scatter-gather DMA of %d pieces sched: %d\n",
+            pieces.size(), event ? event->scheduled() : -1);
+
+    transmitList.push_back(
+            new DmaReqState(cmd, std::move(pieces), burstSize, data, flag,
+                requestorId, sid, ssid, event, delay));
+
+    sendDma();
+}
+
+void
+DmaPort::dmaAction(Packet::Command cmd, const SegmentList &segments,
+                   Event *event, uint8_t *data, Tick delay,
+                   Request::Flags flag)
+{
+    dmaAction(cmd, segments, event, data, defaultSid, defaultSSid, delay,
+              flag);
+}
+
 void
 DmaPort::abortPending()
 {
@@ -223,7 +310,7 @@ DmaPort::abortPending()
 
     if (pendingCount && !transmitList.empty()) {
         auto *state = transmitList.front();
-        if (state->numBytes != state->gen.complete()) {
+        if (state->numBytes != state->complete()) {
             // In flight packets refer to the transmission at the front of the
             // list, and not a transmission whose packets have all been sent
             // but not completed. Preserve the state so the packets don't have
@@ -264,7 +351,8 @@ DmaPort::trySendTimingReq()
 
     // Check if this was the last packet now, since hypothetically the packet
     // response may come immediately, and state may be deleted.
-    bool last = state->gen.last();
+    bool last = state->last();
+    const Addr size = pkt->getSize();
     if (sendTimingReq(pkt)) {
         pendingCount++;
     } else {
@@ -272,7 +360,7 @@ DmaPort::trySendTimingReq()
         inRetry = pkt;
     }
     if (!retryPending) {
-        state->gen.next();
+        state->next();
         // If that was the last packet from this request, pop it from the list.
         if (last)
             transmitList.pop_front();
@@ -281,8 +369,10 @@ DmaPort::trySendTimingReq()
         if (!transmitList.empty()) {
             // This should ultimately wait for as many cycles as the device
             // needs to send the packet, but currently the port does not have
-            // any known width so simply wait a single cycle.
-            device->schedule(sendEvent, device->clockEdge(Cycles(1)));
+            // any known width so simply wait a cycle per cache line. Bursts
+            // then take as long to issue as line-sized packets would.
+            device->schedule(sendEvent, device->clockEdge(
+                        Cycles(divCeil(size, (Addr)cacheLineSize))));
         }
     } else {
         DPRINTF(DMA, "-- Failed, waiting for retry\n");
@@ -302,7 +392,7 @@ DmaPort::sendAtomicReq(DmaReqState *state)
     Tick lat = sendAtomic(pkt);
 
     // Check if we're done, since handleResp may delete state.
-    bool done = !state->gen.next();
+    bool done = !state->next();
     handleRespPacket(pkt, lat);
     return done;
 }
@@ -341,7 +431,7 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
         }
 
         // Check if we're done now, since handleResp may delete state.
-        done = !state->gen.next();
+        done = !state->next();
         handleRespPacket(pkt, lat);
     } else {
         // We have a backdoor that can at least partially satisfy this request.
@@ -351,8 +441,8 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
         const auto *bd = bd_it->second;
         // Offset of this access into the backdoor.
         const Addr offset = state->gen.addr() - bd->range().start();
-        // How many bytes we still need.
-        const Addr remaining = state->totBytes - state->gen.complete();
+        // How many bytes we still need from this piece.
+        const Addr remaining = state->segmentLeft();
         // How many bytes this backdoor can provide, starting from offset.
         const Addr available = bd->range().size() - offset;
 
@@ -362,7 +452,7 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
         // If there's a buffer for data, read/write it.
         if (state->data) {
             uint8_t *bd_data = bd->ptr() + offset;
-            uint8_t *state_data = state->data + state->gen.complete();
+            uint8_t *state_data = state->data + state->complete();
             if (MemCmd(state->cmd).isRead())
                 memcpy(state_data, bd_data, handled);
             else
@@ -373,8 +463,9 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
         state->gen.setNext(state->gen.addr() + handled);
 
         // Check if we're done now, since handleResp may delete state.
-        done = !state->gen.next();
-        handleResp(state, state->gen.addr(), handled);
+        const Addr addr = state->gen.addr();
+        done = !state->next();
+        handleResp(state, addr, handled);
     }
 
     return done;
@@ -404,7 +495,7 @@ DmaPort::sendDma()
             DmaReqState *state = transmitList.front();
             transmitList.pop_front();
 
-            bool done = state->gen.done();
+            bool done = state->done();
             while (!done)
                 done = bypass ? sendAtomicBdReq(state) : sendAtomicReq(state);
         }
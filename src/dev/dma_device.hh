@@ -43,6 +43,7 @@
 
 #include <deque>
 #include <memory>
+#include <vector>
 
 #include "base/addr_range_map.hh"
 #include "base/chunk_generator.hh"
@@ -60,6 +61,15 @@ class ClockedObject;
 
 class DmaPort : public RequestPort, public Drainable
 {
+  public:
+    /** One contiguous piece of a scatter-gather DMA transfer. */
+    struct Segment
+    {
+        Addr addr;
+        Addr size;
+    };
+    typedef std::vector<Segment> SegmentList;
+
   private:
     AddrRangeMap<MemBackdoorPtr, 1> memBackdoors;
 
@@ -103,6 +113,16 @@ class DmaPort : public RequestPort, public Drainable
         /** Object to track what chunks of bytes to send at a time. */
         ChunkGenerator gen;
 
+        /** The pieces of the transfer, gen walks the current one. */
+        SegmentList segments;
+        size_t segment = 0;
+
+        /** Bytes in the pieces before the current one. */
+        Addr segmentStart = 0;
+
+        /** Largest chunk to send in one packet. */
+        const Addr chunkSize;
+
         /** Pointer to a buffer for the data. */
         uint8_t *const data = nullptr;
 
@@ -124,10 +144,42 @@ class DmaPort : public RequestPort, public Drainable
                     uint32_t _sid, uint32_t _ssid, Event *ce, Tick _delay,
                     Event *ae=nullptr)
             : completionEvent(ce), abortEvent(ae), totBytes(tb), delay(_delay),
-              gen(addr, tb, chunk_sz), data(_data), flags(_flags), id(_id),
+              gen(addr, tb, chunk_sz), segments{{addr, tb}},
+              chunkSize(chunk_sz), data(_data), flags(_flags), id(_id),
               sid(_sid), ssid(_ssid), cmd(_cmd)
         {}
 
+        DmaReqState(Packet::Command _cmd, SegmentList _segments,
+                    Addr chunk_sz, uint8_t *_data, Request::Flags _flags,
+                    RequestorID _id, uint32_t _sid, uint32_t _ssid,
+                    Event *ce, Tick _delay);
+
+        /** Bytes of the whole transfer which have been sent. */
+        Addr complete() const { return segmentStart + gen.complete(); }
+
+        /** Bytes of the current piece which have not been sent. */
+        Addr
+        segmentLeft() const
+        {
+            return segments[segment].size - gen.complete();
+        }
+
+        /** Whether the current chunk is the last one of the transfer. */
+        bool
+        last() const
+        {
+            return gen.last() && segment + 1 == segments.size();
+        }
+
+        /** Whether every chunk of the transfer has been sent. */
+        bool done() const { return gen.done(); }
+
+        /**
+         * Move on to the next chunk, which may start the next piece.
+         * @return false if there are no more chunks.
+         */
+        bool next();
+
         PacketPtr createPacket();
     };
 
@@ -189,6 +241,9 @@ class DmaPort : public RequestPort, public Drainable
 
     const int cacheLineSize;
 
+    /** Largest packet to split DMA requests into. */
+    const Addr burstSize;
+
   protected:
 
     bool recvTimingResp(PacketPtr pkt) override;
@@ -196,7 +251,11 @@ class DmaPort : public RequestPort, public Drainable
 
   public:
 
-    DmaPort(ClockedObject *dev, System *s, uint32_t sid=0, uint32_t ssid=0);
+    /**
+     * @param burst_size Largest packet to send, 0 for the cache line size.
+     */
+    DmaPort(ClockedObject *dev, System *s, uint32_t sid=0, uint32_t ssid=0,
+            Addr burst_size=0);
 
     void
     dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
@@ -207,6 +266,21 @@ class DmaPort : public RequestPort, public Drainable
               uint8_t *data, uint32_t sid, uint32_t ssid, Tick delay,
               Request::Flags flag=0);
 
+    /**
+     * Scatter-gather DMA: transfer the pieces in order, to or from
+     * consecutive bytes of data, and signal the event once when all of
+     * them have completed.
+     */
+    void
+    dmaAction(Packet::Command cmd, const SegmentList &segments,
+              Event *event, uint8_t *data, Tick delay,
+              Request::Flags flag=0);
+
+    void
+    dmaAction(Packet::Command cmd, const SegmentList &segments,
+              Event *event, uint8_t *data, uint32_t sid, uint32_t ssid,
+              Tick delay, Request::Flags flag=0);
+
     // Abort and remove any pending DMA transmissions.
     void abortPending();
 
@@ -253,6 +327,20 @@ class DmaDevice : public PioDevice
         dmaPort.dmaAction(MemCmd::ReadReq, addr, size, event, data, delay);
     }
 
+    void
+    dmaWrite(const DmaPort::SegmentList &segments, Event *event,
+             uint8_t *data, Tick delay=0)
+    {
+        dmaPort.dmaAction(MemCmd::WriteReq, segments, event, data, delay);
+    }
+
+    void
+    dmaRead(const DmaPort::SegmentList &segments, Event *event,
+            uint8_t *data, Tick delay=0)
+    {
+        dmaPort.dmaAction(MemCmd::ReadReq, segments, event, data, delay);
+    }
+
     bool dmaPending() const { return dmaPort.dmaPending(); }
 
     void init() override;
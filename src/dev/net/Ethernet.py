@@ -69,6 +69,10 @@ class EtherLink(SimObject):
     dump = Param.EtherDump(NULL, "dump object")
 
 
+class DistTransport(Enum):
+    vals = ["tcp", "mpi", "shm"]
+
+
 class DistEtherLink(SimObject):
     type = "DistEtherLink"
     cxx_header = "dev/net/dist_etherlink.hh"
@@ -88,6 +92,21 @@ class DistEtherLink(SimObject):
     is_switch = Param.Bool(False, "true if this a link in etherswitch")
     dist_sync_on_pseudo_op = Param.Bool(False, "Start sync with pseudo_op")
     num_nodes = Param.UInt32("2", "Number of simulate nodes")
+    transport = Param.DistTransport(
+        "tcp",
+        "Transport between the gem5 processes: TCP sockets, an MPI job "
+        "or shared memory rings for processes on the same host",
+    )
+    sync_max_multiple = Param.UInt32(
+        1,
+        "Let the dist sync quantum grow up to this multiple of "
+        "sync_repeat while no packets are sent, 1 for a fixed quantum",
+    )
+    batch_packets = Param.Bool(
+        False,
+        "Send data packets along with the next sync barrier rather than "
+        "one by one (mpi and shm transports only)",
+    )
 
 
 class EtherBus(SimObject):
@@ -116,6 +135,13 @@ class EtherSwitch(SimObject):
     delay = Param.Latency("0us", "packet transmit delay")
     delay_var = Param.Latency("0ns", "packet transmit delay variability")
     time_to_live = Param.Latency("10ms", "time to live of MAC address maping")
+    port_eventq_index = VectorParam.UInt32(
+        [],
+        "Event queue of each interface, the switch's own queue if empty. "
+        "Interfaces on different queues exchange packets through the "
+        "switch delay, which must then be non-zero, and run in parallel "
+        "with the devices they are linked to on their queues.",
+    )
 
 
 class EtherTapBase(SimObject):
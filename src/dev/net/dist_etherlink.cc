@@ -52,6 +52,7 @@
 
 #include "base/random.hh"
 #include "base/trace.hh"
+#include "config/have_mpi.hh"
 #include "debug/DistEthernet.hh"
 #include "debug/DistEthernetPkt.hh"
 #include "debug/EthernetData.hh"
@@ -60,17 +61,22 @@
 #include "dev/net/etherint.hh"
 #include "dev/net/etherlink.hh"
 #include "dev/net/etherpkt.hh"
+#include "dev/net/shm_iface.hh"
 #include "dev/net/tcp_iface.hh"
 #include "params/EtherLink.hh"
 #include "sim/cur_tick.hh"
 #include "sim/serialize.hh"
 #include "sim/system.hh"
 
+#if HAVE_MPI
+#include "dev/net/mpi_iface.hh"
+#endif
+
 namespace gem5
 {
 
 DistEtherLink::DistEtherLink(const Params &p)
-    : SimObject(p), linkDelay(p.delay)
+    : SimObject(p), linkDelay(p.delay), syncMaxMultiple(p.sync_max_multiple)
 {
     DPRINTF(DistEthernet,"DistEtherLink::DistEtherLink() "
             "link delay:%llu ticksPerByte:%f\n", p.delay, p.speed);
@@ -89,12 +95,37 @@ DistEtherLink::DistEtherLink(const Params &p)
         sync_repeat = p.delay;
     }
 
-    // create the dist (TCP) interface to talk to the peer gem5 processes.
-    distIface = new TCPIface(p.server_name, p.server_port,
-                             p.dist_rank, p.dist_size,
-                             p.sync_start, sync_repeat, this,
-                             p.dist_sync_on_pseudo_op, p.is_switch,
-                             p.num_nodes);
+    fatal_if(p.batch_packets && p.transport == enums::tcp,
+             "%s: The TCP transport can't batch dist packets.", name());
+
+    // create the dist interface to talk to the peer gem5 processes.
+    switch (p.transport) {
+      case enums::tcp:
+        distIface = new TCPIface(p.server_name, p.server_port,
+                                 p.dist_rank, p.dist_size,
+                                 p.sync_start, sync_repeat, this,
+                                 p.dist_sync_on_pseudo_op, p.is_switch,
+                                 p.num_nodes);
+        break;
+      case enums::mpi:
+#if HAVE_MPI
+        distIface = new MPIIface(p.dist_rank, p.dist_size,
+                                 p.sync_start, sync_repeat, this,
+                                 p.dist_sync_on_pseudo_op, p.is_switch,
+                                 p.num_nodes, p.batch_packets);
+#else
+        fatal("%s: gem5 was built without MPI support.", name());
+#endif
+        break;
+      case enums::shm:
+        distIface = new ShmIface(p.server_port, p.dist_rank, p.dist_size,
+                                 p.sync_start, sync_repeat, this,
+                                 p.dist_sync_on_pseudo_op, p.is_switch,
+                                 p.num_nodes, p.batch_packets);
+        break;
+      default:
+        panic("%s: Unknown dist transport.", name());
+    }
 
     localIface = new LocalIface(name() + ".int0", txLink, rxLink, distIface);
 }
@@ -135,7 +166,7 @@ void
 DistEtherLink::init()
 {
     DPRINTF(DistEthernet,"DistEtherLink::init() called\n");
-    distIface->init(rxLink->doneEvent(), linkDelay);
+    distIface->init(rxLink->doneEvent(), linkDelay, syncMaxMultiple);
 }
 
 void
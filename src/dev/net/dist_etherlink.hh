@@ -217,6 +217,9 @@ class DistEtherLink : public SimObject
 
     Tick linkDelay;
 
+    /** How many times the dist sync quantum may grow to when idle. */
+    unsigned syncMaxMultiple;
+
   public:
     using Params = DistEtherLinkParams;
     DistEtherLink(const Params &p);
@@ -41,6 +41,8 @@
 
 #include "dev/net/dist_iface.hh"
 
+#include <algorithm>
+#include <limits>
 #include <queue>
 #include <thread>
 
@@ -66,8 +68,15 @@ unsigned DistIface::recvThreadsNum = 0;
 DistIface *DistIface::primary = nullptr;
 bool DistIface::isSwitch = false;
 
+DistIface::Sync::Sync()
+    : baseRepeat(std::numeric_limits<Tick>::max()),
+      maxRepeatMultiple(std::numeric_limits<unsigned>::max()),
+      sentPackets(false)
+{}
+
 void
-DistIface::Sync::init(Tick start_tick, Tick repeat_tick)
+DistIface::Sync::init(Tick start_tick, Tick repeat_tick,
+                      unsigned max_multiple)
 {
     if (start_tick < nextAt) {
         nextAt = start_tick;
@@ -82,6 +91,25 @@ DistIface::Sync::init(Tick start_tick, Tick repeat_tick)
         inform("Dist synchronisation interval is changed to %lu.\n",
                nextRepeat);
     }
+    baseRepeat = std::min(baseRepeat, repeat_tick);
+
+    // Use the most conservative growth of all the links.
+    panic_if(max_multiple == 0,
+             "Dist synchronisation multiple must be greater than zero");
+    maxRepeatMultiple = std::min(maxRepeatMultiple, max_multiple);
+}
+
+Tick
+DistIface::Sync::proposeRepeat(bool periodic)
+{
+    const bool sent = sentPackets.exchange(false);
+    if (!periodic || sent || maxRepeatMultiple <= 1)
+        return baseRepeat;
+
+    // The last quantum was quiet on our side, so ask for a longer one.
+    // Everybody agrees on the shortest one asked for, thus any traffic
+    // brings all of them back to the safe quantum.
+    return std::min(nextRepeat * 2, baseRepeat * maxRepeatMultiple);
 }
 
 void
@@ -106,6 +134,7 @@ DistIface::SyncSwitch::SyncSwitch(int num_nodes)
     doStopSync = false;
     nextAt = std::numeric_limits<Tick>::max();
     nextRepeat = std::numeric_limits<Tick>::max();
+    reqRepeat = std::numeric_limits<Tick>::max();
     isAbort = false;
 }
 
@@ -135,7 +164,7 @@ DistIface::SyncNode::run(bool same_tick)
     // initiate the global synchronisation
     header.msgType = MsgType::cmdSyncReq;
     header.sendTick = curTick();
-    header.syncRepeat = nextRepeat;
+    header.syncRepeat = proposeRepeat(same_tick);
     header.needCkpt = needCkpt;
     header.needStopSync = needStopSync;
     if (needCkpt != ReqType::none)
@@ -170,6 +199,9 @@ DistIface::SyncSwitch::run(bool same_tick)
         return false;
     assert(!same_tick || (nextAt == curTick()));
     waitNum = numNodes;
+    // Agree on the shortest repeat asked for, including ours.
+    nextRepeat = std::min(reqRepeat, proposeRepeat(same_tick));
+    reqRepeat = std::numeric_limits<Tick>::max();
     // Complete the global synchronisation
     header.msgType = MsgType::cmdSyncAck;
     header.sendTick = nextAt;
@@ -212,8 +244,8 @@ DistIface::SyncSwitch::progress(Tick send_tick,
 
     if (send_tick > nextAt)
         nextAt = send_tick;
-    if (nextRepeat > sync_repeat)
-        nextRepeat = sync_repeat;
+    if (reqRepeat > sync_repeat)
+        reqRepeat = sync_repeat;
 
     if (need_ckpt == ReqType::collective)
         numCkptReq++;
@@ -424,6 +456,10 @@ DistIface::SyncEvent::process()
         return;
     }
     // schedule the next periodic sync
+    if (repeat != DistIface::sync->nextRepeat) {
+        DPRINTF(DistEthernet, "Dist sync repeat changes from %lu to %lu\n",
+                repeat, DistIface::sync->nextRepeat);
+    }
     repeat = DistIface::sync->nextRepeat;
     schedule(curTick() + repeat);
 }
@@ -611,7 +647,7 @@ DistIface::DistIface(unsigned dist_rank,
                      bool is_switch, int num_nodes) :
     syncStart(sync_start), syncRepeat(sync_repeat),
     recvThread(nullptr), recvScheduler(em), syncStartOnPseudoOp(use_pseudo_op),
-    rank(dist_rank), size(dist_size)
+    linkDelay(0), nextSendTick(0), rank(dist_rank), size(dist_size)
 {
     DPRINTF(DistEthernet, "DistIface() ctor rank:%d\n",dist_rank);
     isPrimary = false;
@@ -651,10 +687,21 @@ DistIface::packetOut(EthPacketPtr pkt, Tick send_delay)
 {
     Header header;
 
+    // A quantum longer than the link delay (see Sync::proposeRepeat)
+    // would let the packet arrive before the end of the quantum, at a tick
+    // the receiver may have simulated already. Conservatively hold the
+    // packet back so that it arrives in the next quantum, and never
+    // before the previous packet.
+    Tick send_tick = std::max(curTick(), nextSendTick);
+    if (syncEvent->scheduled() && syncEvent->repeat > linkDelay)
+        send_tick = std::max(send_tick, syncEvent->when() - linkDelay);
+    nextSendTick = send_tick + send_delay;
+    sync->packetSent();
+
     // Prepare a dist header packet for the Ethernet packet we want to
     // send out.
     header.msgType = MsgType::dataDescriptor;
-    header.sendTick  = curTick();
+    header.sendTick  = send_tick;
     header.sendDelay = send_delay;
 
     header.dataPacketLength = pkt->length;
@@ -783,8 +830,11 @@ DistIface::unserialize(CheckpointIn &cp)
 }
 
 void
-DistIface::init(const Event *done_event, Tick link_delay)
+DistIface::init(const Event *done_event, Tick link_delay,
+                unsigned sync_max_multiple)
 {
+    linkDelay = link_delay;
+
     // Init hook for the underlaying message transport to setup/finalize
     // communication channels
     initTransport();
@@ -800,7 +850,7 @@ DistIface::init(const Event *done_event, Tick link_delay)
     // might have different requirements. The singleton sync object
     // will select the minimum values for both params.
     assert(sync != nullptr);
-    sync->init(syncStart, syncRepeat);
+    sync->init(syncStart, syncRepeat, sync_max_multiple);
 
     // Initialize the seed for random generator to avoid the same sequence
     // in all gem5 peer processes
@@ -70,12 +70,14 @@
  *
  * This interface is an abstract class. It can work with various low level
  * send/receive service implementations (e.g. TCP/IP, MPI,...). A TCP
- * stream socket version is implemented in src/dev/net/tcp_iface.[hh,cc].
+ * stream socket version is implemented in src/dev/net/tcp_iface.[hh,cc],
+ * MPI and shared memory versions in src/dev/net/{mpi,shm}_iface.[hh,cc].
  */
 #ifndef __DEV_DIST_IFACE_HH__
 #define __DEV_DIST_IFACE_HH__
 
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -149,6 +151,17 @@ class DistIface : public Drainable, public Serializable
          * The repeat value for the next periodic sync
          */
         Tick nextRepeat;
+        /**
+         * The smallest repeat of the links of this process, i.e. the safe
+         * quantum, and how many times that the quantum may grow to when
+         * no packets are sent.
+         */
+        Tick baseRepeat;
+        unsigned maxRepeatMultiple;
+        /**
+         * Set when a packet is sent during the current quantum.
+         */
+        std::atomic<bool> sentPackets;
         /**
          * Tick for the next periodic sync (if the event is not scheduled yet)
          */
@@ -160,15 +173,30 @@ class DistIface : public Drainable, public Serializable
 
         friend class SyncEvent;
 
+        /**
+         * The repeat this process asks for in the next sync. The safe
+         * quantum after packets went out, otherwise double the current
+         * one, up to the maximum multiple.
+         *
+         * @param periodic Whether this is a periodic sync.
+         */
+        Tick proposeRepeat(bool periodic);
+
       public:
+        Sync();
+
         /**
          * Initialize periodic sync params.
          *
          * @param start Start tick for dist synchronisation
          * @param repeat Frequency of dist synchronisation
+         * @param max_multiple How many times the quantum may grow to
          *
          */
-        void init(Tick start, Tick repeat);
+        void init(Tick start, Tick repeat, unsigned max_multiple);
+
+        /** Record that a packet was sent during this quantum. */
+        void packetSent() { sentPackets = true; }
         /**
          *  Core method to perform a full dist sync.
          *
@@ -256,6 +284,10 @@ class DistIface : public Drainable, public Serializable
          *  Number of connected simulated nodes
          */
         unsigned numNodes;
+        /**
+         * Smallest repeat the nodes asked for in the on-going sync
+         */
+        Tick reqRepeat;
 
       public:
         SyncSwitch(int num_nodes);
@@ -474,6 +506,15 @@ class DistIface : public Drainable, public Serializable
      * Use pseudoOp to start synchronization.
      */
     bool syncStartOnPseudoOp;
+    /**
+     * Delay of the simulated link.
+     */
+    Tick linkDelay;
+    /**
+     * The earliest send tick of the next packet, after the previous one
+     * has been fully sent.
+     */
+    Tick nextSendTick;
 
   protected:
     /**
@@ -601,7 +642,11 @@ class DistIface : public Drainable, public Serializable
 
     DrainState drain() override;
     void drainResume() override;
-    void init(const Event *e, Tick link_delay);
+    /**
+     * @param sync_max_multiple How many times the sync quantum may grow
+     * to while no packets are sent, 1 for a fixed quantum.
+     */
+    void init(const Event *e, Tick link_delay, unsigned sync_max_multiple);
     void startup();
 
     void serialize(CheckpointOut &cp) const override;
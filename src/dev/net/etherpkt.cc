@@ -28,15 +28,100 @@
 
 #include "dev/net/etherpkt.hh"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <vector>
 
 #include "base/inet.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "sim/serialize.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+/**
+ * Free lists of frame buffers, one per power of two size class. Larger
+ * buffers are not pooled.
+ */
+class BufferPool
+{
+  public:
+    static constexpr unsigned MinBits = 6;
+    static constexpr unsigned MaxBits = 16;
+    /** Most free buffers kept per size class. */
+    static constexpr size_t MaxFree = 128;
+
+    uint8_t *
+    alloc(unsigned size, unsigned &alloc_length)
+    {
+        const unsigned bits = std::max<unsigned>(ceilLog2(size), MinBits);
+        if (bits > MaxBits) {
+            alloc_length = size;
+            return new uint8_t[size];
+        }
+
+        alloc_length = 1 << bits;
+        auto &list = freeLists[bits - MinBits];
+        if (list.empty())
+            return new uint8_t[alloc_length];
+        uint8_t *buf = list.back();
+        list.pop_back();
+        return buf;
+    }
+
+    void
+    free(uint8_t *buf, unsigned alloc_length)
+    {
+        const unsigned bits = floorLog2(alloc_length);
+        if (alloc_length != (1U << bits) || bits < MinBits ||
+                bits > MaxBits) {
+            delete [] buf;
+            return;
+        }
+
+        auto &list = freeLists[bits - MinBits];
+        if (list.size() < MaxFree)
+            list.push_back(buf);
+        else
+            delete [] buf;
+    }
+
+  private:
+    std::array<std::vector<uint8_t *>, MaxBits - MinBits + 1> freeLists;
+};
+
+/**
+ * Frames may be freed in a different thread than they were allocated
+ * in (e.g. dist-gem5 receiver threads), so buffers simply move to the
+ * pool of the freeing thread. The pools are never destroyed, since
+ * static objects may still free frames at exit.
+ */
+BufferPool &
+bufferPool()
+{
+    thread_local BufferPool *pool = new BufferPool;
+    return *pool;
+}
+
+} // anonymous namespace
+
+uint8_t *
+EthPacketData::allocBuffer(unsigned size, unsigned &alloc_length)
+{
+    return bufferPool().alloc(size, alloc_length);
+}
+
+void
+EthPacketData::freeBuffer(uint8_t *buf, unsigned alloc_length)
+{
+    bufferPool().free(buf, alloc_length);
+}
+
 void
 EthPacketData::serialize(const std::string &base, CheckpointOut &cp) const
 {
@@ -65,7 +150,7 @@ EthPacketData::unserialize(const std::string &base, CheckpointIn &cp)
     }
     assert(length <= bufLength);
     if (!data)
-        data = new uint8_t[bufLength];
+        data = allocBuffer(bufLength, allocLength);
     arrayParamIn(cp, base + ".data", data, length);
     if (!optParamIn(cp, base + ".simLength", simLength))
         simLength = length;
@@ -48,6 +48,18 @@ namespace gem5
  */
 class EthPacketData
 {
+  private:
+    /**
+     * Size of the buffer actually allocated, which is rounded up to a
+     * size class of the buffer pool.
+     */
+    unsigned allocLength;
+
+    /** Get a buffer of at least size bytes from the pool. */
+    static uint8_t *allocBuffer(unsigned size, unsigned &alloc_length);
+    /** Return a buffer to the pool. */
+    static void freeBuffer(uint8_t *buf, unsigned alloc_length);
+
   public:
     /**
      * Pointer to packet data will be deleted
@@ -74,14 +86,20 @@ class EthPacketData
     unsigned simLength;
 
     EthPacketData()
-        : data(nullptr), bufLength(0), length(0), simLength(0)
+        : allocLength(0), data(nullptr), bufLength(0), length(0),
+          simLength(0)
     { }
 
+    /**
+     * Frame buffers come from a per thread pool, since frames are
+     * allocated and freed at a high rate by devices, links and taps.
+     */
     explicit EthPacketData(unsigned size)
-        : data(new uint8_t[size]), bufLength(size), length(0), simLength(0)
+        : data(allocBuffer(size, allocLength)), bufLength(size), length(0),
+          simLength(0)
     { }
 
-    ~EthPacketData() { if (data) delete [] data; }
+    ~EthPacketData() { if (data) freeBuffer(data, allocLength); }
 
     void serialize(const std::string &base, CheckpointOut &cp) const;
     void unserialize(const std::string &base, CheckpointIn &cp);
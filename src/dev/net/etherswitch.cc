@@ -32,25 +32,46 @@
 
 #include "dev/net/etherswitch.hh"
 
+#include <algorithm>
+
 #include "base/random.hh"
 #include "base/trace.hh"
 #include "debug/EthernetAll.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
+#include "sim/simulate.hh"
 
 namespace gem5
 {
 
 EtherSwitch::EtherSwitch(const Params &p)
-    : SimObject(p), ttl(p.time_to_live)
+    : SimObject(p), ttl(p.time_to_live), delay(p.delay), parallel(false)
 {
+    fatal_if(!p.port_eventq_index.empty() &&
+             p.port_eventq_index.size() !=
+             p.port_interface_connection_count,
+             "%s: port_eventq_index must have one entry per interface.",
+             name());
+
     for (int i = 0; i < p.port_interface_connection_count; ++i) {
         std::string interfaceName = csprintf("%s.interface%d", name(), i);
+        const uint32_t index = p.port_eventq_index.empty() ?
+            p.eventq_index : p.port_eventq_index[i];
+        EventQueue *eventq = getEventQueue(index);
+        parallel = parallel || index != p.eventq_index;
+        portEventqIndex.push_back(index);
         Interface *interface = new Interface(interfaceName, this,
                                         p.output_buffer_size, p.delay,
-                                        p.delay_var, p.fabric_speed, i);
+                                        p.delay_var, p.fabric_speed, i,
+                                        eventq);
         interfaces.push_back(interface);
     }
+
+    // The switch delay is the lookahead between ports on different
+    // event queues, so packets must not cross them instantly.
+    fatal_if(parallel && p.delay == 0,
+             "%s: ports on different event queues need a non-zero delay.",
+             name());
 }
 
 EtherSwitch::~EtherSwitch()
@@ -61,6 +82,20 @@ EtherSwitch::~EtherSwitch()
     interfaces.clear();
 }
 
+void
+EtherSwitch::init()
+{
+    SimObject::init();
+
+    if (!parallel)
+        return;
+
+    for (auto src : portEventqIndex) {
+        for (auto dst : portEventqIndex)
+            registerLookahead(src, dst, delay);
+    }
+}
+
 Port &
 EtherSwitch::getPort(const std::string &if_name, PortID idx)
 {
@@ -73,12 +108,13 @@ EtherSwitch::getPort(const std::string &if_name, PortID idx)
 }
 
 bool
-EtherSwitch::Interface::PortFifo::push(EthPacketPtr ptr, unsigned senderId)
+EtherSwitch::Interface::PortFifo::push(EthPacketPtr ptr, unsigned senderId,
+                                       Tick recv_tick)
 {
     assert(ptr->length);
 
     _size += ptr->length;
-    fifo.emplace_hint(fifo.end(), ptr, curTick(), senderId);
+    fifo.emplace_hint(fifo.end(), ptr, recv_tick, senderId);
 
     // Drop the extra pushed packets from end of the fifo
     while (avail() < 0) {
@@ -126,9 +162,11 @@ EtherSwitch::Interface::PortFifo::clear()
 EtherSwitch::Interface::Interface(const std::string &name,
                                   EtherSwitch *etherSwitch,
                                   uint64_t outputBufferSize, Tick delay,
-                                  Tick delay_var, double rate, unsigned id)
+                                  Tick delay_var, double rate, unsigned id,
+                                  EventQueue *_eventq)
     : EtherInt(name), ticksPerByte(rate), switchDelay(delay),
       delayVar(delay_var), interfaceId(id), parent(etherSwitch),
+      eventq(_eventq), localRandom(id),
       outputFifo(name + ".outputFifo", outputBufferSize),
       txEvent([this]{ transmit(); }, name)
 {
@@ -146,13 +184,13 @@ EtherSwitch::Interface::recvPacket(EthPacketPtr packet)
     if (!receiver || destMacAddr.multicast() || destMacAddr.broadcast()) {
         for (auto it : parent->interfaces)
             if (it != this)
-                it->enqueue(packet, interfaceId);
+                forward(packet, it);
     } else {
         DPRINTF(Ethernet, "sending packet from MAC %x on port "
                 "%s to MAC %x on port %s\n", uint64_t(srcMacAddr),
                 this->name(), uint64_t(destMacAddr), receiver->name());
 
-        receiver->enqueue(packet, interfaceId);
+        forward(packet, receiver);
     }
     // At the output port, we either have buffer space (no drop) or
     // don't (drop packet); in both cases packet is received on
@@ -162,7 +200,54 @@ EtherSwitch::Interface::recvPacket(EthPacketPtr packet)
 }
 
 void
-EtherSwitch::Interface::enqueue(EthPacketPtr packet, unsigned senderId)
+EtherSwitch::Interface::forward(EthPacketPtr packet, Interface *receiver)
+{
+    if (receiver->eventq == eventq) {
+        receiver->enqueue(packet, interfaceId, curTick());
+        return;
+    }
+
+    // The receiver runs on another thread. Leave the packet in its
+    // inbox and let its own event queue pick it up once the switch
+    // delay has elapsed.
+    {
+        std::lock_guard<std::mutex> lock(receiver->inboxLock);
+        receiver->inbox.emplace_back(packet, curTick(), interfaceId);
+    }
+    receiver->scheduleDelivery(curTick() + switchDelay);
+}
+
+void
+EtherSwitch::Interface::scheduleDelivery(Tick when)
+{
+    eventq->schedule(new EventFunctionWrapper([this]{ deliver(); },
+                                              name() + ".deliver", true),
+                     when);
+}
+
+void
+EtherSwitch::Interface::deliver()
+{
+    std::vector<PortFifoEntry> arrived;
+    {
+        std::lock_guard<std::mutex> lock(inboxLock);
+        for (auto it = inbox.begin(); it != inbox.end();) {
+            if (it->recvTick + switchDelay <= curTick()) {
+                arrived.push_back(*it);
+                it = inbox.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (const auto &entry : arrived)
+        enqueue(entry.packet, entry.srcId, entry.recvTick);
+}
+
+void
+EtherSwitch::Interface::enqueue(EthPacketPtr packet, unsigned senderId,
+                                Tick recv_tick)
 {
     // assuming per-interface transmission events,
     // if the newly push packet gets inserted at the head of the queue
@@ -172,8 +257,13 @@ EtherSwitch::Interface::enqueue(EthPacketPtr packet, unsigned senderId)
     // "curTick" + "switchingDelay of the packet at the head of the fifo"
     // to send this packet out the external link
     // otherwise, there is already a txEvent scheduled
-    if (outputFifo.push(packet, senderId)) {
-        parent->reschedule(txEvent, curTick() + switchingDelay(), true);
+    // Packets from other event queues already spent the switch
+    // delay getting here, so they leave at the same time they would
+    // have if all ports were on one queue.
+    if (outputFifo.push(packet, senderId, recv_tick)) {
+        eventq->reschedule(&txEvent,
+                           std::max(curTick(), recv_tick + switchingDelay()),
+                           true);
     }
 }
 
@@ -186,14 +276,14 @@ EtherSwitch::Interface::transmit()
     if (!sendPacket(outputFifo.front())) {
         DPRINTF(Ethernet, "output port busy...retry later\n");
         if (!txEvent.scheduled())
-            parent->schedule(txEvent, curTick() + sim_clock::as_int::ns);
+            eventq->schedule(&txEvent, curTick() + sim_clock::as_int::ns);
     } else {
         DPRINTF(Ethernet, "packet sent: len=%d\n", outputFifo.front()->length);
         outputFifo.pop();
         // schedule an event to send the pkt at
         // the head of queue, if there is any
         if (!outputFifo.empty()) {
-            parent->schedule(txEvent, curTick() + switchingDelay());
+            eventq->schedule(&txEvent, curTick() + switchingDelay());
         }
     }
 }
@@ -203,8 +293,10 @@ EtherSwitch::Interface::switchingDelay()
 {
     Tick delay = (Tick)ceil(((double)outputFifo.front()->simLength
                                      * ticksPerByte) + 1.0);
-    if (delayVar != 0)
-                delay += random_mt.random<Tick>(0, delayVar);
+    if (delayVar != 0) {
+        Random &rng = parent->parallel ? localRandom : random_mt;
+        delay += rng.random<Tick>(0, delayVar);
+    }
     delay += switchDelay;
     return delay;
 }
@@ -212,6 +304,7 @@ EtherSwitch::Interface::switchingDelay()
 EtherSwitch::Interface*
 EtherSwitch::Interface::lookupDestPort(networking::EthAddr destMacAddr)
 {
+    std::lock_guard<std::mutex> lock(parent->tableLock);
     auto it = parent->forwardingTable.find(uint64_t(destMacAddr));
 
     if (it == parent->forwardingTable.end()) {
@@ -220,8 +313,10 @@ EtherSwitch::Interface::lookupDestPort(networking::EthAddr destMacAddr)
         return nullptr;
     }
 
-    // check if this entry is valid based on TTL and lastUseTime
-    if ((curTick() - it->second.lastUseTime) > parent->ttl) {
+    // check if this entry is valid based on TTL and lastUseTime, ports
+    // on other event queues may have refreshed it ahead of our time
+    if (curTick() > it->second.lastUseTime &&
+        (curTick() - it->second.lastUseTime) > parent->ttl) {
         // TTL for this mapping has been expired, so this item is not
         // valide anymore, let's remove it from the map
         parent->forwardingTable.erase(it);
@@ -238,6 +333,7 @@ EtherSwitch::Interface::learnSenderAddr(networking::EthAddr srcMacAddr,
                                           Interface *sender)
 {
     // learn the port for the sending MAC address
+    std::lock_guard<std::mutex> lock(parent->tableLock);
     auto it = parent->forwardingTable.find(uint64_t(srcMacAddr));
 
     // if the port for sender's MAC address is not cached,
@@ -252,7 +348,7 @@ EtherSwitch::Interface::learnSenderAddr(networking::EthAddr srcMacAddr,
         parent->forwardingTable.insert(std::make_pair(uint64_t(srcMacAddr),
             forwardingTableEntry));
     } else {
-        it->second.lastUseTime = curTick();
+        it->second.lastUseTime = std::max(it->second.lastUseTime, curTick());
     }
 }
 
@@ -283,6 +379,11 @@ EtherSwitch::Interface::serialize(CheckpointOut &cp) const
         SERIALIZE_SCALAR(event_time);
     }
     outputFifo.serializeSection(cp, "outputFifo");
+
+    int inboxsize = inbox.size();
+    SERIALIZE_SCALAR(inboxsize);
+    for (int i = 0; i < inboxsize; ++i)
+        inbox[i].serializeSection(cp, csprintf("inbox%d", i));
 }
 
 void
@@ -294,9 +395,20 @@ EtherSwitch::Interface::unserialize(CheckpointIn &cp)
     if (event_scheduled) {
         Tick event_time;
         UNSERIALIZE_SCALAR(event_time);
-        parent->schedule(txEvent, event_time);
+        eventq->schedule(&txEvent, event_time);
     }
     outputFifo.unserializeSection(cp, "outputFifo");
+
+    // Checkpoints taken before ports could run in parallel have no inbox
+    int inboxsize = 0;
+    UNSERIALIZE_OPT_SCALAR(inboxsize);
+    inbox.clear();
+    for (int i = 0; i < inboxsize; ++i) {
+        PortFifoEntry entry(nullptr, 0, 0);
+        entry.unserializeSection(cp, csprintf("inbox%d", i));
+        scheduleDelivery(entry.recvTick + switchDelay);
+        inbox.push_back(entry);
+    }
 }
 
 void
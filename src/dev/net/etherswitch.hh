@@ -34,11 +34,13 @@
 #define __DEV_ETHERSWITCH_HH__
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "base/inet.hh"
+#include "base/random.hh"
 #include "dev/net/etherint.hh"
 #include "dev/net/etherlink.hh"
 #include "dev/net/etherpkt.hh"
@@ -59,6 +61,8 @@ class EtherSwitch : public SimObject
     EtherSwitch(const Params &p);
     ~EtherSwitch();
 
+    void init() override;
+
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
@@ -71,7 +75,7 @@ class EtherSwitch : public SimObject
       public:
         Interface(const std::string &name, EtherSwitch *_etherSwitch,
                   uint64_t outputBufferSize, Tick delay, Tick delay_var,
-                  double rate, unsigned id);
+                  double rate, unsigned id, EventQueue *_eventq);
         /**
          * When a packet is received from a device, route it
          * through an (several) output queue(s)
@@ -79,8 +83,21 @@ class EtherSwitch : public SimObject
         bool recvPacket(EthPacketPtr packet);
         /**
          * enqueue packet to the outputFifo
+         *
+         * @param recv_tick Tick at which the switch received the packet.
+         */
+        void enqueue(EthPacketPtr packet, unsigned senderId, Tick recv_tick);
+        /**
+         * Hand a received packet over to an output port. Ports on
+         * another event queue get it through their inbox, after the
+         * switch delay.
+         */
+        void forward(EthPacketPtr packet, Interface *receiver);
+        /**
+         * Move the packets whose switch delay has elapsed from the
+         * inbox to the outputFifo.
          */
-        void enqueue(EthPacketPtr packet, unsigned senderId);
+        void deliver();
         void sendDone() {}
         Tick switchingDelay();
 
@@ -97,6 +114,13 @@ class EtherSwitch : public SimObject
         const unsigned interfaceId;
 
         EtherSwitch *parent;
+        /** Event queue on which this port runs. */
+        EventQueue *eventq;
+        /**
+         * Generator for the delay variability, used instead of the
+         * shared one when ports run on different event queues.
+         */
+        Random localRandom;
       protected:
         struct PortFifoEntry : public Serializable
         {
@@ -158,7 +182,7 @@ class EtherSwitch : public SimObject
              * Push a packet into the fifo
              * and sort the packets with same recv tick by port id
              */
-            bool push(EthPacketPtr ptr, unsigned senderId);
+            bool push(EthPacketPtr ptr, unsigned senderId, Tick recv_tick);
             void pop();
             void clear();
             /**
@@ -173,6 +197,14 @@ class EtherSwitch : public SimObject
         PortFifo outputFifo;
         void transmit();
         EventFunctionWrapper txEvent;
+
+        /**
+         * Packets forwarded by ports on other event queues that
+         * have not reached this port yet.
+         */
+        std::vector<PortFifoEntry> inbox;
+        std::mutex inboxLock;
+        void scheduleDelivery(Tick when);
     };
 
     struct SwitchTableEntry
@@ -184,10 +216,18 @@ class EtherSwitch : public SimObject
   private:
     // time to live for MAC address mappings
     const double ttl;
+    // fabric latency, the lookahead between ports on different queues
+    const Tick delay;
     // all interfaces of the switch
     std::vector<Interface*> interfaces;
+    // event queue index of each interface
+    std::vector<uint32_t> portEventqIndex;
     // table that maps MAC address to interfaces
     std::map<uint64_t, SwitchTableEntry> forwardingTable;
+    // protects the forwarding table when ports run in parallel
+    std::mutex tableLock;
+    // true if the ports are spread over several event queues
+    bool parallel;
 
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
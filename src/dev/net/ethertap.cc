@@ -51,6 +51,7 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <cstring>
@@ -192,7 +193,12 @@ EtherTapBase::sendSimulated(void *data, size_t len)
     packet->length = len;
     packet->simLength = len;
     memcpy(packet->data, data, len);
+    sendSimulated(packet);
+}
 
+void
+EtherTapBase::sendSimulated(EthPacketPtr packet)
+{
     DPRINTF(Ethernet, "EtherTap real->sim len=%d\n", packet->length);
     DDUMP(EthernetData, packet->data, packet->length);
     if (!packetBuffer.empty() || !interface->sendPacket(packet)) {
@@ -368,31 +374,38 @@ EtherTapStub::recvReal(int revent)
     DPRINTF(Ethernet, "Received data from peer: len=%d buffer_used=%d "
             "frame_len=%d\n", len, buffer_used, frame_len);
 
-    uint8_t *frame_start = &buffer[sizeof(uint32_t)];
-    while (frame_len != 0 && buffer_used >= frame_len + sizeof(uint32_t)) {
-        sendSimulated(frame_start, frame_len);
+    // Hand all the complete frames over, and only then move what is left
+    // to the start of the buffer, rather than once per frame.
+    uint32_t consumed = 0;
+    while (frame_len != 0 &&
+            buffer_used - consumed >= frame_len + sizeof(uint32_t)) {
+        sendSimulated(buffer + consumed + sizeof(uint32_t), frame_len);
 
         // Bookkeeping.
-        buffer_used -= frame_len + sizeof(uint32_t);
-        if (buffer_used > 0) {
-            // If there's still any data left, move it into position.
-            memmove(buffer, frame_start + frame_len, buffer_used);
-        }
+        consumed += frame_len + sizeof(uint32_t);
         frame_len = 0;
 
-        if (buffer_used >= sizeof(uint32_t))
-            frame_len = ntohl(*(uint32_t *)buffer);
+        if (buffer_used - consumed >= sizeof(uint32_t))
+            frame_len = ntohl(*(uint32_t *)(buffer + consumed));
+    }
+
+    buffer_used -= consumed;
+    if (consumed && buffer_used > 0) {
+        // If there's still any data left, move it into position.
+        memmove(buffer, buffer + consumed, buffer_used);
     }
 }
 
 bool
 EtherTapStub::sendReal(const void *data, size_t len)
 {
+    // Write the length and the frame with a single system call.
     uint32_t frame_len = htonl(len);
-    ssize_t ret = write(socket, &frame_len, sizeof(frame_len));
-    if (ret != sizeof(frame_len))
-        return false;
-    return write(socket, data, len) == len;
+    struct iovec iov[2] = {
+        { &frame_len, sizeof(frame_len) },
+        { const_cast<void *>(data), len },
+    };
+    return writev(socket, iov, 2) == sizeof(frame_len) + len;
 }
 
 
@@ -432,15 +445,22 @@ EtherTap::recvReal(int revent)
     if (!(revent & POLLIN))
         return;
 
-    ssize_t ret;
-    while ((ret = read(tap, buffer, buflen))) {
+    // Read every pending frame straight into a packet buffer, so that it
+    // doesn't need to be copied again.
+    for (;;) {
+        auto packet = std::make_shared<EthPacketData>(buflen);
+        ssize_t ret = read(tap, packet->data, buflen);
+        if (ret == 0)
+            break;
         if (ret < 0) {
             if (errno == EAGAIN)
                 break;
             panic("Failed to read from tap device.\n");
         }
 
-        sendSimulated(buffer, ret);
+        packet->length = ret;
+        packet->simLength = ret;
+        sendSimulated(packet);
     }
 }
 
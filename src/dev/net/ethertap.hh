@@ -100,6 +100,8 @@ class EtherTapBase : public SimObject
 
     bool recvSimulated(EthPacketPtr packet);
     void sendSimulated(void *data, size_t len);
+    /** Send a frame which already is in a packet, without copying it. */
+    void sendSimulated(EthPacketPtr packet);
 
   protected:
     std::queue<EthPacketPtr> packetBuffer;
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/net/mpi_iface.hh"
+
+#include <mpi.h>
+
+#include <climits>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DistEthernet.hh"
+
+namespace gem5
+{
+
+bool MPIIface::ownsMPI = false;
+unsigned MPIIface::openIfaces = 0;
+
+MPIIface::MPIIface(unsigned dist_rank, unsigned dist_size,
+                   Tick sync_start, Tick sync_repeat, EventManager *em,
+                   bool use_pseudo_op, bool is_switch, int num_nodes,
+                   bool batch_packets) :
+    MsgIface(dist_rank, dist_size, sync_start, sync_repeat, em,
+             use_pseudo_op, is_switch, num_nodes, batch_packets),
+    peer(-1), tag(-1)
+{
+    int initialized;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+        // Every link has a receiver thread blocked in MPI while the
+        // simulation thread sends.
+        int provided;
+        MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+        fatal_if(provided < MPI_THREAD_MULTIPLE,
+                 "The MPI library does not support MPI_THREAD_MULTIPLE.");
+        ownsMPI = true;
+    }
+    openIfaces++;
+
+    int world_size, world_rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+    fatal_if(world_size != (int)size + 1,
+             "The MPI transport needs one process per node and one for the "
+             "switch (%d), but the MPI job has %d.", size + 1, world_size);
+    const int expected = is_switch ? size : rank;
+    fatal_if(world_rank != expected,
+             "MPI rank %d does not match the dist rank of this gem5 process "
+             "(%d).", world_rank, expected);
+}
+
+int
+MPIIface::linkTag(unsigned node_rank, unsigned iface_id)
+{
+    int *tag_ub, flag;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tag_ub, &flag);
+
+    const long tag = 1 + (long)node_rank * MaxNodeLinks + iface_id;
+    fatal_if(flag && tag > *tag_ub,
+             "Too many dist links for the MPI tag space (%d).", *tag_ub);
+    return tag;
+}
+
+void
+MPIIface::initTransport()
+{
+    // As with TCP, the switch pairs its links with the nodes' links in
+    // rank and then link order.
+    static unsigned cur_rank = 0;
+    static unsigned cur_id = 0;
+    NodeInfo ni;
+
+    if (isSwitch) {
+        peer = cur_rank;
+        tag = linkTag(cur_rank, cur_id);
+        MPI_Recv(&ni, sizeof(ni), MPI_BYTE, peer, tag, MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+        panic_if(ni.rank != cur_rank || ni.distIfaceId != cur_id,
+                 "Unexpected dist link info (node:%d, iface:%d)",
+                 ni.rank, ni.distIfaceId);
+        inform("Link okay  (iface:%d -> (node:%d, iface:%d))",
+               distIfaceId, ni.rank, ni.distIfaceId);
+        if (ni.distIfaceId < ni.distIfaceNum - 1) {
+            cur_id++;
+        } else {
+            cur_rank++;
+            cur_id = 0;
+        }
+    } else {
+        fatal_if(distIfaceNum > MaxNodeLinks,
+                 "The MPI transport supports at most %d links per node.",
+                 MaxNodeLinks);
+        peer = size;
+        tag = linkTag(rank, distIfaceId);
+        ni.rank = rank;
+        ni.distIfaceId = distIfaceId;
+        ni.distIfaceNum = distIfaceNum;
+        MPI_Send(&ni, sizeof(ni), MPI_BYTE, peer, tag, MPI_COMM_WORLD);
+        inform("Link okay  (iface:%d -> switch)", distIfaceId);
+    }
+}
+
+void
+MPIIface::sendMsg(const void *data, size_t size)
+{
+    panic_if(size > INT_MAX, "Dist message of %d bytes is too large.", size);
+    MPI_Send(data, size, MPI_BYTE, peer, tag, MPI_COMM_WORLD);
+}
+
+bool
+MPIIface::recvMsg(std::vector<uint8_t> &msg)
+{
+    if (peerClosed)
+        return false;
+
+    // Poll rather than block in MPI_Recv, so that the receiver thread
+    // can be stopped before MPI is finalised.
+    MPI_Status status;
+    int flag = 0;
+    unsigned polls = 0;
+    for (;;) {
+        MPI_Iprobe(peer, tag, MPI_COMM_WORLD, &flag, &status);
+        if (flag)
+            break;
+        if (!backoff(polls))
+            return false;
+    }
+
+    int count;
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    msg.resize(count);
+    MPI_Recv(msg.data(), count, MPI_BYTE, peer, tag, MPI_COMM_WORLD,
+             MPI_STATUS_IGNORE);
+
+    // An empty message means the peer has closed the link.
+    if (count == 0) {
+        inform("MPI link closed by peer (iface:%d)", distIfaceId);
+        peerClosed = true;
+        return false;
+    }
+    return true;
+}
+
+void
+MPIIface::closeTransport()
+{
+    DPRINTF(DistEthernet, "MPIIface::closeTransport() iface:%d\n",
+            distIfaceId);
+    if (peer >= 0)
+        MPI_Send(nullptr, 0, MPI_BYTE, peer, tag, MPI_COMM_WORLD);
+}
+
+void
+MPIIface::finishTransport()
+{
+    if (--openIfaces == 0 && ownsMPI)
+        MPI_Finalize();
+}
+
+} // namespace gem5
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * MPI transport for dist-gem5 runs.
+ *
+ * All gem5 processes of the run belong to one MPI job: the compute node
+ * of dist rank r runs as MPI rank r and the switch as the last MPI rank.
+ * Each simulated Ethernet link has its own message tag, so that every
+ * link gets an ordered channel between the switch and its node.
+ */
+
+#ifndef __DEV_NET_MPI_IFACE_HH__
+#define __DEV_NET_MPI_IFACE_HH__
+
+#include <vector>
+
+#include "dev/net/msg_iface.hh"
+
+namespace gem5
+{
+
+class MPIIface : public MsgIface
+{
+  private:
+    /** The MPI rank of the process at the other end of the link. */
+    int peer;
+    /** The tag of the messages on this link, in both directions. */
+    int tag;
+    /** Whether the peer closed the link. */
+    bool peerClosed = false;
+
+    /**
+     * Link info the nodes send to the switch, so that the switch can
+     * pair its links with the ones of the nodes in a fixed order.
+     */
+    struct NodeInfo
+    {
+        unsigned rank;
+        unsigned distIfaceId;
+        unsigned distIfaceNum;
+    };
+
+    /** Most links a single compute node can have. */
+    static constexpr int MaxNodeLinks = 16;
+
+    /** Whether we initialised MPI, and must finalise it. */
+    static bool ownsMPI;
+    /** Number of MPI interfaces not finished yet. */
+    static unsigned openIfaces;
+
+    /** The tag used for link iface_id of node node_rank. */
+    static int linkTag(unsigned node_rank, unsigned iface_id);
+
+  protected:
+    void sendMsg(const void *data, size_t size) override;
+
+    bool recvMsg(std::vector<uint8_t> &msg) override;
+
+    void closeTransport() override;
+
+    void finishTransport() override;
+
+    void initTransport() override;
+
+  public:
+    MPIIface(unsigned dist_rank, unsigned dist_size,
+             Tick sync_start, Tick sync_repeat, EventManager *em,
+             bool use_pseudo_op, bool is_switch, int num_nodes,
+             bool batch_packets);
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_MPI_IFACE_HH__
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/net/msg_iface.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DistEthernet.hh"
+#include "debug/DistEthernetCmd.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+std::vector<MsgIface *> MsgIface::ifaces;
+std::atomic<int> MsgIface::receiving(0);
+std::atomic<bool> MsgIface::closing(false);
+
+MsgIface::MsgIface(unsigned dist_rank, unsigned dist_size,
+                   Tick sync_start, Tick sync_repeat, EventManager *em,
+                   bool use_pseudo_op, bool is_switch, int num_nodes,
+                   bool batch_packets) :
+    DistIface(dist_rank, dist_size, sync_start, sync_repeat, em,
+              use_pseudo_op, is_switch, num_nodes),
+    batchPackets(batch_packets), isSwitch(is_switch)
+{
+    // Held back packets only leave with a sync command, so the periodic
+    // sync must run from the start.
+    fatal_if(batch_packets && use_pseudo_op,
+             "Batching dist packets needs the sync to start at sync_start, "
+             "not on a pseudo op.");
+
+    if (ifaces.empty())
+        registerExitCallback([]() { closeAll(); });
+    ifaces.push_back(this);
+}
+
+MsgIface::~MsgIface()
+{
+    ifaces.erase(std::find(ifaces.begin(), ifaces.end(), this));
+}
+
+void
+MsgIface::append(const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    outBuf.insert(outBuf.end(), bytes, bytes + size);
+}
+
+void
+MsgIface::flush()
+{
+    if (outBuf.empty())
+        return;
+    sendMsg(outBuf.data(), outBuf.size());
+    outBuf.clear();
+}
+
+void
+MsgIface::sendPacket(const Header &header, const EthPacketPtr &packet)
+{
+    append(&header, sizeof(header));
+    append(packet->data, packet->length);
+    if (!batchPackets)
+        flush();
+}
+
+void
+MsgIface::sendCmd(const Header &header)
+{
+    DPRINTF(DistEthernetCmd, "MsgIface::sendCmd() type: %d\n",
+            static_cast<int>(header.msgType));
+    // Like the TCP transport, global commands go to every link of this
+    // process, each along with the packets it still holds.
+    for (auto *iface: ifaces) {
+        iface->append(&header, sizeof(header));
+        iface->flush();
+    }
+}
+
+bool
+MsgIface::recvHeader(Header &header)
+{
+    if (inPos == inBuf.size()) {
+        // Announce ourselves before checking for exit, so closeAll()
+        // either sees us waiting or we see it closing.
+        receiving++;
+        const bool ok = !closing && recvMsg(inBuf);
+        receiving--;
+        if (!ok)
+            return false;
+        inPos = 0;
+    }
+
+    panic_if(inBuf.size() - inPos < sizeof(header),
+             "Truncated dist message (%d bytes left)", inBuf.size() - inPos);
+    memcpy(&header, inBuf.data() + inPos, sizeof(header));
+    inPos += sizeof(header);
+    DPRINTF(DistEthernetCmd, "MsgIface::recvHeader() type: %d\n",
+            static_cast<int>(header.msgType));
+    return true;
+}
+
+void
+MsgIface::recvPacket(const Header &header, EthPacketPtr &packet)
+{
+    panic_if(inBuf.size() - inPos < header.dataPacketLength,
+             "Truncated dist data packet (%d of %d bytes)",
+             inBuf.size() - inPos, header.dataPacketLength);
+    packet = std::make_shared<EthPacketData>(header.dataPacketLength);
+    memcpy(packet->data, inBuf.data() + inPos, header.dataPacketLength);
+    inPos += header.dataPacketLength;
+    packet->simLength = header.simLength;
+    packet->length = header.dataPacketLength;
+}
+
+bool
+MsgIface::backoff(unsigned &polls)
+{
+    // Spin while a reply is likely to be close, e.g. during a sync, then
+    // stop burning a core for idle links.
+    polls++;
+    if (polls < 1024)
+        std::this_thread::yield();
+    else if (polls < 16384)
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+    else
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return !closing;
+}
+
+void
+MsgIface::closeAll()
+{
+    DPRINTF(DistEthernet, "MsgIface::closeAll()\n");
+    for (auto *iface: ifaces)
+        iface->closeTransport();
+
+    closing = true;
+    while (receiving)
+        std::this_thread::yield();
+
+    for (auto *iface: ifaces)
+        iface->finishTransport();
+}
+
+} // namespace gem5
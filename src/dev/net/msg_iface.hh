@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Base class for dist-gem5 transports that exchange whole messages.
+ *
+ * The TCP transport streams headers and packet data as separate sends.
+ * Message based transports (MPI, shared memory rings) instead move one
+ * buffer per message. A data packet is framed as its header followed by
+ * its payload, and a sync command as just its header. Optionally, data
+ * packets are held back and sent together with the next sync command, so
+ * that each quantum needs a single message per link in each direction:
+ * the barrier and the data exchange are combined.
+ */
+
+#ifndef __DEV_NET_MSG_IFACE_HH__
+#define __DEV_NET_MSG_IFACE_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "dev/net/dist_iface.hh"
+
+namespace gem5
+{
+
+class MsgIface : public DistIface
+{
+  private:
+    /** Whether to hold data packets until the next sync command. */
+    const bool batchPackets;
+
+    /** Outgoing messages not sent yet. */
+    std::vector<uint8_t> outBuf;
+
+    /** The last message received, and how much of it was consumed. */
+    std::vector<uint8_t> inBuf;
+    size_t inPos = 0;
+
+    /** All message interfaces of this process. */
+    static std::vector<MsgIface *> ifaces;
+
+    /** Number of receiver threads waiting for a message. */
+    static std::atomic<int> receiving;
+    /** Set at exit to stop the receiver threads. */
+    static std::atomic<bool> closing;
+
+    /** Send the outgoing buffer as one message and empty it. */
+    void flush();
+
+    /** Append raw bytes to the outgoing buffer. */
+    void append(const void *data, size_t size);
+
+    /**
+     * Close every message interface, once all of their receiver threads
+     * have stopped.  Registered as an exit callback.
+     */
+    static void closeAll();
+
+  protected:
+    /** Whether this is a link of the switch process. */
+    const bool isSwitch;
+
+    /**
+     * Send one message to the peer.
+     *
+     * @param data Start of the message.
+     * @param size Size of the message in bytes, never 0.
+     */
+    virtual void sendMsg(const void *data, size_t size) = 0;
+
+    /**
+     * Block until the next message from the peer comes in.
+     *
+     * @param msg Buffer to resize and fill with the message.
+     * @return false if the peer closed the link or we are exiting.
+     */
+    virtual bool recvMsg(std::vector<uint8_t> &msg) = 0;
+
+    /** Tell the peer that this end of the link is closing. */
+    virtual void closeTransport() = 0;
+
+    /**
+     * Release the transport once no receiver thread uses it anymore.
+     * Called for every interface after all of them were closed.
+     */
+    virtual void finishTransport() {}
+
+    /**
+     * Wait a little while polling for a message, spinning at first
+     * and then sleeping for longer and longer.
+     *
+     * @param polls Number of polls so far, updated.
+     * @return false if the receiver thread must stop.
+     */
+    static bool backoff(unsigned &polls);
+
+    void sendPacket(const Header &header,
+                    const EthPacketPtr &packet) override;
+
+    void sendCmd(const Header &header) override;
+
+    bool recvHeader(Header &header) override;
+
+    void recvPacket(const Header &header, EthPacketPtr &packet) override;
+
+  public:
+    /**
+     * @param batch_packets Hold data packets back until the next sync
+     * command and send them in the same message.
+     */
+    MsgIface(unsigned dist_rank, unsigned dist_size,
+             Tick sync_start, Tick sync_repeat, EventManager *em,
+             bool use_pseudo_op, bool is_switch, int num_nodes,
+             bool batch_packets);
+
+    ~MsgIface() override;
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_MSG_IFACE_HH__
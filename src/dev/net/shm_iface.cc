@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/net/shm_iface.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DistEthernet.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+ShmIface::ShmIface(unsigned server_port, unsigned dist_rank,
+                   unsigned dist_size, Tick sync_start, Tick sync_repeat,
+                   EventManager *em, bool use_pseudo_op, bool is_switch,
+                   int num_nodes, bool batch_packets) :
+    MsgIface(dist_rank, dist_size, sync_start, sync_repeat, em,
+             use_pseudo_op, is_switch, num_nodes, batch_packets),
+    serverPort(server_port), side(is_switch ? 1 : 0)
+{
+}
+
+std::string
+ShmIface::segmentName(unsigned node_rank, unsigned iface_id) const
+{
+    return csprintf("/gem5-dist-%d-%d-%d", serverPort, node_rank, iface_id);
+}
+
+void
+ShmIface::createSegment(const std::string &name)
+{
+    // Remove any segment left behind by an earlier run that crashed.
+    shm_unlink(name.c_str());
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    panic_if(fd < 0, "shm_open(%s) failed: %s", name, strerror(errno));
+    panic_if(ftruncate(fd, sizeof(Segment)) != 0,
+             "ftruncate(%s) failed: %s", name, strerror(errno));
+
+    void *addr = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    panic_if(addr == MAP_FAILED, "mmap(%s) failed: %s", name,
+             strerror(errno));
+    close(fd);
+
+    segment = new (addr) Segment();
+    segment->distIfaceNum = distIfaceNum;
+    segment->ready.store(1, std::memory_order_release);
+}
+
+void
+ShmIface::openSegment(const std::string &name)
+{
+    // The node may not have created the segment yet.
+    int fd;
+    struct stat st;
+    bool waiting = false;
+    for (;;) {
+        fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd >= 0) {
+            panic_if(fstat(fd, &st) != 0, "fstat(%s) failed: %s", name,
+                     strerror(errno));
+            if (st.st_size >= (off_t)sizeof(Segment))
+                break;
+            close(fd);
+        } else {
+            panic_if(errno != ENOENT, "shm_open(%s) failed: %s", name,
+                     strerror(errno));
+        }
+        if (!waiting) {
+            inform("Waiting for shared memory link %s", name);
+            waiting = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    void *addr = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    panic_if(addr == MAP_FAILED, "mmap(%s) failed: %s", name,
+             strerror(errno));
+    close(fd);
+
+    segment = (Segment *)addr;
+    while (!segment->ready.load(std::memory_order_acquire))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Both ends have the segment mapped, so drop the name right away to
+    // not leak it whatever happens next.
+    shm_unlink(name.c_str());
+}
+
+void
+ShmIface::initTransport()
+{
+    // As with TCP, the switch pairs its links with the nodes' links in
+    // rank and then link order.
+    static unsigned cur_rank = 0;
+    static unsigned cur_id = 0;
+
+    if (isSwitch) {
+        openSegment(segmentName(cur_rank, cur_id));
+        inform("Link okay  (iface:%d -> (node:%d, iface:%d))",
+               distIfaceId, cur_rank, cur_id);
+        if (cur_id < segment->distIfaceNum - 1) {
+            cur_id++;
+        } else {
+            cur_rank++;
+            cur_id = 0;
+        }
+    } else {
+        createSegment(segmentName(rank, distIfaceId));
+        inform("Link okay  (iface:%d -> switch)", distIfaceId);
+    }
+}
+
+bool
+ShmIface::write(const void *data, size_t size)
+{
+    Ring &ring = segment->rings[side];
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    unsigned polls = 0;
+
+    while (size) {
+        const uint64_t space =
+            RingSize - (tail - ring.head.load(std::memory_order_acquire));
+        if (!space) {
+            if (segment->closed[1 - side].load(std::memory_order_acquire))
+                return false;
+            backoff(polls);
+            continue;
+        }
+
+        const uint64_t pos = tail % RingSize;
+        const uint64_t chunk =
+            std::min<uint64_t>({size, space, RingSize - pos});
+        memcpy(ring.data + pos, bytes, chunk);
+        tail += chunk;
+        bytes += chunk;
+        size -= chunk;
+        ring.tail.store(tail, std::memory_order_release);
+    }
+    return true;
+}
+
+bool
+ShmIface::read(void *data, size_t size)
+{
+    Ring &ring = segment->rings[1 - side];
+    uint8_t *bytes = (uint8_t *)data;
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    unsigned polls = 0;
+
+    while (size) {
+        const uint64_t avail =
+            ring.tail.load(std::memory_order_acquire) - head;
+        if (!avail) {
+            // The peer writes everything before it closes, so look at
+            // the ring again once we know it's closed.
+            if (segment->closed[1 - side].load(std::memory_order_acquire) &&
+                ring.tail.load(std::memory_order_acquire) == head) {
+                return false;
+            }
+            if (!backoff(polls))
+                return false;
+            continue;
+        }
+
+        const uint64_t pos = head % RingSize;
+        const uint64_t chunk =
+            std::min<uint64_t>({size, avail, RingSize - pos});
+        memcpy(bytes, ring.data + pos, chunk);
+        head += chunk;
+        bytes += chunk;
+        size -= chunk;
+        ring.head.store(head, std::memory_order_release);
+    }
+    return true;
+}
+
+void
+ShmIface::sendMsg(const void *data, size_t size)
+{
+    const uint64_t length = size;
+    if (!write(&length, sizeof(length)) || !write(data, size)) {
+        exitSimLoop("Message peer closed the shared memory link, "
+                    "simulation is exiting");
+    }
+}
+
+bool
+ShmIface::recvMsg(std::vector<uint8_t> &msg)
+{
+    uint64_t length;
+    if (!read(&length, sizeof(length)))
+        return false;
+    msg.resize(length);
+    if (!read(msg.data(), length))
+        return false;
+    return true;
+}
+
+void
+ShmIface::closeTransport()
+{
+    DPRINTF(DistEthernet, "ShmIface::closeTransport() iface:%d\n",
+            distIfaceId);
+    if (segment)
+        segment->closed[side].store(1, std::memory_order_release);
+}
+
+} // namespace gem5
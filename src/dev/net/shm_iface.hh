@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Shared memory transport for dist-gem5 runs on a single host.
+ *
+ * Each simulated Ethernet link is a POSIX shared memory segment holding
+ * two single producer, single consumer byte rings, one per direction.
+ * The compute node creates the segment of each of its links, and the
+ * switch maps them in rank and then link order. Segment names include
+ * the server port, which thus tells concurrent runs apart.
+ */
+
+#ifndef __DEV_NET_SHM_IFACE_HH__
+#define __DEV_NET_SHM_IFACE_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dev/net/msg_iface.hh"
+
+namespace gem5
+{
+
+class ShmIface : public MsgIface
+{
+  private:
+    /** Bytes in each direction of a link. */
+    static constexpr uint64_t RingSize = 1 << 20;
+
+    struct Ring
+    {
+        /** Bytes read so far, only written by the consumer. */
+        alignas(64) std::atomic<uint64_t> head;
+        /** Bytes written so far, only written by the producer. */
+        alignas(64) std::atomic<uint64_t> tail;
+        alignas(64) uint8_t data[RingSize];
+    };
+
+    struct Segment
+    {
+        /** Set by the node once the segment is set up. */
+        std::atomic<uint32_t> ready;
+        /** Number of links of the node, for the switch's pairing. */
+        uint32_t distIfaceNum;
+        /** Whether each side (node, switch) has closed the link. */
+        std::atomic<uint32_t> closed[2];
+        /** Ring 0 carries node to switch messages, ring 1 the others. */
+        Ring rings[2];
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "Shared memory rings need address free atomics.");
+
+    unsigned serverPort;
+
+    /**
+     * The mapped segment of the link. It stays mapped until the process
+     * exits, since the receiver thread may still poll it.
+     */
+    Segment *segment = nullptr;
+
+    /** Our side of the segment: 0 for the node, 1 for the switch. */
+    unsigned side = 0;
+
+    std::string segmentName(unsigned node_rank, unsigned iface_id) const;
+
+    /** Map the segment of a link, creating it on the node side. */
+    void createSegment(const std::string &name);
+    void openSegment(const std::string &name);
+
+    /**
+     * Copy bytes into our outgoing ring, waiting for space if needed.
+     * @return false if the peer has closed the link.
+     */
+    bool write(const void *data, size_t size);
+
+    /**
+     * Copy bytes out of our incoming ring, waiting for them if needed.
+     * @return false if the link was closed or we are exiting.
+     */
+    bool read(void *data, size_t size);
+
+  protected:
+    void sendMsg(const void *data, size_t size) override;
+
+    bool recvMsg(std::vector<uint8_t> &msg) override;
+
+    void closeTransport() override;
+
+    void initTransport() override;
+
+  public:
+    /**
+     * @param server_port Port of the run, used to name the segments.
+     */
+    ShmIface(unsigned server_port, unsigned dist_rank, unsigned dist_size,
+             Tick sync_start, Tick sync_repeat, EventManager *em,
+             bool use_pseudo_op, bool is_switch, int num_nodes,
+             bool batch_packets);
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_SHM_IFACE_HH__
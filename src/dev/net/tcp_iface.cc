@@ -263,9 +263,25 @@ TCPIface::~TCPIface()
 void
 TCPIface::sendTCP(int sock, const void *buf, unsigned length)
 {
+    struct iovec iov = { const_cast<void *>(buf), length };
+    sendTCP(sock, &iov, 1);
+}
+
+void
+TCPIface::sendTCP(int sock, const struct iovec *iov, int iov_count)
+{
+    size_t length = 0;
+    for (int i = 0; i < iov_count; i++)
+        length += iov[i].iov_len;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = const_cast<struct iovec *>(iov);
+    msg.msg_iovlen = iov_count;
+
     ssize_t ret;
 
-    ret = ::send(sock, buf, length, MSG_NOSIGNAL);
+    ret = ::sendmsg(sock, &msg, MSG_NOSIGNAL);
     if (ret < 0) {
         if (errno == ECONNRESET || errno == EPIPE) {
             exitSimLoop("Message server closed connection, simulation "
@@ -274,7 +290,7 @@ TCPIface::sendTCP(int sock, const void *buf, unsigned length)
             panic("send() failed: %s", strerror(errno));
         }
     }
-    panic_if(ret != length, "send() failed");
+    panic_if((size_t)ret != length, "send() failed");
 }
 
 bool
@@ -299,8 +315,12 @@ TCPIface::recvTCP(int sock, void *buf, unsigned length)
 void
 TCPIface::sendPacket(const Header &header, const EthPacketPtr &packet)
 {
-    sendTCP(sock, &header, sizeof(header));
-    sendTCP(sock, packet->data, packet->length);
+    // Send the header and the frame in one go.
+    struct iovec iov[2] = {
+        { const_cast<Header *>(&header), sizeof(header) },
+        { packet->data, packet->length },
+    };
+    sendTCP(sock, iov, 2);
 }
 
 void
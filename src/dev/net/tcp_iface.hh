@@ -50,6 +50,8 @@
 #define __DEV_NET_TCP_IFACE_HH__
 
 
+#include <sys/uio.h>
+
 #include <string>
 
 #include "dev/net/dist_iface.hh"
@@ -104,6 +106,16 @@ class TCPIface : public DistIface
     void
     sendTCP(int sock, const void *buf, unsigned length);
 
+    /**
+     * Send out a message made of several buffers with a single system
+     * call.
+     *
+     * @param sock TCP stream socket.
+     * @param iov The buffers of the message.
+     * @param iov_count Number of buffers.
+     */
+    void sendTCP(int sock, const struct iovec *iov, int iov_count);
+
     /**
      * Receive the next incoming message through a TCP stream socket.
      *
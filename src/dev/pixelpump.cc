@@ -37,6 +37,8 @@
 
 #include "dev/pixelpump.hh"
 
+#include <algorithm>
+
 #include "base/logging.hh"
 
 namespace gem5
@@ -220,27 +222,27 @@ BasePixelPump::renderPixels()
     // Try to handle multiple pixels at a time; doing so reduces the
     // accuracy of the underrun detection but lowers simulation
     // overhead
-    const unsigned x_end(std::min(_posX + pixelChunk, _timings.width));
+    const unsigned chunk(pixelChunk ? pixelChunk : _timings.width);
+    const unsigned x_end(std::min(_posX + chunk, _timings.width));
     const unsigned pxl_count(x_end - _posX);
     const unsigned pos_y(posY());
 
-    Pixel pixel(0, 0, 0);
-    const Pixel underrun_pixel(0, 0, 0);
-    for (; _posX < x_end && !_underrun; ++_posX) {
-        if (!nextPixel(pixel)) {
+    const auto line_it(fb.pixels.begin() + fb.width() * pos_y);
+    if (!_underrun) {
+        _posX += nextPixels(line_it + _posX, pxl_count);
+        if (_posX < x_end) {
             warn("Input buffer underrun in BasePixelPump (%u, %u)\n",
                  _posX, pos_y);
             _underrun = true;
             onUnderrun(_posX, pos_y);
-            pixel = underrun_pixel;
         }
-        fb.pixel(_posX, pos_y) = pixel;
     }
 
     // Fill remaining pixels with a dummy pixel value if we ran out of
     // data
-    for (; _posX < x_end; ++_posX)
-        fb.pixel(_posX, pos_y) = underrun_pixel;
+    const Pixel underrun_pixel(0, 0, 0);
+    std::fill(line_it + _posX, line_it + x_end, underrun_pixel);
+    _posX = x_end;
 
     // Schedule a new event to handle the next block of pixels
     if (_posX < _timings.width) {
@@ -224,13 +224,35 @@ class BasePixelPump
      */
     virtual bool nextPixel(Pixel &p) = 0;
 
+    /**
+     * Get the next batch of pixels from the scan line buffer.
+     *
+     * This is called once per pixel chunk when scanning out in
+     * timing mode. The default implementation calls nextPixel over
+     * and over, but devices that buffer whole lines can hand out the
+     * entire chunk at once. Pixels must be returned in order and the
+     * device must stop at the first pixel that isn't available.
+     *
+     * @param ps    A vector iterator to store retrieved pixels into.
+     * @param count The number of pixels being requested.
+     * @return The number of pixels retrieved before an underrun.
+     */
+    virtual size_t
+    nextPixels(std::vector<Pixel>::iterator ps, size_t count)
+    {
+        size_t done = 0;
+        while (done < count && nextPixel(*ps++))
+            done++;
+        return done;
+    }
+
     /**
      * Get the next line of pixels directly from memory. This is for use from
      * the renderFrame which is called in non-caching mode.
      *
-     * The default implementation falls back to calling nextPixel over and
-     * over, but a more efficient implementation could retrieve the entire line
-     * of pixels all at once using fewer access to memory which bypass any
+     * The default implementation falls back to calling nextPixels, but a
+     * more efficient implementation could retrieve the entire line of
+     * pixels all at once using fewer access to memory which bypass any
      * intermediate structures like an incoming FIFO.
      *
      * @param ps          A vector iterator to store retrieved pixels into.
@@ -240,10 +262,7 @@ class BasePixelPump
     virtual size_t
     nextLine(std::vector<Pixel>::iterator ps, size_t line_length)
     {
-        size_t count = 0;
-        while (count < line_length && nextPixel(*ps++))
-            count++;
-        return count;
+        return nextPixels(ps, line_length);
     }
 
     /** First pixel clock of the first VSync line. */
@@ -287,7 +306,10 @@ class BasePixelPump
     virtual void onFrameDone() {};
 
   private: // Params
-    /** Maximum number of pixels to handle per render callback */
+    /**
+     * Maximum number of pixels to handle per render callback, 0 to
+     * render the visible part of a line in a single callback.
+     */
     const unsigned pixelChunk;
 
   private:
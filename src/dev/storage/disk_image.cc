@@ -32,16 +32,20 @@
 
 #include "dev/storage/disk_image.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <string>
 
 #include "base/callback.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/DiskImageRead.hh"
@@ -53,12 +57,40 @@
 namespace gem5
 {
 
+std::streampos
+DiskImage::readSectors(uint8_t *data, std::streampos offset,
+                       uint64_t count) const
+{
+    uint64_t done = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        const uint64_t bytes = read(data + done, (uint64_t)offset + i);
+        done += bytes;
+        if (bytes != SectorSize)
+            break;
+    }
+    return done;
+}
+
+std::streampos
+DiskImage::writeSectors(const uint8_t *data, std::streampos offset,
+                        uint64_t count)
+{
+    uint64_t done = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        const uint64_t bytes = write(data + done, (uint64_t)offset + i);
+        done += bytes;
+        if (bytes != SectorSize)
+            break;
+    }
+    return done;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Raw Disk image
 //
 RawDiskImage::RawDiskImage(const Params &p)
-    : DiskImage(p), disk_size(0)
+    : DiskImage(p), fd(-1), disk_size(0), mapping(nullptr), mapping_size(0)
 {
     open(p.image_file, p.read_only);
 }
@@ -87,30 +119,47 @@ RawDiskImage::open(const std::string &filename, bool rd_only)
         readonly = rd_only;
         file = filename;
 
-        std::ios::openmode mode = std::ios::in | std::ios::binary;
-        if (!readonly)
-            mode |= std::ios::out;
-        stream.open(file.c_str(), mode);
-        if (!stream.is_open())
+        fd = ::open(file.c_str(), readonly ? O_RDONLY : O_RDWR);
+        if (fd == -1)
             panic("Error opening %s", filename);
+
+        // lseek also gives the size of block devices
+        off_t end = lseek(fd, 0, SEEK_END);
+        if (end == -1)
+            panic("Could not seek to the end of %s", filename);
+        disk_size = end;
+
+        // writes through a shared mapping reach the image like pwrite
+        if (disk_size) {
+            void *addr = mmap(nullptr, disk_size,
+                              PROT_READ | (readonly ? 0 : PROT_WRITE),
+                              MAP_SHARED, fd, 0);
+            if (addr != MAP_FAILED) {
+                mapping = (uint8_t *)addr;
+                mapping_size = disk_size;
+            }
+        }
     }
 }
 
 void
 RawDiskImage::close()
 {
-    stream.close();
+    if (mapping)
+        munmap(mapping, mapping_size);
+    mapping = nullptr;
+    mapping_size = 0;
+
+    if (fd != -1)
+        ::close(fd);
+    fd = -1;
 }
 
 std::streampos
 RawDiskImage::size() const
 {
-    if (disk_size == 0) {
-        if (!stream.is_open())
-            panic("file not open!\n");
-        stream.seekg(0, std::ios::end);
-        disk_size = stream.tellg();
-    }
+    if (fd == -1)
+        panic("file not open!\n");
 
     return disk_size / SectorSize;
 }
@@ -121,20 +170,24 @@ RawDiskImage::read(uint8_t *data, std::streampos offset) const
     if (!initialized)
         panic("RawDiskImage not initialized");
 
-    if (!stream.is_open())
+    if (fd == -1)
         panic("file not open!\n");
 
-    stream.seekg(offset * SectorSize, std::ios::beg);
-    if (!stream.good())
-        panic("Could not seek to location in file");
-
-    std::streampos pos = stream.tellg();
-    stream.read((char *)data, SectorSize);
+    const uint64_t pos = (uint64_t)offset * SectorSize;
+    ssize_t count;
+    if (pos + SectorSize <= mapping_size) {
+        memcpy(data, mapping + pos, SectorSize);
+        count = SectorSize;
+    } else {
+        count = pread(fd, data, SectorSize, pos);
+        if (count == -1)
+            panic("Could not read from %s", file);
+    }
 
     DPRINTF(DiskImageRead, "read: offset=%d\n", (uint64_t)offset);
     DDUMP(DiskImageRead, data, SectorSize);
 
-    return stream.tellg() - pos;
+    return count;
 }
 
 std::streampos
@@ -146,30 +199,90 @@ RawDiskImage::write(const uint8_t *data, std::streampos offset)
     if (readonly)
         panic("Cannot write to a read only disk image");
 
-    if (!stream.is_open())
+    if (fd == -1)
         panic("file not open!\n");
 
-    stream.seekp(offset * SectorSize, std::ios::beg);
-    if (!stream.good())
-        panic("Could not seek to location in file");
-
     DPRINTF(DiskImageWrite, "write: offset=%d\n", (uint64_t)offset);
     DDUMP(DiskImageWrite, data, SectorSize);
 
-    std::streampos pos = stream.tellp();
-    stream.write((const char *)data, SectorSize);
-    return stream.tellp() - pos;
+    const uint64_t pos = (uint64_t)offset * SectorSize;
+    if (pos + SectorSize <= mapping_size) {
+        memcpy(mapping + pos, data, SectorSize);
+        return SectorSize;
+    }
+
+    ssize_t count = pwrite(fd, data, SectorSize, pos);
+    if (count == -1)
+        panic("Could not write to %s", file);
+    disk_size = std::max<uint64_t>(disk_size, pos + count);
+    return count;
+}
+
+std::streampos
+RawDiskImage::readSectors(uint8_t *data, std::streampos offset,
+                          uint64_t count) const
+{
+    if (!initialized)
+        panic("RawDiskImage not initialized");
+
+    if (fd == -1)
+        panic("file not open!\n");
+
+    const uint64_t pos = (uint64_t)offset * SectorSize;
+    const uint64_t len = count * SectorSize;
+    DPRINTF(DiskImageRead, "read: offset=%d count=%d\n",
+            (uint64_t)offset, count);
+
+    if (pos + len <= mapping_size) {
+        memcpy(data, mapping + pos, len);
+        return len;
+    }
+
+    ssize_t done = pread(fd, data, len, pos);
+    if (done == -1)
+        panic("Could not read from %s", file);
+    return done;
+}
+
+std::streampos
+RawDiskImage::writeSectors(const uint8_t *data, std::streampos offset,
+                           uint64_t count)
+{
+    if (!initialized)
+        panic("RawDiskImage not initialized");
+
+    if (readonly)
+        panic("Cannot write to a read only disk image");
+
+    if (fd == -1)
+        panic("file not open!\n");
+
+    const uint64_t pos = (uint64_t)offset * SectorSize;
+    const uint64_t len = count * SectorSize;
+    DPRINTF(DiskImageWrite, "write: offset=%d count=%d\n",
+            (uint64_t)offset, count);
+
+    if (pos + len <= mapping_size) {
+        memcpy(mapping + pos, data, len);
+        return len;
+    }
+
+    ssize_t done = pwrite(fd, data, len, pos);
+    if (done == -1)
+        panic("Could not write to %s", file);
+    disk_size = std::max<uint64_t>(disk_size, pos + done);
+    return done;
 }
 
 ////////////////////////////////////////////////////////////////////////
 //
 // Copy on Write Disk image
 //
-const uint32_t CowDiskImage::VersionMajor = 1;
+const uint32_t CowDiskImage::VersionMajor = 2;
 const uint32_t CowDiskImage::VersionMinor = 0;
 
 CowDiskImage::CowDiskImage(const Params &p)
-    : DiskImage(p), filename(p.image_file), child(p.child), table(NULL)
+    : DiskImage(p), filename(p.image_file), child(p.child)
 {
     if (filename.empty()) {
         initSectorTable(p.table_size);
@@ -187,13 +300,6 @@ CowDiskImage::CowDiskImage(const Params &p)
 
 CowDiskImage::~CowDiskImage()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        delete (*i).second;
-        ++i;
-    }
 }
 
 void
@@ -255,24 +361,46 @@ CowDiskImage::open(const std::string &file)
     SafeReadSwap(stream, major_version);
     SafeReadSwap(stream, minor_version);
 
-    if (major_version != VersionMajor && minor_version != VersionMinor)
+    // version 1 images hold single sectors, which are read into clusters
+    if (major_version != VersionMajor && major_version != 1)
         panic("Could not open %s: invalid version %d.%d != %d.%d",
               file, major_version, minor_version, VersionMajor, VersionMinor);
 
-    uint64_t sector_count;
-    SafeReadSwap(stream, sector_count);
-    table = new SectorTable(sector_count);
-
+    table.clear();
 
-    for (uint64_t i = 0; i < sector_count; i++) {
-        uint64_t offset;
-        SafeReadSwap(stream, offset);
+    uint64_t count;
+    SafeReadSwap(stream, count);
 
-        Sector *sector = new Sector;
-        SafeRead(stream, sector, sizeof(Sector));
-
-        assert(table->find(offset) == table->end());
-        (*table)[offset] = sector;
+    if (major_version == 1) {
+        uint8_t sector[SectorSize];
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t offset;
+            SafeReadSwap(stream, offset);
+            SafeRead(stream, sector, SectorSize);
+            writeSector(sector, offset);
+        }
+    } else {
+        table.reserve(count);
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t cluster_num;
+            SafeReadSwap(stream, cluster_num);
+
+            auto &cluster = table[cluster_num];
+            assert(!cluster);
+            cluster.reset(new Cluster);
+            for (unsigned w = 0; w < ClusterSectors / 64; w++) {
+                uint64_t word;
+                SafeReadSwap(stream, word);
+                for (unsigned b = 0; b < 64; b++)
+                    cluster->valid[w * 64 + b] = (word >> b) & 1;
+            }
+            for (unsigned j = 0; j < ClusterSectors; j++) {
+                if (cluster->valid[j]) {
+                    SafeRead(stream, cluster->data + j * SectorSize,
+                             SectorSize);
+                }
+            }
+        }
     }
 
     stream.close();
@@ -284,7 +412,8 @@ CowDiskImage::open(const std::string &file)
 void
 CowDiskImage::initSectorTable(int hash_size)
 {
-    table = new SectorTable(hash_size);
+    table.clear();
+    table.reserve(divCeil(hash_size, ClusterSectors));
 
     initialized = true;
 }
@@ -343,19 +472,29 @@ CowDiskImage::save(const std::string &file) const
 
     SafeWriteSwap(stream, (uint32_t)VersionMajor);
     SafeWriteSwap(stream, (uint32_t)VersionMinor);
-    SafeWriteSwap(stream, (uint64_t)table->size());
-
-    uint64_t size = table->size();
-    SectorTable::iterator iter = table->begin();
-    SectorTable::iterator end = table->end();
-
-    for (uint64_t i = 0; i < size; i++) {
-        if (iter == end)
-            panic("Incorrect Table Size during save of COW disk image");
-
-        SafeWriteSwap(stream, (uint64_t)(*iter).first);
-        SafeWrite(stream, (*iter).second->data, sizeof(Sector));
-        ++iter;
+    SafeWriteSwap(stream, (uint64_t)table.size());
+
+    for (const auto &[cluster_num, cluster] : table) {
+        SafeWriteSwap(stream, cluster_num);
+        for (unsigned w = 0; w < ClusterSectors / 64; w++) {
+            uint64_t word = 0;
+            for (unsigned b = 0; b < 64; b++)
+                word |= uint64_t(cluster->valid[w * 64 + b]) << b;
+            SafeWriteSwap(stream, word);
+        }
+        // write runs of valid sectors at once
+        for (unsigned j = 0; j < ClusterSectors; ) {
+            unsigned end = j;
+            while (end < ClusterSectors && cluster->valid[end])
+                end++;
+            if (end > j) {
+                SafeWrite(stream, cluster->data + j * SectorSize,
+                          (end - j) * SectorSize);
+                j = end;
+            } else {
+                j++;
+            }
+        }
     }
 
     stream.close();
@@ -364,12 +503,13 @@ CowDiskImage::save(const std::string &file) const
 void
 CowDiskImage::writeback()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        child->write((*i).second->data, (*i).first);
-        ++i;
+    for (const auto &[cluster_num, cluster] : table) {
+        for (unsigned j = 0; j < ClusterSectors; j++) {
+            if (cluster->valid[j]) {
+                child->write(cluster->data + j * SectorSize,
+                             (cluster_num << ClusterBits) + j);
+            }
+        }
     }
 }
 
@@ -386,11 +526,13 @@ CowDiskImage::read(uint8_t *data, std::streampos offset) const
     if (offset > size())
         panic("access out of bounds");
 
-    SectorTable::const_iterator i = table->find(offset);
-    if (i == table->end())
+    const uint64_t sector = offset;
+    auto i = table.find(sector >> ClusterBits);
+    const unsigned idx = sector & (ClusterSectors - 1);
+    if (i == table.end() || !i->second->valid[idx])
         return child->read(data, offset);
     else {
-        memcpy(data, (*i).second->data, SectorSize);
+        memcpy(data, i->second->data + idx * SectorSize, SectorSize);
         DPRINTF(DiskImageRead, "read: offset=%d\n", (uint64_t)offset);
         DDUMP(DiskImageRead, data, SectorSize);
         return SectorSize;
@@ -406,14 +548,7 @@ CowDiskImage::write(const uint8_t *data, std::streampos offset)
     if (offset > size())
         panic("access out of bounds");
 
-    SectorTable::iterator i = table->find(offset);
-    if (i == table->end()) {
-        Sector *sector = new Sector;
-        memcpy(sector, data, SectorSize);
-        table->insert(make_pair(offset, sector));
-    } else {
-        memcpy((*i).second->data, data, SectorSize);
-    }
+    writeSector(data, offset);
 
     DPRINTF(DiskImageWrite, "write: offset=%d\n", (uint64_t)offset);
     DDUMP(DiskImageWrite, data, SectorSize);
@@ -421,6 +556,63 @@ CowDiskImage::write(const uint8_t *data, std::streampos offset)
     return SectorSize;
 }
 
+std::streampos
+CowDiskImage::readSectors(uint8_t *data, std::streampos offset,
+                          uint64_t count) const
+{
+    if (!initialized)
+        panic("CowDiskImage not initialized");
+
+    const uint64_t first = offset;
+    if (first + count > (uint64_t)size())
+        panic("access out of bounds");
+
+    // read the runs of sectors this layer doesn't have from the child
+    uint64_t done = 0;
+    uint64_t run = 0;
+    for (uint64_t i = 0; i <= count; i++) {
+        const Cluster *cluster = nullptr;
+        const uint64_t sector = first + i;
+        const unsigned idx = sector & (ClusterSectors - 1);
+        if (i < count) {
+            auto it = table.find(sector >> ClusterBits);
+            if (it != table.end() && it->second->valid[idx])
+                cluster = it->second.get();
+            else {
+                run++;
+                continue;
+            }
+        }
+
+        if (run) {
+            const uint64_t bytes = child->readSectors(
+                    data + done, sector - run, run);
+            done += bytes;
+            if (bytes != run * SectorSize)
+                return done;
+            run = 0;
+        }
+
+        if (cluster) {
+            memcpy(data + done, cluster->data + idx * SectorSize,
+                   SectorSize);
+            done += SectorSize;
+        }
+    }
+    return done;
+}
+
+void
+CowDiskImage::writeSector(const uint8_t *data, uint64_t offset)
+{
+    auto &cluster = table[offset >> ClusterBits];
+    if (!cluster)
+        cluster.reset(new Cluster);
+    const unsigned idx = offset & (ClusterSectors - 1);
+    cluster->valid[idx] = true;
+    memcpy(cluster->data + idx * SectorSize, data, SectorSize);
+}
+
 void
 CowDiskImage::serialize(CheckpointOut &cp) const
 {
@@ -33,7 +33,9 @@
 #ifndef __DEV_STORAGE_DISK_IMAGE_HH__
 #define __DEV_STORAGE_DISK_IMAGE_HH__
 
+#include <bitset>
 #include <fstream>
+#include <memory>
 #include <unordered_map>
 
 #include "params/CowDiskImage.hh"
@@ -65,6 +67,18 @@ class DiskImage : public SimObject
                                 std::streampos offset) const = 0;
     virtual std::streampos write(const uint8_t *data,
                                  std::streampos offset) = 0;
+
+    /**
+     * Read or write count consecutive sectors starting at offset. By
+     * default, the sectors are accessed one at a time.
+     *
+     * @return The number of bytes read or written
+     */
+    virtual std::streampos readSectors(uint8_t *data, std::streampos offset,
+                                       uint64_t count) const;
+    virtual std::streampos writeSectors(const uint8_t *data,
+                                        std::streampos offset,
+                                        uint64_t count);
 };
 
 /**
@@ -73,10 +87,19 @@ class DiskImage : public SimObject
 class RawDiskImage : public DiskImage
 {
   protected:
-    mutable std::fstream stream;
+    int fd;
     std::string file;
     bool readonly;
-    mutable std::streampos disk_size;
+    /** The size of the image in bytes. */
+    uint64_t disk_size;
+
+    /**
+     * The image mapped into memory, so reading a sector is a copy, or
+     * nullptr if it can't be mapped. Sectors past the mapping are
+     * accessed with pread and pwrite.
+     */
+    uint8_t *mapping;
+    uint64_t mapping_size;
 
   public:
     typedef RawDiskImageParams Params;
@@ -92,6 +115,11 @@ class RawDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    std::streampos readSectors(uint8_t *data, std::streampos offset,
+                               uint64_t count) const override;
+    std::streampos writeSectors(const uint8_t *data, std::streampos offset,
+                                uint64_t count) override;
 };
 
 /**
@@ -111,16 +139,30 @@ class CowDiskImage : public DiskImage
     static const uint32_t VersionMinor;
 
   protected:
-    struct Sector
+    /**
+     * The sectors written to this layer are held in clusters of
+     * ClusterSectors consecutive sectors, found by their cluster number
+     * (the sector offset shifted by ClusterBits), rather than in one
+     * allocation per sector.
+     */
+    static constexpr unsigned ClusterBits = 7;
+    static constexpr uint64_t ClusterSectors = uint64_t(1) << ClusterBits;
+
+    struct Cluster
     {
-        uint8_t data[SectorSize];
+        uint8_t data[ClusterSectors * SectorSize];
+        std::bitset<ClusterSectors> valid;
     };
-    typedef std::unordered_map<uint64_t, Sector *> SectorTable;
+    typedef std::unordered_map<uint64_t, std::unique_ptr<Cluster>>
+        ClusterTable;
 
   protected:
     std::string filename;
     DiskImage *child;
-    SectorTable *table;
+    ClusterTable table;
+
+    /** Copy a sector into this layer. */
+    void writeSector(const uint8_t *data, uint64_t offset);
 
   public:
     typedef CowDiskImageParams Params;
@@ -142,6 +184,9 @@ class CowDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    std::streampos readSectors(uint8_t *data, std::streampos offset,
+                               uint64_t count) const override;
 };
 
 void SafeRead(std::ifstream &stream, void *data, int count);
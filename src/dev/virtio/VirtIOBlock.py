@@ -46,5 +46,9 @@ class VirtIOBlock(VirtIODeviceBase):
     cxx_class = "gem5::VirtIOBlock"
 
     queueSize = Param.Unsigned(128, "Output queue size (pages)")
+    num_queues = Param.Unsigned(1, "Number of request queues")
+    latency = Param.Latency(
+        "0ns", "Time from the guest making a request to it completing"
+    )
 
     image = Param.DiskImage("Disk image")
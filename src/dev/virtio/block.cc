@@ -45,14 +45,23 @@ namespace gem5
 {
 
 VirtIOBlock::VirtIOBlock(const Params &params)
-    : VirtIODeviceBase(params, ID_BLOCK, sizeof(Config), 0),
-      qRequests(params.system->physProxy, byteOrder,
-                params.queueSize, *this),
+    : VirtIODeviceBase(params, ID_BLOCK, sizeof(Config),
+                       params.num_queues > 1 ? F_MQ : 0),
+      latency(params.latency),
+      completionEvent([this]() { processCompletions(); }, name()),
       image(*params.image)
 {
-    registerQueue(qRequests);
+    fatal_if(params.num_queues == 0, "%s: needs at least one queue.",
+             name());
+    for (unsigned i = 0; i < params.num_queues; i++) {
+        qRequests.emplace_back(new RequestQueue(params.system->physProxy,
+                    byteOrder, params.queueSize, *this));
+        registerQueue(*qRequests.back());
+    }
 
+    config = {};
     config.capacity = image.size();
+    config.num_queues = params.num_queues;
 }
 
 
@@ -63,12 +72,73 @@ VirtIOBlock::~VirtIOBlock()
 void
 VirtIOBlock::readConfig(PacketPtr pkt, Addr cfgOffset)
 {
-    Config cfg_out;
+    Config cfg_out = {};
     cfg_out.capacity = htog(config.capacity, byteOrder);
+    cfg_out.num_queues = htog(config.num_queues, byteOrder);
 
     readConfigBlob(pkt, cfgOffset, (uint8_t *)&cfg_out);
 }
 
+void
+VirtIOBlock::reset()
+{
+    // the guest is giving up on the requests it made
+    completions.clear();
+    if (completionEvent.scheduled())
+        deschedule(completionEvent);
+
+    VirtIODeviceBase::reset();
+}
+
+DrainState
+VirtIOBlock::drain()
+{
+    // requests are not checkpointed, so return them to the guest early
+    flushCompletions();
+    return DrainState::Drained;
+}
+
+void
+VirtIOBlock::complete(RequestQueue &queue, VirtDescriptor *desc,
+                      uint32_t len)
+{
+    if (latency == 0) {
+        queue.produceDescriptor(desc, len);
+        return;
+    }
+
+    completions.push_back({curTick() + latency, &queue, desc, len});
+    if (!completionEvent.scheduled())
+        schedule(completionEvent, completions.front().when);
+}
+
+void
+VirtIOBlock::processCompletions()
+{
+    while (!completions.empty() && completions.front().when <= curTick()) {
+        const Completion &c = completions.front();
+        c.queue->produceDescriptor(c.desc, c.len);
+        completions.pop_front();
+    }
+    kick();
+
+    if (!completions.empty())
+        schedule(completionEvent, completions.front().when);
+}
+
+void
+VirtIOBlock::flushCompletions()
+{
+    if (completions.empty())
+        return;
+
+    for (const Completion &c : completions)
+        c.queue->produceDescriptor(c.desc, c.len);
+    completions.clear();
+    deschedule(completionEvent);
+    kick();
+}
+
 VirtIOBlock::Status
 VirtIOBlock::read(const BlkRequest &req, VirtDescriptor *desc_chain,
                   size_t off_data, size_t size)
@@ -82,12 +152,10 @@ VirtIOBlock::read(const BlkRequest &req, VirtDescriptor *desc_chain,
     if (size % SectorSize != 0)
         panic("Unexpected request/sector size relationship\n");
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.read(&data[offset], sector) != SectorSize) {
-            warn("Failed to read sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    const uint64_t count = size / SectorSize;
+    if ((uint64_t)image.readSectors(data.data(), sector, count) != size) {
+        warn("Failed to read sectors %i-%i\n", sector, sector + count - 1);
+        return S_IOERR;
     }
 
     desc_chain->chainWrite(off_data, &data[0], size);
@@ -111,18 +179,26 @@ VirtIOBlock::write(const BlkRequest &req, VirtDescriptor *desc_chain,
 
     desc_chain->chainRead(off_data, &data[0], size);
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.write(&data[offset], sector) != SectorSize) {
-            warn("Failed to write sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    const uint64_t count = size / SectorSize;
+    if ((uint64_t)image.writeSectors(data.data(), sector, count) != size) {
+        warn("Failed to write sectors %i-%i\n", sector, sector + count - 1);
+        return S_IOERR;
     }
 
     return S_OK;
 
 }
 
+void
+VirtIOBlock::RequestQueue::onNotify()
+{
+    // Handle all the pending requests before telling the guest about
+    // the ones that are already done.
+    VirtQueue::onNotify();
+    if (parent.latency == 0)
+        parent.kick();
+}
+
 void
 VirtIOBlock::RequestQueue::onNotifyDescriptor(VirtDescriptor *desc)
 {
@@ -164,8 +240,8 @@ VirtIOBlock::RequestQueue::onNotifyDescriptor(VirtDescriptor *desc)
                      &status, sizeof(status));
 
     // Tell the guest that we are done with this descriptor.
-    produceDescriptor(desc, sizeof(BlkRequest) + data_size + sizeof(Status));
-    parent.kick();
+    parent.complete(*this, desc,
+                    sizeof(BlkRequest) + data_size + sizeof(Status));
 }
 
 } // namespace gem5
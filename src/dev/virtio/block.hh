@@ -38,9 +38,14 @@
 #ifndef __DEV_VIRTIO_BLOCK_HH__
 #define __DEV_VIRTIO_BLOCK_HH__
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 #include "base/compiler.hh"
 #include "dev/storage/disk_image.hh"
 #include "dev/virtio/base.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -51,7 +56,7 @@ struct VirtIOBlockParams;
  * VirtIO block device
  *
  * The block device uses the following queues:
- *  -# Requests
+ *  -# Requests (one or more, see the num_queues parameter)
  *
  * A guest issues a request by creating a descriptor chain that starts
  * with a BlkRequest. Immediately after the BlkRequest follows the
@@ -62,7 +67,10 @@ struct VirtIOBlockParams;
  *
  * The protocol supports asynchronous request completion by returning
  * descriptor chains when they have been populated by the backing
- * store. However, there is little point in doing so here.
+ * store. The backing store is accessed as soon as the guest notifies
+ * a queue, but the requests are only returned to the guest after the
+ * latency of the device. Requests which complete together are
+ * returned with a single interrupt.
  *
  * @see https://github.com/rustyrussell/virtio-spec
  * @see http://docs.oasis-open.org/virtio/virtio/v1.0/virtio-v1.0.html
@@ -75,6 +83,9 @@ class VirtIOBlock : public VirtIODeviceBase
     virtual ~VirtIOBlock();
 
     void readConfig(PacketPtr pkt, Addr cfgOffset);
+    void reset() override;
+
+    DrainState drain() override;
 
   protected:
     static const DeviceId ID_BLOCK = 0x02;
@@ -88,6 +99,20 @@ class VirtIOBlock : public VirtIODeviceBase
     struct GEM5_PACKED Config
     {
         uint64_t capacity;
+        uint32_t size_max;
+        uint32_t seg_max;
+        uint16_t cylinders;
+        uint8_t heads;
+        uint8_t sectors;
+        uint32_t blk_size;
+        uint8_t physical_block_exp;
+        uint8_t alignment_offset;
+        uint16_t min_io_size;
+        uint32_t opt_io_size;
+        uint8_t writeback;
+        uint8_t unused0;
+        /** Valid if F_MQ is negotiated */
+        uint16_t num_queues;
     };
     Config config;
 
@@ -100,6 +125,7 @@ class VirtIOBlock : public VirtIODeviceBase
     static const FeatureBits F_RO = (1 << 5);
     static const FeatureBits F_BLK_SIZE = (1 << 6);
     static const FeatureBits F_TOPOLOGY = (1 << 10);
+    static const FeatureBits F_MQ = (1 << 12);
     /** @} */
 
     /** @{
@@ -172,7 +198,8 @@ class VirtIOBlock : public VirtIODeviceBase
             : VirtQueue(proxy, bo, size), parent(_parent) {}
         virtual ~RequestQueue() {}
 
-        void onNotifyDescriptor(VirtDescriptor *desc);
+        void onNotify() override;
+        void onNotifyDescriptor(VirtDescriptor *desc) override;
 
         std::string name() const { return parent.name() + ".qRequests"; }
 
@@ -180,8 +207,33 @@ class VirtIOBlock : public VirtIODeviceBase
         VirtIOBlock &parent;
     };
 
-    /** Device I/O request queue */
-    RequestQueue qRequests;
+    /** Device I/O request queues */
+    std::vector<std::unique_ptr<RequestQueue>> qRequests;
+
+    /** A request to return to the guest */
+    struct Completion
+    {
+        Tick when;
+        RequestQueue *queue;
+        VirtDescriptor *desc;
+        uint32_t len;
+    };
+
+    /** Time from the guest making a request to it completing */
+    const Tick latency;
+
+    /** Requests in the order they complete */
+    std::deque<Completion> completions;
+
+    /** Return a request to the guest, after the latency. */
+    void complete(RequestQueue &queue, VirtDescriptor *desc, uint32_t len);
+
+    /** Return the requests which are due, and interrupt the guest. */
+    void processCompletions();
+    EventFunctionWrapper completionEvent;
+
+    /** Return all pending requests now, e.g., when draining. */
+    void flushCompletions();
 
     /** Image backing this device */
     DiskImage &image;
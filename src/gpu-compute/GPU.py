@@ -126,6 +126,12 @@ class ComputeUnit(ClockedObject):
     cxx_class = "gem5::ComputeUnit"
     cxx_header = "gpu-compute/compute_unit.hh"
 
+    # Tokens are counted atomically, so the token port can cross event
+    # queues. The memory side ports need bridges to do so. The LDS
+    # updates the CU directly and must stay on the CU's event queue.
+    _partition_port = "gmTokenPort"
+    _partition_bind = "ldsPort"
+
     wavefronts = VectorParam.Wavefront("Number of wavefronts")
     # Wavefront size is 64. This is configurable, however changing
     # this value to anything other than 64 will likely cause errors.
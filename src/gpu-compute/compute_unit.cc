@@ -147,6 +147,9 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
 
     // Initialization: all WF slots are assumed STOPPED
     idleWfs = p.n_wf * numVectorALUs;
+    fatal_if(p.n_wf > 64, "%s: at most 64 WF slots per SIMD are supported",
+             name());
+    activeWfMask.resize(numVectorALUs, 0);
     lastVaddrWF.resize(numVectorALUs);
     wfList.resize(numVectorALUs);
 
@@ -762,6 +765,13 @@ ComputeUnit::exec()
 void
 ComputeUnit::init()
 {
+    // CUs on another event queue than their shader reach the rest of
+    // the GPU through bridges. Requests to the system hub are not
+    // bridged.
+    fatal_if(eventQueue() != shader->eventQueue() && shader->systemHub,
+             "%s: CUs on their own event queue do not support a system "
+             "hub.", name());
+
     // Initialize CU Bus models and execution resources
 
     // Vector ALUs
@@ -843,7 +853,10 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
             assert(pkt->req->isInvL1());
 
             // one D-Cache inv is done, decrement counter
-            dispatcher.updateInvCounter(gpuDynInst->kern_id);
+            {
+                EventQueue::ScopedMigration migrate(dispatcher.eventQueue());
+                dispatcher.updateInvCounter(gpuDynInst->kern_id);
+            }
 
             delete pkt->senderState;
             delete pkt;
@@ -866,7 +879,11 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
 
             // once flush done, decrement counter, and return whether all
             // dirty writeback operations are done for the kernel
-            bool isWbDone = dispatcher.updateWbCounter(gpuDynInst->kern_id);
+            bool isWbDone;
+            {
+                EventQueue::ScopedMigration migrate(dispatcher.eventQueue());
+                isWbDone = dispatcher.updateWbCounter(gpuDynInst->kern_id);
+            }
 
             // not all wbs are done for the kernel, just release pkt
             // resources
@@ -882,7 +899,10 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
                     computeUnit->cu_id, w->simdId, w->wfSlotId,
                     w->wfDynId, w->wgId);
 
-            dispatcher.notifyWgCompl(w);
+            {
+                EventQueue::ScopedMigration migrate(dispatcher.eventQueue());
+                dispatcher.notifyWgCompl(w);
+            }
             w->setStatus(Wavefront::S_STOPPED);
         }
 
@@ -1274,7 +1294,7 @@ ComputeUnit::injectGlobalMemFence(GPUDynInstPtr gpuDynInst,
     // Fences will never be issued to system memory, so we can mark the
     // requestor as a device memory ID here.
     if (!req) {
-        req = std::make_shared<Request>(
+        req = Request::make(
             0, 0, 0, vramRequestorId(), 0, gpuDynInst->wfDynId);
     } else {
         req->requestorId(vramRequestorId());
@@ -1538,7 +1558,7 @@ ComputeUnit::DTLBPort::recvTimingResp(PacketPtr pkt)
             if (!stride)
                 break;
 
-            RequestPtr prefetch_req = std::make_shared<Request>(
+            RequestPtr prefetch_req = Request::make(
                 vaddr + stride * pf * X86ISA::PageBytes,
                 sizeof(uint8_t), 0,
                 computeUnit->requestorId(),
@@ -1894,8 +1914,7 @@ ComputeUnit::updateInstStats(GPUDynInstPtr gpuDynInst)
         }
     } else {
         if (gpuDynInst->isALU()) {
-            shader->total_valu_insts++;
-            if (shader->total_valu_insts == shader->max_valu_insts) {
+            if (++shader->total_valu_insts == shader->max_valu_insts) {
                 exitSimLoop("max vALU insts");
             }
             stats.vALUInsts++;
@@ -2058,13 +2077,19 @@ ComputeUnit::isVectorAluIdle(uint32_t simdId) const
 {
     assert(simdId < numVectorALUs);
 
-    for (int i_wf = 0; i_wf < shader->n_wf; ++i_wf){
-        if (wfList[simdId][i_wf]->getStatus() != Wavefront::S_STOPPED) {
-            return false;
-        }
-    }
+    return activeWfMask[simdId] == 0;
+}
 
-    return true;
+void
+ComputeUnit::setWfActive(int simdId, int wfSlotId, bool active)
+{
+    assert(simdId < numVectorALUs);
+    assert(wfSlotId < 64);
+
+    if (active)
+        activeWfMask[simdId] |= 1ULL << wfSlotId;
+    else
+        activeWfMask[simdId] &= ~(1ULL << wfSlotId);
 }
 
 /**
@@ -2077,7 +2102,7 @@ ComputeUnit::sendToLds(GPUDynInstPtr gpuDynInst)
 {
     // this is just a request to carry the GPUDynInstPtr
     // back and forth
-    RequestPtr newRequest = std::make_shared<Request>();
+    RequestPtr newRequest = Request::make();
     newRequest->setPaddr(0x0);
 
     // ReadReq is not evaluted by the LDS but the Packet ctor requires this
@@ -342,6 +342,13 @@ class ComputeUnit : public ClockedObject
     // Idle CU timeout in ticks
     Tick idleCUTimeout;
     int idleWfs;
+    /**
+     * Per SIMD mask of the WF slots that are not stopped, kept up to
+     * date by the wavefronts as their status changes. Stopped slots
+     * can never become ready, so the pipeline stages only look at the
+     * slots set here.
+     */
+    std::vector<uint64_t> activeWfMask;
     bool functionalTLB;
     bool localMemBarrier;
 
@@ -464,6 +471,7 @@ class ComputeUnit : public ClockedObject
 
     bool isDone() const;
     bool isVectorAluIdle(uint32_t simdId) const;
+    void setWfActive(int simdId, int wfSlotId, bool active);
 
     void handleSQCReturn(PacketPtr pkt);
 
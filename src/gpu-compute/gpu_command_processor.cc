@@ -186,7 +186,7 @@ GPUCommandProcessor::submitDispatchPkt(void *raw_pkt, uint32_t queue_id,
                                     is_system_page);
 
             Request::Flags flags = Request::PHYSICAL;
-            RequestPtr request = std::make_shared<Request>(chunk_addr,
+            RequestPtr request = Request::make(chunk_addr,
                 system()->cacheLineSize(), flags, walker->getDevRequestor());
             Packet *readPkt = new Packet(request, MemCmd::ReadReq);
             readPkt->dataStatic((uint8_t *)&akc + gen.complete());
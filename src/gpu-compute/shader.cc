@@ -202,12 +202,13 @@ Shader::prepareInvalidate(HSAQueueEntry *task) {
     for (int i_cu = 0; i_cu < n_cu; ++i_cu) {
         // create a request to hold INV info; the request's fields will
         // be updated in cu before use
-        auto req = std::make_shared<Request>(0, 0, 0,
-                                             cuList[i_cu]->requestorId(),
-                                             0, -1);
+        auto req = Request::make(0, 0, 0,
+                                 cuList[i_cu]->requestorId(),
+                                 0, -1);
 
         _dispatcher.updateInvCounter(kernId, +1);
         // all necessary INV flags are all set now, call cu to execute
+        EventQueue::ScopedMigration migrate(cuList[i_cu]->eventQueue());
         cuList[i_cu]->doInvalidate(req, task->dispatchId());
 
         // I don't like this. This is intrusive coding.
@@ -228,6 +229,7 @@ Shader::prepareFlush(GPUDynInstPtr gpuDynInst){
     // assuming that L2 cache is shared by all cus in the shader
     int i_cu = 0;
     _dispatcher.updateWbCounter(kernId, +1);
+    EventQueue::ScopedMigration migrate(cuList[i_cu]->eventQueue());
     cuList[i_cu]->doFlush(gpuDynInst);
 }
 
@@ -246,8 +248,17 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
         // dispatch workgroup iff the following two conditions are met:
         // (a) wg_rem is true - there are unassigned workgroups in the grid
         // (b) there are enough free slots in cu cuList[i] for this wg
+        // CUs may run on other event queues, so only touch them from
+        // their own queue
+        ComputeUnit *cu = cuList[curCu];
         int num_wfs_in_wg = 0;
-        bool can_disp = cuList[curCu]->hasDispResources(task, num_wfs_in_wg);
+        bool can_disp;
+        bool cu_asleep;
+        {
+            EventQueue::ScopedMigration migrate(cu->eventQueue());
+            can_disp = cu->hasDispResources(task, num_wfs_in_wg);
+            cu_asleep = !cu->tickEvent.scheduled();
+        }
         if (!task->dispComplete() && can_disp) {
             scheduledSomething = true;
             DPRINTF(GPUDisp, "Dispatching a workgroup to CU %d: WG %d\n",
@@ -257,7 +268,7 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
             DPRINTF(GPUWgLatency, "WG Begin cycle:%d wg:%d cu:%d\n",
                     curTick(), task->globalWgId(), curCu);
 
-            if (!cuList[curCu]->tickEvent.scheduled()) {
+            if (cu_asleep) {
                 if (!_activeCus)
                     _lastInactiveTick = curTick();
                 _activeCus++;
@@ -265,7 +276,10 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
 
             panic_if(_activeCus <= 0 || _activeCus > cuList.size(),
                      "Invalid activeCu size\n");
-            cuList[curCu]->dispWorkgroup(task, num_wfs_in_wg);
+            {
+                EventQueue::ScopedMigration migrate(cu->eventQueue());
+                cu->dispWorkgroup(task, num_wfs_in_wg);
+            }
 
             task->markWgDispatch();
             ++disp_count;
@@ -356,6 +370,16 @@ Shader::doFunctionalAccess(const RequestPtr &req, MemCmd cmd, void *data,
 void
 Shader::ScheduleAdd(int *val,Tick when,int x)
 {
+    // A CU on another event queue applies its adds itself, the counters
+    // belong to it.
+    if (curEventQueue() != eventQueue()) {
+        curEventQueue()->schedule(new EventFunctionWrapper([val, x]{
+                *val += x;
+                panic_if(*val < 0, "Negative counter value\n");
+            }, name() + ".scheduledAdd", true), curTick() + when);
+        return;
+    }
+
     sa_val.push_back(val);
     when += curTick();
     sa_when.push_back(when);
@@ -381,7 +405,7 @@ Shader::AccessMem(uint64_t address, void *ptr, uint32_t size, int cu_id,
     for (ChunkGenerator gen(address, size, cuList.at(cu_id)->cacheLineSize());
          !gen.done(); gen.next()) {
 
-        RequestPtr req = std::make_shared<Request>(
+        RequestPtr req = Request::make(
             gen.addr(), gen.size(), 0,
             cuList[0]->requestorId(), 0, 0, nullptr);
 
@@ -450,6 +474,7 @@ Shader::functionalTLBAccess(PacketPtr pkt, int cu_id, BaseMMU::Mode mode)
 void
 Shader::sampleStore(const Tick accessTime)
 {
+    EventQueue::ScopedMigration migrate(eventQueue());
     stats.storeLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -460,6 +485,7 @@ Shader::sampleStore(const Tick accessTime)
 void
 Shader::sampleLoad(const Tick accessTime)
 {
+    EventQueue::ScopedMigration migrate(eventQueue());
     stats.loadLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -467,6 +493,7 @@ Shader::sampleLoad(const Tick accessTime)
 void
 Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
 {
+    EventQueue::ScopedMigration migrate(eventQueue());
     // Only sample instructions that go all the way to main memory
     if (roundTripTime.size() != InstMemoryHop::InstMemoryHopMax) {
         return;
@@ -487,6 +514,7 @@ Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
 void
 Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
 {
+    EventQueue::ScopedMigration migrate(eventQueue());
     stats.coalsrLineAddresses.sample(lineMap.size());
     std::vector<Tick> netTimes;
 
@@ -515,6 +543,7 @@ Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
 
 void
 Shader::notifyCuSleep() {
+    EventQueue::ScopedMigration migrate(eventQueue());
     // If all CUs attached to his shader are asleep, update shaderActiveTicks
     panic_if(_activeCus <= 0 || _activeCus > cuList.size(),
              "Invalid activeCu size\n");
@@ -32,6 +32,7 @@
 #ifndef __SHADER_HH__
 #define __SHADER_HH__
 
+#include <atomic>
 #include <functional>
 #include <string>
 
@@ -258,7 +259,8 @@ class Shader : public ClockedObject
     AMDGPUSystemHub *systemHub;
 
     int64_t max_valu_insts;
-    int64_t total_valu_insts;
+    // updated by CUs that may run on other event queues
+    std::atomic<int64_t> total_valu_insts;
 
     Shader(const Params &p);
     ~Shader();
@@ -305,12 +307,14 @@ class Shader : public ClockedObject
     void
     incVectorInstSrcOperand(int num_operands)
     {
+        EventQueue::ScopedMigration migrate(eventQueue());
         stats.vectorInstSrcOperand[num_operands]++;
     }
 
     void
     incVectorInstDstOperand(int num_operands)
     {
+        EventQueue::ScopedMigration migrate(eventQueue());
         stats.vectorInstDstOperand[num_operands]++;
     }
 
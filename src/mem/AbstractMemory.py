@@ -64,6 +64,14 @@ class AbstractMemory(ClockedObject):
     # are not accessible by the CPU.
     kvm_map = Param.Bool(True, "Should KVM map this memory for the guest")
 
+    # The backing store of the memory can be bound to a host NUMA node,
+    # e.g., the node of the host CPUs running its event queue. The
+    # backing store of interleaved memories is interleaved across the
+    # nodes of the memories.
+    host_numa_node = Param.Int(
+        -1, "Host NUMA node of the backing store, -1 for the host default"
+    )
+
     # Should the bootloader include this memory when passing
     # configuration information about the physical memory layout to
     # the kernel, e.g. using ATAG or ACPI
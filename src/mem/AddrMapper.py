@@ -34,6 +34,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.params import *
+from m5.proxy import *
 from m5.SimObject import SimObject
 
 # An address mapper changes the packet addresses in going from the
@@ -82,3 +83,49 @@ class RangeAddrMapper(AddrMapper):
     remapped_ranges = VectorParam.AddrRange(
         "Ranges of memory that are being mapped to"
     )
+
+
+class TieringPolicy(Enum):
+    vals = ["hardware", "os"]
+
+
+# Tiering address mapper that splits the physical address space into a
+# fast and a slow tier, samples accesses per page, and at the end of
+# every epoch migrates the hottest slow-tier pages into the fast tier by
+# swapping them with cold fast-tier pages. The page table is a permutation
+# of page frames that starts out as the identity mapping; migrations move
+# the data and generate the corresponding read and write traffic on the
+# memory-side port. With the hardware policy pages remain accessible
+# while they are copied, whereas the OS policy blocks accesses to both
+# pages for the duration of the migration plus a fixed software overhead.
+class TieringAddrMapper(AddrMapper):
+    type = "TieringAddrMapper"
+    cxx_header = "mem/tiering_addr_mapper.hh"
+    cxx_class = "gem5::TieringAddrMapper"
+
+    system = Param.System(Parent.any, "System this mapper belongs to")
+
+    fast_range = Param.AddrRange("Address range of the fast memory tier")
+    slow_range = Param.AddrRange("Address range of the slow memory tier")
+
+    page_size = Param.MemorySize("4KiB", "Migration granularity")
+    sample_period = Param.Unsigned(
+        16, "Count one out of every sample_period accesses"
+    )
+    epoch = Param.Latency("100us", "Interval between migration decisions")
+    hot_threshold = Param.Unsigned(
+        2, "Minimum sampled accesses for a page to be migrated"
+    )
+    max_migrations = Param.Unsigned(
+        64, "Maximum number of page migrations started per epoch"
+    )
+
+    policy = Param.TieringPolicy("hardware", "Tiering policy to model")
+    os_overhead = Param.Latency(
+        "5us",
+        "Software overhead (unmapping and TLB shootdown) per migration "
+        "under the OS policy",
+    )
+    migration_window = Param.Unsigned(
+        8, "Maximum number of migration packets in flight"
+    )
@@ -45,6 +45,10 @@ class Bridge(ClockedObject):
     cxx_header = "mem/bridge.hh"
     cxx_class = "gem5::Bridge"
 
+    # Requests are queued for delay ticks before the bridge acts on
+    # them, so its upstream side can run on a different event queue.
+    _partition_port = "cpu_side_port"
+
     mem_side_port = RequestPort(
         "This port sends requests and receives responses"
     )
@@ -64,3 +68,8 @@ class Bridge(ClockedObject):
     ranges = VectorParam.AddrRange(
         [AllMemory], "Address ranges to pass through the bridge"
     )
+
+    def lookahead(self):
+        """Minimum latency of a transaction crossing the bridge. Used as
+        the lookahead when the two sides are on different event queues."""
+        return self.delay.getValue()
@@ -0,0 +1,78 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.objects.ClockedObject import ClockedObject
+
+# A CXL.mem style link to a Type-3 memory expander. Requests and
+# responses are packed into flits made of slots and sent under credit
+# flow control, with flits failing their CRC check being replayed. The
+# link is modelled in batches rather than flit by flit to keep the
+# simulation fast.
+class CXLLink(ClockedObject):
+    type = "CXLLink"
+    cxx_header = "mem/cxl_link.hh"
+    cxx_class = "gem5::CXLLink"
+
+    mem_side_port = RequestPort(
+        "This port sends requests and receives responses"
+    )
+    cpu_side_port = ResponsePort(
+        "This port receives requests and sends responses"
+    )
+    ranges = VectorParam.AddrRange(
+        [AllMemory], "Address ranges to pass through the link"
+    )
+
+    link_latency = Param.Latency(
+        "35ns", "One-way latency of the link, including the PHY and ports"
+    )
+    num_lanes = Param.Unsigned(16, "Number of lanes of the link")
+    lane_speed = Param.UInt64(32, "Gb/s speed of each lane")
+
+    # A 68B CXL flit holds four 16B slots and 4B of CRC and protocol
+    # header
+    slot_size = Param.Unsigned(16, "Size of a flit slot in bytes")
+    flit_slots = Param.Unsigned(4, "Number of slots in a flit")
+    flit_overhead = Param.Unsigned(
+        4, "Bytes of CRC and protocol header in a flit"
+    )
+    flit_error_rate = Param.Float(
+        0.0, "Probability that a flit fails its CRC check and is replayed"
+    )
+
+    req_credits = Param.Unsigned(
+        32, "Number of requests the device side can buffer"
+    )
+    resp_credits = Param.Unsigned(
+        32, "Number of responses the host side can buffer"
+    )
+    req_buffer_size = Param.Unsigned(
+        32, "Number of requests waiting for the link"
+    )
+    resp_buffer_size = Param.Unsigned(
+        32, "Number of responses waiting for the link"
+    )
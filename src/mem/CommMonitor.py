@@ -64,6 +64,24 @@ class CommMonitor(SimObject):
     # control the sample period window length of this monitor
     sample_period = Param.Clock("1ms", "Sample period for histograms")
 
+    # the per-packet distributions (burst length, latency, ITT and
+    # address) can be sampled for a subset of the requests only, while
+    # the counters behind the bandwidth, transaction and outstanding
+    # histograms still see every request
+    sample_every = Param.Unsigned(
+        1, "Sample the per-packet distributions of 1 in N requests"
+    )
+
+    # only keep the aggregate counters, which disables all per-packet
+    # distributions and the sender state used to measure latencies
+    counters_only = Param.Bool(False, "Only keep the aggregate counters")
+
+    # use fixed power-of-two buckets rather than growing histograms for
+    # the burst length and latency distributions, which is cheaper
+    log2_hists = Param.Bool(
+        False, "Use log2 buckets for burst length and latency"
+    )
+
     # for each histogram, set the number of bins and enable the user
     # to disable the measurement, reads and writes use the same
     # parameters
@@ -0,0 +1,73 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.ClockedObject import ClockedObject
+
+# A memory-side cache holding blocks of a far memory (e.g. NVM or CXL
+# attached memory) in a near memory (e.g. DRAM or HBM). Only the tags
+# are kept in the cache: the data lives in the memory connected to
+# near_mem_port, which must cover [near_mem_base, near_mem_base + size).
+# It is typically connected to a controller with in_addr_map=False, so
+# that the near memory is not visible in the physical address map.
+class DRAMCache(ClockedObject):
+    type = "DRAMCache"
+    cxx_header = "mem/dram_cache.hh"
+    cxx_class = "gem5::memory::DRAMCache"
+
+    cpu_side_port = ResponsePort(
+        "This port receives requests and sends responses"
+    )
+    near_mem_port = RequestPort("Port to the memory holding cached blocks")
+    far_mem_port = RequestPort("Port to the memory being cached")
+
+    system = Param.System(Parent.any, "System this cache belongs to")
+
+    size = Param.MemorySize("Capacity of the cache")
+    assoc = Param.Unsigned(
+        1, "Associativity, 1 for an Alloy-style direct-mapped cache"
+    )
+    block_size = Param.Unsigned(
+        Parent.cache_line_size, "Block size in bytes"
+    )
+    near_mem_base = Param.Addr(
+        0, "Near memory address of the first cached block"
+    )
+
+    tags_in_dram = Param.Bool(
+        False,
+        "Keep the tags next to the data in the near memory (Alloy cache) "
+        "instead of in SRAM",
+    )
+    tag_latency = Param.Cycles(2, "SRAM tag lookup latency")
+
+    max_pending = Param.Unsigned(
+        32, "Maximum number of requests in flight through the cache"
+    )
+    writeback_batch = Param.Unsigned(
+        8, "Number of dirty victims written back to far memory at once"
+    )
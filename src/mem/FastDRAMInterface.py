@@ -0,0 +1,112 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import json
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.MemCtrl import MemCtrl
+from m5.objects.MemInterface import MemInterface
+
+# The parameters describing the organisation and the data bus of a
+# memory, taken from the detailed interface the curves are calibrated
+# against
+_organisation_params = [
+    "write_buffer_size",
+    "read_buffer_size",
+    "device_size",
+    "device_bus_width",
+    "burst_length",
+    "device_rowbuffer_size",
+    "devices_per_rank",
+    "banks_per_rank",
+    "tCK",
+    "tBURST",
+    "tWTR",
+    "tRTW",
+    "tCS",
+]
+
+# A cycle-approximate DRAM interface, where the latency of a read is
+# looked up in curves calibrated against a detailed DRAMInterface rather
+# than modelling the banks, ranks, refresh and power-down. The curves give
+# the average latency from a burst entering the controller until its data
+# is ready, for row hits and row misses, as a function of the data bus
+# utilisation. Use configs/dram/fast_dram_calibrate.py to generate them.
+class FastDRAMInterface(MemInterface):
+    type = "FastDRAMInterface"
+    cxx_header = "mem/fast_dram_interface.hh"
+    cxx_class = "gem5::memory::FastDRAMInterface"
+
+    utilization_points = VectorParam.Float(
+        "Data bus utilisation (0 to 1) each point of the curves is at"
+    )
+    row_hit_latency = VectorParam.Latency(
+        "Read latency of a burst to the last row accessed in its bank, at "
+        "each utilisation point"
+    )
+    row_miss_latency = VectorParam.Latency(
+        "Read latency of a burst to another row, at each utilisation point"
+    )
+
+    utilization_window = Param.Latency(
+        "1us", "Window the data bus utilisation is measured over"
+    )
+
+    def controller(self):
+        """
+        Instantiate the memory controller and bind it to
+        the current interface.
+        """
+        controller = MemCtrl()
+        controller.dram = self
+        return controller
+
+    @classmethod
+    def from_calibration(cls, path, **kwargs):
+        """
+        Create an interface from the curves written by the calibration
+        script, with the organisation of the detailed interface they were
+        calibrated against. Any keyword arguments override the parameters.
+        """
+        import m5.objects
+
+        with open(path) as f:
+            calibration = json.load(f)
+
+        dram = getattr(m5.objects, calibration["mem_type"])
+        params = {name: getattr(dram, name) for name in _organisation_params}
+        params["ranks_per_channel"] = calibration["ranks_per_channel"]
+        params["addr_mapping"] = calibration["addr_mapping"]
+        params["utilization_points"] = calibration["utilization_points"]
+        params["row_hit_latency"] = [
+            f"{latency}ns" for latency in calibration["row_hit_latency"]
+        ]
+        params["row_miss_latency"] = [
+            f"{latency}ns" for latency in calibration["row_miss_latency"]
+        ]
+        params.update(kwargs)
+        return cls(**params)
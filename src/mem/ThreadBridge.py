@@ -56,5 +56,9 @@ class ThreadBridge(SimObject):
     cxx_header = "mem/thread_bridge.hh"
     cxx_class = "gem5::ThreadBridge"
 
+    # Accesses migrate to the event queue of the bridge, which is shared
+    # with its downstream side.
+    _partition_port = "in_port"
+
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
@@ -63,7 +63,8 @@ AbstractMemory::AbstractMemory(const Params &p) :
                  MemBackdoor::Readable | MemBackdoor::Writeable :
                  MemBackdoor::Readable)),
     confTableReported(p.conf_table_reported), inAddrMap(p.in_addr_map),
-    kvmMap(p.kvm_map), writeable(p.writeable), _system(NULL),
+    kvmMap(p.kvm_map), hostNumaNode(p.host_numa_node),
+    writeable(p.writeable), _system(NULL),
     stats(*this)
 {
     panic_if(!range.valid() || !range.size(),
@@ -99,7 +100,8 @@ AbstractMemory::initState()
     PortProxy proxy([this](PacketPtr pkt) { functionalAccess(pkt); },
                     system()->cacheLineSize());
 
-    panic_if(!image.write(proxy), "%s: Unable to write image.");
+    panic_if(!image.write(system()->getPhysMem(), proxy),
+             "%s: Unable to write image.");
 }
 
 void
@@ -109,12 +111,23 @@ AbstractMemory::setBackingStore(uint8_t* pmem_addr)
     if (backdoor.ptr())
         backdoor.invalidate();
 
-    // The back door can't handle interleaved memory.
-    backdoor.ptr(range.interleaved() ? nullptr : pmem_addr);
+    // The back door can't handle interleaved memory, nor tracked
+    // writes.
+    backdoor.ptr(range.interleaved() || dirtyPages ? nullptr : pmem_addr);
 
     pmemAddr = pmem_addr;
 }
 
+void
+AbstractMemory::trackDirtyPages(uint8_t* dirty_pages)
+{
+    if (backdoor.ptr())
+        backdoor.invalidate();
+    backdoor.ptr(nullptr);
+
+    dirtyPages = dirty_pages;
+}
+
 AbstractMemory::MemStats::MemStats(AbstractMemory &_mem)
     : statistics::Group(&_mem), mem(_mem),
     ADD_STAT(bytesRead, statistics::units::Byte::get(),
@@ -395,6 +408,9 @@ AbstractMemory::access(PacketPtr pkt)
 
     uint8_t *host_addr = toHostAddr(pkt->getAddr());
 
+    if (pkt->isWrite())
+        markDirty(pkt);
+
     if (pkt->cmd == MemCmd::SwapReq) {
         if (pkt->isAtomicOp()) {
             if (pmemAddr) {
@@ -493,6 +509,7 @@ AbstractMemory::functionalAccess(PacketPtr pkt)
         pkt->makeResponse();
     } else if (pkt->isWrite()) {
         if (pmemAddr) {
+            markDirty(pkt);
             pkt->writeData(host_addr);
         }
         TRACE_PACKET("Write");
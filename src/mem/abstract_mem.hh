@@ -120,6 +120,10 @@ class AbstractMemory : public ClockedObject
     // Backdoor to access this memory.
     MemBackdoor backdoor;
 
+    // One byte per dirty page of the backing store, set when the page
+    // is written, or null if writes are not tracked
+    uint8_t* dirtyPages = nullptr;
+
     // Enable specific memories to be reported to the configuration table
     const bool confTableReported;
 
@@ -129,6 +133,9 @@ class AbstractMemory : public ClockedObject
     // Should KVM map this memory for the guest
     const bool kvmMap;
 
+    // Host NUMA node of the backing store, -1 if not bound
+    const int hostNumaNode;
+
     // Are writes allowed to this memory
     const bool writeable;
 
@@ -241,6 +248,19 @@ class AbstractMemory : public ClockedObject
      */
     void setBackingStore(uint8_t* pmem_addr);
 
+    /** The size of the pages tracked for writes. */
+    static constexpr unsigned DirtyPageShift = 12;
+
+    /**
+     * Track the writes to the backing store. As writes through a
+     * backdoor could not be tracked, no backdoor is given out while
+     * tracking.
+     *
+     * @param dirty_pages One byte per page of the backing store of
+     *                    this memory, set to 1 when the page is written
+     */
+    void trackDirtyPages(uint8_t* dirty_pages);
+
     void
     getBackdoor(MemBackdoorPtr &bd_ptr)
     {
@@ -300,6 +320,23 @@ class AbstractMemory : public ClockedObject
         return pmemAddr + addr - range.start();
     }
 
+    /**
+     * Record a write to the backing store, if writes are tracked.
+     *
+     * @param pkt The packet writing to this memory
+     */
+    inline void
+    markDirty(PacketPtr pkt)
+    {
+        if (!dirtyPages)
+            return;
+        const Addr first = (pkt->getAddr() - range.start()) >> DirtyPageShift;
+        const Addr last = (pkt->getAddr() + pkt->getSize() - 1 -
+                           range.start()) >> DirtyPageShift;
+        for (Addr page = first; page <= last; ++page)
+            dirtyPages[page] = 1;
+    }
+
     /**
      * Get the memory size.
      *
@@ -338,6 +375,14 @@ class AbstractMemory : public ClockedObject
      */
     bool isKvmMap() const { return kvmMap; }
 
+    /**
+     * When a backing store is created for this memory, it is bound to
+     * this host NUMA node.
+     *
+     * @return the host NUMA node of the backing store, -1 if not bound
+     */
+    int getHostNumaNode() const { return hostNumaNode; }
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
@@ -209,13 +209,13 @@ class AddrMapper : public SimObject
 
     void recvFunctionalSnoop(PacketPtr pkt);
 
-    Tick recvAtomic(PacketPtr pkt);
+    virtual Tick recvAtomic(PacketPtr pkt);
 
     Tick recvAtomicSnoop(PacketPtr pkt);
 
-    bool recvTimingReq(PacketPtr pkt);
+    virtual bool recvTimingReq(PacketPtr pkt);
 
-    bool recvTimingResp(PacketPtr pkt);
+    virtual bool recvTimingResp(PacketPtr pkt);
 
     void recvTimingSnoopReq(PacketPtr pkt);
 
@@ -225,7 +225,7 @@ class AddrMapper : public SimObject
 
     bool isSnooping() const;
 
-    void recvReqRetry();
+    virtual void recvReqRetry();
 
     void recvRespRetry();
 
@@ -46,9 +46,11 @@
 
 #include "mem/bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/Bridge.hh"
 #include "params/Bridge.hh"
+#include "sim/simulate.hh"
 
 namespace gem5
 {
@@ -62,6 +64,7 @@ Bridge::BridgeResponsePort::BridgeResponsePort(const std::string& _name,
       memSidePort(_memSidePort), delay(_delay),
       ranges(_ranges.begin(), _ranges.end()),
       outstandingResponses(0), retryReq(false), respQueueLimit(_resp_limit),
+      reqCredits(0),
       sendEvent([this]{ trySendTiming(); }, _name)
 {
 }
@@ -82,10 +85,61 @@ Bridge::Bridge(const Params &p)
       cpuSidePort(p.name + ".cpu_side_port", *this, memSidePort,
                 ticksToCycles(p.delay), p.resp_size, p.ranges),
       memSidePort(p.name + ".mem_side_port", *this, cpuSidePort,
-                 ticksToCycles(p.delay), p.req_size)
+                 ticksToCycles(p.delay), p.req_size),
+      upstreamQueue(nullptr),
+      delayTicks(cyclesToTicks(ticksToCycles(p.delay))),
+      reqCrossing(p.name + ".req_crossing", [this](PacketPtr pkt) {
+          memSidePort.schedTimingReq(pkt, clockEdge());
+      }),
+      respCrossing(p.name + ".resp_crossing", [this](PacketPtr pkt) {
+          cpuSidePort.schedTimingResp(pkt, curTick());
+      })
 {
 }
 
+void
+Bridge::Crossing::send(EventQueue *eventq, PacketPtr pkt, Tick when)
+{
+    // keep the packets in order, as they are in the bridge queues
+    when = std::max(when, lastArrival);
+    lastArrival = when;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        packets.emplace_back(pkt, when);
+    }
+
+    eventq->schedule(new EventFunctionWrapper([this]{ deliver(); }, name,
+                                              true, CrossingPri), when);
+}
+
+void
+Bridge::Crossing::deliver()
+{
+    PacketPtr pkt;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(!packets.empty() && packets.front().tick <= curTick());
+        pkt = packets.front().pkt;
+        packets.pop_front();
+    }
+
+    receive(pkt);
+}
+
+bool
+Bridge::Crossing::trySatisfyFunctional(PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &p : packets) {
+        if (pkt->trySatisfyFunctional(p.pkt)) {
+            pkt->makeResponse();
+            return true;
+        }
+    }
+    return false;
+}
+
 Port &
 Bridge::getPort(const std::string &if_name, PortID idx)
 {
@@ -115,6 +169,22 @@ Bridge::BridgeResponsePort::respQueueFull() const
     return outstandingResponses == respQueueLimit;
 }
 
+bool
+Bridge::BridgeResponsePort::reqQueueFull() const
+{
+    return bridge.upstreamQueue ? reqCredits == 0 :
+        memSidePort.reqQueueFull();
+}
+
+void
+Bridge::BridgeResponsePort::scheduleSend(Tick when)
+{
+    if (bridge.upstreamQueue)
+        bridge.upstreamQueue->schedule(&sendEvent, when);
+    else
+        bridge.schedule(sendEvent, when);
+}
+
 bool
 Bridge::BridgeRequestPort::reqQueueFull() const
 {
@@ -137,8 +207,13 @@ Bridge::BridgeRequestPort::recvTimingResp(PacketPtr pkt)
     Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
     pkt->headerDelay = pkt->payloadDelay = 0;
 
-    cpuSidePort.schedTimingResp(pkt, bridge.clockEdge(delay) +
-                              receive_delay);
+    if (bridge.upstreamQueue) {
+        bridge.respCrossing.send(bridge.upstreamQueue, pkt,
+                                 bridge.clockEdge(delay) + receive_delay);
+    } else {
+        cpuSidePort.schedTimingResp(pkt, bridge.clockEdge(delay) +
+                                  receive_delay);
+    }
 
     return true;
 }
@@ -158,11 +233,23 @@ Bridge::BridgeResponsePort::recvTimingReq(PacketPtr pkt)
     if (retryReq)
         return false;
 
+    if (!bridge.upstreamQueue && bridge.crossing()) {
+        // the requests must not arrive before the bridge's event queue
+        // may have moved past them
+        fatal_if(bridge.delayTicks < simQuantum &&
+                 !(conservativeSync && bridge.delayTicks > 0),
+                 "%s: The delay of a bridge between event queues (%d "
+                 "ticks) must be at least sim_quantum (%d ticks).\n",
+                 bridge.name(), bridge.delayTicks, simQuantum);
+        bridge.upstreamQueue = curEventQueue();
+        reqCredits = memSidePort.reqQueueLimit;
+    }
+
     DPRINTF(Bridge, "Response queue size: %d outresp: %d\n",
             transmitList.size(), outstandingResponses);
 
     // if the request queue is full then there is no hope
-    if (memSidePort.reqQueueFull()) {
+    if (reqQueueFull()) {
         DPRINTF(Bridge, "Request queue full\n");
         retryReq = true;
     } else {
@@ -191,8 +278,16 @@ Bridge::BridgeResponsePort::recvTimingReq(PacketPtr pkt)
             Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
             pkt->headerDelay = pkt->payloadDelay = 0;
 
-            memSidePort.schedTimingReq(pkt, bridge.clockEdge(delay) +
-                                      receive_delay);
+            if (bridge.upstreamQueue) {
+                // the bridge's clock is only looked at by its own thread
+                --reqCredits;
+                bridge.reqCrossing.send(bridge.eventQueue(), pkt,
+                                        curTick() + bridge.delayTicks +
+                                        receive_delay);
+            } else {
+                memSidePort.schedTimingReq(pkt, bridge.clockEdge(delay) +
+                                          receive_delay);
+            }
         }
     }
 
@@ -213,6 +308,14 @@ Bridge::BridgeResponsePort::retryStalledReq()
     }
 }
 
+void
+Bridge::BridgeResponsePort::returnCredit()
+{
+    assert(reqCredits < memSidePort.reqQueueLimit);
+    ++reqCredits;
+    retryStalledReq();
+}
+
 void
 Bridge::BridgeRequestPort::schedTimingReq(PacketPtr pkt, Tick when)
 {
@@ -238,7 +341,7 @@ Bridge::BridgeResponsePort::schedTimingResp(PacketPtr pkt, Tick when)
     // should already be an event scheduled for sending the head
     // packet.
     if (transmitList.empty()) {
-        bridge.schedule(sendEvent, when);
+        scheduleSend(when);
     }
 
     transmitList.emplace_back(pkt, when);
@@ -275,7 +378,14 @@ Bridge::BridgeRequestPort::trySendTiming()
         // then send a retry at this point, also note that if the
         // request we stalled was waiting for the response queue
         // rather than the request queue we might stall it again
-        cpuSidePort.retryStalledReq();
+        if (bridge.upstreamQueue) {
+            bridge.upstreamQueue->schedule(new EventFunctionWrapper(
+                [this]{ cpuSidePort.returnCredit(); },
+                bridge.name() + ".credit", true, CrossingPri),
+                curTick() + bridge.delayTicks);
+        } else {
+            cpuSidePort.retryStalledReq();
+        }
     }
 
     // if the send failed, then we try again once we receive a retry,
@@ -305,17 +415,18 @@ Bridge::BridgeResponsePort::trySendTiming()
         --outstandingResponses;
 
         // If there are more packets to send, schedule event to try again.
+        // The bridge's clock is only looked at by its own thread.
         if (!transmitList.empty()) {
             DeferredPacket next_resp = transmitList.front();
             DPRINTF(Bridge, "Scheduling next send\n");
-            bridge.schedule(sendEvent, std::max(next_resp.tick,
-                                                bridge.clockEdge()));
+            scheduleSend(std::max(next_resp.tick, bridge.upstreamQueue ?
+                                  curTick() : bridge.clockEdge()));
         }
 
         // if there is space in the request queue and we were stalling
         // a request, it will definitely be possible to accept it now
         // since there is guaranteed space in the response queue
-        if (!memSidePort.reqQueueFull() && retryReq) {
+        if (!reqQueueFull() && retryReq) {
             DPRINTF(Bridge, "Request waiting for retry, now retrying\n");
             retryReq = false;
             sendRetryReq();
@@ -344,6 +455,8 @@ Bridge::BridgeResponsePort::recvAtomic(PacketPtr pkt)
     panic_if(pkt->cacheResponding(), "Should not see packets where cache "
              "is responding");
 
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(),
+                                        bridge.crossing());
     return delay * bridge.clockPeriod() + memSidePort.sendAtomic(pkt);
 }
 
@@ -351,6 +464,8 @@ Tick
 Bridge::BridgeResponsePort::recvAtomicBackdoor(
     PacketPtr pkt, MemBackdoorPtr &backdoor)
 {
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(),
+                                        bridge.crossing());
     return delay * bridge.clockPeriod() + memSidePort.sendAtomicBackdoor(
         pkt, backdoor);
 }
@@ -368,6 +483,15 @@ Bridge::BridgeResponsePort::recvFunctional(PacketPtr pkt)
         }
     }
 
+    // and the packets crossing between the event queues
+    if (bridge.respCrossing.trySatisfyFunctional(pkt) ||
+        bridge.reqCrossing.trySatisfyFunctional(pkt)) {
+        return;
+    }
+
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(),
+                                        bridge.crossing());
+
     // also check the request port's request queue
     if (memSidePort.trySatisfyFunctional(pkt)) {
         return;
@@ -383,6 +507,8 @@ void
 Bridge::BridgeResponsePort::recvMemBackdoorReq(
     const MemBackdoorReq &req, MemBackdoorPtr &backdoor)
 {
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(),
+                                        bridge.crossing());
     memSidePort.sendMemBackdoorReq(req, backdoor);
 }
 
@@ -48,11 +48,15 @@
 #define __MEM_BRIDGE_HH__
 
 #include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
 
 #include "base/types.hh"
 #include "mem/port.hh"
 #include "params/Bridge.hh"
 #include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -69,6 +73,13 @@ namespace gem5
  * before forwarding the request. If there is no space present, then
  * the bridge will delay accepting the packet until space becomes
  * available.
+ *
+ * The requestor side of the bridge may be simulated on another event
+ * queue than the bridge itself, in which case the packets cross
+ * between the queues after the bridge delay. The request queue space is
+ * then tracked by credits on the requestor side, which are returned the
+ * bridge delay after a request leaves the queue. Atomic and functional
+ * accesses migrate to the bridge's event queue.
  */
 class Bridge : public ClockedObject
 {
@@ -90,6 +101,72 @@ class Bridge : public ClockedObject
         { }
     };
 
+    /**
+     * The packets crossing from one side of the bridge to the other,
+     * when the two sides are simulated on different event queues. The
+     * packets are handed over by the sending side's thread, and are
+     * delivered in order by events on the receiving side's queue.
+     */
+    class Crossing
+    {
+      public:
+
+        Crossing(const std::string &_name,
+                 std::function<void(PacketPtr)> _receive)
+            : name(_name), receive(_receive)
+        { }
+
+        /**
+         * Send a packet across, from the sending side's thread.
+         *
+         * @param eventq the event queue of the receiving side
+         * @param pkt the packet to send
+         * @param when tick when the packet should arrive, which is
+         *             delayed to arrive after the previous packet
+         */
+        void send(EventQueue *eventq, PacketPtr pkt, Tick when);
+
+        /**
+         * Check a functional request against the packets in flight.
+         *
+         * @return true if we find a match
+         */
+        bool trySatisfyFunctional(PacketPtr pkt);
+
+      private:
+
+        /** Hand the oldest packet to the receiving side. */
+        void deliver();
+
+        const std::string name;
+
+        const std::function<void(PacketPtr)> receive;
+
+        /** The packets in flight, oldest first. */
+        std::mutex mutex;
+        std::deque<DeferredPacket> packets;
+
+        /** Arrival tick of the last packet sent. */
+        Tick lastArrival = 0;
+    };
+
+    /**
+     * Priority of the crossing events, so that the packets arriving
+     * from the other event queue are seen in the same order relative
+     * to the local events in every run.
+     */
+    static const Event::Priority CrossingPri = Event::Default_Pri - 1;
+
+    /**
+     * Is the calling thread simulating another event queue than the
+     * bridge?
+     */
+    bool
+    crossing() const
+    {
+        return inParallelMode && curEventQueue() != eventQueue();
+    }
+
     // Forward declaration to allow the response port to have a pointer
     class BridgeRequestPort;
 
@@ -135,6 +212,13 @@ class Bridge : public ClockedObject
         /** Max queue size for reserved responses. */
         unsigned int respQueueLimit;
 
+        /**
+         * The free space in the request queue, when the peer is
+         * simulated on another event queue than the bridge and
+         * cannot look at the queue itself.
+         */
+        unsigned int reqCredits;
+
         /**
          * Upstream caches need this packet until true is returned, so
          * hold it for deletion until a subsequent call
@@ -148,6 +232,16 @@ class Bridge : public ClockedObject
          */
         bool respQueueFull() const;
 
+        /**
+         * Is the request queue full, as far as this side can tell.
+         *
+         * @return true if no more requests can be accepted
+         */
+        bool reqQueueFull() const;
+
+        /** Schedule the send event, on the peer's event queue. */
+        void scheduleSend(Tick when);
+
         /**
          * Handle send event, scheduled when the packet at the head of
          * the response queue is ready to transmit (for timing
@@ -191,6 +285,12 @@ class Bridge : public ClockedObject
          */
         void retryStalledReq();
 
+        /**
+         * Free up request queue space after the request side has sent
+         * a request, when the peer is on another event queue.
+         */
+        void returnCredit();
+
       protected:
 
         /** When receiving a timing request from the peer port,
@@ -234,6 +334,7 @@ class Bridge : public ClockedObject
      */
     class BridgeRequestPort : public RequestPort
     {
+        friend class BridgeResponsePort;
 
       private:
 
@@ -328,6 +429,19 @@ class Bridge : public ClockedObject
     /** Request port of the bridge. */
     BridgeRequestPort memSidePort;
 
+    /**
+     * The event queue of the requestors, if other than the bridge's,
+     * set when the first request crosses over.
+     */
+    EventQueue *upstreamQueue;
+
+    /** The bridge delay, in ticks. */
+    const Tick delayTicks;
+
+    /** The requests and responses crossing between the event queues. */
+    Crossing reqCrossing;
+    Crossing respCrossing;
+
   public:
 
     Port &getPort(const std::string &if_name,
@@ -136,6 +136,16 @@ class BaseCache(ClockedObject):
         False, "Whether to access tags and data sequentially"
     )
 
+    # A cache that does not store data only keeps the tags and state of
+    # its blocks, and reads and writes their data directly in the backing
+    # store of the physical memory. This saves the host memory of the data
+    # for timing studies of large caches. As the data of the memory may
+    # then be newer than that of the caches below, every cache between
+    # this one and the memory must not store data either.
+    store_data = Param.Bool(
+        True, "Whether the cache stores the data of its blocks"
+    )
+
     cpu_side = ResponsePort("Upstream port closer to the CPU and/or device")
     mem_side = RequestPort("Downstream port closer to memory")
 
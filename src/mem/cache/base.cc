@@ -45,6 +45,8 @@
 
 #include "mem/cache/base.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -87,7 +89,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       compressor(p.compressor),
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
-      writebackClean(p.writeback_clean),
+      writebackClean(p.writeback_clean), storeData(p.store_data),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
                                     name(), false,
@@ -122,9 +124,8 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
     // forward snoops is overridden in init() once we can query
     // whether the connected requestor is actually snooping or not
 
-    tempBlock = new TempCacheBlk(blkSize);
+    tempBlock = new TempCacheBlk(storeData ? blkSize : 0);
 
-    tags->tagsInit();
     if (prefetcher)
         prefetcher->setCache(this);
 
@@ -196,6 +197,14 @@ BaseCache::init()
         fatal("Cache ports on %s are not connected\n", name());
     cpuSidePort.sendRangeChange();
     forwardSnoops = cpuSidePort.isSnooping();
+
+    if (!storeData) {
+        for (const auto &entry : system->getPhysMem().getBackingStore()) {
+            if (entry.inAddrMap) {
+                backingStore.push_back(entry);
+            }
+        }
+    }
 }
 
 Port &
@@ -246,7 +255,7 @@ BaseCache::handleTimingReqHit(PacketPtr pkt, CacheBlk *blk, Tick request_time)
             // Basically we need to get the MSHR in the same state as if
             // we had missed and just received the response.
             // Request *req2 = new Request(*(pkt->req));
-            RequestPtr req2 = std::make_shared<Request>(*(pkt->req));
+            RequestPtr req2 = Request::make(*(pkt->req));
             PacketPtr pkt2 = new Packet(req2, pkt->cmd);
             MSHR *mshr = allocateMissBuffer(pkt2, curTick(), true);
             // Mark the MSHR "in service" (even though it's not) to prevent
@@ -779,8 +788,12 @@ BaseCache::updateBlockData(CacheBlk *blk, const PacketPtr cpkt,
         }
     }
 
-    // Actually perform the data update
-    if (cpkt) {
+    // Actually perform the data update. If the cache does not store data,
+    // a response that is not from an owner cache holds the data that is
+    // already in the backing store, or older data if the block has been
+    // written there since, so it is not copied.
+    if (cpkt && (storeData || !cpkt->isResponse() ||
+                 cpkt->cacheResponding())) {
         cpkt->writeDataToBlock(blk->data, blkSize);
     }
 
@@ -793,6 +806,26 @@ BaseCache::updateBlockData(CacheBlk *blk, const PacketPtr cpkt,
     }
 }
 
+uint8_t *
+BaseCache::getBackingStoreData(Addr blk_addr) const
+{
+    for (const auto &entry : backingStore) {
+        if (entry.range.contains(blk_addr)) {
+            return entry.pmem + (blk_addr - entry.range.start());
+        }
+    }
+    fatal("%s does not store data, but block %#llx has no backing store\n",
+          name(), blk_addr);
+}
+
+void
+BaseCache::mapBlockData(CacheBlk *blk)
+{
+    if (!storeData) {
+        blk->data = getBackingStoreData(regenerateBlkAddr(blk));
+    }
+}
+
 void
 BaseCache::cmpAndSwap(CacheBlk *blk, PacketPtr pkt)
 {
@@ -987,9 +1020,8 @@ BaseCache::updateCompressionData(CacheBlk *&blk, const uint64_t* data,
     // metadata can be updated.
     Cycles compression_lat = Cycles(0);
     Cycles decompression_lat = Cycles(0);
-    const auto comp_data =
-        compressor->compress(data, compression_lat, decompression_lat);
-    std::size_t compression_size = comp_data->getSizeBits();
+    std::size_t compression_size = compressor->compressSizeBits(data,
+        compression_lat, decompression_lat);
 
     // Get previous compressed size
     CompressionBlk* compression_blk = static_cast<CompressionBlk*>(blk);
@@ -1068,6 +1100,7 @@ BaseCache::updateCompressionData(CacheBlk *&blk, const uint64_t* data,
             // co-allocates with the other existing superblock entry
             tags->moveBlock(blk, victim);
             blk = victim;
+            mapBlockData(blk);
             compression_blk = static_cast<CompressionBlk*>(blk);
         }
     }
@@ -1535,6 +1568,7 @@ BaseCache::handleFill(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
             // current request and then get rid of it
             blk = tempBlock;
             tempBlock->insert(addr, is_secure);
+            mapBlockData(blk);
             DPRINTF(Cache, "using temp block for %#llx (%s)\n", addr,
                     is_secure ? "s" : "ns");
         }
@@ -1625,9 +1659,8 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     // calculate the amount of extra cycles needed to read or write compressed
     // blocks.
     if (compressor && pkt->hasData()) {
-        const auto comp_data = compressor->compress(
+        blk_size_bits = compressor->compressSizeBits(
             pkt->getConstPtr<uint64_t>(), compression_lat, decompression_lat);
-        blk_size_bits = comp_data->getSizeBits();
     }
 
     // Find replacement victim
@@ -1649,6 +1682,7 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
 
     // Insert new block at victimized entry
     tags->insertBlock(pkt, victim);
+    mapBlockData(victim);
 
     // If using a compressor, set compression data. This must be done after
     // insertion, as the compression bit may be set.
@@ -1699,7 +1733,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 
     stats.writebacks[Request::wbRequestorId]++;
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure())
@@ -1727,8 +1761,15 @@ BaseCache::writebackBlk(CacheBlk *blk)
     // make sure the block is not marked dirty
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
-    pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    if (storeData) {
+        pkt->allocate();
+        pkt->setDataFromBlock(blk->data, blkSize);
+    } else {
+        // Point at the backing store rather than copying the data, which
+        // would be stale if the block is written again before the packet
+        // reaches the memory. The memory then writes the data onto itself.
+        pkt->dataStatic(blk->data);
+    }
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
@@ -1742,7 +1783,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 PacketPtr
 BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure()) {
@@ -1772,8 +1813,15 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
     // make sure the block is not marked dirty
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
-    pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    if (storeData) {
+        pkt->allocate();
+        pkt->setDataFromBlock(blk->data, blkSize);
+    } else {
+        // Point at the backing store rather than copying the data, which
+        // would be stale if the block is written again before the packet
+        // reaches the memory. The memory then writes the data onto itself.
+        pkt->dataStatic(blk->data);
+    }
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
@@ -1816,7 +1864,7 @@ BaseCache::writebackVisitor(CacheBlk &blk)
     if (blk.isSet(CacheBlk::DirtyBit)) {
         assert(blk.isValid());
 
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             regenerateBlkAddr(&blk), blkSize, 0, Request::funcRequestorId);
 
         request->taskId(blk.getTaskId());
@@ -2022,6 +2070,60 @@ BaseCache::unserialize(CheckpointIn &cp)
     }
 }
 
+void
+BaseCache::saveWarmState(CheckpointOut &cp) const
+{
+    // Replaying the blocks from the oldest to the youngest approximates
+    // the replacement state when loading
+    std::vector<std::pair<Tick, const CacheBlk *>> blks;
+    tags->forEachBlk([&blks](CacheBlk &blk) {
+        if (blk.isValid())
+            blks.emplace_back(blk.getAge(), &blk);
+    });
+    std::stable_sort(blks.begin(), blks.end(),
+        [](const auto &a, const auto &b) { return a.first > b.first; });
+
+    std::vector<Addr> warm_addrs;
+    std::vector<uint8_t> warm_secure;
+    for (const auto &[age, blk] : blks) {
+        warm_addrs.push_back(tags->regenerateBlkAddr(blk));
+        warm_secure.push_back(blk->isSecure());
+    }
+    SERIALIZE_CONTAINER(warm_addrs);
+    SERIALIZE_CONTAINER(warm_secure);
+}
+
+void
+BaseCache::loadWarmState(CheckpointIn &cp)
+{
+    std::vector<Addr> warm_addrs;
+    std::vector<uint8_t> warm_secure;
+    UNSERIALIZE_CONTAINER(warm_addrs);
+    UNSERIALIZE_CONTAINER(warm_secure);
+    fatal_if(warm_addrs.size() != warm_secure.size(),
+             "%s: Malformed warm state\n", name());
+
+    if (system->bypassCaches()) {
+        warn("%s: Not loading the warm state, as the caches are bypassed\n",
+             name());
+        return;
+    }
+
+    for (size_t i = 0; i < warm_addrs.size(); ++i) {
+        // The snapshot may have been taken with another block size
+        RequestPtr request = Request::make(
+            warm_addrs[i] & ~Addr(blkSize - 1), blkSize, 0,
+            Request::funcRequestorId);
+        if (warm_secure[i]) {
+            request->setFlags(Request::SECURE);
+        }
+
+        Packet packet(request, MemCmd::ReadReq);
+        packet.allocate();
+        recvAtomic(&packet);
+    }
+}
+
 
 BaseCache::CacheCmdStats::CacheCmdStats(BaseCache &c,
                                         const std::string &name)
@@ -49,6 +49,7 @@
 #include <cassert>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/compiler.hh"
@@ -619,6 +620,23 @@ class BaseCache : public ClockedObject
     void updateBlockData(CacheBlk *blk, const PacketPtr cpkt,
         bool has_old_data);
 
+    /**
+     * Get the data of a block in the backing store of the physical
+     * memory, for a cache that does not store data.
+     *
+     * @param blk_addr The address of the block.
+     * @return The host pointer to the data of the block.
+     */
+    uint8_t *getBackingStoreData(Addr blk_addr) const;
+
+    /**
+     * Point the data of a block being inserted at its data in the
+     * backing store, if the cache does not store data.
+     *
+     * @param blk The block being inserted.
+     */
+    void mapBlockData(CacheBlk *blk);
+
     /**
      * Handle doing the Compare and Swap function for SPARC.
      */
@@ -670,6 +688,17 @@ class BaseCache : public ClockedObject
      */
     const bool writebackClean;
 
+    /**
+     * Whether the cache stores the data of its blocks. If not, the data
+     * is read and written in the backing store of the physical memory,
+     * which saves the host memory of the data and the copies to and
+     * from it on fills and writebacks.
+     */
+    const bool storeData;
+
+    /** The backing store the data is accessed in, if not stored. */
+    std::vector<memory::BackingStoreEntry> backingStore;
+
     /**
      * Writebacks from the tempBlock, resulting on the response path
      * in atomic mode, must happen after the call to recvAtomic has
@@ -1354,6 +1383,22 @@ class BaseCache : public ClockedObject
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+
+    /**
+     * Save the addresses of the valid blocks, the oldest first. The data
+     * isn't saved, as the snapshot is meant to be taken along with a
+     * checkpoint, where the memory holds the written back data.
+     */
+    void saveWarmState(CheckpointOut &cp) const override;
+
+    /**
+     * Fill the cache with the blocks of a snapshot by replaying an atomic
+     * read of every block through the cache, rather than writing the tags
+     * directly. This keeps the rest of the hierarchy (e.g., snoop filters
+     * and the lower caches) consistent, and lets the snapshot come from a
+     * cache of a different geometry. The blocks are filled clean.
+     */
+    void loadWarmState(CheckpointIn &cp) override;
 };
 
 /**
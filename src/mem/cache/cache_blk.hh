@@ -50,6 +50,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <list>
+#include <memory>
 #include <string>
 
 #include "base/printable.hh"
@@ -505,18 +506,23 @@ class TempCacheBlk final : public CacheBlk
      */
     Addr _addr;
 
+    /** The block's own storage, if any. */
+    std::unique_ptr<uint8_t[]> storage;
+
   public:
     /**
      * Creates a temporary cache block, with its own storage.
-     * @param size The size (in bytes) of this cache block.
+     * @param size The size (in bytes) of this cache block, 0 if the data
+     *             is not stored in the block.
      */
-    TempCacheBlk(unsigned size) : CacheBlk()
+    TempCacheBlk(unsigned size)
+      : CacheBlk(), storage(size ? new uint8_t[size] : nullptr)
     {
-        data = new uint8_t[size];
+        data = storage.get();
     }
     TempCacheBlk(const TempCacheBlk&) = delete;
     TempCacheBlk& operator=(const TempCacheBlk&) = delete;
-    ~TempCacheBlk() { delete [] data; };
+    ~TempCacheBlk() = default;
 
     /**
      * Invalidate the block and clear all state.
@@ -120,7 +120,7 @@ Base::toChunks(const uint64_t* data) const
     // Turn a 64-bit array into a chunkSizeBits-array
     std::vector<Chunk> chunks((blkSize * CHAR_BIT) / chunkSizeBits, 0);
     for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+        const int index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         chunks[i] = bits(data[index_64],
             (start + 1) * chunkSizeBits - 1, start * chunkSizeBits);
@@ -139,7 +139,7 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
     // Turn a chunkSizeBits-array into a 64-bit array
     std::memset(data, 0, blkSize);
     for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+        const int index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         replaceBits(data[index_64], (start + 1) * chunkSizeBits - 1,
             start * chunkSizeBits, chunks[i]);
@@ -166,12 +166,38 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
              "Decompressed line does not match original line.");
     #endif
 
-    // Get compression size. If compressed size is greater than the size
-    // threshold, the compression is seen as unsuccessful
-    std::size_t comp_size_bits = comp_data->getSizeBits();
+    // Classify the compression and update the stats
+    const std::size_t comp_size_bits = recordCompression(
+        comp_data->getSizeBits(), comp_lat, decomp_lat);
+    comp_data->setSizeBits(comp_size_bits);
+
+    return comp_data;
+}
+
+std::size_t
+Base::compressSizeBits(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return compress(chunks, comp_lat, decomp_lat)->getSizeBits();
+}
+
+std::size_t
+Base::compressSizeBits(const uint64_t* data, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return recordCompression(
+        compressSizeBits(toChunks(data), comp_lat, decomp_lat),
+        comp_lat, decomp_lat);
+}
+
+std::size_t
+Base::recordCompression(std::size_t comp_size_bits, Cycles comp_lat,
+    Cycles decomp_lat)
+{
+    // If compressed size is greater than the size threshold, the
+    // compression is seen as unsuccessful
     if (comp_size_bits > sizeThreshold * CHAR_BIT) {
         comp_size_bits = blkSize * CHAR_BIT;
-        comp_data->setSizeBits(comp_size_bits);
         stats.failedCompressions++;
     }
 
@@ -189,7 +215,7 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
             "Compression latency: %llu, decompression latency: %llu\n",
             blkSize*8, comp_size_bits, comp_lat, decomp_lat);
 
-    return comp_data;
+    return comp_size_bits;
 }
 
 Cycles
@@ -188,6 +188,20 @@ class Base : public SimObject
         const std::vector<Chunk>& chunks, Cycles& comp_lat,
         Cycles& decomp_lat) = 0;
 
+    /**
+     * Size-only counterpart of compress(): calculate the size the cache line
+     * would be compressed to, without building its compression data. The
+     * default implementation compresses the line and discards the data;
+     * compressors override it when the size can be found faster.
+     *
+     * @param chunks The cache line to be compressed, divided into chunks.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Size of the cache line after compression, in bits.
+     */
+    virtual std::size_t compressSizeBits(const std::vector<Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat);
+
     /**
      * Apply the decompression process to the compressed data.
      *
@@ -197,6 +211,19 @@ class Base : public SimObject
     virtual void decompress(const CompressionData* comp_data,
                               uint64_t* cache_line) = 0;
 
+  private:
+    /**
+     * Classify a compression as failed if its size is above the threshold,
+     * and update the stats.
+     *
+     * @param comp_size_bits Size of the compressed line, in bits.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return The size of the line after a failed compression is restored.
+     */
+    std::size_t recordCompression(std::size_t comp_size_bits,
+        Cycles comp_lat, Cycles decomp_lat);
+
   public:
     typedef BaseCacheCompressorParams Params;
     Base(const Params &p);
@@ -217,6 +244,20 @@ class Base : public SimObject
     std::unique_ptr<CompressionData>
     compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat);
 
+    /**
+     * Calculate the size the cache line is compressed to, without building
+     * its compression data. It is equivalent to compress(), including the
+     * stats, and should be used when only the size and the latencies are
+     * needed.
+     *
+     * @param data The cache line to be compressed.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Size of the cache line after compression, in bits.
+     */
+    std::size_t compressSizeBits(const uint64_t* data, Cycles& comp_lat,
+        Cycles& decomp_lat);
+
     /**
      * Get the decompression latency if the block is compressed. Latency is 0
      * otherwise.
@@ -106,6 +106,15 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    typename DictionaryCompressor<BaseType>::PatternInfo
+    getPatternInfo(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getPatternInfo(bytes, dict_bytes,
+                                              match_location);
+    }
+
     std::string
     getName(int number) const override
     {
@@ -120,10 +129,21 @@ class BaseDelta : public DictionaryCompressor<BaseType>
 
     void addToDictionary(DictionaryEntry data) override;
 
+    /**
+     * Account for the bases in the size of a compressed line.
+     *
+     * @param size_bits The size of the compressed values, in bits.
+     * @return The size of the compressed line, in bits.
+     */
+    std::size_t adjustSizeBits(std::size_t size_bits) const;
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
   public:
     typedef BaseDictionaryCompressorParams Params;
     BaseDelta(const Params &p);
@@ -70,14 +70,10 @@ BaseDelta<BaseType, DeltaSizeBits>::addToDictionary(DictionaryEntry data)
 }
 
 template <class BaseType, std::size_t DeltaSizeBits>
-std::unique_ptr<Base::CompressionData>
-BaseDelta<BaseType, DeltaSizeBits>::compress(
-    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
-    Cycles& decomp_lat)
+std::size_t
+BaseDelta<BaseType, DeltaSizeBits>::adjustSizeBits(std::size_t size_bits)
+    const
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor<BaseType>::compress(chunks, comp_lat, decomp_lat);
-
     // If there are more bases than the maximum, the compressor failed.
     // Otherwise, we have to take into account all bases that have not
     // been used, considering that there is an implicit zero base that
@@ -85,18 +81,37 @@ BaseDelta<BaseType, DeltaSizeBits>::compress(
     const int diff = DEFAULT_MAX_NUM_BASES -
         DictionaryCompressor<BaseType>::numEntries;
     if (diff < 0) {
-        comp_data->setSizeBits(DictionaryCompressor<BaseType>::blkSize * 8);
         DPRINTF(CacheComp, "Base%dDelta%d compression failed\n",
             8 * sizeof(BaseType), DeltaSizeBits);
-    } else if (diff > 0) {
-        comp_data->setSizeBits(comp_data->getSizeBits() +
-            8 * sizeof(BaseType) * diff);
+        return DictionaryCompressor<BaseType>::blkSize * 8;
     }
+    return size_bits + 8 * sizeof(BaseType) * diff;
+}
+
+template <class BaseType, std::size_t DeltaSizeBits>
+std::unique_ptr<Base::CompressionData>
+BaseDelta<BaseType, DeltaSizeBits>::compress(
+    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    std::unique_ptr<Base::CompressionData> comp_data =
+        DictionaryCompressor<BaseType>::compress(chunks, comp_lat, decomp_lat);
+    comp_data->setSizeBits(adjustSizeBits(comp_data->getSizeBits()));
 
     // Return compressed line
     return comp_data;
 }
 
+template <class BaseType, std::size_t DeltaSizeBits>
+std::size_t
+BaseDelta<BaseType, DeltaSizeBits>::compressSizeBits(
+    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return adjustSizeBits(DictionaryCompressor<BaseType>::compressSizeBits(
+        chunks, comp_lat, decomp_lat));
+}
+
 } // namespace compression
 } // namespace gem5
 
@@ -142,6 +142,24 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     template <unsigned N>
     class SignExtendedPattern;
 
+    /**
+     * The properties of the pattern a value matches. This is all that is
+     * needed to choose the best pattern of a value and to calculate the size
+     * of a compressed line, so it allows doing so without instantiating
+     * every candidate pattern.
+     */
+    struct PatternInfo
+    {
+        /** Pattern enum number. */
+        int number;
+
+        /** Size, in bits, of the pattern. */
+        std::size_t sizeBits;
+
+        /** Whether the pattern allocates a dictionary entry. */
+        bool allocate;
+    };
+
     /**
      * Create a factory to determine if input matches a pattern. The if else
      * chains are constructed by recursion. The patterns should be explored
@@ -167,6 +185,24 @@ class DictionaryCompressor : public BaseDictionaryCompressor
                                                     match_location);
             }
         }
+
+        /**
+         * Allocation-free counterpart of getPattern(). The matching pattern
+         * is built on the stack just to extract its properties.
+         */
+        static PatternInfo
+        getPatternInfo(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            if (Head::isPattern(bytes, dict_bytes, match_location)) {
+                const Head pattern(bytes, match_location);
+                return {pattern.getPatternNumber(), pattern.getSizeBits(),
+                    pattern.shouldAllocate()};
+            } else {
+                return Factory<Tail...>::getPatternInfo(bytes, dict_bytes,
+                                                        match_location);
+            }
+        }
     };
 
     /**
@@ -188,6 +224,15 @@ class DictionaryCompressor : public BaseDictionaryCompressor
         {
             return std::unique_ptr<Pattern>(new Head(bytes, match_location));
         }
+
+        static PatternInfo
+        getPatternInfo(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            const Head pattern(bytes, match_location);
+            return {pattern.getPatternNumber(), pattern.getSizeBits(),
+                pattern.shouldAllocate()};
+        }
     };
 
     /** The dictionary. */
@@ -202,6 +247,32 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     getPattern(const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
         const int match_location) const = 0;
 
+    /**
+     * Get the properties of the pattern the data matches. Classes that
+     * inherit from this base class should implement it with their factory's
+     * getPatternInfo, so that matching does not allocate; by default the
+     * pattern is instantiated through getPattern.
+     *
+     * @param bytes The data being matched.
+     * @param dict_bytes The dictionary entry being matched against.
+     * @param match_location The index of the dictionary entry.
+     * @return The properties of the matching pattern.
+     */
+    virtual PatternInfo
+    getPatternInfo(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes, const int match_location) const;
+
+    /**
+     * Find the best pattern of the data among the dictionary entries, and
+     * update the pattern stats. The dictionary is not modified.
+     *
+     * @param bytes The data being matched.
+     * @param match_location The index of the entry matched, or -1 if the
+     *        best pattern does not depend on the dictionary.
+     * @return The properties of the best pattern.
+     */
+    PatternInfo matchValue(const DictionaryEntry& bytes, int& match_location);
+
     /**
      * Compress data.
      *
@@ -221,6 +292,19 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     /** Clear all dictionary entries. */
     virtual void resetDictionary();
 
+    /**
+     * Size-only counterpart of CompData::addEntry(): get how many bits a
+     * pattern adds to the compressed line, given the patterns added before
+     * it since the last call to resetEntrySizes().
+     *
+     * @param info The pattern being added.
+     * @return The number of bits the pattern adds to the line.
+     */
+    virtual std::size_t getEntrySizeBits(const PatternInfo& info);
+
+    /** Start the size-only compression of a new line. */
+    virtual void resetEntrySizes() {}
+
     /**
      * Add an entry to the dictionary.
      *
@@ -251,6 +335,20 @@ class DictionaryCompressor : public BaseDictionaryCompressor
 
     using BaseDictionaryCompressor::compress;
 
+    /**
+     * Calculate the size of the compressed data. It goes through the same
+     * steps as compress(), but no pattern is instantiated.
+     *
+     * @param chunks The cache line to be compressed.
+     * @return Size of the cache line after compression, in bits.
+     */
+    std::size_t compressSizeBits(const std::vector<Chunk>& chunks);
+
+    std::size_t compressSizeBits(const std::vector<Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
+    using BaseDictionaryCompressor::compressSizeBits;
+
     void decompress(const CompressionData* comp_data, uint64_t* data) override;
 
     /**
@@ -634,19 +732,17 @@ class DictionaryCompressor<T>::RepeatedValuePattern
     isPattern(const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
         const int match_location)
     {
-        // Parse the dictionary entry in a RepT granularity, and if all values
-        // are equal, this is a repeated value pattern. Since the dictionary
-        // is not being used, the match_location is irrelevant
-        T bytes_value = DictionaryCompressor<T>::fromDictionaryEntry(bytes);
+        // If the value equals its lowest RepT-sized value broadcast to all
+        // the RepT-sized positions, all of them are equal, and this is a
+        // repeated value pattern. The broadcast is a multiplication by a
+        // value with a one in the LSB of every position (e.g., 0x01010101
+        // for bytes in 32 bits). Since the dictionary is not being used, the
+        // match_location is irrelevant
+        const T bytes_value =
+            DictionaryCompressor<T>::fromDictionaryEntry(bytes);
         const RepT rep_value = bytes_value;
-        for (int i = 0; i < (sizeof(T) / sizeof(RepT)); i++) {
-            RepT cur_value = bytes_value;
-            if (cur_value != rep_value) {
-                return false;
-            }
-            bytes_value >>= 8 * sizeof(RepT);
-        }
-        return true;
+        const T broadcast = static_cast<T>(-1) / static_cast<RepT>(-1);
+        return bytes_value == static_cast<T>(rep_value * broadcast);
     }
 
     DictionaryEntry
@@ -34,6 +34,7 @@
 #define __MEM_CACHE_COMPRESSORS_DICTIONARY_COMPRESSOR_IMPL_HH__
 
 #include <algorithm>
+#include <cassert>
 
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
@@ -91,34 +92,63 @@ DictionaryCompressor<T>::instantiateDictionaryCompData() const
 }
 
 template <typename T>
-std::unique_ptr<typename DictionaryCompressor<T>::Pattern>
-DictionaryCompressor<T>::compressValue(const T data)
+typename DictionaryCompressor<T>::PatternInfo
+DictionaryCompressor<T>::getPatternInfo(const DictionaryEntry& bytes,
+    const DictionaryEntry& dict_bytes, const int match_location) const
 {
-    // Split data in bytes
-    const DictionaryEntry bytes = toDictionaryEntry(data);
+    const std::unique_ptr<Pattern> pattern =
+        getPattern(bytes, dict_bytes, match_location);
+    return {pattern->getPatternNumber(), pattern->getSizeBits(),
+        pattern->shouldAllocate()};
+}
 
+template <typename T>
+typename DictionaryCompressor<T>::PatternInfo
+DictionaryCompressor<T>::matchValue(const DictionaryEntry& bytes,
+    int& match_location)
+{
     // Start as a no-match pattern. A negative match location is used so that
     // patterns that depend on the dictionary entry don't match
-    std::unique_ptr<Pattern> pattern =
-        getPattern(bytes, toDictionaryEntry(0), -1);
+    match_location = -1;
+    PatternInfo pattern =
+        getPatternInfo(bytes, toDictionaryEntry(0), match_location);
 
     // Search for word on dictionary
     for (std::size_t i = 0; i < numEntries; i++) {
         // Try matching input with possible patterns
-        std::unique_ptr<Pattern> temp_pattern =
-            getPattern(bytes, dictionary[i], i);
+        const PatternInfo temp_pattern =
+            getPatternInfo(bytes, dictionary[i], i);
 
         // Check if found pattern is better than previous
-        if (temp_pattern->getSizeBits() < pattern->getSizeBits()) {
-            pattern = std::move(temp_pattern);
+        if (temp_pattern.sizeBits < pattern.sizeBits) {
+            pattern = temp_pattern;
+            match_location = i;
         }
     }
 
     // Update stats
-    dictionaryStats.patterns[pattern->getPatternNumber()]++;
+    dictionaryStats.patterns[pattern.number]++;
+
+    return pattern;
+}
+
+template <typename T>
+std::unique_ptr<typename DictionaryCompressor<T>::Pattern>
+DictionaryCompressor<T>::compressValue(const T data)
+{
+    // Split data in bytes
+    const DictionaryEntry bytes = toDictionaryEntry(data);
+
+    // Find the best pattern, and only instantiate that one
+    int match_location;
+    const PatternInfo info = matchValue(bytes, match_location);
+    std::unique_ptr<Pattern> pattern = getPattern(bytes,
+        (match_location < 0) ? toDictionaryEntry(0) :
+        dictionary[match_location], match_location);
+    assert(pattern->getPatternNumber() == info.number);
 
     // Push into dictionary
-    if (pattern->shouldAllocate()) {
+    if (info.allocate) {
         addToDictionary(bytes);
     }
 
@@ -163,6 +193,51 @@ DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks,
     return compress(chunks);
 }
 
+template <class T>
+std::size_t
+DictionaryCompressor<T>::getEntrySizeBits(const PatternInfo& info)
+{
+    return info.sizeBits;
+}
+
+template <class T>
+std::size_t
+DictionaryCompressor<T>::compressSizeBits(const std::vector<Chunk>& chunks)
+{
+    // Reset dictionary
+    resetDictionary();
+    resetEntrySizes();
+
+    // Match every value sequentially, as compress() does
+    std::size_t size_bits = 0;
+    for (const auto& value : chunks) {
+        const DictionaryEntry bytes = toDictionaryEntry(value);
+        int match_location;
+        const PatternInfo info = matchValue(bytes, match_location);
+        size_bits += getEntrySizeBits(info);
+        if (info.allocate) {
+            addToDictionary(bytes);
+        }
+    }
+
+    return size_bits;
+}
+
+template <class T>
+std::size_t
+DictionaryCompressor<T>::compressSizeBits(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    // Set latencies based on the degree of parallelization, and any extra
+    // latencies due to shifting or packaging
+    comp_lat = Cycles(compExtraLatency +
+        (chunks.size() / compChunksPerCycle));
+    decomp_lat = Cycles(decompExtraLatency +
+        (chunks.size() / decompChunksPerCycle));
+
+    return compressSizeBits(chunks);
+}
+
 template <class T>
 T
 DictionaryCompressor<T>::decompressValue(const Pattern* pattern)
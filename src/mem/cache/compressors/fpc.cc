@@ -78,7 +78,8 @@ FPC::FPCCompData::addEntry(std::unique_ptr<Pattern> pattern)
 }
 
 FPC::FPC(const Params &p)
-  : DictionaryCompressor<uint32_t>(p), zeroRunSizeBits(p.zero_run_bits)
+  : DictionaryCompressor<uint32_t>(p), zeroRunSizeBits(p.zero_run_bits),
+    zeroRunLength(-1)
 {
 }
 
@@ -91,6 +92,33 @@ FPC::addToDictionary(const DictionaryEntry data)
     // inserts by default
 }
 
+std::size_t
+FPC::getEntrySizeBits(const PatternInfo& info)
+{
+    if (info.number != ZERO_RUN) {
+        zeroRunLength = -1;
+        return info.sizeBits;
+    }
+
+    // Only the first zero of a run is sized; a new run is started when
+    // there is no current run, or when it has reached its maximum length
+    if ((zeroRunLength < 0) || (zeroRunLength == mask(zeroRunSizeBits))) {
+        zeroRunLength = 0;
+        ZeroRun pattern(toDictionaryEntry(0), -1);
+        pattern.setRealSize(zeroRunSizeBits);
+        return pattern.getSizeBits();
+    }
+
+    zeroRunLength++;
+    return 0;
+}
+
+void
+FPC::resetEntrySizes()
+{
+    zeroRunLength = -1;
+}
+
 std::unique_ptr<DictionaryCompressor<uint32_t>::CompData>
 FPC::instantiateDictionaryCompData() const
 {
@@ -112,19 +112,47 @@ class FPC : public DictionaryCompressor<uint32_t>
         return patternNames[number];
     };
 
+    /**
+     * Length of the zero run being matched by a size-only compression, or
+     * -1 if the last pattern was not a zero run.
+     */
+    int zeroRunLength;
+
+    /**
+     * Convenience factory declaration. The templates must be organized by
+     * size, with the smallest first, and "no-match" last.
+     */
+    using PatternFactory = Factory<ZeroRun, SignExtended4Bits,
+        SignExtended1Byte, SignExtendedHalfword, ZeroPaddedHalfword,
+        SignExtendedTwoHalfwords, RepBytes, Uncompressed>;
+
     std::unique_ptr<Pattern> getPattern(
         const DictionaryEntry& bytes,
         const DictionaryEntry& dict_bytes,
         const int match_location) const override
     {
-        using PatternFactory = Factory<ZeroRun, SignExtended4Bits,
-            SignExtended1Byte, SignExtendedHalfword, ZeroPaddedHalfword,
-            SignExtendedTwoHalfwords, RepBytes, Uncompressed>;
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    PatternInfo
+    getPatternInfo(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getPatternInfo(bytes, dict_bytes,
+                                              match_location);
+    }
+
     void addToDictionary(const DictionaryEntry data) override;
 
+    /**
+     * Zero runs are accounted for as FPCCompData::addEntry() does: only the
+     * first zero of a run, or of a run split for being too long, is sized.
+     */
+    std::size_t getEntrySizeBits(const PatternInfo& info) override;
+
+    void resetEntrySizes() override;
+
     std::unique_ptr<DictionaryCompressor::CompData>
     instantiateDictionaryCompData() const override;
 
@@ -100,6 +100,26 @@ class Multi : public Base
         statistics::Vector2d ranks;
     } multiStats;
 
+    /**
+     * Compress the line with every sub-compressor, rank their results, and
+     * get the best one.
+     *
+     * @param chunks The cache line to be compressed, divided into chunks.
+     * @param size_only Whether only the compressed sizes are needed, in
+     *        which case the sub-compressors do not build compression data.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @param best_comp_data The compression data of the best compressor,
+     *        left empty if size_only is set.
+     * @param best_size_bits The compressed size of the best compressor,
+     *        including the encoding bits, in bits.
+     * @return The index of the best compressor.
+     */
+    unsigned compressAll(const std::vector<Base::Chunk>& chunks,
+        bool size_only, Cycles& comp_lat, Cycles& decomp_lat,
+        std::unique_ptr<Base::CompressionData>& best_comp_data,
+        std::size_t& best_size_bits);
+
   public:
     typedef MultiCompressorParams Params;
     Multi(const Params &p);
@@ -111,6 +131,9 @@ class Multi : public Base
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
     void decompress(const CompressionData* comp_data, uint64_t* data) override;
 };
 
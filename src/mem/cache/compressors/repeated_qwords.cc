@@ -56,20 +56,26 @@ RepeatedQwords::addToDictionary(DictionaryEntry data)
     dictionary[numEntries++] = data;
 }
 
-std::unique_ptr<Base::CompressionData>
-RepeatedQwords::compress(const std::vector<Chunk>& chunks,
-    Cycles& comp_lat, Cycles& decomp_lat)
+std::size_t
+RepeatedQwords::adjustSizeBits(std::size_t size_bits) const
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor::compress(chunks);
-
     // Since there is a single value repeated over and over, there should be
     // a single dictionary entry. If there are more, the compressor failed
     assert(numEntries >= 1);
     if (numEntries > 1) {
-        comp_data->setSizeBits(blkSize * 8);
         DPRINTF(CacheComp, "Repeated qwords compression failed\n");
+        return blkSize * 8;
     }
+    return size_bits;
+}
+
+std::unique_ptr<Base::CompressionData>
+RepeatedQwords::compress(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    std::unique_ptr<Base::CompressionData> comp_data =
+        DictionaryCompressor::compress(chunks);
+    comp_data->setSizeBits(adjustSizeBits(comp_data->getSizeBits()));
 
     // Set compression latency
     comp_lat = Cycles(1);
@@ -81,5 +87,21 @@ RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     return comp_data;
 }
 
+std::size_t
+RepeatedQwords::compressSizeBits(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    const std::size_t size_bits =
+        adjustSizeBits(DictionaryCompressor::compressSizeBits(chunks));
+
+    // Set compression latency
+    comp_lat = Cycles(1);
+
+    // Set decompression latency
+    decomp_lat = Cycles(1);
+
+    return size_bits;
+}
+
 } // namespace compression
 } // namespace gem5
@@ -94,12 +94,33 @@ class RepeatedQwords : public DictionaryCompressor<uint64_t>
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    PatternInfo
+    getPatternInfo(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getPatternInfo(bytes, dict_bytes,
+                                              match_location);
+    }
+
     void addToDictionary(DictionaryEntry data) override;
 
+    /**
+     * Classify the compression as failed if the line does not fit the
+     * compressor.
+     *
+     * @param size_bits The size of the compressed values, in bits.
+     * @return The size of the compressed line, in bits.
+     */
+    std::size_t adjustSizeBits(std::size_t size_bits) const;
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
   public:
     typedef RepeatedQwordsCompressorParams Params;
     RepeatedQwords(const Params &p);
@@ -56,18 +56,24 @@ Zero::addToDictionary(DictionaryEntry data)
     dictionary[numEntries++] = data;
 }
 
+std::size_t
+Zero::adjustSizeBits(std::size_t size_bits) const
+{
+    // If there is any non-zero entry, the compressor failed
+    if (numEntries > 0) {
+        DPRINTF(CacheComp, "Zero compression failed\n");
+        return blkSize * 8;
+    }
+    return size_bits;
+}
+
 std::unique_ptr<Base::CompressionData>
 Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
 {
     std::unique_ptr<Base::CompressionData> comp_data =
         DictionaryCompressor::compress(chunks);
-
-    // If there is any non-zero entry, the compressor failed
-    if (numEntries > 0) {
-        comp_data->setSizeBits(blkSize * 8);
-        DPRINTF(CacheComp, "Zero compression failed\n");
-    }
+    comp_data->setSizeBits(adjustSizeBits(comp_data->getSizeBits()));
 
     // Set compression latency (Assumes full line zero comparison)
     comp_lat = Cycles(1);
@@ -79,5 +85,21 @@ Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     return comp_data;
 }
 
+std::size_t
+Zero::compressSizeBits(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    const std::size_t size_bits =
+        adjustSizeBits(DictionaryCompressor::compressSizeBits(chunks));
+
+    // Set compression latency (Assumes full line zero comparison)
+    comp_lat = Cycles(1);
+
+    // Set decompression latency
+    decomp_lat = Cycles(1);
+
+    return size_bits;
+}
+
 } // namespace compression
 } // namespace gem5
@@ -164,6 +164,19 @@ class QueuedPrefetcher(BasePrefetcher):
         that can be throttled depending on the accuracy of the prefetcher.",
     )
 
+    # A non-zero training_delay moves the training of the prefetcher (i.e.,
+    # calculatePrefetch) to a helper thread. The accesses are trained in
+    # order, and the candidates of an access are queued exactly
+    # training_delay cycles after it, so the simulation stays deterministic.
+    # Only the prefetchers whose training does not depend on the rest of the
+    # system support it, and their tables must not use a replacement policy
+    # that draws random numbers.
+    training_delay = Param.Cycles(
+        0,
+        "Cycles after an access when the prefetches it generates are "
+        "queued. If non-zero, the prefetcher is trained on a helper thread",
+    )
+
 
 class StridePrefetcherHashedSetAssociative(SetAssociative):
     type = "StridePrefetcherHashedSetAssociative"
@@ -61,6 +61,11 @@ class AssociativeSet
     replacement_policy::Base* const replacementPolicy;
     /** Vector containing the entries of the container */
     std::vector<Entry> entries;
+    /**
+     * Holds the possible entries of the last lookup, so that lookups do
+     * not need to allocate memory.
+     */
+    mutable std::vector<ReplaceableEntry *> possibleEntries;
 
   public:
     /**
@@ -58,10 +58,9 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
-    for (const auto& location : selected_entries) {
+    for (const auto& location : possibleEntries) {
         Entry* entry = static_cast<Entry *>(location);
         if ((entry->getTag() == tag) && entry->isValid() &&
             entry->isSecure() == is_secure) {
@@ -83,10 +82,9 @@ Entry*
 AssociativeSet<Entry>::findVictim(Addr addr)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
     Entry* victim = static_cast<Entry*>(replacementPolicy->getVictim(
-                            selected_entries));
+                            possibleEntries));
     // There is only one eviction for this replacement
     invalidate(victim);
     return victim;
@@ -97,12 +95,11 @@ template<class Entry>
 std::vector<Entry *>
 AssociativeSet<Entry>::getPossibleEntries(const Addr addr) const
 {
-    std::vector<ReplaceableEntry *> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
-    std::vector<Entry *> entries(selected_entries.size(), nullptr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
+    std::vector<Entry *> entries(possibleEntries.size(), nullptr);
 
     unsigned int idx = 0;
-    for (auto &entry : selected_entries) {
+    for (auto &entry : possibleEntries) {
         entries[idx++] = static_cast<Entry *>(entry);
     }
     return entries;
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CACHE_PREFETCH_COMPACT_ASSOCIATIVE_SET_HH__
+#define __CACHE_PREFETCH_COMPACT_ASSOCIATIVE_SET_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A set associative table holding a Payload per entry, for the large tables
+ * of the prefetchers, as a lighter alternative to the AssociativeSet.
+ *
+ * Instead of a TaggedEntry with its replacement data and full tag, each
+ * entry only needs a 16-bit partial tag, computed from a hash of the key
+ * and the security bit, and the payload is stored inline. Keys whose partial
+ * tags alias are indistinguishable, so a lookup may return the entry of
+ * another key, as with the partially tagged tables of real prefetchers.
+ *
+ * The replacement policy is a true LRU, kept in a single 64-bit word per set
+ * holding the ways ordered from the most to the least recently used, one
+ * nibble each, so the associativity is limited to 16.
+ */
+template<class Payload>
+class CompactAssociativeSet
+{
+    /** Bit of a partial tag marking the entry as valid */
+    static constexpr uint16_t validBit = 0x8000;
+
+    /** Associativity of the table */
+    const unsigned associativity;
+    /** Number of sets of the table */
+    const unsigned numSets;
+    /** Log2 of the number of sets */
+    const unsigned setShift;
+    /** Value of the payloads of the invalid entries */
+    const Payload initValue;
+
+    /** Partial tags of the entries, set after set */
+    std::vector<uint16_t> tags;
+    /** Recency order of the ways of each set, MRU in the lowest nibble */
+    std::vector<uint64_t> lruOrder;
+    /** Payloads of the entries, set after set */
+    std::vector<Payload> payloads;
+
+    /** Mix the bits of a key, so that both the set and tag use all of it */
+    static uint64_t
+    hash(Addr addr, bool is_secure)
+    {
+        uint64_t h = addr ^ (is_secure ? 0x9e3779b97f4a7c15ULL : 0);
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    unsigned getSet(uint64_t h) const { return h & (numSets - 1); }
+
+    uint16_t
+    getTag(uint64_t h) const
+    {
+        return ((h >> setShift) & mask(15)) | validBit;
+    }
+
+    /** Index of an entry within the table */
+    unsigned
+    getIndex(const Payload *entry) const
+    {
+        assert(entry >= payloads.data() &&
+               entry < payloads.data() + payloads.size());
+        return entry - payloads.data();
+    }
+
+    /** Move a way of a set to the MRU position */
+    void
+    touch(unsigned set, unsigned way)
+    {
+        uint64_t order = lruOrder[set];
+        unsigned pos = 0;
+        while (((order >> (4 * pos)) & 0xf) != way) {
+            pos += 1;
+        }
+        uint64_t more_recent = order & mask(4 * pos);
+        uint64_t less_recent = order & ~mask(4 * (pos + 1));
+        lruOrder[set] = less_recent | (more_recent << 4) | way;
+    }
+
+  public:
+    /**
+     * @param assoc number of entries in each set
+     * @param num_entries total number of entries of the table
+     * @param init_val value of the payload of the invalid entries
+     */
+    CompactAssociativeSet(unsigned assoc, unsigned num_entries,
+                          Payload const &init_val = Payload())
+      : associativity(assoc), numSets(num_entries / assoc),
+        setShift(floorLog2(numSets)), initValue(init_val),
+        tags(num_entries, 0), lruOrder(numSets, 0),
+        payloads(num_entries, init_val)
+    {
+        fatal_if(!isPowerOf2(num_entries), "The number of entries of a "
+                 "CompactAssociativeSet<> must be a power of 2");
+        fatal_if(!isPowerOf2(assoc) || assoc > 16 || assoc > num_entries,
+                 "The associativity of a CompactAssociativeSet<> must be a "
+                 "power of 2 not greater than 16 or the number of entries");
+        for (auto &order : lruOrder) {
+            for (unsigned way = 0; way < associativity; way++) {
+                order |= uint64_t(way) << (4 * way);
+            }
+        }
+    }
+
+    /**
+     * Find an entry within the table
+     * @param addr key of the entry
+     * @param is_secure whether the key is in the secure space
+     * @return the entry, or nullptr if it is not in the table
+     */
+    Payload *
+    findEntry(Addr addr, bool is_secure)
+    {
+        const uint64_t h = hash(addr, is_secure);
+        const uint16_t tag = getTag(h);
+        const unsigned first = getSet(h) * associativity;
+        for (unsigned idx = first; idx < first + associativity; idx++) {
+            if (tags[idx] == tag) {
+                return &payloads[idx];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Update the replacement information of an accessed entry
+     * @param entry the accessed entry
+     */
+    void
+    accessEntry(Payload *entry)
+    {
+        const unsigned idx = getIndex(entry);
+        touch(idx / associativity, idx % associativity);
+    }
+
+    /**
+     * Find the entry to be replaced to insert a key, and invalidate it
+     * @param addr key to be inserted
+     * @param is_secure whether the key is in the secure space
+     * @return the victim entry, holding the initial payload
+     */
+    Payload *
+    findVictim(Addr addr, bool is_secure)
+    {
+        const unsigned set = getSet(hash(addr, is_secure));
+        const unsigned first = set * associativity;
+
+        // Use an invalid entry if possible, or else the LRU one
+        unsigned victim = first +
+            ((lruOrder[set] >> (4 * (associativity - 1))) & 0xf);
+        for (unsigned idx = first; idx < first + associativity; idx++) {
+            if (!(tags[idx] & validBit)) {
+                victim = idx;
+                break;
+            }
+        }
+
+        invalidate(&payloads[victim]);
+        return &payloads[victim];
+    }
+
+    /**
+     * Insert a key into an entry, which becomes the MRU one of its set.
+     * The entry must have been returned by findVictim() for the same key.
+     * @param addr key to be inserted
+     * @param is_secure whether the key is in the secure space
+     * @param entry entry the key is inserted into
+     */
+    void
+    insertEntry(Addr addr, bool is_secure, Payload *entry)
+    {
+        const uint64_t h = hash(addr, is_secure);
+        const unsigned idx = getIndex(entry);
+        assert(idx / associativity == getSet(h));
+        tags[idx] = getTag(h);
+        touch(idx / associativity, idx % associativity);
+    }
+
+    /**
+     * Invalidate an entry, resetting its payload
+     * @param entry entry to be invalidated
+     */
+    void
+    invalidate(Payload *entry)
+    {
+        tags[getIndex(entry)] = 0;
+        *entry = initValue;
+    }
+
+    /**
+     * Whether an entry holds a key
+     * @param entry entry to be checked
+     */
+    bool
+    isValid(const Payload *entry) const
+    {
+        return tags[getIndex(entry)] & validBit;
+    }
+
+    /** Iterator types, over the payloads of all the entries */
+    using const_iterator = typename std::vector<Payload>::const_iterator;
+    using iterator = typename std::vector<Payload>::iterator;
+
+    iterator begin() { return payloads.begin(); }
+    iterator end() { return payloads.end(); }
+    const_iterator begin() const { return payloads.begin(); }
+    const_iterator end() const { return payloads.end(); }
+};
+
+} // namespace gem5
+
+#endif//__CACHE_PREFETCH_COMPACT_ASSOCIATIVE_SET_HH__
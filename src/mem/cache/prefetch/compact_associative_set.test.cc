@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mem/cache/prefetch/compact_associative_set.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Insert a key into a table, with the given payload. */
+template<class Payload>
+Payload *
+insert(CompactAssociativeSet<Payload> &table, Addr addr, Payload value,
+       bool is_secure = false)
+{
+    Payload *entry = table.findVictim(addr, is_secure);
+    table.insertEntry(addr, is_secure, entry);
+    *entry = value;
+    return entry;
+}
+
+} // anonymous namespace
+
+/** An inserted key is found, with its payload, and other keys are not. */
+TEST(CompactAssociativeSetTest, InsertAndFind)
+{
+    CompactAssociativeSet<int> table(4, 64, -1);
+    insert(table, 0x400, 7);
+
+    int *entry = table.findEntry(0x400, false);
+    ASSERT_NE(entry, nullptr);
+    ASSERT_TRUE(table.isValid(entry));
+    ASSERT_EQ(*entry, 7);
+    ASSERT_EQ(table.findEntry(0x404, false), nullptr);
+}
+
+/** The security bit is part of the key. */
+TEST(CompactAssociativeSetTest, SecureKey)
+{
+    CompactAssociativeSet<int> table(4, 64, -1);
+    insert(table, 0x400, 1, true);
+
+    ASSERT_NE(table.findEntry(0x400, true), nullptr);
+    ASSERT_EQ(table.findEntry(0x400, false), nullptr);
+}
+
+/** An invalidated entry is not found, and holds the initial payload. */
+TEST(CompactAssociativeSetTest, Invalidate)
+{
+    CompactAssociativeSet<int> table(4, 64, -1);
+    int *entry = insert(table, 0x400, 7);
+    table.invalidate(entry);
+
+    ASSERT_FALSE(table.isValid(entry));
+    ASSERT_EQ(*entry, -1);
+    ASSERT_EQ(table.findEntry(0x400, false), nullptr);
+}
+
+/** The least recently used entry of a full set is replaced. */
+TEST(CompactAssociativeSetTest, LRUReplacement)
+{
+    // A single set, so that all the keys map to it
+    CompactAssociativeSet<int> table(4, 4, -1);
+    for (int key = 0; key < 4; key++) {
+        insert(table, key, key);
+    }
+    table.accessEntry(table.findEntry(0, false));
+
+    insert(table, 4, 4);
+    ASSERT_NE(table.findEntry(0, false), nullptr);
+    ASSERT_EQ(table.findEntry(1, false), nullptr);
+    ASSERT_NE(table.findEntry(2, false), nullptr);
+    ASSERT_NE(table.findEntry(3, false), nullptr);
+    ASSERT_NE(table.findEntry(4, false), nullptr);
+
+    insert(table, 5, 5);
+    ASSERT_EQ(table.findEntry(2, false), nullptr);
+}
+
+/** All the 16 ways fit in the packed replacement state. */
+TEST(CompactAssociativeSetTest, SixteenWays)
+{
+    CompactAssociativeSet<int> table(16, 16, -1);
+    for (int key = 0; key < 16; key++) {
+        insert(table, key, key);
+    }
+    for (int key = 15; key >= 0; key--) {
+        table.accessEntry(table.findEntry(key, false));
+    }
+
+    // Key 15 is now the least recently used
+    insert(table, 16, 16);
+    ASSERT_EQ(table.findEntry(15, false), nullptr);
+    for (int key = 0; key <= 16; key++) {
+        if (key != 15) {
+            int *entry = table.findEntry(key, false);
+            ASSERT_NE(entry, nullptr);
+            ASSERT_EQ(*entry, key);
+        }
+    }
+}
+
+/** An invalid entry is used before the LRU one. */
+TEST(CompactAssociativeSetTest, InvalidBeforeLRU)
+{
+    CompactAssociativeSet<int> table(4, 4, -1);
+    for (int key = 0; key < 4; key++) {
+        insert(table, key, key);
+    }
+    table.invalidate(table.findEntry(2, false));
+
+    insert(table, 4, 4);
+    ASSERT_NE(table.findEntry(0, false), nullptr);
+    ASSERT_NE(table.findEntry(1, false), nullptr);
+    ASSERT_NE(table.findEntry(3, false), nullptr);
+}
@@ -132,6 +132,9 @@ class IrregularStreamBuffer : public Queued
      * @result reference to the entry
      */
     AddressMapping& getPSMapping(Addr paddr, bool is_secure);
+
+    bool supportsTrainingThread() const override { return true; }
+
   public:
     IrregularStreamBuffer(const IrregularStreamBufferPrefetcherParams &p);
     ~IrregularStreamBuffer() = default;
@@ -176,6 +176,7 @@ class PIF : public Queued
         /** Array of probe listeners */
         std::vector<PrefetchListenerPC *> listenersPC;
 
+        bool supportsTrainingThread() const override { return true; }
 
     public:
         PIF(const PIFPrefetcherParams &p);
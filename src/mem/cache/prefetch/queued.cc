@@ -37,6 +37,7 @@
 
 #include "mem/cache/prefetch/queued.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "arch/generic/tlb.hh"
@@ -47,6 +48,7 @@
 #include "mem/cache/base.hh"
 #include "mem/request.hh"
 #include "params/QueuedPrefetcher.hh"
+#include "sim/cur_tick.hh"
 
 namespace gem5
 {
@@ -60,7 +62,7 @@ Queued::DeferredPacket::createPkt(Addr paddr, unsigned blk_size,
                                             bool tag_prefetch,
                                             Tick t) {
     /* Create a prefetch memory request */
-    RequestPtr req = std::make_shared<Request>(paddr, blk_size,
+    RequestPtr req = Request::make(paddr, blk_size,
                                                 0, requestor_id);
 
     if (pfInfo.isSecure()) {
@@ -97,6 +99,114 @@ Queued::DeferredPacket::finish(const Fault &fault,
     owner->translationComplete(this, failed);
 }
 
+Queued::iterator
+Queued::DeferredQueue::find(Addr addr, bool is_secure)
+{
+    auto range = addrIndex.equal_range(addr);
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (entry->second->pfInfo.isSecure() == is_secure)
+            return entry->second;
+    }
+    return packets.end();
+}
+
+Queued::iterator
+Queued::DeferredQueue::find(const DeferredPacket *dp)
+{
+    auto range = addrIndex.equal_range(dp->pfInfo.getAddr());
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (&*entry->second == dp)
+            return entry->second;
+    }
+    panic("Deferred packet not found in the prefetch queue\n");
+}
+
+Queued::iterator
+Queued::DeferredQueue::position(int32_t priority)
+{
+    // The level of the lowest priority that is not lower than the
+    // packet's is the last one the packet has to queue behind
+    auto level = levelEnd.lower_bound(priority);
+    return level == levelEnd.end() ? packets.begin() :
+        std::next(level->second);
+}
+
+void
+Queued::DeferredQueue::link(iterator it)
+{
+    addrIndex.emplace(it->pfInfo.getAddr(), it);
+    levelEnd[it->priority] = it;
+}
+
+void
+Queued::DeferredQueue::unlink(iterator it)
+{
+    auto range = addrIndex.equal_range(it->pfInfo.getAddr());
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (entry->second == it) {
+            addrIndex.erase(entry);
+            break;
+        }
+    }
+
+    auto level = levelEnd.find(it->priority);
+    assert(level != levelEnd.end());
+    if (level->second == it) {
+        if (it != packets.begin() && std::prev(it)->priority == it->priority)
+            level->second = std::prev(it);
+        else
+            levelEnd.erase(level);
+    }
+}
+
+Queued::iterator
+Queued::DeferredQueue::insert(const DeferredPacket &dp)
+{
+    iterator pos = position(dp.priority);
+    iterator it;
+    if (spare.empty()) {
+        it = packets.insert(pos, dp);
+    } else {
+        spare.front() = dp;
+        packets.splice(pos, spare, spare.begin());
+        it = std::prev(pos);
+    }
+    link(it);
+    return it;
+}
+
+Queued::iterator
+Queued::DeferredQueue::erase(iterator it)
+{
+    unlink(it);
+    iterator next = std::next(it);
+    // Don't keep the translation alive while the node is unused
+    it->translationRequest = nullptr;
+    spare.splice(spare.begin(), packets, it);
+    return next;
+}
+
+void
+Queued::DeferredQueue::raisePriority(iterator it, int32_t priority)
+{
+    assert(priority >= it->priority);
+    unlink(it);
+    it->priority = priority;
+    packets.splice(position(priority), packets, it);
+    link(it);
+}
+
+Queued::iterator
+Queued::DeferredQueue::lowestPriorityOldest()
+{
+    assert(!levelEnd.empty());
+    // Levels are contiguous, so the lowest level starts right after
+    // the end of the one above it
+    auto higher = std::next(levelEnd.begin());
+    return higher == levelEnd.end() ? packets.begin() :
+        std::next(higher->second);
+}
+
 Queued::Queued(const QueuedPrefetcherParams &p)
     : Base(p), queueSize(p.queue_size),
       missingTranslationQueueSize(
@@ -104,20 +214,153 @@ Queued::Queued(const QueuedPrefetcherParams &p)
       latency(p.latency), queueSquash(p.queue_squash),
       queueFilter(p.queue_filter), cacheSnoop(p.cache_snoop),
       tagPrefetch(p.tag_prefetch),
-      throttleControlPct(p.throttle_control_percentage), statsQueued(this)
+      throttleControlPct(p.throttle_control_percentage),
+      trainingDelay(p.training_delay), statsQueued(this), numTrained(0),
+      stopTraining(false),
+      trainingEvent([this]{ processTrainingEvent(); }, name())
 {
 }
 
 Queued::~Queued()
 {
+    stopTrainingThread();
+
     // Delete the queued prefetch packets
     for (DeferredPacket &p : pfq) {
         delete p.pkt;
     }
 }
 
+thread_local const Queued::TrainingEntry *Queued::curTrainingEntry = nullptr;
+
+void
+Queued::init()
+{
+    Base::init();
+
+    fatal_if(trainingDelay > 0 && !supportsTrainingThread(),
+             "%s cannot be trained on a helper thread, its training_delay "
+             "must be 0.", name());
+}
+
+DrainState
+Queued::drain()
+{
+    if (!trainingQueue.empty()) {
+        // The prefetches of the pending accesses are queued before the
+        // helper thread is stopped, see processTrainingEvent().
+        return DrainState::Draining;
+    }
+    stopTrainingThread();
+    return DrainState::Drained;
+}
+
+void
+Queued::stopTrainingThread()
+{
+    if (!trainingThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(trainingMutex);
+        stopTraining = true;
+    }
+    trainingCondition.notify_all();
+    trainingThread.join();
+    stopTraining = false;
+}
+
 void
-Queued::printQueue(const std::list<DeferredPacket> &queue) const
+Queued::trainingLoop()
+{
+    std::unique_lock<std::mutex> lock(trainingMutex);
+    while (true) {
+        trainingCondition.wait(lock, [this]{
+            return stopTraining || numTrained < trainingQueue.size();
+        });
+        if (stopTraining) {
+            return;
+        }
+
+        // Only the simulation thread adds and removes entries, and it
+        // removes them after they are trained on, so the entry can be used
+        // without holding the lock
+        TrainingEntry *entry = trainingQueue[numTrained].get();
+        lock.unlock();
+
+        // The tables of the prefetcher use curTick(), which must be the
+        // tick of the access as if it were trained on inline
+        Gem5Internal::_curTickPtr = &entry->tick;
+        curTrainingEntry = entry;
+        calculatePrefetch(entry->pfi, entry->addresses);
+        curTrainingEntry = nullptr;
+        Gem5Internal::_curTickPtr = nullptr;
+
+        lock.lock();
+        numTrained += 1;
+        trainingCondition.notify_all();
+    }
+}
+
+void
+Queued::waitForTraining()
+{
+    std::unique_lock<std::mutex> lock(trainingMutex);
+    trainingCondition.wait(lock, [this]{
+        return numTrained == trainingQueue.size();
+    });
+}
+
+uint64_t
+Queued::getIssuedPrefetches() const
+{
+    return curTrainingEntry ?
+        curTrainingEntry->issuedPrefetches : issuedPrefetches;
+}
+
+uint64_t
+Queued::getUsefulPrefetches() const
+{
+    return curTrainingEntry ?
+        curTrainingEntry->usefulPrefetches : usefulPrefetches;
+}
+
+void
+Queued::processTrainingEvent()
+{
+    while (!trainingQueue.empty() &&
+           trainingQueue.front()->readyTick <= curTick()) {
+        std::unique_ptr<TrainingEntry> entry;
+        {
+            std::unique_lock<std::mutex> lock(trainingMutex);
+            trainingCondition.wait(lock, [this]{ return numTrained > 0; });
+            entry = std::move(trainingQueue.front());
+            trainingQueue.pop_front();
+            numTrained -= 1;
+        }
+        queuePrefetches(entry->pfi, entry->req, entry->pktAddr,
+                        entry->pktSecure, entry->addresses);
+    }
+
+    if (!trainingQueue.empty()) {
+        schedule(trainingEvent, trainingQueue.front()->readyTick);
+    } else if (drainState() == DrainState::Draining) {
+        stopTrainingThread();
+        signalDrainDone();
+    }
+
+    // The cache only looks for prefetches after an access, so tell it
+    // about the new ones
+    Tick next_pf_time = nextPrefetchReadyTime();
+    if (next_pf_time != MaxTick) {
+        cache->schedMemSideSendEvent(
+            std::max(next_pf_time, cache->clockEdge()));
+    }
+}
+
+void
+Queued::printQueue(const DeferredQueue &queue) const
 {
     int pos = 0;
     std::string queue_name = "";
@@ -128,7 +371,7 @@ Queued::printQueue(const std::list<DeferredPacket> &queue) const
         queue_name = "PFTransQ";
     }
 
-    for (const_iterator it = queue.cbegin(); it != queue.cend();
+    for (const_iterator it = queue.begin(); it != queue.end();
                                                             it++, pos++) {
         Addr vaddr = it->pfInfo.getAddr();
         /* Set paddr to 0 if not yet translated */
@@ -176,27 +419,51 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
 
     // Squash queued prefetches if demand miss to same line
     if (queueSquash) {
-        auto itr = pfq.begin();
-        while (itr != pfq.end()) {
-            if (itr->pfInfo.getAddr() == blk_addr &&
-                itr->pfInfo.isSecure() == is_secure) {
-                DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
-                        "(cl: %#x), demand request going to the same addr\n",
-                        itr->pfInfo.getAddr(),
-                        blockAddress(itr->pfInfo.getAddr()));
-                delete itr->pkt;
-                itr = pfq.erase(itr);
-                statsQueued.pfRemovedDemand++;
-            } else {
-                ++itr;
-            }
+        iterator itr;
+        while ((itr = pfq.find(blk_addr, is_secure)) != pfq.end()) {
+            DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
+                    "(cl: %#x), demand request going to the same addr\n",
+                    itr->pfInfo.getAddr(),
+                    blockAddress(itr->pfInfo.getAddr()));
+            delete itr->pkt;
+            pfq.erase(itr);
+            statsQueued.pfRemovedDemand++;
         }
     }
 
-    // Calculate prefetches given this access
-    std::vector<AddrPriority> addresses;
-    calculatePrefetch(pfi, addresses);
+    if (trainingDelay == 0) {
+        // Calculate prefetches given this access
+        std::vector<AddrPriority> addresses;
+        calculatePrefetch(pfi, addresses);
+        queuePrefetches(pfi, pkt->req, pkt->getAddr(), pkt->isSecure(),
+                        addresses);
+        return;
+    }
+
+    // Train on the helper thread, and queue the prefetches after the
+    // training delay
+    if (!trainingThread.joinable()) {
+        trainingThread = std::thread(&Queued::trainingLoop, this);
+    }
+
+    Tick ready_tick = clockEdge(trainingDelay);
+    {
+        std::lock_guard<std::mutex> lock(trainingMutex);
+        trainingQueue.emplace_back(std::make_unique<TrainingEntry>(
+            pfi, pkt, ready_tick, issuedPrefetches, usefulPrefetches));
+    }
+    trainingCondition.notify_all();
+
+    if (!trainingEvent.scheduled()) {
+        schedule(trainingEvent, ready_tick);
+    }
+}
 
+void
+Queued::queuePrefetches(const PrefetchInfo &pfi, const RequestPtr &req,
+                        Addr pkt_addr, bool pkt_secure,
+                        std::vector<AddrPriority> &addresses)
+{
     // Get the maximu number of prefetches that we are allowed to generate
     size_t max_pfs = getMaxPermittedPrefetches(addresses.size());
 
@@ -210,7 +477,7 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
         if (!samePage(addr_prio.first, pfi.getAddr())) {
             statsQueued.pfSpanPage += 1;
 
-            if (hasBeenPrefetched(pkt->getAddr(), pkt->isSecure())) {
+            if (hasBeenPrefetched(pkt_addr, pkt_secure)) {
                 statsQueued.pfUsefulSpanPage += 1;
             }
         }
@@ -222,7 +489,7 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
             DPRINTF(HWPrefetch, "Found a pf candidate addr: %#x, "
                     "inserting into prefetch queue.\n", new_pfi.getAddr());
             // Create and insert the request
-            insert(pkt, new_pfi, addr_prio.second);
+            insert(req, new_pfi, addr_prio.second);
             num_pfs += 1;
             if (num_pfs == max_pfs) {
                 break;
@@ -300,14 +567,7 @@ Queued::processMissingTranslations(unsigned max)
 void
 Queued::translationComplete(DeferredPacket *dp, bool failed)
 {
-    auto it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end()) {
-        if (&(*it) == dp) {
-            break;
-        }
-        it++;
-    }
-    assert(it != pfqMissingTranslation.end());
+    auto it = pfqMissingTranslation.find(dp);
     if (!failed) {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x succeeded: "
                 "paddr %#x \n", mmu->name(),
@@ -335,30 +595,18 @@ Queued::translationComplete(DeferredPacket *dp, bool failed)
 }
 
 bool
-Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
+Queued::alreadyInQueue(DeferredQueue &queue,
                                  const PrefetchInfo &pfi, int32_t priority)
 {
-    bool found = false;
-    iterator it;
-    for (it = queue.begin(); it != queue.end() && !found; it++) {
-        found = it->pfInfo.sameAddr(pfi);
-    }
+    iterator it = queue.find(pfi.getAddr(), pfi.isSecure());
+    bool found = it != queue.end();
 
     /* If the address is already in the queue, update priority and leave */
-    if (it != queue.end()) {
+    if (found) {
         statsQueued.pfBufferHit++;
         if (it->priority < priority) {
             /* Update priority value and position in the queue */
-            it->priority = priority;
-            iterator prev = it;
-            while (prev != queue.begin()) {
-                prev--;
-                /* If the packet has higher priority, swap */
-                if (*it > *prev) {
-                    std::swap(*it, *prev);
-                    it = prev;
-                }
-            }
+            queue.raisePriority(it, priority);
             DPRINTF(HWPrefetch, "Prefetch addr already in "
                 "prefetch queue, priority updated\n");
         } else {
@@ -371,11 +619,11 @@ Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
 
 RequestPtr
 Queued::createPrefetchRequest(Addr addr, PrefetchInfo const &pfi,
-                                        PacketPtr pkt)
+                                        const RequestPtr &req)
 {
-    RequestPtr translation_req = std::make_shared<Request>(
-            addr, blkSize, pkt->req->getFlags(), requestorId, pfi.getPC(),
-            pkt->req->contextId());
+    RequestPtr translation_req = Request::make(
+            addr, blkSize, req->getFlags(), requestorId, pfi.getPC(),
+            req->contextId());
     translation_req->setFlags(Request::PREFETCH);
     return translation_req;
 }
@@ -383,6 +631,13 @@ Queued::createPrefetchRequest(Addr addr, PrefetchInfo const &pfi,
 void
 Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
                          int32_t priority)
+{
+    insert(pkt->req, new_pfi, priority);
+}
+
+void
+Queued::insert(const RequestPtr &req, PrefetchInfo &new_pfi,
+                         int32_t priority)
 {
     if (queueFilter) {
         if (alreadyInQueue(pfq, new_pfi, priority)) {
@@ -406,7 +661,7 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
      */
 
     Addr orig_addr = useVirtualAddresses ?
-        pkt->req->getVaddr() : pkt->req->getPaddr();
+        req->getVaddr() : req->getPaddr();
     bool positive_stride = new_pfi.getAddr() >= orig_addr;
     Addr stride = positive_stride ?
         (new_pfi.getAddr() - orig_addr) : (orig_addr - new_pfi.getAddr());
@@ -419,8 +674,8 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
             // if we trained with virtual addresses,
             // compute the target PA using the original PA and adding the
             // prefetch stride (difference between target VA and original VA)
-            target_paddr = positive_stride ? (pkt->req->getPaddr() + stride) :
-                (pkt->req->getPaddr() - stride);
+            target_paddr = positive_stride ? (req->getPaddr() + stride) :
+                (req->getPaddr() - stride);
         } else {
             target_paddr = new_pfi.getAddr();
         }
@@ -429,21 +684,21 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
         // Page crossing reference
 
         // ContextID is needed for translation
-        if (!pkt->req->hasContextId()) {
+        if (!req->hasContextId()) {
             return;
         }
         if (useVirtualAddresses) {
             has_target_pa = false;
             translation_req = createPrefetchRequest(new_pfi.getAddr(), new_pfi,
-                                                    pkt);
-        } else if (pkt->req->hasVaddr()) {
+                                                    req);
+        } else if (req->hasVaddr()) {
             has_target_pa = false;
             // Compute the target VA using req->getVaddr + stride
             Addr target_vaddr = positive_stride ?
-                (pkt->req->getVaddr() + stride) :
-                (pkt->req->getVaddr() - stride);
+                (req->getVaddr() + stride) :
+                (req->getVaddr() - stride);
             translation_req = createPrefetchRequest(target_vaddr, new_pfi,
-                                                    pkt);
+                                                    req);
         } else {
             // Using PA for training but the request does not have a VA,
             // unable to process this page crossing prefetch.
@@ -480,50 +735,24 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
 }
 
 void
-Queued::addToQueue(std::list<DeferredPacket> &queue,
-                             DeferredPacket &dpp)
+Queued::addToQueue(DeferredQueue &queue, DeferredPacket &dpp)
 {
     /* Verify prefetch buffer space for request */
     if (queue.size() == queueSize) {
         statsQueued.pfRemovedFull++;
-        /* Lowest priority packet */
-        iterator it = queue.end();
-        panic_if (it == queue.begin(),
+        panic_if (queue.empty(),
             "Prefetch queue is both full and empty!");
-        --it;
-        /* Look for oldest in that level of priority */
-        panic_if (it == queue.begin(),
+        panic_if (queue.size() == 1,
             "Prefetch queue is full with 1 element!");
-        iterator prev = it;
-        bool cont = true;
-        /* While not at the head of the queue */
-        while (cont && prev != queue.begin()) {
-            prev--;
-            /* While at the same level of priority */
-            cont = prev->priority == it->priority;
-            if (cont)
-                /* update pointer */
-                it = prev;
-        }
+        /* Oldest packet of the lowest priority */
+        iterator it = queue.lowestPriorityOldest();
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
                             "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
         delete it->pkt;
         queue.erase(it);
     }
 
-    if ((queue.size() == 0) || (dpp <= queue.back())) {
-        queue.emplace_back(dpp);
-    } else {
-        iterator it = queue.end();
-        do {
-            --it;
-        } while (it != queue.begin() && dpp > *it);
-        /* If we reach the head, we have to see if the new element is new head
-         * or not */
-        if (it == queue.begin() && dpp <= *it)
-            it++;
-        queue.insert(it, dpp);
-    }
+    queue.insert(dpp);
 
     if (debug::HWPrefetchQueue)
         printQueue(queue);
@@ -38,15 +38,26 @@
 #ifndef __MEM_CACHE_PREFETCH_QUEUED_HH__
 #define __MEM_CACHE_PREFETCH_QUEUED_HH__
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/prefetch/base.hh"
 #include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/drain.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -139,12 +150,90 @@ class Queued : public Base
         void startTranslation(BaseMMU *mmu);
     };
 
-    std::list<DeferredPacket> pfq;
-    std::list<DeferredPacket> pfqMissingTranslation;
-
     using const_iterator = std::list<DeferredPacket>::const_iterator;
     using iterator = std::list<DeferredPacket>::iterator;
 
+    /**
+     * A queue of deferred packets ordered by decreasing priority, and
+     * from oldest to youngest within a priority level.
+     *
+     * Packets are indexed by address so that duplicates are found
+     * without scanning the queue, and the last packet of each
+     * priority level is tracked so that insertions don't scan it
+     * either. The list nodes of removed packets are kept for reuse.
+     */
+    class DeferredQueue
+    {
+      public:
+        bool empty() const { return packets.empty(); }
+        size_t size() const { return packets.size(); }
+
+        iterator begin() { return packets.begin(); }
+        iterator end() { return packets.end(); }
+        const_iterator begin() const { return packets.begin(); }
+        const_iterator end() const { return packets.end(); }
+
+        DeferredPacket &front() { return packets.front(); }
+        const DeferredPacket &front() const { return packets.front(); }
+
+        /**
+         * Find a queued packet for the given address.
+         * @param addr address of the prefetch
+         * @param is_secure whether the prefetch is to the secure space
+         * @return The packet, or end() if there is none.
+         */
+        iterator find(Addr addr, bool is_secure);
+
+        /**
+         * Find the iterator of a packet in this queue.
+         * @param dp packet to look for, must be in the queue
+         */
+        iterator find(const DeferredPacket *dp);
+
+        /**
+         * Queue a copy of a packet behind all queued packets of the
+         * same or a higher priority.
+         */
+        iterator insert(const DeferredPacket &dp);
+
+        /**
+         * Remove a packet from the queue.
+         * @return The packet that followed the removed one.
+         */
+        iterator erase(iterator it);
+
+        void pop_front() { erase(packets.begin()); }
+
+        /**
+         * Raise the priority of a queued packet, moving it ahead of
+         * all packets of a lower priority.
+         */
+        void raisePriority(iterator it, int32_t priority);
+
+        /** The oldest packet of the lowest priority level. */
+        iterator lowestPriorityOldest();
+
+      private:
+        /** Where a packet of the given priority has to be queued */
+        iterator position(int32_t priority);
+        /** Add a packet placed in the queue to the bookkeeping */
+        void link(iterator it);
+        /** Remove a packet from the bookkeeping */
+        void unlink(iterator it);
+
+        /** Queued packets */
+        std::list<DeferredPacket> packets;
+        /** List nodes of removed packets, for reuse */
+        std::list<DeferredPacket> spare;
+        /** Queued packets by prefetch address */
+        std::unordered_multimap<Addr, iterator> addrIndex;
+        /** Last packet of each priority level in the queue */
+        std::map<int32_t, iterator> levelEnd;
+    };
+
+    DeferredQueue pfq;
+    DeferredQueue pfqMissingTranslation;
+
     // PARAMETERS
 
     /** Maximum size of the prefetch queue */
@@ -174,6 +263,12 @@ class Queued : public Base
     /** Percentage of requests that can be throttled */
     const unsigned int throttleControlPct;
 
+    /**
+     * Cycles after an access when the prefetches it generates are queued.
+     * If non-zero, the prefetcher is trained on a helper thread.
+     */
+    const Cycles trainingDelay;
+
     struct QueuedStats : public statistics::Group
     {
         QueuedStats(statistics::Group *parent);
@@ -186,15 +281,52 @@ class Queued : public Base
         statistics::Scalar pfSpanPage;
         statistics::Scalar pfUsefulSpanPage;
     } statsQueued;
+
+    /**
+     * Whether calculatePrefetch() can run on the helper thread. That is the
+     * case if it only uses the state of the prefetcher itself, and any
+     * other function that uses that state calls waitForTraining() first.
+     * The accuracy counters must be read with getIssuedPrefetches() and
+     * getUsefulPrefetches().
+     *
+     * @return True if the prefetcher supports a non-zero training delay.
+     */
+    virtual bool supportsTrainingThread() const { return false; }
+
+    /**
+     * Wait until the helper thread has trained the prefetcher on every
+     * access notified so far, so that its state can be used safely, and
+     * is the same as if it were trained inline.
+     */
+    void waitForTraining();
+
+    /**
+     * Get the number of issued prefetches as of the access being trained
+     * on.
+     */
+    uint64_t getIssuedPrefetches() const;
+
+    /**
+     * Get the number of useful prefetches as of the access being trained
+     * on.
+     */
+    uint64_t getUsefulPrefetches() const;
+
   public:
     using AddrPriority = std::pair<Addr, int32_t>;
 
     Queued(const QueuedPrefetcherParams &p);
     virtual ~Queued();
 
+    void init() override;
+
+    DrainState drain() override;
+
     void notify(const PacketPtr &pkt, const PrefetchInfo &pfi) override;
 
     void insert(const PacketPtr &pkt, PrefetchInfo &new_pfi, int32_t priority);
+    void insert(const RequestPtr &req, PrefetchInfo &new_pfi,
+                int32_t priority);
 
     virtual void calculatePrefetch(const PrefetchInfo &pfi,
                                    std::vector<AddrPriority> &addresses) = 0;
@@ -205,16 +337,101 @@ class Queued : public Base
         return pfq.empty() ? MaxTick : pfq.front().tick;
     }
 
-    void printQueue(const std::list<DeferredPacket> &queue) const;
+    void printQueue(const DeferredQueue &queue) const;
 
   private:
+    /** An access waiting for, or being used in, the training. */
+    struct TrainingEntry
+    {
+        /** The information of the access, without its data. */
+        const PrefetchInfo pfi;
+
+        /** The request of the access, used to queue the prefetches. */
+        const RequestPtr req;
+
+        /** The address of the packet of the access. */
+        const Addr pktAddr;
+
+        /** Whether the packet of the access is secure. */
+        const bool pktSecure;
+
+        /** The tick of the access, which is curTick() while training. */
+        Tick tick;
+
+        /** The tick when the prefetches of the access are queued. */
+        const Tick readyTick;
+
+        /** The accuracy counters as of the access. */
+        const uint64_t issuedPrefetches;
+        const uint64_t usefulPrefetches;
+
+        /** The prefetch candidates generated by the training. */
+        std::vector<AddrPriority> addresses;
+
+        TrainingEntry(const PrefetchInfo &pfi, const PacketPtr &pkt,
+                      Tick ready_tick, uint64_t issued, uint64_t useful)
+          : pfi(pfi, pfi.getAddr()), req(pkt->req), pktAddr(pkt->getAddr()),
+            pktSecure(pkt->isSecure()), tick(curTick()),
+            readyTick(ready_tick), issuedPrefetches(issued),
+            usefulPrefetches(useful)
+        {}
+    };
+
+    /**
+     * The accesses notified and not queued yet, in order. The first
+     * numTrained entries have been trained on by the helper thread.
+     */
+    std::deque<std::unique_ptr<TrainingEntry>> trainingQueue;
+    std::size_t numTrained;
+
+    /** The entry the helper thread of this host thread trains on. */
+    static thread_local const TrainingEntry *curTrainingEntry;
+
+    /** Protects the training queue, numTrained and stopTraining. */
+    std::mutex trainingMutex;
+    std::condition_variable trainingCondition;
+
+    /** Tells the helper thread to exit. */
+    bool stopTraining;
+
+    /**
+     * The helper thread. It is started on the first access, and stopped
+     * when draining, so that it is not running across a checkpoint or a
+     * fork.
+     */
+    std::thread trainingThread;
+
+    /** Queues the prefetches of the trained accesses when they are ready. */
+    EventFunctionWrapper trainingEvent;
+
+    /** Train on the queued accesses, in order, until stopped. */
+    void trainingLoop();
+
+    /** Stop the helper thread, if it is running. */
+    void stopTrainingThread();
+
+    /** Queue the prefetches of the accesses that are ready. */
+    void processTrainingEvent();
+
+    /**
+     * Turn the prefetch candidates of an access into queued prefetches.
+     *
+     * @param pfi The information of the access.
+     * @param req The request of the access.
+     * @param pkt_addr The address of the packet of the access.
+     * @param pkt_secure Whether the packet of the access is secure.
+     * @param addresses The candidates generated by the prefetcher.
+     */
+    void queuePrefetches(const PrefetchInfo &pfi, const RequestPtr &req,
+                         Addr pkt_addr, bool pkt_secure,
+                         std::vector<AddrPriority> &addresses);
 
     /**
      * Adds a DeferredPacket to the specified queue
      * @param queue selected queue to use
      * @param dpp DeferredPacket to add
      */
-    void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
+    void addToQueue(DeferredQueue &queue, DeferredPacket &dpp);
 
     /**
      * Starts the translations of the queued prefetches with a
@@ -242,7 +459,7 @@ class Queued : public Base
      * @param priority priority of the prefetch request to be added
      * @return True if the prefetch request was found in the queue
      */
-    bool alreadyInQueue(std::list<DeferredPacket> &queue,
+    bool alreadyInQueue(DeferredQueue &queue,
                         const PrefetchInfo &pfi, int32_t priority);
 
     /**
@@ -256,7 +473,7 @@ class Queued : public Base
     size_t getMaxPermittedPrefetches(size_t total) const;
 
     RequestPtr createPrefetchRequest(Addr addr, PrefetchInfo const &pfi,
-                                        PacketPtr pkt);
+                                        const RequestPtr &req);
 };
 
 } // namespace prefetch
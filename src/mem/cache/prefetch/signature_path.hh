@@ -282,6 +282,8 @@ class SignaturePath : public Queued
             stride_t last_offset, stride_t delta, double path_confidence) {
     }
 
+    bool supportsTrainingThread() const override { return true; }
+
   public:
     SignaturePath(const SignaturePathPrefetcherParams &p);
     ~SignaturePath() = default;
@@ -83,7 +83,7 @@ SignaturePathV2::calculateLookaheadConfidence(
         PatternEntry const &sig, PatternStrideEntry const &lookahead) const
 {
     if (sig.counter == 0) return 0.0;
-    return (((double) usefulPrefetches) / issuedPrefetches) *
+    return (((double) getUsefulPrefetches()) / getIssuedPrefetches()) *
             (((double) lookahead.counter) / sig.counter);
 }
 
@@ -46,8 +46,11 @@
 #define __MEM_CACHE_QUEUE_HH__
 
 #include <cassert>
+#include <algorithm>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/named.hh"
@@ -101,6 +104,32 @@ class Queue : public Drainable, public Named
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /**
+     * Allocated entries indexed by block address. Each bucket holds
+     * its entries in allocation order, i.e., the order in which they
+     * appear in the allocatedList.
+     */
+    std::unordered_map<Addr, std::vector<Entry *>> blockIndex;
+
+    /**
+     * Add a newly allocated entry to the block index. Must be called
+     * after the entry's block address is set.
+     */
+    void addToBlockIndex(Entry *entry)
+    {
+        blockIndex[entry->blkAddr].push_back(entry);
+    }
+
+    void removeFromBlockIndex(Entry *entry)
+    {
+        auto it = blockIndex.find(entry->blkAddr);
+        assert(it != blockIndex.end());
+        auto &bucket = it->second;
+        bucket.erase(std::find(bucket.begin(), bucket.end(), entry));
+        if (bucket.empty())
+            blockIndex.erase(it);
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -140,6 +169,7 @@ class Queue : public Drainable, public Named
         for (int i = 0; i < numEntries; ++i) {
             freeList.push_back(&entries[i]);
         }
+        blockIndex.reserve(numEntries);
     }
 
     bool isEmpty() const
@@ -168,7 +198,11 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        auto bucket = blockIndex.find(blk_addr);
+        if (bucket == blockIndex.end())
+            return nullptr;
+
+        for (const auto& entry : bucket->second) {
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -206,12 +240,29 @@ class Queue : public Drainable, public Named
      */
     Entry* findPending(const QueueEntry* entry) const
     {
-        for (const auto& ready_entry : readyList) {
-            if (ready_entry->conflictAddr(entry)) {
-                return ready_entry;
+        // Conflicting entries always share the block address, so only
+        // the entries of that block need to be considered.
+        auto bucket = blockIndex.find(entry->blkAddr);
+        if (bucket == blockIndex.end())
+            return nullptr;
+
+        Entry *pending = nullptr;
+        for (const auto& candidate : bucket->second) {
+            if (candidate->inService || !candidate->conflictAddr(entry))
+                continue;
+
+            if (pending) {
+                // Several candidates, the ready list decides which
+                // one is the earliest
+                for (const auto& ready_entry : readyList) {
+                    if (ready_entry->conflictAddr(entry)) {
+                        return ready_entry;
+                    }
+                }
             }
+            pending = candidate;
         }
-        return nullptr;
+        return pending;
     }
 
     /**
@@ -241,6 +292,7 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        removeFromBlockIndex(entry);
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
@@ -54,6 +54,7 @@
 
 #include "base/sat_counter.hh"
 #include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/repl_data_pool.hh"
 
 namespace gem5
 {
@@ -111,6 +112,13 @@ class BRRIP : public Base
      */
     const unsigned btp;
 
+  private:
+    /**
+     * Packs the replacement data of the entries, so that the RRPVs of the
+     * ways of a set are contiguous.
+     */
+    ReplDataPool<BRRIPReplData> pool;
+
   public:
     typedef BRRIPRPParams Params;
     BRRIP(const Params &p);
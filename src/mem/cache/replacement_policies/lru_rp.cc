@@ -29,6 +29,7 @@
 #include "mem/cache/replacement_policies/lru_rp.hh"
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 
 #include "params/LRURP.hh"
@@ -49,24 +50,24 @@ void
 LRU::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
     // Reset last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = Tick(0);
+    static_cast<LRUReplData*>(
+        replacement_data.get())->lastTouchTick = Tick(0);
 }
 
 void
 LRU::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
     // Update last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = curTick();
+    static_cast<LRUReplData*>(
+        replacement_data.get())->lastTouchTick = curTick();
 }
 
 void
 LRU::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
     // Set last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = curTick();
+    static_cast<LRUReplData*>(
+        replacement_data.get())->lastTouchTick = curTick();
 }
 
 ReplaceableEntry*
@@ -75,25 +76,27 @@ LRU::getVictim(const ReplacementCandidates& candidates) const
     // There must be at least one replacement candidate
     assert(candidates.size() > 0);
 
-    // Visit all candidates to find victim
-    ReplaceableEntry* victim = candidates[0];
-    for (const auto& candidate : candidates) {
-        // Update victim entry if necessary
-        if (std::static_pointer_cast<LRUReplData>(
-                    candidate->replacementData)->lastTouchTick <
-                std::static_pointer_cast<LRUReplData>(
-                    victim->replacementData)->lastTouchTick) {
-            victim = candidate;
-        }
+    // Visit all candidates to find victim. The casts are plain pointer
+    // casts, so that no reference counts are touched in the loop, and the
+    // conditional moves keep it free of unpredictable branches
+    std::size_t victim = 0;
+    Tick victim_tick = static_cast<const LRUReplData*>(
+        candidates[0]->replacementData.get())->lastTouchTick;
+    for (std::size_t i = 1; i < candidates.size(); i++) {
+        const Tick tick = static_cast<const LRUReplData*>(
+            candidates[i]->replacementData.get())->lastTouchTick;
+        const bool older = tick < victim_tick;
+        victim = older ? i : victim;
+        victim_tick = older ? tick : victim_tick;
     }
 
-    return victim;
+    return candidates[victim];
 }
 
 std::shared_ptr<ReplacementData>
 LRU::instantiateEntry()
 {
-    return std::shared_ptr<ReplacementData>(new LRUReplData());
+    return pool.allocate();
 }
 
 } // namespace replacement_policy
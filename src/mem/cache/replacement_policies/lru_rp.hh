@@ -36,6 +36,7 @@
 #define __MEM_CACHE_REPLACEMENT_POLICIES_LRU_RP_HH__
 
 #include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/repl_data_pool.hh"
 
 namespace gem5
 {
@@ -60,6 +61,12 @@ class LRU : public Base
         LRUReplData() : lastTouchTick(0) {}
     };
 
+    /**
+     * Packs the replacement data of the entries, so that the timestamps of
+     * the ways of a set are contiguous.
+     */
+    ReplDataPool<LRUReplData> pool;
+
   public:
     typedef LRURPParams Params;
     LRU(const Params &p);
@@ -93,7 +100,8 @@ class LRU : public Base
                                                                      override;
 
     /**
-     * Find replacement victim using LRU timestamps.
+     * Find replacement victim using LRU timestamps. The timestamps are
+     * compared in a single branch-free pass over the candidates.
      *
      * @param candidates Replacement candidates, selected by indexing policy.
      * @return Replacement entry to be replaced.
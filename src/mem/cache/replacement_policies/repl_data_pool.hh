@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a pool that allocates the replacement data of a policy
+ * from contiguous chunks.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_REPL_DATA_POOL_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_REPL_DATA_POOL_HH__
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+/**
+ * Allocates replacement data from chunks of contiguous entries instead of
+ * one heap allocation (and one shared_ptr control block) per entry. The
+ * returned pointers share the ownership of their chunk, so a chunk lives
+ * as long as any of its entries, even after the pool is destroyed.
+ *
+ * The tags instantiate the replacement data of a set consecutively, so the
+ * data of the ways of a set ends up packed next to each other, and victim
+ * selection walks a single small block of memory.
+ *
+ * @tparam T The type of the entries.
+ */
+template <typename T>
+class ReplDataPool
+{
+    static_assert(!std::is_same<T, bool>::value,
+                  "std::vector<bool> does not store addressable entries");
+
+  private:
+    /** A chunk of entries. Its capacity is reserved on creation. */
+    struct Chunk
+    {
+        std::vector<T> entries;
+    };
+
+    /** The chunk the next entries are allocated from. */
+    std::shared_ptr<Chunk> chunk;
+
+    /** The capacity of the next chunk to be created. */
+    std::size_t nextChunkSize;
+
+    /** The capacity the chunks grow up to. */
+    const std::size_t maxChunkSize;
+
+    /**
+     * Make sure the current chunk has room for count more entries, creating
+     * a new one otherwise. The chunks double in size, so that small
+     * structures do not waste much memory, and large ones are not split in
+     * many chunks.
+     *
+     * @param count The number of entries to make room for.
+     */
+    void
+    reserve(std::size_t count)
+    {
+        if (chunk &&
+            chunk->entries.size() + count <= chunk->entries.capacity()) {
+            return;
+        }
+
+        chunk = std::make_shared<Chunk>();
+        chunk->entries.reserve(std::max(count, nextChunkSize));
+        nextChunkSize = std::min(2 * nextChunkSize, maxChunkSize);
+    }
+
+  public:
+    /**
+     * @param min_chunk_size The capacity of the first chunk.
+     * @param max_chunk_size The capacity the chunks grow up to.
+     */
+    ReplDataPool(std::size_t min_chunk_size = 64,
+                 std::size_t max_chunk_size = 4096)
+      : nextChunkSize(std::max<std::size_t>(min_chunk_size, 1)),
+        maxChunkSize(std::max(max_chunk_size, nextChunkSize))
+    {
+    }
+
+    /**
+     * Allocate a single entry.
+     *
+     * @param args The arguments of the entry's constructor.
+     * @return A pointer to the new entry.
+     */
+    template <typename... Args>
+    std::shared_ptr<T>
+    allocate(Args&&... args)
+    {
+        reserve(1);
+        chunk->entries.emplace_back(std::forward<Args>(args)...);
+        return std::shared_ptr<T>(chunk, &chunk->entries.back());
+    }
+
+    /**
+     * Allocate count contiguous entries, all copies of value.
+     *
+     * @param count The number of entries.
+     * @param value The value of the entries.
+     * @return A pointer to the first entry.
+     */
+    std::shared_ptr<T>
+    allocateArray(std::size_t count, const T &value)
+    {
+        reserve(count);
+        const std::size_t first = chunk->entries.size();
+        chunk->entries.insert(chunk->entries.end(), count, value);
+        return std::shared_ptr<T>(chunk, chunk->entries.data() + first);
+    }
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_REPL_DATA_POOL_HH__
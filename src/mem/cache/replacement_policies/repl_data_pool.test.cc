@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "mem/cache/replacement_policies/repl_data_pool.hh"
+
+using namespace gem5;
+using namespace gem5::replacement_policy;
+
+/** Consecutive entries are allocated next to each other. */
+TEST(ReplDataPoolTest, ContiguousAllocation)
+{
+    ReplDataPool<uint64_t> pool(4, 4);
+    std::shared_ptr<uint64_t> first = pool.allocate(1);
+    std::shared_ptr<uint64_t> second = pool.allocate(2);
+    std::shared_ptr<uint64_t> third = pool.allocate(3);
+
+    ASSERT_EQ(first.get() + 1, second.get());
+    ASSERT_EQ(second.get() + 1, third.get());
+    ASSERT_EQ(*first, 1);
+    ASSERT_EQ(*second, 2);
+    ASSERT_EQ(*third, 3);
+}
+
+/** A full chunk does not move the entries already allocated from it. */
+TEST(ReplDataPoolTest, FullChunk)
+{
+    ReplDataPool<uint64_t> pool(2, 2);
+    std::shared_ptr<uint64_t> first = pool.allocate(1);
+    uint64_t* const first_ptr = first.get();
+    pool.allocate(2);
+    std::shared_ptr<uint64_t> third = pool.allocate(3);
+
+    ASSERT_EQ(first.get(), first_ptr);
+    ASSERT_EQ(*first, 1);
+    ASSERT_EQ(*third, 3);
+}
+
+/** An array is never split across chunks. */
+TEST(ReplDataPoolTest, ArrayAllocation)
+{
+    ReplDataPool<uint64_t> pool(4, 4);
+    pool.allocate(0);
+    pool.allocate(0);
+    std::shared_ptr<uint64_t> array = pool.allocateArray(3, 7);
+    for (int i = 0; i < 3; i++) {
+        array.get()[i] = i;
+    }
+
+    // An array larger than the chunks gets a chunk of its own
+    std::shared_ptr<uint64_t> large = pool.allocateArray(8, 5);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(large.get()[i], 5);
+    }
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(array.get()[i], i);
+    }
+}
+
+/** The entries keep their chunk alive after the pool is destroyed. */
+TEST(ReplDataPoolTest, EntriesOutliveThePool)
+{
+    std::shared_ptr<uint64_t> entry;
+    {
+        ReplDataPool<uint64_t> pool;
+        entry = pool.allocate(42);
+    }
+    ASSERT_EQ(*entry, 42);
+}
+
+/** The entries share the ownership of their chunk. */
+TEST(ReplDataPoolTest, SharedOwnership)
+{
+    std::weak_ptr<uint64_t> weak;
+    std::shared_ptr<uint64_t> other;
+    {
+        ReplDataPool<uint64_t> pool;
+        std::shared_ptr<uint64_t> entry = pool.allocate(1);
+        other = pool.allocate(2);
+        weak = entry;
+    }
+    ASSERT_FALSE(weak.expired());
+    other.reset();
+    ASSERT_TRUE(weak.expired());
+}
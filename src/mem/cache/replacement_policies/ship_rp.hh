@@ -42,6 +42,7 @@
 #include "base/compiler.hh"
 #include "base/sat_counter.hh"
 #include "mem/cache/replacement_policies/brrip_rp.hh"
+#include "mem/cache/replacement_policies/repl_data_pool.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -106,6 +107,12 @@ class SHiP : public BRRIP
      */
     std::vector<SatCounter8> SHCT;
 
+    /**
+     * Packs the replacement data of the entries, so that the data of the
+     * ways of a set is contiguous.
+     */
+    ReplDataPool<SHiPReplData> pool;
+
     /**
      * Extract signature from packet.
      *
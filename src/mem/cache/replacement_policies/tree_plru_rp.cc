@@ -36,6 +36,7 @@
 
 #include <cmath>
 
+#include "base/bitfield.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "params/TreePLRURP.hh"
@@ -95,14 +96,41 @@ isRightSubtree(const uint64_t index)
     return index%2 == 0;
 }
 
+/**
+ * Get the bit of the given indexed tree node.
+ *
+ * @param tree The words of the tree.
+ * @param index The index of the tree node.
+ * @return The value of the node.
+ */
+static bool
+getNode(const uint64_t* tree, const uint64_t index)
+{
+    return bits(tree[index / 64], index % 64);
+}
+
+/**
+ * Set the bit of the given indexed tree node.
+ *
+ * @param tree The words of the tree.
+ * @param index The index of the tree node.
+ * @param value The new value of the node.
+ */
+static void
+setNode(uint64_t* tree, const uint64_t index, const bool value)
+{
+    replaceBits(tree[index / 64], index % 64, value);
+}
+
 TreePLRU::TreePLRUReplData::TreePLRUReplData(
-    const uint64_t index, std::shared_ptr<PLRUTree> tree)
+    const uint64_t index, std::shared_ptr<PLRUTreeWord> tree)
   : index(index), tree(tree)
 {
 }
 
 TreePLRU::TreePLRU(const Params &p)
-  : Base(p), numLeaves(p.num_leaves), count(0), treeInstance(nullptr)
+  : Base(p), numLeaves(p.num_leaves), numTreeWords(divCeil(numLeaves, 64)),
+    count(0), treeInstance(nullptr)
 {
     fatal_if(!isPowerOf2(numLeaves),
              "Number of leaves must be non-zero and a power of 2");
@@ -112,9 +140,9 @@ void
 TreePLRU::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
     // Cast replacement data
-    std::shared_ptr<TreePLRUReplData> treePLRU_replacement_data =
-        std::static_pointer_cast<TreePLRUReplData>(replacement_data);
-    PLRUTree* tree = treePLRU_replacement_data->tree.get();
+    const TreePLRUReplData* treePLRU_replacement_data =
+        static_cast<TreePLRUReplData*>(replacement_data.get());
+    PLRUTreeWord* tree = treePLRU_replacement_data->tree.get();
 
     // Index of the tree entry we are currently checking
     // Make this entry the new LRU entry
@@ -129,7 +157,7 @@ TreePLRU::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
         tree_index = parentIndex(tree_index);
 
         // Update parent node to make it point to the node we just came from
-        tree->at(tree_index) = right;
+        setNode(tree, tree_index, right);
     } while (tree_index != 0);
 }
 
@@ -138,9 +166,9 @@ TreePLRU::touch(const std::shared_ptr<ReplacementData>& replacement_data)
 const
 {
     // Cast replacement data
-    std::shared_ptr<TreePLRUReplData> treePLRU_replacement_data =
-        std::static_pointer_cast<TreePLRUReplData>(replacement_data);
-    PLRUTree* tree = treePLRU_replacement_data->tree.get();
+    const TreePLRUReplData* treePLRU_replacement_data =
+        static_cast<TreePLRUReplData*>(replacement_data.get());
+    PLRUTreeWord* tree = treePLRU_replacement_data->tree.get();
 
     // Index of the tree entry we are currently checking
     // Make this entry the MRU entry
@@ -155,7 +183,7 @@ const
         tree_index = parentIndex(tree_index);
 
         // Update node to not point to the touched leaf
-        tree->at(tree_index) = !right;
+        setNode(tree, tree_index, !right);
     } while (tree_index != 0);
 }
 
@@ -174,16 +202,16 @@ TreePLRU::getVictim(const ReplacementCandidates& candidates) const
     assert(candidates.size() > 0);
 
     // Get tree
-    const PLRUTree* tree = std::static_pointer_cast<TreePLRUReplData>(
-            candidates[0]->replacementData)->tree.get();
+    const PLRUTreeWord* tree = static_cast<TreePLRUReplData*>(
+            candidates[0]->replacementData.get())->tree.get();
 
     // Index of the tree entry we are currently checking. Start with root.
     uint64_t tree_index = 0;
 
     // Parse tree
-    while (tree_index < tree->size()) {
+    while (tree_index < numLeaves - 1) {
         // Go to the next tree entry
-        if (tree->at(tree_index)) {
+        if (getNode(tree, tree_index)) {
             tree_index = rightSubtreeIndex(tree_index);
         } else {
             tree_index = leftSubtreeIndex(tree_index);
@@ -200,18 +228,17 @@ TreePLRU::instantiateEntry()
 {
     // Generate a tree instance every numLeaves created
     if (count % numLeaves == 0) {
-        treeInstance = new PLRUTree(numLeaves - 1, false);
+        treeInstance = treePool.allocateArray(numTreeWords, 0);
     }
 
     // Create replacement data using current tree instance
-    TreePLRUReplData* treePLRUReplData = new TreePLRUReplData(
-        (count % numLeaves) + numLeaves - 1,
-        std::shared_ptr<PLRUTree>(treeInstance));
+    std::shared_ptr<TreePLRUReplData> treePLRUReplData = pool.allocate(
+        (count % numLeaves) + numLeaves - 1, treeInstance);
 
     // Update instance counter
     count++;
 
-    return std::shared_ptr<ReplacementData>(treePLRUReplData);
+    return treePLRUReplData;
 }
 
 } // namespace replacement_policy
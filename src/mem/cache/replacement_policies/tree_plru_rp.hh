@@ -64,6 +64,10 @@
  * Consecutive calls to instantiateEntry() use the same tree up to numLeaves.
  * When numLeaves replacement datas have been created, a new tree is generated,
  * and the counter is reset.
+ *
+ * The bits of a tree are packed in 64-bit words, so the tree of a set of up
+ * to 64 ways takes a single word, and the trees and replacement data are
+ * allocated from contiguous pools rather than one heap object each.
  */
 
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_TREE_PLRU_RP_HH__
@@ -71,9 +75,9 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/repl_data_pool.hh"
 
 namespace gem5
 {
@@ -104,14 +108,22 @@ class TreePLRU : public Base
      *
      * Notice that the replacement data entries are not represented in the tree
      * to avoid unnecessary storage costs.
+     *
+     * The bits are packed in words, bit i of the tree being bit (i % 64) of
+     * its (i / 64)-th word, so a tree is an array of numTreeWords words.
      */
-    typedef std::vector<bool> PLRUTree;
+    typedef uint64_t PLRUTreeWord;
 
     /**
      * Number of leaves that share a single replacement data.
      */
     const uint64_t numLeaves;
 
+    /**
+     * Number of words holding the numLeaves - 1 bits of a tree.
+     */
+    const uint64_t numTreeWords;
+
     /**
      * Count of the number of sharers of a replacement data. It is used when
      * instantiating entries to share a replacement data among many replaceable
@@ -120,9 +132,14 @@ class TreePLRU : public Base
     uint64_t count;
 
     /**
-     * Holds the latest temporary tree instance created by instantiateEntry().
+     * Holds the latest tree instance created by instantiateEntry().
+     */
+    std::shared_ptr<PLRUTreeWord> treeInstance;
+
+    /**
+     * Packs the trees of consecutive sets next to each other.
      */
-    PLRUTree* treeInstance;
+    ReplDataPool<PLRUTreeWord> treePool;
 
   protected:
     /**
@@ -143,7 +160,7 @@ class TreePLRU : public Base
          * that accesses to a replacement data entry updates the PLRU bits of
          * all other replacement data entries in its set.
          */
-        std::shared_ptr<PLRUTree> tree;
+        std::shared_ptr<PLRUTreeWord> tree;
 
         /**
          * Default constructor. Invalidate data.
@@ -151,9 +168,17 @@ class TreePLRU : public Base
          * @param index Index of the corresponding entry in the tree.
          * @param tree The shared tree pointer.
          */
-        TreePLRUReplData(const uint64_t index, std::shared_ptr<PLRUTree> tree);
+        TreePLRUReplData(const uint64_t index,
+                         std::shared_ptr<PLRUTreeWord> tree);
     };
 
+  private:
+    /**
+     * Packs the replacement data of the entries, so that the data of the
+     * ways of a set is contiguous.
+     */
+    ReplDataPool<TreePLRUReplData> pool;
+
   public:
     typedef TreePLRURPParams Params;
     TreePLRU(const Params &p);
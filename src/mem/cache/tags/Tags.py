@@ -44,6 +44,7 @@ class BaseTags(ClockedObject):
     abstract = True
     cxx_header = "mem/cache/tags/base.hh"
     cxx_class = "gem5::BaseTags"
+    thread_safe_init = True
 
     # Get system to which it belongs
     system = Param.System(Parent.any, "System we belong to")
@@ -65,6 +66,11 @@ class BaseTags(ClockedObject):
         "Percentage of tags to be touched to warm up the cache",
     )
 
+    # Get whether the data is stored from the parent (cache)
+    store_data = Param.Bool(
+        Parent.store_data, "Whether to allocate storage for the data"
+    )
+
     sequential_access = Param.Bool(
         Parent.sequential_access,
         "Whether to access tags and data sequentially",
@@ -80,11 +86,18 @@ class BaseTags(ClockedObject):
         Parent.cache_line_size, "Indexing entry size in bytes"
     )
 
+    # A counting filter (num_bits > 1) lets lookups skip the search of the
+    # blocks that are definitely not in the cache
+    miss_filter = Param.BloomFilterBase(
+        NULL, "Bloom filter of the addresses of the valid blocks"
+    )
+
 
 class BaseSetAssoc(BaseTags):
     type = "BaseSetAssoc"
     cxx_header = "mem/cache/tags/base_set_assoc.hh"
     cxx_class = "gem5::BaseSetAssoc"
+    thread_safe_init = True
 
     # Get the cache associativity
     assoc = Param.Int(Parent.assoc, "associativity")
@@ -95,10 +108,18 @@ class BaseSetAssoc(BaseTags):
     )
 
 
+class FlatSetAssoc(BaseSetAssoc):
+    type = "FlatSetAssoc"
+    cxx_header = "mem/cache/tags/flat_set_assoc.hh"
+    cxx_class = "gem5::FlatSetAssoc"
+    thread_safe_init = True
+
+
 class SectorTags(BaseTags):
     type = "SectorTags"
     cxx_header = "mem/cache/tags/sector_tags.hh"
     cxx_class = "gem5::SectorTags"
+    thread_safe_init = True
 
     # Get the cache associativity
     assoc = Param.Int(Parent.assoc, "associativity")
@@ -119,6 +140,7 @@ class CompressedTags(SectorTags):
     type = "CompressedTags"
     cxx_header = "mem/cache/tags/compressed_tags.hh"
     cxx_class = "gem5::CompressedTags"
+    thread_safe_init = True
 
     # Maximum number of compressed blocks per tag
     max_compression_ratio = Param.Int(
@@ -137,6 +159,7 @@ class FALRU(BaseTags):
     type = "FALRU"
     cxx_header = "mem/cache/tags/fa_lru.hh"
     cxx_class = "gem5::FALRU"
+    thread_safe_init = True
 
     min_tracked_cache_size = Param.MemorySize(
         "128KiB", "Minimum cache size for which we track statistics"
@@ -52,6 +52,7 @@
 #include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/request.hh"
 #include "sim/core.hh"
+#include "sim/host_mem.hh"
 #include "sim/sim_exit.hh"
 #include "sim/system.hh"
 
@@ -62,32 +63,61 @@ BaseTags::BaseTags(const Params &p)
     : ClockedObject(p), blkSize(p.block_size), blkMask(blkSize - 1),
       size(p.size), lookupLatency(p.tag_latency),
       system(p.system), indexingPolicy(p.indexing_policy),
+      missFilter(p.miss_filter),
       warmupBound((p.warmup_percentage/100.0) * (p.size / p.block_size)),
       warmedUp(false), numBlocks(p.size / p.block_size),
-      dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
+      // Allocate data storage in one big chunk
+      dataBlks(p.store_data ? new uint8_t[p.size] : nullptr),
       stats(*this)
 {
+    if (dataBlks)
+        host_mem::account(this, "data", size);
     registerExitCallback([this]() { cleanupRefs(); });
 }
 
+void
+BaseTags::init()
+{
+    ClockedObject::init();
+    tagsInit();
+}
+
 ReplaceableEntry*
 BaseTags::findBlockBySetAndWay(int set, int way) const
 {
     return indexingPolicy->getEntry(set, way);
 }
 
+bool
+BaseTags::isFilteredMiss(Addr addr) const
+{
+    if (!missFilter || missFilter->hasSaturated()) {
+        return false;
+    }
+
+    stats.missFilterLookups++;
+    if (missFilter->isSet(blkAlign(addr))) {
+        return false;
+    }
+    stats.missFilterMisses++;
+    return true;
+}
+
 CacheBlk*
 BaseTags::findBlock(Addr addr, bool is_secure) const
 {
+    if (isFilteredMiss(addr)) {
+        return nullptr;
+    }
+
     // Extract block tag
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Search for block
-    for (const auto& location : entries) {
+    for (const auto& location : possibleEntries) {
         CacheBlk* blk = static_cast<CacheBlk*>(location);
         if (blk->matchTag(tag, is_secure)) {
             return blk;
@@ -114,6 +144,9 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     // Insert block with tag, src requestor id and task id
     blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id,
                 pkt->req->taskId());
+    if (missFilter) {
+        missFilter->set(blkAlign(pkt->getAddr()));
+    }
 
     // Check if cache warm up is done
     if (!warmedUp && stats.tagsInUse.value() >= warmupBound) {
@@ -246,7 +279,13 @@ BaseTags::BaseTagStats::BaseTagStats(BaseTags &_tags)
     ADD_STAT(tagAccesses, statistics::units::Count::get(),
              "Number of tag accesses"),
     ADD_STAT(dataAccesses, statistics::units::Count::get(),
-             "Number of data accesses")
+             "Number of data accesses"),
+    ADD_STAT(missFilterLookups, statistics::units::Count::get(),
+             "Number of lookups checked against the miss filter"),
+    ADD_STAT(missFilterMisses, statistics::units::Count::get(),
+             "Number of lookups found to miss by the miss filter"),
+    ADD_STAT(missFilterRate, statistics::units::Ratio::get(),
+             "Ratio of the filtered lookups found to miss")
 {
 }
 
@@ -289,6 +328,11 @@ BaseTags::BaseTagStats::regStats()
     ratioOccsTaskId.flags(nozero);
 
     ratioOccsTaskId = occupanciesTaskId / statistics::constant(tags.numBlocks);
+
+    missFilterLookups.flags(nozero);
+    missFilterMisses.flags(nozero);
+    missFilterRate.flags(nozero | nonan);
+    missFilterRate = missFilterMisses / missFilterLookups;
 }
 
 void
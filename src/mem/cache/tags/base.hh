@@ -52,6 +52,7 @@
 #include <string>
 
 #include "base/callback.hh"
+#include "base/filters/base.hh"
 #include "base/logging.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
@@ -88,6 +89,19 @@ class BaseTags : public ClockedObject
     /** Indexing policy */
     BaseIndexingPolicy *indexingPolicy;
 
+    /**
+     * Holds the possible entries of the last lookup. It is reused by all
+     * lookups so that they do not need to allocate memory.
+     */
+    mutable std::vector<ReplaceableEntry*> possibleEntries;
+
+    /**
+     * Optional filter of the addresses of the valid blocks. It is set on
+     * insertion and unset on invalidation, so a lookup of an address it
+     * does not hold is a definite miss.
+     */
+    bloom_filter::Base *missFilter;
+
     /**
      * The number of tags that need to be touched to meet the warmup
      * percentage.
@@ -99,9 +113,30 @@ class BaseTags : public ClockedObject
     /** the number of blocks in the cache */
     const unsigned numBlocks;
 
-    /** The data blocks, 1 per cache block. */
+    /** The data blocks, 1 per cache block, unless data is not stored. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /**
+     * Get the data storage of a block.
+     *
+     * @param blk_index The index of the block.
+     * @return The data of the block, or nullptr if data is not stored.
+     */
+    uint8_t *
+    getBlockData(unsigned blk_index) const
+    {
+        return dataBlks ? &dataBlks[blkSize * blk_index] : nullptr;
+    }
+
+    /**
+     * Check the miss filter for an address. Once the filter saturated it
+     * may give false negatives, and is not used anymore.
+     *
+     * @param addr The address to look for.
+     * @return Whether the block is definitely not in the cache.
+     */
+    bool isFilteredMiss(Addr addr) const;
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -155,6 +190,13 @@ class BaseTags : public ClockedObject
         statistics::Scalar tagAccesses;
         /** Number of data blocks consulted over all accesses. */
         statistics::Scalar dataAccesses;
+
+        /** Number of lookups checked against the miss filter. */
+        mutable statistics::Scalar missFilterLookups;
+        /** Number of lookups the miss filter found to be misses. */
+        mutable statistics::Scalar missFilterMisses;
+        /** Ratio of the lookups that did not need a search. */
+        statistics::Formula missFilterRate;
     } stats;
 
   public:
@@ -173,6 +215,13 @@ class BaseTags : public ClockedObject
      */
     virtual void tagsInit() = 0;
 
+    /**
+     * Initialize the blocks with tagsInit(). This is done at init rather
+     * than at construction so the tags of many caches can be initialized
+     * on several host threads (see Root.init_threads).
+     */
+    void init() override;
+
     /**
      * Average in the reference count for valid blocks when the simulation
      * exits.
@@ -260,6 +309,10 @@ class BaseTags : public ClockedObject
         stats.totalRefs += blk->getRefCount();
         stats.sampledRefs++;
 
+        if (missFilter) {
+            missFilter->unset(regenerateBlkAddr(blk));
+        }
+
         blk->invalidate();
     }
 
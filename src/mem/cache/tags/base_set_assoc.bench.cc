@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/gtest/clocked_object_fixture.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/cache/replacement_policies/lru_rp.hh"
+#include "mem/cache/tags/base_set_assoc.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "params/BaseSetAssoc.hh"
+#include "params/LRURP.hh"
+#include "params/SetAssociative.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const int blkSize = 64;
+
+/** A set associative cache's tags, with LRU replacement, and no cache. */
+class Tags
+{
+  private:
+    ClockedObjectFixture fixture;
+
+    SetAssociativeParams indexingParams;
+    LRURPParams replacementParams;
+    BaseSetAssocParams tagsParams;
+
+    std::unique_ptr<SetAssociative> indexingPolicy;
+    std::unique_ptr<replacement_policy::LRU> replacementPolicy;
+
+  public:
+    std::unique_ptr<BaseSetAssoc> tags;
+
+    Tags(uint64_t size, int assoc)
+    {
+        fixture.setParams(indexingParams, "indexing_policy");
+        indexingParams.size = size;
+        indexingParams.entry_size = blkSize;
+        indexingParams.assoc = assoc;
+        indexingPolicy.reset(new SetAssociative(indexingParams));
+
+        fixture.setParams(replacementParams, "replacement_policy");
+        replacementPolicy.reset(
+                new replacement_policy::LRU(replacementParams));
+
+        fixture.setParams(tagsParams, "tags");
+        tagsParams.size = size;
+        tagsParams.block_size = blkSize;
+        tagsParams.entry_size = blkSize;
+        tagsParams.assoc = assoc;
+        tagsParams.tag_latency = Cycles(2);
+        tagsParams.warmup_percentage = 0;
+        tagsParams.store_data = false;
+        tagsParams.sequential_access = false;
+        tagsParams.system = nullptr;
+        tagsParams.indexing_policy = indexingPolicy.get();
+        tagsParams.replacement_policy = replacementPolicy.get();
+        tags.reset(new BaseSetAssoc(tagsParams));
+        tags->tagsInit();
+    }
+
+    /**
+     * Make a block valid for an address, in a way which is still invalid.
+     * This skips BaseTags::insertBlock(), whose stats need a system.
+     */
+    void
+    insert(PacketPtr pkt)
+    {
+        for (auto *entry :
+                indexingPolicy->getPossibleEntries(pkt->getAddr())) {
+            auto *blk = static_cast<CacheBlk *>(entry);
+            if (!blk->isValid()) {
+                blk->insert(tags->extractTag(pkt->getAddr()), false, 0, 0);
+                replacementPolicy->reset(blk->replacementData);
+                return;
+            }
+        }
+    }
+};
+
+/** Read packets for random blocks of a footprint starting at address 0. */
+std::vector<PacketPtr>
+makePackets(uint64_t footprint, int num_packets)
+{
+    std::mt19937_64 rng(0);
+    std::vector<PacketPtr> pkts;
+    for (int i = 0; i < num_packets; i++) {
+        const Addr addr = (rng() % (footprint / blkSize)) * blkSize;
+        pkts.push_back(Packet::createRead(
+                    Request::make(addr, blkSize, 0, 0)));
+    }
+    return pkts;
+}
+
+} // anonymous namespace
+
+/**
+ * Look up the tags of a 64KiB cache holding a footprint (in KiB), so a
+ * footprint up to 64KiB only hits, and a larger one mostly misses.
+ */
+static void
+BM_BaseSetAssocAccessBlock(benchmark::State &state)
+{
+    const uint64_t size = 64 * 1024;
+    const uint64_t footprint = state.range(0) * 1024;
+    const int assoc = state.range(1);
+
+    Tags tags(size, assoc);
+    for (Addr addr = 0; addr < std::min(size, footprint); addr += blkSize) {
+        PacketPtr pkt = Packet::createRead(Request::make(addr, blkSize, 0, 0));
+        tags.insert(pkt);
+        delete pkt;
+    }
+
+    std::vector<PacketPtr> pkts = makePackets(footprint, 4096);
+    size_t i = 0;
+    Cycles lat;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                tags.tags->accessBlock(pkts[i++ % pkts.size()], lat));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (auto *pkt : pkts)
+        delete pkt;
+}
+BENCHMARK(BM_BaseSetAssocAccessBlock)
+    ->ArgsProduct({ { 16, 64, 1024 }, { 2, 8, 16 } });
@@ -48,6 +48,7 @@
 #include <string>
 
 #include "base/intmath.hh"
+#include "sim/host_mem.hh"
 
 namespace gem5
 {
@@ -64,6 +65,8 @@ BaseSetAssoc::BaseSetAssoc(const Params &p)
     if (blkSize < 4 || !isPowerOf2(blkSize)) {
         fatal("Block size must be at least 4 and a power of 2");
     }
+
+    host_mem::account(this, "tags", blks.size() * sizeof(CacheBlk));
 }
 
 void
@@ -78,7 +81,7 @@ BaseSetAssoc::tagsInit()
         indexingPolicy->setEntry(blk, blk_index);
 
         // Associate a data chunk to the block
-        blk->data = &dataBlks[blkSize*blk_index];
+        blk->data = getBlockData(blk_index);
 
         // Associate a replacement data entry to the block
         blk->replacementData = replacementPolicy->instantiateEntry();
@@ -170,12 +170,11 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks) override
     {
         // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = static_cast<CacheBlk*>(replacementPolicy->getVictim(
-                                entries));
+                                possibleEntries));
 
         // There is only one eviction for this replacement
         evict_blks.push_back(victim);
@@ -54,6 +54,7 @@
 #include "base/logging.hh"
 #include "mem/cache/base.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "sim/host_mem.hh"
 
 namespace gem5
 {
@@ -76,6 +77,7 @@ FALRU::FALRU(const Params &p)
         fatal("Cache Size must be power of 2 for now");
 
     blks = new FALRUBlk[numBlocks];
+    host_mem::account(this, "tags", numBlocks * sizeof(FALRUBlk));
 }
 
 FALRU::~FALRU()
@@ -90,7 +92,7 @@ FALRU::tagsInit()
     head->prev = nullptr;
     head->next = &(blks[1]);
     head->setPosition(0, 0);
-    head->data = &dataBlks[0];
+    head->data = getBlockData(0);
 
     for (unsigned i = 1; i < numBlocks - 1; i++) {
         blks[i].prev = &(blks[i-1]);
@@ -98,14 +100,14 @@ FALRU::tagsInit()
         blks[i].setPosition(0, i);
 
         // Associate a data chunk to the block
-        blks[i].data = &dataBlks[blkSize*i];
+        blks[i].data = getBlockData(i);
     }
 
     tail = &(blks[numBlocks - 1]);
     tail->prev = &(blks[numBlocks - 2]);
     tail->next = nullptr;
     tail->setPosition(0, numBlocks - 1);
-    tail->data = &dataBlks[(numBlocks - 1) * blkSize];
+    tail->data = getBlockData(numBlocks - 1);
 
     cacheTracking.init(head, tail);
 }
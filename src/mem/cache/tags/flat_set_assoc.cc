@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a set associative tag store that keeps the tags of each
+ * set in a flat array.
+ */
+
+#include "mem/cache/tags/flat_set_assoc.hh"
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
+
+namespace gem5
+{
+
+FlatSetAssoc::FlatSetAssoc(const Params &p)
+    : BaseSetAssoc(p), assoc(p.assoc),
+      setIndexing(dynamic_cast<const SetAssociative *>(p.indexing_policy)),
+      tags(numBlocks, MaxAddr),
+      validBits(numBlocks / p.assoc, 0),
+      secureBits(numBlocks / p.assoc, 0)
+{
+    fatal_if(!setIndexing,
+             "%s requires a SetAssociative indexing policy", name());
+    fatal_if(assoc > sizeof(WayMask) * 8,
+             "%s supports an associativity of at most %d", name(),
+             sizeof(WayMask) * 8);
+}
+
+void
+FlatSetAssoc::tagsInit()
+{
+    BaseSetAssoc::tagsInit();
+
+    for (const auto &blk : blks) {
+        updateTag(&blk);
+    }
+}
+
+void
+FlatSetAssoc::updateTag(const CacheBlk *blk)
+{
+    const uint32_t set = blk->getSet();
+    const uint32_t way = blk->getWay();
+    const WayMask bit = WayMask(1) << way;
+
+    tags[set * assoc + way] = blk->getTag();
+    if (blk->isValid()) {
+        validBits[set] |= bit;
+    } else {
+        validBits[set] &= ~bit;
+    }
+    if (blk->isSecure()) {
+        secureBits[set] |= bit;
+    } else {
+        secureBits[set] &= ~bit;
+    }
+}
+
+CacheBlk *
+FlatSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    if (isFilteredMiss(addr)) {
+        return nullptr;
+    }
+
+    const Addr tag = extractTag(addr);
+    const uint32_t set = setIndexing->getSet(addr);
+    const Addr *set_tags = &tags[set * assoc];
+
+    // Compare all ways without branching so the loop can be vectorized.
+    // The associativity is at most 64, masking the shift amount only lets
+    // the compiler know it is in range.
+    WayMask match = 0;
+    for (unsigned way = 0; way < assoc; way++) {
+        match |= WayMask(set_tags[way] == tag) << (way & 63);
+    }
+    match &= validBits[set];
+    match &= is_secure ? secureBits[set] : ~secureBits[set];
+
+    if (!match) {
+        return nullptr;
+    }
+
+    CacheBlk *blk = const_cast<CacheBlk *>(
+        &blks[set * assoc + findLsbSet(match)]);
+    assert(blk->matchTag(tag, is_secure));
+    return blk;
+}
+
+void
+FlatSetAssoc::invalidate(CacheBlk *blk)
+{
+    BaseSetAssoc::invalidate(blk);
+    updateTag(blk);
+}
+
+void
+FlatSetAssoc::insertBlock(const PacketPtr pkt, CacheBlk *blk)
+{
+    BaseSetAssoc::insertBlock(pkt, blk);
+    updateTag(blk);
+}
+
+void
+FlatSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
+{
+    BaseSetAssoc::moveBlock(src_blk, dest_blk);
+    updateTag(src_blk);
+    updateTag(dest_blk);
+}
+
+} // namespace gem5
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a set associative tag store that keeps the tags of each
+ * set in a flat array.
+ */
+
+#ifndef __MEM_CACHE_TAGS_FLAT_SET_ASSOC_HH__
+#define __MEM_CACHE_TAGS_FLAT_SET_ASSOC_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/tags/base_set_assoc.hh"
+#include "params/FlatSetAssoc.hh"
+
+namespace gem5
+{
+
+class CacheBlk;
+class SetAssociative;
+
+/**
+ * A set associative tag store that mirrors the tags, valid bits and
+ * secure bits of every set in a structure of arrays. The tags of a set
+ * are stored contiguously, and the valid and secure bits of a set are
+ * packed into one word each, so a lookup compares all ways with a
+ * branch-free loop that the compiler can vectorize. It does not
+ * allocate, and it only touches the CacheBlk of the way that hits.
+ *
+ * The mirror is kept up to date by the tag store functions that change
+ * a block's tag (insertBlock(), invalidate() and moveBlock()), so the
+ * cache must not modify the tags of its blocks directly.
+ *
+ * This tag store requires a SetAssociative indexing policy and an
+ * associativity of at most 64.
+ */
+class FlatSetAssoc : public BaseSetAssoc
+{
+  protected:
+    /** Bit vector with one bit per way of a set. */
+    typedef uint64_t WayMask;
+
+    /** The full associativity of the cache. */
+    const unsigned assoc;
+
+    /** The indexing policy, which maps an address to a single set. */
+    const SetAssociative *setIndexing;
+
+    /** The tags of all blocks, indexed by set * assoc + way. */
+    std::vector<Addr> tags;
+
+    /** The valid bits of each set. */
+    std::vector<WayMask> validBits;
+
+    /** The secure bits of each set. */
+    std::vector<WayMask> secureBits;
+
+    /**
+     * Copy the tag information of a block into the flat arrays.
+     *
+     * @param blk The block to update the arrays with.
+     */
+    void updateTag(const CacheBlk *blk);
+
+  public:
+    /** Convenience typedef. */
+    typedef FlatSetAssocParams Params;
+
+    FlatSetAssoc(const Params &p);
+
+    void tagsInit() override;
+
+    /**
+     * Find the block holding an address by comparing all the tags of
+     * its set at once.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    CacheBlk *findBlock(Addr addr, bool is_secure) const override;
+
+    void invalidate(CacheBlk *blk) override;
+    void insertBlock(const PacketPtr pkt, CacheBlk *blk) override;
+    void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
+};
+
+} // namespace gem5
+
+#endif //__MEM_CACHE_TAGS_FLAT_SET_ASSOC_HH__
@@ -58,23 +58,19 @@ namespace gem5
 BaseIndexingPolicy::BaseIndexingPolicy(const Params &p)
     : SimObject(p), assoc(p.assoc),
       numSets(p.size / (p.entry_size * assoc)),
-      setShift(floorLog2(p.entry_size)), setMask(numSets - 1), sets(numSets),
+      setShift(floorLog2(p.entry_size)), setMask(numSets - 1),
+      entryTable((size_t)numSets * assoc, nullptr),
       tagShift(setShift + floorLog2(numSets))
 {
     fatal_if(!isPowerOf2(numSets), "# of sets must be non-zero and a power " \
              "of 2");
     fatal_if(assoc <= 0, "associativity must be greater than zero");
-
-    // Make space for the entries
-    for (uint32_t i = 0; i < numSets; ++i) {
-        sets[i].resize(assoc);
-    }
 }
 
 ReplaceableEntry*
 BaseIndexingPolicy::getEntry(const uint32_t set, const uint32_t way) const
 {
-    return sets[set][way];
+    return entryTable[(size_t)set * assoc + way];
 }
 
 void
@@ -89,7 +85,7 @@ BaseIndexingPolicy::setEntry(ReplaceableEntry* entry, const uint64_t index)
     assert(set < numSets);
 
     // Assign a free pointer
-    sets[set][way] = entry;
+    entryTable[index] = entry;
 
     // Inform the entry its position
     entry->setPosition(set, way);
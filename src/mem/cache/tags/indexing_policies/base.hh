@@ -87,9 +87,11 @@ class BaseIndexingPolicy : public SimObject
     const unsigned setMask;
 
     /**
-     * The cache sets.
+     * The entries of all the cache sets in one array, set by set, so a
+     * large cache needs a single allocation for them. The entry in a way
+     * of a set is at set * assoc + way.
      */
-    std::vector<std::vector<ReplaceableEntry*>> sets;
+    std::vector<ReplaceableEntry*> entryTable;
 
     /**
      * The amount to shift the address to get the tag.
@@ -143,11 +145,32 @@ class BaseIndexingPolicy : public SimObject
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
      *
+     * The entries are written to a vector provided by the caller, which
+     * is cleared first. Callers on hot paths should keep reusing the same
+     * vector, so that no memory is allocated once it has grown to hold
+     * the associativity.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @param entries The vector to store the possible entries in.
+     */
+    virtual void getPossibleEntries(const Addr addr,
+        std::vector<ReplaceableEntry*> &entries) const = 0;
+
+    /**
+     * Find all possible entries for insertion and replacement of an address.
+     * This allocates a new vector on every call, so it should be avoided
+     * on hot paths.
+     *
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
-    virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
-                                                                    const = 0;
+    std::vector<ReplaceableEntry*>
+    getPossibleEntries(const Addr addr) const
+    {
+        std::vector<ReplaceableEntry*> entries;
+        getPossibleEntries(addr, entries);
+        return entries;
+    }
 
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
@@ -69,10 +69,12 @@ SetAssociative::regenerateAddr(const Addr tag, const ReplaceableEntry* entry)
     return (tag << tagShift) | (entry->getSet() << setShift);
 }
 
-std::vector<ReplaceableEntry*>
-SetAssociative::getPossibleEntries(const Addr addr) const
+void
+SetAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*> &entries) const
 {
-    return sets[extractSet(addr)];
+    const auto set = entryTable.begin() + (size_t)extractSet(addr) * assoc;
+    entries.assign(set, set + assoc);
 }
 
 } // namespace gem5
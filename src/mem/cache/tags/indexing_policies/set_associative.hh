@@ -106,6 +106,15 @@ class SetAssociative : public BaseIndexingPolicy
      */
     ~SetAssociative() {};
 
+    /**
+     * Get the set an address maps to. All ways of the set are possible
+     * locations for the address.
+     *
+     * @param addr The address to calculate the set for.
+     * @return The set index of the address.
+     */
+    uint32_t getSet(const Addr addr) const { return extractSet(addr); }
+
     /**
      * Find all possible entries for insertion and replacement of an address.
      * Should be called immediately before ReplacementPolicy's findVictim()
@@ -113,10 +122,11 @@ class SetAssociative : public BaseIndexingPolicy
      * Returns entries in all ways belonging to the set of the address.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @param entries The vector to store the possible entries in.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                     override;
+    void getPossibleEntries(const Addr addr,
+        std::vector<ReplaceableEntry*> &entries) const override;
+    using BaseIndexingPolicy::getPossibleEntries;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
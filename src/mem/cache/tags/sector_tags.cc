@@ -95,7 +95,7 @@ SectorTags::tagsInit()
             blk = &blks[blk_index];
 
             // Associate a data chunk to the block
-            blk->data = &dataBlks[blkSize*blk_index];
+            blk->data = getBlockData(blk_index);
 
             // Associate sector block to this block
             blk->setSectorBlock(sec_blk);
@@ -249,6 +249,10 @@ SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 CacheBlk*
 SectorTags::findBlock(Addr addr, bool is_secure) const
 {
+    if (isFilteredMiss(addr)) {
+        return nullptr;
+    }
+
     // Extract sector tag
     const Addr tag = extractTag(addr);
 
@@ -257,11 +261,10 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     const Addr offset = extractSectorOffset(addr);
 
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Search for block
-    for (const auto& sector : entries) {
+    for (const auto& sector : possibleEntries) {
         auto blk = static_cast<SectorBlk*>(sector)->blks[offset];
         if (blk->matchTag(tag, is_secure)) {
             return blk;
@@ -277,13 +280,12 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
     SectorBlk* victim_sector = nullptr;
-    for (const auto& sector : sector_entries) {
+    for (const auto& sector : possibleEntries) {
         SectorBlk* sector_blk = static_cast<SectorBlk*>(sector);
         if (sector_blk->matchTag(tag, is_secure)) {
             victim_sector = sector_blk;
@@ -295,7 +297,7 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
     if (victim_sector == nullptr){
         // Choose replacement victim from replacement candidates
         victim_sector = static_cast<SectorBlk*>(replacementPolicy->getVictim(
-                                                sector_entries));
+                                                possibleEntries));
     }
 
     // Get the entry of the victim block within the sector
@@ -340,10 +340,9 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 
             // remember where to route the normal response to
             if (expect_response || expect_snoop_resp) {
-                assert(routeTo.find(pkt->req) == routeTo.end());
-                routeTo[pkt->req] = cpu_side_port_id;
+                setRoute(pkt->req, cpu_side_port_id);
 
-                panic_if(routeTo.size() > maxRoutingTableSizeCheck,
+                panic_if(numRoutes > maxRoutingTableSizeCheck,
                          "%s: Routing table exceeds %d packets\n",
                          name(), maxRoutingTableSizeCheck);
             }
@@ -395,23 +394,20 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                 assert(rsp_pkt);
 
                 // determine the destination
-                const auto route_lookup = routeTo.find(rsp_pkt->req);
-                assert(route_lookup != routeTo.end());
-                rsp_port_id = route_lookup->second;
+                rsp_port_id = findRoute(rsp_pkt->req);
                 assert(rsp_port_id != InvalidPortID);
                 assert(rsp_port_id < respLayers.size());
                 // remove the request from the routing table
-                routeTo.erase(route_lookup);
+                clearRoute(rsp_pkt->req);
             }
             outstandingCMO.erase(cmo_lookup);
         } else {
             respond_directly = false;
             outstandingCMO.emplace(pkt->id, deferred_rsp);
             if (!pkt->isWrite()) {
-                assert(routeTo.find(pkt->req) == routeTo.end());
-                routeTo[pkt->req] = cpu_side_port_id;
+                setRoute(pkt->req, cpu_side_port_id);
 
-                panic_if(routeTo.size() > maxRoutingTableSizeCheck,
+                panic_if(numRoutes > maxRoutingTableSizeCheck,
                          "%s: Routing table exceeds %d packets\n",
                          name(), maxRoutingTableSizeCheck);
             }
@@ -450,9 +446,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     RequestPort *src_port = memSidePorts[mem_side_port_id];
 
     // determine the destination
-    const auto route_lookup = routeTo.find(pkt->req);
-    assert(route_lookup != routeTo.end());
-    const PortID cpu_side_port_id = route_lookup->second;
+    const PortID cpu_side_port_id = findRoute(pkt->req);
     assert(cpu_side_port_id != InvalidPortID);
     assert(cpu_side_port_id < respLayers.size());
 
@@ -494,7 +488,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
                                         + latency);
 
     // remove the request from the routing table
-    routeTo.erase(route_lookup);
+    clearRoute(pkt->req);
 
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
@@ -554,8 +548,7 @@ CoherentXBar::recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id)
 
     // if we can expect a response, remember how to route it
     if (!cache_responding && pkt->cacheResponding()) {
-        assert(routeTo.find(pkt->req) == routeTo.end());
-        routeTo[pkt->req] = mem_side_port_id;
+        setRoute(pkt->req, mem_side_port_id);
     }
 
     // a snoop request came from a connected CPU-side-port device (one of
@@ -573,9 +566,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
     ResponsePort* src_port = cpuSidePorts[cpu_side_port_id];
 
     // get the destination
-    const auto route_lookup = routeTo.find(pkt->req);
-    assert(route_lookup != routeTo.end());
-    const PortID dest_port_id = route_lookup->second;
+    const PortID dest_port_id = findRoute(pkt->req);
     assert(dest_port_id != InvalidPortID);
 
     // determine if the response is from a snoop request we
@@ -685,7 +676,7 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
     }
 
     // remove the request from the routing table
-    routeTo.erase(route_lookup);
+    clearRoute(pkt->req);
 
     // stats updates
     transDist[pkt_cmd]++;
@@ -55,8 +55,12 @@ CommMonitor::CommMonitor(const Params &params)
       samplePeriodicEvent([this]{ samplePeriodic(); }, name()),
       samplePeriodTicks(params.sample_period),
       samplePeriod(params.sample_period / sim_clock::as_float::s),
+      sampleEvery(params.sample_every),
+      sampleCount(0),
       stats(this, params)
 {
+    fatal_if(sampleEvery == 0, "%s: sample_every must be at least 1.",
+             name());
     DPRINTF(CommMonitor,
             "Created monitor %s with sample period %d ticks (%f ms)\n",
             name(), samplePeriodTicks, samplePeriod * 1E3);
@@ -105,11 +109,19 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
                                         const CommMonitorParams &params)
     : statistics::Group(parent),
 
-      disableBurstLengthHists(params.disable_burst_length_hists),
+      disableBurstLengthHists(params.disable_burst_length_hists ||
+                              params.counters_only),
+      log2Hists(params.log2_hists),
       ADD_STAT(readBurstLengthHist, statistics::units::Byte::get(),
                "Histogram of burst lengths of transmitted packets"),
       ADD_STAT(writeBurstLengthHist, statistics::units::Byte::get(),
                "Histogram of burst lengths of transmitted packets"),
+      ADD_STAT(readBurstLengthLog2Dist, statistics::units::Count::get(),
+               "Log2 bucket (0 for 0, n + 1 for [2^n, 2^(n+1))) of "
+               "the read burst lengths"),
+      ADD_STAT(writeBurstLengthLog2Dist, statistics::units::Count::get(),
+               "Log2 bucket (0 for 0, n + 1 for [2^n, 2^(n+1))) of "
+               "the write burst lengths"),
 
       disableBandwidthHists(params.disable_bandwidth_hists),
       readBytes(0),
@@ -135,13 +147,20 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
                "Average write bandwidth",
                totalWrittenBytes / simSeconds),
 
-      disableLatencyHists(params.disable_latency_hists),
+      disableLatencyHists(params.disable_latency_hists ||
+                          params.counters_only),
       ADD_STAT(readLatencyHist, statistics::units::Tick::get(),
                "Read request-response latency"),
       ADD_STAT(writeLatencyHist, statistics::units::Tick::get(),
                "Write request-response latency"),
-
-      disableITTDists(params.disable_itt_dists),
+      ADD_STAT(readLatencyLog2Dist, statistics::units::Count::get(),
+               "Log2 bucket (0 for 0, n + 1 for [2^n, 2^(n+1))) of "
+               "the read request-response latencies in ticks"),
+      ADD_STAT(writeLatencyLog2Dist, statistics::units::Count::get(),
+               "Log2 bucket (0 for 0, n + 1 for [2^n, 2^(n+1))) of "
+               "the write request-response latencies in ticks"),
+
+      disableITTDists(params.disable_itt_dists || params.counters_only),
       ADD_STAT(ittReadRead, statistics::units::Tick::get(),
                "Read-to-read inter transaction time"),
       ADD_STAT(ittWriteWrite, statistics::units::Tick::get(),
@@ -166,7 +185,7 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
                "Histogram of write transactions per sample period"),
       writeTrans(0),
 
-      disableAddrDists(params.disable_addr_dists),
+      disableAddrDists(params.disable_addr_dists || params.counters_only),
       readAddrMask(params.read_addr_mask),
       writeAddrMask(params.write_addr_mask),
       ADD_STAT(readAddrDist, statistics::units::Count::get(),
@@ -178,11 +197,19 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
 
     readBurstLengthHist
         .init(params.burst_length_bins)
-        .flags(disableBurstLengthHists ? nozero : pdf);
+        .flags(disableBurstLengthHists || log2Hists ? nozero : pdf);
 
     writeBurstLengthHist
         .init(params.burst_length_bins)
-        .flags(disableBurstLengthHists ? nozero : pdf);
+        .flags(disableBurstLengthHists || log2Hists ? nozero : pdf);
+
+    readBurstLengthLog2Dist
+        .init(0, 64, 1)
+        .flags(disableBurstLengthHists || !log2Hists ? nozero : pdf);
+
+    writeBurstLengthLog2Dist
+        .init(0, 64, 1)
+        .flags(disableBurstLengthHists || !log2Hists ? nozero : pdf);
 
     // Stats based on received responses
     readBandwidthHist
@@ -209,11 +236,19 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
 
     readLatencyHist
         .init(params.latency_bins)
-        .flags(disableLatencyHists ? nozero : pdf);
+        .flags(disableLatencyHists || log2Hists ? nozero : pdf);
 
     writeLatencyHist
         .init(params.latency_bins)
-        .flags(disableLatencyHists ? nozero : pdf);
+        .flags(disableLatencyHists || log2Hists ? nozero : pdf);
+
+    readLatencyLog2Dist
+        .init(0, 64, 1)
+        .flags(disableLatencyHists || !log2Hists ? nozero : pdf);
+
+    writeLatencyLog2Dist
+        .init(0, 64, 1)
+        .flags(disableLatencyHists || !log2Hists ? nozero : pdf);
 
     ittReadRead
         .init(1, params.itt_max_bin, params.itt_max_bin /
@@ -258,7 +293,7 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
 void
 CommMonitor::MonitorStats::updateReqStats(
     const probing::PacketInfo& pkt_info, bool is_atomic,
-    bool expects_response)
+    bool expects_response, bool sampled)
 {
     if (pkt_info.cmd.isRead()) {
         // Increment number of observed read transactions
@@ -266,21 +301,27 @@ CommMonitor::MonitorStats::updateReqStats(
             ++readTrans;
 
         // Get sample of burst length
-        if (!disableBurstLengthHists)
-            readBurstLengthHist.sample(pkt_info.size);
+        if (!disableBurstLengthHists && sampled) {
+            if (log2Hists)
+                readBurstLengthLog2Dist.sample(log2Bucket(pkt_info.size));
+            else
+                readBurstLengthHist.sample(pkt_info.size);
+        }
 
         // Sample the masked address
-        if (!disableAddrDists)
+        if (!disableAddrDists && sampled)
             readAddrDist.sample(pkt_info.addr & readAddrMask);
 
+        // The times of the last requests are always tracked, so that
+        // the sampled inter transaction times are not skewed
         if (!disableITTDists) {
             // Sample value of read-read inter transaction time
-            if (timeOfLastRead != 0)
+            if (timeOfLastRead != 0 && sampled)
                 ittReadRead.sample(curTick() - timeOfLastRead);
             timeOfLastRead = curTick();
 
             // Sample value of req-req inter transaction time
-            if (timeOfLastReq != 0)
+            if (timeOfLastReq != 0 && sampled)
                 ittReqReq.sample(curTick() - timeOfLastReq);
             timeOfLastReq = curTick();
         }
@@ -292,8 +333,12 @@ CommMonitor::MonitorStats::updateReqStats(
         if (!disableTransactionHists)
             ++writeTrans;
 
-        if (!disableBurstLengthHists)
-            writeBurstLengthHist.sample(pkt_info.size);
+        if (!disableBurstLengthHists && sampled) {
+            if (log2Hists)
+                writeBurstLengthLog2Dist.sample(log2Bucket(pkt_info.size));
+            else
+                writeBurstLengthHist.sample(pkt_info.size);
+        }
 
         // Update the bandwidth stats on the request
         if (!disableBandwidthHists) {
@@ -302,17 +347,17 @@ CommMonitor::MonitorStats::updateReqStats(
         }
 
         // Sample the masked write address
-        if (!disableAddrDists)
+        if (!disableAddrDists && sampled)
             writeAddrDist.sample(pkt_info.addr & writeAddrMask);
 
         if (!disableITTDists) {
             // Sample value of write-to-write inter transaction time
-            if (timeOfLastWrite != 0)
+            if (timeOfLastWrite != 0 && sampled)
                 ittWriteWrite.sample(curTick() - timeOfLastWrite);
             timeOfLastWrite = curTick();
 
             // Sample value of req-to-req inter transaction time
-            if (timeOfLastReq != 0)
+            if (timeOfLastReq != 0 && sampled)
                 ittReqReq.sample(curTick() - timeOfLastReq);
             timeOfLastReq = curTick();
         }
@@ -324,7 +369,8 @@ CommMonitor::MonitorStats::updateReqStats(
 
 void
 CommMonitor::MonitorStats::updateRespStats(
-    const probing::PacketInfo& pkt_info, Tick latency, bool is_atomic)
+    const probing::PacketInfo& pkt_info, Tick latency, bool is_atomic,
+    bool sampled)
 {
     if (pkt_info.cmd.isRead()) {
         // Decrement number of outstanding read requests
@@ -333,8 +379,12 @@ CommMonitor::MonitorStats::updateRespStats(
             --outstandingReadReqs;
         }
 
-        if (!disableLatencyHists)
-            readLatencyHist.sample(latency);
+        if (!disableLatencyHists && sampled) {
+            if (log2Hists)
+                readLatencyLog2Dist.sample(log2Bucket(latency));
+            else
+                readLatencyHist.sample(latency);
+        }
 
         // Update the bandwidth stats based on responses for reads
         if (!disableBandwidthHists) {
@@ -349,8 +399,12 @@ CommMonitor::MonitorStats::updateRespStats(
             --outstandingWriteReqs;
         }
 
-        if (!disableLatencyHists)
-            writeLatencyHist.sample(latency);
+        if (!disableLatencyHists && sampled) {
+            if (log2Hists)
+                writeLatencyLog2Dist.sample(log2Bucket(latency));
+            else
+                writeLatencyHist.sample(latency);
+        }
     }
 }
 
@@ -364,9 +418,10 @@ CommMonitor::recvAtomic(PacketPtr pkt)
 
     const Tick delay(memSidePort.sendAtomic(pkt));
 
-    stats.updateReqStats(req_pkt_info, true, expects_response);
+    const bool sampled = sampleNext();
+    stats.updateReqStats(req_pkt_info, true, expects_response, sampled);
     if (expects_response)
-        stats.updateRespStats(req_pkt_info, delay, true);
+        stats.updateRespStats(req_pkt_info, delay, true, sampled);
 
     // Some packets, such as WritebackDirty, don't need response.
     assert(pkt->isResponse() || !expects_response);
@@ -394,19 +449,26 @@ CommMonitor::recvTimingReq(PacketPtr pkt)
     const bool expects_response(pkt->needsResponse() &&
                                 !pkt->cacheResponding());
 
+    // Only the sampled requests get a sender state to measure their
+    // latency. A request that is not accepted is sampled again on its
+    // retry.
+    const bool sampled = nextSampled();
+
     // If a cache miss is served by a cache, a monitor near the memory
     // would see a request which needs a response, but this response
     // would not come back from the memory. Therefore we additionally
     // have to check the cacheResponding flag
-    if (expects_response && !stats.disableLatencyHists) {
-        pkt->pushSenderState(new CommMonitorSenderState(curTick()));
+    const bool track_latency = expects_response &&
+        !stats.disableLatencyHists && sampled;
+    if (track_latency) {
+        pkt->pushSenderState(new CommMonitorSenderState(curTick(), this));
     }
 
     // Attempt to send the packet
     bool successful = memSidePort.sendTimingReq(pkt);
 
     // If not successful, restore the sender state
-    if (!successful && expects_response && !stats.disableLatencyHists) {
+    if (!successful && track_latency) {
         delete pkt->popSenderState();
     }
 
@@ -417,7 +479,8 @@ CommMonitor::recvTimingReq(PacketPtr pkt)
     if (successful) {
         DPRINTF(CommMonitor, "Forwarded %s request\n", pkt->isRead() ? "read" :
                 pkt->isWrite() ? "write" : "non read/write");
-        stats.updateReqStats(pkt_info, false, expects_response);
+        sampleNext();
+        stats.updateReqStats(pkt_info, false, expects_response, sampled);
     }
     return successful;
 }
@@ -433,22 +496,29 @@ CommMonitor::recvTimingResp(PacketPtr pkt)
     const probing::PacketInfo pkt_info(pkt);
 
     Tick latency = 0;
-    CommMonitorSenderState* received_state =
-        dynamic_cast<CommMonitorSenderState*>(pkt->senderState);
+    CommMonitorSenderState* received_state = nullptr;
 
     if (!stats.disableLatencyHists) {
+        received_state =
+            dynamic_cast<CommMonitorSenderState*>(pkt->senderState);
+
+        // With sampling, only some requests carry our sender state
+        if (received_state && received_state->monitor != this)
+            received_state = nullptr;
+
         // Restore initial sender state
-        if (received_state == NULL)
+        if (received_state == NULL && sampleEvery == 1)
             panic("Monitor got a response without monitor sender state\n");
 
         // Restore the sate
-        pkt->senderState = received_state->predecessor;
+        if (received_state)
+            pkt->senderState = received_state->predecessor;
     }
 
     // Attempt to send the packet
     bool successful = cpuSidePort.sendTimingResp(pkt);
 
-    if (!stats.disableLatencyHists) {
+    if (received_state) {
         // If packet successfully send, sample value of latency,
         // afterwards delete sender state, otherwise restore state
         if (successful) {
@@ -466,7 +536,8 @@ CommMonitor::recvTimingResp(PacketPtr pkt)
         ppPktResp->notify(pkt_info);
         DPRINTF(CommMonitor, "Received %s response\n", pkt->isRead() ? "read" :
                 pkt->isWrite() ?  "write" : "non read/write");
-        stats.updateRespStats(pkt_info, latency, false);
+        stats.updateRespStats(pkt_info, latency, false,
+                              received_state != nullptr);
     }
     return successful;
 }
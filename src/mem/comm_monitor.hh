@@ -40,6 +40,7 @@
 #ifndef __MEM_COMM_MONITOR_HH__
 #define __MEM_COMM_MONITOR_HH__
 
+#include "base/intmath.hh"
 #include "base/statistics.hh"
 #include "mem/port.hh"
 #include "params/CommMonitor.hh"
@@ -58,7 +59,9 @@ namespace gem5
  * outstanding read/write requests, read latency and inter transaction time
  * (read-read, write-write, read/write-read/write). Furthermore it allows
  * to capture the number of accesses to an address over time ("heat map").
- * All stats can be disabled from Python.
+ * All stats can be disabled from Python. To keep the overhead low, the
+ * per-packet distributions can be sampled for one in N requests, or
+ * disabled altogether to only keep the aggregate counters.
  */
 class CommMonitor : public SimObject
 {
@@ -99,9 +102,11 @@ class CommMonitor : public SimObject
          * calculate round-trip latency.
          *
          * @param _transmitTime Time of packet transmission
+         * @param _monitor The monitor that created the state
          */
-        CommMonitorSenderState(Tick _transmitTime)
-            : transmitTime(_transmitTime)
+        CommMonitorSenderState(Tick _transmitTime,
+                               const CommMonitor *_monitor)
+            : transmitTime(_transmitTime), monitor(_monitor)
         { }
 
         /** Destructor */
@@ -110,6 +115,12 @@ class CommMonitor : public SimObject
         /** Tick when request is transmitted */
         Tick transmitTime;
 
+        /**
+         * Monitor that created the state, as only sampled requests get
+         * one, and another monitor may have pushed the state on top.
+         */
+        const CommMonitor *monitor;
+
     };
 
     /**
@@ -275,12 +286,23 @@ class CommMonitor : public SimObject
         /** Disable flag for burst length histograms **/
         bool disableBurstLengthHists;
 
+        /**
+         * Whether the burst length and latency are sampled in fixed
+         * power-of-two buckets rather than in histograms, which need
+         * to grow and also keep the sum of logarithms of the samples.
+         */
+        const bool log2Hists;
+
         /** Histogram of read burst lengths */
         statistics::Histogram readBurstLengthHist;
 
         /** Histogram of write burst lengths */
         statistics::Histogram writeBurstLengthHist;
 
+        /** Log2 distributions of read and write burst lengths */
+        statistics::Distribution readBurstLengthLog2Dist;
+        statistics::Distribution writeBurstLengthLog2Dist;
+
         /** Disable flag for the bandwidth histograms */
         bool disableBandwidthHists;
 
@@ -311,6 +333,10 @@ class CommMonitor : public SimObject
         /** Histogram of write request-to-response latencies */
         statistics::Histogram writeLatencyHist;
 
+        /** Log2 distributions of read and write latencies */
+        statistics::Distribution readLatencyLog2Dist;
+        statistics::Distribution writeLatencyLog2Dist;
+
         /** Disable flag for ITT distributions. */
         bool disableITTDists;
 
@@ -386,12 +412,48 @@ class CommMonitor : public SimObject
         MonitorStats(statistics::Group *parent,
             const CommMonitorParams &params);
 
+        /**
+         * Update the stats of a request, or of a response.
+         *
+         * @param sampled Whether the per-packet distributions sample
+         *        this request (respectively the forwarded latency)
+         */
         void updateReqStats(const probing::PacketInfo& pkt, bool is_atomic,
-                            bool expects_response);
+                            bool expects_response, bool sampled);
         void updateRespStats(const probing::PacketInfo& pkt, Tick latency,
-                             bool is_atomic);
+                             bool is_atomic, bool sampled);
+
+        /**
+         * Get the bucket of a value in the log2 distributions: 0 for
+         * 0, and n + 1 for values in [2^n, 2^(n+1)).
+         */
+        static int
+        log2Bucket(uint64_t value)
+        {
+            return value ? floorLog2(value) + 1 : 0;
+        }
     };
 
+    /** Whether the next request is sampled, without consuming it. */
+    bool nextSampled() const { return sampleCount + 1 >= sampleEvery; }
+
+    /**
+     * Decide whether the per-packet distributions sample the next
+     * request, which is one in sampleEvery.
+     *
+     * @return Whether the next request is sampled
+     */
+    bool
+    sampleNext()
+    {
+        if (!nextSampled()) {
+            ++sampleCount;
+            return false;
+        }
+        sampleCount = 0;
+        return true;
+    }
+
     /** This function is called periodically at the end of each time bin */
     void samplePeriodic();
 
@@ -408,8 +470,14 @@ class CommMonitor : public SimObject
     /** Sample period in seconds */
     const double samplePeriod;
 
+    /** Number of requests per sample of the per-packet distributions */
+    const unsigned sampleEvery;
+
     /** @} */
 
+    /** Number of requests since the last sampled one */
+    unsigned sampleCount;
+
     /** Instantiate stats */
     MonitorStats stats;
 
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cxl_link.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/random.hh"
+#include "base/trace.hh"
+#include "debug/CXLLink.hh"
+#include "debug/Drain.hh"
+#include "params/CXLLink.hh"
+#include "sim/core.hh"
+
+namespace gem5
+{
+
+CXLLink::Channel::Channel(CXLLink &_link, const char *short_name,
+                          bool _to_mem, unsigned _credits,
+                          unsigned _buffer_size)
+    : link(_link), _name(_link.name() + "." + short_name), toMem(_to_mem),
+      credits(_credits), bufferSize(_buffer_size), linkFreeAt(0),
+      retryUpstream(false),
+      transmitEvent([this]{ transmit(); }, name() + ".transmit"),
+      deliverEvent([this]{ deliver(); }, name() + ".deliver"),
+      creditEvent([this]{ returnCredits(); }, name() + ".credit"),
+      stats(&_link, short_name, _link.flitSlots)
+{
+    fatal_if(credits == 0, "%s: the link needs at least one credit\n",
+             name());
+    fatal_if(bufferSize == 0, "%s: the buffer size must be at least 1\n",
+             name());
+}
+
+void
+CXLLink::Channel::send(PacketPtr pkt)
+{
+    assert(!full());
+
+    txQueue.push_back(pkt);
+
+    if (!transmitEvent.scheduled() && credits > 0)
+        link.schedule(transmitEvent, std::max(curTick(), linkFreeAt));
+}
+
+void
+CXLLink::Channel::transmit()
+{
+    assert(curTick() >= linkFreeAt);
+
+    Tick start = curTick();
+    unsigned slots = 0;
+    unsigned flits = 0;
+    unsigned count = 0;
+
+    while (!txQueue.empty() && credits > 0) {
+        PacketPtr pkt = txQueue.front();
+        txQueue.pop_front();
+        credits--;
+
+        slots += link.slotsFor(pkt);
+
+        // Open the flits holding the slots of this message, replaying
+        // the ones that fail their CRC check at the receiver
+        while (flits < divCeil(slots, link.flitSlots)) {
+            flits++;
+            if (link.flitErrorRate > 0 &&
+                random_mt.random<double>() < link.flitErrorRate) {
+                stats.replays++;
+                start += 2 * link.linkLatency + link.flitTicks;
+            }
+        }
+
+        // The receiver only forwards a message once the flit with its
+        // last slot has been checked
+        const Tick arrival = start + flits * link.flitTicks +
+            link.linkLatency;
+
+        DPRINTF(CXLLink, "%s: %s arrives at %d\n", name(), pkt->print(),
+                arrival);
+
+        rxQueue.push_back({pkt, arrival});
+        count++;
+    }
+
+    if (count == 0)
+        return;
+
+    linkFreeAt = start + flits * link.flitTicks;
+
+    stats.messages += count;
+    stats.flits += flits;
+    stats.slots += slots;
+    stats.batches++;
+
+    if (!txQueue.empty()) {
+        DPRINTF(CXLLink, "%s: out of credits, %d messages waiting\n",
+                name(), txQueue.size());
+        stats.creditStalls++;
+    }
+
+    if (!deliverEvent.scheduled())
+        link.schedule(deliverEvent, rxQueue.front().tick);
+
+    // we have made some space in the transmit queue, let the sender
+    // know if it is waiting for it
+    if (retryUpstream) {
+        retryUpstream = false;
+        if (toMem)
+            link.cpuSidePort.sendRetryReq();
+        else
+            link.memSidePort.sendRetryResp();
+    }
+}
+
+void
+CXLLink::Channel::deliver()
+{
+    while (!rxQueue.empty() && rxQueue.front().tick <= curTick()) {
+        PacketPtr pkt = rxQueue.front().pkt;
+
+        const bool sent = toMem ? link.memSidePort.sendTimingReq(pkt) :
+            link.cpuSidePort.sendTimingResp(pkt);
+
+        // if the send failed, then we try again once we receive a retry
+        if (!sent) {
+            DPRINTF(CXLLink, "%s: receiver busy, waiting for retry\n",
+                    name());
+            return;
+        }
+
+        rxQueue.pop_front();
+
+        // The credit is piggybacked on a flit going the other way
+        creditReturns.push_back(curTick() + link.linkLatency);
+        if (!creditEvent.scheduled())
+            link.schedule(creditEvent, creditReturns.front());
+    }
+
+    if (!rxQueue.empty() && !deliverEvent.scheduled())
+        link.schedule(deliverEvent, rxQueue.front().tick);
+
+    link.checkDrained();
+}
+
+void
+CXLLink::Channel::returnCredits()
+{
+    while (!creditReturns.empty() && creditReturns.front() <= curTick()) {
+        creditReturns.pop_front();
+        credits++;
+    }
+
+    if (!creditReturns.empty())
+        link.schedule(creditEvent, creditReturns.front());
+
+    if (!txQueue.empty() && !transmitEvent.scheduled())
+        link.schedule(transmitEvent, std::max(curTick(), linkFreeAt));
+
+    link.checkDrained();
+}
+
+bool
+CXLLink::Channel::empty() const
+{
+    return txQueue.empty() && rxQueue.empty() && creditReturns.empty();
+}
+
+bool
+CXLLink::Channel::trySatisfyFunctional(PacketPtr pkt) const
+{
+    for (auto *queued : txQueue) {
+        if (pkt->trySatisfyFunctional(queued))
+            return true;
+    }
+
+    for (const auto &deferred : rxQueue) {
+        if (pkt->trySatisfyFunctional(deferred.pkt))
+            return true;
+    }
+
+    return false;
+}
+
+CXLLink::Channel::ChannelStats::ChannelStats(statistics::Group *parent,
+                                             const char *name,
+                                             unsigned flit_slots)
+    : statistics::Group(parent, name),
+    ADD_STAT(messages, statistics::units::Count::get(),
+             "Number of messages sent"),
+    ADD_STAT(flits, statistics::units::Count::get(),
+             "Number of flits sent"),
+    ADD_STAT(slots, statistics::units::Count::get(),
+             "Number of flit slots used by messages"),
+    ADD_STAT(batches, statistics::units::Count::get(),
+             "Number of times messages were packed onto the link"),
+    ADD_STAT(replays, statistics::units::Count::get(),
+             "Number of flits replayed after a CRC error"),
+    ADD_STAT(creditStalls, statistics::units::Count::get(),
+             "Number of times the link ran out of credits"),
+    ADD_STAT(slotUtilization, statistics::units::Ratio::get(),
+             "Fraction of the flit slots carrying a message"),
+    ADD_STAT(avgBatchSize, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Count>::get(),
+             "Average number of messages sent per batch")
+{
+    slotUtilization.precision(4);
+    slotUtilization = slots / (flits * flit_slots);
+
+    avgBatchSize.precision(2);
+    avgBatchSize = messages / batches;
+}
+
+CXLLink::CpuSidePort::CpuSidePort(const std::string &_name, CXLLink &_link)
+    : ResponsePort(_name), link(_link)
+{
+}
+
+bool
+CXLLink::CpuSidePort::recvTimingReq(PacketPtr pkt)
+{
+    DPRINTF(CXLLink, "recvTimingReq: %s\n", pkt->print());
+
+    if (link.m2s.full()) {
+        DPRINTF(CXLLink, "Request buffer full\n");
+        link.m2s.stall();
+        return false;
+    }
+
+    // @todo: We need to pay for this and not just zero it out
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    link.m2s.send(pkt);
+    return true;
+}
+
+void
+CXLLink::CpuSidePort::recvRespRetry()
+{
+    link.s2m.deliver();
+}
+
+Tick
+CXLLink::CpuSidePort::recvAtomic(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    Tick latency = link.atomicLatency(pkt);
+    latency += link.memSidePort.sendAtomic(pkt);
+
+    if (pkt->isResponse())
+        latency += link.atomicLatency(pkt);
+
+    return latency;
+}
+
+void
+CXLLink::CpuSidePort::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // check the response channel first, then the request channel
+    if (link.s2m.trySatisfyFunctional(pkt) ||
+        link.m2s.trySatisfyFunctional(pkt)) {
+        pkt->popLabel();
+        pkt->makeResponse();
+        return;
+    }
+
+    pkt->popLabel();
+
+    link.memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+CXLLink::CpuSidePort::getAddrRanges() const
+{
+    return link.ranges;
+}
+
+CXLLink::MemSidePort::MemSidePort(const std::string &_name, CXLLink &_link)
+    : RequestPort(_name), link(_link)
+{
+}
+
+bool
+CXLLink::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    DPRINTF(CXLLink, "recvTimingResp: %s\n", pkt->print());
+
+    if (link.s2m.full()) {
+        DPRINTF(CXLLink, "Response buffer full\n");
+        link.s2m.stall();
+        return false;
+    }
+
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    link.s2m.send(pkt);
+    return true;
+}
+
+void
+CXLLink::MemSidePort::recvReqRetry()
+{
+    link.m2s.deliver();
+}
+
+CXLLink::CXLLink(const CXLLinkParams &p)
+    : ClockedObject(p),
+      cpuSidePort(name() + ".cpu_side_port", *this),
+      memSidePort(name() + ".mem_side_port", *this),
+      ranges(p.ranges.begin(), p.ranges.end()),
+      linkLatency(p.link_latency),
+      flitTicks(divCeil((p.flit_slots * p.slot_size + p.flit_overhead) * 8 *
+                        sim_clock::as_int::ns,
+                        uint64_t(p.num_lanes) * p.lane_speed)),
+      slotSize(p.slot_size),
+      flitSlots(p.flit_slots),
+      flitErrorRate(p.flit_error_rate),
+      m2s(*this, "m2s", true, p.req_credits, p.req_buffer_size),
+      s2m(*this, "s2m", false, p.resp_credits, p.resp_buffer_size)
+{
+    fatal_if(p.num_lanes == 0 || p.lane_speed == 0,
+             "%s: the link needs at least one lane and a speed\n", name());
+    fatal_if(slotSize == 0 || flitSlots == 0,
+             "%s: flits need at least one slot of at least one byte\n",
+             name());
+    fatal_if(flitErrorRate < 0 || flitErrorRate >= 1,
+             "%s: flit_error_rate must be in [0, 1)\n", name());
+}
+
+void
+CXLLink::init()
+{
+    // make sure both sides are connected
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Both ports of a CXL link must be connected.\n");
+
+    // notify the request side of our address ranges
+    cpuSidePort.sendRangeChange();
+}
+
+Port &
+CXLLink::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return memSidePort;
+    else if (if_name == "cpu_side_port")
+        return cpuSidePort;
+    else
+        // pass it along to our super class
+        return ClockedObject::getPort(if_name, idx);
+}
+
+unsigned
+CXLLink::slotsFor(PacketPtr pkt) const
+{
+    // one header slot, plus the data if the message carries any
+    return 1 + (pkt->hasData() ? divCeil(pkt->getSize(), slotSize) : 0);
+}
+
+Tick
+CXLLink::atomicLatency(PacketPtr pkt) const
+{
+    return linkLatency + divCeil(slotsFor(pkt), flitSlots) * flitTicks;
+}
+
+void
+CXLLink::checkDrained()
+{
+    if (drainState() == DrainState::Draining && m2s.empty() &&
+        s2m.empty()) {
+        DPRINTF(Drain, "CXLLink done draining, signaling drain manager\n");
+        signalDrainDone();
+    }
+}
+
+DrainState
+CXLLink::drain()
+{
+    return m2s.empty() && s2m.empty() ? DrainState::Drained :
+        DrainState::Draining;
+}
+
+} // namespace gem5
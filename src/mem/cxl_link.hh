@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a CXL.mem style link to a memory expander.
+ */
+
+#ifndef __MEM_CXL_LINK_HH__
+#define __MEM_CXL_LINK_HH__
+
+#include <deque>
+#include <string>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/port.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+struct CXLLinkParams;
+
+/**
+ * A link to a CXL Type-3 memory expander. Requests travel host to
+ * device (M2S) and responses device to host (S2M) on two independent
+ * channels. Each channel packs messages into fixed size flits made of
+ * slots: a message takes one header slot, plus enough slots for its
+ * data if it carries any. Messages are only sent when the receiver has
+ * a credit for them. Credits come back once the receiver has forwarded
+ * the message, after one link latency. Flits that fail their CRC check
+ * (flit_error_rate) are replayed, at the cost of a NAK round trip.
+ *
+ * To keep the simulation cost per byte low, the link is not simulated
+ * flit by flit. Whenever a channel is free, everything it has credits
+ * for is packed back to back in one go, and the arrival time of every
+ * message is computed from the flit that carries its last slot. One
+ * event then transmits a whole batch, and one event delivers all the
+ * messages that have arrived.
+ */
+class CXLLink : public ClockedObject
+{
+  private:
+
+    /** A message along with the tick it reaches the receiver. */
+    struct DeferredPacket
+    {
+        PacketPtr pkt;
+        Tick tick;
+    };
+
+    /** One direction of the link. */
+    class Channel
+    {
+      public:
+        Channel(CXLLink &_link, const char *short_name, bool _to_mem,
+                unsigned _credits, unsigned _buffer_size);
+
+        const std::string &name() const { return _name; }
+
+        /** Whether a new message can be queued for transmission. */
+        bool full() const { return txQueue.size() >= bufferSize; }
+
+        /** Queue a message to be sent across the link. */
+        void send(PacketPtr pkt);
+
+        /** Forward the messages that crossed the link. */
+        void deliver();
+
+        /** Remember that the sender must be told to retry. */
+        void stall() { retryUpstream = true; }
+
+        bool empty() const;
+
+        bool trySatisfyFunctional(PacketPtr pkt) const;
+
+      private:
+        CXLLink &link;
+        const std::string _name;
+
+        /** Requests flow to the memory, responses to the CPU. */
+        const bool toMem;
+
+        unsigned credits;
+        const unsigned bufferSize;
+
+        /** Messages waiting for the link or for a credit. */
+        std::deque<PacketPtr> txQueue;
+        /** Messages on the link or waiting to be forwarded. */
+        std::deque<DeferredPacket> rxQueue;
+        /** Ticks at which forwarded messages return their credit. */
+        std::deque<Tick> creditReturns;
+
+        /** The first tick the link is free to start a new flit. */
+        Tick linkFreeAt;
+
+        bool retryUpstream;
+
+        /** Pack all messages we have credits for into flits. */
+        void transmit();
+        void returnCredits();
+
+        EventFunctionWrapper transmitEvent;
+        EventFunctionWrapper deliverEvent;
+        EventFunctionWrapper creditEvent;
+
+      public:
+        struct ChannelStats : public statistics::Group
+        {
+            ChannelStats(statistics::Group *parent, const char *name,
+                         unsigned flit_slots);
+
+            statistics::Scalar messages;
+            statistics::Scalar flits;
+            statistics::Scalar slots;
+            statistics::Scalar batches;
+            statistics::Scalar replays;
+            statistics::Scalar creditStalls;
+            statistics::Formula slotUtilization;
+            statistics::Formula avgBatchSize;
+        } stats;
+    };
+
+    class CpuSidePort : public ResponsePort
+    {
+      public:
+        CpuSidePort(const std::string &_name, CXLLink &_link);
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+        CXLLink &link;
+    };
+
+    class MemSidePort : public RequestPort
+    {
+      public:
+        MemSidePort(const std::string &_name, CXLLink &_link);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvReqRetry() override;
+
+      private:
+        CXLLink &link;
+    };
+
+    CpuSidePort cpuSidePort;
+    MemSidePort memSidePort;
+
+    const AddrRangeList ranges;
+
+    /** One-way latency of the link. */
+    const Tick linkLatency;
+    /** Time to serialise one flit. */
+    const Tick flitTicks;
+    const unsigned slotSize;
+    const unsigned flitSlots;
+    const double flitErrorRate;
+
+    Channel m2s;
+    Channel s2m;
+
+    /** Number of flit slots a message takes. */
+    unsigned slotsFor(PacketPtr pkt) const;
+
+    /** Time for a message to cross the link on its own. */
+    Tick atomicLatency(PacketPtr pkt) const;
+
+    void checkDrained();
+
+  public:
+    CXLLink(const CXLLinkParams &p);
+
+    void init() override;
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    DrainState drain() override;
+};
+
+} // namespace gem5
+
+#endif //__MEM_CXL_LINK_HH__
@@ -0,0 +1,838 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_cache.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DRAMCache.hh"
+#include "debug/Drain.hh"
+#include "params/DRAMCache.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMCache::CpuSidePort::CpuSidePort(const std::string &_name,
+                                    DRAMCache &_cache)
+    : QueuedResponsePort(_name, queue),
+      cache(_cache), queue(_cache, *this)
+{
+}
+
+Tick
+DRAMCache::CpuSidePort::recvAtomic(PacketPtr pkt)
+{
+    return cache.recvAtomic(pkt);
+}
+
+void
+DRAMCache::CpuSidePort::recvFunctional(PacketPtr pkt)
+{
+    cache.recvFunctional(pkt);
+}
+
+bool
+DRAMCache::CpuSidePort::recvTimingReq(PacketPtr pkt)
+{
+    return cache.recvTimingReq(pkt);
+}
+
+AddrRangeList
+DRAMCache::CpuSidePort::getAddrRanges() const
+{
+    return cache.farMemPort.getAddrRanges();
+}
+
+DRAMCache::MemSidePort::MemSidePort(const std::string &_name,
+                                    DRAMCache &_cache, bool _far)
+    : QueuedRequestPort(_name, reqQueue, snoopRespQueue),
+      cache(_cache), far(_far),
+      reqQueue(_cache, *this), snoopRespQueue(_cache, *this)
+{
+}
+
+bool
+DRAMCache::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    // technically the packet only reaches us after the header delay,
+    // and typically we also need to deserialise any payload
+    const Tick when = curTick() + pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    cache.handleResponse(pkt, when);
+    return true;
+}
+
+void
+DRAMCache::MemSidePort::recvRangeChange()
+{
+    // Only the far memory is visible to the rest of the system
+    if (far)
+        cache.cpuSidePort.sendRangeChange();
+}
+
+DRAMCache::DRAMCache(const DRAMCacheParams &p)
+    : ClockedObject(p),
+      cpuSidePort(name() + ".cpu_side_port", *this),
+      nearMemPort(name() + ".near_mem_port", *this, false),
+      farMemPort(name() + ".far_mem_port", *this, true),
+      requestorId(p.system->getRequestorId(this)),
+      blkSize(p.block_size),
+      assoc(p.assoc),
+      numSets(p.assoc ? p.size / (p.block_size * p.assoc) : 0),
+      nearMemBase(p.near_mem_base),
+      tagsInDRAM(p.tags_in_dram),
+      tagLatency(p.tag_latency),
+      maxPending(p.max_pending),
+      writebackBatch(p.writeback_batch),
+      tags(numSets * assoc, 0),
+      lastUse(numSets * assoc, 0),
+      useCounter(0),
+      pendingTxns(0),
+      pendingWritebacks(0),
+      retryReq(false),
+      retryEvent([this]{ processRetryEvent(); }, name()),
+      stats(*this)
+{
+    fatal_if(!isPowerOf2(blkSize), "%s: block size %d is not a power "
+             "of 2\n", name(), blkSize);
+    fatal_if(assoc == 0, "%s: associativity must be at least 1\n", name());
+    fatal_if(numSets == 0 || !isPowerOf2(numSets),
+             "%s: size %d with %d ways of %d bytes must give a power of 2 "
+             "number of sets\n", name(), p.size, assoc, blkSize);
+    fatal_if(maxPending == 0, "%s: max_pending must be at least 1\n",
+             name());
+    fatal_if(writebackBatch == 0, "%s: writeback_batch must be at least "
+             "1\n", name());
+}
+
+void
+DRAMCache::init()
+{
+    if (!cpuSidePort.isConnected() || !nearMemPort.isConnected() ||
+        !farMemPort.isConnected())
+        fatal("%s: all ports must be connected.\n", name());
+
+    cpuSidePort.sendRangeChange();
+}
+
+Port &
+DRAMCache::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "cpu_side_port") {
+        return cpuSidePort;
+    } else if (if_name == "near_mem_port") {
+        return nearMemPort;
+    } else if (if_name == "far_mem_port") {
+        return farMemPort;
+    } else {
+        return ClockedObject::getPort(if_name, idx);
+    }
+}
+
+unsigned
+DRAMCache::findWay(uint64_t set, Addr blk_addr) const
+{
+    const uint64_t blk = blk_addr / blkSize;
+    for (unsigned way = 0; way < assoc; way++) {
+        const uint64_t tag = tags[set * assoc + way];
+        if ((tag & TagValid) && (tag & TagBlkMask) == blk)
+            return way;
+    }
+    return assoc;
+}
+
+unsigned
+DRAMCache::findVictim(uint64_t set) const
+{
+    unsigned victim = 0;
+    for (unsigned way = 0; way < assoc; way++) {
+        const unsigned idx = set * assoc + way;
+        if (!(tags[idx] & TagValid))
+            return way;
+        // Compare stamps relative to each other to survive wrap-around
+        if (int32_t(lastUse[idx] - lastUse[set * assoc + victim]) < 0)
+            victim = way;
+    }
+    return victim;
+}
+
+void
+DRAMCache::touch(uint64_t set, unsigned way)
+{
+    lastUse[set * assoc + way] = ++useCounter;
+}
+
+DRAMCache::WritebackEntry *
+DRAMCache::findWriteback(Addr blk_addr)
+{
+    auto it = std::find_if(writebackBuffer.begin(), writebackBuffer.end(),
+        [blk_addr](const WritebackEntry &wb)
+        { return wb.blkAddr == blk_addr; });
+    return it == writebackBuffer.end() ? nullptr : &*it;
+}
+
+PacketPtr
+DRAMCache::createPacket(Addr addr, unsigned size, MemCmd cmd,
+                        Transaction *txn, AccessState::Step step)
+{
+    RequestPtr req = Request::make(addr, size, 0, requestorId);
+    PacketPtr pkt = new Packet(req, cmd);
+    pkt->allocate();
+    pkt->pushSenderState(new AccessState(txn, step));
+    return pkt;
+}
+
+Tick
+DRAMCache::sendAtomicAccess(MemSidePort &port, Addr addr, unsigned size,
+                            MemCmd cmd, uint8_t *data, const PacketPtr orig)
+{
+    RequestPtr req = Request::make(addr, size, 0, requestorId);
+    if (orig && orig->isMaskedWrite())
+        req->setByteEnable(orig->req->getByteEnable());
+    Packet pkt(req, cmd);
+    pkt.dataStatic(data);
+    return port.sendAtomic(&pkt);
+}
+
+void
+DRAMCache::sendFunctionalAccess(MemSidePort &port, Addr addr, MemCmd cmd,
+                                uint8_t *data)
+{
+    RequestPtr req = Request::make(addr, blkSize, 0, requestorId);
+    Packet pkt(req, cmd);
+    pkt.dataStatic(data);
+    port.sendFunctional(&pkt);
+}
+
+bool
+DRAMCache::recvTimingReq(PacketPtr pkt)
+{
+    DPRINTF(DRAMCache, "recvTimingReq: %s\n", pkt->print());
+
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see reads and writes at a DRAM cache\n");
+
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+    panic_if(pkt->getAddr() + pkt->getSize() > blk_addr + blkSize,
+             "%s: %s crosses a %d byte block\n", name(), pkt->print(),
+             blkSize);
+
+    pendingDelete.reset();
+
+    if (pendingTxns >= maxPending) {
+        DPRINTF(DRAMCache, "Too many pending requests, not accepting\n");
+        retryReq = true;
+        stats.numRetries++;
+        return false;
+    }
+
+    const Tick when = curTick() + pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    auto *txn = new Transaction{pkt, blk_addr, setOf(blk_addr), 0, false,
+                                {}, false, {}};
+    pendingTxns++;
+
+    auto it = busySets.find(txn->set);
+    if (it != busySets.end()) {
+        DPRINTF(DRAMCache, "Set %#x busy, queueing %s\n", txn->set,
+                pkt->print());
+        stats.blockedSetAccesses++;
+        it->second.second.push_back(txn);
+        return true;
+    }
+
+    busySets.emplace(txn->set,
+                     std::make_pair(txn, std::deque<Transaction *>()));
+    startTransaction(txn, when);
+    return true;
+}
+
+void
+DRAMCache::startTransaction(Transaction *txn, Tick when)
+{
+    PacketPtr pkt = txn->pkt;
+
+    // A dirty block we just evicted may still be waiting in the
+    // write-back buffer, in which case it is the only valid copy
+    if (WritebackEntry *wb = findWriteback(txn->blkAddr)) {
+        DPRINTF(DRAMCache, "Write-back buffer hit for %s\n", pkt->print());
+        stats.writebackBufferHits++;
+        if (pkt->isRead())
+            pkt->setDataFromBlock(wb->data.data(), blkSize);
+        else
+            pkt->writeDataToBlock(wb->data.data(), blkSize);
+        respond(txn, when + cyclesToTicks(tagLatency));
+        finishTransaction(txn);
+        return;
+    }
+
+    txn->way = findWay(txn->set, txn->blkAddr);
+    txn->hit = txn->way != assoc;
+
+    if (tagsInDRAM) {
+        // The tag is read together with the data of the probed way:
+        // the way we hit in, or the victim on a miss
+        const unsigned way = txn->hit ? txn->way : findVictim(txn->set);
+        PacketPtr probe = createPacket(nearAddr(txn->set, way), blkSize,
+                                       MemCmd::ReadReq, txn,
+                                       AccessState::Probe);
+        nearMemPort.schedTimingReq(probe, when);
+    } else {
+        handleLookup(txn, when + cyclesToTicks(tagLatency));
+    }
+}
+
+void
+DRAMCache::handleLookup(Transaction *txn, Tick when)
+{
+    PacketPtr pkt = txn->pkt;
+
+    DPRINTF(DRAMCache, "%s %s\n", txn->hit ? "Hit" : "Miss", pkt->print());
+
+    if (txn->hit) {
+        touch(txn->set, txn->way);
+
+        const Addr addr = nearAddr(txn->set, txn->way) +
+            pkt->getOffset(blkSize);
+
+        if (pkt->isRead()) {
+            stats.readHits++;
+            nearMemPort.schedTimingReq(
+                createPacket(addr, pkt->getSize(), MemCmd::ReadReq, txn,
+                             AccessState::NearRead), when);
+        } else {
+            stats.writeHits++;
+            PacketPtr wr = createPacket(addr, pkt->getSize(),
+                                        MemCmd::WriteReq, txn,
+                                        AccessState::NearWrite);
+            if (pkt->isMaskedWrite())
+                wr->req->setByteEnable(pkt->req->getByteEnable());
+            wr->setData(pkt->getConstPtr<uint8_t>());
+            tagOf(txn->set, txn->way) |= TagDirty;
+            nearMemPort.schedTimingReq(wr, when);
+            respond(txn, when);
+        }
+    } else if (pkt->isRead()) {
+        stats.readMisses++;
+        farMemPort.schedTimingReq(
+            createPacket(txn->blkAddr, blkSize, MemCmd::ReadReq, txn,
+                         AccessState::FarRead), when);
+    } else if (pkt->getSize() == blkSize && !pkt->isMaskedWrite()) {
+        // Full block writes allocate without fetching the block
+        stats.writeMisses++;
+        txn->data.resize(blkSize);
+        pkt->writeDataToBlock(txn->data.data(), blkSize);
+        txn->fillDirty = true;
+        respond(txn, when);
+        allocate(txn, when);
+    } else {
+        // Partial writes that miss go straight to the far memory
+        stats.writeMisses++;
+        RequestPtr req = Request::make(*pkt->req);
+        PacketPtr wr = new Packet(req, MemCmd::WriteReq);
+        wr->allocate();
+        wr->setData(pkt->getConstPtr<uint8_t>());
+        wr->pushSenderState(new AccessState(txn, AccessState::FarWrite));
+        farMemPort.schedTimingReq(wr, when);
+        respond(txn, when);
+    }
+}
+
+void
+DRAMCache::allocate(Transaction *txn, Tick when)
+{
+    txn->way = findVictim(txn->set);
+
+    const uint64_t victim = tagOf(txn->set, txn->way);
+    if ((victim & TagValid) && (victim & TagDirty)) {
+        const Addr victim_addr = (victim & TagBlkMask) * blkSize;
+        if (txn->victimData.empty()) {
+            // Read the victim before the fill overwrites it
+            nearMemPort.schedTimingReq(
+                createPacket(nearAddr(txn->set, txn->way), blkSize,
+                             MemCmd::ReadReq, txn,
+                             AccessState::VictimRead), when);
+            return;
+        }
+        queueWriteback(victim_addr, std::move(txn->victimData));
+    }
+
+    issueFill(txn, when);
+}
+
+void
+DRAMCache::issueFill(Transaction *txn, Tick when)
+{
+    DPRINTF(DRAMCache, "Fill %#x into set %#x way %d\n", txn->blkAddr,
+            txn->set, txn->way);
+
+    stats.fills++;
+
+    tagOf(txn->set, txn->way) = TagValid |
+        (txn->fillDirty ? TagDirty : 0) | (txn->blkAddr / blkSize);
+    touch(txn->set, txn->way);
+
+    PacketPtr fill = createPacket(nearAddr(txn->set, txn->way), blkSize,
+                                  MemCmd::WriteReq, txn, AccessState::Fill);
+    fill->setData(txn->data.data());
+    nearMemPort.schedTimingReq(fill, when);
+}
+
+void
+DRAMCache::respond(Transaction *txn, Tick when)
+{
+    PacketPtr pkt = txn->pkt;
+    if (!pkt)
+        return;
+    txn->pkt = nullptr;
+
+    if (pkt->needsResponse()) {
+        pkt->makeResponse();
+        cpuSidePort.schedTimingResp(pkt, when);
+    } else {
+        // queue the packet for deletion
+        pendingDelete.reset(pkt);
+    }
+}
+
+void
+DRAMCache::finishTransaction(Transaction *txn)
+{
+    assert(!txn->pkt);
+
+    auto it = busySets.find(txn->set);
+    assert(it != busySets.end() && it->second.first == txn);
+
+    delete txn;
+    pendingTxns--;
+
+    if (retryReq && !retryEvent.scheduled())
+        schedule(retryEvent, curTick());
+
+    auto &waiting = it->second.second;
+    if (waiting.empty()) {
+        busySets.erase(it);
+    } else {
+        Transaction *next = waiting.front();
+        waiting.pop_front();
+        it->second.first = next;
+        startTransaction(next, curTick());
+    }
+
+    // Use idle periods to write back the dirty victims
+    if (pendingTxns == 0)
+        flushWritebacks();
+
+    checkDrained();
+}
+
+void
+DRAMCache::processRetryEvent()
+{
+    if (retryReq && pendingTxns < maxPending) {
+        retryReq = false;
+        cpuSidePort.sendRetryReq();
+    }
+}
+
+void
+DRAMCache::handleResponse(PacketPtr pkt, Tick when)
+{
+    auto *state = safe_cast<AccessState *>(pkt->popSenderState());
+    Transaction *txn = state->txn;
+    const AccessState::Step step = state->step;
+    delete state;
+
+    DPRINTF(DRAMCache, "handleResponse: step %d %s\n", step, pkt->print());
+
+    switch (step) {
+      case AccessState::Probe:
+        if (txn->hit && txn->pkt->isRead()) {
+            // The probe already returned the data we are after
+            stats.readHits++;
+            touch(txn->set, txn->way);
+            txn->pkt->setDataFromBlock(pkt->getConstPtr<uint8_t>(),
+                                       blkSize);
+            respond(txn, when);
+            finishTransaction(txn);
+        } else {
+            if (!txn->hit) {
+                const uint8_t *data = pkt->getConstPtr<uint8_t>();
+                txn->victimData.assign(data, data + blkSize);
+            }
+            handleLookup(txn, when);
+        }
+        break;
+
+      case AccessState::NearRead:
+        txn->pkt->setData(pkt->getConstPtr<uint8_t>());
+        respond(txn, when);
+        finishTransaction(txn);
+        break;
+
+      case AccessState::FarRead: {
+          const uint8_t *data = pkt->getConstPtr<uint8_t>();
+          txn->data.assign(data, data + blkSize);
+          txn->pkt->setDataFromBlock(data, blkSize);
+          respond(txn, when);
+          allocate(txn, when);
+          break;
+      }
+
+      case AccessState::VictimRead: {
+          const uint64_t victim = tagOf(txn->set, txn->way);
+          const uint8_t *data = pkt->getConstPtr<uint8_t>();
+          queueWriteback((victim & TagBlkMask) * blkSize,
+                         std::vector<uint8_t>(data, data + blkSize));
+          issueFill(txn, when);
+          break;
+      }
+
+      case AccessState::NearWrite:
+      case AccessState::FarWrite:
+      case AccessState::Fill:
+        finishTransaction(txn);
+        break;
+
+      case AccessState::Writeback:
+        assert(pendingWritebacks > 0);
+        pendingWritebacks--;
+        checkDrained();
+        break;
+    }
+
+    delete pkt;
+}
+
+void
+DRAMCache::queueWriteback(Addr blk_addr, std::vector<uint8_t> &&data)
+{
+    DPRINTF(DRAMCache, "Queue write-back of %#x\n", blk_addr);
+
+    writebackBuffer.push_back({blk_addr, std::move(data)});
+
+    if (writebackBuffer.size() >= writebackBatch)
+        flushWritebacks();
+}
+
+void
+DRAMCache::flushWritebacks()
+{
+    if (writebackBuffer.empty())
+        return;
+
+    DPRINTF(DRAMCache, "Writing back %d blocks\n", writebackBuffer.size());
+
+    stats.writebackBatches++;
+
+    for (auto &wb : writebackBuffer) {
+        PacketPtr pkt = createPacket(wb.blkAddr, blkSize, MemCmd::WriteReq,
+                                     nullptr, AccessState::Writeback);
+        pkt->setData(wb.data.data());
+        farMemPort.schedTimingReq(pkt, curTick());
+        pendingWritebacks++;
+        stats.writebacks++;
+    }
+
+    writebackBuffer.clear();
+}
+
+Tick
+DRAMCache::recvAtomic(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see reads and writes at a DRAM cache\n");
+
+    // switching to atomic mode requires draining
+    assert(isIdle());
+
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+    panic_if(pkt->getAddr() + pkt->getSize() > blk_addr + blkSize,
+             "%s: %s crosses a %d byte block\n", name(), pkt->print(),
+             blkSize);
+
+    const uint64_t set = setOf(blk_addr);
+    const unsigned way = findWay(set, blk_addr);
+    std::vector<uint8_t> data(blkSize);
+
+    Tick latency = tagsInDRAM ? 0 : cyclesToTicks(tagLatency);
+
+    // In Alloy mode, a read hit is served by the tag probe itself
+    if (tagsInDRAM && !(way != assoc && pkt->isRead())) {
+        latency += sendAtomicAccess(nearMemPort,
+                                    nearAddr(set, way != assoc ? way :
+                                             findVictim(set)),
+                                    blkSize, MemCmd::ReadReq, data.data());
+    }
+
+    if (way != assoc) {
+        touch(set, way);
+        const Addr addr = nearAddr(set, way) + pkt->getOffset(blkSize);
+        if (pkt->isRead()) {
+            stats.readHits++;
+            latency += sendAtomicAccess(nearMemPort, addr, pkt->getSize(),
+                                        MemCmd::ReadReq,
+                                        pkt->getPtr<uint8_t>());
+        } else {
+            stats.writeHits++;
+            latency += sendAtomicAccess(nearMemPort, addr, pkt->getSize(),
+                                        MemCmd::WriteReq,
+                                        pkt->getPtr<uint8_t>(), pkt);
+            tagOf(set, way) |= TagDirty;
+        }
+    } else if (pkt->isRead()) {
+        stats.readMisses++;
+        latency += sendAtomicAccess(farMemPort, blk_addr, blkSize,
+                                    MemCmd::ReadReq, data.data());
+        pkt->setDataFromBlock(data.data(), blkSize);
+        atomicFill(set, blk_addr, data.data(), false);
+    } else if (pkt->getSize() == blkSize && !pkt->isMaskedWrite()) {
+        stats.writeMisses++;
+        pkt->writeDataToBlock(data.data(), blkSize);
+        atomicFill(set, blk_addr, data.data(), true);
+    } else {
+        stats.writeMisses++;
+        latency += sendAtomicAccess(farMemPort, pkt->getAddr(),
+                                    pkt->getSize(), MemCmd::WriteReq,
+                                    pkt->getPtr<uint8_t>(), pkt);
+    }
+
+    if (pkt->needsResponse())
+        pkt->makeResponse();
+
+    return latency;
+}
+
+void
+DRAMCache::atomicFill(uint64_t set, Addr blk_addr, uint8_t *data,
+                      bool dirty)
+{
+    // Fills are off the critical path, so their latency is not
+    // accounted for
+    const unsigned way = findVictim(set);
+    const uint64_t victim = tagOf(set, way);
+
+    if ((victim & TagValid) && (victim & TagDirty)) {
+        std::vector<uint8_t> victim_data(blkSize);
+        sendAtomicAccess(nearMemPort, nearAddr(set, way), blkSize,
+                         MemCmd::ReadReq, victim_data.data());
+        sendAtomicAccess(farMemPort, (victim & TagBlkMask) * blkSize,
+                         blkSize, MemCmd::WriteReq, victim_data.data());
+        stats.writebacks++;
+    }
+
+    sendAtomicAccess(nearMemPort, nearAddr(set, way), blkSize,
+                     MemCmd::WriteReq, data);
+    stats.fills++;
+
+    tagOf(set, way) = TagValid | (dirty ? TagDirty : 0) |
+        (blk_addr / blkSize);
+    touch(set, way);
+}
+
+void
+DRAMCache::recvFunctional(PacketPtr pkt)
+{
+    if (cpuSidePort.trySatisfyFunctional(pkt)) {
+        pkt->makeResponse();
+        return;
+    }
+
+    if (pkt->isPrint()) {
+        farMemPort.sendFunctional(pkt);
+        return;
+    }
+
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+    panic_if(pkt->getAddr() + pkt->getSize() > blk_addr + blkSize,
+             "%s: %s crosses a %d byte block\n", name(), pkt->print(),
+             blkSize);
+
+    const uint64_t set = setOf(blk_addr);
+
+    // Block data held by an in-flight fill
+    auto busy = busySets.find(set);
+    if (busy != busySets.end()) {
+        Transaction *txn = busy->second.first;
+        if (txn->blkAddr == blk_addr && !txn->data.empty() &&
+            pkt->trySatisfyFunctional(nullptr, blk_addr, pkt->isSecure(),
+                                      blkSize, txn->data.data())) {
+            pkt->makeResponse();
+            return;
+        }
+    }
+
+    // Evicted blocks not written back yet
+    if (WritebackEntry *wb = findWriteback(blk_addr)) {
+        if (pkt->trySatisfyFunctional(nullptr, blk_addr, pkt->isSecure(),
+                                      blkSize, wb->data.data())) {
+            pkt->makeResponse();
+            return;
+        }
+    }
+
+    // Write-backs and partial writes on their way to the far memory
+    if (farMemPort.trySatisfyFunctional(pkt)) {
+        pkt->makeResponse();
+        return;
+    }
+
+    const unsigned way = findWay(set, blk_addr);
+    if (way != assoc) {
+        const Addr addr = nearAddr(set, way) + pkt->getOffset(blkSize);
+        RequestPtr req = Request::make(addr, pkt->getSize(), 0,
+                                       requestorId);
+        Packet near_pkt(req, pkt->cmd);
+        near_pkt.dataStatic(pkt->getPtr<uint8_t>());
+        if (!nearMemPort.trySatisfyFunctional(&near_pkt))
+            nearMemPort.sendFunctional(&near_pkt);
+
+        if (pkt->isRead()) {
+            pkt->makeResponse();
+            return;
+        }
+    }
+
+    // Writes also update the far memory so that clean blocks stay clean
+    farMemPort.sendFunctional(pkt);
+}
+
+bool
+DRAMCache::isIdle() const
+{
+    return pendingTxns == 0 && writebackBuffer.empty() &&
+        pendingWritebacks == 0;
+}
+
+void
+DRAMCache::checkDrained()
+{
+    if (drainState() != DrainState::Draining)
+        return;
+
+    flushWritebacks();
+
+    if (isIdle()) {
+        DPRINTF(Drain, "DRAMCache done draining, signaling drain manager\n");
+        signalDrainDone();
+    }
+}
+
+DrainState
+DRAMCache::drain()
+{
+    flushWritebacks();
+
+    if (!isIdle()) {
+        DPRINTF(Drain, "DRAMCache not drained\n");
+        return DrainState::Draining;
+    }
+
+    return DrainState::Drained;
+}
+
+void
+DRAMCache::memWriteback()
+{
+    std::vector<uint8_t> data(blkSize);
+
+    for (uint64_t set = 0; set < numSets; set++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            uint64_t &tag = tagOf(set, way);
+            if (!(tag & TagValid) || !(tag & TagDirty))
+                continue;
+
+            sendFunctionalAccess(nearMemPort, nearAddr(set, way),
+                                 MemCmd::ReadReq, data.data());
+            sendFunctionalAccess(farMemPort, (tag & TagBlkMask) * blkSize,
+                                 MemCmd::WriteReq, data.data());
+            tag &= ~TagDirty;
+        }
+    }
+
+    for (auto &wb : writebackBuffer) {
+        sendFunctionalAccess(farMemPort, wb.blkAddr, MemCmd::WriteReq,
+                             wb.data.data());
+    }
+    writebackBuffer.clear();
+}
+
+void
+DRAMCache::memInvalidate()
+{
+    std::fill(tags.begin(), tags.end(), 0);
+}
+
+DRAMCache::DRAMCacheStats::DRAMCacheStats(DRAMCache &cache)
+    : statistics::Group(&cache),
+    ADD_STAT(readHits, statistics::units::Count::get(),
+             "Number of read hits"),
+    ADD_STAT(readMisses, statistics::units::Count::get(),
+             "Number of read misses"),
+    ADD_STAT(writeHits, statistics::units::Count::get(),
+             "Number of write hits"),
+    ADD_STAT(writeMisses, statistics::units::Count::get(),
+             "Number of write misses"),
+    ADD_STAT(writebackBufferHits, statistics::units::Count::get(),
+             "Number of accesses served by the write-back buffer"),
+    ADD_STAT(blockedSetAccesses, statistics::units::Count::get(),
+             "Number of accesses that waited for a busy set"),
+    ADD_STAT(fills, statistics::units::Count::get(),
+             "Number of blocks filled into the near memory"),
+    ADD_STAT(writebacks, statistics::units::Count::get(),
+             "Number of dirty blocks written back to the far memory"),
+    ADD_STAT(writebackBatches, statistics::units::Count::get(),
+             "Number of write-back batches sent to the far memory"),
+    ADD_STAT(numRetries, statistics::units::Count::get(),
+             "Number of times a request was refused"),
+    ADD_STAT(hitRate, statistics::units::Ratio::get(),
+             "Hit rate of the DRAM cache")
+{
+    hitRate.precision(4);
+    hitRate = (readHits + writeHits) /
+        (readHits + writeHits + readMisses + writeMisses);
+}
+
+} // namespace memory
+} // namespace gem5
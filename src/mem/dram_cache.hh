@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * DRAMCache declaration
+ */
+
+#ifndef __MEM_DRAM_CACHE_HH__
+#define __MEM_DRAM_CACHE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/packet.hh"
+#include "mem/qport.hh"
+#include "mem/request.hh"
+#include "sim/clocked_object.hh"
+
+namespace gem5
+{
+
+struct DRAMCacheParams;
+
+namespace memory
+{
+
+/**
+ * A memory-side cache that uses a fast (near) memory, e.g. DRAM or
+ * HBM, to cache blocks of a slower (far) memory such as NVM or CXL
+ * attached memory. The component sits between the memory bus and two
+ * memory controllers and only keeps tags: the cached data lives in the
+ * near memory, at near_mem_base + (set * assoc + way) * block_size.
+ *
+ * Tags are either held in SRAM, in which case the hit/miss decision is
+ * known after tag_latency, or alongside the data in the near memory
+ * (Alloy cache style). In the latter case every access starts with a
+ * probe burst to the near memory that returns both the tag and the
+ * data, so read hits are served by the probe itself and misses pay for
+ * the probe before going to the far memory.
+ *
+ * Reads and full-block writes allocate, partial writes that miss are
+ * sent to the far memory. Dirty victims are collected in a write-back
+ * buffer and written to the far memory in batches, or as soon as the
+ * cache is idle. Accesses to the same set are serialised, which
+ * removes all hazards between fills, victims and new requests.
+ */
+class DRAMCache : public ClockedObject
+{
+  private:
+
+    /** A request in flight through the cache. */
+    struct Transaction
+    {
+        /** The original request, nullptr once it has been answered. */
+        PacketPtr pkt;
+        Addr blkAddr;
+        uint64_t set;
+        /** Way the block hits in, or the way it is filled into. */
+        unsigned way;
+        bool hit;
+        /** Block data to fill into the near memory, if any. */
+        std::vector<uint8_t> data;
+        /** Whether the filled block must be marked dirty. */
+        bool fillDirty;
+        /** Victim data already read by a tag probe, if any. */
+        std::vector<uint8_t> victimData;
+    };
+
+    /** Identify what a near or far memory response belongs to. */
+    struct AccessState : public Packet::SenderState
+    {
+        enum Step
+        {
+            Probe,
+            NearRead,
+            NearWrite,
+            FarRead,
+            FarWrite,
+            VictimRead,
+            Fill,
+            Writeback
+        };
+
+        Transaction *txn;
+        Step step;
+
+        AccessState(Transaction *_txn, Step _step) : txn(_txn), step(_step)
+        {}
+    };
+
+    /** A dirty victim waiting to be written to the far memory. */
+    struct WritebackEntry
+    {
+        Addr blkAddr;
+        std::vector<uint8_t> data;
+    };
+
+    class CpuSidePort : public QueuedResponsePort
+    {
+      public:
+        CpuSidePort(const std::string &_name, DRAMCache &_cache);
+
+      protected:
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        bool recvTimingReq(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+        DRAMCache &cache;
+        RespPacketQueue queue;
+    };
+
+    class MemSidePort : public QueuedRequestPort
+    {
+      public:
+        MemSidePort(const std::string &_name, DRAMCache &_cache,
+                    bool _far);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvRangeChange() override;
+
+      private:
+        DRAMCache &cache;
+        const bool far;
+        ReqPacketQueue reqQueue;
+        SnoopRespPacketQueue snoopRespQueue;
+    };
+
+    CpuSidePort cpuSidePort;
+    MemSidePort nearMemPort;
+    MemSidePort farMemPort;
+
+    const RequestorID requestorId;
+
+    const unsigned blkSize;
+    const unsigned assoc;
+    const uint64_t numSets;
+    const Addr nearMemBase;
+    const bool tagsInDRAM;
+    const Cycles tagLatency;
+    const unsigned maxPending;
+    const unsigned writebackBatch;
+
+    /**
+     * Compact tag store: one word per block holding the valid and
+     * dirty bits and the block number, plus a last-use stamp for LRU
+     * replacement within a set.
+     */
+    std::vector<uint64_t> tags;
+    std::vector<uint32_t> lastUse;
+    uint32_t useCounter;
+
+    static constexpr uint64_t TagValid = 1ULL << 63;
+    static constexpr uint64_t TagDirty = 1ULL << 62;
+    static constexpr uint64_t TagBlkMask = TagDirty - 1;
+
+    /**
+     * Sets with a transaction in flight, and the transactions waiting
+     * for that set to become available.
+     */
+    std::unordered_map<uint64_t,
+                       std::pair<Transaction *, std::deque<Transaction *>>>
+        busySets;
+
+    std::deque<WritebackEntry> writebackBuffer;
+
+    /** Number of accepted requests that have not completed yet. */
+    unsigned pendingTxns;
+    /** Number of write-backs sent to the far memory and not acked. */
+    unsigned pendingWritebacks;
+    /** Whether we owe the CPU side a retry. */
+    bool retryReq;
+
+    /** Send a retry once a transaction slot frees up. */
+    void processRetryEvent();
+    EventFunctionWrapper retryEvent;
+
+    /**
+     * Requests that do not need a response are deleted on the next
+     * request, as the sender may still look at them when
+     * recvTimingReq() returns.
+     */
+    std::unique_ptr<Packet> pendingDelete;
+
+    uint64_t setOf(Addr blk_addr) const
+    { return (blk_addr / blkSize) & (numSets - 1); }
+
+    Addr nearAddr(uint64_t set, unsigned way) const
+    { return nearMemBase + (set * assoc + way) * blkSize; }
+
+    uint64_t &tagOf(uint64_t set, unsigned way)
+    { return tags[set * assoc + way]; }
+
+    /** @return The way holding blk_addr, or assoc on a miss. */
+    unsigned findWay(uint64_t set, Addr blk_addr) const;
+    unsigned findVictim(uint64_t set) const;
+    void touch(uint64_t set, unsigned way);
+
+    WritebackEntry *findWriteback(Addr blk_addr);
+
+    PacketPtr createPacket(Addr addr, unsigned size, MemCmd cmd,
+                           Transaction *txn, AccessState::Step step);
+
+    /** Access memory behind one of our ports in atomic mode. */
+    Tick sendAtomicAccess(MemSidePort &port, Addr addr, unsigned size,
+                          MemCmd cmd, uint8_t *data,
+                          const PacketPtr orig=nullptr);
+    /** Access memory behind one of our ports functionally. */
+    void sendFunctionalAccess(MemSidePort &port, Addr addr, MemCmd cmd,
+                              uint8_t *data);
+    /** Fill a block in atomic mode, writing back the victim if dirty. */
+    void atomicFill(uint64_t set, Addr blk_addr, uint8_t *data,
+                    bool dirty);
+
+    /** Start servicing a transaction that owns its set. */
+    void startTransaction(Transaction *txn, Tick when);
+    /** Act on the outcome of the tag lookup. */
+    void handleLookup(Transaction *txn, Tick when);
+    /** Evict the victim if needed, then fill the block. */
+    void allocate(Transaction *txn, Tick when);
+    void issueFill(Transaction *txn, Tick when);
+    void respond(Transaction *txn, Tick when);
+    void finishTransaction(Transaction *txn);
+
+    void handleResponse(PacketPtr pkt, Tick when);
+
+    void queueWriteback(Addr blk_addr, std::vector<uint8_t> &&data);
+    void flushWritebacks();
+
+    Tick recvAtomic(PacketPtr pkt);
+    void recvFunctional(PacketPtr pkt);
+    bool recvTimingReq(PacketPtr pkt);
+
+    bool isIdle() const;
+    void checkDrained();
+
+    struct DRAMCacheStats : public statistics::Group
+    {
+        DRAMCacheStats(DRAMCache &cache);
+
+        statistics::Scalar readHits;
+        statistics::Scalar readMisses;
+        statistics::Scalar writeHits;
+        statistics::Scalar writeMisses;
+        statistics::Scalar writebackBufferHits;
+        statistics::Scalar blockedSetAccesses;
+        statistics::Scalar fills;
+        statistics::Scalar writebacks;
+        statistics::Scalar writebackBatches;
+        statistics::Scalar numRetries;
+        statistics::Formula hitRate;
+    } stats;
+
+  public:
+    DRAMCache(const DRAMCacheParams &p);
+
+    void init() override;
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    DrainState drain() override;
+
+    void memWriteback() override;
+    void memInvalidate() override;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_DRAM_CACHE_HH__
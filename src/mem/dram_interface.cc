@@ -59,116 +59,119 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
+    // The oldest packet, and the tick its burst is allowed at, amongst:
+    // the row hits that can issue seamlessly, without additional delay,
+    // such as same rank accesses and/or different bank-group accesses
+    const MemPacketQueue::Entry *seamless_hit = nullptr;
+    Tick seamless_col_at = MaxTick;
+    // the other row hits, to banks that are prepped and ready
+    const MemPacketQueue::Entry *prepped_hit = nullptr;
+    Tick prepped_col_at = MaxTick;
+    // the packets to closed rows, in the banks that can be prepared the
+    // earliest
+    const MemPacketQueue::Entry *earliest_pkt = nullptr;
+    Tick earliest_col_at = MaxTick;
+
+    // are there packets to closed rows in the ranks that are available?
+    bool got_conflict = false;
+
+    // search the row hits first, FCFS within the hits, taking the bank
+    // queues rather than the individual packets into account
+    for (int i = 0; i < ranksPerChannel; i++) {
+        // check if rank is not doing a refresh and thus is available,
+        // if not, jump to the next rank
+        if (!ranks[i]->inRefIdleState()) {
+            DPRINTF(DRAM, "%s Rank %d not available\n", __func__, i);
+            continue;
+        }
 
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
+        for (int j = 0; j < banksPerRank; j++) {
+            const auto *bank_queue =
+                queue.bankQueue(true, pseudoChannel, i * banksPerRank + j);
+            if (!bank_queue)
+                continue;
+
+            const Bank& bank = ranks[i]->banks[j];
+            const auto *row_queue = bank_queue->rowQueue(bank.openRow);
+
+            DPRINTF(DRAM, "%s checking %d DRAM packets in bank %d, rank %d\n",
+                    __func__, bank_queue->size(), j, i);
+
+            got_conflict |= bank_queue->numRows() > (row_queue ? 1 : 0);
+            if (!row_queue)
+                continue;
+
+            const MemPacketQueue::Entry *hit = &row_queue->front();
+            const Tick col_allowed_at = (*hit->pkt)->isRead() ?
+                bank.rdAllowedAt : bank.wrAllowedAt;
+
+            // no additional rank-to-rank or same bank-group delays, or
+            // we switched read/write and might as well go for the row hit
+            if (col_allowed_at <= min_col_at) {
+                if (!seamless_hit || hit->seqNum < seamless_hit->seqNum) {
+                    seamless_hit = hit;
+                    seamless_col_at = col_allowed_at;
+                }
+            } else if (!prepped_hit || hit->seqNum < prepped_hit->seqNum) {
+                prepped_hit = hit;
+                prepped_col_at = col_allowed_at;
+            }
+        }
+    }
 
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
-
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
-
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
+    if (seamless_hit) {
+        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
+        return std::make_pair(seamless_hit->pkt, seamless_col_at);
+    }
 
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
+    // if there is no seamless row hit, determine if there are packets
+    // that can be issued without incurring additional bus delay due to
+    // bank timing, amongst those to closed rows, to enable more open row
+    // possibilities in future selections
+    bool hidden_bank_prep = false;
+    if (got_conflict) {
+        std::vector<uint32_t> earliest_banks;
+        std::tie(earliest_banks, hidden_bank_prep) =
+            minBankPrep(queue, min_col_at);
+
+        for (int i = 0; i < ranksPerChannel; i++) {
+            for (int j = 0; j < banksPerRank; j++) {
+                // minBankPrep will give priority to banks that can issue
+                // seamlessly
+                if (!bits(earliest_banks[i], j, j))
+                    continue;
+
+                const Bank& bank = ranks[i]->banks[j];
+                const auto *conflict =
+                    queue.bankQueue(true, pseudoChannel, i * banksPerRank + j)
+                         ->oldestConflict(bank.openRow);
+                if (conflict && (!earliest_pkt ||
+                                 conflict->seqNum < earliest_pkt->seqNum)) {
+                    earliest_pkt = conflict;
+                    earliest_col_at = (*conflict->pkt)->isRead() ?
+                        bank.rdAllowedAt : bank.wrAllowedAt;
                 }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
             }
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
-        DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+    // give priority to packets that can issue bank commands 'behind the
+    // scenes', any additional delay if any will be due to col-to-col
+    // command requirements, then to the row hits to prepped banks, and
+    // otherwise just go for the earliest possible
+    if (earliest_pkt && (hidden_bank_prep || !prepped_hit)) {
+        DPRINTF(DRAM, "%s Earliest bank %s\n", __func__,
+                hidden_bank_prep ? "prepped behind the scenes" : "found");
+        return std::make_pair(earliest_pkt->pkt, earliest_col_at);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    if (prepped_hit) {
+        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
+        return std::make_pair(prepped_hit->pkt, prepped_col_at);
+    }
+
+    DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+    return std::make_pair(queue.end(), MaxTick);
 }
 
 void
@@ -508,33 +511,23 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
         bool got_bank_conflict = false;
 
         for (uint8_t i = 0; i < ctrl->numPriorities(); ++i) {
-            auto p = queue[i].begin();
-            // keep on looking until we find a hit or reach the end of the
-            // queue
+            // look up the packets waiting for the same bank
             // 1) if a hit is found, then both open and close adaptive
             //    policies keep the page open
             // 2) if no hit is found, got_bank_conflict is set to true if a
             //    bank conflict request is waiting in the queue
             // 3) make sure we are not considering the packet that we are
             //    currently dealing with
-            while (!got_more_hits && p != queue[i].end()) {
-
-                if ((*p)->pseudoChannel != pseudoChannel) {
-                    // only consider if this pkt belongs to this interface
-                    ++p;
-                    continue;
-                }
-
-                if (mem_pkt != (*p)) {
-                    bool same_rank_bank = (mem_pkt->rank == (*p)->rank) &&
-                                          (mem_pkt->bank == (*p)->bank);
+            const auto *bank_queue =
+                queue[i].bankQueue(true, pseudoChannel, mem_pkt->bankId);
+            if (!bank_queue)
+                continue;
 
-                    bool same_row = mem_pkt->row == (*p)->row;
-                    got_more_hits |= same_rank_bank && same_row;
-                    got_bank_conflict |= same_rank_bank && !same_row;
-                }
-                ++p;
-            }
+            const auto *row_queue = bank_queue->rowQueue(mem_pkt->row);
+            got_more_hits |= row_queue && (row_queue->size() > 1 ||
+                                           *row_queue->front().pkt != mem_pkt);
+            got_bank_conflict |=
+                bank_queue->numRows() > (row_queue ? 1 : 0);
 
             if (got_more_hits)
                 break;
@@ -1038,27 +1031,17 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
-    std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
-    }
-
     // Find command with optimal bank timing
     // Will prioritize commands that can issue seamlessly.
     for (int i = 0; i < ranksPerChannel; i++) {
         for (int j = 0; j < banksPerRank; j++) {
             uint16_t bank_id = i * banksPerRank + j;
 
-            // if we have waiting requests for the bank, and it is
-            // amongst the first available, update the mask
-            if (got_waiting[bank_id]) {
-                // make sure this rank is not currently refreshing.
-                assert(ranks[i]->inRefIdleState());
+            // if we have queued transactions targetting the bank, its
+            // rank is not currently refreshing, and it is amongst the
+            // first available, update the mask
+            if (ranks[i]->inRefIdleState() &&
+                queue.bankQueue(true, pseudoChannel, bank_id)) {
                 // simplistic approximation of when the bank can issue
                 // an activate, ignoring any rank-to-rank switching
                 // cost in this calculation
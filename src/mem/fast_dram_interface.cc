@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/fast_dram_interface.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/trace.hh"
+#include "debug/FastDRAM.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+FastDRAMInterface::FastDRAMInterface(const FastDRAMInterfaceParams &_p)
+    : MemInterface(_p),
+      utilPoints(_p.utilization_points),
+      rowHitLatency(_p.row_hit_latency),
+      rowMissLatency(_p.row_miss_latency),
+      utilWindow(_p.utilization_window),
+      openRows(_p.banks_per_rank * _p.ranks_per_channel, Bank::NO_ROW),
+      windowStart(0), windowBusy(0), utilization(0),
+      lastCmdAt(0), lastRead(true), lastRank(0), lastReadyAt(0),
+      stats(*this)
+{
+    fatal_if(utilPoints.empty(), "%s: no utilization points given\n",
+             name());
+    fatal_if(rowHitLatency.size() != utilPoints.size() ||
+             rowMissLatency.size() != utilPoints.size(),
+             "%s: the latency curves must have one value per "
+             "utilization point\n", name());
+    for (int i = 0; i < utilPoints.size(); i++) {
+        fatal_if(utilPoints[i] < 0 || utilPoints[i] > 1,
+                 "%s: utilization point %f is not in [0, 1]\n", name(),
+                 utilPoints[i]);
+        fatal_if(i && utilPoints[i] <= utilPoints[i - 1],
+                 "%s: the utilization points must be increasing\n",
+                 name());
+    }
+    fatal_if(utilWindow == 0, "%s: the utilization window must not be "
+             "empty\n", name());
+
+    fatal_if(!isPowerOf2(burstSize), "DRAM burst size %d is not allowed, "
+             "must be a power of two\n", burstSize);
+
+    // sanity check the ranks since we rely on bit slicing for the
+    // address decoding
+    fatal_if(!isPowerOf2(ranksPerChannel), "DRAM rank count of %d is "
+             "not allowed, must be a power of two\n", ranksPerChannel);
+
+    uint64_t capacity = 1ULL << ceilLog2(AbstractMemory::size());
+
+    DPRINTF(FastDRAM, "Memory capacity %lld (%lld) bytes\n", capacity,
+            AbstractMemory::size());
+
+    rowsPerBank = capacity / (rowBufferSize *
+                    banksPerRank * ranksPerChannel);
+}
+
+Tick
+FastDRAMInterface::curveLatency(const std::vector<Tick> &curve,
+                                double util) const
+{
+    auto next = std::upper_bound(utilPoints.begin(), utilPoints.end(),
+                                 util);
+    if (next == utilPoints.begin())
+        return curve.front();
+    if (next == utilPoints.end())
+        return curve.back();
+
+    const size_t i = next - utilPoints.begin();
+    const double frac = (util - utilPoints[i - 1]) /
+                        (utilPoints[i] - utilPoints[i - 1]);
+    return curve[i - 1] +
+           frac * ((double)curve[i] - (double)curve[i - 1]);
+}
+
+void
+FastDRAMInterface::updateUtilization(Tick burst_at)
+{
+    const Tick window = burst_at - burst_at % utilWindow;
+    if (window != windowStart) {
+        // a window without any burst in between was idle
+        utilization = window == windowStart + utilWindow ?
+            std::min(1.0, (double)windowBusy / utilWindow) : 0;
+        windowStart = window;
+        windowBusy = 0;
+    }
+    windowBusy += tBURST;
+}
+
+MemPacket*
+FastDRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
+                       unsigned size, bool is_read, uint8_t pseudo_channel)
+{
+    // decode the address based on the address mapping scheme, with
+    // Ro, Ra, Co, Ba and Ch denoting row, rank, column, bank and
+    // channel, respectively
+    uint8_t rank;
+    uint8_t bank;
+    // use a 64-bit unsigned during the computations as the row is
+    // always the top bits, and check before creating the packet
+    uint64_t row;
+
+    // Get packed address, starting at 0
+    Addr addr = getCtrlAddr(pkt_addr);
+
+    // truncate the address to a memory burst, which makes it unique to
+    // a specific buffer, row, bank, rank and channel
+    addr = addr / burstSize;
+
+    // we have removed the lowest order address bits that denote the
+    // position within the column
+    if (addrMapping == enums::RoRaBaChCo || addrMapping == enums::RoRaBaCoCh) {
+        // the lowest order bits denote the column to ensure that
+        // sequential cache lines occupy the same row
+        addr = addr / burstsPerRowBuffer;
+
+        // after the channel bits, get the bank bits to interleave
+        // over the banks
+        bank = addr % banksPerRank;
+        addr = addr / banksPerRank;
+
+        // after the bank, we get the rank bits which thus interleaves
+        // over the ranks
+        rank = addr % ranksPerChannel;
+        addr = addr / ranksPerChannel;
+
+        // lastly, get the row bits, no need to remove them from addr
+        row = addr % rowsPerBank;
+    } else if (addrMapping == enums::RoCoRaBaCh) {
+        // with emerging technologies, could have small page size with
+        // interleaving granularity greater than row buffer
+        if (burstsPerStripe > burstsPerRowBuffer) {
+            // remove column bits which are a subset of burstsPerStripe
+            addr = addr / burstsPerRowBuffer;
+        } else {
+            // remove lower column bits below channel bits
+            addr = addr / burstsPerStripe;
+        }
+
+        // start with the bank bits, as this provides the maximum
+        // opportunity for parallelism between requests
+        bank = addr % banksPerRank;
+        addr = addr / banksPerRank;
+
+        // next get the rank bits
+        rank = addr % ranksPerChannel;
+        addr = addr / ranksPerChannel;
+
+        // next, the higher-order column bites
+        if (burstsPerStripe < burstsPerRowBuffer) {
+            addr = addr / (burstsPerRowBuffer / burstsPerStripe);
+        }
+
+        // lastly, get the row bits, no need to remove them from addr
+        row = addr % rowsPerBank;
+    } else
+        panic("Unknown address mapping policy chosen!");
+
+    assert(rank < ranksPerChannel);
+    assert(bank < banksPerRank);
+    assert(row < rowsPerBank);
+    assert(row < Bank::NO_ROW);
+
+    DPRINTF(FastDRAM, "Address: %#x Rank %d Bank %d Row %d\n",
+            pkt_addr, rank, bank, row);
+
+    uint16_t bank_id = banksPerRank * rank + bank;
+
+    return new MemPacket(pkt, is_read, true, pseudo_channel, rank, bank, row,
+                   bank_id, pkt_addr, size);
+}
+
+std::pair<MemPacketQueue::iterator, Tick>
+FastDRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue,
+                                    Tick min_col_at) const
+{
+    // the oldest packet to the last row accessed in its bank, using
+    // the per bank index of the queue
+    const MemPacketQueue::Entry *hit = nullptr;
+    for (uint16_t bank_id = 0; bank_id < openRows.size(); bank_id++) {
+        if (openRows[bank_id] == Bank::NO_ROW)
+            continue;
+        const auto *bank_queue =
+            queue.bankQueue(true, pseudoChannel, bank_id);
+        if (!bank_queue)
+            continue;
+        const auto *row_queue = bank_queue->rowQueue(openRows[bank_id]);
+        if (row_queue && (!hit || row_queue->front().seqNum < hit->seqNum))
+            hit = &row_queue->front();
+    }
+
+    if (hit) {
+        DPRINTF(FastDRAM, "%s row hit found\n", __func__);
+        return std::make_pair(hit->pkt, min_col_at);
+    }
+
+    // otherwise the oldest packet to this interface
+    for (auto i = queue.begin(); i != queue.end(); ++i) {
+        if ((*i)->isDram() && (*i)->pseudoChannel == pseudoChannel)
+            return std::make_pair(i, min_col_at);
+    }
+
+    DPRINTF(FastDRAM, "%s no packets found\n", __func__);
+    return std::make_pair(queue.end(), MaxTick);
+}
+
+void
+FastDRAMInterface::addRankToRankDelay(Tick cmd_at)
+{
+    // a burst by another interface sharing the bus is a rank switch
+    lastCmdAt = std::max(lastCmdAt, cmd_at);
+    lastRank = otherRank;
+}
+
+std::pair<Tick, Tick>
+FastDRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
+                                 const std::vector<MemPacketQueue>& queue)
+{
+    DPRINTF(FastDRAM, "Timing access to addr %#x, rank/bank/row %d %d %d\n",
+            mem_pkt->addr, mem_pkt->rank, mem_pkt->bank, mem_pkt->row);
+
+    // wait for the data bus, including any rank switch or bus
+    // turnaround since the last burst
+    Tick cmd_at = std::max(curTick(), next_burst_at);
+    if (mem_pkt->rank != lastRank) {
+        cmd_at = std::max(cmd_at, lastCmdAt + rankToRankDelay());
+    } else if (mem_pkt->isRead() != lastRead) {
+        cmd_at = std::max(cmd_at, lastCmdAt + (lastRead ?
+                          readToWriteDelay() : writeToReadDelay()));
+    }
+
+    // verify there is command bandwidth to issue the burst
+    cmd_at = ctrl->verifySingleCmd(cmd_at, maxCommandsPerWindow, false);
+
+    lastCmdAt = cmd_at;
+    lastRead = mem_pkt->isRead();
+    lastRank = mem_pkt->rank;
+
+    updateUtilization(cmd_at);
+
+    const bool row_hit = openRows[mem_pkt->bankId] == mem_pkt->row;
+    openRows[mem_pkt->bankId] = mem_pkt->row;
+
+    if (mem_pkt->isRead()) {
+        // the curves give the latency from the burst entering the
+        // controller, bounded by the data bus and by returning the data
+        // in order
+        const Tick latency = curveLatency(
+            row_hit ? rowHitLatency : rowMissLatency, utilization);
+        mem_pkt->readyTime = std::max({mem_pkt->entryTime + latency,
+                                       cmd_at + tBURST,
+                                       lastReadyAt + tBURST});
+        lastReadyAt = mem_pkt->readyTime;
+
+        stats.readBursts++;
+        if (row_hit)
+            stats.readRowHits++;
+        stats.bytesRead += burstSize;
+        stats.totQLat += cmd_at - mem_pkt->entryTime;
+        stats.totMemAccLat += mem_pkt->readyTime - mem_pkt->entryTime;
+        stats.readUtilization.sample(utilization * 100);
+    } else {
+        mem_pkt->readyTime = cmd_at + tBURST;
+
+        stats.writeBursts++;
+        if (row_hit)
+            stats.writeRowHits++;
+        stats.bytesWritten += burstSize;
+    }
+
+    DPRINTF(FastDRAM, "Access to %#x, ready at %lld, row %s, "
+            "utilization %f.\n", mem_pkt->addr, mem_pkt->readyTime,
+            row_hit ? "hit" : "miss", utilization);
+
+    return std::make_pair(cmd_at, cmd_at + tBURST);
+}
+
+FastDRAMInterface::FastDRAMStats::FastDRAMStats(FastDRAMInterface &_dram)
+    : statistics::Group(&_dram),
+    dram(_dram),
+
+    ADD_STAT(readBursts, statistics::units::Count::get(),
+             "Number of DRAM read bursts"),
+    ADD_STAT(writeBursts, statistics::units::Count::get(),
+             "Number of DRAM write bursts"),
+
+    ADD_STAT(readRowHits, statistics::units::Count::get(),
+             "Number of read bursts to the last row of their bank"),
+    ADD_STAT(writeRowHits, statistics::units::Count::get(),
+             "Number of write bursts to the last row of their bank"),
+    ADD_STAT(readRowHitRate, statistics::units::Ratio::get(),
+             "Row buffer hit rate for reads"),
+    ADD_STAT(writeRowHitRate, statistics::units::Ratio::get(),
+             "Row buffer hit rate for writes"),
+
+    ADD_STAT(totQLat, statistics::units::Tick::get(),
+             "Total ticks spent queuing"),
+    ADD_STAT(totMemAccLat, statistics::units::Tick::get(),
+             "Total ticks spent from burst creation until serviced "
+             "by the DRAM"),
+    ADD_STAT(avgQLat, statistics::units::Rate<
+                statistics::units::Tick, statistics::units::Count>::get(),
+             "Average queueing delay per DRAM burst"),
+    ADD_STAT(avgMemAccLat, statistics::units::Rate<
+                statistics::units::Tick, statistics::units::Count>::get(),
+             "Average memory access latency per DRAM burst"),
+
+    ADD_STAT(bytesRead, statistics::units::Byte::get(),
+             "Total bytes read"),
+    ADD_STAT(bytesWritten, statistics::units::Byte::get(),
+             "Total bytes written"),
+
+    ADD_STAT(avgRdBW, statistics::units::Rate<
+                statistics::units::Byte, statistics::units::Second>::get(),
+             "Average DRAM read bandwidth in MiBytes/s"),
+    ADD_STAT(avgWrBW, statistics::units::Rate<
+                statistics::units::Byte, statistics::units::Second>::get(),
+             "Average DRAM write bandwidth in MiBytes/s"),
+    ADD_STAT(peakBW, statistics::units::Rate<
+                statistics::units::Byte, statistics::units::Second>::get(),
+             "Theoretical peak bandwidth in MiByte/s"),
+    ADD_STAT(busUtil, statistics::units::Ratio::get(),
+             "Data bus utilization in percentage"),
+
+    ADD_STAT(readUtilization, statistics::units::Ratio::get(),
+             "Data bus utilization in percentage the read latencies were "
+             "looked up at")
+{
+}
+
+void
+FastDRAMInterface::FastDRAMStats::regStats()
+{
+    using namespace statistics;
+
+    readRowHitRate.precision(2);
+    writeRowHitRate.precision(2);
+
+    avgQLat.precision(2);
+    avgMemAccLat.precision(2);
+
+    avgRdBW.precision(2);
+    avgWrBW.precision(2);
+    peakBW.precision(2);
+
+    busUtil.precision(2);
+
+    readUtilization
+        .init(20)
+        .flags(nozero);
+
+    readRowHitRate = (readRowHits / readBursts) * 100;
+    writeRowHitRate = (writeRowHits / writeBursts) * 100;
+
+    avgQLat = totQLat / readBursts;
+    avgMemAccLat = totMemAccLat / readBursts;
+
+    avgRdBW = (bytesRead / 1000000) / simSeconds;
+    avgWrBW = (bytesWritten / 1000000) / simSeconds;
+    peakBW = (sim_clock::Frequency / dram.tBURST) *
+              dram.burstSize / 1000000;
+
+    busUtil = (avgRdBW + avgWrBW) / peakBW * 100;
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * FastDRAMInterface declaration
+ */
+
+#ifndef __FAST_DRAM_INTERFACE_HH__
+#define __FAST_DRAM_INTERFACE_HH__
+
+#include <vector>
+
+#include "mem/mem_interface.hh"
+#include "params/FastDRAMInterface.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * A cycle-approximate DRAM interface for early exploration. Rather than
+ * modelling the bank and rank state machines, refresh and power-down,
+ * the latency of a read is looked up in two curves, one for row hits and
+ * one for row misses, indexed by the recent utilisation of the data
+ * bus. The curves are calibrated offline against a detailed
+ * DRAMInterface (see configs/dram/fast_dram_calibrate.py) and capture
+ * the average time from a burst entering the controller until its data
+ * is ready. The data bus itself, the bus turnarounds and the command
+ * bandwidth are still modelled, which bounds the achievable bandwidth.
+ */
+class FastDRAMInterface : public MemInterface
+{
+  private:
+    /** The bus utilisation points the curves are sampled at */
+    const std::vector<double> utilPoints;
+
+    /** The read latency curves for row hits and row misses */
+    const std::vector<Tick> rowHitLatency;
+    const std::vector<Tick> rowMissLatency;
+
+    /** The length of the window the bus utilisation is measured over */
+    const Tick utilWindow;
+
+    /** The last row accessed in each bank, by bank id */
+    std::vector<uint32_t> openRows;
+
+    /** The start of the current utilisation window */
+    Tick windowStart;
+
+    /** The data bus busy time, in the current window */
+    Tick windowBusy;
+
+    /** The data bus utilisation, of the last window */
+    double utilization;
+
+    /** The last burst issued, to account for bus turnarounds */
+    Tick lastCmdAt;
+    bool lastRead;
+    uint8_t lastRank;
+
+    /** The rank of a burst issued by another interface on the bus */
+    static constexpr uint8_t otherRank = -1;
+
+    /** When the data of the last read is ready */
+    Tick lastReadyAt;
+
+    /**
+     * Look up a latency curve at a bus utilisation, interpolating
+     * linearly between the points.
+     *
+     * @param curve The curve to look up
+     * @param util The bus utilisation
+     * @return The latency
+     */
+    Tick curveLatency(const std::vector<Tick> &curve, double util) const;
+
+    /**
+     * Account for a burst on the data bus in the bus utilisation.
+     *
+     * @param burst_at When the burst is issued
+     */
+    void updateUtilization(Tick burst_at);
+
+    struct FastDRAMStats : public statistics::Group
+    {
+        FastDRAMStats(FastDRAMInterface &dram);
+
+        void regStats() override;
+
+        FastDRAMInterface &dram;
+
+        /** total number of DRAM bursts serviced */
+        statistics::Scalar readBursts;
+        statistics::Scalar writeBursts;
+
+        // Row hit count and rate
+        statistics::Scalar readRowHits;
+        statistics::Scalar writeRowHits;
+        statistics::Formula readRowHitRate;
+        statistics::Formula writeRowHitRate;
+
+        // Latencies summed over all requests
+        statistics::Scalar totQLat;
+        statistics::Scalar totMemAccLat;
+
+        // Average latencies per request
+        statistics::Formula avgQLat;
+        statistics::Formula avgMemAccLat;
+
+        statistics::Scalar bytesRead;
+        statistics::Scalar bytesWritten;
+
+        // Average bandwidth
+        statistics::Formula avgRdBW;
+        statistics::Formula avgWrBW;
+        statistics::Formula peakBW;
+        statistics::Formula busUtil;
+
+        /** The bus utilisation the read latencies were looked up at */
+        statistics::Histogram readUtilization;
+    };
+
+    FastDRAMStats stats;
+
+  public:
+    void setupRank(const uint8_t rank, const bool is_read) override { }
+
+    MemPacket* decodePacket(const PacketPtr pkt, Addr pkt_addr,
+                           unsigned int size, bool is_read,
+                           uint8_t pseudo_channel = 0) override;
+
+    /**
+     * There are no rank state machines, so nothing ever needs draining.
+     */
+    bool allRanksDrained() const override { return true; }
+
+    Tick commandOffset() const override { return tBURST; }
+
+    /**
+     * The unloaded latency of a row miss.
+     */
+    Tick
+    accessLatency() const override
+    {
+        return curveLatency(rowMissLatency, 0);
+    }
+
+    /**
+     * Without refresh and power-down, a burst is always ready.
+     */
+    bool burstReady(MemPacket* pkt) const override { return true; }
+
+    bool
+    isBusy(bool read_queue_empty, bool all_writes_nvm) override
+    {
+        return false;
+    }
+
+    /**
+     * Pick the oldest packet to the last row accessed in its bank, and
+     * otherwise the oldest packet.
+     */
+    std::pair<MemPacketQueue::iterator, Tick>
+    chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const override;
+
+    void addRankToRankDelay(Tick cmd_at) override;
+
+    std::pair<Tick, Tick>
+    doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
+                  const std::vector<MemPacketQueue>& queue) override;
+
+    void respondEvent(uint8_t rank) override { }
+    void checkRefreshState(uint8_t rank) override { }
+    void drainRanks() override { }
+    void suspend() override { }
+    bool readsWaitingToIssue() const override { return false; }
+    void chooseRead(MemPacketQueue& queue) override { }
+    bool writeRespQueueFull() const override { return false; }
+
+    FastDRAMInterface(const FastDRAMInterfaceParams &_p);
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__FAST_DRAM_INTERFACE_HH__
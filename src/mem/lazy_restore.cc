@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/lazy_restore.hh"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/userfaultfd.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#endif
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+LazyRestore::LazyRestore(int image_fd, uint8_t *pmem, uint64_t size,
+                         uint64_t chunk_size,
+                         const std::vector<uint64_t> &chunk_offsets,
+                         const std::vector<uint64_t> &chunk_sizes,
+                         long page_size)
+    : imageFd(image_fd), pmem(pmem), size(size), chunkSize(chunk_size),
+      chunkOffsets(chunk_offsets), chunkSizes(chunk_sizes),
+      pageSize(page_size), restored(chunk_sizes.size(), false)
+{
+}
+
+LazyRestore::~LazyRestore()
+{
+    if (handler.joinable()) {
+        uint64_t stop = 1;
+        if (write(stopFd, &stop, sizeof(stop)) != sizeof(stop))
+            panic("Failed to stop the lazy restore of %p\n", pmem);
+        handler.join();
+    }
+
+    if (uffd != -1)
+        close(uffd);
+    if (stopFd != -1)
+        close(stopFd);
+    close(imageFd);
+}
+
+#if defined(__linux__)
+
+bool
+LazyRestore::start()
+{
+    uffd = syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK);
+    if (uffd == -1)
+        return false;
+
+    struct uffdio_api api = {};
+    api.api = UFFD_API;
+    if (ioctl(uffd, UFFDIO_API, &api) == -1) {
+        close(uffd);
+        uffd = -1;
+        return false;
+    }
+
+    const uint64_t len = roundUp(size, pageSize);
+
+    // drop anything already in the backing store, so every page faults
+    // on its first access
+    if (madvise(pmem, len, MADV_DONTNEED) == -1)
+        panic("Failed to discard the backing store at %p\n", pmem);
+
+    struct uffdio_register reg = {};
+    reg.range.start = (uintptr_t)pmem;
+    reg.range.len = len;
+    reg.mode = UFFDIO_REGISTER_MODE_MISSING;
+    if (ioctl(uffd, UFFDIO_REGISTER, &reg) == -1) {
+        close(uffd);
+        uffd = -1;
+        return false;
+    }
+
+    stopFd = eventfd(0, EFD_CLOEXEC);
+    if (stopFd == -1)
+        panic("Failed to create the lazy restore eventfd: %s\n",
+              strerror(errno));
+
+    handler = std::thread([this]() { handleFaults(); });
+    return true;
+}
+
+void
+LazyRestore::handleFaults()
+{
+    while (true) {
+        struct pollfd fds[2] = {
+            { uffd, POLLIN, 0 },
+            { stopFd, POLLIN, 0 },
+        };
+        if (poll(fds, 2, -1) == -1) {
+            if (errno == EINTR)
+                continue;
+            panic("Lazy restore poll failed: %s\n", strerror(errno));
+        }
+
+        if (fds[1].revents)
+            return;
+
+        struct uffd_msg msg;
+        ssize_t bytes_read = read(uffd, &msg, sizeof(msg));
+        if (bytes_read == -1 && (errno == EAGAIN || errno == EINTR))
+            continue;
+        panic_if(bytes_read != sizeof(msg),
+                 "Lazy restore read failed: %s\n", strerror(errno));
+
+        if (msg.event != UFFD_EVENT_PAGEFAULT)
+            continue;
+
+        const uint64_t offset = msg.arg.pagefault.address - (uintptr_t)pmem;
+        const size_t chunk = offset / chunkSize;
+        if (!restored[chunk]) {
+            restoreChunk(chunk);
+            restored[chunk] = true;
+        } else {
+            // another thread faulted on the chunk while it was being
+            // restored, and resolving the chunk already woke it up
+            struct uffdio_range range;
+            range.start = msg.arg.pagefault.address & ~(pageSize - 1);
+            range.len = pageSize;
+            ioctl(uffd, UFFDIO_WAKE, &range);
+        }
+    }
+}
+
+void
+LazyRestore::restoreChunk(size_t chunk)
+{
+    const uint64_t offset = chunk * chunkSize;
+    const uint64_t len =
+        roundUp(std::min(chunkSize, size - offset), pageSize);
+
+    std::vector<uint8_t> data;
+    if (chunkSizes[chunk]) {
+        std::vector<uint8_t> compressed(chunkSizes[chunk]);
+        uint64_t done = 0;
+        while (done < compressed.size()) {
+            ssize_t bytes_read = pread(imageFd, compressed.data() + done,
+                                       compressed.size() - done,
+                                       chunkOffsets[chunk] + done);
+            panic_if(bytes_read <= 0, "Lazy restore of chunk %d failed: %s\n",
+                     chunk, strerror(errno));
+            done += bytes_read;
+        }
+
+        // keep the buffer page sized so the last page can be copied
+        // whole
+        data.resize(len, 0);
+        uLongf data_len = len;
+        panic_if(uncompress(data.data(), &data_len, compressed.data(),
+                            compressed.size()) != Z_OK,
+                 "Lazy restore of chunk %d failed to decompress\n", chunk);
+    }
+
+    // resolve the runs of zero and non-zero pages, mapping the zero
+    // pages to the shared zero page rather than allocating them
+    uint64_t page = 0;
+    while (page < len) {
+        auto is_zero = [&](uint64_t p) {
+            return data.empty() ||
+                std::all_of(data.begin() + p, data.begin() + p + pageSize,
+                            [](uint8_t b) { return b == 0; });
+        };
+
+        const bool zero = is_zero(page);
+        uint64_t end = page + pageSize;
+        while (end < len && is_zero(end) == zero)
+            end += pageSize;
+
+        int ret;
+        if (zero) {
+            struct uffdio_zeropage zp = {};
+            zp.range.start = (uintptr_t)pmem + offset + page;
+            zp.range.len = end - page;
+            ret = ioctl(uffd, UFFDIO_ZEROPAGE, &zp);
+        } else {
+            struct uffdio_copy copy = {};
+            copy.dst = (uintptr_t)pmem + offset + page;
+            copy.src = (uintptr_t)data.data() + page;
+            copy.len = end - page;
+            ret = ioctl(uffd, UFFDIO_COPY, &copy);
+        }
+        panic_if(ret == -1 && errno != EEXIST,
+                 "Lazy restore of chunk %d failed: %s\n", chunk,
+                 strerror(errno));
+
+        page = end;
+    }
+}
+
+#else
+
+bool
+LazyRestore::start()
+{
+    return false;
+}
+
+#endif
+
+void
+LazyRestore::complete()
+{
+    // touching a page has the handler restore its whole chunk, and
+    // touching the chunks that are already restored is cheap
+    for (uint64_t offset = 0; offset < size; offset += chunkSize)
+        (void)*(volatile uint8_t *)(pmem + offset);
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_LAZY_RESTORE_HH__
+#define __MEM_LAZY_RESTORE_HH__
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Restore a backing store from a chunked checkpoint image on demand.
+ *
+ * The backing store is registered with userfaultfd, and a host thread
+ * decompresses a chunk into it the first time any of its pages is
+ * touched, be it by the simulator, another host thread or the kernel
+ * on behalf of KVM. This keeps the restore time proportional to the
+ * memory a simulation actually uses rather than to the memory size.
+ *
+ * The backing store has to be a private anonymous mapping, and must
+ * stay mapped for as long as this object exists.
+ */
+class LazyRestore
+{
+  private:
+    /** The userfaultfd the backing store is registered with. */
+    int uffd = -1;
+
+    /** Written to stop the fault handling thread. */
+    int stopFd = -1;
+
+    /** The checkpoint image, owned by this object. */
+    int imageFd;
+
+    uint8_t *pmem;
+    uint64_t size;
+    uint64_t chunkSize;
+    std::vector<uint64_t> chunkOffsets;
+    std::vector<uint64_t> chunkSizes;
+    long pageSize;
+
+    /** Whether each chunk has been restored. */
+    std::vector<bool> restored;
+
+    std::thread handler;
+
+    /** Handle the faults until stopped. */
+    void handleFaults();
+
+    /** Decompress a chunk and resolve its pages. */
+    void restoreChunk(size_t chunk);
+
+  public:
+    /**
+     * @param image_fd The checkpoint image, which is closed when this
+     *                 object is destroyed
+     * @param pmem The backing store
+     * @param size The size of the backing store
+     * @param chunk_size The uncompressed size of each chunk
+     * @param chunk_offsets The file offset of each chunk
+     * @param chunk_sizes The compressed size of each chunk, 0 for the
+     *                    all-zero chunks
+     * @param page_size The host page size
+     */
+    LazyRestore(int image_fd, uint8_t *pmem, uint64_t size,
+                uint64_t chunk_size,
+                const std::vector<uint64_t> &chunk_offsets,
+                const std::vector<uint64_t> &chunk_sizes, long page_size);
+
+    ~LazyRestore();
+
+    /**
+     * Register the backing store and start handling its faults. The
+     * current contents of the backing store are discarded.
+     *
+     * @return False if userfaultfd is not available on this host, in
+     *         which case the backing store is left untouched
+     */
+    bool start();
+
+    /**
+     * Restore all the chunks which have not been touched yet. The
+     * chunks are faulted in from the calling thread, so this must not
+     * be called from the fault handling thread.
+     */
+    void complete();
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_LAZY_RESTORE_HH__
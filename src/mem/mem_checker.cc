@@ -66,15 +66,14 @@ MemChecker::WriteCluster::startWrite(MemChecker::Serial serial, Tick _start,
     }
 
     // Create new transaction, and denote completion time to be in the future.
-    writes.insert(std::make_pair(serial,
-                  MemChecker::Transaction(serial, _start, TICK_FUTURE, data)));
+    writes.emplace_back(serial, _start, TICK_FUTURE, data);
 }
 
 void
 MemChecker::WriteCluster::completeWrite(MemChecker::Serial serial,
     Tick _complete)
 {
-    auto it = writes.find(serial);
+    auto it = findWrite(serial);
 
     if (it == writes.end()) {
         warn("Could not locate write transaction: serial = %d, "
@@ -83,8 +82,8 @@ MemChecker::WriteCluster::completeWrite(MemChecker::Serial serial,
     }
 
     // Record completion time of the write
-    assert(it->second.complete == TICK_FUTURE);
-    it->second.complete = _complete;
+    assert(it->complete == TICK_FUTURE);
+    it->complete = _complete;
 
     // Update max completion time for the cluster
     if (completeMax < _complete) {
@@ -105,10 +104,13 @@ MemChecker::WriteCluster::completeWrite(MemChecker::Serial serial,
 void
 MemChecker::WriteCluster::abortWrite(MemChecker::Serial serial)
 {
-    if (!writes.erase(serial)) {
+    auto it = findWrite(serial);
+
+    if (it == writes.end()) {
         warn("Could not locate write transaction: serial = %d\n", serial);
         return;
     }
+    writes.erase(it);
 
     if (--numIncomplete == 0 && !writes.empty()) {
         // This write cluster is now complete, and we can assign the current
@@ -124,8 +126,9 @@ MemChecker::WriteCluster::abortWrite(MemChecker::Serial serial)
 void
 MemChecker::ByteTracker::startRead(MemChecker::Serial serial, Tick start)
 {
-    outstandingReads.insert(std::make_pair(serial,
-            MemChecker::Transaction(serial, start, TICK_FUTURE)));
+    assert(outstandingReads.empty() ||
+           outstandingReads.back().serial < serial);
+    outstandingReads.emplace_back(serial, start, TICK_FUTURE);
 }
 
 bool
@@ -145,8 +148,7 @@ MemChecker::ByteTracker::inExpectedData(Tick start, Tick complete,
     // preceding & overlapping writes.
     for (auto cluster = writeClusters.rbegin();
          cluster != writeClusters.rend() && wc_overlap; ++cluster) {
-        for (const auto& addr_write : cluster->writes) {
-            const Transaction& write = addr_write.second;
+        for (const auto& write : cluster->writes) {
 
             if (write.complete < last_obs.start) {
                 // If this write transaction completed before the last
@@ -226,16 +228,18 @@ bool
 MemChecker::ByteTracker::completeRead(MemChecker::Serial serial,
                                       Tick complete, uint8_t data)
 {
-    auto it = outstandingReads.find(serial);
+    auto it = std::lower_bound(outstandingReads.begin(),
+        outstandingReads.end(), serial,
+        [](const Transaction &t, Serial s) { return t.serial < s; });
 
-    if (it == outstandingReads.end()) {
+    if (it == outstandingReads.end() || it->serial != serial) {
         // Can happen if concurrent with reset_address_range
         warn("Could not locate read transaction: serial = %d, complete = %d\n",
              serial, complete);
         return true;
     }
 
-    Tick start = it->second.start;
+    Tick start = it->start;
     outstandingReads.erase(it);
 
     // Verify data
@@ -276,6 +280,7 @@ void
 MemChecker::ByteTracker::abortWrite(MemChecker::Serial serial)
 {
     getIncompleteWriteCluster()->abortWrite(serial);
+    pruneTransactions();
 }
 
 void
@@ -285,7 +290,7 @@ MemChecker::ByteTracker::pruneTransactions()
     // reads, we use curTick(), i.e. we will remove all readObservation except
     // the most recent one.
     const Tick before = outstandingReads.empty() ? curTick() :
-                        outstandingReads.begin()->second.start;
+                        outstandingReads.front().start;
 
     // Pruning of readObservations
     readObservations.erase(readObservations.begin(),
@@ -308,9 +313,7 @@ MemChecker::completeRead(MemChecker::Serial serial, Tick complete,
             "completing read: serial = %d, complete = %d, "
             "addr = %#llx, size = %d\n", serial, complete, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        ByteTracker *tracker = getByteTracker(addr + i);
-
+    forEachByteTracker(addr, size, [&](size_t i, ByteTracker *tracker) {
         if (!tracker->completeRead(serial, complete, data[i])) {
             // Generate error message, and aggregate all failures for the bytes
             // considered in this transaction in one message.
@@ -333,7 +336,7 @@ MemChecker::completeRead(MemChecker::Serial serial, Tick complete,
                              ? "" : "|");
             }
         }
-    }
+    });
 
     if (!result) {
         DPRINTF(MemChecker, "read of %#llx @ cycle %d failed:\n%s\n", addr,
@@ -347,7 +350,9 @@ void
 MemChecker::reset(Addr addr, size_t size)
 {
     for (size_t i = 0; i < size; ++i) {
-        byte_trackers.erase(addr + i);
+        auto it = lineTrackers.find((addr + i) >> lineBits);
+        if (it != lineTrackers.end() && it->second.reset(addr + i))
+            lineTrackers.erase(it);
     }
 }
 
@@ -38,16 +38,16 @@
 #ifndef __MEM_MEM_CHECKER_HH__
 #define __MEM_MEM_CHECKER_HH__
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
-#include <list>
-#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "base/cprintf.hh"
-#include "base/named.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "debug/MemChecker.hh"
@@ -70,6 +70,10 @@ namespace gem5
  * on the particular location, and we do not consider the effect of multi-byte
  * reads or writes. This precludes us from discovering single-copy atomicity
  * violations.
+ *
+ * The per-byte state is grouped by line, so that a transaction looks up
+ * each line it touches once, and only the bytes of a line that have been
+ * accessed get a ByteTracker.
 */
 class MemChecker : public SimObject
 {
@@ -184,31 +188,49 @@ class MemChecker : public SimObject
         Tick complete;  //!< Completion of last write in cluster
 
         /**
-         * Map of Serial --> Transaction of all writes in cluster; contains
-         * all, in-flight or already completed.
+         * All writes in cluster, in-flight or already completed, in the order
+         * they were started. Clusters only hold a few writes, so a vector is
+         * both smaller and faster to search than a map.
          */
-        std::unordered_map<Serial, Transaction> writes;
+        std::vector<Transaction> writes;
 
       private:
+        /**
+         * Find a write of this cluster.
+         *
+         * @param serial Unique identifier of the write.
+         * @return Iterator to the write, or writes.end() if it is not found.
+         */
+        std::vector<Transaction>::iterator
+        findWrite(Serial serial)
+        {
+            return std::find_if(writes.begin(), writes.end(),
+                [serial](const Transaction &t) { return t.serial == serial; });
+        }
+
         Tick completeMax;
         size_t numIncomplete;
     };
 
-    typedef std::list<Transaction> TransactionList;
-    typedef std::list<WriteCluster> WriteClusterList;
+    /**
+     * The transactions of a ByteTracker are pruned down to a handful after
+     * every completion, so they are kept in vectors rather than lists to
+     * avoid a heap allocation per transaction.
+     */
+    typedef std::vector<Transaction> TransactionList;
+    typedef std::vector<WriteCluster> WriteClusterList;
 
     /**
      * The ByteTracker keeps track of transactions for the *same byte* -- all
      * outstanding reads, the completed reads (and what they observed) and write
      * clusters (see WriteCluster).
      */
-    class ByteTracker : public Named
+    class ByteTracker
     {
       public:
 
-        ByteTracker(Addr addr = 0, const MemChecker *parent = NULL)
-            : Named((parent != NULL ? parent->name() : "") +
-                     csprintf(".ByteTracker@%#llx", addr))
+        ByteTracker(Addr _addr = 0, const MemChecker *_parent = NULL)
+            : addr(_addr), parent(_parent)
         {
             // The initial transaction has start == complete == TICK_INITIAL,
             // indicating that there has been no real write to this location;
@@ -301,6 +323,17 @@ class MemChecker : public SimObject
         const std::vector<uint8_t>& lastExpectedData() const
         { return _lastExpectedData; }
 
+        /**
+         * The name is only needed for debug output, so it is built on demand
+         * instead of being stored in every tracker.
+         */
+        std::string
+        name() const
+        {
+            return (parent != NULL ? parent->name() : "") +
+                csprintf(".ByteTracker@%#llx", addr);
+        }
+
       private:
 
         /**
@@ -347,14 +380,18 @@ class MemChecker : public SimObject
         void pruneTransactions();
 
       private:
+        /** Address of the tracked byte */
+        Addr addr;
+
+        /** The checker this tracker belongs to, used for its name */
+        const MemChecker *parent;
 
         /**
-         * Maintains a map of Serial -> Transaction for all outstanding reads.
-         *
-         * Use an ordered map here, as this makes pruneTransactions() more
-         * efficient (find first outstanding read).
+         * All outstanding reads, ordered by serial. Serials are handed out in
+         * increasing order, so starting a read appends to the vector, and
+         * pruneTransactions() finds the first outstanding read at the front.
          */
-        std::map<Serial, Transaction> outstandingReads;
+        TransactionList outstandingReads;
 
         /**
          * List of completed reads, i.e. observations of reads.
@@ -452,7 +489,7 @@ class MemChecker : public SimObject
      * the reset with serial S.
      */
     void reset()
-    { byte_trackers.clear(); }
+    { lineTrackers.clear(); }
 
     /**
      * Resets an address-range. This may be useful in case other unmonitored
@@ -476,19 +513,87 @@ class MemChecker : public SimObject
     const std::string& getErrorMessage() const { return errorMessage; }
 
   private:
+    /** Number of bits of the offset of a byte within a line */
+    static constexpr unsigned lineBits = 6;
+
+    /** Number of bytes tracked by a LineTracker */
+    static constexpr Addr lineSize = Addr(1) << lineBits;
+
     /**
-     * Returns the instance of ByteTracker for the requested location.
+     * The LineTracker holds the ByteTrackers of one line. The trackers are
+     * allocated on the first access to their byte, and the mask records
+     * which of them exist.
      */
-    ByteTracker* getByteTracker(Addr addr)
+    class LineTracker
     {
-        auto it = byte_trackers.find(addr);
-        if (it == byte_trackers.end()) {
-            it = byte_trackers.insert(
-                std::make_pair(addr, ByteTracker(addr, this))).first;
+      public:
+        /**
+         * Returns the ByteTracker of a byte of this line, allocating it if
+         * needed.
+         *
+         * @param addr   Address of the byte.
+         * @param parent The checker, used to name a new tracker.
+         */
+        ByteTracker*
+        getByteTracker(Addr addr, const MemChecker *parent)
+        {
+            const unsigned offset = addr & (lineSize - 1);
+            if (!bytes[offset]) {
+                bytes[offset] = std::make_unique<ByteTracker>(addr, parent);
+                byteMask |= uint64_t(1) << offset;
+            }
+            return bytes[offset].get();
         }
-        return &it->second;
+
+        /**
+         * Drops the state of a byte of this line.
+         *
+         * @param addr Address of the byte.
+         * @return True if the line no longer tracks any byte.
+         */
+        bool
+        reset(Addr addr)
+        {
+            const unsigned offset = addr & (lineSize - 1);
+            bytes[offset].reset();
+            byteMask &= ~(uint64_t(1) << offset);
+            return byteMask == 0;
+        }
+
+      private:
+        /** The trackers of the bytes of the line, indexed by offset */
+        std::array<std::unique_ptr<ByteTracker>, lineSize> bytes;
+
+        /** One bit per byte that has a tracker */
+        uint64_t byteMask = 0;
     };
 
+    static_assert(lineSize <= 64, "The byte mask is a uint64_t");
+
+    /**
+     * Applies a function to the ByteTracker of each byte of a range, looking
+     * up each line of the range only once.
+     *
+     * @param addr Address of the first byte.
+     * @param size Number of bytes.
+     * @param f    Function called with the index of the byte in the range
+     *             and its tracker.
+     */
+    template <class F>
+    void
+    forEachByteTracker(Addr addr, size_t size, F f)
+    {
+        size_t i = 0;
+        while (i < size) {
+            const Addr byte_addr = addr + i;
+            LineTracker &line = lineTrackers[byte_addr >> lineBits];
+            const size_t line_end = std::min<size_t>(size,
+                i + lineSize - (byte_addr & (lineSize - 1)));
+            for (; i < line_end; ++i)
+                f(i, line.getByteTracker(addr + i, this));
+        }
+    }
+
   private:
     /**
      * Detailed error message of the last violation in completeRead.
@@ -502,7 +607,7 @@ class MemChecker : public SimObject
     Serial nextSerial;
 
     /**
-     * Maintain a map of address --> byte-tracker. Per-byte entries are
+     * Maintain a map of line number --> line-tracker. Per-byte entries are
      * initialized as needed.
      *
      * The required space for this obviously grows with the number of distinct
@@ -510,9 +615,9 @@ class MemChecker : public SimObject
      * the number of nodes in the system, those may affect the size of per-byte
      * tracking information.
      *
-     * Access via getByteTracker()!
+     * Access via forEachByteTracker()!
      */
-    std::unordered_map<Addr, ByteTracker> byte_trackers;
+    std::unordered_map<Addr, LineTracker> lineTrackers;
 };
 
 inline MemChecker::Serial
@@ -522,9 +627,9 @@ MemChecker::startRead(Tick start, Addr addr, size_t size)
             "starting read: serial = %d, start = %d, addr = %#llx, "
             "size = %d\n", nextSerial, start, addr , size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->startRead(nextSerial, start);
-    }
+    forEachByteTracker(addr, size, [this, start](size_t, ByteTracker *t) {
+        t->startRead(nextSerial, start);
+    });
 
     return nextSerial++;
 }
@@ -536,9 +641,10 @@ MemChecker::startWrite(Tick start, Addr addr, size_t size, const uint8_t *data)
             "starting write: serial = %d, start = %d, addr = %#llx, "
             "size = %d\n", nextSerial, start, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->startWrite(nextSerial, start, data[i]);
-    }
+    forEachByteTracker(addr, size,
+        [this, start, data](size_t i, ByteTracker *t) {
+            t->startWrite(nextSerial, start, data[i]);
+        });
 
     return nextSerial++;
 }
@@ -551,9 +657,9 @@ MemChecker::completeWrite(MemChecker::Serial serial, Tick complete,
             "completing write: serial = %d, complete = %d, "
             "addr = %#llx, size = %d\n", serial, complete, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->completeWrite(serial, complete);
-    }
+    forEachByteTracker(addr, size, [serial, complete](size_t, ByteTracker *t) {
+        t->completeWrite(serial, complete);
+    });
 }
 
 inline void
@@ -563,9 +669,9 @@ MemChecker::abortWrite(MemChecker::Serial serial, Addr addr, size_t size)
             "aborting write: serial = %d, addr = %#llx, size = %d\n",
             serial, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->abortWrite(serial);
-    }
+    forEachByteTracker(addr, size, [serial](size_t, ByteTracker *t) {
+        t->abortWrite(serial);
+    });
 }
 
 } // namespace gem5
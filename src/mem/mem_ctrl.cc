@@ -40,6 +40,8 @@
 
 #include "mem/mem_ctrl.hh"
 
+#include <algorithm>
+
 #include "base/trace.hh"
 #include "debug/DRAM.hh"
 #include "debug/Drain.hh"
@@ -57,6 +59,59 @@ namespace gem5
 namespace memory
 {
 
+const MemPacketQueue::Entry *
+MemPacketQueue::BankQueue::oldestConflict(uint32_t row) const
+{
+    const Entry *oldest = nullptr;
+    for (const auto &r : rows) {
+        if (r.first != row &&
+            (!oldest || r.second.front().seqNum < oldest->seqNum)) {
+            oldest = &r.second.front();
+        }
+    }
+    return oldest;
+}
+
+MemPacketQueue::BankQueue &
+MemPacketQueue::bankQueue(const MemPacket *mem_pkt)
+{
+    const size_t channel = mem_pkt->pseudoChannel * 2 + mem_pkt->isDram();
+    if (channel >= banks.size())
+        banks.resize(channel + 1);
+    if (mem_pkt->bankId >= banks[channel].size())
+        banks[channel].resize(mem_pkt->bankId + 1);
+    return banks[channel][mem_pkt->bankId];
+}
+
+void
+MemPacketQueue::push_back(MemPacket *mem_pkt)
+{
+    BankQueue &bank_queue = bankQueue(mem_pkt);
+    bank_queue.rows[mem_pkt->row].push_back(
+        {nextSeqNum++, packets.insert(packets.end(), mem_pkt)});
+    ++bank_queue.numPackets;
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator it)
+{
+    BankQueue &bank_queue = bankQueue(*it);
+    auto row = bank_queue.rows.find((*it)->row);
+    assert(row != bank_queue.rows.end());
+
+    // The packets are mostly scheduled oldest first within a row
+    RowQueue &row_queue = row->second;
+    auto entry = std::find_if(row_queue.begin(), row_queue.end(),
+                              [it](const Entry &e) { return e.pkt == it; });
+    assert(entry != row_queue.end());
+    row_queue.erase(entry);
+    if (row_queue.empty())
+        bank_queue.rows.erase(row);
+    --bank_queue.numPackets;
+
+    return packets.erase(it);
+}
+
 MemCtrl::MemCtrl(const MemCtrlParams &p) :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
@@ -486,7 +541,7 @@ MemCtrl::recvTimingReq(PacketPtr pkt)
 
 void
 MemCtrl::processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
@@ -879,7 +934,7 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
 
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
-                        MemPacketQueue& resp_queue,
+                        std::deque<MemPacket*>& resp_queue,
                         EventFunctionWrapper& resp_event,
                         EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
@@ -47,7 +47,9 @@
 #define __MEM_CTRL_HH__
 
 #include <deque>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -215,9 +217,120 @@ class MemPacket
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
+/**
+ * A queue of memory packets, in the order they were queued. The packets
+ * are also indexed by bank and row, so that the scheduler can find the
+ * row hits and the banks with waiting packets without searching the
+ * whole queue.
+ */
+class MemPacketQueue
+{
+  private:
+    typedef std::list<MemPacket*> Packets;
+
+  public:
+    typedef Packets::iterator iterator;
+    typedef Packets::const_iterator const_iterator;
+
+    struct Entry
+    {
+        /** The position of the packet in the queue as a whole */
+        uint64_t seqNum;
+
+        /** The packet in the queue */
+        iterator pkt;
+    };
+
+    /** The packets waiting for a row, oldest first */
+    typedef std::list<Entry> RowQueue;
+
+    /** The packets waiting for a bank */
+    class BankQueue
+    {
+      public:
+        /**
+         * @param row The row to get the packets of.
+         * @return The packets waiting for the row, or nullptr if none.
+         */
+        const RowQueue *
+        rowQueue(uint32_t row) const
+        {
+            auto it = rows.find(row);
+            return it == rows.end() ? nullptr : &it->second;
+        }
+
+        /**
+         * @param row The open row of the bank.
+         * @return The oldest packet waiting for another row, or nullptr
+         * if none.
+         */
+        const Entry *oldestConflict(uint32_t row) const;
+
+        /** @return The number of rows with waiting packets. */
+        size_t numRows() const { return rows.size(); }
+
+        /** @return The number of waiting packets. */
+        size_t size() const { return numPackets; }
+
+      private:
+        friend class MemPacketQueue;
+
+        std::unordered_map<uint32_t, RowQueue> rows;
+        size_t numPackets = 0;
+    };
+
+    MemPacketQueue() = default;
+
+    // The index refers to the packets by their list iterators
+    MemPacketQueue(const MemPacketQueue &) = delete;
+    MemPacketQueue &operator=(const MemPacketQueue &) = delete;
+    MemPacketQueue(MemPacketQueue &&) = default;
+    MemPacketQueue &operator=(MemPacketQueue &&) = default;
+
+    iterator begin() { return packets.begin(); }
+    iterator end() { return packets.end(); }
+    const_iterator begin() const { return packets.begin(); }
+    const_iterator end() const { return packets.end(); }
+
+    size_t size() const { return packets.size(); }
+    bool empty() const { return packets.empty(); }
+
+    MemPacket *front() const { return packets.front(); }
+    MemPacket *back() const { return packets.back(); }
+
+    void push_back(MemPacket *mem_pkt);
+
+    iterator erase(iterator it);
+
+    /**
+     * Get the packets waiting for a bank.
+     *
+     * @param is_dram Whether the bank is a DRAM or an NVM one.
+     * @param pseudo_channel The pseudo channel of the bank.
+     * @param bank_id The id of the bank, across all the ranks.
+     * @return The packets waiting for the bank, or nullptr if none.
+     */
+    const BankQueue *
+    bankQueue(bool is_dram, uint8_t pseudo_channel, uint16_t bank_id) const
+    {
+        const size_t channel = pseudo_channel * 2 + is_dram;
+        if (channel >= banks.size() || bank_id >= banks[channel].size())
+            return nullptr;
+        const BankQueue &bank_queue = banks[channel][bank_id];
+        return bank_queue.size() ? &bank_queue : nullptr;
+    }
+
+  private:
+    BankQueue &bankQueue(const MemPacket *mem_pkt);
+
+    Packets packets;
+
+    /** The bank queues, per pseudo channel and memory type, and bank */
+    std::vector<std::vector<BankQueue>> banks;
+
+    /** The sequence number of the next packet queued */
+    uint64_t nextSeqNum = 0;
+};
 
 
 /**
@@ -300,14 +413,14 @@ class MemCtrl : public qos::MemCtrl
      * in these methods
      */
     virtual void processNextReqEvent(MemInterface* mem_intr,
-                          MemPacketQueue& resp_queue,
+                          std::deque<MemPacket*>& resp_queue,
                           EventFunctionWrapper& resp_event,
                           EventFunctionWrapper& next_req_event,
                           bool& retry_wr_req);
     EventFunctionWrapper nextReqEvent;
 
     virtual void processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req);
     EventFunctionWrapper respondEvent;
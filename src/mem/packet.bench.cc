@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+
+using namespace gem5;
+
+// Requests record the tick they were created at.
+GTestTickHandler tickHandler;
+
+/** Create and destroy a read request packet, as a CPU does for a load. */
+static void
+BM_PacketCreateRead(benchmark::State &state)
+{
+    for (auto _ : state) {
+        RequestPtr req = Request::make(0x1000, 64, 0, 0);
+        PacketPtr pkt = Packet::createRead(req);
+        pkt->allocate();
+        benchmark::DoNotOptimize(pkt);
+        delete pkt;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PacketCreateRead);
+
+/**
+ * Create a packet for an existing request and turn it into a response,
+ * as a memory access to a cache line does.
+ */
+static void
+BM_PacketRequestResponse(benchmark::State &state)
+{
+    RequestPtr req = Request::make(0x1000, 64, 0, 0);
+    for (auto _ : state) {
+        PacketPtr pkt = new Packet(req, MemCmd::ReadReq, 64);
+        pkt->allocate();
+        pkt->makeResponse();
+        benchmark::DoNotOptimize(pkt->getConstPtr<uint8_t>());
+        delete pkt;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PacketRequestResponse);
+
+/** Copy a write packet with its data, as the caches do for snoops. */
+static void
+BM_PacketCopy(benchmark::State &state)
+{
+    RequestPtr req = Request::make(0x1000, state.range(0), 0, 0);
+    PacketPtr orig = Packet::createWrite(req);
+    orig->allocate();
+
+    for (auto _ : state) {
+        PacketPtr pkt = new Packet(orig, false, true);
+        benchmark::DoNotOptimize(pkt);
+        delete pkt;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    delete orig;
+}
+BENCHMARK(BM_PacketCopy)->Arg(8)->Arg(64)->Arg(4096);
@@ -57,6 +57,7 @@
 #include "base/compiler.hh"
 #include "base/extensible.hh"
 #include "base/flags.hh"
+#include "base/free_list.hh"
 #include "base/logging.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
@@ -298,6 +299,12 @@ class Packet : public Printable, public Extensible<Packet>
     typedef gem5::Flags<FlagsType> Flags;
 
   private:
+    /**
+     * Payloads up to this size are allocated from a free list. This
+     * covers a cache line for the common block sizes.
+     */
+    static constexpr unsigned PooledDataSize = 64;
+    typedef FreeList<PooledDataSize> DataFreeList;
     enum : FlagsType
     {
         // Flags to transfer across when copying a packet
@@ -353,6 +360,10 @@ class Packet : public Printable, public Extensible<Packet>
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The dynamic data was allocated from the small data free
+        /// list rather than with new [], and is returned to it when
+        /// the packet is destroyed.
+        POOLED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -1054,6 +1065,29 @@ class Packet : public Printable, public Extensible<Packet>
         deleteData();
     }
 
+    /**
+     * Packets are allocated and destroyed at a very high rate, so they
+     * are recycled through a per-thread free list rather than going to
+     * the system allocator every time. Classes derived from Packet
+     * that are larger fall back to the global allocator.
+     */
+    static void *
+    operator new(size_t size)
+    {
+        if (size == sizeof(Packet))
+            return FreeList<sizeof(Packet)>::allocate();
+        return ::operator new(size);
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size == sizeof(Packet))
+            FreeList<sizeof(Packet)>::release(p);
+        else
+            ::operator delete(p);
+    }
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1322,7 +1356,9 @@ class Packet : public Printable, public Extensible<Packet>
     writeData(uint8_t *p) const
     {
         if (!isMaskedWrite()) {
-            std::memcpy(p, getConstPtr<uint8_t>(), getSize());
+            // packets with static data may point at the destination
+            if (p != getConstPtr<uint8_t>())
+                std::memcpy(p, getConstPtr<uint8_t>(), getSize());
         } else {
             assert(req->getByteEnable().size() == getSize());
             // Write only the enabled bytes
@@ -1355,10 +1391,12 @@ class Packet : public Printable, public Extensible<Packet>
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(POOLED_DATA))
+            DataFreeList::release(data);
+        else if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|POOLED_DATA);
         data = NULL;
     }
 
@@ -1370,8 +1408,13 @@ class Packet : public Printable, public Extensible<Packet>
         // payload, actually allocate space
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
-            flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= PooledDataSize) {
+                flags.set(DYNAMIC_DATA|POOLED_DATA);
+                data = static_cast<PacketDataPtr>(DataFreeList::allocate());
+            } else {
+                flags.set(DYNAMIC_DATA);
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
@@ -44,30 +44,73 @@
 namespace gem5
 {
 
+EmulationPageTable::Leaf *
+EmulationPageTable::findLeaf(Addr leaf_num) const
+{
+    if (leaf_num != lastLeafNum) {
+        auto it = pTable.find(leaf_num);
+        if (it == pTable.end())
+            return nullptr;
+        if (inParallelMode)
+            return it->second.get();
+        lastLeafNum = leaf_num;
+        lastLeaf = it->second.get();
+    }
+    return lastLeaf;
+}
+
+EmulationPageTable::Leaf &
+EmulationPageTable::getLeaf(Addr leaf_num)
+{
+    Leaf *leaf = findLeaf(leaf_num);
+    if (!leaf) {
+        auto &ptr = pTable[leaf_num];
+        ptr.reset(new Leaf);
+        leaf = ptr.get();
+        lastLeafNum = leaf_num;
+        lastLeaf = leaf;
+    }
+    return *leaf;
+}
+
+void
+EmulationPageTable::dropLeaf(Addr leaf_num)
+{
+    if (leaf_num == lastLeafNum) {
+        lastLeafNum = MaxAddr;
+        lastLeaf = nullptr;
+    }
+    pTable.erase(leaf_num);
+}
+
 void
 EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 {
     bool clobber = flags & Clobber;
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
+    auto lock = lockTable<WriteLock>();
 
     DPRINTF(MMU, "Allocating Page: %#x-%#x\n", vaddr, vaddr + size);
 
     while (size > 0) {
-        auto it = pTable.find(vaddr);
-        if (it != pTable.end()) {
-            // already mapped
-            panic_if(!clobber,
-                     "EmulationPageTable::allocate: addr %#x already mapped",
-                     vaddr);
-            it->second = Entry(paddr, flags);
-        } else {
-            pTable.emplace(vaddr, Entry(paddr, flags));
+        Leaf &leaf = getLeaf(leafNum(vaddr));
+        for (unsigned i = leafIndex(vaddr); i < LeafPages && size > 0; i++) {
+            if (leaf.valid[i]) {
+                // already mapped
+                panic_if(!clobber,
+                         "EmulationPageTable::allocate: addr %#x already "
+                         "mapped", vaddr);
+            } else {
+                leaf.valid[i] = true;
+                numPages++;
+            }
+            leaf.entries[i] = Entry(paddr, flags);
+
+            size -= _pageSize;
+            vaddr += _pageSize;
+            paddr += _pageSize;
         }
-
-        size -= _pageSize;
-        vaddr += _pageSize;
-        paddr += _pageSize;
     }
 }
 
@@ -76,17 +119,26 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 {
     assert(pageOffset(vaddr) == 0);
     assert(pageOffset(new_vaddr) == 0);
+    auto lock = lockTable<WriteLock>();
 
     DPRINTF(MMU, "moving pages from vaddr %08p to %08p, size = %d\n", vaddr,
             new_vaddr, size);
 
     while (size > 0) {
-        [[maybe_unused]] auto new_it = pTable.find(new_vaddr);
-        auto old_it = pTable.find(vaddr);
-        assert(old_it != pTable.end() && new_it == pTable.end());
+        Leaf *old_leaf = findLeaf(leafNum(vaddr));
+        const unsigned old_i = leafIndex(vaddr);
+        assert(old_leaf && old_leaf->valid[old_i]);
+        const Entry entry = old_leaf->entries[old_i];
+        old_leaf->valid[old_i] = false;
+        if (old_leaf->valid.none())
+            dropLeaf(leafNum(vaddr));
+
+        Leaf &new_leaf = getLeaf(leafNum(new_vaddr));
+        const unsigned new_i = leafIndex(new_vaddr);
+        assert(!new_leaf.valid[new_i]);
+        new_leaf.valid[new_i] = true;
+        new_leaf.entries[new_i] = entry;
 
-        pTable.emplace(new_vaddr, old_it->second);
-        pTable.erase(old_it);
         size -= _pageSize;
         vaddr += _pageSize;
         new_vaddr += _pageSize;
@@ -96,23 +148,44 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 void
 EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 {
-    for (auto &iter : pTable)
-        addr_maps->push_back(std::make_pair(iter.first, iter.second.paddr));
+    auto lock = lockTable<ReadLock>();
+    forEachEntry([addr_maps](Addr vaddr, const Entry &entry) {
+        addr_maps->push_back(std::make_pair(vaddr, entry.paddr));
+    });
 }
 
 void
 EmulationPageTable::unmap(Addr vaddr, int64_t size)
 {
     assert(pageOffset(vaddr) == 0);
+    auto lock = lockTable<WriteLock>();
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
 
+    const int64_t leaf_size = _pageSize * LeafPages;
     while (size > 0) {
-        auto it = pTable.find(vaddr);
-        assert(it != pTable.end());
-        pTable.erase(it);
-        size -= _pageSize;
-        vaddr += _pageSize;
+        const Addr leaf_num = leafNum(vaddr);
+        Leaf *leaf = findLeaf(leaf_num);
+        assert(leaf);
+        unsigned i = leafIndex(vaddr);
+        if (i == 0 && size >= leaf_size) {
+            // The whole leaf goes
+            assert(leaf->valid.all());
+            numPages -= LeafPages;
+            size -= leaf_size;
+            vaddr += leaf_size;
+        } else {
+            for (; i < LeafPages && size > 0; i++) {
+                assert(leaf->valid[i]);
+                leaf->valid[i] = false;
+                numPages--;
+                size -= _pageSize;
+                vaddr += _pageSize;
+            }
+            if (leaf->valid.any())
+                continue;
+        }
+        dropLeaf(leaf_num);
     }
 }
 
@@ -121,28 +194,42 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 {
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
+    auto lock = lockTable<ReadLock>();
 
-    for (int64_t offset = 0; offset < size; offset += _pageSize)
-        if (pTable.find(vaddr + offset) != pTable.end())
-            return false;
+    while (size > 0) {
+        Leaf *leaf = findLeaf(leafNum(vaddr));
+        for (unsigned i = leafIndex(vaddr); i < LeafPages && size > 0; i++) {
+            if (leaf && leaf->valid[i])
+                return false;
+            size -= _pageSize;
+            vaddr += _pageSize;
+        }
+    }
 
     return true;
 }
 
 const EmulationPageTable::Entry *
-EmulationPageTable::lookup(Addr vaddr)
+EmulationPageTable::lookupLocked(Addr vaddr) const
 {
-    Addr page_addr = pageAlign(vaddr);
-    PTableItr iter = pTable.find(page_addr);
-    if (iter == pTable.end())
+    Leaf *leaf = findLeaf(leafNum(vaddr));
+    const unsigned i = leafIndex(vaddr);
+    if (!leaf || !leaf->valid[i])
         return nullptr;
-    return &(iter->second);
+    return &leaf->entries[i];
+}
+
+const EmulationPageTable::Entry *
+EmulationPageTable::lookup(Addr vaddr)
+{
+    auto lock = lockTable<ReadLock>();
+    return lookupLocked(vaddr);
 }
 
 bool
-EmulationPageTable::translate(Addr vaddr, Addr &paddr)
+EmulationPageTable::translateLocked(Addr vaddr, Addr &paddr) const
 {
-    const Entry *entry = lookup(vaddr);
+    const Entry *entry = lookupLocked(vaddr);
     if (!entry) {
         DPRINTF(MMU, "Couldn't Translate: %#x\n", vaddr);
         return false;
@@ -152,6 +239,13 @@ EmulationPageTable::translate(Addr vaddr, Addr &paddr)
     return true;
 }
 
+bool
+EmulationPageTable::translate(Addr vaddr, Addr &paddr)
+{
+    auto lock = lockTable<ReadLock>();
+    return translateLocked(vaddr, paddr);
+}
+
 Fault
 EmulationPageTable::translate(const RequestPtr &req)
 {
@@ -186,17 +280,18 @@ void
 EmulationPageTable::serialize(CheckpointOut &cp) const
 {
     ScopedCheckpointSection sec(cp, "ptable");
-    paramOut(cp, "size", pTable.size());
+    auto lock = lockTable<ReadLock>();
+    paramOut(cp, "size", numPages);
 
-    PTable::size_type count = 0;
-    for (auto &pte : pTable) {
+    size_t count = 0;
+    forEachEntry([&cp, &count](Addr vaddr, const Entry &entry) {
         ScopedCheckpointSection sec(cp, csprintf("Entry%d", count++));
 
-        paramOut(cp, "vaddr", pte.first);
-        paramOut(cp, "paddr", pte.second.paddr);
-        paramOut(cp, "flags", pte.second.flags);
-    }
-    assert(count == pTable.size());
+        paramOut(cp, "vaddr", vaddr);
+        paramOut(cp, "paddr", entry.paddr);
+        paramOut(cp, "flags", entry.flags);
+    });
+    assert(count == numPages);
 }
 
 void
@@ -216,7 +311,13 @@ EmulationPageTable::unserialize(CheckpointIn &cp)
         UNSERIALIZE_SCALAR(paddr);
         UNSERIALIZE_SCALAR(flags);
 
-        pTable.emplace(vaddr, Entry(paddr, flags));
+        Leaf &leaf = getLeaf(leafNum(vaddr));
+        const unsigned idx = leafIndex(vaddr);
+        if (!leaf.valid[idx]) {
+            leaf.valid[idx] = true;
+            leaf.entries[idx] = Entry(paddr, flags);
+            numPages++;
+        }
     }
 }
 
@@ -224,9 +325,10 @@ const std::string
 EmulationPageTable::externalize() const
 {
     std::stringstream ss;
-    for (PTable::const_iterator it=pTable.begin(); it != pTable.end(); ++it) {
-        ss << std::hex << it->first << ":" << it->second.paddr << ";";
-    }
+    auto lock = lockTable<ReadLock>();
+    forEachEntry([&ss](Addr vaddr, const Entry &entry) {
+        ss << std::hex << vaddr << ":" << entry.paddr << ";";
+    });
     return ss.str();
 }
 
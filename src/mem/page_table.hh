@@ -35,6 +35,10 @@
 #ifndef __MEM_PAGE_TABLE_HH__
 #define __MEM_PAGE_TABLE_HH__
 
+#include <array>
+#include <bitset>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -43,6 +47,7 @@
 #include "base/types.hh"
 #include "mem/request.hh"
 #include "mem/translation_gen.hh"
+#include "sim/eventq.hh"
 #include "sim/serialize.hh"
 
 namespace gem5
@@ -63,12 +68,91 @@ class EmulationPageTable : public Serializable
     };
 
   protected:
-    typedef std::unordered_map<Addr, Entry> PTable;
-    typedef PTable::iterator PTableItr;
+    /**
+     * The table is a two level radix tree, with the leaves holding the
+     * entries of a naturally aligned block of LeafPages pages, found by
+     * their leaf number (the page number shifted by LeafBits). Mapping
+     * and unmapping large regions only looks up one leaf every LeafPages
+     * pages, and the accesses of a program mostly hit the last leaf.
+     */
+    static constexpr unsigned LeafBits = 9;
+    static constexpr Addr LeafPages = Addr(1) << LeafBits;
+
+    struct Leaf
+    {
+        std::array<Entry, LeafPages> entries;
+        std::bitset<LeafPages> valid;
+    };
+
+    typedef std::unordered_map<Addr, std::unique_ptr<Leaf>> PTable;
     PTable pTable;
 
+    /** The number of mapped pages. */
+    size_t numPages = 0;
+
+    /**
+     * The leaf last looked up, and its number. Lookups made while the
+     * simulation runs on several threads use but don't update it.
+     */
+    mutable Leaf *lastLeaf = nullptr;
+    mutable Addr lastLeafNum = MaxAddr;
+
+    /**
+     * CPUs on different event queues may translate through the table
+     * while a syscall on another one changes it. In parallel mode,
+     * lookups hold this shared and changes hold it exclusively.
+     */
+    mutable std::shared_mutex mutex;
+
+    typedef std::shared_lock<std::shared_mutex> ReadLock;
+    typedef std::unique_lock<std::shared_mutex> WriteLock;
+
+    /** Take a lock on the table if more than one thread may use it. */
+    template <typename Lock>
+    Lock
+    lockTable() const
+    {
+        Lock lock(mutex, std::defer_lock);
+        if (inParallelMode)
+            lock.lock();
+        return lock;
+    }
+
     const Addr _pageSize;
     const Addr offsetMask;
+    const unsigned pageShift;
+
+    Addr leafNum(Addr vaddr) const { return vaddr >> (pageShift + LeafBits); }
+    unsigned
+    leafIndex(Addr vaddr) const
+    {
+        return (vaddr >> pageShift) & (LeafPages - 1);
+    }
+
+    /** Find the leaf with a number, nullptr if there isn't one. */
+    Leaf *findLeaf(Addr leaf_num) const;
+    /** Find the leaf with a number, creating it if there isn't one. */
+    Leaf &getLeaf(Addr leaf_num);
+    /** Free a leaf which has no entries left. */
+    void dropLeaf(Addr leaf_num);
+
+    /** Lookup and translate for callers which hold the table's lock. */
+    const Entry *lookupLocked(Addr vaddr) const;
+    bool translateLocked(Addr vaddr, Addr &paddr) const;
+
+    /** Call a function with the address and entry of each mapped page. */
+    template <typename F>
+    void
+    forEachEntry(F &&f) const
+    {
+        for (auto &[leaf_num, leaf] : pTable) {
+            const Addr base = leaf_num << (pageShift + LeafBits);
+            for (unsigned i = 0; i < LeafPages; i++) {
+                if (leaf->valid[i])
+                    f(base + (Addr(i) << pageShift), leaf->entries[i]);
+            }
+        }
+    }
 
     const uint64_t _pid;
     const std::string _name;
@@ -78,7 +162,8 @@ class EmulationPageTable : public Serializable
     EmulationPageTable(
             const std::string &__name, uint64_t _pid, Addr _pageSize) :
             _pageSize(_pageSize), offsetMask(mask(floorLog2(_pageSize))),
-            _pid(_pid), _name(__name), shared(false)
+            pageShift(floorLog2(_pageSize)), _pid(_pid), _name(__name),
+            shared(false)
     {
         assert(isPowerOf2(_pageSize));
     }
@@ -108,8 +193,8 @@ class EmulationPageTable : public Serializable
     // for DPRINTF compatibility
     const std::string name() const { return _name; }
 
-    Addr pageAlign(Addr a)  { return (a & ~offsetMask); }
-    Addr pageOffset(Addr a) { return (a &  offsetMask); }
+    Addr pageAlign(Addr a) const { return (a & ~offsetMask); }
+    Addr pageOffset(Addr a) const { return (a &  offsetMask); }
     // Page size can technically vary based on the virtual address, but we'll
     // ignore that for now.
     Addr pageSize()   { return _pageSize; }
@@ -38,23 +38,40 @@
 #include "mem/physical.hh"
 
 #include <fcntl.h>
+#include <sys/file.h>
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/user.h>
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <atomic>
 #include <climits>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <set>
 #include <string>
 
 #include "base/intmath.hh"
+#include "base/parallel.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
 #include "debug/Checkpoint.hh"
 #include "mem/abstract_mem.hh"
+#include "mem/lazy_restore.hh"
+#include "sim/host_mem.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_exit.hh"
 
@@ -76,13 +93,137 @@ namespace gem5
 namespace memory
 {
 
+namespace
+{
+
+// The uncompressed size of the chunks of chunked checkpoints
+const uint64_t checkpointChunkSize = 64 * 1024 * 1024;
+
+bool
+isZero(const uint8_t *data, uint64_t len)
+{
+    return len == 0 ||
+        (data[0] == 0 && std::memcmp(data, data + 1, len - 1) == 0);
+}
+
+/**
+ * Checkpoints written before raw images existed do not mark them, but
+ * an uncompressed image the size of the range can only be a raw one
+ * (gzread would read it verbatim anyway).
+ */
+bool
+isUnmarkedRawImage(const std::string &filepath, uint64_t range_size)
+{
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    unsigned char magic[2] = {};
+    bool raw = fstat(fd, &st) == 0 && (uint64_t)st.st_size == range_size &&
+        (pread(fd, magic, sizeof(magic), 0) != sizeof(magic) ||
+         magic[0] != 0x1f || magic[1] != 0x8b);
+    close(fd);
+    return raw;
+}
+
+bool
+pwriteAll(int fd, const uint8_t *data, uint64_t len, uint64_t offset)
+{
+    while (len) {
+        ssize_t written = pwrite(fd, data, std::min<uint64_t>(len, INT_MAX),
+                                 offset);
+        if (written <= 0)
+            return false;
+        data += written;
+        len -= written;
+        offset += written;
+    }
+    return true;
+}
+
+bool
+preadAll(int fd, uint8_t *data, uint64_t len, uint64_t offset)
+{
+    while (len) {
+        ssize_t bytes_read = pread(fd, data, std::min<uint64_t>(len, INT_MAX),
+                                   offset);
+        if (bytes_read <= 0)
+            return false;
+        data += bytes_read;
+        len -= bytes_read;
+        offset += bytes_read;
+    }
+    return true;
+}
+
+/**
+ * The size of the default hugetlbfs pages, which MAP_HUGETLB maps
+ * without a size flag, 0 if the host has none reserved.
+ */
+uint64_t
+defaultHugePageSize()
+{
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    uint64_t value;
+    uint64_t total = 0, size = 0;
+    while (meminfo >> key >> value) {
+        if (key == "HugePages_Total:")
+            total = value;
+        else if (key == "Hugepagesize:")
+            size = value * 1024;
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return total ? size : 0;
+}
+
+/**
+ * Bind host memory to a set of NUMA nodes. A single node gets all the
+ * pages, several nodes get the pages interleaved across them.
+ *
+ * @return true if the memory was bound
+ */
+bool
+bindToNodes(void *pmem, uint64_t size, const std::set<int> &nodes)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int word_bits = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> mask(*nodes.rbegin() / word_bits + 1, 0);
+    for (int node : nodes)
+        mask[node / word_bits] |= 1UL << (node % word_bits);
+
+    const int mode = nodes.size() == 1 ? MPOL_BIND : MPOL_INTERLEAVE;
+    return syscall(SYS_mbind, pmem, size, mode, mask.data(),
+                   mask.size() * word_bits + 1, 0) == 0;
+#else
+    errno = ENOSYS;
+    return false;
+#endif
+}
+
+} // anonymous namespace
+
 PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               enums::CheckpointMemoryFormat checkpoint_format,
+                               unsigned checkpoint_threads,
+                               bool lazy_checkpoint_restore,
+                               bool delta_checkpoints,
+                               BackingStoreHugePages huge_pages,
+                               bool prefault_backing_store,
+                               const std::string& shared_image_dir) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
+    hugePages(huge_pages), hugetlbPageSize(0),
+    prefault(prefault_backing_store), sharedImageDir(shared_image_dir),
+    checkpointFormat(checkpoint_format),
+    checkpointThreads(hostThreads(checkpoint_threads)),
+    lazyCheckpointRestore(lazy_checkpoint_restore),
+    deltaCheckpoints(delta_checkpoints), untrackedWrites(false),
     pageSize(sysconf(_SC_PAGE_SIZE))
 {
     // Register cleanup callback if requested.
@@ -93,6 +234,30 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
     if (mmap_using_noreserve)
         warn("Not reserving swap space. May cause SIGSEGV on actual usage\n");
 
+    // the shared images are mapped as the backing store, there is
+    // nothing left to restore on demand
+    fatal_if(lazyCheckpointRestore && !sharedImageDir.empty(),
+             "%s: Checkpoints can't be both restored lazily and through "
+             "shared images\n", name());
+
+    if (hugePages == BackingStoreHugePages::hugetlb) {
+        // the hugetlbfs pages can't be shared with other processes by
+        // name, replaced by a checkpoint image, or restored on demand
+        fatal_if(!sharedBackstore.empty(),
+                 "%s: hugetlb pages can't back a shared backing store\n",
+                 name());
+        fatal_if(checkpointFormat == enums::raw || lazyCheckpointRestore ||
+                 !sharedImageDir.empty(),
+                 "%s: hugetlb pages can't be used with raw, lazily "
+                 "restored or shared checkpoint images\n", name());
+#if defined(MAP_HUGETLB)
+        hugetlbPageSize = defaultHugePageSize();
+#endif
+        if (!hugetlbPageSize)
+            warn("%s: The host has no hugetlb pages, using transparent "
+                 "huge pages\n", name());
+    }
+
     // add the memories from the system to the address map as
     // appropriate
     for (const auto& m : _memories) {
@@ -131,6 +296,10 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
         }
     }
 
+    // the memories don't change after this, freeze the address map
+    // to make the lookups cheaper and thread-safe
+    addrMap.freeze();
+
     // iterate over the increasing addresses and chunks of contiguous
     // space to be mapped to backing store, create it and inform the
     // memories
@@ -238,35 +407,221 @@ PhysicalMemory::createBackingStore(
         map_flags |= MAP_NORESERVE;
     }
 
-    uint8_t* pmem = (uint8_t*) mmap(NULL, range.size(),
+#if defined(MAP_HUGETLB)
+    // a hugetlb mapping has to be a multiple of the huge page size
+    if (hugetlbPageSize)
+        map_flags |= MAP_HUGETLB;
+#endif
+    const uint64_t map_size = hugetlbPageSize ?
+        roundUp(range.size(), hugetlbPageSize) : range.size();
+
+    uint8_t* pmem = (uint8_t*) mmap(NULL, map_size,
                                     PROT_READ | PROT_WRITE,
                                     map_flags, shm_fd, map_offset);
 
     if (pmem == (uint8_t*) MAP_FAILED) {
         perror("mmap");
+        fatal_if(hugetlbPageSize, "Could not mmap %d bytes of hugetlb pages "
+                 "for range %s, are enough of them reserved?\n", map_size,
+                 range.to_string());
         fatal("Could not mmap %d bytes for range %s!\n", range.size(),
               range.to_string());
     }
 
+    // bind the backing store to the host nodes of its memories before
+    // any page is touched
+    std::set<int> nodes;
+    for (const auto& m : _memories) {
+        if (m->getHostNumaNode() >= 0)
+            nodes.insert(m->getHostNumaNode());
+    }
+    if (!nodes.empty() && !bindToNodes(pmem, map_size, nodes)) {
+        warn("%s: Could not bind the backing store for range %s to its "
+             "host NUMA nodes (errno: %i)\n", name(), range.to_string(),
+             errno);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if (hugePages != BackingStoreHugePages::none && !hugetlbPageSize &&
+        madvise(pmem, map_size, MADV_HUGEPAGE) == -1) {
+        warn("%s: Could not use transparent huge pages for range %s "
+             "(errno: %i)\n", name(), range.to_string(), errno);
+    }
+#else
+    warn_if(hugePages != BackingStoreHugePages::none,
+            "%s: Huge pages are not supported on this host\n", name());
+#endif
+
+    if (prefault) {
+        // write a byte of every page, in chunks on several host threads
+        // as faulting in a large memory takes a while
+        constexpr uint64_t chunk_size = 64 * 1024 * 1024;
+        const uint64_t pages_per_chunk = chunk_size / pageSize;
+        const uint64_t num_pages = divCeil(range.size(), pageSize);
+        DPRINTF(AddrRanges, "Pre-faulting %d pages for range %s\n",
+                num_pages, range.to_string());
+        parallelFor(checkpointThreads,
+                    divCeil(num_pages, pages_per_chunk), [&](size_t c) {
+            const uint64_t end =
+                std::min((c + 1) * pages_per_chunk, num_pages);
+            for (uint64_t page = c * pages_per_chunk; page < end; ++page)
+                *(volatile uint8_t *)(pmem + page * pageSize) = 0;
+        });
+    }
+
     // remember this backing store so we can checkpoint it and unmap
     // it appropriately
     backingStore.emplace_back(range, pmem,
                               conf_table_reported, in_addr_map, kvm_map,
                               shm_fd, map_offset);
 
+    // track the pages written for delta checkpoints
+    if (deltaCheckpoints) {
+        dirtyPages.emplace_back(
+            divCeil(range.size(), 1ULL << AbstractMemory::DirtyPageShift),
+            0);
+    }
+
     // point the memories to their backing store
     for (const auto& m : _memories) {
         DPRINTF(AddrRanges, "Mapping memory %s to backing store\n",
                 m->name());
         m->setBackingStore(pmem);
+        host_mem::account(m, "backingStore", m->size());
+        if (deltaCheckpoints)
+            m->trackDirtyPages(dirtyPages.back().data());
     }
 }
 
+void
+PhysicalMemory::untrackedWriter(const std::string &writer)
+{
+    if (deltaCheckpoints && !untrackedWrites) {
+        warn("%s: writes by %s cannot be tracked, checkpoints will not "
+             "be deltas\n", name(), writer);
+    }
+    untrackedWrites = true;
+    parentCheckpoint.clear();
+}
+
+bool
+PhysicalMemory::trackedWriter(std::function<void()> sync)
+{
+    if (!deltaCheckpoints || untrackedWrites)
+        return false;
+    writeTrackers.push_back(std::move(sync));
+    return true;
+}
+
+void
+PhysicalMemory::markWritten(Addr addr, Addr size) const
+{
+    if (!deltaCheckpoints || size == 0)
+        return;
+
+    for (int i = 0; i < backingStore.size(); ++i) {
+        const AddrRange &range = backingStore[i].range;
+        if (!range.contains(addr))
+            continue;
+        assert(range.contains(addr + size - 1));
+        constexpr unsigned shift = AbstractMemory::DirtyPageShift;
+        auto &dirty = dirtyPages[i];
+        std::fill(dirty.begin() + ((addr - range.start()) >> shift),
+                  dirty.begin() +
+                  ((addr + size - 1 - range.start()) >> shift) + 1, 1);
+        return;
+    }
+}
+
+uint8_t *
+PhysicalMemory::hostAddr(Addr addr, Addr size) const
+{
+    for (const auto &store : backingStore) {
+        if (store.inAddrMap && store.range.contains(addr) &&
+            store.range.contains(addr + size - 1)) {
+            return store.pmem + (addr - store.range.start());
+        }
+    }
+    return nullptr;
+}
+
+bool
+PhysicalMemory::writeBacking(Addr addr, const uint8_t *data, Addr size)
+{
+    if (size == 0)
+        return true;
+    uint8_t *host = hostAddr(addr, size);
+    if (!host)
+        return false;
+
+    std::memcpy(host, data, size);
+    markWritten(addr, size);
+    return true;
+}
+
+bool
+PhysicalMemory::zeroBacking(Addr addr, Addr size)
+{
+    if (size == 0)
+        return true;
+    uint8_t *host = hostAddr(addr, size);
+    if (!host)
+        return false;
+
+    // reading an untouched page of an anonymous mapping doesn't
+    // allocate it, so only write the pages that aren't zero already
+    Addr offset = 0;
+    while (offset < size) {
+        const Addr len = std::min<Addr>(
+            roundUp(addr + offset + 1, pageSize) - (addr + offset),
+            size - offset);
+        if (!isZero(host + offset, len)) {
+            std::memset(host + offset, 0, len);
+            markWritten(addr + offset, len);
+        }
+        offset += len;
+    }
+    return true;
+}
+
+void
+PhysicalMemory::completeLazyRestore()
+{
+    for (auto &lazy : lazyRestores)
+        lazy->complete();
+    lazyRestores.clear();
+}
+
+void
+PhysicalMemory::trackWritesSince(const std::string &cpt_dir) const
+{
+    if (!deltaCheckpoints || untrackedWrites)
+        return;
+
+    // the path is kept absolute so the children do not depend on the
+    // working directory
+    char *path = realpath(cpt_dir.c_str(), nullptr);
+    if (!path) {
+        parentCheckpoint.clear();
+        return;
+    }
+    parentCheckpoint = path;
+    free(path);
+
+    for (auto &dirty : dirtyPages)
+        std::fill(dirty.begin(), dirty.end(), 0);
+}
+
 PhysicalMemory::~PhysicalMemory()
 {
+    // stop restoring on demand before the backing store goes away
+    lazyRestores.clear();
+
     // unmap the backing store
-    for (auto& s : backingStore)
-        munmap((char*)s.pmem, s.range.size());
+    for (auto& s : backingStore) {
+        munmap((char*)s.pmem, hugetlbPageSize ?
+               roundUp(s.range.size(), hugetlbPageSize) : s.range.size());
+    }
 }
 
 bool
@@ -347,6 +702,10 @@ PhysicalMemory::serialize(CheckpointOut &cp) const
     SERIALIZE_CONTAINER(lal_addr);
     SERIALIZE_CONTAINER(lal_cid);
 
+    // get the writes which didn't go through the memories
+    for (auto &sync : writeTrackers)
+        sync();
+
     // serialize the backing stores
     unsigned int nbr_of_stores = backingStore.size();
     SERIALIZE_SCALAR(nbr_of_stores);
@@ -357,6 +716,9 @@ PhysicalMemory::serialize(CheckpointOut &cp) const
         ScopedCheckpointSection sec(cp, csprintf("store%d", store_id));
         serializeStore(cp, store_id++, s.range, s.pmem);
     }
+
+    // the next checkpoint only needs the pages written from now on
+    trackWritesSince(CheckpointIn::dir());
 }
 
 void
@@ -376,8 +738,47 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
-    // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
+
+    // checkpointing over the parent has to write everything again
+    std::string parent = parentCheckpoint;
+    char *cpt_dir = realpath(CheckpointIn::dir().c_str(), nullptr);
+    if (cpt_dir) {
+        if (parent == cpt_dir)
+            parent.clear();
+        free(cpt_dir);
+    }
+
+    if (!parent.empty()) {
+        std::string dirty_filename =
+            name() + ".store" + std::to_string(store_id) + ".dirty";
+        SERIALIZE_SCALAR(parent);
+        SERIALIZE_SCALAR(dirty_filename);
+        writeDeltaImage(filepath,
+                        CheckpointIn::dir() + "/" + dirty_filename, range,
+                        pmem, dirtyPages[store_id]);
+        return;
+    }
+
+    if (checkpointFormat == enums::raw) {
+        bool raw_image = true;
+        SERIALIZE_SCALAR(raw_image);
+        writeRawImage(filepath, range, pmem);
+        return;
+    }
+
+    if (checkpointFormat == enums::chunked_gzip) {
+        uint64_t chunk_size = checkpointChunkSize;
+        std::vector<uint64_t> chunk_offsets;
+        std::vector<uint64_t> chunk_sizes;
+        writeChunkedImage(filepath, range, pmem, chunk_offsets, chunk_sizes);
+        SERIALIZE_SCALAR(chunk_size);
+        SERIALIZE_CONTAINER(chunk_offsets);
+        SERIALIZE_CONTAINER(chunk_sizes);
+        return;
+    }
+
+    // write memory file
     gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
@@ -429,13 +830,14 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
         unserializeStore(cp);
     }
 
+    // the next checkpoint only needs the pages written from now on
+    trackWritesSince(cp.getCptDir());
+
 }
 
 void
 PhysicalMemory::unserializeStore(CheckpointIn &cp)
 {
-    const uint32_t chunk_size = 16384;
-
     unsigned int store_id;
     UNSERIALIZE_SCALAR(store_id);
 
@@ -443,13 +845,7 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
-    uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
 
     long range_size;
@@ -462,12 +858,73 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    // a delta is applied over its parent, which is restored from the
+    // same section of the parent checkpoint
+    std::string parent;
+    if (UNSERIALIZE_OPT_SCALAR(parent)) {
+        std::string dirty_filename;
+        UNSERIALIZE_SCALAR(dirty_filename);
+        DPRINTF(Checkpoint, "Restoring the parent %s of %s\n", parent,
+                filename);
+        CheckpointIn parent_cp(parent);
+        unserializeStore(parent_cp);
+        restoreDeltaImage(filepath, cp.getCptDir() + "/" + dirty_filename,
+                          store_id);
+        return;
+    }
+
+    bool raw_image = false;
+    UNSERIALIZE_OPT_SCALAR(raw_image);
+    uint64_t chunk_size = 0;
+    UNSERIALIZE_OPT_SCALAR(chunk_size);
+
+    if (!chunk_size &&
+        (raw_image || isUnmarkedRawImage(filepath, range.size()))) {
+        restoreRawImage(filepath, store_id);
+        return;
+    }
+
+    std::function<void()> restore;
+    if (chunk_size) {
+        std::vector<uint64_t> chunk_offsets;
+        std::vector<uint64_t> chunk_sizes;
+        UNSERIALIZE_CONTAINER(chunk_offsets);
+        UNSERIALIZE_CONTAINER(chunk_sizes);
+        restore = [=]() {
+            restoreChunkedImage(filepath, store_id, chunk_size,
+                                chunk_offsets, chunk_sizes);
+        };
+    } else {
+        restore = [=]() { restoreGzipImage(filepath, store_id); };
+    }
+
+    // a shared backing store has to stay backed by its shared memory
+    // segment, so it can't map a shared image
+    if (!sharedImageDir.empty() && backingStore[store_id].shmFd == -1)
+        restoreSharedImage(filepath, store_id, restore);
+    else
+        restore();
+}
+
+void
+PhysicalMemory::restoreGzipImage(const std::string &filepath,
+                                 unsigned int store_id)
+{
+    const uint32_t read_size = 16384;
+
+    uint8_t* pmem = backingStore[store_id].pmem;
+    AddrRange range = backingStore[store_id].range;
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filepath);
+
     uint64_t curr_size = 0;
-    long* temp_page = new long[chunk_size];
+    long* temp_page = new long[read_size];
     long* pmem_current;
     uint32_t bytes_read;
     while (curr_size < range.size()) {
-        bytes_read = gzread(compressed_mem, temp_page, chunk_size);
+        bytes_read = gzread(compressed_mem, temp_page, read_size);
         if (bytes_read == 0)
             break;
 
@@ -488,7 +945,391 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
 
     if (gzclose(compressed_mem))
         fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
+              filepath);
+}
+
+void
+PhysicalMemory::restoreSharedImage(const std::string &filepath,
+                                   unsigned int store_id,
+                                   const std::function<void()> &restore)
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+
+    // name the raw image after the compressed image it holds, so a
+    // changed checkpoint gets a new raw image
+    struct stat st;
+    char *path = realpath(filepath.c_str(), nullptr);
+    if (!path || stat(path, &st)) {
+        free(path);
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+    }
+    const std::string key = csprintf("%s:%d:%d:%d", path, st.st_size,
+                                     st.st_mtime, store.range.size());
+    free(path);
+    const std::string imagepath = csprintf("%s/%016x.raw", sharedImageDir,
+                                           std::hash<std::string>()(key));
+
+    // the first process to get the lock writes the raw image, which
+    // writeRawImage() renames into place once it is complete
+    const std::string lockpath = imagepath + ".lock";
+    int lock_fd = open(lockpath.c_str(), O_RDWR | O_CREAT, 0666);
+    if (lock_fd == -1 || flock(lock_fd, LOCK_EX))
+        fatal("Can't lock the shared physical memory image '%s'\n",
+              lockpath);
+
+    if (::access(imagepath.c_str(), F_OK) != 0) {
+        DPRINTF(Checkpoint, "Writing the shared image %s of %s\n",
+                imagepath, filepath);
+        restore();
+        writeRawImage(imagepath, store.range, store.pmem);
+    }
+
+    flock(lock_fd, LOCK_UN);
+    close(lock_fd);
+
+    DPRINTF(Checkpoint, "Mapping the shared image %s of %s\n", imagepath,
+            filepath);
+    restoreRawImage(imagepath, store_id);
+}
+
+void
+PhysicalMemory::writeRawImage(const std::string &filepath, AddrRange range,
+                              uint8_t* pmem) const
+{
+    // write to a new file and rename it into place, as the old image
+    // may still be mapped as the backing store it was restored into
+    std::string temppath = filepath + ".tmp";
+    int fd = open(temppath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    // write runs of non-zero pages, leaving the zero pages as holes
+    const uint64_t range_size = range.size();
+    uint64_t offset = 0;
+    while (offset < range_size) {
+        uint64_t end = offset;
+        while (end < range_size) {
+            uint64_t len = std::min<uint64_t>(pageSize, range_size - end);
+            if (isZero(pmem + end, len))
+                break;
+            end += len;
+        }
+
+        if (!pwriteAll(fd, pmem + offset, end - offset, offset))
+            fatal("Write failed on physical memory checkpoint file '%s'\n",
+                  filepath);
+        offset = end;
+
+        // skip the zero page ending the run
+        offset = std::min<uint64_t>(offset + pageSize, range_size);
+    }
+
+    if (ftruncate(fd, range_size) || close(fd))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              filepath);
+
+    if (rename(temppath.c_str(), filepath.c_str()))
+        fatal("Can't rename physical memory checkpoint file '%s'\n",
+              filepath);
+}
+
+void
+PhysicalMemory::restoreRawImage(const std::string &filepath,
+                                unsigned int store_id)
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    struct stat st;
+    if (fstat(fd, &st) || (uint64_t)st.st_size != store.range.size())
+        fatal("Physical memory checkpoint file '%s' does not match the "
+              "memory range size %lld\n", filepath, store.range.size());
+
+    if (store.shmFd == -1) {
+        // map the image copy-on-write over the backing store, which
+        // keeps its address, so pages are only read when touched and
+        // are shared with any other process restoring the same image
+        int map_flags = MAP_PRIVATE | MAP_FIXED;
+        if (mmapUsingNoReserve)
+            map_flags |= MAP_NORESERVE;
+
+        if (mmap(store.pmem, store.range.size(), PROT_READ | PROT_WRITE,
+                 map_flags, fd, 0) == MAP_FAILED) {
+            perror("mmap");
+            fatal("Could not mmap physical memory checkpoint file '%s'\n",
+                  filepath);
+        }
+    } else {
+        // a shared backing store has to stay backed by its shared
+        // memory segment, so copy the image into it instead
+        if (!preadAll(fd, store.pmem, store.range.size(), 0))
+            fatal("Read failed on physical memory checkpoint file '%s'\n",
+                  filepath);
+    }
+
+    close(fd);
+}
+
+void
+PhysicalMemory::writeChunkedImage(const std::string &filepath,
+                                  AddrRange range, uint8_t* pmem,
+                                  std::vector<uint64_t> &chunk_offsets,
+                                  std::vector<uint64_t> &chunk_sizes) const
+{
+    // as for raw images, the old file may still be mapped
+    std::string temppath = filepath + ".tmp";
+    int fd = open(temppath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    const uint64_t range_size = range.size();
+    const size_t num_chunks = divCeil(range_size, checkpointChunkSize);
+    chunk_offsets.assign(num_chunks, 0);
+    chunk_sizes.assign(num_chunks, 0);
+
+    // compress as many chunks as there are threads at a time, and
+    // write them in order, to bound the memory used for the buffers
+    std::vector<std::vector<uint8_t>> buffers(checkpointThreads);
+    std::atomic<bool> failed(false);
+    uint64_t file_offset = 0;
+    for (size_t first = 0; first < num_chunks; first += checkpointThreads) {
+        const size_t window =
+            std::min<size_t>(checkpointThreads, num_chunks - first);
+
+        parallelFor(checkpointThreads, window, [&](size_t i) {
+            const uint64_t offset = (first + i) * checkpointChunkSize;
+            const uint64_t len =
+                std::min(checkpointChunkSize, range_size - offset);
+            auto &buffer = buffers[i];
+            if (isZero(pmem + offset, len)) {
+                buffer.clear();
+                return;
+            }
+
+            uLongf compressed_len = compressBound(len);
+            buffer.resize(compressed_len);
+            if (compress2(buffer.data(), &compressed_len, pmem + offset,
+                          len, Z_DEFAULT_COMPRESSION) != Z_OK) {
+                failed = true;
+            }
+            buffer.resize(compressed_len);
+        });
+
+        if (failed)
+            fatal("Compression failed on physical memory checkpoint file "
+                  "'%s'\n", filepath);
+
+        for (size_t i = 0; i < window; ++i) {
+            const auto &buffer = buffers[i];
+            chunk_offsets[first + i] = file_offset;
+            chunk_sizes[first + i] = buffer.size();
+            if (!pwriteAll(fd, buffer.data(), buffer.size(), file_offset))
+                fatal("Write failed on physical memory checkpoint file "
+                      "'%s'\n", filepath);
+            file_offset += buffer.size();
+        }
+    }
+
+    if (close(fd))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              filepath);
+
+    if (rename(temppath.c_str(), filepath.c_str()))
+        fatal("Can't rename physical memory checkpoint file '%s'\n",
+              filepath);
+}
+
+void
+PhysicalMemory::restoreChunkedImage(const std::string &filepath,
+                                    unsigned int store_id,
+                                    uint64_t chunk_size,
+                                    const std::vector<uint64_t> &chunk_offsets,
+                                    const std::vector<uint64_t> &chunk_sizes)
+{
+    uint8_t* pmem = backingStore[store_id].pmem;
+    const uint64_t range_size = backingStore[store_id].range.size();
+    const size_t num_chunks = divCeil(range_size, chunk_size);
+    if (chunk_offsets.size() != num_chunks ||
+        chunk_sizes.size() != num_chunks) {
+        fatal("Physical memory checkpoint file '%s' has %d chunks, "
+              "expected %d\n", filepath, chunk_sizes.size(), num_chunks);
+    }
+
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    if (lazyCheckpointRestore) {
+        if (backingStore[store_id].shmFd != -1) {
+            warn("Restoring the shared backing store of %s eagerly\n",
+                 filepath);
+        } else {
+            auto lazy = std::make_unique<LazyRestore>(
+                fd, pmem, range_size, chunk_size, chunk_offsets,
+                chunk_sizes, pageSize);
+            if (lazy->start()) {
+                DPRINTF(Checkpoint, "Restoring %s on demand\n", filepath);
+                lazyRestores.push_back(std::move(lazy));
+                return;
+            }
+            warn("userfaultfd is not available, restoring %s eagerly\n",
+                 filepath);
+            // the lazy restore owns the image, so reopen it
+            lazy.reset();
+            fd = open(filepath.c_str(), O_RDONLY);
+            if (fd == -1)
+                fatal("Can't open physical memory checkpoint file '%s'\n",
+                      filepath);
+        }
+    }
+
+    std::atomic<bool> failed(false);
+    parallelFor(checkpointThreads, num_chunks, [&](size_t chunk) {
+        // chunks that are not stored are all zero, as is the backing
+        // store
+        if (!chunk_sizes[chunk] || failed)
+            return;
+
+        const uint64_t offset = chunk * chunk_size;
+        const uint64_t len = std::min(chunk_size, range_size - offset);
+        std::vector<uint8_t> compressed(chunk_sizes[chunk]);
+        std::vector<uint8_t> data(len);
+        uLongf data_len = len;
+        if (!preadAll(fd, compressed.data(), compressed.size(),
+                      chunk_offsets[chunk]) ||
+            uncompress(data.data(), &data_len, compressed.data(),
+                       compressed.size()) != Z_OK ||
+            data_len != len) {
+            failed = true;
+            return;
+        }
+
+        // only copy the non-zero pages, so we don't give the VM
+        // system hell
+        for (uint64_t page = 0; page < len; page += pageSize) {
+            const uint64_t page_len = std::min<uint64_t>(pageSize,
+                                                         len - page);
+            if (!isZero(data.data() + page, page_len))
+                std::memcpy(pmem + offset + page, data.data() + page,
+                            page_len);
+        }
+    });
+
+    close(fd);
+
+    if (failed)
+        fatal("Read failed on physical memory checkpoint file '%s'\n",
+              filepath);
+}
+
+void
+PhysicalMemory::writeDeltaImage(const std::string &filepath,
+                                const std::string &dirtypath,
+                                AddrRange range, uint8_t* pmem,
+                                const std::vector<uint8_t> &dirty_pages) const
+{
+    // as for raw images, the old files may still be in use
+    std::string temppath = filepath + ".tmp";
+    int fd = open(temppath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    // write runs of written pages, leaving the others as holes
+    const uint64_t range_size = range.size();
+    const uint64_t page_size = 1ULL << AbstractMemory::DirtyPageShift;
+    uint64_t written_pages = 0;
+    for (size_t page = 0; page < dirty_pages.size(); ) {
+        if (!dirty_pages[page]) {
+            ++page;
+            continue;
+        }
+
+        size_t end = page;
+        while (end < dirty_pages.size() && dirty_pages[end])
+            ++end;
+
+        const uint64_t offset = page * page_size;
+        const uint64_t len = std::min(end * page_size, range_size) - offset;
+        if (!pwriteAll(fd, pmem + offset, len, offset))
+            fatal("Write failed on physical memory checkpoint file '%s'\n",
+                  filepath);
+
+        written_pages += end - page;
+        page = end;
+    }
+
+    if (ftruncate(fd, range_size) || close(fd))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              filepath);
+
+    if (rename(temppath.c_str(), filepath.c_str()))
+        fatal("Can't rename physical memory checkpoint file '%s'\n",
+              filepath);
+
+    DPRINTF(Checkpoint, "Wrote %d of %d pages to delta image %s\n",
+            written_pages, dirty_pages.size(), filepath);
+
+    fd = open(dirtypath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1 ||
+        !pwriteAll(fd, dirty_pages.data(), dirty_pages.size(), 0) ||
+        close(fd)) {
+        fatal("Write failed on physical memory checkpoint file '%s'\n",
+              dirtypath);
+    }
+}
+
+void
+PhysicalMemory::restoreDeltaImage(const std::string &filepath,
+                                  const std::string &dirtypath,
+                                  unsigned int store_id)
+{
+    uint8_t* pmem = backingStore[store_id].pmem;
+    const uint64_t range_size = backingStore[store_id].range.size();
+    const uint64_t page_size = 1ULL << AbstractMemory::DirtyPageShift;
+
+    std::vector<uint8_t> dirty_pages(divCeil(range_size, page_size));
+    int fd = open(dirtypath.c_str(), O_RDONLY);
+    if (fd == -1 ||
+        !preadAll(fd, dirty_pages.data(), dirty_pages.size(), 0)) {
+        fatal("Read failed on physical memory checkpoint file '%s'\n",
+              dirtypath);
+    }
+    close(fd);
+
+    fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    for (size_t page = 0; page < dirty_pages.size(); ) {
+        if (!dirty_pages[page]) {
+            ++page;
+            continue;
+        }
+
+        size_t end = page;
+        while (end < dirty_pages.size() && dirty_pages[end])
+            ++end;
+
+        const uint64_t offset = page * page_size;
+        const uint64_t len = std::min(end * page_size, range_size) - offset;
+        if (!preadAll(fd, pmem + offset, len, offset))
+            fatal("Read failed on physical memory checkpoint file '%s'\n",
+                  filepath);
+
+        page = end;
+    }
+
+    close(fd);
 }
 
 } // namespace memory
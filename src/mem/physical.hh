@@ -39,11 +39,15 @@
 #define __MEM_PHYSICAL_HH__
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
+#include "enums/BackingStoreHugePages.hh"
+#include "enums/CheckpointMemoryFormat.hh"
 #include "mem/packet.hh"
 #include "sim/serialize.hh"
 
@@ -57,6 +61,7 @@ namespace memory
  * Forward declaration to avoid header dependencies.
  */
 class AbstractMemory;
+class LazyRestore;
 
 /**
  * A single entry for the backing store.
@@ -156,12 +161,53 @@ class PhysicalMemory : public Serializable
     const std::string sharedBackstore;
     uint64_t sharedBackstoreSize;
 
+    // Huge pages used for the backing store
+    const BackingStoreHugePages hugePages;
+
+    // Size of the hugetlbfs pages the backing store is mapped from, 0
+    // if it is mapped from small pages
+    uint64_t hugetlbPageSize;
+
+    // Populate the backing store when it is created
+    const bool prefault;
+
+    // Directory of the raw images shared by the processes restoring
+    // the same compressed checkpoint, empty if they are not shared
+    const std::string sharedImageDir;
+
+    // The format the backing store is checkpointed in
+    const enums::CheckpointMemoryFormat checkpointFormat;
+
+    // Host threads used for chunked checkpoints
+    const unsigned checkpointThreads;
+
+    // Restore chunked checkpoints on demand
+    const bool lazyCheckpointRestore;
+
+    // Checkpoint only the pages written since the previous checkpoint
+    const bool deltaCheckpoints;
+
+    // Set if some writes to the backing store cannot be tracked
+    bool untrackedWrites;
+
+    // The checkpoint the writes are tracked since, if any
+    mutable std::string parentCheckpoint;
+
+    // One byte per page of each backing store, set when it is written
+    mutable std::vector<std::vector<uint8_t>> dirtyPages;
+
+    // Report the writes of the writers tracking them themselves
+    std::vector<std::function<void()>> writeTrackers;
+
     long pageSize;
 
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
 
+    // The backing stores being restored on demand
+    std::vector<std::unique_ptr<LazyRestore>> lazyRestores;
+
     // Prevent copying
     PhysicalMemory(const PhysicalMemory&);
 
@@ -182,6 +228,130 @@ class PhysicalMemory : public Serializable
                             bool conf_table_reported,
                             bool in_addr_map, bool kvm_map);
 
+    /**
+     * Write a backing store as a raw image, the size of the range,
+     * leaving the all-zero pages as holes.
+     *
+     * @param filepath The path of the image
+     * @param range The address range of this backing store
+     * @param pmem The host pointer to this backing store
+     */
+    void writeRawImage(const std::string &filepath, AddrRange range,
+                       uint8_t* pmem) const;
+
+    /**
+     * Restore a backing store from a raw image. Unless the backing
+     * store is shared, the image is mapped copy-on-write in place of
+     * the backing store so the restore does not copy it.
+     *
+     * @param filepath The path of the image
+     * @param store_id Unique identifier of this backing store
+     */
+    void restoreRawImage(const std::string &filepath,
+                         unsigned int store_id);
+
+    /**
+     * Write a backing store as independently compressed chunks,
+     * compressing the chunks in parallel. All-zero chunks are not
+     * stored.
+     *
+     * @param filepath The path of the image
+     * @param range The address range of this backing store
+     * @param pmem The host pointer to this backing store
+     * @param chunk_offsets Set to the file offset of each chunk
+     * @param chunk_sizes Set to the compressed size of each chunk, 0
+     *                    for the chunks that are not stored
+     */
+    void writeChunkedImage(const std::string &filepath, AddrRange range,
+                           uint8_t* pmem,
+                           std::vector<uint64_t> &chunk_offsets,
+                           std::vector<uint64_t> &chunk_sizes) const;
+
+    /**
+     * Restore a backing store from independently compressed chunks,
+     * decompressing the chunks in parallel, or on demand if lazy
+     * restore is enabled.
+     *
+     * @param filepath The path of the image
+     * @param store_id Unique identifier of this backing store
+     * @param chunk_size The uncompressed size of each chunk
+     * @param chunk_offsets The file offset of each chunk
+     * @param chunk_sizes The compressed size of each chunk
+     */
+    void restoreChunkedImage(const std::string &filepath,
+                             unsigned int store_id, uint64_t chunk_size,
+                             const std::vector<uint64_t> &chunk_offsets,
+                             const std::vector<uint64_t> &chunk_sizes);
+
+    /**
+     * Restore a backing store from a gzip compressed image.
+     *
+     * @param filepath The path of the image
+     * @param store_id Unique identifier of this backing store
+     */
+    void restoreGzipImage(const std::string &filepath,
+                          unsigned int store_id);
+
+    /**
+     * Restore a backing store from a compressed image through a raw
+     * image in the shared image directory. The first process to
+     * restore the image decompresses it and writes the raw image, the
+     * others wait for it. All of them then map the raw image
+     * copy-on-write, so the host keeps a single copy of the pages
+     * that they don't write.
+     *
+     * @param filepath The path of the compressed image
+     * @param store_id Unique identifier of this backing store
+     * @param restore Decompresses the image into the backing store
+     */
+    void restoreSharedImage(const std::string &filepath,
+                            unsigned int store_id,
+                            const std::function<void()> &restore);
+
+    /**
+     * Write the pages of a backing store written since the parent
+     * checkpoint, as a sparse raw image and a map of the pages it
+     * holds.
+     *
+     * @param filepath The path of the image
+     * @param dirtypath The path of the page map
+     * @param range The address range of this backing store
+     * @param pmem The host pointer to this backing store
+     * @param dirty_pages One byte per page, set if the page is written
+     */
+    void writeDeltaImage(const std::string &filepath,
+                         const std::string &dirtypath, AddrRange range,
+                         uint8_t* pmem,
+                         const std::vector<uint8_t> &dirty_pages) const;
+
+    /**
+     * Apply the pages of a delta image over a backing store restored
+     * from the parent checkpoint.
+     *
+     * @param filepath The path of the image
+     * @param dirtypath The path of the page map
+     * @param store_id Unique identifier of this backing store
+     */
+    void restoreDeltaImage(const std::string &filepath,
+                           const std::string &dirtypath,
+                           unsigned int store_id);
+
+    /**
+     * Start tracking the writes since the given checkpoint.
+     *
+     * @param cpt_dir The checkpoint directory
+     */
+    void trackWritesSince(const std::string &cpt_dir) const;
+
+    /**
+     * Find the host memory backing a range of the global address map.
+     *
+     * @param addr The physical address of the range
+     * @param size The size of the range
+     * @return The host address, nullptr if no backing store has it all
+     */
+    uint8_t *hostAddr(Addr addr, Addr size) const;
+
   public:
 
     /**
@@ -191,7 +361,16 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   enums::CheckpointMemoryFormat checkpoint_format=
+                       enums::gzip,
+                   unsigned checkpoint_threads=0,
+                   bool lazy_checkpoint_restore=false,
+                   bool delta_checkpoints=false,
+                   BackingStoreHugePages huge_pages=
+                       BackingStoreHugePages::none,
+                   bool prefault_backing_store=false,
+                   const std::string& shared_image_dir="");
 
     /**
      * Unmap all the backing store we have used.
@@ -245,6 +424,66 @@ class PhysicalMemory : public Serializable
     std::vector<BackingStoreEntry> getBackingStore() const
     { return backingStore; }
 
+    /**
+     * Note that the backing store is written without going through
+     * the memories, e.g., by a KVM guest, so the writes cannot be
+     * tracked and the checkpoints cannot be deltas.
+     *
+     * @param writer The name of what writes the backing store
+     */
+    void untrackedWriter(const std::string &writer);
+
+    /**
+     * Register a writer of the backing store which tracks its writes
+     * itself, e.g., a KVM VM logging the pages written by the guest. The
+     * function is called before checkpointing, and has to report the
+     * writes since it was last called with markWritten().
+     *
+     * @param sync The function reporting the writes
+     * @return False if the writes don't need to be tracked
+     */
+    bool trackedWriter(std::function<void()> sync);
+
+    /**
+     * Note a write to the backing store which didn't go through the
+     * memories.
+     *
+     * @param addr The physical address of the write
+     * @param size The size of the write
+     */
+    void markWritten(Addr addr, Addr size) const;
+
+    /**
+     * Copy data straight into the backing store, e.g., to load an image
+     * before the simulation starts. This bypasses the memory system, so
+     * nothing cached is updated.
+     *
+     * @param addr The physical address of the write
+     * @param data The data to write
+     * @param size The size of the write
+     * @return False if the range is not all in a single backing store
+     */
+    bool writeBacking(Addr addr, const uint8_t *data, Addr size);
+
+    /**
+     * Zero a range of the backing store, like writeBacking(). Pages which
+     * are all zeros already are left untouched, so zeroing a large range
+     * of a fresh backing store does not allocate the host pages.
+     *
+     * @param addr The physical address of the range
+     * @param size The size of the range
+     * @return False if the range is not all in a single backing store
+     */
+    bool zeroBacking(Addr addr, Addr size);
+
+    /**
+     * Restore all of the backing store that is still to be restored on
+     * demand, and stop handling its faults. This has to be done before
+     * forking the simulator, as the child would not inherit the fault
+     * handling and would read the unrestored memory as zeros.
+     */
+    void completeLazyRestore();
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
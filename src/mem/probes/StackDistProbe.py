@@ -58,6 +58,10 @@ class StackDistProbe(BaseMemProbe):
         False, "Verify behaviuor with reference implementation"
     )
 
+    # SHARDS-style spatial sampling: only the lines whose address hash
+    # falls below the rate are tracked, and their distances are scaled
+    sample_rate = Param.Float(1.0, "Fraction of the cache lines to track")
+
     # linear histogram bins and enable/disable
     linear_hist_bins = Param.Unsigned("16", "Bins in linear histograms")
     disable_linear_hists = Param.Bool(False, "Disable linear histograms")
@@ -43,17 +43,44 @@
 namespace gem5
 {
 
+namespace
+{
+
+/** Number of bits of the address hash used for sampling. */
+constexpr unsigned sampleHashBits = 24;
+
+/** Spread the bits of a line address over the sampled hash bits. */
+uint64_t
+sampleHash(Addr addr)
+{
+    uint64_t h = addr;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h & ((1ULL << sampleHashBits) - 1);
+}
+
+} // anonymous namespace
+
 StackDistProbe::StackDistProbe(const StackDistProbeParams &p)
     : BaseMemProbe(p),
       lineSize(p.line_size),
       disableLinearHists(p.disable_linear_hists),
       disableLogHists(p.disable_log_hists),
+      sampleRate(p.sample_rate),
+      sampleThreshold(p.sample_rate * (1ULL << sampleHashBits)),
+      sampleCarry(0),
       calc(p.verify),
       stats(this)
 {
     fatal_if(p.system->cacheLineSize() > p.line_size,
              "The stack distance probe must use a cache line size that is "
              "larger or equal to the system's cahce line size.");
+    fatal_if(p.sample_rate <= 0 || p.sample_rate > 1,
+             "The sampling rate of the stack distance probe must be in "
+             "(0, 1].");
 }
 
 StackDistProbe::StackDistProbeStats::StackDistProbeStats(
@@ -106,19 +133,33 @@ StackDistProbe::handleRequest(const probing::PacketInfo &pkt_info)
     // Align the address to a cache line size
     const Addr aligned_addr(roundDown(pkt_info.addr, lineSize));
 
+    // Only the sampled lines are tracked, and as they are a fraction of
+    // the lines of the stack, their distances are scaled up and each of
+    // their accesses is counted for the accesses to the untracked lines
+    int weight = 1;
+    if (sampleRate < 1) {
+        if (sampleHash(aligned_addr / lineSize) >= sampleThreshold)
+            return;
+        sampleCarry += 1 / sampleRate;
+        weight = sampleCarry;
+        sampleCarry -= weight;
+    }
+
     // Calculate the stack distance
-    const uint64_t sd(calc.calcStackDistAndUpdate(aligned_addr).first);
+    uint64_t sd(calc.calcStackDistAndUpdate(aligned_addr).first);
     if (sd == StackDistCalc::Infinity) {
-        stats.infiniteSD++;
+        stats.infiniteSD += weight;
         return;
     }
+    if (sampleRate < 1)
+        sd = sd / sampleRate;
 
     // Sample the stack distance of the address in linear bins
     if (!disableLinearHists) {
         if (pkt_info.cmd.isRead())
-            stats.readLinearHist.sample(sd);
+            stats.readLinearHist.sample(sd, weight);
         else
-            stats.writeLinearHist.sample(sd);
+            stats.writeLinearHist.sample(sd, weight);
     }
 
     if (!disableLogHists) {
@@ -126,9 +167,9 @@ StackDistProbe::handleRequest(const probing::PacketInfo &pkt_info)
 
         // Sample the stack distance of the address in log bins
         if (pkt_info.cmd.isRead())
-            stats.readLogHist.sample(sd_lg2);
+            stats.readLogHist.sample(sd_lg2, weight);
         else
-            stats.writeLogHist.sample(sd_lg2);
+            stats.writeLogHist.sample(sd_lg2, weight);
     }
 }
 
@@ -66,6 +66,16 @@ class StackDistProbe : public BaseMemProbe
     // Disable the logarithmic histograms
     const bool disableLogHists;
 
+    // Fraction of the lines that are tracked
+    const double sampleRate;
+
+    // Lines whose hash is below the threshold are tracked
+    const uint64_t sampleThreshold;
+
+    // Fraction of an access the previous samples did not account for,
+    // as each sample stands for 1 / sampleRate accesses
+    double sampleCarry;
+
   protected:
     StackDistCalc calc;
 
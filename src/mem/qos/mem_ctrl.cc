@@ -274,8 +274,14 @@ void
 MemCtrl::addRequestor(RequestorID id)
 {
     if (!hasRequestor(id)) {
-        requestors.emplace(id, _system->getRequestorName(id));
+        if (id >= requestors.size()) {
+            requestors.resize(id + 1);
+            packetPriorities.resize(id + 1);
+            requestTimes.resize(id + 1);
+        }
+        requestors[id] = _system->getRequestorName(id);
         packetPriorities[id].resize(numPriorities(), 0);
+        requestorIds.push_back(id);
 
         DPRINTF(QOS,
                 "qos::MemCtrl::addRequestor registering"
@@ -104,15 +104,25 @@ class MemCtrl : public ClockedObject
      */
     const bool qosSyncroScheduler;
 
-    /** Hash of requestor ID - requestor name */
-    std::unordered_map<RequestorID, const std::string> requestors;
+    /**
+     * Requestor names, indexed by requestor ID. Requestor IDs are
+     * allocated densely by the system, so the per-requestor state is
+     * kept in flat vectors rather than hashed on every packet.
+     */
+    std::vector<std::string> requestors;
+
+    /** IDs of the registered requestors, in registration order */
+    std::vector<RequestorID> requestorIds;
 
-    /** Hash of requestors - number of packets queued per priority */
-    std::unordered_map<RequestorID, std::vector<uint64_t> > packetPriorities;
+    /**
+     * Per requestor, number of packets queued per priority. Empty for
+     * requestors that have not been registered.
+     */
+    std::vector<std::vector<uint64_t>> packetPriorities;
 
-    /** Hash of requestors - address of request - queue of times of request */
-    std::unordered_map<RequestorID,
-            std::unordered_map<uint64_t, std::deque<uint64_t>> > requestTimes;
+    /** Per requestor, address of request - queue of times of request */
+    std::vector<std::unordered_map<uint64_t, std::deque<uint64_t>>>
+        requestTimes;
 
     /**
      * Vector of QoS priorities/last service time. Refreshed at every
@@ -314,7 +324,8 @@ class MemCtrl : public ClockedObject
      */
     bool hasRequestor(RequestorID id) const
     {
-        return requestors.find(id) != requestors.end();
+        return id < packetPriorities.size() &&
+            !packetPriorities[id].empty();
     }
 
     /**
@@ -505,20 +516,20 @@ MemCtrl::qosSchedule(std::initializer_list<Queues*> queues,
 
     if (qosSyncroScheduler) {
         // Call the scheduling function on all other requestors.
-        for (const auto& requestor : requestors) {
+        for (const auto requestor : requestorIds) {
 
-            if (requestor.first == pkt->requestorId())
+            if (requestor == pkt->requestorId())
                 continue;
 
-            uint8_t prio = schedule(requestor.first, 0);
+            uint8_t prio = schedule(requestor, 0);
 
             if (qosPriorityEscalation) {
                 DPRINTF(QOS,
                         "qos::MemCtrl::qosSchedule: (syncro) escalating "
                         "REQUESTOR %s to assigned priority %d\n",
-                        _system->getRequestorName(requestor.first),
+                        _system->getRequestorName(requestor),
                         prio);
-                escalate(queues, queue_entry_size, requestor.first, prio);
+                escalate(queues, queue_entry_size, requestor, prio);
             }
         }
     }
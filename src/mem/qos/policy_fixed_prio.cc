@@ -69,18 +69,27 @@ FixedPriorityPolicy::init()
 void
 FixedPriorityPolicy::initRequestorName(std::string requestor, uint8_t priority)
 {
-    priorityMap.insert(
-        this->pair<std::string, uint8_t>(requestor, priority));
+    setPriority(this->pair<std::string, uint8_t>(requestor, priority));
 }
 
 void
 FixedPriorityPolicy::initRequestorObj(const SimObject* requestor,
                                    uint8_t priority)
 {
-    priorityMap.insert(
+    setPriority(
         this->pair<const SimObject*, uint8_t>(requestor, priority));
 }
 
+void
+FixedPriorityPolicy::setPriority(const std::pair<RequestorID, uint8_t> &entry)
+{
+    if (entry.first >= priorityMap.size())
+        priorityMap.resize(entry.first + 1);
+
+    if (!priorityMap[entry.first])
+        priorityMap[entry.first] = entry.second;
+}
+
 uint8_t
 FixedPriorityPolicy::schedule(const RequestorID id, const uint64_t data)
 {
@@ -88,10 +97,8 @@ FixedPriorityPolicy::schedule(const RequestorID id, const uint64_t data)
     // if a match is found in the configured priority map, returns the
     // matching priority, else returns zero
 
-    auto ret = priorityMap.find(id);
-
-    if (ret != priorityMap.end()) {
-        return ret->second;
+    if (id < priorityMap.size() && priorityMap[id]) {
+        return *priorityMap[id];
     } else {
         DPRINTF(QOS, "Requestor %s (RequestorID %d) not present in "
                      "priorityMap, assigning default priority %d\n",
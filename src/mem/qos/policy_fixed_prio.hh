@@ -39,7 +39,8 @@
 #define __MEM_QOS_POLICY_FIXED_PRIO_HH__
 
 #include <cstdint>
-#include <map>
+#include <optional>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "mem/qos/policy.hh"
@@ -100,14 +101,18 @@ class FixedPriorityPolicy : public Policy
     virtual uint8_t schedule(const RequestorID, const uint64_t) override;
 
   protected:
+    /** Record the priority of a requestor, the first setting wins */
+    void setPriority(const std::pair<RequestorID, uint8_t> &entry);
+
     /** Default fixed priority value for non-listed requestors */
     const uint8_t defaultPriority;
 
     /**
      * Priority map, associates configured requestors with
-     * a fixed QoS priority value
+     * a fixed QoS priority value. Indexed by requestor ID, as the IDs
+     * are allocated densely and the map is consulted on every packet.
      */
-    std::map<RequestorID, uint8_t> priorityMap;
+    std::vector<std::optional<uint8_t>> priorityMap;
 };
 
 } // namespace qos
@@ -52,7 +52,7 @@ namespace qos
 {
 
 PropFairPolicy::PropFairPolicy(const Params &p)
-  : Policy(p), weight(p.weight)
+  : Policy(p), weight(p.weight), scale(1.0)
 {
     fatal_if(weight < 0 || weight > 1,
         "weight must be a value between 0 and 1");
@@ -70,11 +70,22 @@ PropFairPolicy::initRequestor(const Requestor requestor, const double score)
     assert(id != Request::invldRequestorId);
 
     // Setting the Initial score for the selected requestor.
-    history.push_back(std::make_pair(id, score));
+    history.push_back(std::make_pair(id, score / scale));
 
     fatal_if(history.size() > memCtrl->numPriorities(),
         "Policy's maximum number of requestors is currently dictated "
         "by the maximum number of priorities\n");
+
+    // Sorting in reverse in base of personal history:
+    // First elements have higher history/score -> lower priority.
+    std::stable_sort(history.begin(), history.end(),
+        [] (const RequestorHistory& lhs, const RequestorHistory& rhs)
+        { return lhs.second > rhs.second; });
+
+    if (id >= position.size())
+        position.resize(id + 1, -1);
+    for (size_t i = 0; i < history.size(); i++)
+        position[history[i].first] = i;
 }
 
 void
@@ -89,42 +100,43 @@ PropFairPolicy::initRequestorObj(const SimObject* requestor, const double score)
     initRequestor(requestor, score);
 }
 
-double
-PropFairPolicy::updateScore(
-    const double old_score, const uint64_t served_bytes) const
+void
+PropFairPolicy::normalizeScores()
 {
-    return ((1.0 - weight) * old_score) + (weight * served_bytes);
+    for (auto &entry : history)
+        entry.second *= scale;
+    scale = 1.0;
 }
 
 uint8_t
 PropFairPolicy::schedule(const RequestorID pkt_id, const uint64_t pkt_size)
 {
-    auto sort_pred =
-    [] (const RequestorHistory& lhs, const RequestorHistory& rhs)
-    { return lhs.second > rhs.second; };
+    // Every score decays as score = (1 - weight) * score, which is
+    // applied to all of them at once through the common scale. Fold
+    // the scale back in before it underflows (or immediately, for a
+    // weight of 1).
+    scale *= 1.0 - weight;
+    if (scale < 1e-100)
+        normalizeScores();
+
+    if (pkt_id >= position.size() || position[pkt_id] < 0)
+        return 0;
 
-    // Sorting in reverse in base of personal history:
-    // First elements have higher history/score -> lower priority.
     // The qos priority is the position in the sorted vector.
-    std::sort(history.begin(), history.end(), sort_pred);
+    int pos = position[pkt_id];
+    uint8_t pkt_priority = pos;
 
     const double served_bytes = static_cast<double>(pkt_size);
-
-    uint8_t pkt_priority = 0;
-    for (auto m_hist = history.begin(); m_hist != history.end(); m_hist++) {
-
-        RequestorID curr_id = m_hist->first;
-        double& curr_score = m_hist->second;
-
-        if (curr_id == pkt_id) {
-            // The qos priority is the position in the sorted vector.
-            pkt_priority = std::distance(history.begin(), m_hist);
-
-            curr_score = updateScore(curr_score, served_bytes);
-        } else {
-            curr_score = updateScore(curr_score, 0);
-        }
+    history[pos].second += weight * served_bytes / scale;
+
+    // The score can only have grown, so keep the vector sorted by
+    // moving the entry towards the front
+    while (pos > 0 && history[pos - 1].second < history[pos].second) {
+        std::swap(history[pos - 1], history[pos]);
+        position[history[pos].first] = pos;
+        pos--;
     }
+    position[pkt_id] = pos;
 
     return pkt_priority;
 }
@@ -108,16 +108,28 @@ class PropFairPolicy : public Policy
     template <typename Requestor>
     void initRequestor(const Requestor requestor, const double score);
 
-    inline double
-    updateScore(const double old_score, const uint64_t served_bytes) const;
+    /** Fold the common scaling factor back into the scores */
+    void normalizeScores();
 
   protected:
     /** PF Policy weight */
     const double weight;
 
-    /** history is keeping track of every requestor's score */
+    /**
+     * history is keeping track of every requestor's score, sorted by
+     * decreasing score. As every schedule call decays all scores by
+     * the same factor, the scores are stored relative to a common
+     * scale, which leaves the order untouched and only requires the
+     * served requestor to be updated and moved.
+     */
     using RequestorHistory = std::pair<RequestorID, double>;
     std::vector<RequestorHistory> history;
+
+    /** Position of every requestor in history, indexed by ID */
+    std::vector<int> position;
+
+    /** Actual scores are the stored ones multiplied by this factor */
+    double scale;
 };
 
 } // namespace qos
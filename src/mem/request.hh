@@ -49,17 +49,21 @@
 #define __MEM_REQUEST_HH__
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/amo.hh"
 #include "base/compiler.hh"
 #include "base/extensible.hh"
 #include "base/flags.hh"
+#include "base/free_list.hh"
+#include "base/refcnt.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "mem/htm.hh"
@@ -91,10 +95,10 @@ class Packet;
 class Request;
 class ThreadContext;
 
-typedef std::shared_ptr<Request> RequestPtr;
+typedef RefCountingPtr<Request> RequestPtr;
 typedef uint16_t RequestorID;
 
-class Request : public Extensible<Request>
+class Request : public Extensible<Request>, public SharedRefCounted<Request>
 {
   public:
     typedef uint64_t FlagsType;
@@ -470,6 +474,24 @@ class Request : public Extensible<Request>
     /** The cause for HTM transaction abort */
     HtmFailureFaultCause _htmAbortCause = HtmFailureFaultCause::INVALID;
 
+    /**
+     * A route recorded by a crossbar (the owner) for the response to
+     * this request.
+     */
+    struct Route
+    {
+        const void *owner = nullptr;
+        PortID port = InvalidPortID;
+    };
+
+    /**
+     * The routes of the crossbars the request is outstanding in. They
+     * are kept with the request rather than the packet, as snoop
+     * responses are copies of the packet that share its request. They
+     * are not copied with the request.
+     */
+    std::array<Route, 4> routes;
+
   public:
 
     /**
@@ -502,7 +524,7 @@ class Request : public Extensible<Request>
     }
 
     Request(const Request& other)
-        : Extensible<Request>(other),
+        : Extensible<Request>(other), SharedRefCounted<Request>(other),
           _paddr(other._paddr), _size(other._size),
           _byteEnable(other._byteEnable),
           _requestorId(other._requestorId),
@@ -523,6 +545,31 @@ class Request : public Extensible<Request>
 
     ~Request() {}
 
+    /**
+     * Create a new request. Requests are allocated from a per-thread
+     * free list, which is considerably cheaper than going to the
+     * system allocator for every memory access.
+     */
+    template <typename... Args>
+    static RequestPtr
+    make(Args&&... args)
+    {
+        return RequestPtr(new Request(std::forward<Args>(args)...));
+    }
+
+    static void *
+    operator new(size_t size)
+    {
+        assert(size == sizeof(Request));
+        return FreeList<sizeof(Request)>::allocate();
+    }
+
+    static void
+    operator delete(void *p)
+    {
+        FreeList<sizeof(Request)>::release(p);
+    }
+
     /**
      * Factory method for creating memory management requests, with
      * unspecified addr and size.
@@ -530,7 +577,7 @@ class Request : public Extensible<Request>
     static RequestPtr
     createMemManagement(Flags flags, RequestorID id)
     {
-        auto mgmt_req = std::make_shared<Request>();
+        auto mgmt_req = Request::make();
         mgmt_req->_flags.set(flags);
         mgmt_req->_requestorId = id;
         mgmt_req->_time = curTick();
@@ -612,8 +659,8 @@ class Request : public Extensible<Request>
         assert(hasVaddr());
         assert(!hasPaddr());
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = Request::make(*this);
+        req2 = Request::make(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
@@ -892,6 +939,61 @@ class Request : public Extensible<Request>
         privateFlags.set(VALID_EXTRA_DATA);
     }
 
+    /**
+     * Record the route for the response to this request through a
+     * crossbar.
+     *
+     * @param owner The crossbar recording the route.
+     * @param port The port to route the response to.
+     * @return False if there is no room left for another route.
+     */
+    bool
+    setRoute(const void *owner, PortID port)
+    {
+        assert(getRoute(owner) == InvalidPortID);
+        for (auto &route : routes) {
+            if (!route.owner) {
+                route.owner = owner;
+                route.port = port;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @param owner The crossbar that recorded the route.
+     * @return The port to route the response to, or InvalidPortID if
+     * the crossbar recorded no route.
+     */
+    PortID
+    getRoute(const void *owner) const
+    {
+        for (const auto &route : routes) {
+            if (route.owner == owner)
+                return route.port;
+        }
+        return InvalidPortID;
+    }
+
+    /**
+     * Remove the route a crossbar recorded.
+     *
+     * @param owner The crossbar that recorded the route.
+     * @return False if the crossbar recorded no route.
+     */
+    bool
+    clearRoute(const void *owner)
+    {
+        for (auto &route : routes) {
+            if (route.owner == owner) {
+                route = Route();
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool
     hasContextId() const
     {
@@ -46,6 +46,9 @@ namespace gem5
 namespace ruby
 {
 
+thread_local std::vector<Consumer::DeferredWakeup> *
+    Consumer::deferredWakeups = nullptr;
+
 Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
     : m_wakeup_event([this]{ processCurrentEvent(); },
                     "Consumer Event", false, ev_prio),
@@ -55,6 +58,10 @@ Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
 void
 Consumer::scheduleEvent(Cycles timeDelta)
 {
+    if (deferredWakeups) {
+        deferredWakeups->push_back({this, false, 0, timeDelta});
+        return;
+    }
     m_wakeup_ticks.insert(em->clockEdge(timeDelta));
     scheduleNextWakeup();
 }
@@ -62,18 +69,39 @@ Consumer::scheduleEvent(Cycles timeDelta)
 void
 Consumer::scheduleEventAbsolute(Tick evt_time)
 {
+    if (deferredWakeups) {
+        deferredWakeups->push_back({this, true, evt_time, Cycles(0)});
+        return;
+    }
     m_wakeup_ticks.insert(
         divCeil(evt_time, em->clockPeriod()) * em->clockPeriod());
     scheduleNextWakeup();
 }
 
+void
+Consumer::deferWakeups(std::vector<DeferredWakeup> *wakeups)
+{
+    deferredWakeups = wakeups;
+}
+
+void
+Consumer::commitWakeups(const std::vector<DeferredWakeup> &wakeups)
+{
+    assert(!deferredWakeups);
+    for (const auto &wakeup : wakeups) {
+        if (wakeup.absolute)
+            wakeup.consumer->scheduleEventAbsolute(wakeup.when);
+        else
+            wakeup.consumer->scheduleEvent(wakeup.delta);
+    }
+}
+
 void
 Consumer::scheduleNextWakeup()
 {
     // look for the next tick in the future to schedule
-    auto it = m_wakeup_ticks.lower_bound(em->clockEdge());
-    if (it != m_wakeup_ticks.end()) {
-        Tick when = *it;
+    Tick when = m_wakeup_ticks.lowerBound(em->clockEdge());
+    if (when != MaxTick) {
         assert(when >= em->clockEdge());
         if (m_wakeup_event.scheduled() && (when < m_wakeup_event.when()))
             em->reschedule(m_wakeup_event, when, true);
@@ -85,12 +113,11 @@ Consumer::scheduleNextWakeup()
 void
 Consumer::processCurrentEvent()
 {
-    auto curr = m_wakeup_ticks.begin();
-    assert(em->clockEdge() == *curr);
+    assert(em->clockEdge() == m_wakeup_ticks.front());
 
     // remove the current tick from the wakeup list, wake up, and then schedule
     // the next wakeup
-    m_wakeup_ticks.erase(curr);
+    m_wakeup_ticks.popFront();
     wakeup();
     scheduleNextWakeup();
 }
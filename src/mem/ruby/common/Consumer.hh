@@ -47,8 +47,12 @@
 #ifndef __MEM_RUBY_COMMON_CONSUMER_HH__
 #define __MEM_RUBY_COMMON_CONSUMER_HH__
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
 #include <iostream>
-#include <set>
+#include <vector>
 
 #include "sim/clocked_object.hh"
 
@@ -75,7 +79,7 @@ class Consumer
     bool
     alreadyScheduled(Tick time)
     {
-        return m_wakeup_ticks.find(time) != m_wakeup_ticks.end();
+        return m_wakeup_ticks.contains(time);
     }
 
     ClockedObject *
@@ -87,8 +91,125 @@ class Consumer
     void scheduleEventAbsolute(Tick timeAbs);
     void scheduleEvent(Cycles timeDelta);
 
+    /**
+     * A wakeup requested while the calling thread defers its scheduling.
+     * Relative requests keep their delay so the consumer's clock is only
+     * read when the wakeup is committed.
+     */
+    struct DeferredWakeup
+    {
+        Consumer *consumer;
+        bool absolute;
+        Tick when;
+        Cycles delta;
+    };
+
+    /**
+     * Defer the wakeups the calling thread requests into wakeups, rather
+     * than scheduling them, until called again with nullptr. This lets
+     * consumers be evaluated off the event queue's thread.
+     */
+    static void deferWakeups(std::vector<DeferredWakeup> *wakeups);
+
+    /** Schedule wakeups deferred by deferWakeups(), in order. */
+    static void commitWakeups(const std::vector<DeferredWakeup> &wakeups);
+
   private:
-    std::set<Tick> m_wakeup_ticks;
+    static thread_local std::vector<DeferredWakeup> *deferredWakeups;
+
+    /**
+     * Sorted set of pending wakeup ticks. Most consumers only have one
+     * or two wakeups pending at any time, so the earliest ticks are kept
+     * in a small inline array. Only the remaining ones spill into a
+     * vector, sorted in decreasing order so that the earliest of them can
+     * be moved inline cheaply.
+     */
+    class WakeupTicks
+    {
+      public:
+        bool
+        contains(Tick t) const
+        {
+            for (unsigned i = 0; i < numInline; i++) {
+                if (inlineTicks[i] == t)
+                    return true;
+            }
+            return std::binary_search(spill.begin(), spill.end(), t,
+                                      std::greater<Tick>());
+        }
+
+        /** Insert a tick, ignoring duplicates */
+        void
+        insert(Tick t)
+        {
+            unsigned pos = 0;
+            while (pos < numInline && inlineTicks[pos] < t)
+                pos++;
+            if (pos < numInline && inlineTicks[pos] == t)
+                return;
+
+            if (pos == inlineSize) {
+                auto it = std::lower_bound(spill.begin(), spill.end(), t,
+                                           std::greater<Tick>());
+                if (it == spill.end() || *it != t)
+                    spill.insert(it, t);
+                return;
+            }
+
+            if (numInline == inlineSize)
+                spill.push_back(inlineTicks[--numInline]);
+            for (unsigned i = numInline; i > pos; i--)
+                inlineTicks[i] = inlineTicks[i - 1];
+            inlineTicks[pos] = t;
+            numInline++;
+        }
+
+        /** Earliest tick not before t, MaxTick if there is none */
+        Tick
+        lowerBound(Tick t) const
+        {
+            for (unsigned i = 0; i < numInline; i++) {
+                if (inlineTicks[i] >= t)
+                    return inlineTicks[i];
+            }
+            for (auto it = spill.rbegin(); it != spill.rend(); it++) {
+                if (*it >= t)
+                    return *it;
+            }
+            return MaxTick;
+        }
+
+        Tick
+        front() const
+        {
+            assert(numInline > 0);
+            return inlineTicks[0];
+        }
+
+        void
+        popFront()
+        {
+            assert(numInline > 0);
+            for (unsigned i = 1; i < numInline; i++)
+                inlineTicks[i - 1] = inlineTicks[i];
+            numInline--;
+            if (!spill.empty()) {
+                inlineTicks[numInline++] = spill.back();
+                spill.pop_back();
+            }
+        }
+
+      private:
+        static constexpr unsigned inlineSize = 4;
+
+        std::array<Tick, inlineSize> inlineTicks;
+        unsigned numInline = 0;
+
+        /** Ticks after the inline ones, in decreasing order */
+        std::vector<Tick> spill;
+    };
+
+    WakeupTicks m_wakeup_ticks;
     EventFunctionWrapper m_wakeup_event;
     ClockedObject *em;
 
@@ -79,19 +79,20 @@ DataBlock::equal(const DataBlock& obj) const
 void
 DataBlock::copyPartial(const DataBlock &dblk, const WriteMask &mask)
 {
-    for (int i = 0; i < RubySystem::getBlockSizeBytes(); i++) {
-        if (mask.getMask(i, 1)) {
-            m_data[i] = dblk.m_data[i];
-        }
+    // copy each run of masked bytes at once, the masks of the partial
+    // writes usually being one run or a few
+    int size = RubySystem::getBlockSizeBytes();
+    for (int begin = mask.firstBitSet(true); begin < size;) {
+        int end = mask.firstBitSet(false, begin);
+        memcpy(&m_data[begin], &dblk.m_data[begin], end - begin);
+        begin = mask.firstBitSet(true, end);
     }
 }
 
 void
 DataBlock::atomicPartial(const DataBlock &dblk, const WriteMask &mask)
 {
-    for (int i = 0; i < RubySystem::getBlockSizeBytes(); i++) {
-        m_data[i] = dblk.m_data[i];
-    }
+    memcpy(m_data, dblk.m_data, RubySystem::getBlockSizeBytes());
     mask.performAtomic(m_data);
 }
 
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_COMMON_FLATADDRMAP_HH__
+#define __MEM_RUBY_COMMON_FLATADDRMAP_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * A map from addresses to values, for the tables of outstanding requests
+ * on the critical path of every Ruby access. The keys are kept in a flat
+ * open addressing table with linear probing, and the values in a pool
+ * whose entries are reused once erased, so a lookup is a few probes of an
+ * array and an insertion allocates nothing once the pool has grown to the
+ * number of outstanding entries. As with std::unordered_map, references
+ * to the values remain valid until the value is erased. The entries are
+ * iterated in the order of their slots in the table.
+ */
+template<class T>
+class FlatAddrMap
+{
+  public:
+    typedef Addr key_type;
+    typedef T mapped_type;
+    typedef std::pair<const Addr, T> value_type;
+
+  private:
+    static constexpr uint32_t emptySlot = ~0u;
+    static constexpr uint32_t erasedSlot = ~0u - 1;
+
+    struct Slot
+    {
+        Addr key;
+        uint32_t node;
+    };
+
+    template<class Map, class Value>
+    class Iterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef FlatAddrMap::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value *pointer;
+        typedef Value &reference;
+
+        Iterator() : map(nullptr), slot(0) {}
+
+        template<class OtherMap, class OtherValue>
+        Iterator(const Iterator<OtherMap, OtherValue> &other)
+            : map(other.map), slot(other.slot)
+        {}
+
+        reference
+        operator*() const
+        {
+            return *map->nodes[map->slots[slot].node];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        Iterator &
+        operator++()
+        {
+            slot = map->nextSlot(slot + 1);
+            return *this;
+        }
+
+        Iterator
+        operator++(int)
+        {
+            Iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool
+        operator==(const Iterator &other) const
+        {
+            return slot == other.slot;
+        }
+
+        bool
+        operator!=(const Iterator &other) const
+        {
+            return slot != other.slot;
+        }
+
+      private:
+        friend class FlatAddrMap;
+        template<class, class> friend class Iterator;
+
+        Iterator(Map *_map, size_t _slot) : map(_map), slot(_slot) {}
+
+        Map *map;
+        size_t slot;
+    };
+
+  public:
+    typedef Iterator<FlatAddrMap, value_type> iterator;
+    typedef Iterator<const FlatAddrMap, const value_type> const_iterator;
+
+    /**
+     * @param expected The number of entries expected to be in the map at
+     * once, e.g. the maximum number of outstanding requests.
+     */
+    explicit FlatAddrMap(size_t expected = 16)
+        : used(0), numEntries(0)
+    {
+        rehash(slotsFor(expected));
+    }
+
+    /** Make room for n entries without rehashing. */
+    void
+    reserve(size_t n)
+    {
+        if (slotsFor(n) > slots.size())
+            rehash(slotsFor(n));
+    }
+
+    /**
+     * Make room for n entries without rehashing nor growing the pool of
+     * values, for maps with a fixed capacity.
+     */
+    void
+    preallocate(size_t n)
+    {
+        reserve(n);
+        if (n <= nodes.size())
+            return;
+
+        size_t first = nodes.size();
+        nodes.resize(n);
+        // Hand out the lowest nodes first
+        for (size_t node = n; node-- > first; )
+            freeNodes.push_back(node);
+    }
+
+    size_t size() const { return numEntries; }
+    bool empty() const { return numEntries == 0; }
+
+    iterator begin() { return iterator(this, nextSlot(0)); }
+    iterator end() { return iterator(this, slots.size()); }
+    const_iterator begin() const { return const_iterator(this, nextSlot(0)); }
+    const_iterator
+    end() const
+    {
+        return const_iterator(this, slots.size());
+    }
+
+    iterator
+    find(Addr key)
+    {
+        size_t slot = probe(key);
+        return slots[slot].node == emptySlot ? end() : iterator(this, slot);
+    }
+
+    const_iterator
+    find(Addr key) const
+    {
+        size_t slot = probe(key);
+        return slots[slot].node == emptySlot ?
+            end() : const_iterator(this, slot);
+    }
+
+    size_t count(Addr key) const { return find(key) != end() ? 1 : 0; }
+
+    T &
+    at(Addr key)
+    {
+        iterator it = find(key);
+        assert(it != end());
+        return it->second;
+    }
+
+    const T &
+    at(Addr key) const
+    {
+        const_iterator it = find(key);
+        assert(it != end());
+        return it->second;
+    }
+
+    T &operator[](Addr key) { return emplace(key).first->second; }
+
+    /**
+     * Insert a value constructed from args, unless the key is already in
+     * the map.
+     */
+    template<class... Args>
+    std::pair<iterator, bool>
+    emplace(Addr key, Args&&... args)
+    {
+        size_t slot = probe(key);
+        if (slots[slot].node != emptySlot)
+            return std::make_pair(iterator(this, slot), false);
+
+        if ((used + 1) * 4 > slots.size() * 3) {
+            // Rehashing drops the erased slots, and grows the table only
+            // if it is full of live entries.
+            rehash(slotsFor(numEntries + 1));
+            slot = probe(key);
+        }
+
+        uint32_t node;
+        if (freeNodes.empty()) {
+            node = nodes.size();
+            nodes.emplace_back();
+        } else {
+            node = freeNodes.back();
+            freeNodes.pop_back();
+        }
+        nodes[node].emplace(std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(
+                                std::forward<Args>(args)...));
+
+        slots[slot].key = key;
+        slots[slot].node = node;
+        used++;
+        numEntries++;
+        return std::make_pair(iterator(this, slot), true);
+    }
+
+    std::pair<iterator, bool>
+    insert(const value_type &value)
+    {
+        return emplace(value.first, value.second);
+    }
+
+    /** Erase an entry, returning the iterator to the next one. */
+    iterator
+    erase(const_iterator it)
+    {
+        size_t slot = it.slot;
+        uint32_t node = slots[slot].node;
+        assert(node < erasedSlot);
+        nodes[node].reset();
+        freeNodes.push_back(node);
+        slots[slot].node = erasedSlot;
+        numEntries--;
+
+        // The erased slots at the end of a probe sequence are not needed
+        // to find any key, so they can be emptied.
+        if (slots[(slot + 1) & mask].node == emptySlot) {
+            size_t s = slot;
+            while (slots[s].node == erasedSlot) {
+                slots[s].node = emptySlot;
+                used--;
+                s = (s - 1) & mask;
+            }
+        }
+
+        return iterator(this, nextSlot(slot + 1));
+    }
+
+    size_t
+    erase(Addr key)
+    {
+        iterator it = find(key);
+        if (it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    void
+    clear()
+    {
+        for (auto &slot : slots)
+            slot.node = emptySlot;
+        nodes.clear();
+        freeNodes.clear();
+        used = 0;
+        numEntries = 0;
+    }
+
+  private:
+    /** The number of slots to keep n entries at most 3/4 full. */
+    static size_t
+    slotsFor(size_t n)
+    {
+        size_t num_slots = 8;
+        while (num_slots * 3 < n * 4)
+            num_slots *= 2;
+        return num_slots;
+    }
+
+    size_t
+    hash(Addr key) const
+    {
+        // Fibonacci hashing, as the low bits of line addresses are zero
+        return (key * 0x9e3779b97f4a7c15ULL) >> shift;
+    }
+
+    /** The slot of the key, or the empty slot ending its probe sequence. */
+    size_t
+    probe(Addr key) const
+    {
+        for (size_t slot = hash(key); ; slot = (slot + 1) & mask) {
+            uint32_t node = slots[slot].node;
+            if (node == emptySlot ||
+                (node != erasedSlot && slots[slot].key == key)) {
+                return slot;
+            }
+        }
+    }
+
+    size_t
+    nextSlot(size_t slot) const
+    {
+        while (slot < slots.size() && slots[slot].node >= erasedSlot)
+            slot++;
+        return slot;
+    }
+
+    void
+    rehash(size_t num_slots)
+    {
+        std::vector<Slot> old_slots(num_slots, Slot{0, emptySlot});
+        old_slots.swap(slots);
+        mask = num_slots - 1;
+        shift = 64;
+        for (size_t n = num_slots; n > 1; n >>= 1)
+            shift--;
+
+        for (const auto &old_slot : old_slots) {
+            if (old_slot.node >= erasedSlot)
+                continue;
+            size_t slot = hash(old_slot.key);
+            while (slots[slot].node != emptySlot)
+                slot = (slot + 1) & mask;
+            slots[slot] = old_slot;
+        }
+        used = numEntries;
+    }
+
+    std::vector<Slot> slots;
+    size_t mask;
+    int shift;
+    // The number of live and erased slots
+    size_t used;
+    size_t numEntries;
+
+    // The values, which never move while they are in the map
+    std::deque<std::optional<value_type>> nodes;
+    std::vector<uint32_t> freeNodes;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_COMMON_FLATADDRMAP_HH__
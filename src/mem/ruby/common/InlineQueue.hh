@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_COMMON_INLINEQUEUE_HH__
+#define __MEM_RUBY_COMMON_INLINEQUEUE_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * A FIFO queue keeping up to N elements inline, for the short lists of
+ * requests coalesced on a line. Once the inline elements are all in use,
+ * the queue spills into a deque, allocated on first use, until it has
+ * drained. As with std::list, references to the elements remain valid
+ * until they are popped, even when more elements are pushed.
+ */
+template<class T, int N>
+class InlineQueue
+{
+  private:
+    template<class Queue, class Value>
+    class Iterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value *pointer;
+        typedef Value &reference;
+
+        Iterator() : queue(nullptr), index(0) {}
+
+        template<class OtherQueue, class OtherValue>
+        Iterator(const Iterator<OtherQueue, OtherValue> &other)
+            : queue(other.queue), index(other.index)
+        {}
+
+        reference operator*() const { return queue->element(index); }
+        pointer operator->() const { return &**this; }
+
+        Iterator &
+        operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        Iterator
+        operator++(int)
+        {
+            Iterator it = *this;
+            index++;
+            return it;
+        }
+
+        bool
+        operator==(const Iterator &other) const
+        {
+            return index == other.index;
+        }
+
+        bool
+        operator!=(const Iterator &other) const
+        {
+            return index != other.index;
+        }
+
+      private:
+        friend class InlineQueue;
+        template<class, class> friend class Iterator;
+
+        Iterator(Queue *_queue, size_t _index)
+            : queue(_queue), index(_index)
+        {}
+
+        Queue *queue;
+        size_t index;
+    };
+
+  public:
+    typedef T value_type;
+    typedef Iterator<InlineQueue, T> iterator;
+    typedef Iterator<const InlineQueue, const T> const_iterator;
+
+    InlineQueue() : head(0), numInline(0) {}
+
+    InlineQueue(const InlineQueue &other) : head(0), numInline(0)
+    {
+        for (const auto &elem : other)
+            push_back(elem);
+    }
+
+    InlineQueue &
+    operator=(const InlineQueue &other)
+    {
+        if (this != &other) {
+            clear();
+            for (const auto &elem : other)
+                push_back(elem);
+        }
+        return *this;
+    }
+
+    ~InlineQueue() { clear(); }
+
+    size_t
+    size() const
+    {
+        return numInline + (overflow ? overflow->size() : 0);
+    }
+    bool empty() const { return size() == 0; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    T &front() { return element(0); }
+    const T &front() const { return element(0); }
+    T &back() { return element(size() - 1); }
+    const T &back() const { return element(size() - 1); }
+
+    template<class... Args>
+    T &
+    emplace_back(Args&&... args)
+    {
+        // The inline elements are always the oldest ones, so they are only
+        // used once the overflow has drained.
+        if ((!overflow || overflow->empty()) && numInline < N) {
+            T *elem = new (slot((head + numInline) % N))
+                T(std::forward<Args>(args)...);
+            numInline++;
+            return *elem;
+        }
+        if (!overflow)
+            overflow.reset(new std::deque<T>);
+        return overflow->emplace_back(std::forward<Args>(args)...);
+    }
+
+    void push_back(const T &elem) { emplace_back(elem); }
+    void push_back(T &&elem) { emplace_back(std::move(elem)); }
+
+    void
+    pop_front()
+    {
+        assert(!empty());
+        if (numInline > 0) {
+            slot(head)->~T();
+            head = (head + 1) % N;
+            numInline--;
+        } else {
+            overflow->pop_front();
+        }
+    }
+
+    void
+    clear()
+    {
+        while (numInline > 0)
+            pop_front();
+        overflow.reset();
+        head = 0;
+    }
+
+  private:
+    T *slot(int i) { return std::launder(reinterpret_cast<T *>(storage[i])); }
+    const T *
+    slot(int i) const
+    {
+        return std::launder(reinterpret_cast<const T *>(storage[i]));
+    }
+
+    T &
+    element(size_t index)
+    {
+        return index < numInline ?
+            *slot((head + index) % N) : (*overflow)[index - numInline];
+    }
+
+    const T &
+    element(size_t index) const
+    {
+        return index < numInline ?
+            *slot((head + index) % N) : (*overflow)[index - numInline];
+    }
+
+    alignas(T) unsigned char storage[N][sizeof(T)];
+    int head;
+    size_t numInline;
+    std::unique_ptr<std::deque<T>> overflow;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_COMMON_INLINEQUEUE_HH__
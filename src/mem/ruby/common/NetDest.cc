@@ -36,56 +36,18 @@ namespace gem5
 namespace ruby
 {
 
-NetDest::NetDest()
-{
-  resize();
-}
-
-void
-NetDest::add(MachineID newElement)
-{
-    assert(bitIndex(newElement.num) < m_bits[vecIndex(newElement)].getSize());
-    m_bits[vecIndex(newElement)].add(bitIndex(newElement.num));
-}
-
-void
-NetDest::addNetDest(const NetDest& netDest)
-{
-    assert(m_bits.size() == netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
-        m_bits[i].addSet(netDest.m_bits[i]);
-    }
-}
-
 void
 NetDest::setNetDest(MachineType machine, const Set& set)
 {
     // assure that there is only one set of destinations for this machine
     assert(MachineType_base_level((MachineType)(machine + 1)) -
            MachineType_base_level(machine) == 1);
-    m_bits[MachineType_base_level(machine)] = set;
-}
-
-void
-NetDest::remove(MachineID oldElement)
-{
-    m_bits[vecIndex(oldElement)].remove(bitIndex(oldElement.num));
-}
-
-void
-NetDest::removeNetDest(const NetDest& netDest)
-{
-    assert(m_bits.size() == netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
-        m_bits[i].removeSet(netDest.m_bits[i]);
-    }
-}
-
-void
-NetDest::clear()
-{
-    for (int i = 0; i < m_bits.size(); i++) {
-        m_bits[i].clear();
+    int first = vecIndex(machine);
+    for (int i = 0; i < wordsPerMachine; i++)
+        m_bits[first + i] = 0;
+    for (NodeID j = 0; j < set.getSize(); j++) {
+        if (set.isElement(j))
+            m_bits[first + j / 64] |= 1ULL << (j % 64);
     }
 }
 
@@ -101,10 +63,11 @@ NetDest::broadcast()
 void
 NetDest::broadcast(MachineType machineType)
 {
-    for (NodeID i = 0; i < MachineType_base_count(machineType); i++) {
-        MachineID mach = {machineType, i};
-        add(mach);
-    }
+    int first = vecIndex(machineType);
+    int num = MachineType_base_count(machineType);
+    assert(num <= NUMBER_BITS_PER_SET);
+    for (int i = 0; i < wordsPerMachine && num > 0; i++, num -= 64)
+        m_bits[first + i] |= num >= 64 ? ~0ULL : mask(num);
 }
 
 //For Princeton Network
@@ -112,44 +75,27 @@ std::vector<NodeID>
 NetDest::getAllDest()
 {
     std::vector<NodeID> dest;
-    dest.clear();
-    for (int i = 0; i < m_bits.size(); i++) {
-        for (int j = 0; j < m_bits[i].getSize(); j++) {
-            if (m_bits[i].isElement(j)) {
-                int id = MachineType_base_number((MachineType)i) + j;
-                dest.push_back((NodeID)id);
+    dest.reserve(count());
+    for (int i = 0; i < MachineType_NUM; i++) {
+        int base = MachineType_base_number((MachineType)i);
+        for (int j = 0; j < wordsPerMachine; j++) {
+            for (uint64_t bits = m_bits[i * wordsPerMachine + j]; bits;
+                 bits &= bits - 1) {
+                dest.push_back((NodeID)(base + j * 64 + ctz64(bits)));
             }
         }
     }
     return dest;
 }
 
-int
-NetDest::count() const
-{
-    int counter = 0;
-    for (int i = 0; i < m_bits.size(); i++) {
-        counter += m_bits[i].count();
-    }
-    return counter;
-}
-
-NodeID
-NetDest::elementAt(MachineID index)
-{
-    return m_bits[vecIndex(index)].elementAt(bitIndex(index.num));
-}
-
 MachineID
 NetDest::smallestElement() const
 {
-    assert(count() > 0);
-    for (int i = 0; i < m_bits.size(); i++) {
-        for (NodeID j = 0; j < m_bits[i].getSize(); j++) {
-            if (m_bits[i].isElement(j)) {
-                MachineID mach = {MachineType_from_base_level(i), j};
-                return mach;
-            }
+    for (int i = 0; i < numWords; i++) {
+        if (m_bits[i]) {
+            MachineID mach = {MachineType_from_base_level(i / wordsPerMachine),
+                (NodeID)((i % wordsPerMachine) * 64 + ctz64(m_bits[i]))};
+            return mach;
         }
     }
     panic("No smallest element of an empty set.");
@@ -158,10 +104,11 @@ NetDest::smallestElement() const
 MachineID
 NetDest::smallestElement(MachineType machine) const
 {
-    int size = m_bits[MachineType_base_level(machine)].getSize();
-    for (NodeID j = 0; j < size; j++) {
-        if (m_bits[MachineType_base_level(machine)].isElement(j)) {
-            MachineID mach = {machine, j};
+    int first = vecIndex(machine);
+    for (int i = 0; i < wordsPerMachine; i++) {
+        if (m_bits[first + i]) {
+            MachineID mach = {machine,
+                              (NodeID)(i * 64 + ctz64(m_bits[first + i]))};
             return mach;
         }
     }
@@ -173,22 +120,12 @@ NetDest::smallestElement(MachineType machine) const
 bool
 NetDest::isBroadcast() const
 {
-    for (int i = 0; i < m_bits.size(); i++) {
-        if (!m_bits[i].isBroadcast()) {
+    for (int i = 0; i < MachineType_NUM; i++) {
+        int counter = 0;
+        for (int j = 0; j < wordsPerMachine; j++)
+            counter += popCount(m_bits[i * wordsPerMachine + j]);
+        if (counter != MachineType_base_count((MachineType)i))
             return false;
-        }
-    }
-    return true;
-}
-
-// Returns true iff no bits are set
-bool
-NetDest::isEmpty() const
-{
-    for (int i = 0; i < m_bits.size(); i++) {
-        if (!m_bits[i].isEmpty()) {
-            return false;
-        }
     }
     return true;
 }
@@ -197,11 +134,9 @@ NetDest::isEmpty() const
 NetDest
 NetDest::OR(const NetDest& orNetDest) const
 {
-    assert(m_bits.size() == orNetDest.getSize());
     NetDest result;
-    for (int i = 0; i < m_bits.size(); i++) {
-        result.m_bits[i] = m_bits[i].OR(orNetDest.m_bits[i]);
-    }
+    for (int i = 0; i < numWords; i++)
+        result.m_bits[i] = m_bits[i] | orNetDest.m_bits[i];
     return result;
 }
 
@@ -209,81 +144,36 @@ NetDest::OR(const NetDest& orNetDest) const
 NetDest
 NetDest::AND(const NetDest& andNetDest) const
 {
-    assert(m_bits.size() == andNetDest.getSize());
     NetDest result;
-    for (int i = 0; i < m_bits.size(); i++) {
-        result.m_bits[i] = m_bits[i].AND(andNetDest.m_bits[i]);
-    }
+    for (int i = 0; i < numWords; i++)
+        result.m_bits[i] = m_bits[i] & andNetDest.m_bits[i];
     return result;
 }
 
-// Returns true if the intersection of the two sets is non-empty
-bool
-NetDest::intersectionIsNotEmpty(const NetDest& other_netDest) const
-{
-    assert(m_bits.size() == other_netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
-        if (!m_bits[i].intersectionIsEmpty(other_netDest.m_bits[i])) {
-            return true;
-        }
-    }
-    return false;
-}
-
 bool
 NetDest::isSuperset(const NetDest& test) const
 {
-    assert(m_bits.size() == test.getSize());
-
-    for (int i = 0; i < m_bits.size(); i++) {
-        if (!m_bits[i].isSuperset(test.m_bits[i])) {
+    for (int i = 0; i < numWords; i++) {
+        if (test.m_bits[i] & ~m_bits[i])
             return false;
-        }
     }
     return true;
 }
 
-bool
-NetDest::isElement(MachineID element) const
-{
-    return ((m_bits[vecIndex(element)])).isElement(bitIndex(element.num));
-}
-
-void
-NetDest::resize()
-{
-    m_bits.resize(MachineType_base_level(MachineType_NUM));
-    assert(m_bits.size() == MachineType_NUM);
-
-    for (int i = 0; i < m_bits.size(); i++) {
-        m_bits[i].setSize(MachineType_base_count((MachineType)i));
-    }
-}
-
 void
 NetDest::print(std::ostream& out) const
 {
-    out << "[NetDest (" << m_bits.size() << ") ";
+    out << "[NetDest (" << getSize() << ") ";
 
-    for (int i = 0; i < m_bits.size(); i++) {
-        for (int j = 0; j < m_bits[i].getSize(); j++) {
-            out << (bool) m_bits[i].isElement(j) << " ";
+    for (int i = 0; i < MachineType_NUM; i++) {
+        for (NodeID j = 0; j < MachineType_base_count((MachineType)i); j++) {
+            MachineID mach = {(MachineType)i, j};
+            out << isElement(mach) << " ";
         }
         out << " - ";
     }
     out << "]";
 }
 
-bool
-NetDest::isEqual(const NetDest& n) const
-{
-    assert(m_bits.size() == n.m_bits.size());
-    for (unsigned int i = 0; i < m_bits.size(); ++i) {
-        if (!m_bits[i].isEqual(n.m_bits[i]))
-            return false;
-    }
-    return true;
-}
-
 } // namespace ruby
 } // namespace gem5
@@ -29,9 +29,12 @@
 #ifndef __MEM_RUBY_COMMON_NETDEST_HH__
 #define __MEM_RUBY_COMMON_NETDEST_HH__
 
+#include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
+#include "base/bitfield.hh"
 #include "mem/ruby/common/Set.hh"
 #include "mem/ruby/common/MachineID.hh"
 
@@ -41,13 +44,16 @@ namespace gem5
 namespace ruby
 {
 
-// NetDest specifies the network destination of a Message
+// NetDest specifies the network destination of a Message. It is a fixed
+// size bitset of NUMBER_BITS_PER_SET bits for each of the MachineTypes
+// SLICC generated, so copying one allocates nothing and the set operations
+// are loops over a few words.
 class NetDest
 {
   public:
     // Constructors
     // creates and empty set
-    NetDest();
+    NetDest() { clear(); }
     explicit NetDest(int bit_size);
 
     NetDest& operator=(const Set& obj);
@@ -55,16 +61,59 @@ class NetDest
     ~NetDest()
     { }
 
-    void add(MachineID newElement);
-    void addNetDest(const NetDest& netDest);
+    void
+    add(MachineID newElement)
+    {
+        assert(newElement.num < MachineType_base_count(newElement.type));
+        word(newElement) |= bit(newElement);
+    }
+
+    void
+    addNetDest(const NetDest& netDest)
+    {
+        for (int i = 0; i < numWords; i++)
+            m_bits[i] |= netDest.m_bits[i];
+    }
+
     void setNetDest(MachineType machine, const Set& set);
-    void remove(MachineID oldElement);
-    void removeNetDest(const NetDest& netDest);
-    void clear();
+
+    void remove(MachineID oldElement) { word(oldElement) &= ~bit(oldElement); }
+
+    void
+    removeNetDest(const NetDest& netDest)
+    {
+        for (int i = 0; i < numWords; i++)
+            m_bits[i] &= ~netDest.m_bits[i];
+    }
+
+    void
+    clear()
+    {
+        for (int i = 0; i < numWords; i++)
+            m_bits[i] = 0;
+    }
+
     void broadcast();
     void broadcast(MachineType machine);
-    int count() const;
-    bool isEqual(const NetDest& netDest) const;
+
+    int
+    count() const
+    {
+        int counter = 0;
+        for (int i = 0; i < numWords; i++)
+            counter += popCount(m_bits[i]);
+        return counter;
+    }
+
+    bool
+    isEqual(const NetDest& netDest) const
+    {
+        for (int i = 0; i < numWords; i++) {
+            if (m_bits[i] != netDest.m_bits[i])
+                return false;
+        }
+        return true;
+    }
 
     // return the logical OR of this netDest and orNetDest
     NetDest OR(const NetDest& orNetDest) const;
@@ -73,16 +122,43 @@ class NetDest
     NetDest AND(const NetDest& andNetDest) const;
 
     // Returns true if the intersection of the two netDests is non-empty
-    bool intersectionIsNotEmpty(const NetDest& other_netDest) const;
+    bool
+    intersectionIsNotEmpty(const NetDest& other_netDest) const
+    {
+        for (int i = 0; i < numWords; i++) {
+            if (m_bits[i] & other_netDest.m_bits[i])
+                return true;
+        }
+        return false;
+    }
 
     // Returns true if the intersection of the two netDests is empty
-    bool intersectionIsEmpty(const NetDest& other_netDest) const;
+    bool
+    intersectionIsEmpty(const NetDest& other_netDest) const
+    {
+        return !intersectionIsNotEmpty(other_netDest);
+    }
 
     bool isSuperset(const NetDest& test) const;
     bool isSubset(const NetDest& test) const { return test.isSuperset(*this); }
-    bool isElement(MachineID element) const;
+
+    bool
+    isElement(MachineID element) const
+    {
+        return word(element) & bit(element);
+    }
+
     bool isBroadcast() const;
-    bool isEmpty() const;
+
+    bool
+    isEmpty() const
+    {
+        for (int i = 0; i < numWords; i++) {
+            if (m_bits[i])
+                return false;
+        }
+        return true;
+    }
 
     // For Princeton Network
     std::vector<NodeID> getAllDest();
@@ -90,28 +166,45 @@ class NetDest
     MachineID smallestElement() const;
     MachineID smallestElement(MachineType machine) const;
 
-    void resize();
-    int getSize() const { return m_bits.size(); }
+    // The size is fixed, this is kept for compatibility.
+    void resize() {}
+    int getSize() const { return MachineType_NUM; }
 
     // get element for a index
-    NodeID elementAt(MachineID index);
+    NodeID elementAt(MachineID index) { return isElement(index); }
 
     void print(std::ostream& out) const;
 
   private:
-    // returns a value >= MachineType_base_level("this machine")
-    // and < MachineType_base_level("next highest machine")
-    int
-    vecIndex(MachineID m) const
+    static constexpr int wordsPerMachine = (NUMBER_BITS_PER_SET + 63) / 64;
+    static constexpr int numWords = MachineType_NUM * wordsPerMachine;
+
+    // returns the index of the first word of the machine type
+    static int
+    vecIndex(MachineType type)
+    {
+        int vec_index = MachineType_base_level(type);
+        assert(vec_index < MachineType_NUM);
+        return vec_index * wordsPerMachine;
+    }
+
+    uint64_t &
+    word(MachineID m)
+    {
+        assert(m.num < NUMBER_BITS_PER_SET);
+        return m_bits[vecIndex(m.type) + m.num / 64];
+    }
+
+    uint64_t
+    word(MachineID m) const
     {
-        int vec_index = MachineType_base_level(m.type);
-        assert(vec_index < m_bits.size());
-        return vec_index;
+        assert(m.num < NUMBER_BITS_PER_SET);
+        return m_bits[vecIndex(m.type) + m.num / 64];
     }
 
-    NodeID bitIndex(NodeID index) const { return index; }
+    static uint64_t bit(MachineID m) { return 1ULL << (m.num % 64); }
 
-    std::vector<Set> m_bits;  // a vector of bit vectors - i.e. Sets
+    uint64_t m_bits[numWords];
 };
 
 inline std::ostream&
@@ -76,6 +76,9 @@ class TriggerQueue
     // def. to workaround that
     const T& next() const { return queue.front().val; }
 
+    // Returns the head of the queue, for a third template parameter
+    const T& head() const { return queue.front().val; }
+
     // Returns the end of the queue
     const T& back() const { return queue.back().val; }
 
@@ -41,12 +41,15 @@
 #ifndef __MEM_RUBY_COMMON_WRITEMASK_HH__
 #define __MEM_RUBY_COMMON_WRITEMASK_HH__
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
 #include <vector>
 
 #include "base/amo.hh"
+#include "base/bitfield.hh"
 #include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 
@@ -61,19 +64,30 @@ class WriteMask
   public:
     typedef std::vector<std::pair<int, AtomicOpFunctor* >> AtomicOpVector;
 
+    /** The largest block size a mask can cover. */
+    static constexpr int MaxSize = 512;
+
     WriteMask();
 
     WriteMask(int size)
-      : mSize(size), mMask(size, false), mAtomic(false)
-    {}
+      : mSize(size), mMask{}, mAtomic(false)
+    {
+        assert(mSize <= MaxSize);
+    }
 
     WriteMask(int size, std::vector<bool> & mask)
-      : mSize(size), mMask(mask), mAtomic(false)
-    {}
+      : WriteMask(size)
+    {
+        setBits(mask);
+    }
 
     WriteMask(int size, std::vector<bool> &mask, AtomicOpVector atomicOp)
-      : mSize(size), mMask(mask), mAtomic(true), mAtomicOp(atomicOp)
-    {}
+      : WriteMask(size)
+    {
+        setBits(mask);
+        mAtomic = true;
+        mAtomicOp = atomicOp;
+    }
 
     ~WriteMask()
     {}
@@ -81,75 +95,74 @@ class WriteMask
     void
     clear()
     {
-        mMask = std::vector<bool>(mSize, false);
+        mMask.fill(0);
     }
 
     bool
     test(int offset) const
     {
         assert(offset < mSize);
-        return mMask[offset];
+        return (mMask[offset / WordBits] >> (offset % WordBits)) & 1;
     }
 
     void
     setMask(int offset, int len, bool val = true)
     {
         assert(mSize >= (offset + len));
-        for (int i = 0; i < len; i++) {
-            mMask[offset + i] = val;
+        for (int w = offset / WordBits; w < numWords(offset + len); w++) {
+            uint64_t bits = wordBits(w, offset, offset + len);
+            if (val)
+                mMask[w] |= bits;
+            else
+                mMask[w] &= ~bits;
         }
     }
     void
     fillMask()
     {
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = true;
-        }
+        for (int w = 0; w < numWords(); w++)
+            mMask[w] = wordBits(w, 0, mSize);
     }
 
     bool
     getMask(int offset, int len) const
     {
-        bool tmp = true;
         assert(mSize >= (offset + len));
-        for (int i = 0; i < len; i++) {
-            tmp = tmp & mMask.at(offset + i);
+        for (int w = offset / WordBits; w < numWords(offset + len); w++) {
+            uint64_t bits = wordBits(w, offset, offset + len);
+            if ((mMask[w] & bits) != bits)
+                return false;
         }
-        return tmp;
+        return true;
     }
 
     bool
     isOverlap(const WriteMask &readMask) const
     {
-        bool tmp = false;
         assert(mSize == readMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            if (readMask.mMask.at(i)) {
-                tmp = tmp | mMask.at(i);
-            }
+        for (int w = 0; w < numWords(); w++) {
+            if (mMask[w] & readMask.mMask[w])
+                return true;
         }
-        return tmp;
+        return false;
     }
 
     bool
     containsMask(const WriteMask &readMask) const
     {
-        bool tmp = true;
         assert(mSize == readMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            if (readMask.mMask.at(i)) {
-                tmp = tmp & mMask.at(i);
-            }
+        for (int w = 0; w < numWords(); w++) {
+            if (readMask.mMask[w] & ~mMask[w])
+                return false;
         }
-        return tmp;
+        return true;
     }
 
     bool isEmpty() const
     {
-        for (int i = 0; i < mSize; i++) {
-            if (mMask.at(i)) {
+        for (int w = 0; w < numWords(); w++) {
+            if (mMask[w])
                 return false;
-            }
         }
         return true;
     }
@@ -157,10 +170,9 @@ class WriteMask
     bool
     isFull() const
     {
-        for (int i = 0; i < mSize; i++) {
-            if (!mMask.at(i)) {
+        for (int w = 0; w < numWords(); w++) {
+            if (mMask[w] != wordBits(w, 0, mSize))
                 return false;
-            }
         }
         return true;
     }
@@ -169,9 +181,8 @@ class WriteMask
     andMask(const WriteMask & writeMask)
     {
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = (mMask.at(i)) && (writeMask.mMask.at(i));
-        }
+        for (int w = 0; w < numWords(); w++)
+            mMask[w] &= writeMask.mMask[w];
 
         if (writeMask.mAtomic) {
             mAtomic = true;
@@ -183,9 +194,8 @@ class WriteMask
     orMask(const WriteMask & writeMask)
     {
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = (mMask.at(i)) || (writeMask.mMask.at(i));
-        }
+        for (int w = 0; w < numWords(); w++)
+            mMask[w] |= writeMask.mMask[w];
 
         if (writeMask.mAtomic) {
             mAtomic = true;
@@ -197,17 +207,19 @@ class WriteMask
     setInvertedMask(const WriteMask & writeMask)
     {
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = !writeMask.mMask.at(i);
-        }
+        for (int w = 0; w < numWords(); w++)
+            mMask[w] = ~writeMask.mMask[w] & wordBits(w, 0, mSize);
     }
 
     int
     firstBitSet(bool val, int offset = 0) const
     {
-        for (int i = offset; i < mSize; ++i)
-            if (mMask[i] == val)
-                return i;
+        for (int w = offset / WordBits; w < numWords(); w++) {
+            uint64_t bits = (val ? mMask[w] : ~mMask[w]) &
+                wordBits(w, offset, mSize);
+            if (bits)
+                return w * WordBits + findLsbSet(bits);
+        }
         return mSize;
     }
 
@@ -215,8 +227,8 @@ class WriteMask
     count(int offset = 0) const
     {
         int count = 0;
-        for (int i = offset; i < mSize; ++i)
-            count += mMask[i];
+        for (int w = offset / WordBits; w < numWords(); w++)
+            count += popCount(mMask[w] & wordBits(w, offset, mSize));
         return count;
     }
 
@@ -257,8 +269,43 @@ class WriteMask
     }
 
   private:
+    static constexpr int WordBits = 64;
+    static constexpr int MaxWords = MaxSize / WordBits;
+
+    /** The number of mask words covering the first size bytes. */
+    static int
+    numWords(int size)
+    {
+        return (size + WordBits - 1) / WordBits;
+    }
+
+    int numWords() const { return numWords(mSize); }
+
+    /** The bits of word w covering the bytes in [begin, end). */
+    static uint64_t
+    wordBits(int w, int begin, int end)
+    {
+        int lo = std::max(begin - w * WordBits, 0);
+        int hi = std::min(end - w * WordBits, WordBits);
+        return lo < hi ? mask(hi - lo) << lo : 0;
+    }
+
+    void
+    setBits(const std::vector<bool> &mask)
+    {
+        assert(mask.size() <= mSize);
+        for (int i = 0; i < mask.size(); i++) {
+            if (mask[i])
+                mMask[i / WordBits] |= 1ULL << (i % WordBits);
+        }
+    }
+
     int mSize;
-    std::vector<bool> mMask;
+    /**
+     * One bit per byte of the block, the bits past mSize being always
+     * clear, so the masks are combined a word at a time.
+     */
+    std::array<uint64_t, MaxWords> mMask;
     bool mAtomic;
     AtomicOpVector mAtomicOp;
 };
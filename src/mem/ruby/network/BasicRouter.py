@@ -36,5 +36,5 @@ class BasicRouter(ClockedObject):
 
     router_id = Param.Int("ID in relation to other routers")
 
-    # only used by garnet
+    # only used by garnet and the analytical network
     latency = Param.Cycles(1, "number of cycles inside router")
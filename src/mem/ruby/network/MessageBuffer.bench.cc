@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <ostream>
+
+#include "base/gtest/clocked_object_fixture.hh"
+#include "enums/MessageRandomization.hh"
+#include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
+#include "params/MessageBuffer.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+/** A message without a payload. */
+class BenchMessage : public Message
+{
+  public:
+    using Message::Message;
+
+    MsgPtr clone() const override { return makeMessage<BenchMessage>(*this); }
+    void print(std::ostream &out) const override { out << "BenchMessage"; }
+};
+
+/** A consumer which dequeues all the messages it is woken up for. */
+class Drain : public Consumer
+{
+  public:
+    MessageBuffer *buffer = nullptr;
+
+    using Consumer::Consumer;
+
+    void
+    wakeup() override
+    {
+        while (buffer->isReady(curTick()))
+            buffer->dequeue(curTick());
+    }
+
+    void print(std::ostream &out) const override { out << "Drain"; }
+};
+
+} // anonymous namespace
+
+/**
+ * Enqueue a batch of messages in a buffer with a one cycle latency, and
+ * let its consumer wake up and dequeue them. This measures the message
+ * allocation, the buffer and the consumer's wakeups together, as a Ruby
+ * controller sees them.
+ */
+static void
+BM_MessageBufferEnqueueDequeue(benchmark::State &state)
+{
+    const int num_msgs = state.range(0);
+    const Tick period = 1000;
+
+    ClockedObjectFixture fixture(period);
+    ClockedObject *object = fixture.getObject();
+    EventQueue *eq = object->eventQueue();
+
+    MessageBufferParams params;
+    fixture.setParams(params, "buffer");
+    params.allow_zero_latency = false;
+    params.buffer_size = 0;
+    params.max_dequeue_rate = 0;
+    params.ordered = state.range(1);
+    params.randomization = MessageRandomization::disabled;
+    params.routing_priority = 0;
+    params.port_in_port_connection_count = 0;
+    params.port_out_port_connection_count = 0;
+    MessageBuffer buffer(params);
+
+    Drain drain(object);
+    drain.buffer = &buffer;
+    buffer.setConsumer(&drain);
+
+    for (auto _ : state) {
+        for (int i = 0; i < num_msgs; i++) {
+            buffer.enqueue(makeMessage<BenchMessage>(curTick()), curTick(),
+                           period);
+        }
+        while (!eq->empty())
+            eq->serviceOne();
+    }
+    state.SetItemsProcessed(state.iterations() * num_msgs);
+}
+BENCHMARK(BM_MessageBufferEnqueueDequeue)
+    ->ArgsProduct({ { 1, 16, 256 }, { false, true } });
@@ -41,6 +41,8 @@
 #include "mem/ruby/network/MessageBuffer.hh"
 
 #include <cassert>
+#include <map>
+#include <mutex>
 
 #include "base/cprintf.hh"
 #include "base/logging.hh"
@@ -48,6 +50,7 @@
 #include "base/stl_helpers.hh"
 #include "debug/RubyQueue.hh"
 #include "mem/ruby/system/RubySystem.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -57,15 +60,125 @@ namespace ruby
 
 using stl_helpers::operator<<;
 
+/**
+ * The messages in flight to the buffers consumed on an event queue,
+ * sent from other event queues.
+ *
+ * The messages arriving at the same time are all inserted by a single
+ * event, ordered by the buffer they are sent to and the order they
+ * were sent in, so the consumers see the same order every run
+ * regardless of the order the sending threads got to them in. The
+ * lookahead between the queues guarantees that all the messages
+ * arriving at a time have been sent when the queue gets to it.
+ */
+class MessageDelivery
+{
+  public:
+    /** Get the deliveries to the buffers consumed on a queue. */
+    static MessageDelivery &
+    forQueue(EventQueue *eq)
+    {
+        static std::mutex mutex;
+        static std::map<EventQueue *, MessageDelivery> deliveries;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        return deliveries.try_emplace(eq, eq).first->second;
+    }
+
+    explicit MessageDelivery(EventQueue *eq) : eventq(eq) {}
+
+    void
+    send(MessageBuffer *buffer, MsgPtr message)
+    {
+        Tick when = message->getLastEnqueueTime();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = pending.find(when);
+        if (it == pending.end()) {
+            it = pending.emplace(when, Messages()).first;
+            eventq->schedule(new EventFunctionWrapper(
+                [this, when]{ deliver(when); },
+                "Ruby remote message delivery", true, DeliveryPri), when);
+        }
+        it->second.emplace_back(buffer, std::move(message));
+    }
+
+    /** Apply a functional access to the messages still in flight. */
+    template <class F>
+    void
+    forEachInFlight(const MessageBuffer *buffer, F f)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &arrival : pending) {
+            for (auto &msg : arrival.second) {
+                if (msg.first == buffer)
+                    f(msg.second.get());
+            }
+        }
+    }
+
+  private:
+    /**
+     * The messages are inserted before their consumers wake up at the
+     * same time.
+     */
+    static const Event::Priority DeliveryPri =
+        Event::Delayed_Writeback_Pri - 1;
+
+    typedef std::vector<std::pair<MessageBuffer *, MsgPtr>> Messages;
+
+    void
+    deliver(Tick when)
+    {
+        Messages arrived;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = pending.find(when);
+            assert(it != pending.end());
+            arrived.swap(it->second);
+            pending.erase(it);
+        }
+
+        std::sort(arrived.begin(), arrived.end(),
+            [](const Messages::value_type &a, const Messages::value_type &b)
+            {
+                if (a.first->m_ordinal != b.first->m_ordinal)
+                    return a.first->m_ordinal < b.first->m_ordinal;
+                return a.second->getMsgCounter() < b.second->getMsgCounter();
+            });
+
+        for (auto &msg : arrived)
+            msg.first->arrive(std::move(msg.second));
+    }
+
+    EventQueue *eventq;
+    std::mutex mutex;
+    std::map<Tick, Messages> pending;
+};
+
+namespace
+{
+
+uint64_t numMessageBuffers = 0;
+
+// The number of messages arriving in order that are kept out of the heap
+const size_t fifoCapacity = 64;
+
+} // anonymous namespace
+
 MessageBuffer::MessageBuffer(const Params &p)
-    : SimObject(p), m_stall_map_size(0), m_max_size(p.buffer_size),
+    : SimObject(p), m_fifo(fifoCapacity),
+    m_occupancy_mask(nullptr), m_occupancy_bit(0), m_stall_map_size(0),
+    m_max_size(p.buffer_size),
     m_max_dequeue_rate(p.max_dequeue_rate), m_dequeues_this_cy(0),
     m_time_last_time_size_checked(0),
     m_time_last_time_enqueue(0), m_time_last_time_pop(0),
-    m_last_arrival_time(0), m_strict_fifo(p.ordered),
+    m_last_arrival_time(0), m_last_wakeup_time(MaxTick),
+    m_strict_fifo(p.ordered),
     m_randomization(p.randomization),
     m_allow_zero_latency(p.allow_zero_latency),
     m_routing_priority(p.routing_priority),
+    m_ordinal(numMessageBuffers++),
     ADD_STAT(m_not_avail_count, statistics::units::Count::get(),
              "Number of times this buffer did not have N slots available"),
     ADD_STAT(m_msg_count, statistics::units::Count::get(),
@@ -137,7 +250,7 @@ MessageBuffer::getSize(Tick curTime)
 {
     if (m_time_last_time_size_checked != curTime) {
         m_time_last_time_size_checked = curTime;
-        m_size_last_time_size_checked = m_prio_heap.size();
+        m_size_last_time_size_checked = numMessages();
     }
 
     return m_size_last_time_size_checked;
@@ -161,7 +274,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
 
     if (m_time_last_time_pop < current_time) {
         // no pops this cycle - heap and stall queue size is correct
-        current_size = m_prio_heap.size();
+        current_size = numMessages();
         current_stall_size = m_stall_map_size;
     } else {
         if (m_time_last_time_enqueue < current_time) {
@@ -184,7 +297,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
         DPRINTF(RubyQueue, "n: %d, current_size: %d, heap size: %d, "
                 "m_max_size: %d\n",
                 n, current_size + current_stall_size,
-                m_prio_heap.size(), m_max_size);
+                numMessages(), m_max_size);
         m_not_avail_count++;
         return false;
     }
@@ -194,7 +307,7 @@ const Message*
 MessageBuffer::peek() const
 {
     DPRINTF(RubyQueue, "Peeking at head of queue.\n");
-    const Message* msg_ptr = m_prio_heap.front().get();
+    const Message* msg_ptr = head().get();
     assert(msg_ptr);
 
     DPRINTF(RubyQueue, "Message: %s\n", (*msg_ptr));
@@ -216,6 +329,20 @@ random_time()
 void
 MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
 {
+    assert(m_consumer != NULL);
+    if (inParallelMode) {
+        if (m_consumer->getObject()->eventQueue() != curEventQueue()) {
+            enqueueRemote(std::move(message), current_time, delta);
+            return;
+        }
+        if (!m_local_sender.load(std::memory_order_relaxed)) {
+            m_local_sender = true;
+            fatal_if(m_remote_sender.load(), "%s: Buffers between event "
+                     "queues cannot also be enqueued into from their "
+                     "consumer's event queue.\n", name());
+        }
+    }
+
     // record current time incase we have a pop that also adjusts my size
     if (m_time_last_time_enqueue < current_time) {
         m_msgs_this_cycle = 0;  // first msg this cycle
@@ -277,22 +404,123 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
     msg_ptr->setLastEnqueueTime(arrival_time);
     msg_ptr->setMsgCounter(m_msg_counter);
 
-    // Insert the message into the priority heap
-    m_prio_heap.push_back(message);
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    DPRINTF(RubyQueue, "Enqueue arrival_time: %lld, Message: %s\n",
+            arrival_time, *(message.get()));
+
+    insert(message);
+}
+
+void
+MessageBuffer::push(MsgPtr message)
+{
+    if (!m_fifo.full() &&
+        (m_fifo.empty() || !(m_fifo.back() > message))) {
+        m_fifo.push_back(std::move(message));
+    } else {
+        m_prio_heap.push_back(std::move(message));
+        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
+                  std::greater<MsgPtr>());
+    }
+    updateOccupancy();
+}
+
+void
+MessageBuffer::popHead()
+{
+    if (headInFifo()) {
+        // Drop the reference, the queue keeps its entries
+        m_fifo.front() = nullptr;
+        m_fifo.pop_front();
+    } else {
+        pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
+                 std::greater<MsgPtr>());
+        m_prio_heap.pop_back();
+    }
+    updateOccupancy();
+}
+
+void
+MessageBuffer::insert(MsgPtr message)
+{
+    push(message);
     // Increment the number of messages statistic
     m_buf_msgs++;
 
     assert((m_max_size == 0) ||
-           ((m_prio_heap.size() + m_stall_map_size) <= m_max_size));
+           ((numMessages() + m_stall_map_size) <= m_max_size));
+
+    // Schedule the wakeup. Messages enqueued in the same cycle mostly
+    // share their arrival time, and a wakeup requested for a future
+    // tick is still pending, so only ask for a new one when needed.
+    Tick arrival_time = message->getLastEnqueueTime();
+    if (arrival_time != m_last_wakeup_time || arrival_time <= curTick()) {
+        m_consumer->scheduleEventAbsolute(arrival_time);
+        m_last_wakeup_time = arrival_time;
+    }
+    m_consumer->storeEventInfo(m_vnet_id);
+}
 
-    DPRINTF(RubyQueue, "Enqueue arrival_time: %lld, Message: %s\n",
-            arrival_time, *(message.get()));
+void
+MessageBuffer::enqueueRemote(MsgPtr message, Tick current_time, Tick delta)
+{
+    // The sender cannot see how full the buffer is when the consumer
+    // is simulated by another thread, and with several senders the
+    // order of the messages would depend on the threads' timing.
+    fatal_if(m_max_size != 0, "%s: Buffers between event queues must be "
+             "unbounded (buffer_size = 0).\n", name());
+    fatal_if(m_randomization == MessageRandomization::enabled ||
+             (m_randomization == MessageRandomization::ruby_system &&
+              RubySystem::getRandomization()), "%s: Buffers between event "
+             "queues cannot randomize the message delays.\n", name());
+    const EventQueue *sender = nullptr;
+    if (!m_remote_sender.compare_exchange_strong(sender, curEventQueue()))
+        fatal_if(sender != curEventQueue(), "%s: Buffers between event "
+                 "queues must have a single sending event queue.\n",
+                 name());
+    fatal_if(m_local_sender.load(), "%s: Buffers between event queues "
+             "cannot also be enqueued into from their consumer's event "
+             "queue.\n", name());
+    fatal_if(delta < simQuantum, "%s: Messages between event queues must "
+             "arrive at least sim_quantum (%d ticks) after they are sent, "
+             "this one takes %d ticks.\n", name(), simQuantum, delta);
+
+    Tick arrival_time = current_time + delta;
+    Message* msg_ptr = message.get();
+    assert(current_time >= msg_ptr->getLastEnqueueTime() &&
+           "ensure we aren't dequeued early");
 
-    // Schedule the wakeup
-    assert(m_consumer != NULL);
-    m_consumer->scheduleEventAbsolute(arrival_time);
-    m_consumer->storeEventInfo(m_vnet_id);
+    msg_ptr->updateDelayedTicks(current_time);
+    msg_ptr->setLastEnqueueTime(arrival_time);
+    // Only orders the messages until they arrive, the buffer's own
+    // counter is only updated by the consumer's thread.
+    msg_ptr->setMsgCounter(++m_remote_msg_counter);
+
+    DPRINTF(RubyQueue, "Enqueue remote arrival_time: %lld, Message: %s\n",
+            arrival_time, *msg_ptr);
+
+    MessageDelivery::forQueue(m_consumer->getObject()->eventQueue())
+        .send(this, std::move(message));
+}
+
+void
+MessageBuffer::arrive(MsgPtr message)
+{
+    // The bookkeeping enqueue() does for the local messages, done when
+    // the message arrives.
+    if (m_time_last_time_enqueue < curTick()) {
+        m_msgs_this_cycle = 0;
+        m_time_last_time_enqueue = curTick();
+    }
+
+    m_msg_counter++;
+    m_msgs_this_cycle++;
+
+    if (!RubySystem::getWarmupEnabled())
+        m_last_arrival_time = curTick();
+
+    message->setMsgCounter(m_msg_counter);
+
+    insert(std::move(message));
 }
 
 Tick
@@ -302,7 +530,7 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     assert(isReady(current_time));
 
     // get MsgPtr of the message about to be dequeued
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = head();
 
     // get the delay cycles
     message->updateDelayedTicks(current_time);
@@ -311,15 +539,14 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     // record previous size and time so the current buffer size isn't
     // adjusted until schd cycle
     if (m_time_last_time_pop < current_time) {
-        m_size_at_cycle_start = m_prio_heap.size();
+        m_size_at_cycle_start = numMessages();
         m_stalled_at_cycle_start = m_stall_map_size;
         m_time_last_time_pop = current_time;
         m_dequeues_this_cy = 0;
     }
     ++m_dequeues_this_cy;
 
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
-    m_prio_heap.pop_back();
+    popHead();
     if (decrement_messages) {
         // Record how much time is passed since the message was enqueued
         m_stall_time += curTick() - message->getLastEnqueueTime();
@@ -353,7 +580,12 @@ MessageBuffer::unregisterDequeueCallback()
 void
 MessageBuffer::clear()
 {
+    while (!m_fifo.empty()) {
+        m_fifo.front() = nullptr;
+        m_fifo.pop_front();
+    }
     m_prio_heap.clear();
+    updateOccupancy();
 
     m_msg_counter = 0;
     m_time_last_time_enqueue = 0;
@@ -368,27 +600,24 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 {
     DPRINTF(RubyQueue, "Recycling.\n");
     assert(isReady(current_time));
-    MsgPtr node = m_prio_heap.front();
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    MsgPtr node = head();
+    popHead();
 
     Tick future_time = current_time + recycle_latency;
     node->setLastEnqueueTime(future_time);
 
-    m_prio_heap.back() = node;
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    push(node);
     m_consumer->scheduleEventAbsolute(future_time);
 }
 
 void
-MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
+MessageBuffer::reanalyzeList(StallMsgList &lt, Tick schdTick)
 {
     while (!lt.empty()) {
         MsgPtr m = lt.front();
         assert(m->getLastEnqueueTime() <= schdTick);
 
-        m_prio_heap.push_back(m);
-        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                  std::greater<MsgPtr>());
+        push(m);
 
         m_consumer->scheduleEventAbsolute(schdTick);
 
@@ -411,10 +640,11 @@ MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle
     //
-    m_stall_map_size -= m_stall_msg_map[addr].size();
+    auto map_iter = m_stall_msg_map.find(addr);
+    m_stall_map_size -= map_iter->second.size();
     assert(m_stall_map_size >= 0);
-    reanalyzeList(m_stall_msg_map[addr], current_time);
-    m_stall_msg_map.erase(addr);
+    reanalyzeList(map_iter->second, current_time);
+    m_stall_msg_map.erase(map_iter);
 }
 
 void
@@ -428,7 +658,7 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle.
     //
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
+    for (auto map_iter = m_stall_msg_map.begin();
          map_iter != m_stall_msg_map.end(); ++map_iter) {
         m_stall_map_size -= map_iter->second.size();
         assert(m_stall_map_size >= 0);
@@ -443,7 +673,7 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     DPRINTF(RubyQueue, "Stalling due to %#x\n", addr);
     assert(isReady(current_time));
     assert(getOffset(addr) == 0);
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = head();
 
     // Since the message will just be moved to stall map, indicate that the
     // buffer should not decrement the m_buf_msgs statistic
@@ -504,6 +734,8 @@ MessageBuffer::print(std::ostream& out) const
     }
 
     std::vector<MsgPtr> copy(m_prio_heap);
+    copy.insert(copy.end(), m_fifo.begin(), m_fifo.end());
+    std::make_heap(copy.begin(), copy.end(), std::greater<MsgPtr>());
     std::sort_heap(copy.begin(), copy.end(), std::greater<MsgPtr>());
     ccprintf(out, "%s] %s", copy, name());
 }
@@ -515,8 +747,8 @@ MessageBuffer::isReady(Tick current_time) const
     bool can_dequeue = (m_max_dequeue_rate == 0) ||
                        (m_time_last_time_pop < current_time) ||
                        (m_dequeues_this_cy < m_max_dequeue_rate);
-    bool is_ready = (m_prio_heap.size() > 0) &&
-                   (m_prio_heap.front()->getLastEnqueueTime() <= current_time);
+    bool is_ready = !isEmpty() &&
+                   (head()->getLastEnqueueTime() <= current_time);
     if (!can_dequeue && is_ready) {
         // Make sure the Consumer executes next cycle to dequeue the ready msg
         m_consumer->scheduleEvent(Cycles(1));
@@ -527,10 +759,10 @@ MessageBuffer::isReady(Tick current_time) const
 Tick
 MessageBuffer::readyTime() const
 {
-    if (m_prio_heap.empty())
+    if (isEmpty())
         return MaxTick;
     else
-        return m_prio_heap.front()->getLastEnqueueTime();
+        return head()->getLastEnqueueTime();
 }
 
 uint32_t
@@ -541,10 +773,11 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
 
     uint32_t num_functional_accesses = 0;
 
-    // Check the priority heap and write any messages that may
+    // Check the messages in the buffer and write any that may
     // correspond to the address in the packet.
-    for (unsigned int i = 0; i < m_prio_heap.size(); ++i) {
-        Message *msg = m_prio_heap[i].get();
+    for (unsigned int i = 0; i < numMessages(); ++i) {
+        Message *msg = i < m_prio_heap.size() ? m_prio_heap[i].get() :
+            m_fifo[m_fifo.head() + i - m_prio_heap.size()].get();
         if (is_read && !mask && msg->functionalRead(pkt))
             return 1;
         else if (is_read && mask && msg->functionalRead(pkt, *mask))
@@ -555,11 +788,11 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
 
     // Check the stall queue and write any messages that may
     // correspond to the address in the packet.
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
+    for (auto map_iter = m_stall_msg_map.begin();
          map_iter != m_stall_msg_map.end();
          ++map_iter) {
 
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
+        for (auto it = (map_iter->second).begin();
             it != (map_iter->second).end(); ++it) {
 
             Message *msg = (*it).get();
@@ -572,6 +805,25 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
         }
     }
 
+    // Check the messages sent from other event queues that have not
+    // arrived yet.
+    if (m_remote_sender) {
+        bool found = false;
+        MessageDelivery::forQueue(m_consumer->getObject()->eventQueue())
+            .forEachInFlight(this, [&](Message *msg) {
+                if (found)
+                    return;
+                if (is_read && !mask && msg->functionalRead(pkt))
+                    found = true;
+                else if (is_read && mask && msg->functionalRead(pkt, *mask))
+                    num_functional_accesses++;
+                else if (!is_read && msg->functionalWrite(pkt))
+                    num_functional_accesses++;
+            });
+        if (found)
+            return 1;
+    }
+
     return num_functional_accesses;
 }
 
@@ -47,6 +47,7 @@
 #define __MEM_RUBY_NETWORK_MESSAGEBUFFER_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <iostream>
@@ -54,12 +55,15 @@
 #include <unordered_map>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/trace.hh"
 #include "debug/RubyQueue.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/common/FlatAddrMap.hh"
+#include "mem/ruby/common/InlineQueue.hh"
 #include "mem/ruby/network/dummy_port.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "params/MessageBuffer.hh"
@@ -71,6 +75,8 @@ namespace gem5
 namespace ruby
 {
 
+class MessageDelivery;
+
 class MessageBuffer : public SimObject
 {
   public:
@@ -92,10 +98,8 @@ class MessageBuffer : public SimObject
     void
     delayHead(Tick current_time, Tick delta)
     {
-        MsgPtr m = m_prio_heap.front();
-        std::pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                      std::greater<MsgPtr>());
-        m_prio_heap.pop_back();
+        MsgPtr m = head();
+        popHead();
         enqueue(m, current_time, delta);
     }
 
@@ -121,7 +125,7 @@ class MessageBuffer : public SimObject
     //! message queue.  The function assumes that the queue is nonempty.
     const Message* peek() const;
 
-    const MsgPtr &peekMsgPtr() const { return m_prio_heap.front(); }
+    const MsgPtr &peekMsgPtr() const { return head(); }
 
     void enqueue(MsgPtr message, Tick curTime, Tick delta);
 
@@ -145,7 +149,20 @@ class MessageBuffer : public SimObject
     void unregisterDequeueCallback();
 
     void recycle(Tick current_time, Tick recycle_latency);
-    bool isEmpty() const { return m_prio_heap.size() == 0; }
+    bool isEmpty() const { return m_fifo.empty() && m_prio_heap.empty(); }
+
+    /**
+     * Mirror whether the buffer holds any message in a bit of a mask
+     * owned by the consumer, so that it can skip the empty buffers
+     * rather than polling all of them.
+     */
+    void
+    trackOccupancy(std::vector<uint64_t> *mask, unsigned bit)
+    {
+        m_occupancy_mask = mask;
+        m_occupancy_bit = bit;
+        updateOccupancy();
+    }
     bool isStallMapEmpty() { return m_stall_msg_map.size() == 0; }
     unsigned int getStallMapSize() { return m_stall_msg_map.size(); }
 
@@ -193,33 +210,109 @@ class MessageBuffer : public SimObject
     int routingPriority() const { return m_routing_priority; }
 
   private:
-    void reanalyzeList(std::list<MsgPtr> &, Tick);
+    friend class MessageDelivery;
+
+    // The messages stalled on a line, most lines only have a few
+    typedef InlineQueue<MsgPtr, 2> StallMsgList;
+
+    void reanalyzeList(StallMsgList &, Tick);
+
+    // The number of messages waiting in the buffer, not counting the
+    // stalled ones
+    size_t
+    numMessages() const
+    {
+        return m_fifo.size() + m_prio_heap.size();
+    }
+
+    // Whether the earliest message is the head of m_fifo rather than the
+    // top of m_prio_heap
+    bool
+    headInFifo() const
+    {
+        return !m_fifo.empty() && (m_prio_heap.empty() ||
+            m_prio_heap.front() > m_fifo[m_fifo.head()]);
+    }
+
+    const MsgPtr &
+    head() const
+    {
+        return headInFifo() ? m_fifo[m_fifo.head()] : m_prio_heap.front();
+    }
+
+    void popHead();
+    void push(MsgPtr message);
 
     uint32_t functionalAccess(Packet *pkt, bool is_read, WriteMask *mask);
 
+    /**
+     * Hand a message over to a consumer on another event queue. The
+     * message is inserted into the buffer at its arrival time by the
+     * consumer's queue, so only the consumer's thread ever touches the
+     * buffer's contents and counters.
+     */
+    void enqueueRemote(MsgPtr message, Tick current_time, Tick delta);
+
+    /**
+     * Count and insert a message sent from another event queue, on the
+     * consumer's queue at the message's arrival time.
+     */
+    void arrive(MsgPtr message);
+
+    /** Insert a message into the buffer and wake up the consumer. */
+    void insert(MsgPtr message);
+
   private:
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
+
+    /**
+     * The messages waiting in the buffer, in the order of their arrival
+     * times and then their message counters. As the enqueue latencies are
+     * mostly constant, the messages mostly arrive in that order, and are
+     * appended to m_fifo. Those that arrive out of order, or once m_fifo
+     * is full, go to the m_prio_heap heap instead. The head of the buffer
+     * is the earliest of the heads of the two.
+     */
+    CircularQueue<MsgPtr> m_fifo;
     std::vector<MsgPtr> m_prio_heap;
 
+    //! Occupancy mask of the consumer, see trackOccupancy()
+    std::vector<uint64_t> *m_occupancy_mask;
+    unsigned m_occupancy_bit;
+
+    void
+    updateOccupancy()
+    {
+        if (!m_occupancy_mask)
+            return;
+        uint64_t &word = (*m_occupancy_mask)[m_occupancy_bit / 64];
+        uint64_t bit = 1ULL << (m_occupancy_bit % 64);
+        if (isEmpty())
+            word &= ~bit;
+        else
+            word |= bit;
+    }
+
     std::function<void()> m_dequeue_callback;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    // The stalled messages are moved back to the buffer in the order of
+    // their arrival times, so the iteration order of the map, which only
+    // depends on the order of the stalls, does not matter.
+    typedef FlatAddrMap<StallMsgList> StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
      * If this buffer allows the receiver to stall messages, on a stall
-     * request, the stalled message is removed from the m_prio_heap and placed
+     * request, the stalled message is removed from the buffer and placed
      * in the m_stall_msg_map. Messages are held there until the receiver
      * requests they be reanalyzed, at which point they are moved back to
-     * m_prio_heap.
+     * the buffer.
      *
      * NOTE: The stall map holds messages in the order in which they were
      * initially received, and when a line is unblocked, the messages are
-     * moved back to the m_prio_heap in the same order. This prevents starving
+     * moved back to the buffer in the same order. This prevents starving
      * older requests with younger ones.
      */
     StallMsgMapType m_stall_msg_map;
@@ -236,7 +329,7 @@ class MessageBuffer : public SimObject
      * Current size of the stall map.
      * Track the number of messages held in stall map lists. This is used to
      * ensure that if the buffer is finite-sized, it blocks further requests
-     * when the m_prio_heap and m_stall_msg_map contain m_max_size messages.
+     * when the buffer and m_stall_msg_map contain m_max_size messages.
      */
     int m_stall_map_size;
 
@@ -265,6 +358,9 @@ class MessageBuffer : public SimObject
     Tick m_time_last_time_pop;
     Tick m_last_arrival_time;
 
+    // last wakeup requested from the consumer by insert()
+    Tick m_last_wakeup_time;
+
     unsigned int m_size_at_cycle_start;
     unsigned int m_stalled_at_cycle_start;
     unsigned int m_msgs_this_cycle;
@@ -280,6 +376,27 @@ class MessageBuffer : public SimObject
     int m_input_link_id;
     int m_vnet_id;
 
+    /**
+     * The order in which the buffers were created, which orders the
+     * messages arriving on different buffers from other event queues
+     * at the same time.
+     */
+    const uint64_t m_ordinal;
+
+    /**
+     * The event queue the messages are sent from when it is not the
+     * consumer's. A buffer has either a single remote sending queue or
+     * only local senders, so the order of its messages never depends on
+     * the threads' timing.
+     */
+    std::atomic<const EventQueue *> m_remote_sender{nullptr};
+
+    /** Whether messages were enqueued from the consumer's event queue. */
+    std::atomic<bool> m_local_sender{false};
+
+    /** Orders the messages from the remote sender until they arrive. */
+    uint64_t m_remote_msg_counter = 0;
+
     // Count the # of times I didn't have N slots available
     statistics::Scalar m_not_avail_count;
     statistics::Scalar m_msg_count;
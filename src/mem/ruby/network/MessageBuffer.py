@@ -71,6 +71,11 @@ class MessageBuffer(SimObject):
                                             buffer connects different objects",
     )
 
+    # A buffer runs on the event queue of its parent, and can carry
+    # messages to a consumer on another event queue.
+    _partition_port = ("in_port", "out_port")
+    _partition_follow_parent = True
+
     out_port = RequestPort("Request port to MessageBuffer receiver")
     master = DeprecatedParam(out_port, "`master` is now called `out_port`")
     in_port = ResponsePort("Response port from MessageBuffer sender")
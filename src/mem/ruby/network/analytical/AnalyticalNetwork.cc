@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/network/analytical/AnalyticalNetwork.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "base/cast.hh"
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
+#include "debug/RubyNetwork.hh"
+#include "mem/ruby/common/NetDest.hh"
+#include "mem/ruby/network/BasicLink.hh"
+#include "mem/ruby/network/BasicRouter.hh"
+#include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace
+{
+
+// The M/D/1 queueing delay grows without bound as a link's utilization
+// approaches one, and the utilization measured over a window can exceed
+// one, so it is capped here.
+const double maxUtilization = 0.95;
+
+} // anonymous namespace
+
+AnalyticalNetwork::AnalyticalNetwork(const Params &p)
+    : Network(p), Consumer(this),
+      m_model_contention(p.model_contention),
+      m_contention_window(p.contention_window),
+      networkStats(this)
+{
+    fatal_if(m_model_contention && m_contention_window == 0,
+             "%s: The contention window must be at least one cycle.",
+             name());
+
+    // The routers only provide their latency
+    for (auto router : p.routers) {
+        auto id = static_cast<size_t>(router->params().router_id);
+        if (id >= m_switch_latency.size())
+            m_switch_latency.resize(id + 1);
+        m_switch_latency[id] = router->params().latency;
+    }
+    m_switch_links.resize(m_switch_latency.size());
+
+    m_node_links.resize(m_nodes);
+    m_global_ids.resize(m_nodes);
+    m_machines.resize(m_nodes);
+}
+
+void
+AnalyticalNetwork::init()
+{
+    Network::init();
+
+    // The topology pointer should have already been initialized in
+    // the parent class network constructor.
+    assert(m_topology_ptr != NULL);
+    m_topology_ptr->createLinks(this);
+
+    computePaths();
+
+    for (NodeID node = 0; node < m_nodes; node++) {
+        for (int vnet = 0; vnet < m_toNetQueues[node].size(); vnet++) {
+            MessageBuffer *buffer = m_toNetQueues[node][vnet];
+            if (buffer) {
+                buffer->setConsumer(this);
+                buffer->setVnet(vnet);
+            }
+        }
+    }
+    m_last_arrival.assign(m_nodes,
+                          std::vector<Tick>(m_virtual_networks, 0));
+}
+
+int
+AnalyticalNetwork::addLink(BasicLink *link, int dest_switch,
+                           NodeID dest_node,
+                           const std::vector<NetDest> &routing_table_entry)
+{
+    fatal_if(link->m_bandwidth_factor <= 0,
+             "%s: The bandwidth factor of link %s must be positive.",
+             name(), link->name());
+
+    m_links.push_back({dest_switch, link->m_latency,
+                       link->m_bandwidth_factor, link->m_weight, dest_node,
+                       routing_table_entry, Cycles(0), 0, 0.0});
+    return m_links.size() - 1;
+}
+
+// From a switch to an endpoint node
+void
+AnalyticalNetwork::makeExtOutLink(SwitchID src, NodeID global_dest,
+                                  BasicLink* link,
+                                  std::vector<NetDest>& routing_table_entry)
+{
+    NodeID local_dest = getLocalNodeID(global_dest);
+    assert(local_dest < m_nodes);
+    assert(src < m_switch_links.size());
+
+    m_global_ids[local_dest] = global_dest;
+    m_switch_links[src].push_back(
+        addLink(link, -1, local_dest, routing_table_entry));
+}
+
+// From an endpoint node to a switch
+void
+AnalyticalNetwork::makeExtInLink(NodeID global_src, SwitchID dest,
+                                 BasicLink* link,
+                                 std::vector<NetDest>& routing_table_entry)
+{
+    NodeID local_src = getLocalNodeID(global_src);
+    assert(local_src < m_nodes);
+    assert(dest < m_switch_links.size());
+
+    m_global_ids[local_src] = global_src;
+    m_node_links[local_src].push_back(
+        addLink(link, dest, 0, routing_table_entry));
+}
+
+// From a switch to a switch
+void
+AnalyticalNetwork::makeInternalLink(SwitchID src, SwitchID dest,
+                                    BasicLink* link,
+                                    std::vector<NetDest>& routing_table_entry,
+                                    PortDirection src_outport,
+                                    PortDirection dst_inport)
+{
+    assert(src < m_switch_links.size() && dest < m_switch_links.size());
+    m_switch_links[src].push_back(
+        addLink(link, dest, 0, routing_table_entry));
+}
+
+void
+AnalyticalNetwork::computePaths()
+{
+    for (NodeID node = 0; node < m_nodes; node++) {
+        NodeID global_id = m_global_ids[node];
+        for (int m = 0; m < MachineType_NUM; m++) {
+            MachineType type = (MachineType)m;
+            NodeID base = MachineType_base_number(type);
+            if (global_id >= base &&
+                global_id < base + MachineType_base_count(type)) {
+                m_machines[node] = {type, global_id - base};
+                break;
+            }
+        }
+    }
+
+    m_paths.resize(m_virtual_networks);
+    for (int vnet = 0; vnet < m_virtual_networks; vnet++) {
+        m_paths[vnet].resize(m_nodes);
+        for (NodeID src = 0; src < m_nodes; src++) {
+            m_paths[vnet][src].resize(m_nodes);
+            for (NodeID dest = 0; dest < m_nodes; dest++)
+                m_paths[vnet][src][dest] = computePath(src, dest, vnet);
+        }
+    }
+}
+
+/*
+ * Follows the routing tables Topology computed for the links, taking the
+ * lowest weight link towards the destination out of every switch.
+ */
+AnalyticalNetwork::Path
+AnalyticalNetwork::computePath(NodeID src, NodeID dest, int vnet) const
+{
+    const MachineID &machine = m_machines[dest];
+    auto next_link = [&](const std::vector<int> &links) {
+        int next = -1;
+        for (int l : links) {
+            const Link &link = m_links[l];
+            if (vnet >= link.routes.size() ||
+                !link.routes[vnet].isElement(machine)) {
+                continue;
+            }
+            if (next < 0 || link.weight < m_links[next].weight)
+                next = l;
+        }
+        return next;
+    };
+
+    Path path;
+    int l = next_link(m_node_links[src]);
+    while (l >= 0 && path.links.size() < m_links.size()) {
+        const Link &link = m_links[l];
+        path.links.push_back(l);
+        path.latency += link.latency;
+        if (path.links.size() == 1 || link.bandwidth < path.bandwidth)
+            path.bandwidth = link.bandwidth;
+
+        if (link.dest_switch < 0) {
+            path.valid = link.dest_node == dest;
+            break;
+        }
+        path.latency += m_switch_latency[link.dest_switch];
+        l = next_link(m_switch_links[link.dest_switch]);
+    }
+    return path;
+}
+
+void
+AnalyticalNetwork::wakeup()
+{
+    Tick current_time = clockEdge();
+
+    for (NodeID node = 0; node < m_nodes; node++) {
+        for (int vnet = 0; vnet < m_toNetQueues[node].size(); vnet++) {
+            MessageBuffer *buffer = m_toNetQueues[node][vnet];
+            if (!buffer)
+                continue;
+
+            while (buffer->isReady(current_time)) {
+                if (!sendMessage(buffer, node, vnet)) {
+                    scheduleEvent(Cycles(1));
+                    break;
+                }
+            }
+        }
+    }
+}
+
+bool
+AnalyticalNetwork::sendMessage(MessageBuffer *buffer, NodeID src, int vnet)
+{
+    Tick current_time = clockEdge();
+    MsgPtr msg_ptr = buffer->peekMsgPtr();
+    Message *net_msg_ptr = msg_ptr.get();
+    std::vector<NodeID> dests = net_msg_ptr->getDestination().getAllDest();
+
+    // Check for resources at all the destinations
+    for (auto &dest : dests) {
+        dest = getLocalNodeID(dest);
+        MessageBuffer *out = m_fromNetQueues[dest][vnet];
+        assert(out);
+        if (!out->areNSlotsAvailable(1, current_time)) {
+            DPRINTF(RubyNetwork, "Can't deliver message since node %d "
+                    "is blocked\n", dest);
+            return false;
+        }
+    }
+
+    MessageSizeType size_type = net_msg_ptr->getMessageSize();
+    int bytes = MessageSizeType_to_int(size_type);
+    networkStats.msgCount[size_type]++;
+    networkStats.msgBytes[size_type] += bytes;
+
+    MsgPtr unmodified_msg_ptr;
+    if (dests.size() > 1) {
+        // Each destination gets its own copy of the message, with only
+        // itself as the destination
+        unmodified_msg_ptr = msg_ptr->clone();
+    }
+
+    buffer->dequeue(current_time);
+
+    for (int i = 0; i < dests.size(); i++) {
+        NodeID dest = dests[i];
+        if (i + 1 == dests.size() && i > 0)
+            msg_ptr = unmodified_msg_ptr;
+        else if (i > 0)
+            msg_ptr = unmodified_msg_ptr->clone();
+
+        const Path &path = m_paths[vnet][src][dest];
+        panic_if(!path.valid, "%s: No route from node %d to node %d on "
+                 "vnet %d.", name(), src, dest, vnet);
+
+        Tick arrival = current_time + cyclesToTicks(messageLatency(path,
+                                                                  bytes));
+        if (m_ordered[vnet])
+            arrival = std::max(arrival, m_last_arrival[dest][vnet]);
+        m_last_arrival[dest][vnet] = arrival;
+
+        NetDest &destination = msg_ptr->getDestination();
+        destination.clear();
+        destination.add(m_machines[dest]);
+
+        DPRINTF(RubyNetwork, "Delivering message from node %d to node %d "
+                "on vnet %d at %d: %s\n", src, dest, vnet, arrival,
+                *msg_ptr);
+        m_fromNetQueues[dest][vnet]->enqueue(msg_ptr, current_time,
+                                             arrival - current_time);
+    }
+    return true;
+}
+
+Cycles
+AnalyticalNetwork::messageLatency(const Path &path, int bytes)
+{
+    // The message is serialized once, on the narrowest link
+    Cycles latency = path.latency + Cycles(divCeil(bytes, path.bandwidth));
+
+    if (m_model_contention) {
+        double queueing = 0;
+        for (int l : path.links)
+            queueing += queueingDelay(m_links[l], bytes);
+        Cycles queueing_latency(std::lround(queueing));
+        latency += queueing_latency;
+        networkStats.queueingLatency += queueing_latency;
+    }
+
+    networkStats.deliveries++;
+    networkStats.hops += path.links.size();
+    networkStats.latency += latency;
+    return latency;
+}
+
+/*
+ * The mean waiting time of an M/D/1 queue is rho / (2 * (1 - rho)) service
+ * times, for a utilization rho. The utilization of a link is the one
+ * measured over the previous contention window, and the message is
+ * accounted to the current window.
+ */
+double
+AnalyticalNetwork::queueingDelay(Link &link, int bytes)
+{
+    Cycles now = curCycle();
+    if (now >= link.window_start + m_contention_window) {
+        uint64_t elapsed = now - link.window_start;
+        // Nothing used the link over the window before the current one if
+        // more than one window elapsed
+        link.utilization = elapsed < 2 * m_contention_window ?
+            double(link.window_bytes) /
+                (double(m_contention_window) * link.bandwidth) :
+            0;
+        link.window_start = Cycles(now - elapsed % m_contention_window);
+        link.window_bytes = 0;
+    }
+    link.window_bytes += bytes;
+
+    double rho = std::min(link.utilization, maxUtilization);
+    double service = double(bytes) / link.bandwidth;
+    return rho / (2 * (1 - rho)) * service;
+}
+
+void
+AnalyticalNetwork::print(std::ostream& out) const
+{
+    out << "[AnalyticalNetwork]";
+}
+
+AnalyticalNetwork::
+NetworkStats::NetworkStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(msgCount, statistics::units::Count::get(),
+               "Number of messages sent, by message size type"),
+      ADD_STAT(msgBytes, statistics::units::Byte::get(),
+               "Number of bytes sent, by message size type"),
+      ADD_STAT(deliveries, statistics::units::Count::get(),
+               "Number of messages delivered"),
+      ADD_STAT(hops, statistics::units::Count::get(),
+               "Number of links traversed by the delivered messages"),
+      ADD_STAT(latency, statistics::units::Cycle::get(),
+               "Total latency of the delivered messages"),
+      ADD_STAT(queueingLatency, statistics::units::Cycle::get(),
+               "Total estimated queueing latency of the delivered messages"),
+      ADD_STAT(avgHops, statistics::units::Rate<
+                  statistics::units::Count, statistics::units::Count>::get(),
+               "Average number of links traversed by a message",
+               hops / deliveries),
+      ADD_STAT(avgLatency, statistics::units::Rate<
+                  statistics::units::Cycle, statistics::units::Count>::get(),
+               "Average latency of a message", latency / deliveries),
+      ADD_STAT(avgQueueingLatency, statistics::units::Rate<
+                  statistics::units::Cycle, statistics::units::Count>::get(),
+               "Average estimated queueing latency of a message",
+               queueingLatency / deliveries)
+{
+    msgCount.init(MessageSizeType_NUM).flags(statistics::nozero);
+    msgBytes.init(MessageSizeType_NUM).flags(statistics::nozero);
+    for (int type = 0; type < MessageSizeType_NUM; type++) {
+        std::string name = MessageSizeType_to_string((MessageSizeType)type);
+        msgCount.subname(type, name);
+        msgBytes.subname(type, name);
+    }
+}
+
+} // namespace ruby
+} // namespace gem5
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
+#define __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
+
+#include <iostream>
+#include <vector>
+
+#include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/common/MachineID.hh"
+#include "mem/ruby/network/Network.hh"
+#include "params/AnalyticalNetwork.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+class MessageBuffer;
+
+/**
+ * A network that delivers each message after a latency looked up in a
+ * table precomputed from the topology, rather than by moving it through
+ * routers and links. The latency of a path is the sum of the latencies of
+ * its links and routers plus the serialization of the message on its
+ * narrowest link. Optionally, the queueing delay of every link on the path
+ * is estimated with an M/D/1 model from the link's utilization over the
+ * previous contention window.
+ */
+class AnalyticalNetwork : public Network, public Consumer
+{
+  public:
+    PARAMS(AnalyticalNetwork);
+
+    AnalyticalNetwork(const Params &p);
+    ~AnalyticalNetwork() = default;
+
+    void init();
+
+    void wakeup();
+
+    // Methods used by Topology to setup the network
+    void makeExtOutLink(SwitchID src, NodeID dest, BasicLink* link,
+                     std::vector<NetDest>& routing_table_entry);
+    void makeExtInLink(NodeID src, SwitchID dest, BasicLink* link,
+                    std::vector<NetDest>& routing_table_entry);
+    void makeInternalLink(SwitchID src, SwitchID dest, BasicLink* link,
+                          std::vector<NetDest>& routing_table_entry,
+                          PortDirection src_outport,
+                          PortDirection dst_inport);
+
+    void collateStats() {}
+    void print(std::ostream& out) const;
+
+    // Messages in the network are always in the controllers' buffers,
+    // which the controllers access functionally themselves.
+    bool functionalRead(Packet *pkt) { return false; }
+    bool functionalRead(Packet *pkt, WriteMask &mask) { return false; }
+    uint32_t functionalWrite(Packet *pkt) { return 0; }
+
+  private:
+    struct Link
+    {
+        // The switch the link leads to, or -1 for a link to a node
+        int dest_switch;
+        Cycles latency;
+        // Bytes per cycle
+        int bandwidth;
+        int weight;
+        // The local node a link to a node leads to
+        NodeID dest_node;
+        // The destinations reached through the link, for each vnet
+        std::vector<NetDest> routes;
+
+        // Contention estimate
+        Cycles window_start;
+        uint64_t window_bytes;
+        double utilization;
+    };
+
+    struct Path
+    {
+        bool valid = false;
+        std::vector<int> links;
+        // Link and router latencies
+        Cycles latency;
+        // Bandwidth of the narrowest link, in bytes per cycle
+        int bandwidth = 0;
+    };
+
+    int addLink(BasicLink *link, int dest_switch, NodeID dest_node,
+                const std::vector<NetDest> &routing_table_entry);
+    void computePaths();
+    Path computePath(NodeID src, NodeID dest, int vnet) const;
+
+    bool sendMessage(MessageBuffer *buffer, NodeID src, int vnet);
+    Cycles messageLatency(const Path &path, int bytes);
+    double queueingDelay(Link &link, int bytes);
+
+    // Private copy constructor and assignment operator
+    AnalyticalNetwork(const AnalyticalNetwork& obj);
+    AnalyticalNetwork& operator=(const AnalyticalNetwork& obj);
+
+    const bool m_model_contention;
+    const Cycles m_contention_window;
+
+    std::vector<Link> m_links;
+    // The links out of each switch and their latency
+    std::vector<std::vector<int>> m_switch_links;
+    std::vector<Cycles> m_switch_latency;
+    // The links into the network from each local node
+    std::vector<std::vector<int>> m_node_links;
+    // The global ID and machine of each local node
+    std::vector<NodeID> m_global_ids;
+    std::vector<MachineID> m_machines;
+
+    // Indexed by vnet, local source and local destination
+    std::vector<std::vector<std::vector<Path>>> m_paths;
+
+    // Latest delivery to each local node and vnet, to keep ordered vnets
+    // ordered under varying contention
+    std::vector<std::vector<Tick>> m_last_arrival;
+
+    struct NetworkStats : public statistics::Group
+    {
+        NetworkStats(statistics::Group *parent);
+
+        statistics::Vector msgCount;
+        statistics::Vector msgBytes;
+        statistics::Scalar deliveries;
+        statistics::Scalar hops;
+        statistics::Scalar latency;
+        statistics::Scalar queueingLatency;
+        statistics::Formula avgHops;
+        statistics::Formula avgLatency;
+        statistics::Formula avgQueueingLatency;
+    } networkStats;
+};
+
+inline std::ostream&
+operator<<(std::ostream& out, const AnalyticalNetwork& obj)
+{
+    obj.print(out);
+    out << std::flush;
+    return out;
+}
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
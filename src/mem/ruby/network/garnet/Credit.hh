@@ -32,6 +32,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_CREDIT_HH__
 
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 
 #include "base/types.hh"
@@ -64,6 +65,23 @@ class Credit : public flit
 
     ~Credit() {};
 
+    static void *
+    operator new(std::size_t size)
+    {
+        if (size != sizeof(Credit))
+            return ::operator new(size);
+        return FlitFreeList<sizeof(Credit)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        if (size != sizeof(Credit))
+            ::operator delete(p);
+        else
+            FlitFreeList<sizeof(Credit)>::release(p);
+    }
+
     bool is_free_signal() { return m_is_free_signal; }
 
   private:
@@ -31,6 +31,7 @@
 
 #include "mem/ruby/network/garnet/GarnetNetwork.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "base/cast.hh"
@@ -62,7 +63,12 @@ namespace garnet
  */
 
 GarnetNetwork::GarnetNetwork(const Params &p)
-    : Network(p)
+    : Network(p), m_router_threads(p.router_threads),
+      m_next_ready_router(0),
+      m_evaluate_routers_event([this]{ evaluateRouters(); },
+                               "GarnetNetwork router evaluation", false,
+                               Event::Default_Pri + 1),
+      m_stop_router_workers(false)
 {
     m_num_rows = p.num_rows;
     m_ni_flit_size = p.ni_flit_size;
@@ -107,6 +113,102 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     inform("Garnet version %s\n", garnetVersion);
 }
 
+GarnetNetwork::~GarnetNetwork()
+{
+    stopRouterWorkers();
+}
+
+DrainState
+GarnetNetwork::drain()
+{
+    // The routers woken up this cycle are evaluated first, see
+    // evaluateRouters().
+    if (m_evaluate_routers_event.scheduled())
+        return DrainState::Draining;
+    stopRouterWorkers();
+    return DrainState::Drained;
+}
+
+void
+GarnetNetwork::stopRouterWorkers()
+{
+    if (m_router_workers.empty())
+        return;
+
+    m_stop_router_workers = true;
+    m_router_barrier->wait();
+    for (auto &worker : m_router_workers)
+        worker.join();
+    m_router_workers.clear();
+    m_router_barrier.reset();
+    m_stop_router_workers = false;
+}
+
+void
+GarnetNetwork::scheduleRouterEvaluation(Router *router)
+{
+    m_ready_routers.push_back(router);
+    // The routers are woken up at the default priority, so this runs
+    // after all of this cycle's router wakeups.
+    if (!m_evaluate_routers_event.scheduled())
+        schedule(m_evaluate_routers_event, curTick());
+}
+
+void
+GarnetNetwork::evaluateReadyRouters()
+{
+    for (size_t i = m_next_ready_router++; i < m_ready_routers.size();
+         i = m_next_ready_router++) {
+        m_ready_routers[i]->evaluateDeferred();
+    }
+}
+
+void
+GarnetNetwork::routerThread()
+{
+    curEventQueue(eventQueue());
+    while (true) {
+        m_router_barrier->wait();
+        if (m_stop_router_workers)
+            break;
+        evaluateReadyRouters();
+        m_router_barrier->wait();
+    }
+}
+
+void
+GarnetNetwork::evaluateRouters()
+{
+    // Routers exchange flits and credits only through links, which move
+    // them a cycle later at the earliest, so the routers of a cycle can be
+    // evaluated in any order. Only their wakeups are ordered.
+    std::sort(m_ready_routers.begin(), m_ready_routers.end(),
+              [](Router *a, Router *b) { return a->get_id() < b->get_id(); });
+
+    m_next_ready_router = 0;
+    if (m_router_threads > 1 && m_ready_routers.size() > 1) {
+        if (m_router_workers.empty()) {
+            m_router_barrier = std::make_unique<Barrier>(m_router_threads);
+            for (int i = 1; i < m_router_threads; i++)
+                m_router_workers.emplace_back([this]{ routerThread(); });
+        }
+        m_router_barrier->wait();
+        evaluateReadyRouters();
+        m_router_barrier->wait();
+    } else {
+        evaluateReadyRouters();
+    }
+
+    for (auto router : m_ready_routers)
+        router->commitWakeups();
+    m_ready_routers.clear();
+
+    if (drainState() == DrainState::Draining) {
+        stopRouterWorkers();
+        signalDrainDone();
+    }
+}
+
 void
 GarnetNetwork::init()
 {
@@ -603,7 +705,7 @@ GarnetNetwork::print(std::ostream& out) const
 }
 
 void
-GarnetNetwork::update_traffic_distribution(RouteInfo route)
+GarnetNetwork::update_traffic_distribution(const RouteInfo &route)
 {
     int src_node = route.src_router;
     int dest_node = route.dest_router;
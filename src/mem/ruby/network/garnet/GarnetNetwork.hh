@@ -32,9 +32,13 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <vector>
 
+#include "base/barrier.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/network/fault_model/FaultModel.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
@@ -63,10 +67,12 @@ class GarnetNetwork : public Network
   public:
     typedef GarnetNetworkParams Params;
     GarnetNetwork(const Params &p);
-    ~GarnetNetwork() = default;
+    ~GarnetNetwork();
 
     void init();
 
+    DrainState drain() override;
+
     const char *garnetVersion = "3.0";
 
     // Configuration (set externally)
@@ -82,6 +88,23 @@ class GarnetNetwork : public Network
     int getRoutingAlgorithm() const { return m_routing_algorithm; }
 
     bool isFaultModelEnabled() const { return m_enable_fault_model; }
+
+    // Number of host threads evaluating the routers, 0 if each router is
+    // evaluated by its own wakeup
+    uint32_t routerThreads() const { return m_router_threads; }
+
+    /**
+     * Evaluate a router woken up this cycle, after every other router
+     * woken up this cycle, with the routers split between the router
+     * threads. The wakeups the routers request are scheduled once all of
+     * them are evaluated, in router order, so the simulation does not
+     * depend on the number of threads. It is not the same as with no
+     * router threads though, as the routers are evaluated after all of
+     * the cycle's default priority events rather than on their own
+     * wakeup, and each router picks its random routes from its own
+     * sequence rather than from the shared one.
+     */
+    void scheduleRouterEvaluation(Router *router);
     FaultModel* fault_model;
 
 
@@ -154,7 +177,7 @@ class GarnetNetwork : public Network
         m_total_hops += hops;
     }
 
-    void update_traffic_distribution(RouteInfo route);
+    void update_traffic_distribution(const RouteInfo &route);
     int getNextPacketID() { return m_next_packet_id++; }
 
   protected:
@@ -167,6 +190,7 @@ class GarnetNetwork : public Network
     uint32_t m_buffers_per_data_vc;
     int m_routing_algorithm;
     bool m_enable_fault_model;
+    uint32_t m_router_threads;
 
     // Statistical variables
     statistics::Vector m_packets_received;
@@ -214,6 +238,24 @@ class GarnetNetwork : public Network
     std::vector<CreditLink *> m_creditlinks; // All credit links in the network
     std::vector<NetworkInterface *> m_nis;   // All NI's in Network
     int m_next_packet_id; // static vairable for packet id allocation
+
+    void evaluateRouters();
+    void evaluateReadyRouters();
+    void routerThread();
+    void stopRouterWorkers();
+
+    // Routers to evaluate this cycle
+    std::vector<Router *> m_ready_routers;
+    std::atomic<size_t> m_next_ready_router;
+    EventFunctionWrapper m_evaluate_routers_event;
+
+    // The threads helping the event queue's thread evaluate the routers,
+    // started on the first evaluation. They are stopped when draining,
+    // so that they are not running across a checkpoint or a fork, and
+    // started again by the next evaluation after the drain.
+    std::vector<std::thread> m_router_workers;
+    std::unique_ptr<Barrier> m_router_barrier;
+    bool m_stop_router_workers;
 };
 
 inline std::ostream&
@@ -51,6 +51,14 @@ class GarnetNetwork(RubyNetwork):
     garnet_deadlock_threshold = Param.UInt32(
         50000, "network-level deadlock threshold"
     )
+    router_threads = Param.UInt32(
+        0,
+        "number of host threads evaluating the routers each cycle, 0 to "
+        "evaluate each router on its own wakeup. The simulation is the "
+        "same for any non-zero number of threads, but differs from the one "
+        "with no threads: the routers are evaluated after the cycle's other "
+        "events, and pick their random routes from per-router sequences.",
+    )
 
 
 class GarnetNetworkInterface(ClockedObject):
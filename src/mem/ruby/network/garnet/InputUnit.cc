@@ -31,6 +31,7 @@
 
 #include "mem/ruby/network/garnet/InputUnit.hh"
 
+#include "base/bitfield.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/Router.hh"
@@ -46,7 +47,9 @@ namespace garnet
 
 InputUnit::InputUnit(int id, PortDirection direction, Router *router)
   : Consumer(router), m_router(router), m_id(id), m_direction(direction),
-    m_vc_per_vnet(m_router->get_vc_per_vnet())
+    m_vc_per_vnet(m_router->get_vc_per_vnet()),
+    m_active_vcs((m_router->get_num_vcs() + 63) / 64, 0),
+    m_num_active_vcs(0)
 {
     const int m_num_vcs = m_router->get_num_vcs();
     m_num_buffer_reads.resize(m_num_vcs/m_vc_per_vnet);
@@ -109,6 +112,7 @@ InputUnit::wakeup()
 
         // Buffer the flit
         virtualChannels[vc].insertFlit(t_flit);
+        set_vc_buffered(vc);
 
         int vnet = vc/m_vc_per_vnet;
         // number of writes same as reads
@@ -139,6 +143,19 @@ InputUnit::wakeup()
     }
 }
 
+int
+InputUnit::next_active_vc(int vc) const
+{
+    for (int word = vc / 64; word < m_active_vcs.size(); word++) {
+        uint64_t bits = m_active_vcs[word];
+        if (word == vc / 64)
+            bits &= ~mask(vc % 64);
+        if (bits)
+            return word * 64 + findLsbSet(bits);
+    }
+    return -1;
+}
+
 // Send a credit back to upstream router for this VC.
 // Called by SwitchAllocator when the flit in this VC wins the Switch.
 void
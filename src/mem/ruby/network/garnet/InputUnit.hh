@@ -116,9 +116,18 @@ class InputUnit : public Consumer
     inline flit*
     getTopFlit(int vc)
     {
-        return virtualChannels[vc].getTopFlit();
+        flit *t_flit = virtualChannels[vc].getTopFlit();
+        if (virtualChannels[vc].isEmpty())
+            set_vc_empty(vc);
+        return t_flit;
     }
 
+    // Whether any VC holds flits
+    inline bool has_active_vcs() const { return m_num_active_vcs > 0; }
+
+    // The first VC from vc onwards that holds flits, -1 if none does
+    int next_active_vc(int vc) const;
+
     inline bool
     need_stage(int vc, flit_stage stage, Tick time)
     {
@@ -158,6 +167,23 @@ class InputUnit : public Consumer
     void resetStats();
 
   private:
+    inline void
+    set_vc_buffered(int vc)
+    {
+        uint64_t bit = 1ULL << (vc % 64);
+        if (!(m_active_vcs[vc / 64] & bit)) {
+            m_active_vcs[vc / 64] |= bit;
+            m_num_active_vcs++;
+        }
+    }
+
+    inline void
+    set_vc_empty(int vc)
+    {
+        m_active_vcs[vc / 64] &= ~(1ULL << (vc % 64));
+        m_num_active_vcs--;
+    }
+
     Router *m_router;
     int m_id;
     PortDirection m_direction;
@@ -169,6 +195,11 @@ class InputUnit : public Consumer
     // Input Virtual channels
     std::vector<VirtualChannel> virtualChannels;
 
+    // One bit per VC, set while the VC holds flits, so the allocator
+    // only visits the VCs that have something to send
+    std::vector<uint64_t> m_active_vcs;
+    int m_num_active_vcs;
+
     // Statistical variables
     std::vector<double> m_num_buffer_writes;
     std::vector<double> m_num_buffer_reads;
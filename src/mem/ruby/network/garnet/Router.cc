@@ -70,6 +70,17 @@ Router::init()
 
 void
 Router::wakeup()
+{
+    // With router threads, the network evaluates every router woken up
+    // this cycle together once they have all been woken up.
+    if (m_network_ptr->routerThreads() > 0)
+        m_network_ptr->scheduleRouterEvaluation(this);
+    else
+        evaluate();
+}
+
+void
+Router::evaluate()
 {
     DPRINTF(RubyNetwork, "Router %d woke up\n", m_id);
     assert(clockEdge() == curTick());
@@ -96,6 +107,21 @@ Router::wakeup()
     crossbarSwitch.wakeup();
 }
 
+void
+Router::evaluateDeferred()
+{
+    m_deferred_wakeups.clear();
+    Consumer::deferWakeups(&m_deferred_wakeups);
+    evaluate();
+    Consumer::deferWakeups(nullptr);
+}
+
+void
+Router::commitWakeups()
+{
+    Consumer::commitWakeups(m_deferred_wakeups);
+}
+
 void
 Router::addInPort(PortDirection inport_dirn,
                   NetworkLink *in_link, CreditLink *credit_link)
@@ -159,7 +185,8 @@ Router::getInportDirection(int inport)
 }
 
 int
-Router::route_compute(RouteInfo route, int inport, PortDirection inport_dirn)
+Router::route_compute(const RouteInfo &route, int inport,
+                      PortDirection inport_dirn)
 {
     return routingUnit.outportCompute(route, inport, inport_dirn);
 }
@@ -74,6 +74,16 @@ class Router : public BasicRouter, public Consumer
     void wakeup();
     void print(std::ostream& out) const {};
 
+    /** Evaluate the router's pipeline stages for the current cycle. */
+    void evaluate();
+
+    /**
+     * Evaluate the router, possibly off the event queue's thread, with the
+     * wakeups it requests deferred until commitWakeups().
+     */
+    void evaluateDeferred();
+    void commitWakeups();
+
     void init();
     void addInPort(PortDirection inport_dirn, NetworkLink *link,
                    CreditLink *credit_link);
@@ -116,7 +126,8 @@ class Router : public BasicRouter, public Consumer
     PortDirection getOutportDirection(int outport);
     PortDirection getInportDirection(int inport);
 
-    int route_compute(RouteInfo route, int inport, PortDirection direction);
+    int route_compute(const RouteInfo &route, int inport,
+                      PortDirection direction);
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
 
@@ -155,6 +166,9 @@ class Router : public BasicRouter, public Consumer
     std::vector<std::shared_ptr<InputUnit>> m_input_unit;
     std::vector<std::shared_ptr<OutputUnit>> m_output_unit;
 
+    // Wakeups requested by the last evaluateDeferred()
+    std::vector<Consumer::DeferredWakeup> m_deferred_wakeups;
+
     // Statistical variables required for power computations
     statistics::Scalar m_buffer_reads;
     statistics::Scalar m_buffer_writes;
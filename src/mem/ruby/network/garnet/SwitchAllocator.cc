@@ -113,11 +113,17 @@ SwitchAllocator::arbitrate_inports()
     // Select a VC from each input in a round robin manner
     // Independent arbiter at each input port
     for (int inport = 0; inport < m_num_inports; inport++) {
-        int invc = m_round_robin_invc[inport];
+        auto input_unit = m_router->getInputUnit(inport);
+        if (!input_unit->has_active_vcs())
+            continue;
 
-        for (int invc_iter = 0; invc_iter < m_num_vcs; invc_iter++) {
-            auto input_unit = m_router->getInputUnit(inport);
+        // Only visit the VCs holding flits, in round robin order
+        int invc = input_unit->next_active_vc(m_round_robin_invc[inport]);
+        if (invc == -1)
+            invc = input_unit->next_active_vc(0);
+        const int first_invc = invc;
 
+        while (invc != -1) {
             if (input_unit->need_stage(invc, SA_, curTick())) {
                 // This flit is in SA stage
 
@@ -138,9 +144,11 @@ SwitchAllocator::arbitrate_inports()
                 }
             }
 
-            invc++;
-            if (invc >= m_num_vcs)
-                invc = 0;
+            invc = input_unit->next_active_vc(invc + 1);
+            if (invc == -1)
+                invc = input_unit->next_active_vc(0);
+            if (invc == first_invc)
+                break;
         }
     }
 }
@@ -363,8 +371,10 @@ SwitchAllocator::check_for_wakeup()
     }
 
     for (int i = 0; i < m_num_inports; i++) {
-        for (int j = 0; j < m_num_vcs; j++) {
-            if (m_router->getInputUnit(i)->need_stage(j, SA_, nextCycle)) {
+        auto input_unit = m_router->getInputUnit(i);
+        for (int j = input_unit->next_active_vc(0); j != -1;
+             j = input_unit->next_active_vc(j + 1)) {
+            if (input_unit->need_stage(j, SA_, nextCycle)) {
                 m_router->schedule_wakeup(Cycles(1));
                 return;
             }
@@ -30,6 +30,8 @@
 
 #include "mem/ruby/network/garnet/flit.hh"
 
+#include <utility>
+
 #include "base/intmath.hh"
 #include "debug/RubyNetwork.hh"
 
@@ -43,11 +45,13 @@ namespace garnet
 {
 
 // Constructor for the flit
-flit::flit(int packet_id, int id, int  vc, int vnet, RouteInfo route, int size,
-    MsgPtr msg_ptr, int MsgSize, uint32_t bWidth, Tick curTime)
+flit::flit(int packet_id, int id, int  vc, int vnet, const RouteInfo &route,
+    int size, MsgPtr msg_ptr, int MsgSize, uint32_t bWidth, Tick curTime)
 {
     m_size = size;
-    m_msg_ptr = msg_ptr;
+    // The message is shared by all flits of a packet, take over the
+    // reference rather than bumping the count once more
+    m_msg_ptr = std::move(msg_ptr);
     m_enqueue_time = curTime;
     m_dequeue_time = curTime;
     m_time = curTime;
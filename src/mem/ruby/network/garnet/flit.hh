@@ -32,7 +32,9 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_FLIT_HH__
 
 #include <cassert>
+#include <cstddef>
 #include <iostream>
+#include <new>
 
 #include "base/types.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
@@ -47,15 +49,73 @@ namespace ruby
 namespace garnet
 {
 
+/**
+ * Intrusive free list recycling the storage of objects of a given size.
+ * Flits and credits are created and destroyed for every packet crossing
+ * the network, so their storage is kept on a free list rather than
+ * returned to the heap. The list never shrinks, it holds as many objects
+ * as were live at the same time.
+ */
+template <std::size_t Size>
+class FlitFreeList
+{
+  public:
+    static void *
+    allocate()
+    {
+        if (!head)
+            return ::operator new(Size);
+        Node *node = head;
+        head = node->next;
+        return node;
+    }
+
+    static void
+    release(void *p)
+    {
+        Node *node = static_cast<Node *>(p);
+        node->next = head;
+        head = node;
+    }
+
+  private:
+    struct Node
+    {
+        Node *next;
+    };
+
+    static_assert(Size >= sizeof(Node));
+
+    static inline Node *head = nullptr;
+};
+
 class flit
 {
   public:
     flit() {}
-    flit(int packet_id, int id, int vc, int vnet, RouteInfo route, int size,
-         MsgPtr msg_ptr, int MsgSize, uint32_t bWidth, Tick curTime);
+    flit(int packet_id, int id, int vc, int vnet, const RouteInfo &route,
+         int size, MsgPtr msg_ptr, int MsgSize, uint32_t bWidth,
+         Tick curTime);
 
     virtual ~flit(){};
 
+    static void *
+    operator new(std::size_t size)
+    {
+        if (size != sizeof(flit))
+            return ::operator new(size);
+        return FlitFreeList<sizeof(flit)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        if (size != sizeof(flit))
+            ::operator delete(p);
+        else
+            FlitFreeList<sizeof(flit)>::release(p);
+    }
+
     int get_outport() {return m_outport; }
     int get_size() { return m_size; }
     Tick get_enqueue_time() { return m_enqueue_time; }
@@ -65,7 +125,7 @@ class flit
     Tick get_time() { return m_time; }
     int get_vnet() { return m_vnet; }
     int get_vc() { return m_vc; }
-    RouteInfo get_route() { return m_route; }
+    const RouteInfo &get_route() const { return m_route; }
     MsgPtr& get_msg_ptr() { return m_msg_ptr; }
     flit_type get_type() { return m_type; }
     std::pair<flit_stage, Tick> get_stage() { return m_stage; }
@@ -74,7 +134,7 @@ class flit
     void set_outport(int port) { m_outport = port; }
     void set_time(Tick time) { m_time = time; }
     void set_vc(int vc) { m_vc = vc; }
-    void set_route(RouteInfo route) { m_route = route; }
+    void set_route(const RouteInfo &route) { m_route = route; }
     void set_src_delay(Tick delay) { src_delay = delay; }
     void set_dequeue_time(Tick time) { m_dequeue_time = time; }
     void set_enqueue_time(Tick time) { m_enqueue_time = time; }
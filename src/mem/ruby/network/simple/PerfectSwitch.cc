@@ -42,8 +42,10 @@
 
 #include <algorithm>
 
+#include "base/bitfield.hh"
 #include "base/cast.hh"
 #include "base/cprintf.hh"
+#include "base/intmath.hh"
 #include "base/random.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
@@ -99,6 +101,8 @@ PerfectSwitch::updatePriorityGroups(int vnet, MessageBuffer* in_buf)
     while (m_in_prio.size() <= vnet) {
         m_in_prio.emplace_back();
         m_in_prio_groups.emplace_back();
+        m_in_prio_group_start.emplace_back();
+        m_in_occupancy.emplace_back();
     }
 
     m_in_prio[vnet].push_back(in_buf);
@@ -109,13 +113,36 @@ PerfectSwitch::updatePriorityGroups(int vnet, MessageBuffer* in_buf)
 
     // reset groups
     m_in_prio_groups[vnet].clear();
+    m_in_prio_group_start[vnet].clear();
     int cur_prio = m_in_prio[vnet].front()->routingPriority();
     m_in_prio_groups[vnet].emplace_back();
-    for (auto buf : m_in_prio[vnet]) {
-        if (buf->routingPriority() != cur_prio)
+    m_in_prio_group_start[vnet].push_back(0);
+    for (unsigned i = 0; i < m_in_prio[vnet].size(); ++i) {
+        MessageBuffer *buf = m_in_prio[vnet][i];
+        if (buf->routingPriority() != cur_prio) {
             m_in_prio_groups[vnet].emplace_back();
+            m_in_prio_group_start[vnet].push_back(i);
+        }
         m_in_prio_groups[vnet].back().push_back(buf);
     }
+
+    // the positions changed, hand out the occupancy bits again
+    m_in_occupancy[vnet].assign(divCeil(m_in_prio[vnet].size(), 64), 0);
+    for (unsigned i = 0; i < m_in_prio[vnet].size(); ++i)
+        m_in_prio[vnet][i]->trackOccupancy(&m_in_occupancy[vnet], i);
+}
+
+unsigned
+PerfectSwitch::nextOccupied(int vnet, unsigned from, unsigned to) const
+{
+    const std::vector<uint64_t> &mask = m_in_occupancy[vnet];
+    while (from < to) {
+        uint64_t word = mask[from / 64] >> (from % 64);
+        if (word)
+            return std::min(to, from + ctz64(word));
+        from = (from / 64 + 1) * 64;
+    }
+    return to;
 }
 
 void
@@ -155,29 +182,36 @@ PerfectSwitch::operateVnet(int vnet)
     if (m_pending_message_count[vnet] == 0)
         return;
 
-    for (auto &in : m_in_prio_groups[vnet]) {
+    // only the non-empty ports are visited, the others cannot have a
+    // message ready
+    const std::vector<MessageBuffer*> &in_prio = m_in_prio[vnet];
+    for (int g = 0; g < m_in_prio_groups[vnet].size(); ++g) {
+        unsigned begin = m_in_prio_group_start[vnet][g];
+        unsigned end = begin + m_in_prio_groups[vnet][g].size();
+
         // first check the port with the oldest message
-        unsigned start_in_port = 0;
+        unsigned start_in_port = begin;
         Tick lowest_tick = MaxTick;
-        for (int i = 0; i < in.size(); ++i) {
-            MessageBuffer *buffer = in[i];
-            if (buffer) {
-                Tick ready_time = buffer->readyTime();
-                if (ready_time < lowest_tick){
-                    lowest_tick = ready_time;
-                    start_in_port = i;
-                }
+        for (unsigned i = nextOccupied(vnet, begin, end); i < end;
+             i = nextOccupied(vnet, i + 1, end)) {
+            Tick ready_time = in_prio[i]->readyTime();
+            if (ready_time < lowest_tick){
+                lowest_tick = ready_time;
+                start_in_port = i;
             }
         }
         DPRINTF(RubyNetwork, "vnet %d: %d pending msgs. "
                             "Checking port %d first\n",
-                vnet, m_pending_message_count[vnet], start_in_port);
+                vnet, m_pending_message_count[vnet], start_in_port - begin);
         // check all ports starting with the one with the oldest message
-        for (int i = 0; i < in.size(); ++i) {
-            int in_port = (i + start_in_port) % in.size();
-            MessageBuffer *buffer = in[in_port];
-            if (buffer)
-                operateMessageBuffer(buffer, vnet);
+        for (unsigned i = nextOccupied(vnet, start_in_port, end); i < end;
+             i = nextOccupied(vnet, i + 1, end)) {
+            operateMessageBuffer(in_prio[i], vnet);
+        }
+        for (unsigned i = nextOccupied(vnet, begin, start_in_port);
+             i < start_in_port;
+             i = nextOccupied(vnet, i + 1, start_in_port)) {
+            operateMessageBuffer(in_prio[i], vnet);
         }
     }
 }
@@ -252,7 +286,10 @@ PerfectSwitch::operateMessageBuffer(MessageBuffer *buffer, int vnet)
             int outgoing = output_links[i].m_link_id;
             OutputPort &out_port = m_out[outgoing];
 
-            if (i > 0) {
+            if (i + 1 == output_links.size() && i > 0) {
+                // the last link takes the unmodified message itself
+                msg_ptr = unmodified_msg_ptr;
+            } else if (i > 0) {
                 // create a private copy of the unmodified message
                 msg_ptr = unmodified_msg_ptr->clone();
             }
@@ -48,6 +48,7 @@
 #ifndef __MEM_RUBY_NETWORK_SIMPLE_PERFECTSWITCH_HH__
 #define __MEM_RUBY_NETWORK_SIMPLE_PERFECTSWITCH_HH__
 
+#include <deque>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -119,9 +120,18 @@ class PerfectSwitch : public Consumer
     std::vector<std::vector<MessageBuffer*> > m_in_prio;
     // input ports grouped by priority; indexed by vnet,prio_lv
     std::vector<std::vector<std::vector<MessageBuffer*>>> m_in_prio_groups;
+    // position of the first port of each group in m_in_prio
+    std::vector<std::vector<unsigned>> m_in_prio_group_start;
+    // bit mask of the non-empty input ports, in the order of m_in_prio and
+    // maintained by the buffers themselves; indexed by vnet first. A deque
+    // keeps the masks in place while vnets are added.
+    std::deque<std::vector<uint64_t>> m_in_occupancy;
 
     void updatePriorityGroups(int vnet, MessageBuffer* buf);
 
+    // first non-empty port of a vnet in [from, to), or to if none
+    unsigned nextOccupied(int vnet, unsigned from, unsigned to) const;
+
     uint32_t m_virtual_networks;
     int m_wakeups_wo_switch;
 
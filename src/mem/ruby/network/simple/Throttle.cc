@@ -44,6 +44,7 @@
 
 #include "base/cast.hh"
 #include "base/cprintf.hh"
+#include "base/intmath.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/network/Network.hh"
@@ -129,6 +130,10 @@ Throttle::addLinks(const std::vector<MessageBuffer*>& in_vec,
 
     m_vnets = in_vec.size();
 
+    m_in_occupancy.assign(divCeil(m_vnets, 64), 0);
+    for (int vnet = 0; vnet < m_vnets; ++vnet)
+        m_in[vnet]->trackOccupancy(&m_in_occupancy, vnet);
+
     gem5_assert(m_physical_vnets ?
            (m_link_bandwidth_multiplier.size() == m_vnets) :
            (m_link_bandwidth_multiplier.size() == 1));
@@ -239,6 +244,18 @@ Throttle::operateVnet(int vnet, int channel, int &total_bw_remaining,
     }
 }
 
+bool
+Throttle::isIdle(int vnet) const
+{
+    if (m_in_occupancy[vnet / 64] & (1ULL << (vnet % 64)))
+        return false;
+    for (int units : m_units_remaining[vnet]) {
+        if (units > 0)
+            return false;
+    }
+    return true;
+}
+
 void
 Throttle::wakeup()
 {
@@ -262,6 +279,8 @@ Throttle::wakeup()
 
     if (iteration_direction) {
         for (int vnet = 0; vnet < m_vnets; ++vnet) {
+            if (isIdle(vnet))
+                continue;
             for (int channel = 0; channel < getChannelCnt(vnet); ++channel) {
                 operateVnet(vnet, channel, bw_remaining,
                             bw_saturated, output_blocked,
@@ -270,6 +289,8 @@ Throttle::wakeup()
         }
     } else {
         for (int vnet = m_vnets-1; vnet >= 0; --vnet) {
+            if (isIdle(vnet))
+                continue;
             for (int channel = 0; channel < getChannelCnt(vnet); ++channel) {
                 operateVnet(vnet, channel, bw_remaining,
                             bw_saturated, output_blocked,
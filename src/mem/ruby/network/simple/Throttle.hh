@@ -112,12 +112,18 @@ class Throttle : public Consumer
                      bool &bw_saturated, bool &output_blocked,
                      MessageBuffer *in, MessageBuffer *out);
 
+    // true if a vnet has neither queued messages nor one in transfer
+    bool isIdle(int vnet) const;
+
     // Private copy constructor and assignment operator
     Throttle(const Throttle& obj);
     Throttle& operator=(const Throttle& obj);
 
     std::vector<MessageBuffer*> m_in;
     std::vector<MessageBuffer*> m_out;
+    // bit mask of the non-empty input buffers, indexed by vnet and
+    // maintained by the buffers themselves
+    std::vector<uint64_t> m_in_occupancy;
     unsigned int m_vnets;
     std::vector<std::vector<int>> m_units_remaining;
 
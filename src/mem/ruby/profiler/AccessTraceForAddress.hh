@@ -49,7 +49,7 @@ class AccessTraceForAddress
   public:
     AccessTraceForAddress()
         : m_loads(0), m_stores(0), m_atomics(0), m_total(0), m_user(0),
-          m_sharing(0), m_histogram_ptr(NULL)
+          m_sharing(0), m_weight(0), m_histogram_ptr(NULL)
     { }
     ~AccessTraceForAddress();
 
@@ -62,6 +62,16 @@ class AccessTraceForAddress
     Addr getAddress() const { return m_addr; }
     void addSample(int value);
 
+    /**
+     * Frequency counter of the address in a profile of bounded size,
+     * which unlike the other counters is decremented when an address
+     * has to be dropped.
+     */
+    uint64_t getWeight() const { return m_weight; }
+    void addWeight() { m_weight++; }
+    /** Decrement the frequency counter, returns true if it reaches 0. */
+    bool decayWeight() { return --m_weight == 0; }
+
     void print(std::ostream& out) const;
 
     static inline bool
@@ -79,6 +89,7 @@ class AccessTraceForAddress
     uint64_t m_total;
     uint64_t m_user;
     uint64_t m_sharing;
+    uint64_t m_weight;
     Set m_touched_by;
     Histogram* m_histogram_ptr;
 };
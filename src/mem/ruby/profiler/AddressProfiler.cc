@@ -28,6 +28,7 @@
 
 #include "mem/ruby/profiler/AddressProfiler.hh"
 
+#include <algorithm>
 #include <vector>
 
 #include "base/bitfield.hh"
@@ -131,6 +132,7 @@ printSorted(std::ostream& out, int num_of_sequencers,
 
     while (counter < max) {
         const AccessTraceForAddress* record = sorted[counter];
+        counter++;
         all_records.add(record->getTotal());
         remaining_records.add(record->getTotal());
         all_records_log.add(record->getTotal());
@@ -155,7 +157,8 @@ printSorted(std::ostream& out, int num_of_sequencers,
 }
 
 AddressProfiler::AddressProfiler(int num_of_sequencers, Profiler *profiler)
-    : m_profiler(profiler)
+    : m_profiler(profiler), m_max_entries(0), m_sample_period(1),
+      m_sample_count(0)
 {
     m_num_of_sequencers = num_of_sequencers;
     clearStats();
@@ -177,6 +180,36 @@ AddressProfiler::setAllInstructions(bool all_instructions)
     m_all_instructions = all_instructions;
 }
 
+void
+AddressProfiler::setLimits(unsigned max_entries, unsigned sample_period)
+{
+    m_max_entries = max_entries;
+    m_sample_period = std::max(sample_period, 1u);
+}
+
+AccessTraceForAddress *
+AddressProfiler::lookupTrace(Addr addr, AddressMap &record_map)
+{
+    if (m_max_entries && record_map.size() >= m_max_entries &&
+        !record_map.count(addr)) {
+        // The table is full: instead of adding the address, decrement
+        // all the counters, and make room by dropping the addresses
+        // that are not more frequent than the new one.
+        for (auto it = record_map.begin(); it != record_map.end(); ) {
+            if (it->second.decayWeight())
+                it = record_map.erase(it);
+            else
+                ++it;
+        }
+        return nullptr;
+    }
+
+    AccessTraceForAddress &access_trace =
+        lookupTraceForAddress(addr, record_map);
+    access_trace.addWeight();
+    return &access_trace;
+}
+
 void
 AddressProfiler::printStats(std::ostream& out) const
 {
@@ -186,6 +219,13 @@ AddressProfiler::printStats(std::ostream& out) const
         out << "---------------------" << std::endl;
 
         out << std::endl;
+        if (m_max_entries) {
+            out << "max_entries_per_table: " << m_max_entries
+                << std::endl;
+        }
+        if (m_sample_period > 1) {
+            out << "sample_period: " << m_sample_period << std::endl;
+        }
         out << "sharing_misses: " << m_sharing_miss_counter << std::endl;
         out << "getx_sharing_histogram: " << m_getx_sharing_histogram
             << std::endl;
@@ -301,6 +341,10 @@ AddressProfiler::addTraceSample(Addr data_addr, Addr pc_addr,
                                 RubyAccessMode access_mode, NodeID id,
                                 bool sharing_miss)
 {
+    if (m_sample_period > 1 && m_sample_count++ % m_sample_period != 0)
+        return;
+
+    AccessTraceForAddress *access_trace;
     if (m_all_instructions) {
         if (sharing_miss) {
             m_sharing_miss_counter++;
@@ -308,27 +352,31 @@ AddressProfiler::addTraceSample(Addr data_addr, Addr pc_addr,
 
         // record data address trace info
         data_addr = makeLineAddress(data_addr);
-        lookupTraceForAddress(data_addr, m_dataAccessTrace).
-            update(type, access_mode, id, sharing_miss);
+        if ((access_trace = lookupTrace(data_addr, m_dataAccessTrace)))
+            access_trace->update(type, access_mode, id, sharing_miss);
 
         // record macro data address trace info
 
         // 6 for datablock, 4 to make it 16x more coarse
         Addr macro_addr = mbits<Addr>(data_addr, 63, 10);
-        lookupTraceForAddress(macro_addr, m_macroBlockAccessTrace).
-            update(type, access_mode, id, sharing_miss);
+        if ((access_trace = lookupTrace(macro_addr, m_macroBlockAccessTrace)))
+            access_trace->update(type, access_mode, id, sharing_miss);
 
         // record program counter address trace info
-        lookupTraceForAddress(pc_addr, m_programCounterAccessTrace).
-            update(type, access_mode, id, sharing_miss);
+        if ((access_trace =
+             lookupTrace(pc_addr, m_programCounterAccessTrace))) {
+            access_trace->update(type, access_mode, id, sharing_miss);
+        }
     }
 
     if (m_all_instructions) {
         // This code is used if the address profiler is an
         // all-instructions profiler record program counter address
         // trace info
-        lookupTraceForAddress(pc_addr, m_programCounterAccessTrace).
-            update(type, access_mode, id, sharing_miss);
+        if ((access_trace =
+             lookupTrace(pc_addr, m_programCounterAccessTrace))) {
+            access_trace->update(type, access_mode, id, sharing_miss);
+        }
     }
 }
 
@@ -342,7 +390,8 @@ AddressProfiler::profileRetry(Addr data_addr, AccessType type, int count)
         m_retryProfileHistoWrite.add(count);
     }
     if (count > 1) {
-        lookupTraceForAddress(data_addr, m_retryProfileMap).addSample(count);
+        if (auto *access_trace = lookupTrace(data_addr, m_retryProfileMap))
+            access_trace->addSample(count);
     }
 }
 
@@ -73,6 +73,17 @@ class AddressProfiler
     //added by SS
     void setHotLines(bool hot_lines);
     void setAllInstructions(bool all_instructions);
+
+    /**
+     * Bound the memory used by the profile.
+     *
+     * @param max_entries Maximum number of addresses per table, 0 for
+     *        no limit. Full tables keep the most frequent addresses
+     *        (Misra-Gries), any address seen in more than 1/max_entries
+     *        of the samples is guaranteed to be kept.
+     * @param sample_period Record one every sample_period misses.
+     */
+    void setLimits(unsigned max_entries, unsigned sample_period);
     void regStats(const std::string &name) {}
     void collateStats() {}
 
@@ -81,6 +92,12 @@ class AddressProfiler
     AddressProfiler(const AddressProfiler& obj);
     AddressProfiler& operator=(const AddressProfiler& obj);
 
+    /**
+     * Find or create the record of an address, returns nullptr if the
+     * table is full and the sample has to be dropped.
+     */
+    AccessTraceForAddress *lookupTrace(Addr addr, AddressMap &record_map);
+
     int64_t m_sharing_miss_counter;
 
     AddressMap m_dataAccessTrace;
@@ -100,6 +117,10 @@ class AddressProfiler
     bool m_all_instructions;
 
     int m_num_of_sequencers;
+
+    size_t m_max_entries;
+    unsigned m_sample_period;
+    uint64_t m_sample_count;
 };
 
 AccessTraceForAddress& lookupTraceForAddress(Addr addr,
@@ -44,6 +44,8 @@
 #include <iostream>
 #include <memory>
 #include <stack>
+#include <utility>
+#include <vector>
 
 #include "mem/packet.hh"
 #include "mem/ruby/common/NetDest.hh"
@@ -59,6 +61,78 @@ namespace ruby
 class Message;
 typedef std::shared_ptr<Message> MsgPtr;
 
+/**
+ * An allocator recycling the storage of the messages. The messages
+ * are allocated together with their reference counts by
+ * std::allocate_shared, which rebinds the allocator to the type of
+ * the combined object, so every message type gets its own pool of
+ * equally sized blocks. The pools are per host thread, and only the
+ * thread that freed a block reuses it.
+ */
+template <class T>
+class MessageAllocator
+{
+  public:
+    typedef T value_type;
+
+    MessageAllocator() = default;
+
+    template <class U>
+    MessageAllocator(const MessageAllocator<U> &other)
+    {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        std::vector<void *> &pool = freeBlocks();
+        if (n == 1 && !pool.empty()) {
+            void *block = pool.back();
+            pool.pop_back();
+            return static_cast<T *>(block);
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        std::vector<void *> &pool = freeBlocks();
+        if (n == 1 && pool.size() < MaxFreeBlocks)
+            pool.push_back(p);
+        else
+            ::operator delete(p);
+    }
+
+    template <class U>
+    bool operator==(const MessageAllocator<U> &other) const { return true; }
+    template <class U>
+    bool operator!=(const MessageAllocator<U> &other) const { return false; }
+
+  private:
+    /** The most free blocks kept by each pool. */
+    static constexpr std::size_t MaxFreeBlocks = 4096;
+
+    static std::vector<void *> &
+    freeBlocks()
+    {
+        // never destroyed, as messages may still be freed by the
+        // destructors of other static objects
+        thread_local std::vector<void *> *pool = new std::vector<void *>;
+        return *pool;
+    }
+};
+
+/**
+ * Create a message from the pool of its type.
+ */
+template <class T, class... Args>
+std::shared_ptr<T>
+makeMessage(Args&&... args)
+{
+    return std::allocate_shared<T>(MessageAllocator<T>(),
+                                   std::forward<Args>(args)...);
+}
+
 class Message
 {
   public:
@@ -46,6 +46,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "base/filters/base.hh"
 #include "base/statistics.hh"
 #include "mem/cache/replacement_policies/base.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
@@ -168,6 +169,18 @@ class CacheMemory : public SimObject
     int findTagInSet(int64_t line, Addr tag) const;
     int findTagInSetIgnorePermissions(int64_t cacheSet, Addr tag) const;
 
+    // The entry in the given way of the given set
+    AbstractCacheEntry *&
+    entryAt(int64_t cacheSet, int way)
+    {
+        return m_cache[cacheSet * m_cache_assoc + way];
+    }
+    AbstractCacheEntry *
+    entryAt(int64_t cacheSet, int way) const
+    {
+        return m_cache[cacheSet * m_cache_assoc + way];
+    }
+
     // Private copy constructor and assignment operator
     CacheMemory(const CacheMemory& obj);
     CacheMemory& operator=(const CacheMemory& obj);
@@ -176,10 +189,16 @@ class CacheMemory : public SimObject
     // Data Members (m_prefix)
     bool m_is_instruction_only_cache;
 
-    // The first index is the # of cache lines.
-    // The second index is the the amount associativity.
-    std::unordered_map<Addr, int> m_tag_index;
-    std::vector<std::vector<AbstractCacheEntry*> > m_cache;
+    // The last tag looked up, and its way or -1
+    mutable Addr m_last_tag;
+    mutable int m_last_way;
+    // The entries of all the sets in one array, set by set (see entryAt)
+    std::vector<AbstractCacheEntry*> m_cache;
+    // The line address held by each way of m_cache, or MaxAddr if empty
+    std::vector<Addr> m_tags;
+    // Optional filter of the addresses in m_tags, used to find definite
+    // misses without searching the set
+    bloom_filter::Base *m_miss_filter;
 
     /** We use the replacement policies from the Classic memory system. */
     replacement_policy::Base *m_replacementPolicy_ptr;
@@ -202,6 +221,10 @@ class CacheMemory : public SimObject
      * so we cannot store the ReplacementData inside the cache entry.
      * Instantiate ReplacementData for multiple times will break replacement
      * policy like TreePLRU.
+     *
+     * The ReplacementData of a set is only instantiated, for all its ways
+     * at once, when the first block is allocated in it, so large caches
+     * don't pay for sets that are never touched.
      */
     std::vector<std::vector<ReplData> > replacement_data;
 
@@ -239,6 +262,10 @@ class CacheMemory : public SimObject
           statistics::Formula m_prefetch_accesses;
 
           statistics::Vector m_accessModeType;
+
+          mutable statistics::Scalar m_miss_filter_lookups;
+          mutable statistics::Scalar m_miss_filter_misses;
+          statistics::Formula m_miss_filter_rate;
       } cacheMemoryStats;
 
     public:
@@ -56,7 +56,8 @@ namespace ruby
 {
 
 DirectoryMemory::DirectoryMemory(const Params &p)
-    : SimObject(p), addrRanges(p.addr_ranges.begin(), p.addr_ranges.end())
+    : SimObject(p), pageMem(this, "pages"),
+      addrRanges(p.addr_ranges.begin(), p.addr_ranges.end())
 {
     m_size_bytes = 0;
     for (const auto &r: addrRanges) {
@@ -70,20 +71,20 @@ void
 DirectoryMemory::init()
 {
     m_num_entries = m_size_bytes / RubySystem::getBlockSizeBytes();
-    m_entries = new AbstractCacheEntry*[m_num_entries];
-    for (int i = 0; i < m_num_entries; i++)
-        m_entries[i] = NULL;
+    m_pages.resize(divCeil(m_num_entries, entriesPerPage));
+    pageMem.allocate(m_pages.size() * sizeof(m_pages[0]));
 }
 
 DirectoryMemory::~DirectoryMemory()
 {
     // free up all the directory entries
-    for (uint64_t i = 0; i < m_num_entries; i++) {
-        if (m_entries[i] != NULL) {
-            delete m_entries[i];
+    for (const auto &page : m_pages) {
+        if (!page)
+            continue;
+        for (auto entry : page->entries) {
+            delete entry;
         }
     }
-    delete [] m_entries;
 }
 
 bool
@@ -119,7 +120,8 @@ DirectoryMemory::lookup(Addr address)
 
     uint64_t idx = mapAddressToLocalIdx(address);
     assert(idx < m_num_entries);
-    return m_entries[idx];
+    const auto &page = m_pages[idx >> entryPageBits];
+    return page ? page->entries[idx & (entriesPerPage - 1)] : nullptr;
 }
 
 AbstractCacheEntry*
@@ -131,9 +133,16 @@ DirectoryMemory::allocate(Addr address, AbstractCacheEntry *entry)
 
     idx = mapAddressToLocalIdx(address);
     assert(idx < m_num_entries);
-    assert(m_entries[idx] == NULL);
+    auto &page = m_pages[idx >> entryPageBits];
+    if (!page) {
+        page = std::make_unique<EntryPage>();
+        pageMem.allocate(sizeof(EntryPage));
+    }
+    AbstractCacheEntry *&slot = page->entries[idx & (entriesPerPage - 1)];
+    assert(slot == NULL);
     entry->changePermission(AccessPermission_Read_Only);
-    m_entries[idx] = entry;
+    slot = entry;
+    page->numAllocated++;
 
     return entry;
 }
@@ -147,9 +156,17 @@ DirectoryMemory::deallocate(Addr address)
 
     idx = mapAddressToLocalIdx(address);
     assert(idx < m_num_entries);
-    assert(m_entries[idx] != NULL);
-    delete m_entries[idx];
-    m_entries[idx] = NULL;
+    auto &page = m_pages[idx >> entryPageBits];
+    assert(page);
+    AbstractCacheEntry *&slot = page->entries[idx & (entriesPerPage - 1)];
+    assert(slot != NULL);
+    delete slot;
+    slot = NULL;
+    // release the page with its last entry
+    if (--page->numAllocated == 0) {
+        page.reset();
+        pageMem.release(sizeof(EntryPage));
+    }
 }
 
 void
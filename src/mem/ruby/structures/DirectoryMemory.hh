@@ -42,13 +42,16 @@
 #define __MEM_RUBY_STRUCTURES_DIRECTORYMEMORY_HH__
 
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/DirectoryRequestType.hh"
 #include "mem/ruby/slicc_interface/AbstractCacheEntry.hh"
 #include "params/RubyDirectoryMemory.hh"
+#include "sim/host_mem.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -97,8 +100,25 @@ class DirectoryMemory : public SimObject
     DirectoryMemory& operator=(const DirectoryMemory& obj);
 
   private:
+    /**
+     * The entries are kept in pages of contiguous blocks, which are only
+     * allocated while one of their entries is, so the host memory used
+     * follows the blocks that are touched rather than the directory size.
+     */
+    static constexpr unsigned entryPageBits = 12;
+    static constexpr uint64_t entriesPerPage = 1ULL << entryPageBits;
+
+    struct EntryPage
+    {
+        AbstractCacheEntry *entries[entriesPerPage] = {};
+        /** Number of allocated entries in the page. */
+        uint64_t numAllocated = 0;
+    };
+
     const std::string m_name;
-    AbstractCacheEntry **m_entries;
+    std::vector<std::unique_ptr<EntryPage>> m_pages;
+    /** The host memory used by the pages, without their entries. */
+    host_mem::Counter pageMem;
     // int m_size;  // # of memory module blocks this directory is
                     // responsible for
     uint64_t m_size_bytes;
@@ -33,6 +33,7 @@ from m5.SimObject import SimObject
 class RubyCache(SimObject):
     type = "RubyCache"
     cxx_class = "gem5::ruby::CacheMemory"
+    thread_safe_init = True
     cxx_header = "mem/ruby/structures/CacheMemory.hh"
 
     size = Param.MemorySize("capacity in bytes")
@@ -50,3 +51,8 @@ class RubyCache(SimObject):
     tagAccessLatency = Param.Cycles(1, "cycles for a tag array access")
     resourceStalls = Param.Bool(False, "stall if there is a resource failure")
     ruby_system = Param.RubySystem(Parent.any, "")
+    # A counting filter (num_bits > 1) lets lookups skip the search of the
+    # lines that are definitely not in the cache
+    miss_filter = Param.BloomFilterBase(
+        NULL, "Bloom filter of the addresses of the allocated lines"
+    )
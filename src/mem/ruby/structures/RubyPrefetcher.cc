@@ -56,7 +56,9 @@ namespace ruby
 
 RubyPrefetcher::RubyPrefetcher(const Params &p)
     : SimObject(p), m_num_streams(p.num_streams),
-    m_array(p.num_streams), m_train_misses(p.train_misses),
+    m_array(p.num_streams),
+    m_stream_index(p.num_streams * p.num_startup_pfs),
+    m_train_misses(p.train_misses),
     m_num_startup_pfs(p.num_startup_pfs),
     unitFilter(p.unit_filter),
     negativeFilter(p.unit_filter),
@@ -164,6 +166,9 @@ RubyPrefetcher::issueNextPrefetch(Addr address, PrefetchEntry *stream)
     }
 
     // extend this prefetching stream by 1 (or more)
+    bool was_valid = stream->m_is_valid;
+    if (was_valid)
+        indexStream(*stream, false);
     Addr page_addr = pageAddress(stream->m_address);
     Addr line_addr = makeNextStrideAddress(stream->m_address,
                                          stream->m_stride);
@@ -183,6 +188,8 @@ RubyPrefetcher::issueNextPrefetch(Addr address, PrefetchEntry *stream)
     rubyPrefetcherStats.numPrefetchRequested++;
     stream->m_address = line_addr;
     stream->m_use_time = m_controller->curCycle();
+    if (was_valid)
+        indexStream(*stream, true);
     DPRINTF(RubyPrefetcher, "Requesting prefetch for %#x\n", line_addr);
     m_controller->enqueuePrefetch(line_addr, stream->m_type);
 }
@@ -214,6 +221,8 @@ RubyPrefetcher::initializeStream(Addr address, int stride,
 
     // initialize the stream prefetcher
     PrefetchEntry *mystream = &(m_array[index]);
+    if (mystream->m_is_valid)
+        indexStream(*mystream, false);
     mystream->m_address = makeLineAddress(address);
     mystream->m_stride = stride;
     mystream->m_use_time = m_controller->curCycle();
@@ -245,11 +254,16 @@ RubyPrefetcher::initializeStream(Addr address, int stride,
 
     // update the address to be the last address prefetched
     mystream->m_address = line_addr;
+    indexStream(*mystream, true);
 }
 
 PrefetchEntry *
 RubyPrefetcher::getPrefetchEntry(Addr address, uint32_t &index)
 {
+    // most misses are not part of any stream
+    if (!m_stream_index.count(address))
+        return NULL;
+
     // search all streams for a match
     for (int i = 0; i < m_num_streams; i++) {
         // search all the outstanding prefetches for this stream
@@ -265,6 +279,23 @@ RubyPrefetcher::getPrefetchEntry(Addr address, uint32_t &index)
     return NULL;
 }
 
+void
+RubyPrefetcher::indexStream(const PrefetchEntry &stream, bool add)
+{
+    for (int j = 0; j < m_num_startup_pfs; j++) {
+        Addr addr = makeNextStrideAddress(stream.m_address,
+                                          -(stream.m_stride * j));
+        if (add) {
+            m_stream_index[addr]++;
+        } else {
+            auto it = m_stream_index.find(addr);
+            assert(it != m_stream_index.end());
+            if (--it->second == 0)
+                m_stream_index.erase(it);
+        }
+    }
+}
+
 bool
 RubyPrefetcher::accessUnitFilter(CircularQueue<UnitFilterEntry>* const filter,
     Addr line_addr, int stride, const RubyRequestType& type)
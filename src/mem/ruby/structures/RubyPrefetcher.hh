@@ -49,6 +49,7 @@
 #include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/FlatAddrMap.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/slicc_interface/RubyRequest.hh"
@@ -177,6 +178,12 @@ class RubyPrefetcher : public SimObject
         PrefetchEntry* getPrefetchEntry(Addr address,
             uint32_t &index);
 
+        /**
+         * Add (or remove) the outstanding prefetches of a valid stream
+         * to (or from) the stream index.
+         */
+        void indexStream(const PrefetchEntry &stream, bool add);
+
         /**
          * Access a unit stride filter to determine if there is a hit, and
          * update it otherwise.
@@ -209,6 +216,13 @@ class RubyPrefetcher : public SimObject
         //! an array of the active prefetch streams
         std::vector<PrefetchEntry> m_array;
 
+        /**
+         * Number of valid streams with an outstanding prefetch for each
+         * line address, so misses outside of any stream don't need to
+         * search m_array.
+         */
+        FlatAddrMap<uint32_t> m_stream_index;
+
         //! number of misses I must see before allocating a stream
         uint32_t m_train_misses;
         //! number of initial prefetches to startup a stream
@@ -42,9 +42,9 @@
 #define __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 
 #include <iostream>
-#include <unordered_map>
 
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/FlatAddrMap.hh"
 
 namespace gem5
 {
@@ -57,8 +57,11 @@ class TBETable
 {
   public:
     TBETable(int number_of_TBEs)
-        : m_number_of_TBEs(number_of_TBEs)
+        : m_map(number_of_TBEs), m_number_of_TBEs(number_of_TBEs),
+          m_last_address(MaxAddr), m_last_entry(nullptr)
     {
+        // The number of TBEs is fixed, so allocate all of them upfront
+        m_map.preallocate(number_of_TBEs);
     }
 
     bool isPresent(Addr address) const;
@@ -82,10 +85,15 @@ class TBETable
     TBETable& operator=(const TBETable& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    FlatAddrMap<ENTRY> m_map;
 
   private:
     int m_number_of_TBEs;
+
+    // The last address looked up, and its entry or null. A controller
+    // handling an event looks the same TBE up several times.
+    Addr m_last_address;
+    ENTRY *m_last_entry;
 };
 
 template<class ENTRY>
@@ -112,7 +120,9 @@ TBETable<ENTRY>::allocate(Addr address)
 {
     assert(!isPresent(address));
     assert(m_map.size() < m_number_of_TBEs);
-    m_map[address] = ENTRY();
+    auto it = m_map.emplace(address).first;
+    if (address == m_last_address)
+        m_last_entry = &it->second;
 }
 
 template<class ENTRY>
@@ -122,6 +132,8 @@ TBETable<ENTRY>::deallocate(Addr address)
     assert(isPresent(address));
     assert(m_map.size() > 0);
     m_map.erase(address);
+    if (address == m_last_address)
+        m_last_entry = nullptr;
 }
 
 template<class ENTRY>
@@ -136,8 +148,12 @@ template<class ENTRY>
 inline ENTRY*
 TBETable<ENTRY>::lookup(Addr address)
 {
-  if (m_map.find(address) != m_map.end()) return &(m_map.find(address)->second);
-  return NULL;
+    if (address != m_last_address) {
+        auto it = m_map.find(address);
+        m_last_address = address;
+        m_last_entry = it != m_map.end() ? &it->second : nullptr;
+    }
+    return m_last_entry;
 }
 
 
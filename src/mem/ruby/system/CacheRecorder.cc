@@ -29,6 +29,18 @@
 
 #include "mem/ruby/system/CacheRecorder.hh"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/parallel.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -39,6 +51,38 @@ namespace gem5
 namespace ruby
 {
 
+namespace
+{
+
+// The uncompressed size of the chunks the trace is compressed in
+const uint64_t traceChunkBytes = 8 << 20;
+
+// Compress data into a gzip member.
+std::vector<uint8_t>
+gzipCompress(const std::vector<uint8_t> &data)
+{
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // A window of 15 bits plus 16 writes a gzip header and trailer.
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        fatal("Insufficient memory to allocate compression state\n");
+    }
+
+    std::vector<uint8_t> compressed(deflateBound(&stream, data.size()));
+    stream.next_in = const_cast<Bytef *>(data.data());
+    stream.avail_in = data.size();
+    stream.next_out = compressed.data();
+    stream.avail_out = compressed.size();
+    if (deflate(&stream, Z_FINISH) != Z_STREAM_END)
+        fatal("Compression of the cache trace failed\n");
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+} // anonymous namespace
+
 void
 TraceRecord::print(std::ostream& out) const
 {
@@ -71,6 +115,7 @@ CacheRecorder::CacheRecorder(uint8_t* uncompressed_trace,
             panic("Recorded cache block size (%d) < current block size (%d) !!",
                     m_block_size_bytes, RubySystem::getBlockSizeBytes());
         }
+        makeFetchQueues();
     }
 }
 
@@ -89,9 +134,9 @@ CacheRecorder::enqueueNextFlushRequest()
     if (m_records_flushed < m_records.size()) {
         TraceRecord* rec = m_records[m_records_flushed];
         m_records_flushed++;
-        auto req = std::make_shared<Request>(rec->m_data_address,
-                                             m_block_size_bytes, 0,
-                                             Request::funcRequestorId);
+        auto req = Request::make(rec->m_data_address,
+                                 m_block_size_bytes, 0,
+                                 Request::funcRequestorId);
         MemCmd::Command requestType = MemCmd::FlushReq;
         Packet *pkt = new Packet(req, requestType);
 
@@ -105,53 +150,130 @@ CacheRecorder::enqueueNextFlushRequest()
     }
 }
 
+TraceRecord *
+CacheRecorder::getRecord(uint64_t index) const
+{
+    return (TraceRecord *)(m_uncompressed_trace +
+                           index * (sizeof(TraceRecord) + m_block_size_bytes));
+}
+
+void
+CacheRecorder::makeFetchQueues()
+{
+    uint64_t num_records =
+        m_uncompressed_trace_size / (sizeof(TraceRecord) + m_block_size_bytes);
+    m_previous_record.resize(num_records);
+    m_record_done.assign(num_records, false);
+
+    std::unordered_map<Addr, uint64_t> last_record;
+    for (uint64_t index = 0; index < num_records; index++) {
+        TraceRecord *record = getRecord(index);
+        assert(record->m_cntrl_id < m_seq_map.size());
+        Sequencer *sequencer = m_seq_map[record->m_cntrl_id];
+        assert(sequencer != NULL);
+
+        auto queue = m_fetch_queue_index.emplace(sequencer,
+                                                 m_fetch_queues.size());
+        if (queue.second)
+            m_fetch_queues.push_back({sequencer, {}, 0});
+        m_fetch_queues[queue.first->second].records.push_back(index);
+
+        auto last = last_record.find(record->m_data_address);
+        m_previous_record[index] =
+            last == last_record.end() ? -1 : (int64_t)last->second;
+        last_record[record->m_data_address] = index;
+    }
+}
+
 void
 CacheRecorder::enqueueNextFetchRequest()
 {
-    if (m_bytes_read < m_uncompressed_trace_size) {
-        TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
-                                                                m_bytes_read);
+    for (int queue = 0; queue < m_fetch_queues.size(); queue++)
+        issueNextFetchRequest(queue);
+
+    if (m_fetch_queues.empty())
+        DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
+}
 
-        DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
+void
+CacheRecorder::issueNextFetchRequest(int queue)
+{
+    FetchQueue &fetch_queue = m_fetch_queues[queue];
+    if (fetch_queue.records.empty())
+        return;
 
-        for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
-                rec_bytes_read += RubySystem::getBlockSizeBytes()) {
-            RequestPtr req;
-            MemCmd::Command requestType;
+    uint64_t index = fetch_queue.records.front();
+    int64_t previous = m_previous_record[index];
+    if (previous >= 0 && !m_record_done[previous]) {
+        // Wait for the earlier record of the block, so every block ends up
+        // as the sequential replay of the trace would leave it.
+        m_waiting_queues[previous] = queue;
+        return;
+    }
 
-            if (traceRecord->m_type == RubyRequestType_LD) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    RubySystem::getBlockSizeBytes(), 0,
-                                    Request::funcRequestorId);
-            }   else if (traceRecord->m_type == RubyRequestType_IFETCH) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                        traceRecord->m_data_address + rec_bytes_read,
-                        RubySystem::getBlockSizeBytes(),
-                        Request::INST_FETCH, Request::funcRequestorId);
-            }   else {
-                requestType = MemCmd::WriteReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    RubySystem::getBlockSizeBytes(), 0,
-                                Request::funcRequestorId);
-            }
+    TraceRecord* traceRecord = getRecord(index);
+    DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
 
-            Packet *pkt = new Packet(req, requestType);
-            pkt->dataStatic(traceRecord->m_data + rec_bytes_read);
+    fetch_queue.outstanding =
+        m_block_size_bytes / RubySystem::getBlockSizeBytes();
+    for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
+            rec_bytes_read += RubySystem::getBlockSizeBytes()) {
+        RequestPtr req;
+        MemCmd::Command requestType;
 
-            Sequencer* m_sequencer_ptr = m_seq_map[traceRecord->m_cntrl_id];
-            assert(m_sequencer_ptr != NULL);
-            m_sequencer_ptr->makeRequest(pkt);
+        if (traceRecord->m_type == RubyRequestType_LD) {
+            requestType = MemCmd::ReadReq;
+            req = Request::make(
+                traceRecord->m_data_address + rec_bytes_read,
+                RubySystem::getBlockSizeBytes(), 0,
+                                Request::funcRequestorId);
+        }   else if (traceRecord->m_type == RubyRequestType_IFETCH) {
+            requestType = MemCmd::ReadReq;
+            req = Request::make(
+                    traceRecord->m_data_address + rec_bytes_read,
+                    RubySystem::getBlockSizeBytes(),
+                    Request::INST_FETCH, Request::funcRequestorId);
+        }   else {
+            requestType = MemCmd::WriteReq;
+            req = Request::make(
+                traceRecord->m_data_address + rec_bytes_read,
+                RubySystem::getBlockSizeBytes(), 0,
+                            Request::funcRequestorId);
         }
 
-        m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
-        m_records_read++;
-    } else {
-        DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
+        Packet *pkt = new Packet(req, requestType);
+        pkt->dataStatic(traceRecord->m_data + rec_bytes_read);
+
+        fetch_queue.sequencer->makeRequest(pkt);
+    }
+}
+
+void
+CacheRecorder::fetchRequestDone(Sequencer *sequencer)
+{
+    auto queue = m_fetch_queue_index.find(sequencer);
+    assert(queue != m_fetch_queue_index.end());
+    FetchQueue &fetch_queue = m_fetch_queues[queue->second];
+    assert(fetch_queue.outstanding > 0);
+    if (--fetch_queue.outstanding > 0)
+        return;
+
+    uint64_t index = fetch_queue.records.front();
+    fetch_queue.records.pop_front();
+    m_record_done[index] = true;
+    m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
+    m_records_read++;
+
+    auto waiting = m_waiting_queues.find(index);
+    if (waiting != m_waiting_queues.end()) {
+        int waiting_queue = waiting->second;
+        m_waiting_queues.erase(waiting);
+        issueNextFetchRequest(waiting_queue);
     }
+    issueNextFetchRequest(queue->second);
+
+    if (m_bytes_read == m_uncompressed_trace_size)
+        DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
 }
 
 void
@@ -207,6 +329,69 @@ CacheRecorder::aggregateRecords(uint8_t **buf, uint64_t total_size)
     return current_size;
 }
 
+uint64_t
+CacheRecorder::writeRecords(const std::string &filename)
+{
+    std::sort(m_records.begin(), m_records.end(), compareTraceRecords);
+
+    int fd = creat(filename.c_str(), 0664);
+    if (fd < 0) {
+        perror("creat");
+        fatal("Can't open memory trace file '%s'\n", filename);
+    }
+
+    uint64_t record_size = sizeof(TraceRecord) + m_block_size_bytes;
+    uint64_t chunk_records = std::max<uint64_t>(1,
+                                                traceChunkBytes / record_size);
+    uint64_t num_chunks = std::max<uint64_t>(1,
+        divCeil(m_records.size(), chunk_records));
+    uint64_t num_threads = std::min<uint64_t>(num_chunks, hostThreads(0));
+
+    // Compress a batch of num_threads chunks at a time, and write them in
+    // order.
+    std::vector<std::vector<uint8_t>> compressed(num_threads);
+    for (uint64_t first = 0; first < num_chunks; first += num_threads) {
+        uint64_t batch = std::min(num_threads, num_chunks - first);
+        parallelFor(num_threads, batch, [&](size_t i) {
+            uint64_t begin = (first + i) * chunk_records;
+            uint64_t end = std::min<uint64_t>(begin + chunk_records,
+                                              m_records.size());
+            std::vector<uint8_t> chunk;
+            if (end > begin)
+                chunk.resize((end - begin) * record_size);
+            for (uint64_t r = begin; r < end; r++) {
+                memcpy(&chunk[(r - begin) * record_size], m_records[r],
+                       record_size);
+                free(m_records[r]);
+                m_records[r] = NULL;
+            }
+            compressed[i] = gzipCompress(chunk);
+        });
+
+        for (uint64_t i = 0; i < batch; i++) {
+            const uint8_t *data = compressed[i].data();
+            size_t left = compressed[i].size();
+            while (left > 0) {
+                ssize_t written = write(fd, data, left);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    fatal("Write failed on memory trace file '%s'\n",
+                          filename);
+                data += written;
+                left -= written;
+            }
+        }
+    }
+
+    if (close(fd))
+        fatal("Close failed on memory trace file '%s'\n", filename);
+
+    uint64_t size = m_records.size() * record_size;
+    m_records.clear();
+    return size;
+}
+
 uint64_t
 CacheRecorder::getNumRecords() const
 {
@@ -35,6 +35,9 @@
 #ifndef __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 #define __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 
+#include <deque>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/types.hh"
@@ -85,6 +88,17 @@ class CacheRecorder
 
     uint64_t aggregateRecords(uint8_t **data, uint64_t size);
 
+    /*!
+     * Function for writing the records, in the same order as
+     * aggregateRecords(), to a gzip'd trace file. The records are
+     * compressed in chunks, in parallel, and each chunk is written as a
+     * gzip member, so the records are never all copied into one buffer
+     * and the file reads as a single gzip stream.
+     *
+     * @return The uncompressed size of the trace.
+     */
+    uint64_t writeRecords(const std::string &filename);
+
     uint64_t getNumRecords() const;
 
     /*!
@@ -100,12 +114,20 @@ class CacheRecorder
     /*!
      * Function for fetching warming up the memory and the caches. It goes
      * through the recorded contents of the caches, as available in the
-     * checkpoint and issues fetch requests. Except for the first one, a
-     * fetch request is issued only after the previous one has completed.
-     * It should be possible to use this with any protocol.
+     * checkpoint and issues fetch requests. Each sequencer replays its
+     * records in order, one at a time, and the sequencers replay theirs
+     * concurrently, except that a record is only issued once the earlier
+     * records of the same block have completed. It should be possible to
+     * use this with any protocol.
      */
     void enqueueNextFetchRequest();
 
+    /*!
+     * Function called by a sequencer when one of its fetch requests has
+     * completed, to issue its next one.
+     */
+    void fetchRequestDone(Sequencer *sequencer);
+
   private:
     // Private copy constructor and assignment operator
     CacheRecorder(const CacheRecorder& obj);
@@ -115,6 +137,27 @@ class CacheRecorder
     uint8_t* m_uncompressed_trace;
     uint64_t m_uncompressed_trace_size;
     std::vector<Sequencer*> m_seq_map;
+
+    // The records to replay through each sequencer, in order, by index
+    // into the trace
+    struct FetchQueue
+    {
+        Sequencer *sequencer;
+        std::deque<uint64_t> records;
+        int outstanding;
+    };
+    std::vector<FetchQueue> m_fetch_queues;
+    std::unordered_map<Sequencer *, int> m_fetch_queue_index;
+    // The previous record of the same block of every record, or -1
+    std::vector<int64_t> m_previous_record;
+    std::vector<bool> m_record_done;
+    // The queue waiting for each record to complete, if any
+    std::unordered_map<uint64_t, int> m_waiting_queues;
+
+    void makeFetchQueues();
+    void issueNextFetchRequest(int queue);
+    TraceRecord *getRecord(uint64_t index) const;
+
     uint64_t m_bytes_read;
     uint64_t m_records_read;
     uint64_t m_records_flushed;
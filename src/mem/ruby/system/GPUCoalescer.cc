@@ -212,6 +212,7 @@ GPUCoalescer::GPUCoalescer(const Params &p)
 
     assert(m_max_outstanding_requests > 0);
     assert(m_deadlock_threshold > 0);
+    coalescedTable.reserve(m_max_outstanding_requests);
     assert(m_instCache_ptr);
     assert(m_dataCache_ptr);
 
@@ -267,6 +268,28 @@ GPUCoalescer::GPUCoalescer(const Params &p)
 
 GPUCoalescer::~GPUCoalescer()
 {
+    for (auto crequest : freeCoalescedReqs) {
+        delete crequest;
+    }
+}
+
+CoalescedRequest *
+GPUCoalescer::allocCoalescedRequest(uint64_t seq_num)
+{
+    if (freeCoalescedReqs.empty()) {
+        return new CoalescedRequest(seq_num);
+    }
+
+    CoalescedRequest *crequest = freeCoalescedReqs.back();
+    freeCoalescedReqs.pop_back();
+    crequest->reset(seq_num);
+    return crequest;
+}
+
+void
+GPUCoalescer::freeCoalescedRequest(CoalescedRequest *crequest)
+{
+    freeCoalescedReqs.push_back(crequest);
 }
 
 Port &
@@ -420,7 +443,7 @@ GPUCoalescer::writeCallback(Addr address,
                 forwardRequestTime, firstResponseTime, isRegion);
 
     // remove this crequest in coalescedTable
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
@@ -511,7 +534,7 @@ GPUCoalescer::readCallback(Addr address,
         hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                     forwardRequestTime, firstResponseTime, isRegion);
 
-        delete crequest;
+        freeCoalescedRequest(crequest);
         coalescedTable.at(address).pop_front();
         if (coalescedTable.at(address).empty()) {
             break;
@@ -713,16 +736,29 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
     Addr line_addr = makeLineAddress(pkt->getAddr());
 
+    // Fast path: another lane of this instruction already coalesced into
+    // a request for the same line during this pass.
+    for (auto &line : instLines) {
+        if (line.first == line_addr) {
+            line.second->insertPacket(pkt);
+            return true;
+        }
+    }
+
     // If the packet has the same line address as a request already in the
     // coalescedTable and has the same sequence number, it can be coalesced.
-    if (coalescedTable.count(line_addr)) {
+    // This finds the requests created for the instruction in an earlier
+    // cycle.
+    auto table_iter = coalescedTable.find(line_addr);
+    if (table_iter != coalescedTable.end()) {
         // Search for a previous coalesced request with the same seqNum.
-        auto& creqQueue = coalescedTable.at(line_addr);
+        auto& creqQueue = table_iter->second;
         auto citer = std::find_if(creqQueue.begin(), creqQueue.end(),
             [&](CoalescedRequest* c) { return c->getSeqNum() == seqNum; }
         );
         if (citer != creqQueue.end()) {
             (*citer)->insertPacket(pkt);
+            instLines.emplace_back(line_addr, *citer);
             return true;
         }
     }
@@ -733,26 +769,22 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
         DPRINTF(GPUCoalescer, "Creating new or aliased request for 0x%X\n",
                 line_addr);
 
-        CoalescedRequest *creq = new CoalescedRequest(seqNum);
+        CoalescedRequest *creq = allocCoalescedRequest(seqNum);
         creq->insertPacket(pkt);
         creq->setRubyType(getRequestType(pkt));
         creq->setIssueTime(curCycle());
+        instLines.emplace_back(line_addr, creq);
 
-        if (!coalescedTable.count(line_addr)) {
+        if (table_iter == coalescedTable.end()) {
             // If there is no outstanding request for this line address,
             // create a new coalecsed request and issue it immediately.
-            auto reqList = std::deque<CoalescedRequest*> { creq };
-            coalescedTable.insert(std::make_pair(line_addr, reqList));
-            if (!coalescedReqs.count(seqNum)) {
-                coalescedReqs.insert(std::make_pair(seqNum, reqList));
-            } else {
-                coalescedReqs.at(seqNum).push_back(creq);
-            }
+            coalescedTable[line_addr].push_back(creq);
+            instIssue.push_back(creq);
         } else {
             // The request is for a line address that is already outstanding
             // but for a different instruction. Add it as a new request to be
             // issued when the current outstanding request is completed.
-            coalescedTable.at(line_addr).push_back(creq);
+            table_iter->second.push_back(creq);
             DPRINTF(GPUCoalescer, "found address 0x%X with new seqNum %d\n",
                     line_addr, seqNum);
         }
@@ -831,20 +863,18 @@ GPUCoalescer::completeIssue()
             // erase them from the list if coalescing is successful and
             // leave them in the list otherwise. This aggressively attempts
             // to coalesce as many packets as possible from the current inst.
-            pkt_list->remove_if(
-                [&](PacketPtr pkt) { return coalescePacket(pkt); }
-            );
-
-            if (coalescedReqs.count(seq_num)) {
-                auto& creqs = coalescedReqs.at(seq_num);
-                for (auto creq : creqs) {
-                    DPRINTF(GPUCoalescer, "Issued req type %s seqNum %d\n",
-                            RubyRequestType_to_string(creq->getRubyType()),
-                                                      seq_num);
-                    issueRequest(creq);
-                }
-                coalescedReqs.erase(seq_num);
+            pkt_list->erase(std::remove_if(pkt_list->begin(), pkt_list->end(),
+                [&](PacketPtr pkt) { return coalescePacket(pkt); }),
+                pkt_list->end());
+            instLines.clear();
+
+            for (auto creq : instIssue) {
+                DPRINTF(GPUCoalescer, "Issued req type %s seqNum %d\n",
+                        RubyRequestType_to_string(creq->getRubyType()),
+                        seq_num);
+                issueRequest(creq);
             }
+            instIssue.clear();
 
             assert(pkt_list_size >= pkt_list->size());
             size_t pkt_list_diff = pkt_list_size - pkt_list->size();
@@ -906,7 +936,7 @@ GPUCoalescer::atomicCallback(Addr address,
     hitCallback(crequest, mach, (DataBlock&)data, true,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false);
 
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
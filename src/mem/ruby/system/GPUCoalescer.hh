@@ -34,6 +34,8 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "gpu-compute/gpu_dyn_inst.hh"
@@ -41,6 +43,8 @@
 #include "mem/request.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/common/FlatAddrMap.hh"
+#include "mem/ruby/common/InlineQueue.hh"
 #include "mem/ruby/protocol/PrefetchBit.hh"
 #include "mem/ruby/protocol/RubyAccessMode.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
@@ -62,7 +66,7 @@ struct MachineID;
 class CacheMemory;
 
 // List of packets that belongs to a specific instruction.
-typedef std::list<PacketPtr> PerInstPackets;
+typedef std::vector<PacketPtr> PerInstPackets;
 
 class UncoalescedTable
 {
@@ -112,6 +116,16 @@ class CoalescedRequest
     {}
     ~CoalescedRequest() {}
 
+    // Reinitialize a recycled request, keeping the packet storage.
+    void
+    reset(uint64_t _seqNum)
+    {
+        seqNum = _seqNum;
+        issueTime = Cycles(0);
+        rubyType = RubyRequestType_NULL;
+        pkts.clear();
+    }
+
     void insertPacket(PacketPtr pkt) { pkts.push_back(pkt); }
     void setSeqNum(uint64_t _seqNum) { seqNum = _seqNum; }
     void setIssueTime(Cycles _issueTime) { issueTime = _issueTime; }
@@ -176,7 +190,7 @@ class PendingWriteInst
         assert(numPendingStores == 0);
 
         // make a response packet
-        PacketPtr pkt = new Packet(std::make_shared<Request>(),
+        PacketPtr pkt = new Packet(Request::make(),
                                    MemCmd::WriteCompleteResp);
 
         if (!usingRubyTester) {
@@ -409,6 +423,12 @@ class GPUCoalescer : public RubyPort
     // "target" list of the coalescedTable.
     bool coalescePacket(PacketPtr pkt);
 
+    // Coalesced requests are recycled through a free list, as one is
+    // created and destroyed for every line an instruction touches.
+    CoalescedRequest *allocCoalescedRequest(uint64_t seq_num);
+    void freeCoalescedRequest(CoalescedRequest *crequest);
+    std::vector<CoalescedRequest*> freeCoalescedReqs;
+
     EventFunctionWrapper issueEvent;
 
   protected:
@@ -432,11 +452,17 @@ class GPUCoalescer : public RubyPort
     // maximum size is equal to the maximum outstanding requests for a CU
     // (typically the number of blocks in TCP). If there are duplicates of
     // an address, the are serviced in age order.
-    std::map<Addr, std::deque<CoalescedRequest*>> coalescedTable;
-    // Map of instruction sequence number to coalesced requests that get
-    // created in coalescePacket, used in completeIssue to send the fully
-    // coalesced request
-    std::unordered_map<uint64_t, std::deque<CoalescedRequest*>> coalescedReqs;
+    FlatAddrMap<InlineQueue<CoalescedRequest*, 4>> coalescedTable;
+    // Flat coalescing buffer for the instruction completeIssue is working
+    // on: the line address of each coalesced request created or found for
+    // it so far. The lanes of an instruction typically touch only a few
+    // lines, so a scan of this buffer replaces the coalescedTable lookups
+    // for all but the first packet of each line.
+    std::vector<std::pair<Addr, CoalescedRequest*>> instLines;
+    // New requests of that instruction that are not aliased with an
+    // outstanding request, which completeIssue sends once the instruction
+    // is coalesced.
+    std::vector<CoalescedRequest*> instIssue;
 
     // a map btw an instruction sequence number and PendingWriteInst
     // this is used to do a final call back for each write when it is
@@ -48,6 +48,7 @@
 #include "debug/Ruby.hh"
 #include "mem/ruby/protocol/AccessPermission.hh"
 #include "mem/ruby/slicc_interface/AbstractController.hh"
+#include "mem/ruby/system/Sequencer.hh"
 #include "mem/simple_mem.hh"
 #include "sim/full_system.hh"
 #include "sim/system.hh"
@@ -321,9 +322,12 @@ RubyPort::MemResponsePort::recvTimingReq(PacketPtr pkt)
 Tick
 RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
 {
-    // Only atomic_noncaching mode supported!
-    if (!owner.system->bypassCaches()) {
-        panic("Ruby supports atomic accesses only in noncaching mode\n");
+    // Only atomic_noncaching mode supported, unless the caches are warmed
+    // from the atomic accesses!
+    bool warmup = !owner.system->bypassCaches();
+    if (warmup && !owner.m_ruby_system->getAtomicWarmup()) {
+        panic("Ruby supports atomic accesses only in noncaching mode, or "
+              "with the RubySystem's atomic_warmup\n");
     }
 
     // Check for pio requests and directly send them to the dedicated
@@ -347,8 +351,12 @@ RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
                RubySystem::getBlockSizeBytes());
     }
 
-    // Find the machine type of memory controller interface
     RubySystem *rs = owner.m_ruby_system;
+    if (warmup) {
+        return atomicWarmupAccess(pkt);
+    }
+
+    // Find the machine type of memory controller interface
     static int mem_interface_type = -1;
     if (mem_interface_type == -1) {
         if (rs->m_abstract_controls[MachineType_Directory].size() != 0) {
@@ -373,6 +381,44 @@ RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
     return latency;
 }
 
+Tick
+RubyPort::MemResponsePort::atomicWarmupAccess(PacketPtr pkt)
+{
+    RubySystem *rs = owner.m_ruby_system;
+
+    if (pkt->cmd == MemCmd::MemSyncReq) {
+        pkt->makeResponse();
+        return 0;
+    }
+
+    if (rs->getAccessBackingStore()) {
+        // The backing store has the official version of the data.
+        rs->getPhysMem()->access(pkt);
+    } else {
+        fatal_if(pkt->isAtomicOp(), "Atomic memory operations in the "
+                 "atomic mode require the RubySystem's access_backing_store"
+                 "\n");
+        bool needs_response = pkt->needsResponse();
+        if (pkt->isLLSC() && pkt->isWrite()) {
+            // There is no other access in between to fail the store
+            // conditional.
+            pkt->req->setExtraData(1);
+        }
+        bool succeeded = pkt->isRead() ? rs->functionalRead(pkt) :
+            rs->functionalWrite(pkt);
+        fatal_if(!succeeded, "Ruby atomic %s failed for address %#x\n",
+                 pkt->isWrite() ? "write" : "read", pkt->getAddr());
+        if (needs_response && !pkt->isResponse())
+            pkt->makeResponse();
+    }
+
+    // Only the CPU sequencers warm the caches.
+    if (owner.m_controller->getCPUSequencer() == &owner)
+        rs->recordAtomicAccess(owner.m_controller, pkt);
+
+    return owner.cyclesToTicks(Cycles(1));
+}
+
 void
 RubyPort::MemResponsePort::addToRetryList()
 {
@@ -498,7 +544,7 @@ RubyPort::ruby_stale_translation_callback(Addr txnId)
     // Allocate the invalidate request and packet on the stack, as it is
     // assumed they will not be modified or deleted by receivers.
     // TODO: should this really be using funcRequestorId?
-    auto request = std::make_shared<Request>(
+    auto request = Request::make(
         0, RubySystem::getBlockSizeBytes(), Request::TLBI_EXT_SYNC,
         Request::funcRequestorId);
     // Store the txnId in extraData instead of the address
@@ -698,7 +744,7 @@ RubyPort::ruby_eviction_callback(Addr address)
     // Allocate the invalidate request and packet on the stack, as it is
     // assumed they will not be modified or deleted by receivers.
     // TODO: should this really be using funcRequestorId?
-    auto request = std::make_shared<Request>(
+    auto request = Request::make(
         address, RubySystem::getBlockSizeBytes(), 0,
         Request::funcRequestorId);
 
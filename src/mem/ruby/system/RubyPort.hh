@@ -108,6 +108,12 @@ class RubyPort : public ClockedObject
         void addToRetryList();
 
       private:
+        /**
+         * Perform an atomic access functionally, and record it to warm
+         * the caches with once switched to the timing mode.
+         */
+        Tick atomicWarmupAccess(PacketPtr pkt);
+
         bool isShadowRomAddress(Addr addr) const;
         bool isPhysMemAddress(PacketPtr pkt) const;
     };
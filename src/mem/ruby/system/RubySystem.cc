@@ -43,7 +43,9 @@
 #include <fcntl.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <list>
 
 #include "base/compiler.hh"
@@ -52,6 +54,7 @@
 #include "debug/RubyCacheTrace.hh"
 #include "debug/RubySystem.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/WriteMask.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/system/DMASequencer.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -78,12 +81,17 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params &p)
     : ClockedObject(p), m_access_backing_store(p.access_backing_store),
-      m_cache_recorder(NULL)
+      m_atomic_warmup(p.atomic_warmup),
+      m_atomic_warmup_lines(p.atomic_warmup_lines),
+      m_num_atomic_accesses(0), m_cache_recorder(NULL)
 {
     m_randomization = p.randomization;
 
     m_block_size_bytes = p.block_size_bytes;
     assert(isPowerOf2(m_block_size_bytes));
+    fatal_if(m_block_size_bytes > WriteMask::MaxSize,
+             "Ruby blocks cannot be larger than %d bytes\n",
+             WriteMask::MaxSize);
     m_block_size_bits = floorLog2(m_block_size_bytes);
     m_memory_size_bits = p.memory_size_bits;
 
@@ -106,6 +114,7 @@ RubySystem::registerNetwork(Network* network_ptr)
 void
 RubySystem::registerAbstractController(AbstractController* cntrl)
 {
+    m_cntrl_index[cntrl] = m_abs_cntrl_vec.size();
     m_abs_cntrl_vec.push_back(cntrl);
 
     MachineID id = cntrl->getMachineID();
@@ -165,6 +174,83 @@ RubySystem::registerRequestorIDs()
             requestorToNetwork.insert(std::make_pair(id, 0));
         }
     }
+
+    buildHolderIndex();
+}
+
+void
+RubySystem::buildHolderIndex()
+{
+    for (auto &[net_id, cntrls] : netCntrls) {
+        HolderIndex &index = holderIndex[net_id];
+        for (unsigned pos = 0; pos < cntrls.size(); ++pos) {
+            AbstractController *cntrl = cntrls[pos];
+            const AddrRangeList &ranges = cntrl->getAddrRanges();
+
+            // A controller is indexed by range only if each of its
+            // ranges either matches an existing entry exactly or does
+            // not overlap any, otherwise it is checked for every line.
+            bool by_range = !ranges.empty();
+            for (const auto &r : ranges) {
+                if (!r.interleaved() && r.start() == 0 &&
+                    r.end() == MaxAddr) {
+                    by_range = false;
+                    break;
+                }
+                auto it = index.byRange.intersects(r);
+                if (it != index.byRange.end() && !(it->first == r)) {
+                    by_range = false;
+                    break;
+                }
+            }
+
+            if (!by_range) {
+                index.anyLine.emplace_back(pos, cntrl);
+                continue;
+            }
+
+            for (const auto &r : ranges) {
+                auto it = index.byRange.intersects(r);
+                if (it == index.byRange.end())
+                    it = index.byRange.insert(r, PositionedCntrls());
+                panic_if(!(it->first == r),
+                         "Overlapping address ranges in %s.",
+                         cntrl->name());
+                it->second.emplace_back(pos, cntrl);
+            }
+        }
+        index.byRange.freeze();
+
+        DPRINTF(RubySystem, "Network %d: %d controllers hold any line, "
+                "%d range entries\n", net_id, index.anyLine.size(),
+                index.byRange.size());
+    }
+}
+
+const std::vector<AbstractController *> &
+RubySystem::lineHolders(unsigned net_id, Addr line_addr)
+{
+    static const PositionedCntrls none;
+
+    HolderIndex &index = holderIndex[net_id];
+    auto it = index.byRange.contains(line_addr);
+    const PositionedCntrls &ranged =
+        it == index.byRange.end() ? none : it->second;
+
+    // Merge both lists back into netCntrls order so that the first
+    // controller found in a given state does not change
+    holderScratch.clear();
+    auto a = index.anyLine.begin();
+    auto b = ranged.begin();
+    while (a != index.anyLine.end() || b != ranged.end()) {
+        if (b == ranged.end() ||
+            (a != index.anyLine.end() && a->first < b->first)) {
+            holderScratch.push_back(a++->second);
+        } else {
+            holderScratch.push_back(b++->second);
+        }
+    }
+    return holderScratch;
 }
 
 RubySystem::~RubySystem()
@@ -285,35 +371,6 @@ RubySystem::memWriteback()
     // checkpoint is immediately taken.
 }
 
-void
-RubySystem::writeCompressedTrace(uint8_t *raw_data, std::string filename,
-                                 uint64_t uncompressed_trace_size)
-{
-    // Create the checkpoint file for the memory
-    std::string thefile = CheckpointIn::dir() + "/" + filename.c_str();
-
-    int fd = creat(thefile.c_str(), 0664);
-    if (fd < 0) {
-        perror("creat");
-        fatal("Can't open memory trace file '%s'\n", filename);
-    }
-
-    gzFile compressedMemory = gzdopen(fd, "wb");
-    if (compressedMemory == NULL)
-        fatal("Insufficient memory to allocate compression state for %s\n",
-              filename);
-
-    if (gzwrite(compressedMemory, raw_data, uncompressed_trace_size) !=
-        uncompressed_trace_size) {
-        fatal("Write failed on memory trace file '%s'\n", filename);
-    }
-
-    if (gzclose(compressedMemory)) {
-        fatal("Close failed on memory trace file '%s'\n", filename);
-    }
-    delete[] raw_data;
-}
-
 void
 RubySystem::serialize(CheckpointOut &cp) const
 {
@@ -331,12 +388,9 @@ RubySystem::serialize(CheckpointOut &cp) const
                 "ruby trace");
     }
 
-    // Aggregate the trace entries together into a single array
-    uint8_t *raw_data = new uint8_t[4096];
-    uint64_t cache_trace_size = m_cache_recorder->aggregateRecords(
-                                                        &raw_data, 4096);
     std::string cache_trace_file = name() + ".cache.gz";
-    writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size);
+    uint64_t cache_trace_size = m_cache_recorder->writeRecords(
+        CheckpointIn::dir() + "/" + cache_trace_file);
 
     SERIALIZE_SCALAR(cache_trace_file);
     SERIALIZE_SCALAR(cache_trace_size);
@@ -351,6 +405,11 @@ RubySystem::drainResume()
         delete m_cache_recorder;
         m_cache_recorder = NULL;
     }
+
+    // Warm the caches with the lines accessed in the atomic mode once
+    // switched to the timing mode.
+    if (m_atomic_warmup && params().system->isTimingMode())
+        warmupFromAtomicAccesses();
 }
 
 void
@@ -373,10 +432,19 @@ RubySystem::readCompressedTrace(std::string filename, uint8_t *&raw_data,
               filename);
     }
 
+    // gzread() takes at most an unsigned int at a time, so read the trace
+    // in chunks.
+    const uint64_t chunk_size = 1 << 30;
+    gzbuffer(compressedTrace, 1 << 20);
     raw_data = new uint8_t[uncompressed_trace_size];
-    if (gzread(compressedTrace, raw_data, uncompressed_trace_size) <
-            uncompressed_trace_size) {
-        fatal("Unable to read complete trace from file %s\n", filename);
+    for (uint64_t offset = 0; offset < uncompressed_trace_size;
+         offset += chunk_size) {
+        unsigned size = std::min(chunk_size,
+                                 uncompressed_trace_size - offset);
+        if (gzread(compressedTrace, raw_data + offset, size) < (int)size) {
+            fatal("Unable to read complete trace from file %s\n",
+                  filename);
+        }
     }
 
     if (gzclose(compressedTrace)) {
@@ -438,36 +506,130 @@ RubySystem::startup()
     // state was checkpointed.
 
     if (m_warmup_enabled) {
-        DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
-        // save the current tick value
-        Tick curtick_original = curTick();
-        // save the event queue head
-        Event* eventq_head = eventq->replaceHead(NULL);
-        // set curTick to 0 and reset Ruby System's clock
-        setCurTick(0);
-        resetClock();
-
-        // Schedule an event to start cache warmup
-        enqueueRubyEvent(curTick());
-        simulate();
-
-        delete m_cache_recorder;
-        m_cache_recorder = NULL;
+        warmupCaches();
         m_systems_to_warmup--;
         if (m_systems_to_warmup == 0) {
             m_warmup_enabled = false;
         }
-
-        // Restore eventq head
-        eventq->replaceHead(eventq_head);
-        // Restore curTick and Ruby System's clock
-        setCurTick(curtick_original);
-        resetClock();
     }
 
     resetStats();
 }
 
+void
+RubySystem::warmupCaches()
+{
+    DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
+    // save the current tick value
+    Tick curtick_original = curTick();
+    // save the event queue head
+    Event* eventq_head = eventq->replaceHead(NULL);
+    // set curTick to 0 and reset Ruby System's clock
+    setCurTick(0);
+    resetClock();
+
+    // Schedule an event to start cache warmup
+    enqueueRubyEvent(curTick());
+    simulate();
+
+    delete m_cache_recorder;
+    m_cache_recorder = NULL;
+
+    // Restore eventq head
+    eventq->replaceHead(eventq_head);
+    // Restore curTick and Ruby System's clock
+    setCurTick(curtick_original);
+    resetClock();
+}
+
+void
+RubySystem::recordAtomicAccess(AbstractController *cntrl, PacketPtr pkt)
+{
+    assert(m_cntrl_index.count(cntrl));
+    int index = m_cntrl_index[cntrl];
+    if (m_atomic_accesses.size() <= index)
+        m_atomic_accesses.resize(m_abs_cntrl_vec.size());
+    AtomicAccesses &accesses = m_atomic_accesses[index];
+
+    Addr line = makeLineAddress(pkt->getAddr());
+    RubyRequestType type = pkt->isWrite() ? RubyRequestType_ST :
+        pkt->req->isInstFetch() ? RubyRequestType_IFETCH :
+        RubyRequestType_LD;
+
+    auto it = accesses.lines.find(line);
+    if (it != accesses.lines.end()) {
+        // A line that was written is warmed with a store
+        if (it->second->type == RubyRequestType_ST)
+            type = RubyRequestType_ST;
+        accesses.lru.erase(it->second);
+    } else if (accesses.lru.size() == m_atomic_warmup_lines) {
+        accesses.lines.erase(accesses.lru.front().line);
+        accesses.lru.pop_front();
+    }
+
+    accesses.lru.push_back(
+        {line, type, pkt->requestorId(), m_num_atomic_accesses++});
+    accesses.lines[line] = std::prev(accesses.lru.end());
+}
+
+/*
+ * The recorded lines are replayed in the order they were last accessed in,
+ * as requests of the type they were accessed with, which is the closest to
+ * the stable states the atomic accesses would have left the lines in that
+ * any protocol can reproduce. Stores write the current data of their line,
+ * so replaying them does not change the memory contents.
+ */
+void
+RubySystem::warmupFromAtomicAccesses()
+{
+    std::vector<std::pair<int, const AtomicAccess *>> records;
+    for (int cntrl = 0; cntrl < m_atomic_accesses.size(); cntrl++) {
+        for (const auto &access : m_atomic_accesses[cntrl].lru)
+            records.emplace_back(cntrl, &access);
+    }
+    if (records.empty())
+        return;
+
+    std::sort(records.begin(), records.end(),
+              [](const auto &a, const auto &b) {
+                  return a.second->order < b.second->order;
+              });
+
+    uint64_t record_size = sizeof(TraceRecord) + m_block_size_bytes;
+    uint64_t trace_size = records.size() * record_size;
+    uint8_t *trace = new uint8_t[trace_size];
+    for (int i = 0; i < records.size(); i++) {
+        const AtomicAccess &access = *records[i].second;
+        TraceRecord *rec = (TraceRecord *)(trace + i * record_size);
+        rec->m_cntrl_id = records[i].first;
+        rec->m_time = 0;
+        rec->m_data_address = access.line;
+        rec->m_pc_address = 0;
+        rec->m_type = access.type;
+        std::memset(rec->m_data, 0, m_block_size_bytes);
+
+        if (access.type == RubyRequestType_ST) {
+            auto req = Request::make(access.line, m_block_size_bytes, 0,
+                                     access.requestor);
+            Packet pkt(req, MemCmd::ReadReq);
+            pkt.dataStatic(rec->m_data);
+            if (m_access_backing_store)
+                m_phys_mem->functionalAccess(&pkt);
+            else if (!functionalRead(&pkt))
+                rec->m_type = RubyRequestType_LD;
+        }
+    }
+    m_atomic_accesses.clear();
+
+    DPRINTF(RubyCacheTrace, "Warming the caches with %d atomic accesses\n",
+            records.size());
+    makeCacheRecorder(trace, trace_size, m_block_size_bytes);
+    bool warmup_enabled = m_warmup_enabled;
+    m_warmup_enabled = true;
+    warmupCaches();
+    m_warmup_enabled = warmup_enabled;
+}
+
 void
 RubySystem::processRubyEvent()
 {
@@ -515,9 +677,15 @@ RubySystem::functionalRead(PacketPtr pkt)
     AbstractController *ctrl_rw = nullptr;
     AbstractController *ctrl_backing_store = nullptr;
 
+    // Controllers whose address ranges exclude the line can not hold it
+    // and count as invalid.
+    const auto &holders = lineHolders(request_net_id, line_address);
+    int num_controllers = netCntrls[request_net_id].size();
+    num_invalid = num_controllers - holders.size();
+
     // In this loop we count the number of controllers that have the given
     // address in read only, read write and busy states.
-    for (auto& cntrl : netCntrls[request_net_id]) {
+    for (auto& cntrl : holders) {
         access_perm = cntrl-> getAccessPermission(line_address);
         if (access_perm == AccessPermission_Read_Only){
             num_ro++;
@@ -553,7 +721,6 @@ RubySystem::functionalRead(PacketPtr pkt)
     // The reason is because the Backing_Store memory could easily be stale, if
     // there are copies floating around the cache hierarchy, so you want to read
     // it only if it's not in the cache hierarchy at all.
-    int num_controllers = netCntrls[request_net_id].size();
     if (num_invalid == (num_controllers - 1) && num_backing_store == 1) {
         DPRINTF(RubySystem, "only copy in Backing_Store memory, read from it\n");
         ctrl_backing_store->functionalRead(line_address, pkt);
@@ -589,7 +756,7 @@ RubySystem::functionalRead(PacketPtr pkt)
         DPRINTF(RubySystem, "Controllers functionalRead lookup "
                             "(num_maybe_stale=%d, num_busy = %d)\n",
                 num_maybe_stale, num_busy);
-        for (auto& cntrl : netCntrls[request_net_id]) {
+        for (auto& cntrl : holders) {
             if (cntrl->functionalReadBuffers(pkt))
                 return true;
         }
@@ -722,7 +889,11 @@ RubySystem::functionalWrite(PacketPtr pkt)
     int request_net_id = requestorToNetwork[pkt->requestorId()];
     assert(netCntrls.count(request_net_id));
 
-    for (auto& cntrl : netCntrls[request_net_id]) {
+    // A message carrying the line can only be in the network while one of
+    // the controllers that may hold it is in a transient state
+    bool in_flight = false;
+
+    for (auto& cntrl : lineHolders(request_net_id, line_addr)) {
         num_functional_writes += cntrl->functionalWriteBuffers(pkt);
 
         access_perm = cntrl->getAccessPermission(line_addr);
@@ -731,6 +902,11 @@ RubySystem::functionalWrite(PacketPtr pkt)
             num_functional_writes +=
                 cntrl->functionalWrite(line_addr, pkt);
         }
+        if (access_perm == AccessPermission_Busy ||
+            access_perm == AccessPermission_Maybe_Stale ||
+            access_perm == AccessPermission_Backing_Store_Busy) {
+            in_flight = true;
+        }
 
         // Also updates requests pending in any sequencer associated
         // with the controller
@@ -744,8 +920,10 @@ RubySystem::functionalWrite(PacketPtr pkt)
         }
     }
 
-    for (auto& network : m_networks) {
-        num_functional_writes += network->functionalWrite(pkt);
+    if (in_flight) {
+        for (auto& network : m_networks) {
+            num_functional_writes += network->functionalWrite(pkt);
+        }
     }
     DPRINTF(RubySystem, "Messages written = %u\n", num_functional_writes);
 
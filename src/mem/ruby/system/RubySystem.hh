@@ -35,8 +35,10 @@
 #ifndef __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 #define __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 
+#include <list>
 #include <unordered_map>
 
+#include "base/addr_range_map.hh"
 #include "base/callback.hh"
 #include "base/output.hh"
 #include "mem/packet.hh"
@@ -78,6 +80,13 @@ class RubySystem : public ClockedObject
     memory::SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
+    bool getAtomicWarmup() const { return m_atomic_warmup; }
+
+    /**
+     * Record a line accessed atomically through a controller's sequencer,
+     * to warm the caches with when switching to the timing mode.
+     */
+    void recordAtomicAccess(AbstractController *cntrl, PacketPtr pkt);
 
     // Public Methods
     Profiler*
@@ -128,10 +137,30 @@ class RubySystem : public ClockedObject
     static void readCompressedTrace(std::string filename,
                                     uint8_t *&raw_data,
                                     uint64_t &uncompressed_trace_size);
-    static void writeCompressedTrace(uint8_t *raw_data, std::string file,
-                                     uint64_t uncompressed_trace_size);
 
     void processRubyEvent();
+
+    /**
+     * Index the controllers of each network by the address ranges they
+     * declare, so functional accesses only query those that can hold
+     * the line.
+     */
+    void buildHolderIndex();
+
+    /**
+     * Controllers of a network that may hold a line, in the order they
+     * appear in netCntrls.
+     */
+    const std::vector<AbstractController *> &
+    lineHolders(unsigned net_id, Addr line_addr);
+
+    /**
+     * Replay the trace of the cache recorder through the sequencers, with
+     * time rolled back to zero, as when restoring a checkpoint.
+     */
+    void warmupCaches();
+    void warmupFromAtomicAccesses();
+
   private:
     // configuration parameters
     static bool m_randomization;
@@ -145,6 +174,26 @@ class RubySystem : public ClockedObject
     memory::SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
 
+    // Lines accessed in the atomic mode, for each controller, least
+    // recently accessed first
+    struct AtomicAccess
+    {
+        Addr line;
+        RubyRequestType type;
+        RequestorID requestor;
+        uint64_t order;
+    };
+    struct AtomicAccesses
+    {
+        std::list<AtomicAccess> lru;
+        std::unordered_map<Addr, std::list<AtomicAccess>::iterator> lines;
+    };
+    const bool m_atomic_warmup;
+    const unsigned m_atomic_warmup_lines;
+    std::unordered_map<AbstractController *, int> m_cntrl_index;
+    std::vector<AtomicAccesses> m_atomic_accesses;
+    uint64_t m_num_atomic_accesses;
+
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
     std::vector<AbstractController *> m_abs_cntrl_vec;
@@ -154,6 +203,19 @@ class RubySystem : public ClockedObject
     std::unordered_map<RequestorID, unsigned> requestorToNetwork;
     std::unordered_map<unsigned, std::vector<AbstractController*>> netCntrls;
 
+    // Controllers of a network tagged with their position in netCntrls.
+    // Those covering all of memory, or whose ranges do not line up with
+    // the other controllers, may hold any line.
+    using PositionedCntrls =
+        std::vector<std::pair<unsigned, AbstractController *>>;
+    struct HolderIndex
+    {
+        PositionedCntrls anyLine;
+        AddrRangeMap<PositionedCntrls> byRange;
+    };
+    std::unordered_map<unsigned, HolderIndex> holderIndex;
+    std::vector<AbstractController *> holderScratch;
+
   public:
     Profiler* m_profiler;
     CacheRecorder* m_cache_recorder;
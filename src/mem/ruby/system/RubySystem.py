@@ -48,6 +48,15 @@ class RubySystem(ClockedObject):
         64, "number of bits that a memory address requires"
     )
 
+    parallel_controllers = Param.Bool(
+        False,
+        "Let the event queue partitioner (Root.eventq_partitions) place the "
+        "controllers, each with its sequencers, on other event queues than "
+        "the network. The message buffers between them must then be "
+        "unbounded, not randomized, fed from a single event queue, and "
+        "their latency at least Root.sim_quantum.",
+    )
+
     phys_mem = Param.SimpleMemory(NULL, "")
     system = Param.System(Parent.any, "system object")
 
@@ -57,8 +66,30 @@ class RubySystem(ClockedObject):
         store and only use ruby for timing.",
     )
 
+    atomic_warmup = Param.Bool(
+        False,
+        "Support the atomic memory mode by performing the accesses "
+        "functionally. The sequencers record the lines they access, and "
+        "the caches are warmed with them through the protocol, as when "
+        "restoring a checkpoint, on switching to the timing mode. The "
+        "warmup requests count in the Ruby stats.",
+    )
+    atomic_warmup_lines = Param.Unsigned(
+        65536,
+        "The number of most recently accessed lines each sequencer warms "
+        "the caches with",
+    )
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
+    profiler_max_entries = Param.Unsigned(
+        0,
+        "Maximum number of addresses kept in each address profiler table, "
+        "only the most frequent ones are kept (0: unlimited)",
+    )
+    profiler_sample_period = Param.Unsigned(
+        1, "Number of misses per miss recorded by the address profiler"
+    )
     num_of_sequencers = Param.Int("")
     number_of_virtual_networks = Param.Unsigned("")
@@ -182,6 +182,9 @@ SharedMemoryServer::ClientSocketEvent::process(int revents)
                name(), range.to_string(), it->range.to_string(), it->shmFd,
                (unsigned long long)it->shmOffset);
 
+        // The client may write the memory directly
+        shmServer->system->getPhysMem().untrackedWriter(name());
+
         // Populate response message.
         // mmap fd @ offset <===> [start, end] in simulated phys mem.
         msghdr msg = {};
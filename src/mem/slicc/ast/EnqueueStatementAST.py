@@ -67,7 +67,7 @@ class EnqueueStatementAST(StatementAST):
         # Declare message
         code(
             "std::shared_ptr<${{msg_type.c_ident}}> out_msg = "
-            "std::make_shared<${{msg_type.c_ident}}>(clockEdge());"
+            "makeMessage<${{msg_type.c_ident}}>(clockEdge());"
         )
 
         # The other statements
@@ -1259,6 +1259,8 @@ $c_ident::${{action.ident}}(Addr addr)
 
 """
                 )
+        self.printTransitionWorker(code)
+
         for func in self.functions:
             code(func.generateCode())
 
@@ -1345,6 +1347,211 @@ $c_ident::functionalReadBuffers(PacketPtr& pkt, WriteMask &mask)
 
         code.write(path, f"{c_ident}.cc")
 
+
+    def printTransitionWorker(self, code):
+        """Output the function performing the transitions. It is in the
+        same translation unit as the actions, so that they can be inlined
+        into it."""
+
+        ident = self.ident
+
+        code(
+            """
+#define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
+
+TransitionResult
+${ident}_Controller::doTransitionWorker(${ident}_Event event,
+                                        ${ident}_State state,
+                                        ${ident}_State& next_state,
+"""
+        )
+
+        if self.TBEType != None:
+            code(
+                """
+                                        ${{self.TBEType.c_ident}}*& m_tbe_ptr,
+"""
+            )
+        if self.EntryType != None:
+            code(
+                """
+                                        ${{self.EntryType.c_ident}}*& m_cache_entry_ptr,
+"""
+            )
+        code(
+            """
+                                        Addr addr)
+{
+    m_curTransitionEvent = event;
+    m_curTransitionNextState = next_state;
+"""
+        )
+        code.indent()
+
+        # This map will allow suppress generating duplicate code
+        cases = OrderedDict()
+
+        for trans in self.transitions:
+            case_string = "%s_State_%s, %s_Event_%s" % (
+                self.ident,
+                trans.state.ident,
+                self.ident,
+                trans.event.ident,
+            )
+
+            case = self.symtab.codeFormatter()
+            # Only set next_state if it changes
+            if trans.state != trans.nextState:
+                if trans.nextState.isWildcard():
+                    # When * is encountered as an end state of a transition,
+                    # the next state is determined by calling the
+                    # machine-specific getNextState function. The next state
+                    # is determined before any actions of the transition
+                    # execute, and therefore the next state calculation cannot
+                    # depend on any of the transitionactions.
+                    case(
+                        "next_state = getNextState(addr); "
+                        "m_curTransitionNextState = next_state;"
+                    )
+                else:
+                    ns_ident = trans.nextState.ident
+                    case(
+                        "next_state = ${ident}_State_${ns_ident}; "
+                        "m_curTransitionNextState = next_state;"
+                    )
+
+            actions = trans.actions
+            request_types = trans.request_types
+
+            # Check for resources
+            case_sorter = []
+            res = trans.resources
+            for key, val in res.items():
+                val = f"""
+if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
+    return TransitionResult_ResourceStall;
+"""
+                case_sorter.append(val)
+
+            # Check all of the request_types for resource constraints
+            for request_type in request_types:
+                val = """
+if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
+    return TransitionResult_ResourceStall;
+}
+""" % (
+                    self.ident,
+                    request_type.ident,
+                )
+                case_sorter.append(val)
+
+            # Emit the code sequences in a sorted order.  This makes the
+            # output deterministic (without this the output order can vary
+            # since Map's keys() on a vector of pointers is not deterministic
+            for c in sorted(case_sorter):
+                case("$c")
+
+            # Record access types for this transition
+            for request_type in request_types:
+                case(
+                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
+                )
+
+            # Figure out if we stall
+            stall = False
+            for action in actions:
+                if action.ident == "z_stall":
+                    stall = True
+                    break
+
+            if stall:
+                case("return TransitionResult_ProtocolStall;")
+            else:
+                if self.TBEType != None and self.EntryType != None:
+                    for action in actions:
+                        case(
+                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
+                        )
+                elif self.TBEType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_tbe_ptr, addr);")
+                elif self.EntryType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
+                else:
+                    for action in actions:
+                        case("${{action.ident}}(addr);")
+                case("return TransitionResult_Valid;")
+
+            case = str(case)
+
+            # Look to see if this transition code is unique.
+            if case not in cases:
+                cases[case] = []
+
+            cases[case].append(case_string)
+
+        # Number the unique code blocks from 1, and build a dense table
+        # mapping every (state, event) pair to the number of its block, or
+        # to 0 if the pair has no transition. Switching on the block number
+        # compiles to a single jump table.
+        case_of = {}
+        for num, transitions in enumerate(cases.values(), 1):
+            for trans in transitions:
+                case_of[trans] = num
+        table = []
+        for state in self.states.values():
+            for event in self.events.values():
+                table.append(
+                    case_of.get(
+                        f"{self.ident}_State_{state.ident}, "
+                        f"{self.ident}_Event_{event.ident}",
+                        0,
+                    )
+                )
+        if len(cases) < 256:
+            entry_type = "uint8_t"
+        elif len(cases) < 65536:
+            entry_type = "uint16_t"
+        else:
+            entry_type = "uint32_t"
+
+        code(
+            "static const ${entry_type} "
+            "caseTable[${ident}_State_NUM * ${ident}_Event_NUM] = {"
+        )
+        code.indent()
+        for i in range(0, len(table), 16):
+            code(", ".join(str(num) for num in table[i : i + 16]) + ",")
+        code.dedent()
+        code("};")
+        code()
+        code("switch (caseTable[HASH_FUN(state, event)]) {")
+
+        # Walk through all of the unique code blocks and spit out the
+        # corresponding case statement elements
+        for num, (case, transitions) in enumerate(cases.items(), 1):
+            # Iterative over all the multiple transitions that share
+            # the same code
+            for trans in transitions:
+                code("  // $trans")
+            code("  case $num:")
+            code("    $case\n")
+
+        code.dedent()
+        code(
+            """
+      default:
+        panic("Invalid transition\\n"
+              "%s time: %d addr: %#x event: %s state: %s\\n",
+              name(), curCycle(), addr, event, state);
+    }
+
+    return TransitionResult_Valid;
+}
+"""
+        )
+
     def printCWakeup(self, path, includes):
         """Output the wakeup loop for the events"""
 
@@ -1518,8 +1725,6 @@ ${ident}_Controller::wakeup()
 #include "mem/ruby/protocol/Types.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
-#define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
-
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
 #define CLEAR_TRANSITION_COMMENT() (${ident}_transitionComment.str(""))
 
@@ -1650,158 +1855,6 @@ return result;
             """
 }
 
-TransitionResult
-${ident}_Controller::doTransitionWorker(${ident}_Event event,
-                                        ${ident}_State state,
-                                        ${ident}_State& next_state,
-"""
-        )
-
-        if self.TBEType != None:
-            code(
-                """
-                                        ${{self.TBEType.c_ident}}*& m_tbe_ptr,
-"""
-            )
-        if self.EntryType != None:
-            code(
-                """
-                                        ${{self.EntryType.c_ident}}*& m_cache_entry_ptr,
-"""
-            )
-        code(
-            """
-                                        Addr addr)
-{
-    m_curTransitionEvent = event;
-    m_curTransitionNextState = next_state;
-    switch(HASH_FUN(state, event)) {
-"""
-        )
-
-        # This map will allow suppress generating duplicate code
-        cases = OrderedDict()
-
-        for trans in self.transitions:
-            case_string = "%s_State_%s, %s_Event_%s" % (
-                self.ident,
-                trans.state.ident,
-                self.ident,
-                trans.event.ident,
-            )
-
-            case = self.symtab.codeFormatter()
-            # Only set next_state if it changes
-            if trans.state != trans.nextState:
-                if trans.nextState.isWildcard():
-                    # When * is encountered as an end state of a transition,
-                    # the next state is determined by calling the
-                    # machine-specific getNextState function. The next state
-                    # is determined before any actions of the transition
-                    # execute, and therefore the next state calculation cannot
-                    # depend on any of the transitionactions.
-                    case(
-                        "next_state = getNextState(addr); "
-                        "m_curTransitionNextState = next_state;"
-                    )
-                else:
-                    ns_ident = trans.nextState.ident
-                    case(
-                        "next_state = ${ident}_State_${ns_ident}; "
-                        "m_curTransitionNextState = next_state;"
-                    )
-
-            actions = trans.actions
-            request_types = trans.request_types
-
-            # Check for resources
-            case_sorter = []
-            res = trans.resources
-            for key, val in res.items():
-                val = f"""
-if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
-    return TransitionResult_ResourceStall;
-"""
-                case_sorter.append(val)
-
-            # Check all of the request_types for resource constraints
-            for request_type in request_types:
-                val = """
-if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
-    return TransitionResult_ResourceStall;
-}
-""" % (
-                    self.ident,
-                    request_type.ident,
-                )
-                case_sorter.append(val)
-
-            # Emit the code sequences in a sorted order.  This makes the
-            # output deterministic (without this the output order can vary
-            # since Map's keys() on a vector of pointers is not deterministic
-            for c in sorted(case_sorter):
-                case("$c")
-
-            # Record access types for this transition
-            for request_type in request_types:
-                case(
-                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
-                )
-
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
-                case("return TransitionResult_ProtocolStall;")
-            else:
-                if self.TBEType != None and self.EntryType != None:
-                    for action in actions:
-                        case(
-                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
-                        )
-                elif self.TBEType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_tbe_ptr, addr);")
-                elif self.EntryType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
-                else:
-                    for action in actions:
-                        case("${{action.ident}}(addr);")
-                case("return TransitionResult_Valid;")
-
-            case = str(case)
-
-            # Look to see if this transition code is unique.
-            if case not in cases:
-                cases[case] = []
-
-            cases[case].append(case_string)
-
-        # Walk through all of the unique code blocks and spit out the
-        # corresponding case statement elements
-        for case, transitions in cases.items():
-            # Iterative over all the multiple transitions that share
-            # the same code
-            for trans in transitions:
-                code("  case HASH_FUN($trans):")
-            code("    $case\n")
-
-        code(
-            """
-      default:
-        panic("Invalid transition\\n"
-              "%s time: %d addr: %#x event: %s state: %s\\n",
-              name(), curCycle(), addr, event, state);
-    }
-
-    return TransitionResult_Valid;
-}
-
 } // namespace ruby
 } // namespace gem5
 """
@@ -42,6 +42,9 @@
 
 #include "mem/snoop_filter.hh"
 
+#include <algorithm>
+
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
@@ -52,12 +55,103 @@ namespace gem5
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
+SnoopFilter::SnoopFilterCache::SnoopFilterCache(size_t max_entries)
+    : maxSlots(std::max<size_t>(16, 1ULL << ceilLog2(2 * max_entries)))
+{
+    // start small, as most snoop filters never get close to their
+    // capacity
+    rebuild(std::min<size_t>(maxSlots, 1024));
+}
+
+SnoopFilter::SnoopFilterCache::Slot
+SnoopFilter::SnoopFilterCache::find(Addr line_addr) const
+{
+    const Slot mask = keys.size() - 1;
+    for (Slot slot = home(line_addr); ; slot = (slot + 1) & mask) {
+        if (keys[slot] == line_addr)
+            return slot;
+        if (keys[slot] == EmptyKey)
+            return NoSlot;
+    }
+}
+
+std::pair<SnoopFilter::SnoopFilterCache::Slot, bool>
+SnoopFilter::SnoopFilterCache::emplace(Addr line_addr)
+{
+    assert(line_addr != EmptyKey && line_addr != ErasedKey);
+
+    // keep at least a quarter of the slots empty, so probes stay short
+    // and always terminate
+    if (4 * (entries + tombstones + 1) > 3 * keys.size()) {
+        // grow until the capacity fits at half occupancy, and beyond
+        // that only if the entries alone fill the table
+        const bool grow = 2 * (entries + 1) > keys.size() &&
+            (keys.size() < maxSlots ||
+             4 * (entries + 1) > 3 * keys.size());
+        rebuild(grow ? 2 * keys.size() : keys.size());
+    }
+
+    const Slot mask = keys.size() - 1;
+    Slot erased = NoSlot;
+    Slot slot = home(line_addr);
+    for (; keys[slot] != EmptyKey; slot = (slot + 1) & mask) {
+        if (keys[slot] == line_addr)
+            return std::make_pair(slot, false);
+        if (keys[slot] == ErasedKey && erased == NoSlot)
+            erased = slot;
+    }
+
+    // reuse the first tombstone on the way, if any
+    if (erased != NoSlot) {
+        slot = erased;
+        tombstones--;
+    }
+    keys[slot] = line_addr;
+    items[slot] = SnoopItem();
+    entries++;
+    return std::make_pair(slot, true);
+}
+
+void
+SnoopFilter::SnoopFilterCache::erase(Slot slot)
+{
+    assert(keys[slot] != EmptyKey && keys[slot] != ErasedKey);
+    keys[slot] = ErasedKey;
+    entries--;
+    tombstones++;
+}
+
+void
+SnoopFilter::SnoopFilterCache::rebuild(size_t num_slots)
+{
+    assert(isPowerOf2(num_slots));
+
+    std::vector<Addr> old_keys(num_slots, EmptyKey);
+    std::vector<SnoopItem> old_items(num_slots);
+    keys.swap(old_keys);
+    items.swap(old_items);
+    shift = 64 - floorLog2(num_slots);
+    tombstones = 0;
+
+    const Slot mask = num_slots - 1;
+    for (Slot old_slot = 0; old_slot < old_keys.size(); old_slot++) {
+        const Addr line_addr = old_keys[old_slot];
+        if (line_addr == EmptyKey || line_addr == ErasedKey)
+            continue;
+        Slot slot = home(line_addr);
+        while (keys[slot] != EmptyKey)
+            slot = (slot + 1) & mask;
+        keys[slot] = line_addr;
+        items[slot] = old_items[old_slot];
+    }
+}
+
 void
-SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
+SnoopFilter::eraseIfNullEntry(SnoopFilterCache::Slot sf_slot)
 {
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = cachedLocations.item(sf_slot);
     if ((sf_item.requested | sf_item.holder).none()) {
-        cachedLocations.erase(sf_it);
+        cachedLocations.erase(sf_slot);
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
@@ -78,8 +172,8 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         line_addr |= LineSecure;
     }
     SnoopMask req_port = portToMask(cpu_side_port);
-    reqLookupResult.it = cachedLocations.find(line_addr);
-    bool is_hit = (reqLookupResult.it != cachedLocations.end());
+    reqLookupResult.slot = cachedLocations.find(line_addr);
+    bool is_hit = (reqLookupResult.slot != SnoopFilterCache::NoSlot);
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
@@ -87,12 +181,11 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
     if (!is_hit && !allocate)
         return snoopDown(lookupLatency);
 
-    // If no hit in snoop filter create a new element and update iterator
+    // If no hit in snoop filter create a new element and update the slot
     if (!is_hit) {
-        reqLookupResult.it =
-            cachedLocations.emplace(line_addr, SnoopItem()).first;
+        reqLookupResult.slot = cachedLocations.emplace(line_addr).first;
     }
-    SnoopItem& sf_item = reqLookupResult.it->second;
+    SnoopItem& sf_item = cachedLocations.item(reqLookupResult.slot);
     SnoopMask interested = sf_item.holder | sf_item.requested;
 
     // Store unmodified value of snoop filter item in temp storage in
@@ -159,10 +252,10 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 void
 SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 {
-    if (reqLookupResult.it != cachedLocations.end()) {
+    if (reqLookupResult.slot != SnoopFilterCache::NoSlot) {
         // since we rely on the caller, do a basic check to ensure
         // that finishRequest is being called following lookupRequest
-        assert(reqLookupResult.it->first == \
+        assert(cachedLocations.key(reqLookupResult.slot) == \
                 (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : \
                  (addr & ~(Addr(linesize - 1)))));
         if (will_retry) {
@@ -170,13 +263,14 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
             // Undo any changes made in lookupRequest to the snoop filter
             // entry if the request will come again. retryItem holds
             // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
+            cachedLocations.item(reqLookupResult.slot) = retry_item;
 
             DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
                     __func__,  retry_item.requested, retry_item.holder);
         }
 
-        eraseIfNullEntry(reqLookupResult.it);
+        eraseIfNullEntry(reqLookupResult.slot);
+        reqLookupResult.slot = SnoopFilterCache::NoSlot;
     }
 }
 
@@ -191,8 +285,8 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = (sf_it != cachedLocations.end());
+    auto sf_slot = cachedLocations.find(line_addr);
+    bool is_hit = (sf_slot != SnoopFilterCache::NoSlot);
 
     panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
              "snoop filter exceeded capacity of %d cache blocks\n",
@@ -204,7 +298,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (!is_hit)
         return snoopDown(lookupLatency);
 
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = cachedLocations.item(sf_slot);
 
     SnoopMask interested = (sf_item.holder | sf_item.requested);
 
@@ -234,7 +328,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
         sf_item.holder = 0;
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_slot);
     }
 
     return snoopSelected(maskToPortList(interested), lookupLatency);
@@ -264,7 +358,13 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem& sf_item = cachedLocations[line_addr];
+    auto sf_slot = cachedLocations.find(line_addr);
+
+    // The source should have the line
+    panic_if(sf_slot == SnoopFilterCache::NoSlot,
+             "SF has no entry for the line\n");
+
+    SnoopItem& sf_item = cachedLocations.item(sf_slot);
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -311,8 +411,8 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = sf_it != cachedLocations.end();
+    auto sf_slot = cachedLocations.find(line_addr);
+    bool is_hit = sf_slot != SnoopFilterCache::NoSlot;
 
     // Nothing to do if it is not a hit
     if (!is_hit)
@@ -322,7 +422,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     // Modified state, and we know that there are no other copies, or
     // they will all be invalidated imminently
     if (!cpkt->hasSharers()) {
-        SnoopItem& sf_item = sf_it->second;
+        SnoopItem& sf_item = cachedLocations.item(sf_slot);
 
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
@@ -330,7 +430,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
 
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_slot);
     }
 }
 
@@ -353,12 +453,12 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    if (sf_it == cachedLocations.end())
+    auto sf_slot = cachedLocations.find(line_addr);
+    if (sf_slot == SnoopFilterCache::NoSlot)
         return;
 
     SnoopMask response_mask = portToMask(cpu_side_port);
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = cachedLocations.item(sf_slot);
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -377,7 +477,7 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
         if (cpkt->isInvalidate()) {
             sf_item.holder &= ~response_mask;
         }
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_slot);
     } else {
         // Any other response implies that a cache above will have the
         // block.
@@ -44,8 +44,8 @@
 #define __MEM_SNOOP_FILTER_HH__
 
 #include <bitset>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mem/packet.hh"
 #include "mem/port.hh"
@@ -96,7 +96,9 @@ class SnoopFilter : public SimObject
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
     SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
+        SimObject(p),
+        cachedLocations(p.max_capacity / p.system->cacheLineSize()),
+        reqLookupResult(SnoopFilterCache::NoSlot),
         linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
         maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
         stats(this)
@@ -213,17 +215,98 @@ class SnoopFilter : public SimObject
     /**
     * Per cache line item tracking a bitmask of ResponsePorts who have an
     * outstanding request to this line (requested) or already share a
-    * cache line with this address (holder).
+    * cache line with this address (holder). The two masks fill one cache
+    * line, so they are combined with whole-word operations.
     */
-    struct SnoopItem
+    struct alignas(2 * sizeof(SnoopMask)) SnoopItem
     {
         SnoopMask requested;
         SnoopMask holder;
     };
+
     /**
-     * HashMap of SnoopItems indexed by line address
+     * Hash table of SnoopItems indexed by line address. It uses open
+     * addressing with linear probing, and erased entries are left as
+     * tombstones until the table is rebuilt. The addresses are kept
+     * apart from the items so that probing only touches the former. The
+     * table grows by doubling until it fits the capacity of the snoop
+     * filter at half occupancy. From then on, it mostly rebuilds to drop
+     * the tombstones, and only grows if the entries alone fill it.
      */
-    typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
+    class SnoopFilterCache
+    {
+      public:
+        /** The position of an entry in the table */
+        typedef size_t Slot;
+
+        static constexpr Slot NoSlot = -1;
+
+        /**
+         * @param max_entries The number of entries the table is sized
+         * for.
+         */
+        SnoopFilterCache(size_t max_entries);
+
+        /**
+         * @param line_addr The line address to look up.
+         * @return The slot of the line, or NoSlot if not present.
+         */
+        Slot find(Addr line_addr) const;
+
+        /**
+         * Find a line, or insert an empty item for it if not present.
+         * Inserting may move the other entries.
+         *
+         * @param line_addr The line address.
+         * @return The slot of the line, and whether it was inserted.
+         */
+        std::pair<Slot, bool> emplace(Addr line_addr);
+
+        /**
+         * Erase the entry in a slot. The other entries do not move.
+         *
+         * @param slot The slot of the entry.
+         */
+        void erase(Slot slot);
+
+        Addr key(Slot slot) const { return keys[slot]; }
+        SnoopItem &item(Slot slot) { return items[slot]; }
+
+        /** @return The number of entries. */
+        size_t size() const { return entries; }
+
+      private:
+        /**
+         * The keys of the slots without an entry. Line addresses have
+         * their bits below the line size clear, apart from the
+         * LineSecure bit, so they never match these.
+         */
+        static constexpr Addr EmptyKey = MaxAddr;
+        static constexpr Addr ErasedKey = MaxAddr - 1;
+
+        /** @return The first slot to probe for a line. */
+        Slot
+        home(Addr line_addr) const
+        {
+            // Fibonacci hashing, as the low bits of line addresses
+            // carry little information
+            return (line_addr * 0x9e3779b97f4a7c15ULL) >> shift;
+        }
+
+        /** Rebuild the table, with the given number of slots. */
+        void rebuild(size_t num_slots);
+
+        std::vector<Addr> keys;
+        std::vector<SnoopItem> items;
+
+        /** The number of slots that fit the capacity at half occupancy */
+        size_t maxSlots;
+        /** The shift giving the home slot from the line address hash */
+        unsigned shift;
+
+        size_t entries = 0;
+        size_t tombstones = 0;
+    };
 
     /**
      * Simple factory methods for standard return values.
@@ -261,7 +344,7 @@ class SnoopFilter : public SimObject
     /**
      * Removes snoop filter items which have no requestors and no holders.
      */
-    void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
+    void eraseIfNullEntry(SnoopFilterCache::Slot sf_slot);
 
     /** Simple hash set of cached addresses. */
     SnoopFilterCache cachedLocations;
@@ -274,8 +357,8 @@ class SnoopFilter : public SimObject
      */
     struct ReqLookupResult
     {
-        /** Iterator used to store the result from lookupRequest. */
-        SnoopFilterCache::iterator it;
+        /** Slot used to store the result from lookupRequest. */
+        SnoopFilterCache::Slot slot;
 
         /**
          * Variable to temporarily store value of snoopfilter entry
@@ -285,13 +368,14 @@ class SnoopFilter : public SimObject
         SnoopItem retryItem;
 
         /**
-         * The constructor must be informed of the internal cache's end
-         * iterator, so do not allow the compiler to implictly define it.
+         * The constructor must be informed of the internal cache's
+         * invalid slot, so do not allow the compiler to implictly define
+         * it.
          *
-         * @param end_it Iterator to the end of the internal cache.
+         * @param no_slot The invalid slot of the internal cache.
          */
-        ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0}
+        ReqLookupResult(SnoopFilterCache::Slot no_slot)
+            : slot(no_slot), retryItem{0, 0}
         {
         }
         ReqLookupResult() = delete;
@@ -345,9 +429,18 @@ inline SnoopFilter::SnoopList
 SnoopFilter::maskToPortList(SnoopMask port_mask) const
 {
     SnoopList res;
-    for (const auto& p : cpuSidePorts)
-        if ((port_mask & portToMask(*p)).any())
-            res.push_back(p);
+    // Most lookups find no other holder, avoid walking all the ports
+    if (port_mask.none())
+        return res;
+
+    // Snooping port i in cpuSidePorts owns bit i of the mask
+    size_t remaining = port_mask.count();
+    for (size_t i = 0; remaining && i < cpuSidePorts.size(); ++i) {
+        if (port_mask[i]) {
+            res.push_back(cpuSidePorts[i]);
+            --remaining;
+        }
+    }
     return res;
 }
 
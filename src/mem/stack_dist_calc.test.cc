@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "mem/stack_dist_calc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A naive stack, the most recently used address at its back. */
+class NaiveStack
+{
+  public:
+    uint64_t
+    access(Addr addr, bool push)
+    {
+        auto it = std::find(stack.rbegin(), stack.rend(), addr);
+        uint64_t dist = StackDistCalc::Infinity;
+        if (it != stack.rend()) {
+            dist = it - stack.rbegin();
+            stack.erase(std::next(it).base());
+        }
+        if (push)
+            stack.push_back(addr);
+        return dist;
+    }
+
+    uint64_t
+    distance(Addr addr) const
+    {
+        auto it = std::find(stack.rbegin(), stack.rend(), addr);
+        return it == stack.rend() ? StackDistCalc::Infinity :
+            it - stack.rbegin();
+    }
+
+  private:
+    std::vector<Addr> stack;
+};
+
+} // anonymous namespace
+
+TEST(StackDistCalcTest, Distances)
+{
+    StackDistCalc calc;
+
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x0).first,
+              StackDistCalc::Infinity);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x40).first,
+              StackDistCalc::Infinity);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x80).first,
+              StackDistCalc::Infinity);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x0).first, 2u);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x0).first, 0u);
+    EXPECT_EQ(calc.calcStackDist(0x40).first, 2u);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x80).first, 1u);
+}
+
+TEST(StackDistCalcTest, Marks)
+{
+    StackDistCalc calc;
+
+    calc.calcStackDistAndUpdate(0x0);
+    calc.calcStackDistAndUpdate(0x40);
+
+    EXPECT_FALSE(calc.calcStackDist(0x0, true).second);
+    EXPECT_TRUE(calc.calcStackDist(0x0).second);
+    EXPECT_FALSE(calc.calcStackDist(0x0).second);
+
+    calc.calcStackDist(0x40, true);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x40, false),
+              std::make_pair(uint64_t(0), true));
+    EXPECT_EQ(calc.calcStackDist(0x40).first, StackDistCalc::Infinity);
+    EXPECT_EQ(calc.calcStackDist(0x0).first, 0u);
+}
+
+/**
+ * A random trace that renumbers the timestamps many times, with and
+ * without growing them, against the naive stack.
+ */
+TEST(StackDistCalcTest, MatchesNaiveStack)
+{
+    StackDistCalc calc;
+    NaiveStack naive;
+    std::mt19937_64 rng(1);
+
+    for (int i = 0; i < 50000; ++i) {
+        // Vary the working set so the stack both grows and shrinks
+        const Addr lines = i < 20000 ? 3000 : 200;
+        const Addr addr = (rng() % lines) * 64;
+        switch (rng() % 8) {
+          case 0:
+            ASSERT_EQ(calc.calcStackDistAndUpdate(addr, false).first,
+                      naive.access(addr, false));
+            break;
+          case 1:
+            ASSERT_EQ(calc.calcStackDist(addr).first, naive.distance(addr));
+            break;
+          default:
+            ASSERT_EQ(calc.calcStackDistAndUpdate(addr).first,
+                      naive.access(addr, true));
+        }
+    }
+}
@@ -0,0 +1,619 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/tiering_addr_mapper.hh"
+
+#include <algorithm>
+#include <limits>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/MemTiering.hh"
+#include "sim/serialize.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+TieringAddrMapper::RadixTable::RadixTable(uint64_t num_entries)
+    : leaves(divCeil(num_entries, leafEntries))
+{
+    fatal_if(num_entries >= std::numeric_limits<uint32_t>::max(),
+             "Radix table with %d entries is too large\n", num_entries);
+}
+
+uint64_t
+TieringAddrMapper::RadixTable::lookup(uint64_t idx) const
+{
+    const auto &leaf = leaves[idx >> leafBits];
+    if (!leaf)
+        return idx;
+    uint32_t val = (*leaf)[idx & (leafEntries - 1)];
+    return val ? val - 1 : idx;
+}
+
+void
+TieringAddrMapper::RadixTable::set(uint64_t idx, uint64_t val)
+{
+    auto &leaf = leaves[idx >> leafBits];
+    if (!leaf) {
+        if (val == idx)
+            return;
+        leaf.reset(new Leaf());
+        leaf->fill(0);
+    }
+    (*leaf)[idx & (leafEntries - 1)] = val == idx ? 0 : val + 1;
+}
+
+void
+TieringAddrMapper::RadixTable::clear()
+{
+    for (auto &leaf : leaves)
+        leaf.reset();
+}
+
+void
+TieringAddrMapper::RadixTable::mappedEntries(
+    std::vector<uint64_t> &idxs, std::vector<uint64_t> &vals) const
+{
+    for (uint64_t i = 0; i < leaves.size(); i++) {
+        if (!leaves[i])
+            continue;
+        for (uint64_t j = 0; j < leafEntries; j++) {
+            uint32_t val = (*leaves[i])[j];
+            if (val) {
+                idxs.push_back((i << leafBits) | j);
+                vals.push_back(val - 1);
+            }
+        }
+    }
+}
+
+TieringAddrMapper::TieringAddrMapper(const TieringAddrMapperParams &p)
+    : AddrMapper(p),
+      system(p.system),
+      requestorId(p.system->getRequestorId(this)),
+      fastRange(p.fast_range),
+      slowRange(p.slow_range),
+      pageSize(p.page_size),
+      pageShift(floorLog2(p.page_size)),
+      numFastPages(p.fast_range.size() / p.page_size),
+      numSlowPages(p.slow_range.size() / p.page_size),
+      samplePeriod(p.sample_period),
+      epoch(p.epoch),
+      hotThreshold(p.hot_threshold),
+      maxMigrations(p.max_migrations),
+      osPolicy(p.policy == enums::os),
+      osOverhead(p.os_overhead),
+      migrationWindow(p.migration_window),
+      lineSize(0), linesPerPage(0),
+      pageToFrame(numFastPages + numSlowPages),
+      frameToPage(numFastPages + numSlowPages),
+      sampleCount(0), clockHand(0),
+      migState(MigrationState::Idle),
+      migrationStart(0), nextLine(0), outstanding(0),
+      pendingPkt(nullptr), memSideBlocked(false), cpuSideRetry(false),
+      epochEvent([this]{ processEpoch(); }, name() + ".epochEvent"),
+      overheadEvent([this]{ processOverhead(); },
+                    name() + ".overheadEvent"),
+      stats(*this)
+{
+    fatal_if(!isPowerOf2(pageSize), "Page size must be a power of 2\n");
+    fatal_if(fastRange.interleaved() || slowRange.interleaved(),
+             "%s does not support interleaved tiers\n", name());
+    fatal_if(fastRange.intersects(slowRange),
+             "%s: the fast and slow tier overlap\n", name());
+    fatal_if(fastRange.start() % pageSize || fastRange.size() % pageSize ||
+             slowRange.start() % pageSize || slowRange.size() % pageSize,
+             "%s: tiers must be page aligned\n", name());
+    fatal_if(!numFastPages || !numSlowPages,
+             "%s: both tiers must hold at least one page\n", name());
+    fatal_if(!samplePeriod || !migrationWindow,
+             "%s: sample period and migration window must be non-zero\n",
+             name());
+}
+
+void
+TieringAddrMapper::init()
+{
+    AddrMapper::init();
+
+    lineSize = system->cacheLineSize();
+    fatal_if(pageSize % lineSize,
+             "%s: page size must be a multiple of the line size\n", name());
+    linesPerPage = pageSize / lineSize;
+
+    cpuSidePort.sendRangeChange();
+}
+
+void
+TieringAddrMapper::startup()
+{
+    schedule(epochEvent, curTick() + epoch);
+}
+
+AddrRangeList
+TieringAddrMapper::getAddrRanges() const
+{
+    return AddrRangeList({fastRange, slowRange});
+}
+
+bool
+TieringAddrMapper::pageOf(Addr addr, uint64_t &page) const
+{
+    if (fastRange.contains(addr)) {
+        page = (addr - fastRange.start()) >> pageShift;
+        return true;
+    } else if (slowRange.contains(addr)) {
+        page = numFastPages + ((addr - slowRange.start()) >> pageShift);
+        return true;
+    }
+    return false;
+}
+
+Addr
+TieringAddrMapper::frameAddr(uint64_t frame) const
+{
+    if (isFast(frame))
+        return fastRange.start() + (frame << pageShift);
+    return slowRange.start() + ((frame - numFastPages) << pageShift);
+}
+
+Addr
+TieringAddrMapper::remapAddr(Addr addr) const
+{
+    uint64_t page;
+    if (!pageOf(addr, page))
+        return addr;
+    return frameAddr(pageToFrame.lookup(page)) + (addr & (pageSize - 1));
+}
+
+void
+TieringAddrMapper::recordAccess(Addr addr)
+{
+    uint64_t page;
+    if (!pageOf(addr, page))
+        return;
+
+    if (isFast(pageToFrame.lookup(page)))
+        stats.fastAccesses++;
+    else
+        stats.slowAccesses++;
+
+    if (++sampleCount >= samplePeriod) {
+        sampleCount = 0;
+        sampledCounts[page]++;
+        stats.sampledAccesses++;
+    }
+}
+
+bool
+TieringAddrMapper::isBlocked(Addr addr) const
+{
+    switch (migState) {
+      case MigrationState::Idle:
+        return false;
+      case MigrationState::Flipping:
+        break;
+      default:
+        if (!osPolicy)
+            return false;
+        break;
+    }
+
+    uint64_t page;
+    return pageOf(addr, page) &&
+        (page == active.hotPage || page == active.coldPage);
+}
+
+Tick
+TieringAddrMapper::recvAtomic(PacketPtr pkt)
+{
+    recordAccess(pkt->getAddr());
+    return AddrMapper::recvAtomic(pkt);
+}
+
+bool
+TieringAddrMapper::recvTimingReq(PacketPtr pkt)
+{
+    Addr orig_addr = pkt->getAddr();
+
+    if (memSideBlocked || isBlocked(orig_addr)) {
+        if (!memSideBlocked)
+            stats.blockedReqs++;
+        cpuSideRetry = true;
+        return false;
+    }
+
+    uint64_t frame;
+    bool track = pkt->needsResponse() && !pkt->cacheResponding() &&
+        pageOf(remapAddr(orig_addr), frame);
+
+    if (!AddrMapper::recvTimingReq(pkt)) {
+        memSideBlocked = true;
+        cpuSideRetry = true;
+        return false;
+    }
+
+    if (track)
+        inflight[frame]++;
+    recordAccess(orig_addr);
+    return true;
+}
+
+bool
+TieringAddrMapper::recvTimingResp(PacketPtr pkt)
+{
+    if (pkt->req->requestorId() == requestorId) {
+        delete pkt;
+        assert(outstanding > 0);
+        outstanding--;
+        migrationProgress();
+        return true;
+    }
+
+    uint64_t frame;
+    bool tracked = pageOf(pkt->getAddr(), frame);
+
+    if (!AddrMapper::recvTimingResp(pkt))
+        return false;
+
+    if (tracked) {
+        auto it = inflight.find(frame);
+        assert(it != inflight.end());
+        if (--it->second == 0)
+            inflight.erase(it);
+        if (migState == MigrationState::Flipping)
+            tryFlip();
+    }
+    return true;
+}
+
+void
+TieringAddrMapper::recvReqRetry()
+{
+    memSideBlocked = false;
+    issueMigrationPackets();
+    retryUpstream();
+}
+
+void
+TieringAddrMapper::retryUpstream()
+{
+    if (cpuSideRetry && !memSideBlocked) {
+        cpuSideRetry = false;
+        cpuSidePort.sendRetryReq();
+    }
+}
+
+void
+TieringAddrMapper::processEpoch()
+{
+    schedule(epochEvent, curTick() + epoch);
+
+    if (drainState() != DrainState::Running) {
+        sampledCounts.clear();
+        return;
+    }
+
+    if (migState != MigrationState::Idle || !migrationQueue.empty()) {
+        // Still busy with the previous epoch, keep sampling
+        stats.skippedEpochs++;
+        return;
+    }
+
+    std::vector<std::pair<uint32_t, uint64_t>> hot;
+    for (const auto &[page, count] : sampledCounts) {
+        if (count >= hotThreshold && !isFast(pageToFrame.lookup(page)))
+            hot.emplace_back(count, page);
+    }
+
+    size_t num = std::min<size_t>(hot.size(), maxMigrations);
+    std::partial_sort(hot.begin(), hot.begin() + num, hot.end(),
+                      std::greater<>());
+
+    // Victims are fast-tier pages not sampled during the epoch, found
+    // by sweeping a clock hand at most once around the fast tier
+    uint64_t scanned = 0;
+    for (size_t i = 0; i < num && scanned < numFastPages; i++) {
+        while (scanned < numFastPages) {
+            uint64_t frame = clockHand;
+            clockHand = (clockHand + 1) % numFastPages;
+            scanned++;
+
+            uint64_t owner = frameToPage.lookup(frame);
+            if (sampledCounts.count(owner))
+                continue;
+
+            uint64_t page = hot[i].second;
+            DPRINTF(MemTiering, "Epoch: migrate page %#x (%d samples) "
+                    "with page %#x\n", page, hot[i].first, owner);
+            migrationQueue.push_back({page, owner,
+                                      pageToFrame.lookup(page), frame});
+            // Do not pick the same victim twice
+            sampledCounts[owner] = 0;
+            break;
+        }
+    }
+
+    sampledCounts.clear();
+
+    if (system->isAtomicMode()) {
+        while (!migrationQueue.empty()) {
+            active = migrationQueue.front();
+            migrationQueue.pop_front();
+            swapPages();
+            stats.migrations++;
+            stats.migratedBytes += 2 * pageSize;
+        }
+    } else {
+        startMigration();
+    }
+}
+
+void
+TieringAddrMapper::startMigration()
+{
+    assert(migState == MigrationState::Idle);
+
+    if (migrationQueue.empty() ||
+        drainState() == DrainState::Draining) {
+        migrationQueue.clear();
+        if (drainState() == DrainState::Draining) {
+            DPRINTF(Drain, "TieringAddrMapper done draining\n");
+            signalDrainDone();
+        }
+        return;
+    }
+
+    active = migrationQueue.front();
+    migrationQueue.pop_front();
+    migrationStart = curTick();
+    nextLine = 0;
+
+    DPRINTF(MemTiering, "Start migrating page %#x (frame %#x) and page "
+            "%#x (frame %#x)\n", active.hotPage, active.slowFrame,
+            active.coldPage, active.fastFrame);
+
+    if (osPolicy) {
+        migState = MigrationState::Overhead;
+        schedule(overheadEvent, curTick() + osOverhead);
+    } else {
+        migState = MigrationState::Reading;
+        issueMigrationPackets();
+    }
+}
+
+void
+TieringAddrMapper::processOverhead()
+{
+    assert(migState == MigrationState::Overhead);
+    migState = MigrationState::Reading;
+    issueMigrationPackets();
+}
+
+void
+TieringAddrMapper::issueMigrationPackets()
+{
+    while (!memSideBlocked) {
+        if (!pendingPkt) {
+            if ((migState != MigrationState::Reading &&
+                 migState != MigrationState::Writing) ||
+                outstanding >= migrationWindow ||
+                nextLine >= 2 * linesPerPage) {
+                return;
+            }
+
+            // The first half of the lines belongs to the slow frame,
+            // the second half to the fast frame
+            uint64_t frame = nextLine < linesPerPage ?
+                active.slowFrame : active.fastFrame;
+            Addr addr = frameAddr(frame) +
+                (nextLine % linesPerPage) * lineSize;
+            nextLine++;
+
+            RequestPtr req = Request::make(
+                addr, lineSize, 0, requestorId);
+            if (migState == MigrationState::Reading) {
+                pendingPkt = new Packet(req, MemCmd::ReadReq);
+            } else {
+                pendingPkt = new Packet(req, MemCmd::WriteReq);
+            }
+            pendingPkt->allocate();
+            outstanding++;
+        }
+
+        if (pendingPkt->isWrite()) {
+            // Write what memory holds right now, so that the copy can
+            // never overwrite data written since the swap
+            functionalAccess(pendingPkt->getAddr(), lineSize,
+                             pendingPkt->getPtr<uint8_t>(), false);
+        }
+
+        if (!memSidePort.sendTimingReq(pendingPkt)) {
+            memSideBlocked = true;
+            return;
+        }
+        pendingPkt = nullptr;
+    }
+}
+
+void
+TieringAddrMapper::migrationProgress()
+{
+    if (nextLine < 2 * linesPerPage || outstanding > 0) {
+        issueMigrationPackets();
+        return;
+    }
+
+    if (migState == MigrationState::Reading) {
+        migState = MigrationState::Flipping;
+        tryFlip();
+    } else if (migState == MigrationState::Writing) {
+        finishMigration();
+    }
+}
+
+void
+TieringAddrMapper::tryFlip()
+{
+    assert(migState == MigrationState::Flipping);
+
+    if (inflight.count(active.slowFrame) || inflight.count(active.fastFrame))
+        return;
+
+    swapPages();
+
+    migState = MigrationState::Writing;
+    nextLine = 0;
+    issueMigrationPackets();
+    if (!osPolicy)
+        retryUpstream();
+}
+
+void
+TieringAddrMapper::swapPages()
+{
+    std::vector<uint8_t> slow_data(pageSize);
+    std::vector<uint8_t> fast_data(pageSize);
+    Addr slow_addr = frameAddr(active.slowFrame);
+    Addr fast_addr = frameAddr(active.fastFrame);
+
+    functionalAccess(slow_addr, pageSize, slow_data.data(), false);
+    functionalAccess(fast_addr, pageSize, fast_data.data(), false);
+    functionalAccess(slow_addr, pageSize, fast_data.data(), true);
+    functionalAccess(fast_addr, pageSize, slow_data.data(), true);
+
+    pageToFrame.set(active.hotPage, active.fastFrame);
+    pageToFrame.set(active.coldPage, active.slowFrame);
+    frameToPage.set(active.fastFrame, active.hotPage);
+    frameToPage.set(active.slowFrame, active.coldPage);
+}
+
+void
+TieringAddrMapper::finishMigration()
+{
+    DPRINTF(MemTiering, "Finished migrating page %#x and page %#x\n",
+            active.hotPage, active.coldPage);
+
+    stats.migrations++;
+    stats.migratedBytes += 2 * pageSize;
+    stats.totMigrationLatency += curTick() - migrationStart;
+
+    migState = MigrationState::Idle;
+    retryUpstream();
+    startMigration();
+}
+
+void
+TieringAddrMapper::functionalAccess(Addr addr, unsigned size,
+                                    uint8_t *data, bool write)
+{
+    RequestPtr req = Request::make(addr, size, 0, requestorId);
+    Packet pkt(req, write ? MemCmd::WriteReq : MemCmd::ReadReq);
+    pkt.dataStatic(data);
+    memSidePort.sendFunctional(&pkt);
+}
+
+DrainState
+TieringAddrMapper::drain()
+{
+    migrationQueue.clear();
+    if (migState != MigrationState::Idle) {
+        DPRINTF(Drain, "TieringAddrMapper not drained\n");
+        return DrainState::Draining;
+    }
+    return DrainState::Drained;
+}
+
+void
+TieringAddrMapper::serialize(CheckpointOut &cp) const
+{
+    std::vector<uint64_t> pages;
+    std::vector<uint64_t> frames;
+    pageToFrame.mappedEntries(pages, frames);
+
+    SERIALIZE_CONTAINER(pages);
+    SERIALIZE_CONTAINER(frames);
+    SERIALIZE_SCALAR(clockHand);
+}
+
+void
+TieringAddrMapper::unserialize(CheckpointIn &cp)
+{
+    std::vector<uint64_t> pages;
+    std::vector<uint64_t> frames;
+
+    UNSERIALIZE_CONTAINER(pages);
+    UNSERIALIZE_CONTAINER(frames);
+    UNSERIALIZE_SCALAR(clockHand);
+
+    fatal_if(pages.size() != frames.size(),
+             "%s: inconsistent page mapping in checkpoint\n", name());
+
+    pageToFrame.clear();
+    frameToPage.clear();
+    for (size_t i = 0; i < pages.size(); i++) {
+        pageToFrame.set(pages[i], frames[i]);
+        frameToPage.set(frames[i], pages[i]);
+    }
+}
+
+TieringAddrMapper::TieringStats::TieringStats(TieringAddrMapper &m)
+    : statistics::Group(&m),
+      ADD_STAT(fastAccesses, statistics::units::Count::get(),
+               "Number of accesses served by the fast tier"),
+      ADD_STAT(slowAccesses, statistics::units::Count::get(),
+               "Number of accesses served by the slow tier"),
+      ADD_STAT(fastAccessRatio, statistics::units::Ratio::get(),
+               "Fraction of accesses served by the fast tier"),
+      ADD_STAT(sampledAccesses, statistics::units::Count::get(),
+               "Number of accesses counted towards page hotness"),
+      ADD_STAT(migrations, statistics::units::Count::get(),
+               "Number of page pairs swapped between the tiers"),
+      ADD_STAT(migratedBytes, statistics::units::Byte::get(),
+               "Number of bytes moved by migrations"),
+      ADD_STAT(blockedReqs, statistics::units::Count::get(),
+               "Number of requests refused due to a migration"),
+      ADD_STAT(skippedEpochs, statistics::units::Count::get(),
+               "Number of epochs ending with migrations still pending"),
+      ADD_STAT(totMigrationLatency, statistics::units::Tick::get(),
+               "Total time spent migrating pages"),
+      ADD_STAT(avgMigrationLatency, statistics::units::Rate<
+                   statistics::units::Tick, statistics::units::Count>::get(),
+               "Average time to migrate a page pair")
+{
+    fastAccessRatio = fastAccesses / (fastAccesses + slowAccesses);
+    avgMigrationLatency = totMigrationLatency / migrations;
+
+    avgMigrationLatency.precision(2);
+}
+
+} // namespace gem5
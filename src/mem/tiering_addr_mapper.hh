@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_TIERING_ADDR_MAPPER_HH__
+#define __MEM_TIERING_ADDR_MAPPER_HH__
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/addr_mapper.hh"
+#include "mem/request.hh"
+#include "params/TieringAddrMapper.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+class System;
+
+/**
+ * An address mapper that manages a two-tier memory, e.g. HBM in front
+ * of DDR or DDR in front of CXL attached memory. The mapper exposes the
+ * union of the fast and the slow range and translates every page to the
+ * frame currently holding it. Accesses are sampled per page, and at the
+ * end of every epoch the hottest pages residing in the slow tier are
+ * swapped with fast-tier pages that were not touched during the epoch.
+ *
+ * Migrations are carried out one at a time. Both frames are first read
+ * line by line, the data is then swapped and the mapping updated once
+ * all in-flight requests to the two frames have completed, and finally
+ * both frames are written back. The writes carry the data present in
+ * memory when they are sent, so they only add the timing of the copy
+ * without ever overwriting newer data. Under the hardware policy the
+ * pages stay accessible except while the mapping is switched, whereas
+ * the OS policy blocks them for the whole migration plus a software
+ * overhead. In atomic mode migrations complete instantly.
+ */
+class TieringAddrMapper : public AddrMapper
+{
+  public:
+    TieringAddrMapper(const TieringAddrMapperParams &p);
+
+    AddrRangeList getAddrRanges() const override;
+
+    void init() override;
+
+    void startup() override;
+
+    DrainState drain() override;
+
+    void serialize(CheckpointOut &cp) const override;
+
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    /**
+     * Sparse two-level radix table mapping page numbers to page
+     * numbers. Leaves are only allocated when one of their entries is
+     * written, and entries that were never written map a page onto
+     * itself, so the table only costs memory for the parts of the
+     * address space that have been migrated.
+     */
+    class RadixTable
+    {
+      public:
+        RadixTable(uint64_t num_entries);
+
+        uint64_t lookup(uint64_t idx) const;
+
+        void set(uint64_t idx, uint64_t val);
+
+        /** Reset all entries to the identity mapping */
+        void clear();
+
+        /** Collect the entries that differ from the identity mapping */
+        void mappedEntries(std::vector<uint64_t> &idxs,
+                           std::vector<uint64_t> &vals) const;
+
+      private:
+        static constexpr unsigned leafBits = 10;
+        static constexpr uint64_t leafEntries = 1ULL << leafBits;
+
+        /** Entries hold the mapped value plus one, zero is identity */
+        using Leaf = std::array<uint32_t, leafEntries>;
+
+        std::vector<std::unique_ptr<Leaf>> leaves;
+    };
+
+    Addr remapAddr(Addr addr) const override;
+
+    Tick recvAtomic(PacketPtr pkt) override;
+
+    bool recvTimingReq(PacketPtr pkt) override;
+
+    bool recvTimingResp(PacketPtr pkt) override;
+
+    void recvReqRetry() override;
+
+    void
+    recvRangeChange() override
+    {
+        // The tiers are fixed by the parameters, nothing to update
+    }
+
+  private:
+    /**
+     * Page number of an address, with the fast-tier pages numbered
+     * first followed by the slow-tier pages.
+     *
+     * @return false if the address is in neither tier
+     */
+    bool pageOf(Addr addr, uint64_t &page) const;
+
+    /** Start address of a frame, using the same numbering as pages */
+    Addr frameAddr(uint64_t frame) const;
+
+    bool isFast(uint64_t frame) const { return frame < numFastPages; }
+
+    /** Update the tier statistics and the sampled page counters */
+    void recordAccess(Addr addr);
+
+    /** Check if requests to a page currently have to wait */
+    bool isBlocked(Addr addr) const;
+
+    /** Pick the pages to migrate at the end of an epoch */
+    void processEpoch();
+
+    /** Begin the next queued migration, if any */
+    void startMigration();
+
+    /** Called when the OS overhead of the active migration is paid */
+    void processOverhead();
+
+    /** Create and send migration packets within the window */
+    void issueMigrationPackets();
+
+    /** Move a migration on once all of its packets have completed */
+    void migrationProgress();
+
+    /** Switch the mapping once no request to the frames is in flight */
+    void tryFlip();
+
+    /** Swap the data and the mapping of the active migration */
+    void swapPages();
+
+    void finishMigration();
+
+    /** Let the CPU side try again if we refused a request */
+    void retryUpstream();
+
+    void functionalAccess(Addr addr, unsigned size, uint8_t *data,
+                          bool write);
+
+    System *system;
+
+    const RequestorID requestorId;
+
+    const AddrRange fastRange;
+    const AddrRange slowRange;
+
+    const Addr pageSize;
+    const unsigned pageShift;
+    const uint64_t numFastPages;
+    const uint64_t numSlowPages;
+
+    const unsigned samplePeriod;
+    const Tick epoch;
+    const unsigned hotThreshold;
+    const unsigned maxMigrations;
+    const bool osPolicy;
+    const Tick osOverhead;
+    const unsigned migrationWindow;
+
+    /** Cache line size, the granularity of the migration traffic */
+    unsigned lineSize;
+
+    /** Number of lines moved per page, in each direction */
+    unsigned linesPerPage;
+
+    /** Frame currently holding each page */
+    RadixTable pageToFrame;
+
+    /** Page currently held by each frame */
+    RadixTable frameToPage;
+
+    /** Accesses seen since the last sample */
+    unsigned sampleCount;
+
+    /** Sampled accesses per page during the current epoch */
+    std::unordered_map<uint64_t, uint32_t> sampledCounts;
+
+    /** Fast-tier frame from which the next victim search starts */
+    uint64_t clockHand;
+
+    /** Requests awaiting a response, per frame */
+    std::unordered_map<uint64_t, unsigned> inflight;
+
+    struct Migration
+    {
+        /** Hot page moving from the slow into the fast tier */
+        uint64_t hotPage;
+        /** Cold page moving from the fast into the slow tier */
+        uint64_t coldPage;
+        uint64_t slowFrame;
+        uint64_t fastFrame;
+    };
+
+    std::deque<Migration> migrationQueue;
+
+    enum class MigrationState
+    {
+        Idle,
+        Overhead,
+        Reading,
+        Flipping,
+        Writing
+    };
+
+    MigrationState migState;
+
+    Migration active;
+
+    Tick migrationStart;
+
+    /** Next line of the active migration to create a packet for */
+    unsigned nextLine;
+
+    /** Migration packets created but not yet responded to */
+    unsigned outstanding;
+
+    /** Migration packet refused by the memory side */
+    PacketPtr pendingPkt;
+
+    /** Waiting for a retry from the memory side */
+    bool memSideBlocked;
+
+    /** We refused a request from the CPU side and owe it a retry */
+    bool cpuSideRetry;
+
+    EventFunctionWrapper epochEvent;
+
+    EventFunctionWrapper overheadEvent;
+
+    struct TieringStats : public statistics::Group
+    {
+        TieringStats(TieringAddrMapper &m);
+
+        statistics::Scalar fastAccesses;
+        statistics::Scalar slowAccesses;
+        statistics::Formula fastAccessRatio;
+        statistics::Scalar sampledAccesses;
+        statistics::Scalar migrations;
+        statistics::Scalar migratedBytes;
+        statistics::Scalar blockedReqs;
+        statistics::Scalar skippedEpochs;
+        statistics::Scalar totMigrationLatency;
+        statistics::Formula avgMigrationLatency;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif //__MEM_TIERING_ADDR_MAPPER_HH__
@@ -154,12 +154,12 @@ TokenManager::getMaxTokenCount() const
 void
 TokenManager::recvTokens(int num_tokens)
 {
-    availableTokens += num_tokens;
+    const int available = availableTokens += num_tokens;
 
     DPRINTF(TokenPort, "Received %d tokens, have %d\n",
-                       num_tokens, availableTokens);
+                       num_tokens, available);
 
-    panic_if(availableTokens > maxTokens,
+    panic_if(available > maxTokens,
              "More tokens available than the maximum after recvTokens!\n");
 }
 
@@ -175,10 +175,10 @@ TokenManager::acquireTokens(int num_tokens)
     panic_if(!haveTokens(num_tokens),
              "Attempted to acquire more tokens than are available!\n");
 
-    availableTokens -= num_tokens;
+    const int available = availableTokens -= num_tokens;
 
     DPRINTF(TokenPort, "Acquired %d tokens, have %d\n",
-                       num_tokens, availableTokens);
+                       num_tokens, available);
 }
 
 } // namespace gem5
@@ -45,10 +45,14 @@
 
 #include "mem/translating_port_proxy.hh"
 
+#include <cstring>
+
 #include "arch/generic/mmu.hh"
 #include "base/chunk_generator.hh"
 #include "cpu/base.hh"
+#include "cpu/fetch_backdoor.hh"
 #include "cpu/thread_context.hh"
+#include "mem/port.hh"
 #include "sim/system.hh"
 
 namespace gem5
@@ -85,14 +89,50 @@ TranslatingPortProxy::tryOnBlob(BaseMMU::Mode mode, TranslationGenPtr gen,
     return true;
 }
 
+uint8_t *
+TranslatingPortProxy::hostAddr(HostBackdoor &host,
+        const TranslationGen::Range &range, bool write) const
+{
+    // Special accesses, e.g. uncacheable ones, go through the memory
+    // system.
+    if (flags || host.refused)
+        return nullptr;
+
+    const AddrRange addr_range = RangeSize(range.paddr, range.size);
+    MemBackdoorPtr &bd = host.backdoor;
+    if (!bd || !addr_range.isSubset(bd->range())) {
+        bd = nullptr;
+        auto *port =
+            dynamic_cast<RequestPort *>(&_tc->getCpuPtr()->getDataPort());
+        if (port) {
+            port->sendMemBackdoorReq(MemBackdoorReq(addr_range,
+                    write ? MemBackdoor::Writeable : MemBackdoor::Readable),
+                bd);
+        }
+        if (!bd || !addr_range.isSubset(bd->range()) || !bd->ptr()) {
+            bd = nullptr;
+            host.refused = true;
+            return nullptr;
+        }
+    }
+
+    if (write ? !bd->writeable() : !bd->readable())
+        return nullptr;
+    return bd->ptr() + (range.paddr - bd->range().start());
+}
+
 bool
 TranslatingPortProxy::tryReadBlob(Addr addr, void *p, int size) const
 {
     constexpr auto mode = BaseMMU::Read;
+    HostBackdoor host;
     return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
             addr, size, _tc, mode, flags),
-        [this, &p](const auto &range) {
-            PortProxy::readBlobPhys(range.paddr, flags, p, range.size);
+        [this, &p, &host](const auto &range) {
+            if (uint8_t *host_addr = hostAddr(host, range, false))
+                std::memcpy(p, host_addr, range.size);
+            else
+                PortProxy::readBlobPhys(range.paddr, flags, p, range.size);
             p = static_cast<uint8_t *>(p) + range.size;
     });
 }
@@ -102,10 +142,16 @@ TranslatingPortProxy::tryWriteBlob(
         Addr addr, const void *p, int size) const
 {
     constexpr auto mode = BaseMMU::Write;
+    HostBackdoor host;
     return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
             addr, size, _tc, mode, flags),
-        [this, &p](const auto &range) {
-            PortProxy::writeBlobPhys(range.paddr, flags, p, range.size);
+        [this, &p, &host](const auto &range) {
+            if (uint8_t *host_addr = hostAddr(host, range, true)) {
+                std::memcpy(host_addr, p, range.size);
+                FetchBackdoor::written(range.paddr, range.size);
+            } else {
+                PortProxy::writeBlobPhys(range.paddr, flags, p, range.size);
+            }
             p = static_cast<const uint8_t *>(p) + range.size;
     });
 }
@@ -114,10 +160,16 @@ bool
 TranslatingPortProxy::tryMemsetBlob(Addr addr, uint8_t v, int size) const
 {
     constexpr auto mode = BaseMMU::Write;
+    HostBackdoor host;
     return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
             addr, size, _tc, mode, flags),
-        [this, v](const auto &range) {
-            PortProxy::memsetBlobPhys(range.paddr, flags, v, range.size);
+        [this, v, &host](const auto &range) {
+            if (uint8_t *host_addr = hostAddr(host, range, true)) {
+                std::memset(host_addr, v, range.size);
+                FetchBackdoor::written(range.paddr, range.size);
+            } else {
+                PortProxy::memsetBlobPhys(range.paddr, flags, v, range.size);
+            }
     });
 }
 
@@ -44,6 +44,7 @@
 #include <functional>
 
 #include "arch/generic/mmu.hh"
+#include "mem/backdoor.hh"
 #include "mem/port_proxy.hh"
 
 namespace gem5
@@ -72,6 +73,27 @@ class TranslatingPortProxy : public PortProxy
     bool tryOnBlob(BaseMMU::Mode mode, TranslationGenPtr gen,
             std::function<void(const TranslationGen::Range &)> func) const;
 
+    /**
+     * The back door to host memory an access is using, if the memory
+     * system gave one out. Caches don't, so the back door is only there
+     * when nothing between the CPU and the memory may hold data.
+     */
+    struct HostBackdoor
+    {
+        MemBackdoorPtr backdoor = nullptr;
+        bool refused = false;
+    };
+
+    /**
+     * Get the host address of a translated range through a back door,
+     * reusing the last one when it also covers the range.
+     *
+     * @return The host address, or nullptr if the range has to be
+     * accessed with packets.
+     */
+    uint8_t *hostAddr(HostBackdoor &host, const TranslationGen::Range &range,
+            bool write) const;
+
   public:
     TranslatingPortProxy(ThreadContext *tc, Request::Flags _flags=0);
 
@@ -437,6 +437,10 @@ BaseXBar::recvRangeChange(PortID mem_side_port_id)
     // modules, go ahead and tell our connected memory-side-port modules in
     // turn, this effectively assumes a tree structure of the system
     if (gotAllAddrRanges) {
+        // the port map is complete until the next range change, so
+        // freeze it to make the lookups cheaper
+        portMap.freeze();
+
         DPRINTF(AddrRanges, "Aggregating address ranges\n");
         xbarRanges.clear();
 
@@ -52,6 +52,7 @@
 #include "base/addr_range_map.hh"
 #include "base/types.hh"
 #include "mem/qport.hh"
+#include "mem/request.hh"
 #include "params/BaseXBar.hh"
 #include "sim/clocked_object.hh"
 #include "sim/stats.hh"
@@ -322,10 +323,61 @@ class BaseXBar : public ClockedObject
      * Remember where request packets came from so that we can route
      * responses to the appropriate port. This relies on the fact that
      * the underlying Request pointer inside the Packet stays
-     * constant.
+     * constant. The route is recorded in the Request itself, and only
+     * kept here if the Request has no room left for another route.
      */
     std::unordered_map<RequestPtr, PortID> routeTo;
 
+    /** The number of routes recorded, for sanity checking */
+    size_t numRoutes = 0;
+
+    /**
+     * Record where to route the response to a request.
+     *
+     * @param req The request.
+     * @param port_id The port to route the response to.
+     */
+    void
+    setRoute(const RequestPtr &req, PortID port_id)
+    {
+        assert(findRoute(req) == InvalidPortID);
+        if (!req->setRoute(this, port_id))
+            routeTo[req] = port_id;
+        numRoutes++;
+    }
+
+    /**
+     * @param req The request.
+     * @return The port to route the response to, or InvalidPortID if
+     * no route was recorded.
+     */
+    PortID
+    findRoute(const RequestPtr &req) const
+    {
+        PortID port_id = req->getRoute(this);
+        if (port_id == InvalidPortID && !routeTo.empty()) {
+            auto route_lookup = routeTo.find(req);
+            if (route_lookup != routeTo.end())
+                port_id = route_lookup->second;
+        }
+        return port_id;
+    }
+
+    /**
+     * Remove the route recorded for a request.
+     *
+     * @param req The request.
+     */
+    void
+    clearRoute(const RequestPtr &req)
+    {
+        if (!req->clearRoute(this)) {
+            [[maybe_unused]] size_t erased = routeTo.erase(req);
+            assert(erased);
+        }
+        numRoutes--;
+    }
+
     /** all contigous ranges seen by this crossbar */
     AddrRangeList xbarRanges;
 
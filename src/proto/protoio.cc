@@ -37,16 +37,158 @@
 
 #include "proto/protoio.hh"
 
+#include <pthread.h>
+
+#include <set>
 #include <string>
 
 #include "base/logging.hh"
 
 using namespace google::protobuf;
 
+namespace
+{
+
+/// The streams with a helper thread, running or stopped for a fork
+std::set<ProtoStream*> helperStreams;
+std::mutex helperStreamsMutex;
+std::once_flag forkHandlersFlag;
+
+} // anonymous namespace
+
+ProtoStream::Chunk *
+ProtoStream::ChunkRing::producerChunk()
+{
+    auto ready = [this] {
+        return stop.load() || tail.load() - head.load() < numChunks;
+    };
+    if (!ready()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, ready);
+    }
+    return stop.load() ? nullptr : &chunks[tail.load() % numChunks];
+}
+
+void
+ProtoStream::ChunkRing::push()
+{
+    tail.store(tail.load() + 1);
+    notify();
+}
+
+ProtoStream::Chunk *
+ProtoStream::ChunkRing::consumerChunk()
+{
+    auto ready = [this] {
+        return stop.load() || head.load() != tail.load();
+    };
+    if (!ready()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, ready);
+    }
+    return head.load() == tail.load() ? nullptr :
+        &chunks[head.load() % numChunks];
+}
+
+void
+ProtoStream::ChunkRing::pop()
+{
+    Chunk &chunk = chunks[head.load() % numChunks];
+    chunk.data.clear();
+    chunk.last = false;
+    chunk.truncated = false;
+    head.store(head.load() + 1);
+    notify();
+}
+
+void
+ProtoStream::ChunkRing::requestStop(bool stop_requested)
+{
+    stop.store(stop_requested);
+    notify();
+}
+
+void
+ProtoStream::ChunkRing::clear()
+{
+    for (auto &chunk : chunks) {
+        chunk.data.clear();
+        chunk.last = false;
+        chunk.truncated = false;
+    }
+    head.store(0);
+    tail.store(0);
+}
+
+void
+ProtoStream::ChunkRing::notify()
+{
+    // Taking the mutex orders the index update before the wait
+    // predicate of a thread about to sleep is evaluated
+    { std::lock_guard<std::mutex> lock(mutex); }
+    changed.notify_all();
+}
+
+void
+ProtoStream::startHelper()
+{
+    std::call_once(forkHandlersFlag, [] {
+        pthread_atfork(prepareFork, afterFork, afterFork);
+    });
+
+    std::lock_guard<std::mutex> lock(helperStreamsMutex);
+    helperStreams.insert(this);
+    spawnHelper();
+}
+
+void
+ProtoStream::stopHelper()
+{
+    std::lock_guard<std::mutex> lock(helperStreamsMutex);
+    helperStreams.erase(this);
+    joinHelper();
+}
+
+void
+ProtoStream::spawnHelper()
+{
+    assert(!helper.joinable());
+    helper = std::thread([this] { helperLoop(); });
+}
+
+void
+ProtoStream::joinHelper()
+{
+    if (!helper.joinable())
+        return;
+    ring.requestStop(true);
+    helper.join();
+    ring.requestStop(false);
+}
+
+void
+ProtoStream::prepareFork()
+{
+    // Hold on to the mutex until the fork is done, and stop the
+    // helpers so that neither process is left with a stream that a
+    // thread which no longer exists was half way through using. The
+    // streams restart their helpers as they are used again
+    helperStreamsMutex.lock();
+    for (auto *stream : helperStreams)
+        stream->joinHelper();
+}
+
+void
+ProtoStream::afterFork()
+{
+    helperStreamsMutex.unlock();
+}
+
 ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
     fileStream(filename.c_str(),
             std::ios::out | std::ios::binary | std::ios::trunc),
-    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
+    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL),
+    chunk(nullptr)
 {
     if (!fileStream.good())
         panic("Could not open %s for writing\n", filename);
@@ -64,15 +206,25 @@ ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
     }
 
     // Write the magic number to the file
-    io::CodedOutputStream codedStream(zeroCopyStream);
-    codedStream.WriteLittleEndian32(magicNumber);
+    {
+        io::CodedOutputStream codedStream(zeroCopyStream);
+        codedStream.WriteLittleEndian32(magicNumber);
+    }
 
     // Note that each type of stream (packet, instruction etc) should
     // add its own header and perform the appropriate checks
+
+    startHelper();
 }
 
 ProtoOutputStream::~ProtoOutputStream()
 {
+    // Hand over what is left and let the helper write it all out
+    if (chunk != nullptr)
+        ring.push();
+    resumeHelper();
+    stopHelper();
+
     // As the compression is optional, see if the stream exists
     if (gzipStream != NULL)
         delete gzipStream;
@@ -83,27 +235,47 @@ ProtoOutputStream::~ProtoOutputStream()
 void
 ProtoOutputStream::write(const Message& msg)
 {
-    // Due to the byte limit of the coded stream we create it for
-    // every single mesage (based on forum discussions around the size
-    // limitation)
-    io::CodedOutputStream codedStream(zeroCopyStream);
-
-    // Write the size of the message to the stream
 #   if GOOGLE_PROTOBUF_VERSION < 3001000
-        auto msg_size = msg.ByteSize();
+        uint32_t msg_size = msg.ByteSize();
 #   else
-        auto msg_size = msg.ByteSizeLong();
+        uint32_t msg_size = msg.ByteSizeLong();
 #   endif
-    codedStream.WriteVarint32(msg_size);
 
-    // Write the message itself to the stream
-    msg.SerializeWithCachedSizes(&codedStream);
+    if (chunk == nullptr) {
+        resumeHelper();
+        chunk = ring.producerChunk();
+    }
+
+    // Append the size of the message and the message itself to the
+    // chunk, exactly as they are to appear in the stream
+    size_t offset = chunk->data.size();
+    chunk->data.resize(offset + io::CodedOutputStream::VarintSize32(msg_size) +
+                       msg_size);
+    uint8_t *msg_start = io::CodedOutputStream::WriteVarint32ToArray(
+        msg_size, &chunk->data[offset]);
+    msg.SerializeWithCachedSizesToArray(msg_start);
+
+    if (chunk->data.size() >= chunkSize) {
+        ring.push();
+        chunk = nullptr;
+    }
+}
+
+void
+ProtoOutputStream::helperLoop()
+{
+    while (Chunk *chunk = ring.consumerChunk()) {
+        io::CodedOutputStream codedStream(zeroCopyStream);
+        codedStream.WriteRaw(chunk->data.data(), chunk->data.size());
+        ring.pop();
+    }
 }
 
 ProtoInputStream::ProtoInputStream(const std::string& filename) :
     fileStream(filename.c_str(), std::ios::in | std::ios::binary),
     fileName(filename), useGzip(false),
-    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
+    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL),
+    chunk(nullptr), chunkOffset(0), endOfStream(false)
 {
     if (!fileStream.good())
         panic("Could not open %s for reading\n", filename);
@@ -118,6 +290,7 @@ ProtoInputStream::ProtoInputStream(const std::string& filename) :
     fileStream.seekg(0, std::ifstream::beg);
 
     createStreams();
+    startHelper();
 }
 
 void
@@ -163,6 +336,7 @@ ProtoInputStream::destroyStreams()
 
 ProtoInputStream::~ProtoInputStream()
 {
+    stopHelper();
     destroyStreams();
     fileStream.close();
 }
@@ -171,36 +345,98 @@ ProtoInputStream::~ProtoInputStream()
 void
 ProtoInputStream::reset()
 {
+    stopHelper();
+    chunk = nullptr;
+    chunkOffset = 0;
+    endOfStream = false;
+    ring.clear();
+
     destroyStreams();
     // seek to the start of the input file and clear any flags
     fileStream.clear();
     fileStream.seekg(0, std::ifstream::beg);
     createStreams();
+    startHelper();
 }
 
 bool
 ProtoInputStream::read(Message& msg)
 {
-    // Read a message from the stream by getting the size, using it as
-    // a limit when parsing the message, then popping the limit again
-    uint32_t size;
+    while (true) {
+        if (chunk == nullptr) {
+            resumeHelper();
+            chunk = ring.consumerChunk();
+            chunkOffset = 0;
+        }
 
-    // Due to the byte limit of the coded stream we create it for
-    // every single mesage (based on forum discussions around the size
-    // limitation)
-    io::CodedInputStream codedStream(zeroCopyStream);
-    if (codedStream.ReadVarint32(&size)) {
-        io::CodedInputStream::Limit limit = codedStream.PushLimit(size);
-        if (msg.ParseFromCodedStream(&codedStream)) {
-            codedStream.PopLimit(limit);
-            // All went well, the message is parsed and the limit is
-            // popped again
-            return true;
-        } else {
+        if (chunkOffset < chunk->data.size()) {
+            // The helper has already checked the framing, so get the
+            // size and parse the message right out of the chunk
+            const uint8_t *data = chunk->data.data() + chunkOffset;
+            io::CodedInputStream codedStream(
+                data, chunk->data.size() - chunkOffset);
+            uint32_t size;
+            codedStream.ReadVarint32(&size);
+            int size_bytes = codedStream.CurrentPosition();
+            chunkOffset += size_bytes + size;
+
+            if (msg.ParseFromArray(data + size_bytes, size))
+                return true;
             panic("Unable to read message from coded stream %s\n",
                   fileName);
         }
+
+        if (chunk->truncated)
+            panic("Unable to read message from coded stream %s\n",
+                  fileName);
+
+        // Stay on the last chunk so that any further reads fail too
+        if (chunk->last)
+            return false;
+
+        ring.pop();
+        chunk = nullptr;
     }
+}
+
+void
+ProtoInputStream::helperLoop()
+{
+    if (endOfStream)
+        return;
 
-    return false;
+    while (Chunk *chunk = ring.producerChunk()) {
+        // A chunk left part filled by a stop is filled up further
+        while (!chunk->last && chunk->data.size() < chunkSize) {
+            if (ring.stopRequested())
+                return;
+
+            // Due to the byte limit of the coded stream we create it
+            // for every single mesage (based on forum discussions
+            // around the size limitation)
+            io::CodedInputStream codedStream(zeroCopyStream);
+            uint32_t size;
+            if (!codedStream.ReadVarint32(&size)) {
+                chunk->last = true;
+                break;
+            }
+
+            size_t offset = chunk->data.size();
+            chunk->data.resize(offset +
+                               io::CodedOutputStream::VarintSize32(size) +
+                               size);
+            uint8_t *msg_start = io::CodedOutputStream::WriteVarint32ToArray(
+                size, &chunk->data[offset]);
+            if (!codedStream.ReadRaw(msg_start, size)) {
+                chunk->data.resize(offset);
+                chunk->last = true;
+                chunk->truncated = true;
+            }
+        }
+
+        endOfStream = chunk->last;
+        ring.push();
+        if (endOfStream)
+            return;
+    }
 }
@@ -49,11 +49,24 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /**
  * A ProtoStream provides the shared functionality of the input and
- * output streams. At the moment this is limited to magic number.
+ * output streams: the magic number, and the helper thread that does
+ * the (de)compression and file I/O off the simulation thread.
+ *
+ * The helper thread and the simulation thread exchange framed
+ * messages, i.e. each message prepended with its varint32 size
+ * exactly as it appears in the (uncompressed) stream, through a
+ * small ring of chunks. While the simulation thread works on one
+ * chunk, the helper thread fills or drains the others.
  */
 class ProtoStream
 {
@@ -63,13 +76,148 @@ class ProtoStream
     /// Use the ASCII characters gem5 as our magic number
     static const uint32_t magicNumber = 0x356d6567;
 
+    /// Chunks are handed over once they hold at least this many bytes
+    static const size_t chunkSize = 64 * 1024;
+
+    /// Number of chunks in the ring between the two threads
+    static const size_t numChunks = 4;
+
+    /**
+     * A chunk of framed messages.
+     */
+    struct Chunk
+    {
+        /// The framed messages
+        std::vector<uint8_t> data;
+
+        /// The stream ends after this chunk
+        bool last = false;
+
+        /// The stream ends after this chunk with a truncated message
+        bool truncated = false;
+    };
+
+    /**
+     * A bounded ring of chunks with a single producer and a single
+     * consumer. The chunk buffers are reused, and the ring indices are
+     * each only written by one side, so neither side touches the mutex
+     * unless the ring is full or empty, or to signal the other side
+     * once per chunk.
+     */
+    class ChunkRing
+    {
+      public:
+
+        ChunkRing() : chunks(numChunks), head(0), tail(0), stop(false) {}
+
+        /**
+         * Get the chunk the producer fills, waiting for one to be free.
+         *
+         * @return The chunk, or nullptr if a stop has been requested
+         */
+        Chunk *producerChunk();
+
+        /** Hand the producer's chunk over to the consumer. */
+        void push();
+
+        /**
+         * Get the oldest chunk handed over, waiting until there is one.
+         *
+         * @return The chunk, or nullptr if a stop has been requested
+         *         and there are no chunks left
+         */
+        Chunk *consumerChunk();
+
+        /** Return the consumer's chunk to the producer, emptied. */
+        void pop();
+
+        /** Has a stop been requested? */
+        bool stopRequested() const { return stop.load(); }
+
+        /** Request that, or cancel the request that, the helper stops. */
+        void requestStop(bool stop_requested);
+
+        /** Empty the ring. Only call this while no helper is running. */
+        void clear();
+
+      private:
+
+        /** Wake the other side after moving one of the indices. */
+        void notify();
+
+        std::vector<Chunk> chunks;
+
+        /// Number of chunks ever popped, only written by the consumer
+        std::atomic<size_t> head;
+
+        /// Number of chunks ever pushed, only written by the producer
+        std::atomic<size_t> tail;
+
+        std::atomic<bool> stop;
+
+        std::mutex mutex;
+        std::condition_variable changed;
+    };
+
     /**
      * Create a ProtoStream.
      */
     ProtoStream() {}
 
+    virtual ~ProtoStream() {}
+
+    /**
+     * Start the helper thread, and register the stream so that the
+     * helper is stopped before the process forks. A fork only
+     * duplicates the forking thread.
+     */
+    void startHelper();
+
+    /**
+     * Restart the helper thread if it was stopped for a fork. This is
+     * left until the stream is next used, as the processes share the
+     * file offset and a stream may only ever be used by one of them.
+     */
+    void resumeHelper()
+    {
+        if (!helper.joinable())
+            spawnHelper();
+    }
+
+    /**
+     * Stop the helper thread and deregister the stream.
+     */
+    void stopHelper();
+
+    /**
+     * The body of the helper thread. It must return promptly, leaving
+     * the stream in a state it can resume from, once a stop is
+     * requested on the ring.
+     */
+    virtual void helperLoop() = 0;
+
+    /// The ring of chunks between the simulation and helper thread
+    ChunkRing ring;
+
   private:
 
+    /** Join the helper thread, leaving the stream registered. */
+    void joinHelper();
+
+    /** Spawn the helper thread. */
+    void spawnHelper();
+
+    /**
+     * The fork handlers.
+     * @{
+     */
+    static void prepareFork();
+    static void afterFork();
+    /** @} */
+
+    /// The helper thread
+    std::thread helper;
+
     /**
      * Hide the copy constructor and assignment operator.
      * @{
@@ -85,7 +233,8 @@ class ProtoStream
  * stream is done to enable interaction with the file on a per-message
  * basis to avoid having to deal with huge data structures. The latter
  * is made possible by encoding the length of each message in the
- * stream.
+ * stream. The messages are serialised on the simulation thread, and
+ * compressed and written to the file on the helper thread.
  */
 class ProtoOutputStream : public ProtoStream
 {
@@ -116,6 +265,12 @@ class ProtoOutputStream : public ProtoStream
 
   private:
 
+    /**
+     * Write the chunks handed over by write() to the underlying
+     * streams until a stop is requested and they are all written.
+     */
+    void helperLoop() override;
+
     /// Underlying file output stream
     std::ofstream fileStream;
 
@@ -128,6 +283,9 @@ class ProtoOutputStream : public ProtoStream
     /// Top-level zero-copy stream, either with compression or not
     google::protobuf::io::ZeroCopyOutputStream* zeroCopyStream;
 
+    /// The chunk being filled by write(), if any
+    Chunk *chunk;
+
 };
 
 /**
@@ -135,7 +293,9 @@ class ProtoOutputStream : public ProtoStream
  * decompression, based on looking at the file name. Reading from the
  * stream is done on a per-message basis to avoid having to deal with
  * huge data structures. The latter assumes the length of each message
- * is encoded in the stream when it is written.
+ * is encoded in the stream when it is written. The helper thread reads
+ * and decompresses the file ahead of the simulation thread, which only
+ * parses the messages.
  */
 class ProtoInputStream : public ProtoStream
 {
@@ -181,6 +341,12 @@ class ProtoInputStream : public ProtoStream
      */
     void destroyStreams();
 
+    /**
+     * Fill chunks with the framed messages read from the underlying
+     * streams until the end of the file, or until a stop is requested.
+     */
+    void helperLoop() override;
+
     /// Underlying file input stream
     std::ifstream fileStream;
 
@@ -199,6 +365,15 @@ class ProtoInputStream : public ProtoStream
     /// Top-level zero-copy stream, either with compression or not
     google::protobuf::io::ZeroCopyInputStream* zeroCopyStream;
 
+    /// The chunk read() is parsing messages from, if any
+    Chunk *chunk;
+
+    /// Offset of the next framed message in the chunk
+    size_t chunkOffset;
+
+    /// The helper has handed over the last chunk of the stream
+    bool endOfStream;
+
 };
 
 #endif //__PROTO_PROTOIO_HH
@@ -52,6 +52,7 @@ class HighBandwidthMemory(ChanneledMemory):
         interleaving_size: Union[int, str],
         size: Optional[str] = None,
         addr_mapping: Optional[str] = None,
+        channel_bridge_delay: Optional[str] = None,
     ) -> None:
         """
         :param dram_interface_class: The DRAM interface type to create with
@@ -66,6 +67,8 @@ class HighBandwidthMemory(ChanneledMemory):
         :param interleaving_size: Defines the interleaving size of the multi-
             channel memory system. By default, it is equivalent to the atom
             size, i.e., 64.
+        :param channel_bridge_delay: Optionally put a Bridge with this delay
+            in front of each channel's controller, see ChanneledMemory.
         """
         super().__init__(
             dram_interface_class,
@@ -73,6 +76,7 @@ class HighBandwidthMemory(ChanneledMemory):
             interleaving_size,
             size,
             addr_mapping,
+            channel_bridge_delay,
         )
 
         _num_channels = _try_convert(num_channels, int)
@@ -153,9 +157,12 @@ class HighBandwidthMemory(ChanneledMemory):
                     intlvMatch=i,
                 )
             )
-        return [
-            (addr_ranges[i], ctrl.port) for i, ctrl in enumerate(self.mem_ctrl)
-        ]
+        return self._bridge_channels(
+            [
+                (addr_ranges[i], ctrl.port)
+                for i, ctrl in enumerate(self.mem_ctrl)
+            ]
+        )
 
 
 def HBM2Stack(
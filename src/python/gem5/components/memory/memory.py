@@ -32,7 +32,7 @@ from ...utils.override import overrides
 from m5.util.convert import toMemorySize
 from ..boards.abstract_board import AbstractBoard
 from .abstract_memory_system import AbstractMemorySystem
-from m5.objects import AddrRange, DRAMInterface, MemCtrl, Port
+from m5.objects import AddrRange, Bridge, DRAMInterface, MemCtrl, Port
 from typing import Type, Sequence, Tuple, List, Optional, Union
 
 
@@ -65,6 +65,7 @@ class ChanneledMemory(AbstractMemorySystem):
         interleaving_size: Union[int, str],
         size: Optional[str] = None,
         addr_mapping: Optional[str] = None,
+        channel_bridge_delay: Optional[str] = None,
     ) -> None:
         """
         :param dram_interface_class: The DRAM interface type to create with
@@ -79,6 +80,11 @@ class ChanneledMemory(AbstractMemorySystem):
         :param interleaving_size: Defines the interleaving size of the multi-
             channel memory system. By default, it is equivalent to the atom
             size, i.e., 64.
+        :param channel_bridge_delay: Optionally put a Bridge with this delay
+            in front of each channel's controller. The event queue
+            partitioner (Root.eventq_partitions) can then simulate each
+            channel on its own event queue. The delay must be at least
+            Root.sim_quantum, unless Root.conservative_sync is set.
         """
         num_channels = _try_convert(num_channels, int)
         interleaving_size = _try_convert(interleaving_size, int)
@@ -109,6 +115,32 @@ class ChanneledMemory(AbstractMemorySystem):
 
         self._create_mem_interfaces_controller()
 
+        if channel_bridge_delay:
+            self.channel_bridge = [
+                Bridge(
+                    delay=channel_bridge_delay,
+                    req_size=ctrl.read_buffer_size + ctrl.write_buffer_size,
+                    resp_size=ctrl.read_buffer_size,
+                )
+                for ctrl in self.mem_ctrl
+            ]
+            for bridge, ctrl in zip(self.channel_bridge, self.mem_ctrl):
+                bridge.mem_side_port = ctrl.port
+
+    def _bridge_channels(
+        self, mem_ports: Sequence[Tuple[AddrRange, Port]]
+    ) -> Sequence[Tuple[AddrRange, Port]]:
+        """Returns the ports of the channel bridges in place of those of the
+        channels, if the channels are bridged."""
+        if not hasattr(self, "channel_bridge"):
+            return mem_ports
+        for bridge, (addr_range, _) in zip(self.channel_bridge, mem_ports):
+            bridge.ranges = [addr_range]
+        return [
+            (addr_range, bridge.cpu_side_port)
+            for bridge, (addr_range, _) in zip(self.channel_bridge, mem_ports)
+        ]
+
     def _create_mem_interfaces_controller(self):
         self._dram = [
             self._dram_class(addr_mapping=self._addr_mapping)
@@ -164,7 +196,9 @@ class ChanneledMemory(AbstractMemorySystem):
 
     @overrides(AbstractMemorySystem)
     def get_mem_ports(self) -> Sequence[Tuple[AddrRange, Port]]:
-        return [(ctrl.dram.range, ctrl.port) for ctrl in self.mem_ctrl]
+        return self._bridge_channels(
+            [(ctrl.dram.range, ctrl.port) for ctrl in self.mem_ctrl]
+        )
 
     @overrides(AbstractMemorySystem)
     def get_memory_controllers(self) -> List[MemCtrl]:
@@ -51,6 +51,10 @@ class AbstractProcessor(SubSystem):
         """
         super().__init__()
 
+        self._kvm_parallel = True
+        self._kvm_sim_quantum = "1ms"
+        self._kvm_inst_stop_skid = 0
+
         if cores:
             # In the stdlib we assume the system processor conforms to a single
             # ISA target.
@@ -75,6 +79,53 @@ class AbstractProcessor(SubSystem):
     def incorporate_processor(self, board: AbstractBoard) -> None:
         raise NotImplementedError
 
+    def set_kvm_options(
+        self,
+        parallel: bool = True,
+        sim_quantum: str = "1ms",
+        inst_stop_skid: int = 0,
+    ) -> None:
+        """Set how the KVM cores of the processor, if any, are simulated.
+
+        :param parallel: Run each KVM core on its own event queue, and so on
+        its own host thread, while the rest of the board stays on event queue
+        0. Otherwise all the cores run one after the other on the host
+        thread of the board.
+        :param sim_quantum: The simulated time the event queues run between
+        synchronizations. The KVM cores only see the interrupts from other
+        event queues, e.g., the IPIs of the other cores, at the end of a
+        quantum. Shorter quanta speed up the guest code waiting on other
+        cores, e.g., TLB shootdowns, but synchronize more often.
+        :param inst_stop_skid: Stop the KVM cores this many instructions
+        before an instruction count exit, e.g., a SimPoint or the maximum
+        instruction count, and single-step the rest of the way. The cores
+        then exit exactly at the instruction count, and the PcCountTrackers
+        see the PCs of the stepped instructions. The perf overflow signal
+        that stops the cores is delivered with some skid, a few hundred
+        instructions usually cover it. 0 relies on the overflow alone.
+        """
+        self._kvm_parallel = parallel
+        self._kvm_sim_quantum = sim_quantum
+        self._kvm_inst_stop_skid = inst_stop_skid
+
+    def get_kvm_sim_quantum(self) -> str:
+        """Get the simulation quantum to use with the KVM cores."""
+        return self._kvm_sim_quantum
+
+    def _configure_kvm_cores(self, cores: List[AbstractCore]) -> None:
+        """Apply the KVM options to the KVM cores. Put each core on its own
+        event queue if the processor runs them in parallel. The objects in
+        the cores, e.g., their MMUs and interrupt controllers, stay on event
+        queue 0 with the board."""
+        for core in cores:
+            core.get_simobject().instStopSkid = self._kvm_inst_stop_skid
+        if not self._kvm_parallel:
+            return
+        for i, core in enumerate(cores):
+            for obj in core.get_simobject().descendants():
+                obj.eventq_index = 0
+            core.get_simobject().eventq_index = i + 1
+
     def _post_instantiate(self) -> None:
         """Called to set up anything needed after m5.instantiate"""
         pass
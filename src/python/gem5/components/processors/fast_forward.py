@@ -0,0 +1,67 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+from .abstract_core import AbstractCore
+from .base_cpu_core import BaseCPUCore
+
+from m5.objects import BaseAtomicSimpleCPU
+
+from typing import List
+
+
+def set_fast_forward_params(
+    cores: List[AbstractCore],
+    decoded_block_cache_size: int = 4096,
+) -> None:
+    """
+    Sets up atomic cores to fast-forward through the uninteresting parts of
+    a workload as quickly as possible. The instructions are replayed from a
+    decoded block cache and chained with threaded dispatch, and only the
+    instructions that aren't in a cached block go through the fetch and the
+    decoder. The cores are still atomic simple CPUs, so they keep their state
+    in a simple thread and can be switched to and from the detailed cores.
+
+    This is to be called before the simulation is instantiated, e.g., on the
+    starting cores of a `SimpleSwitchableProcessor`:
+
+    ```
+    set_fast_forward_params(processor.get_cores())
+    ```
+
+    :param cores: The cores to set up. They must all be atomic cores.
+    :param decoded_block_cache_size: The number of decoded blocks cached by
+    each core. It must be a power of 2.
+    """
+    for core in cores:
+        if not (
+            isinstance(core, BaseCPUCore)
+            and isinstance(core.get_simobject(), BaseAtomicSimpleCPU)
+        ):
+            raise Exception("Only atomic cores can be set up to fast-forward.")
+        cpu = core.get_simobject()
+        cpu.decoded_block_cache_size = decoded_block_cache_size
+        cpu.threaded_dispatch = True
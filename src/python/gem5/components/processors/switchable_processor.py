@@ -93,15 +93,9 @@ class SwitchableProcessor(AbstractProcessor):
         self._board = board
 
         if self._prepare_kvm:
-            # To get the KVM CPUs to run on different host CPUs
-            # Specify a different event queue for each CPU
-            kvm_cores = [
-                core for core in self._all_cores() if core.is_kvm_core()
-            ]
-            for i, core in enumerate(kvm_cores):
-                for obj in core.get_simobject().descendants():
-                    obj.eventq_index = 0
-                core.get_simobject().eventq_index = i + 1
+            self._configure_kvm_cores(
+                [core for core in self._all_cores() if core.is_kvm_core()]
+            )
 
     @overrides(AbstractProcessor)
     def get_num_cores(self) -> int:
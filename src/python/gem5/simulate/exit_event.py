@@ -25,6 +25,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from enum import Enum
+from typing import List
 
 
 class ExitEvent(Enum):
@@ -54,6 +55,18 @@ class ExitEvent(Enum):
     PERF_COUNTER_RESET = "performance counter reset"
     PERF_COUNTER_INTERRUPT = "performance counter interrupt"
 
+    @classmethod
+    def exit_strings(cls, exit_event: "ExitEvent") -> List[str]:
+        """
+        Returns the exit strings known to translate to an ExitEvent. Exit
+        strings matched by their suffix are not included.
+        """
+        return [
+            exit_string
+            for exit_string in _known_exit_strings
+            if cls.translate_exit_status(exit_string) == exit_event
+        ]
+
     @classmethod
     def translate_exit_status(cls, exit_string: str) -> "ExitEvent":
         """
@@ -111,3 +124,26 @@ class ExitEvent(Enum):
         raise NotImplementedError(
             f"Exit event '{exit_string}' not implemented"
         )
+
+
+# The exit strings which `ExitEvent.translate_exit_status` matches exactly.
+_known_exit_strings = [
+    "m5_workbegin instruction encountered",
+    "workbegin",
+    "m5_workend instruction encountered",
+    "workend",
+    "m5_exit instruction encountered",
+    "exiting with last active thread context",
+    "simulate() limit reached",
+    "Tick exit reached",
+    "switchcpu",
+    "m5_fail instruction encountered",
+    "checkpoint",
+    "user interrupt received",
+    "simpoint starting point found",
+    "a thread reached the max instruction count",
+    "performance counter enabled",
+    "performance counter disabled",
+    "performance counter reset",
+    "performance counter interrupt",
+]
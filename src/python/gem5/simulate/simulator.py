@@ -29,12 +29,16 @@ import m5.ticks
 from m5.stats import addStatVisitor
 from m5.ext.pystats.simstat import SimStat
 from m5.objects import Root
-from m5.util import warn
+from m5.util import convert, warn
+from m5.params import isNullPointer
 
+import math
 import os
+import statistics
 import sys
+import traceback
 from pathlib import Path
-from typing import Optional, List, Tuple, Dict, Generator, Union
+from typing import Callable, Optional, List, Tuple, Dict, Generator, Union
 
 from .exit_event_generators import (
     warn_default_decorator,
@@ -339,6 +343,50 @@ class Simulator:
             )
         addStatVisitor(f"json://{path}")
 
+    def set_native_exit_action(
+        self,
+        exit_event: ExitEvent,
+        action: str = "continue",
+        limit: Optional[int] = None,
+    ) -> None:
+        """
+        Handle an exit event in C++ and keep simulating, without returning
+        to Python. The exit event generator of the event is then bypassed,
+        which saves a round trip through Python for frequent exits, e.g.,
+        per-iteration `m5_work_begin` markers.
+
+        :param exit_event: The exit event to handle.
+        :param action: What to do on each exit: "continue", "dump_stats",
+        "reset_stats" or "dump_reset_stats".
+        :param limit: The number of exits to handle in C++, after which they
+        go to the exit event generator again. No limit if None.
+        """
+        if exit_event == ExitEvent.MAX_TICK:
+            raise ValueError("MAX_TICK exit events always return to Python.")
+        for exit_string in ExitEvent.exit_strings(exit_event):
+            m5.setExitAction(exit_string, action, limit or 0)
+
+    def clear_native_exit_action(self, exit_event: ExitEvent) -> None:
+        """
+        Return an exit event to its exit event generator again.
+
+        :param exit_event: The exit event set with `set_native_exit_action`.
+        """
+        for exit_string in ExitEvent.exit_strings(exit_event):
+            m5.clearExitAction(exit_string)
+
+    def get_native_exit_count(self, exit_event: ExitEvent) -> int:
+        """
+        Returns the number of exit events handled in C++ since the action
+        of the exit event was set.
+
+        :param exit_event: The exit event set with `set_native_exit_action`.
+        """
+        return sum(
+            m5.getExitActionCount(exit_string)
+            for exit_string in ExitEvent.exit_strings(exit_event)
+        )
+
     def get_last_exit_event_cause(self) -> str:
         """
         Returns the last exit event cause.
@@ -373,6 +421,18 @@ class Simulator:
 
         return to_return
 
+    def _check_banned_modules(self) -> None:
+        """
+        Checks to ensure no banned module has been imported.
+        """
+        for banned_module in self._banned_modules.keys():
+            if banned_module in sys.modules:
+                raise Exception(
+                    f"The banned module '{banned_module}' has been included. "
+                    "Please do not use this in your simulations. "
+                    f"Reason: {self._banned_modules[banned_module]}"
+                )
+
     def _instantiate(self) -> None:
         """
         This method will instantiate the board and carry out necessary
@@ -418,7 +478,9 @@ class Simulator:
                 and any(core.is_kvm_core() for core in processor._all_cores())
             ):
                 m5.ticks.fixGlobalFrequency()
-                root.sim_quantum = m5.ticks.fromSeconds(0.001)
+                root.sim_quantum = m5.ticks.fromSeconds(
+                    convert.toLatency(processor.get_kvm_sim_quantum())
+                )
 
             # m5.instantiate() takes a parameter specifying the path to the
             # checkpoint directory. If the parameter is None, no checkpoint
@@ -444,14 +506,7 @@ class Simulator:
         reset. This is the **maximum number of ticks per simulation run**.
         """
 
-        # Check to ensure no banned module has been imported.
-        for banned_module in self._banned_modules.keys():
-            if banned_module in sys.modules:
-                raise Exception(
-                    f"The banned module '{banned_module}' has been included. "
-                    "Please do not use this in your simulations. "
-                    f"Reason: {self._banned_modules[banned_module]}"
-                )
+        self._check_banned_modules()
 
         # We instantiate the board if it has not already been instantiated.
         self._instantiate()
@@ -461,54 +516,411 @@ class Simulator:
 
             self._last_exit_event = m5.simulate(max_ticks)
 
-            # Translate the exit event cause to the exit event enum.
-            exit_enum = ExitEvent.translate_exit_status(
-                self.get_last_exit_event_cause()
+            # If the generator returned True we will return from the Simulator
+            # run loop.
+            if self._handle_exit_event():
+                return
+
+    def run_sampled(
+        self,
+        measure_cores: str,
+        warming_cores: str,
+        measure_insts: int,
+        detailed_warmup_insts: int,
+        functional_warming_insts: int,
+        fast_forward_cores: Optional[str] = None,
+        fast_forward_insts: int = 0,
+        max_samples: Optional[int] = None,
+        confidence: float = 0.997,
+        target_error: Optional[float] = None,
+        share_branch_predictor: bool = True,
+        dump_stats: bool = False,
+    ) -> Dict:
+        """
+        Runs a SMARTS-style sampled simulation. Each sample consists of the
+        following phases, each run on a set of cores of the board's
+        `SwitchableProcessor`:
+
+        1. Fast-forward (optional) for `fast_forward_insts` instructions on the
+           `fast_forward_cores` (typically KVM or atomic cores without
+           caches being warmed).
+        2. Functional warming for `functional_warming_insts` instructions on
+           the `warming_cores` (atomic cores). Atomic accesses update the
+           cache tags and replacement state and the branch predictor is
+           trained, all without modelling timing.
+        3. Detailed warm-up for `detailed_warmup_insts` instructions on the
+           `measure_cores` to fill the pipeline and in-flight state.
+        4. A measured window of `measure_insts` instructions on the
+           `measure_cores`, from which the sample's IPC is taken.
+
+        Setting `fast_forward_insts` to 0 keeps the warming cores running
+        between measured windows, which is the continuous functional warming
+        of SMARTS. Sampling stops when the workload exits, when `max_samples`
+        samples have been taken, or when the relative half-width of the IPC
+        confidence interval drops below `target_error`.
+
+        **Warning:** Only the first core is used to count instructions and to
+        measure IPC.
+
+        **Note:** The MAX_INSTS exit events are consumed by this function.
+        All other exit events are handled as they are in `run()`.
+
+        :param measure_cores: The switchable cores key of the detailed cores.
+        :param warming_cores: The switchable cores key of the functional
+        warming cores.
+        :param measure_insts: The instructions in each measured window.
+        :param detailed_warmup_insts: The instructions of detailed warm-up
+        before each measured window.
+        :param functional_warming_insts: The instructions of functional
+        warming before each detailed warm-up.
+        :param fast_forward_cores: The switchable cores key of the
+        fast-forwarding cores. If None, no fast-forwarding is done.
+        :param fast_forward_insts: The instructions fast-forwarded before
+        each functional warming phase.
+        :param max_samples: The maximum number of samples to take. If None,
+        sampling continues until the workload exits.
+        :param confidence: The confidence level of the reported interval.
+        :param target_error: An optional relative error (e.g., 0.03 for 3%)
+        at which to stop sampling.
+        :param share_branch_predictor: If True, the warming cores use the
+        measure cores' branch predictors so they are trained during
+        functional warming. This must be set before the simulation is
+        instantiated.
+        :param dump_stats: If True, the stats are reset at the start of each
+        measured window and dumped at the end of it.
+
+        :returns: A dictionary containing the per-sample IPCs ("samples"),
+        their "mean" and "stdev", the "confidence" level and the confidence
+        "interval" as a (low, high) tuple.
+        """
+
+        processor = self._board.get_processor()
+        if not isinstance(processor, SwitchableProcessor):
+            raise Exception(
+                "Sampled simulation requires the board's processor to be a "
+                "SwitchableProcessor."
             )
 
-            # Check to see the run is corresponding to the expected execution
-            # order (assuming this check is demanded by the user).
-            if self._expected_execution_order:
-                expected_enum = self._expected_execution_order[
-                    self._exit_event_count
-                ]
-                if exit_enum.value != expected_enum.value:
-                    raise Exception(
-                        f"Expected a '{expected_enum.value}' exit event but a "
-                        f"'{exit_enum.value}' exit event was encountered."
-                    )
+        keys = [measure_cores, warming_cores]
+        if fast_forward_cores is not None:
+            keys.append(fast_forward_cores)
+        for key in keys:
+            if key not in processor._switchable_cores.keys():
+                raise Exception(
+                    f"Key '{key}' is not a key in the switchable_processor "
+                    "dictionary."
+                )
 
-            # Record the current tick and exit event enum.
-            self._tick_stopwatch.append((exit_enum, self.get_current_tick()))
+        if processor.get_num_cores() > 1:
+            warn("Sampled simulation only measures the first core")
 
-            try:
-                # If the user has specified their own generator for this exit
-                # event, use it.
-                exit_on_completion = next(self._on_exit_event[exit_enum])
-            except StopIteration:
-                # If the user's generator has ended, throw a warning and use
-                # the default generator for this exit event.
+        if share_branch_predictor:
+            if self._instantiated:
                 warn(
-                    "User-specified generator for the exit event "
-                    f"'{exit_enum.value}' has ended. Using the default "
-                    "generator."
+                    "Branch predictors cannot be shared after the "
+                    "simulation has been instantiated."
                 )
-                exit_on_completion = next(
-                    self._default_on_exit_dict[exit_enum]
+            else:
+                for warm, detailed in zip(
+                    processor._switchable_cores[warming_cores],
+                    processor._switchable_cores[measure_cores],
+                ):
+                    warm_cpu = warm.get_simobject()
+                    detailed_cpu = detailed.get_simobject()
+                    if (
+                        "branchPred" in warm_cpu._params
+                        and "branchPred" in detailed_cpu._params
+                        and not isNullPointer(detailed_cpu.branchPred)
+                    ):
+                        warm_cpu.branchPred = detailed_cpu.branchPred
+
+        self._check_banned_modules()
+        self._instantiate()
+
+        samples = []
+        while max_samples is None or len(samples) < max_samples:
+            if fast_forward_cores is not None and fast_forward_insts:
+                self._switch_cores(fast_forward_cores)
+                if not self._run_insts(fast_forward_insts):
+                    break
+
+            self._switch_cores(warming_cores)
+            if not self._run_insts(functional_warming_insts):
+                break
+
+            self._switch_cores(measure_cores)
+            if not self._run_insts(detailed_warmup_insts):
+                break
+
+            if dump_stats:
+                m5.stats.reset()
+
+            cpu = processor.get_cores()[0].get_simobject()
+            start_insts = cpu.totalInsts()
+            start_cycles = cpu.resolveStat("numCycles").value
+
+            # A measured window cut short by the workload exiting is
+            # discarded.
+            if not self._run_insts(measure_insts):
+                break
+
+            if dump_stats:
+                m5.stats.dump()
+
+            cycles = cpu.resolveStat("numCycles").value - start_cycles
+            if cycles > 0:
+                samples.append((cpu.totalInsts() - start_insts) / cycles)
+
+            if target_error is not None and len(samples) > 1:
+                summary = _sample_summary(samples, confidence)
+                low, high = summary["interval"]
+                if (high - low) / 2 <= target_error * summary["mean"]:
+                    break
+
+        return _sample_summary(samples, confidence)
+
+    def run_forked_regions(
+        self,
+        region_start_insts: List[int],
+        detailed_cores: str,
+        region_insts: int,
+        fast_forward_cores: Optional[str] = None,
+        warmup_insts: int = 0,
+        max_children: Optional[int] = None,
+        on_region: Optional[Callable[[int], None]] = None,
+    ) -> Dict[int, int]:
+        """
+        Simulates regions of interest in forked children of the simulator
+        rather than from checkpoints. The parent fast-forwards once through
+        the workload, on the `fast_forward_cores` (typically KVM cores), and
+        forks a child at the start of every region. The child switches to
+        the `detailed_cores`, runs `warmup_insts` instructions of warm-up,
+        resets the stats and runs the `region_insts` instructions of the
+        region, while the parent carries on to the next region. The child
+        shares the parent's memory copy-on-write, so no checkpoint is ever
+        written or restored.
+
+        Each child's output is written to a `region<N>` directory in the
+        parent's output directory, N being the region's index in
+        `region_start_insts`. The child's stats are dumped when it exits, so
+        they only cover its region's window.
+
+        **Warning:** Only the first core is used to count instructions. The
+        region start instructions are counted from the call to this
+        function.
+
+        **Note:** Forking requires the listeners (e.g., the GDB ports) to be
+        disabled. They are disabled by this function if the simulation has
+        not been instantiated yet.
+
+        :param region_start_insts: The instruction at which each region
+        starts.
+        :param detailed_cores: The switchable cores key of the cores the
+        regions are simulated on.
+        :param region_insts: The instructions in each region.
+        :param fast_forward_cores: The switchable cores key of the cores the
+        parent fast-forwards on. If None, the current cores are used.
+        :param warmup_insts: The instructions of detailed warm-up each child
+        runs before the region. The warm-up overlaps the end of the
+        fast-forward to the region's start, so the region is simulated from
+        the same instruction either way. The warm-up is cut short if it
+        would start before the previous region's fork.
+        :param max_children: The maximum number of children running at any
+        time. The parent waits for a child to exit before forking another
+        one past this. If None, the number of host CPUs is used.
+        :param on_region: An optional function called in the child with the
+        region's index at the end of the region, e.g., to record results.
+
+        :returns: A dictionary of each simulated region's index to the exit
+        status of its child (the negated signal number if it was killed by a
+        signal). Regions after the workload exits are not simulated.
+        """
+
+        processor = self._board.get_processor()
+        if not isinstance(processor, SwitchableProcessor):
+            raise Exception(
+                "Forked region simulation requires the board's processor to "
+                "be a SwitchableProcessor."
+            )
+
+        keys = [detailed_cores]
+        if fast_forward_cores is not None:
+            keys.append(fast_forward_cores)
+        for key in keys:
+            if key not in processor._switchable_cores.keys():
+                raise Exception(
+                    f"Key '{key}' is not a key in the switchable_processor "
+                    "dictionary."
                 )
-            except KeyError:
-                # If the user has not specified their own generator for this
-                # exit event, use the default.
-                exit_on_completion = next(
-                    self._default_on_exit_dict[exit_enum]
+
+        if processor.get_num_cores() > 1:
+            warn("Forked region simulation only counts the first core")
+
+        if not self._instantiated:
+            m5.disableAllListeners()
+        elif not m5.listenersDisabled():
+            raise Exception(
+                "The simulator cannot be forked with listeners enabled. "
+                "Call `m5.disableAllListeners()` before the simulation is "
+                "instantiated."
+            )
+
+        if max_children is None:
+            max_children = os.cpu_count() or 1
+        if max_children < 1:
+            raise Exception("At least one child must be allowed to run.")
+
+        self._check_banned_modules()
+        self._instantiate()
+
+        if fast_forward_cores is not None:
+            self._switch_cores(fast_forward_cores)
+
+        def wait_child(children: Dict[int, int]) -> Tuple[int, int]:
+            while True:
+                pid, status = os.waitpid(-1, 0)
+                if pid in children:
+                    break
+            if os.WIFSIGNALED(status):
+                return children.pop(pid), -os.WTERMSIG(status)
+            return children.pop(pid), os.WEXITSTATUS(status)
+
+        children = {}
+        statuses = {}
+        executed = 0
+        regions = sorted(
+            range(len(region_start_insts)),
+            key=lambda region: region_start_insts[region],
+        )
+        for region in regions:
+            fork_insts = max(region_start_insts[region] - warmup_insts, 0)
+            if fork_insts > executed:
+                if not self._run_insts(fork_insts - executed):
+                    warn(
+                        "The workload exited before the region starting at "
+                        f"instruction {region_start_insts[region]}."
+                    )
+                    break
+                executed = fork_insts
+
+            while len(children) >= max_children:
+                done, status = wait_child(children)
+                statuses[done] = status
+
+            pid = m5.fork("%(parent)s/" + f"region{region}")
+            if pid == 0:
+                # The child must never return to the parent's loop, so it
+                # exits however the region ends.
+                try:
+                    self._switch_cores(detailed_cores)
+                    # The parent may already be past the start of the
+                    # warm-up if it overlaps the previous region's one.
+                    if self._run_insts(
+                        region_start_insts[region] - max(fork_insts, executed)
+                    ):
+                        m5.stats.reset()
+                        self._run_insts(region_insts)
+                    if on_region is not None:
+                        on_region(region)
+                except Exception:
+                    traceback.print_exc()
+                    sys.exit(1)
+                sys.exit(0)
+            children[pid] = region
+
+        while children:
+            done, status = wait_child(children)
+            statuses[done] = status
+
+        return statuses
+
+    def _switch_cores(self, switchable_core_key: str) -> None:
+        """
+        Switches the board's SwitchableProcessor to the given cores, if they
+        are not already switched in.
+        """
+        processor = self._board.get_processor()
+        if (
+            processor.get_cores()
+            != processor._switchable_cores[switchable_core_key]
+        ):
+            processor.switch_to_processor(switchable_core_key)
+
+    def _run_insts(self, insts: int) -> bool:
+        """
+        Runs the simulation until the first core has executed `insts` more
+        instructions. Exit events other than MAX_INSTS are handled as in
+        `run()`.
+
+        :returns: False if an exit event generator yielded True before the
+        instructions were executed, True otherwise.
+        """
+        if insts == 0:
+            return True
+
+        core = self._board.get_processor().get_cores()[0]
+        core._set_inst_stop_any_thread(insts, self._instantiated)
+
+        while True:
+            self._last_exit_event = m5.simulate()
+            exit_enum = ExitEvent.translate_exit_status(
+                self.get_last_exit_event_cause()
+            )
+            if exit_enum == ExitEvent.MAX_INSTS:
+                return True
+            if self._handle_exit_event():
+                return False
+
+    def _handle_exit_event(self) -> bool:
+        """
+        Handles the most recent exit event (`self._last_exit_event`) by
+        executing the user-specified or default generator for it.
+
+        :returns: True if the generator yielded True, signalling the run loop
+        should exit.
+        """
+
+        # Translate the exit event cause to the exit event enum.
+        exit_enum = ExitEvent.translate_exit_status(
+            self.get_last_exit_event_cause()
+        )
+
+        # Check to see the run is corresponding to the expected execution
+        # order (assuming this check is demanded by the user).
+        if self._expected_execution_order:
+            expected_enum = self._expected_execution_order[
+                self._exit_event_count
+            ]
+            if exit_enum.value != expected_enum.value:
+                raise Exception(
+                    f"Expected a '{expected_enum.value}' exit event but a "
+                    f"'{exit_enum.value}' exit event was encountered."
                 )
 
-            self._exit_event_count += 1
+        # Record the current tick and exit event enum.
+        self._tick_stopwatch.append((exit_enum, self.get_current_tick()))
 
-            # If the generator returned True we will return from the Simulator
-            # run loop.
-            if exit_on_completion:
-                return
+        try:
+            # If the user has specified their own generator for this exit
+            # event, use it.
+            exit_on_completion = next(self._on_exit_event[exit_enum])
+        except StopIteration:
+            # If the user's generator has ended, throw a warning and use
+            # the default generator for this exit event.
+            warn(
+                "User-specified generator for the exit event "
+                f"'{exit_enum.value}' has ended. Using the default "
+                "generator."
+            )
+            exit_on_completion = next(self._default_on_exit_dict[exit_enum])
+        except KeyError:
+            # If the user has not specified their own generator for this
+            # exit event, use the default.
+            exit_on_completion = next(self._default_on_exit_dict[exit_enum])
+
+        self._exit_event_count += 1
+
+        return exit_on_completion
 
     def save_checkpoint(self, checkpoint_dir: Path) -> None:
         """
@@ -518,3 +930,40 @@ class Simulator:
         will be saved.
         """
         m5.checkpoint(str(checkpoint_dir))
+
+
+def _sample_summary(samples: List[float], confidence: float) -> Dict:
+    """
+    Summarizes a list of per-sample measurements as their mean, sample
+    standard deviation and the confidence interval of the mean, assuming the
+    sample mean is normally distributed (as in SMARTS).
+    """
+    if not samples:
+        return {
+            "samples": [],
+            "mean": 0.0,
+            "stdev": 0.0,
+            "confidence": confidence,
+            "interval": (0.0, 0.0),
+        }
+
+    mean = statistics.mean(samples)
+    stdev = statistics.stdev(samples) if len(samples) > 1 else 0.0
+
+    # Find the two-sided critical value of the standard normal distribution
+    # by bisection, as `statistics.NormalDist` requires Python 3.8.
+    low, high = 0.0, 10.0
+    for _ in range(64):
+        z = (low + high) / 2
+        if math.erf(z / math.sqrt(2)) < confidence:
+            low = z
+        else:
+            high = z
+    half_width = z * stdev / math.sqrt(len(samples))
+    return {
+        "samples": list(samples),
+        "mean": mean,
+        "stdev": stdev,
+        "confidence": confidence,
+        "interval": (mean - half_width, mean + half_width),
+    }
@@ -0,0 +1,91 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+
+"""
+This file contains a helper to run many functions, each in its own gem5
+process, with a bounded number of processes at a time. Unlike `Pool`, a
+process which dies (e.g., because gem5 panicked) is reported through its exit
+code rather than making the pool wait for its result forever.
+"""
+
+from multiprocessing.connection import wait
+from os import cpu_count
+from typing import Any, Callable, Iterable, Optional, Tuple
+
+from .context import gem5Context
+
+
+def run_processes(
+    tasks: Iterable[Tuple[str, Callable, tuple, Any]],
+    processes: Optional[int] = None,
+    on_exit: Optional[Callable[[Any, int], None]] = None,
+    stop: Optional[Callable[[], bool]] = None,
+) -> None:
+    """
+    Runs every task in its own gem5 process.
+
+    :param tasks: The tasks, as tuples of the process name (which names its
+    output directory in the output directory of the main process), the
+    target function, its arguments, and a key passed to `on_exit`. The tasks
+    are only taken from the iterable as processes become free.
+    :param processes: The maximum number of concurrent gem5 processes. If
+    None, the number of host CPUs is used.
+    :param on_exit: Called with the key and the exit code of every task once
+    its process has exited.
+    :param stop: Called before starting every task. If it returns True, no
+    further tasks are started.
+    """
+    if processes is None:
+        processes = cpu_count() or 1
+    if processes < 1:
+        raise Exception("At least one process is needed to run the tasks.")
+
+    context = gem5Context()
+    pending = iter(tasks)
+    running = {}
+
+    def start_next() -> bool:
+        if stop and stop():
+            return False
+        task = next(pending, None)
+        if task is None:
+            return False
+        name, target, args, key = task
+        process = context.Process(target=target, args=args, name=name)
+        process.start()
+        running[process.sentinel] = (process, key)
+        return True
+
+    while len(running) < processes and start_next():
+        pass
+
+    while running:
+        for sentinel in wait(list(running)):
+            process, key = running.pop(sentinel)
+            process.join()
+            if on_exit:
+                on_exit(key, process.exitcode)
+            process.close()
+            start_next()
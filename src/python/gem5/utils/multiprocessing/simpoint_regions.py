@@ -0,0 +1,259 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+This file contains a workflow to simulate every SimPoint region of a
+workload in parallel, each region in its own gem5 process, and to combine the
+per-region statistics into weighted aggregates.
+
+The checkpoints are expected to be those taken with the
+`save_checkpoint_generator` on SIMPOINT_BEGIN exit events (see
+`configs/example/gem5_library/checkpoints/simpoints-se-checkpoint.py`), i.e.,
+one `cpt.<tick>` directory per SimPoint region.
+
+Example
+-------
+
+regions.py:
+
+```
+def run_region(checkpoint, region):
+    board = ... # Build the board as in simpoints-se-restore.py, restoring
+                # from `checkpoint`.
+    simulator = Simulator(board=board, on_exit_event=...)
+    simulator.run()
+    return simulator.get_stats()
+```
+
+run.py:
+
+```
+from gem5.utils.multiprocessing.simpoint_regions import (
+    find_simpoint_checkpoints,
+    run_simpoint_regions,
+)
+from regions import run_region
+
+if __name__ == "__m5_main__":
+    checkpoints = find_simpoint_checkpoints(Path("cpt_dir"), simpoint)
+    results = run_simpoint_regions(
+        run_region, checkpoints, simpoint.get_weight_list(), processes=8
+    )
+    print(results["aggregate"]["board.processor.cores.core.ipc"])
+```
+"""
+
+import gzip
+import os
+import shutil
+from pathlib import Path
+from typing import Any, Callable, Dict, List, Optional
+
+from .context import gem5Context
+
+# The chunk size used when expanding the memory images. This must be a
+# multiple of the host page size for the expanded images to be sparse.
+_chunk_size = 1 << 20
+
+
+def find_simpoint_checkpoints(checkpoint_dir: Path, simpoint) -> List[Path]:
+    """
+    Finds the checkpoint of every SimPoint region in `checkpoint_dir`.
+
+    The checkpoints are taken in the order of the regions' start
+    instructions, so the `cpt.<tick>` directories sorted by tick are matched
+    to the regions sorted by start instruction.
+
+    :param checkpoint_dir: The directory containing the `cpt.<tick>`
+    checkpoint directories.
+    :param simpoint: The `SimpointResource` (or `SimPoint`) the checkpoints
+    were taken with.
+
+    :returns: The checkpoint directory of each region, in the order of the
+    SimPoint's weight list.
+    """
+    checkpoints = sorted(
+        (
+            path
+            for path in Path(checkpoint_dir).iterdir()
+            if path.is_dir() and path.name.startswith("cpt.")
+        ),
+        key=lambda path: int(path.name.split(".", 1)[1]),
+    )
+
+    start_insts = simpoint.get_simpoint_start_insts()
+    if len(checkpoints) != len(start_insts):
+        raise Exception(
+            f"Found {len(checkpoints)} checkpoints in '{checkpoint_dir}' but "
+            f"the SimPoint has {len(start_insts)} regions."
+        )
+
+    order = sorted(range(len(start_insts)), key=lambda i: start_insts[i])
+    region_checkpoints = [None] * len(start_insts)
+    for region, checkpoint in zip(order, checkpoints):
+        region_checkpoints[region] = checkpoint
+    return region_checkpoints
+
+
+def prepare_memory_images(checkpoint: Path) -> None:
+    """
+    Expands the gzip'd physical memory images of a checkpoint, in place, into
+    uncompressed sparse files.
+
+    The checkpoint restore maps uncompressed images copy-on-write into the
+    backing store rather than reading them, so after this every worker
+    restoring from the checkpoint shares the same read-only image through
+    the host's page cache and only copies the pages it writes. Chunks of
+    zeros are skipped over rather than written, so the images only occupy
+    the host storage the non-zero memory needs.
+
+    :param checkpoint: The checkpoint directory.
+    """
+    for image in Path(checkpoint).glob("*.pmem"):
+        with open(image, "rb") as f:
+            if f.read(2) != b"\x1f\x8b":
+                # Already uncompressed.
+                continue
+
+        expanded = image.with_name(image.name + ".tmp")
+        with gzip.open(image, "rb") as src, open(expanded, "wb") as dst:
+            zeros = bytes(_chunk_size)
+            while True:
+                chunk = src.read(_chunk_size)
+                if not chunk:
+                    break
+                if chunk == zeros[: len(chunk)]:
+                    dst.seek(len(chunk), os.SEEK_CUR)
+                else:
+                    dst.write(chunk)
+            dst.truncate()
+        shutil.copymode(image, expanded)
+        os.replace(expanded, image)
+
+
+def _run_region(args) -> Dict:
+    """
+    The worker process entry point: runs a single region.
+    """
+    run_region, checkpoint, region = args
+    return run_region(checkpoint, region)
+
+
+def _flatten_stats(stats: Any, prefix: str = "") -> Dict[str, float]:
+    """
+    Flattens a JSON-style stats dictionary (as returned by
+    `Simulator.get_stats()`) into a dictionary of the scalar statistics keyed
+    by their dot-separated names.
+    """
+    flat = {}
+    if not isinstance(stats, dict):
+        return flat
+
+    if stats.get("type") == "Scalar" and isinstance(
+        stats.get("value"), (int, float)
+    ):
+        flat[prefix] = float(stats["value"])
+        return flat
+
+    for name, value in stats.items():
+        flat.update(
+            _flatten_stats(value, f"{prefix}.{name}" if prefix else name)
+        )
+    return flat
+
+
+def run_simpoint_regions(
+    run_region: Callable[[Path, int], Dict],
+    checkpoints: List[Path],
+    weights: List[float],
+    processes: Optional[int] = None,
+    prepare_images: bool = False,
+) -> Dict:
+    """
+    Simulates every SimPoint region in its own gem5 process and combines the
+    per-region statistics into weighted aggregates.
+
+    **Note:** As with the rest of `gem5.utils.multiprocessing`, `run_region`
+    must be importable from a module other than the main script.
+
+    :param run_region: The function simulating a single region. It is passed
+    the region's checkpoint directory and the region's index and returns the
+    region's stats as a JSON-style dictionary (e.g., the return of
+    `Simulator.get_stats()`).
+    :param checkpoints: The checkpoint directory of each region.
+    :param weights: The SimPoint weight of each region.
+    :param processes: The number of worker processes. If None, the number of
+    host CPUs is used.
+    :param prepare_images: If True, the checkpoints' memory images are
+    expanded once, before the workers start, with `prepare_memory_images`.
+    This rewrites the checkpoints in place, so it is off by default.
+
+    :returns: A dictionary containing the flattened scalar stats of every
+    region ("regions"), the normalized "weights", and the weighted mean of
+    every scalar stat present in all regions ("aggregate").
+    """
+    if len(checkpoints) != len(weights):
+        raise Exception(
+            f"{len(checkpoints)} checkpoints were given for "
+            f"{len(weights)} SimPoint weights."
+        )
+
+    if prepare_images:
+        for checkpoint in set(checkpoints):
+            prepare_memory_images(checkpoint)
+
+    # Each worker must be a fresh gem5 process, so each runs only one region.
+    with gem5Context().Pool(processes=processes, maxtasksperchild=1) as pool:
+        region_stats = pool.map(
+            _run_region,
+            [
+                (run_region, checkpoint, region)
+                for region, checkpoint in enumerate(checkpoints)
+            ],
+            chunksize=1,
+        )
+
+    regions = [_flatten_stats(stats) for stats in region_stats]
+
+    total_weight = sum(weights)
+    if total_weight <= 0:
+        raise Exception("The SimPoint weights must sum to a positive value.")
+    normalized = [weight / total_weight for weight in weights]
+
+    aggregate = {}
+    if regions:
+        common = set(regions[0]).intersection(*regions[1:])
+        for name in sorted(common):
+            aggregate[name] = sum(
+                weight * stats[name]
+                for weight, stats in zip(normalized, regions)
+            )
+
+    return {
+        "regions": regions,
+        "weights": normalized,
+        "aggregate": aggregate,
+    }
@@ -0,0 +1,205 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+
+"""
+This file contains a workflow to sweep the parameters of a simulation, such
+as the cache sizes, the branch predictor or the DRAM timings, running every
+configuration in its own gem5 process and gathering their statistics into one
+results table.
+
+All the configurations may restore from the same checkpoint. Its memory
+images are expanded once, before the sweep starts, so that every
+configuration maps them copy-on-write rather than inflating them again.
+
+Example
+-------
+
+configs.py:
+
+```
+def run_config(checkpoint, config):
+    board = ... # Build the board with config["l2_size"] and
+                # config["dram"], restoring from `checkpoint`.
+    simulator = Simulator(board=board, checkpoint_path=checkpoint)
+    simulator.run()
+    return simulator.get_stats()
+```
+
+run.py:
+
+```
+from gem5.utils.multiprocessing.sweep import (
+    product_configs,
+    run_sweep,
+    write_results_table,
+)
+from configs import run_config
+
+if __name__ == "__m5_main__":
+    results = run_sweep(
+        run_config,
+        product_configs(
+            l2_size=["256KiB", "1MiB", "4MiB"],
+            dram=["DDR4_2400_8x8", "LPDDR5_6400_1x16_BG_BL32"],
+        ),
+        checkpoint=Path("cpt"),
+        stats=["board.processor.cores.core.ipc"],
+    )
+    write_results_table(results, Path("sweep.csv"))
+```
+"""
+
+import csv
+import itertools
+import json
+from pathlib import Path
+from typing import Callable, Dict, Iterable, List, Optional
+
+from ._process_pool import run_processes
+from .simpoint_regions import _flatten_stats, prepare_memory_images
+
+# The name of the file a configuration's process leaves its stats in
+_stats_file = "sweep_stats.json"
+
+
+def product_configs(**axes: Iterable) -> List[Dict]:
+    """
+    Builds the configurations of a full factorial sweep.
+
+    :param axes: The values of every swept parameter, keyed by its name.
+
+    :returns: A configuration, as a dictionary of parameter values, per
+    combination of the values.
+    """
+    names = list(axes)
+    return [
+        dict(zip(names, values))
+        for values in itertools.product(*(axes[name] for name in names))
+    ]
+
+
+def _run_config(run_config, checkpoint, config: Dict) -> None:
+    """
+    The worker process entry point: runs a single configuration and leaves
+    its flattened scalar stats in the process' output directory.
+    """
+    from m5 import options
+
+    stats = _flatten_stats(run_config(checkpoint, config))
+    with open(Path(options.outdir) / _stats_file, "w") as f:
+        json.dump(stats, f)
+
+
+def run_sweep(
+    run_config: Callable[[Optional[Path], Dict], Dict],
+    configs: List[Dict],
+    checkpoint: Optional[Path] = None,
+    processes: Optional[int] = None,
+    stats: Optional[List[str]] = None,
+    prepare_images: bool = False,
+) -> List[Dict]:
+    """
+    Simulates every configuration in its own gem5 process and gathers their
+    statistics.
+
+    The output directory of the i-th configuration is `config<i>` in the
+    output directory of the main process.
+
+    **Note:** As with the rest of `gem5.utils.multiprocessing`, `run_config`
+    must be importable from a module other than the main script.
+
+    :param run_config: The function simulating a single configuration. It is
+    passed the checkpoint directory and the configuration, and returns the
+    stats as a JSON-style dictionary (e.g., the return of
+    `Simulator.get_stats()`).
+    :param configs: The configurations, as dictionaries of parameter values.
+    :param checkpoint: The checkpoint every configuration restores from, if
+    any.
+    :param processes: The maximum number of concurrent gem5 processes. If
+    None, the number of host CPUs is used.
+    :param stats: The names of the scalar stats to gather. If None, all the
+    scalar stats are gathered.
+    :param prepare_images: If True, the checkpoint's memory images are
+    expanded once, before the workers start, with `prepare_memory_images`.
+    This rewrites the checkpoint in place, so it is off by default.
+
+    :returns: A row per configuration, in the order of `configs`, holding
+    the configuration's parameters, its "exitcode" and the gathered stats. A
+    configuration whose process failed has no stats.
+    """
+    from m5 import options
+
+    if checkpoint is not None and prepare_images:
+        prepare_memory_images(checkpoint)
+
+    names = [f"config{i}" for i in range(len(configs))]
+    rows = [dict(config) for config in configs]
+
+    def on_exit(index: int, exitcode: int) -> None:
+        row = rows[index]
+        row["exitcode"] = exitcode
+        stats_path = Path(options.outdir) / names[index] / _stats_file
+        if exitcode != 0 or not stats_path.is_file():
+            return
+        with open(stats_path) as f:
+            config_stats = json.load(f)
+        if stats is None:
+            row.update(config_stats)
+        else:
+            row.update(
+                (name, config_stats[name])
+                for name in stats
+                if name in config_stats
+            )
+
+    run_processes(
+        (
+            (names[i], _run_config, (run_config, checkpoint, config), i)
+            for i, config in enumerate(configs)
+        ),
+        processes,
+        on_exit,
+    )
+    return rows
+
+
+def write_results_table(rows: List[Dict], path: Path) -> None:
+    """
+    Writes the rows returned by `run_sweep` as a CSV table, with a column per
+    parameter or stat present in any row. The cells of the stats a row lacks
+    are left empty.
+
+    :param rows: The rows of the table.
+    :param path: The CSV file to write.
+    """
+    # An insertion ordered set of the column names
+    columns = {}
+    for row in rows:
+        columns.update(dict.fromkeys(row))
+
+    with open(path, "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=list(columns))
+        writer.writeheader()
+        writer.writerows(rows)
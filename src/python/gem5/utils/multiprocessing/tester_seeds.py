@@ -0,0 +1,161 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+
+"""
+This file contains a workflow to run a memory tester (e.g., `MemTest` or
+`RubyTester`) with many random seeds in parallel, each seed in its own gem5
+process, and to gather the seeds that failed with a command line to reproduce
+each of them.
+
+A seed fails if its gem5 process does not exit cleanly, e.g., because the
+tester panicked on a wrong value, or if the function running it returns
+False.
+
+Example
+-------
+
+seeds.py:
+
+```
+import m5
+from m5.objects import *
+
+def run_seed(seed, run_length):
+    system = ... # Build the tester system, e.g., as in memtest.py, with
+                 # `max_loads=run_length`.
+    root = Root(full_system=False, system=system)
+    m5.instantiate()
+    exit_event = m5.simulate()
+    return exit_event.getCause() == "maximum number of loads reached"
+```
+
+run.py:
+
+```
+from gem5.utils.multiprocessing.tester_seeds import run_tester_seeds
+from seeds import run_seed
+
+if __name__ == "__m5_main__":
+    failures = run_tester_seeds(
+        run_seed,
+        seeds=range(10000),
+        run_length=lambda seed: 10000 * (1 + seed % 10),
+        reproducer=lambda seed, length: (
+            f"gem5.opt configs/example/memtest.py "
+            f"--random-seed={seed} --maxloads={length}"
+        ),
+    )
+    for failure in failures:
+        print(failure["reproducer"])
+```
+"""
+
+import sys
+from typing import Callable, Dict, Iterable, List, Optional, Union
+
+from ._process_pool import run_processes
+
+
+def _run_seed(run_tester, seed: int, run_length: int) -> None:
+    """
+    The worker process entry point: seeds the random number generator before
+    the tester system is built, and runs a single seed.
+    """
+    from _m5.core import seedRandom
+
+    seedRandom(seed)
+    if run_tester(seed, run_length) is False:
+        sys.exit(1)
+
+
+def run_tester_seeds(
+    run_tester: Callable[[int, int], Optional[bool]],
+    seeds: Iterable[int],
+    run_length: Union[int, Callable[[int], int]],
+    processes: Optional[int] = None,
+    reproducer: Optional[Callable[[int, int], str]] = None,
+    max_failures: Optional[int] = None,
+) -> List[Dict]:
+    """
+    Runs a tester with every seed, each seed in its own gem5 process, with up
+    to `processes` processes at a time.
+
+    The gem5 processes are spawned rather than forked, so that every seed
+    builds its system in a fresh process. The output directory of each seed
+    is `seed<seed>` in the output directory of the main process.
+
+    **Note:** As with the rest of `gem5.utils.multiprocessing`, `run_tester`
+    must be importable from a module other than the main script.
+
+    :param run_tester: The function building and simulating the tester
+    system. It is passed the seed and the run length (e.g., the number of
+    loads or checks), and may return False to report a failure that did not
+    end the process.
+    :param seeds: The random seeds to run.
+    :param run_length: The run length of every seed, or a function returning
+    the run length of a seed.
+    :param processes: The maximum number of concurrent gem5 processes. If
+    None, the number of host CPUs is used.
+    :param reproducer: A function returning the command line reproducing a
+    seed, given the seed and its run length.
+    :param max_failures: If not None, no further seeds are started once this
+    many seeds have failed.
+
+    :returns: A list with a dictionary per failed seed, in the order the
+    seeds finished, containing the "seed", the "run_length", the process'
+    "exitcode" and the "reproducer" command line (None if no `reproducer` is
+    given).
+    """
+    failures = []
+
+    def tasks():
+        for seed in seeds:
+            length = run_length(seed) if callable(run_length) else run_length
+            yield (
+                f"seed{seed}",
+                _run_seed,
+                (run_tester, seed, length),
+                (seed, length),
+            )
+
+    def on_exit(key, exitcode: int) -> None:
+        seed, length = key
+        if exitcode != 0:
+            failures.append(
+                {
+                    "seed": seed,
+                    "run_length": length,
+                    "exitcode": exitcode,
+                    "reproducer": reproducer(seed, length)
+                    if reproducer
+                    else None,
+                }
+            )
+
+    def stop() -> bool:
+        return max_failures is not None and len(failures) >= max_failures
+
+    run_processes(tasks(), processes, on_exit, stop)
+    return failures
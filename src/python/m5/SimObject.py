@@ -118,6 +118,12 @@ instanceDict = {}
 # Did any of the SimObjects lack a header file?
 noCxxHeader = False
 
+# Per-class layout of the C++ params struct, see SimObject.getCCParams()
+ccParamsLayouts = {}
+
+# Per-class names of the params of a given type, see SimObject.find_any()
+paramsOfType = {}
+
 
 def public_value(key, value):
     return key.startswith("_") or isinstance(
@@ -133,6 +139,7 @@ class MetaSimObject(type):
     # Attributes that can be set only at initialization time
     init_keywords = {
         "abstract": bool,
+        "thread_safe_init": bool,
         "cxx_class": str,
         "cxx_type": str,
         "cxx_header": str,
@@ -173,6 +180,10 @@ class MetaSimObject(type):
                 value_dict[key] = val
         if "abstract" not in value_dict:
             value_dict["abstract"] = False
+        # A new C++ class has to declare its own init() and initState()
+        # thread safe, Python-only subclasses share their base's code.
+        if "type" in value_dict and "thread_safe_init" not in value_dict:
+            value_dict["thread_safe_init"] = False
         if "cxx_extra_bases" not in value_dict:
             value_dict["cxx_extra_bases"] = []
         if "cxx_exports" not in value_dict:
@@ -306,6 +317,7 @@ class MetaSimObject(type):
         assert not hasattr(pdesc, "name")
         pdesc.name = name
         cls._params[name] = pdesc
+        paramsOfType.clear()
         if hasattr(pdesc, "default"):
             cls._set_param(name, pdesc.default, pdesc)
 
@@ -611,6 +623,12 @@ class SimObject(object, metaclass=MetaSimObject):
     type = "SimObject"
     abstract = True
 
+    # Set in a class whose init() and initState() only touch the state
+    # of the object itself, to let Root.init_threads run those passes
+    # for its instances on several host threads. They must not schedule
+    # events, register stats or call into Python.
+    thread_safe_init = False
+
     cxx_header = "sim/sim_object.hh"
     cxx_class = "gem5::SimObject"
     cxx_extra_bases = ["Drainable", "Serializable", "statistics::Group"]
@@ -1034,17 +1052,32 @@ class SimObject(object, metaclass=MetaSimObject):
                     )
                 found_obj = child
         # search param space
-        for pname, pdesc in self._params.items():
-            if issubclass(pdesc.ptype, ptype):
-                match_obj = self._values[pname]
-                if found_obj != None and found_obj != match_obj:
-                    raise AttributeError(
-                        "parent.any matched more than one: %s and %s"
-                        % (found_obj.path, match_obj.path)
-                    )
-                found_obj = match_obj
+        for pname in self._paramsOfType(ptype):
+            match_obj = self._values[pname]
+            if found_obj != None and found_obj != match_obj:
+                raise AttributeError(
+                    "parent.any matched more than one: %s and %s"
+                    % (found_obj.path, match_obj.path)
+                )
+            found_obj = match_obj
         return found_obj, found_obj != None
 
+    # Names of the params whose type derives from ptype. Proxy resolution
+    # asks the same question of every object up the hierarchy, so the
+    # answer is cached per class.
+    @classmethod
+    def _paramsOfType(cls, ptype):
+        key = (cls, ptype)
+        names = paramsOfType.get(key)
+        if names is None:
+            names = [
+                pname
+                for pname, pdesc in cls._params.items()
+                if issubclass(pdesc.ptype, ptype)
+            ]
+            paramsOfType[key] = names
+        return names
+
     def find_all(self, ptype):
         all = {}
         # search children
@@ -1067,11 +1100,10 @@ class SimObject(object, metaclass=MetaSimObject):
                     child_all, done = child.find_all(ptype)
                     all.update(dict(zip(child_all, [done] * len(child_all))))
         # search param space
-        for pname, pdesc in self._params.items():
-            if issubclass(pdesc.ptype, ptype):
-                match_obj = self._values[pname]
-                if not isproxy(match_obj) and not isNullPointer(match_obj):
-                    all[match_obj] = True
+        for pname in self._paramsOfType(ptype):
+            match_obj = self._values[pname]
+            if not isproxy(match_obj) and not isNullPointer(match_obj):
+                all[match_obj] = True
         # Also make sure to sort the keys based on the objects' path to
         # ensure that the order is the same on all hosts
         return sorted(all.keys(), key=lambda o: o.path()), True
@@ -1180,49 +1212,74 @@ class SimObject(object, metaclass=MetaSimObject):
         cc_params = cc_params_struct()
         cc_params.name = str(self)
 
-        param_names = list(self._params.keys())
-        param_names.sort()
-        for param in param_names:
-            value = self._values.get(param)
-            if value is None:
-                fatal(
-                    "%s.%s without default or user set value",
-                    self.path(),
-                    param,
-                )
+        # Each level of the params struct is filled in with one call to its
+        # bulk setter rather than one attribute set per param.
+        for setter, params, ports in self._ccParamsLayout():
+            values = []
+            for param, is_vector in params:
+                value = self._values.get(param)
+                if value is None:
+                    fatal(
+                        "%s.%s without default or user set value",
+                        self.path(),
+                        param,
+                    )
 
-            value = value.getValue()
-            if isinstance(self._params[param], VectorParamDesc):
-                assert isinstance(value, list)
-                vec = getattr(cc_params, param)
-                assert not len(vec)
-                # Some types are exposed as opaque types. They support
-                # the append operation unlike the automatically
-                # wrapped types.
-                if isinstance(vec, list):
-                    setattr(cc_params, param, list(value))
-                else:
-                    for v in value:
-                        getattr(cc_params, param).append(v)
-            else:
-                setattr(cc_params, param, value)
+                value = value.getValue()
+                if is_vector:
+                    assert isinstance(value, list)
+                    value = list(value)
+                values.append(value)
 
-        port_names = list(self._ports.keys())
-        port_names.sort()
-        for port_name in port_names:
-            port = self._port_refs.get(port_name, None)
-            if port != None:
-                port_count = len(port)
+            for port_name in ports:
+                port = self._port_refs.get(port_name, None)
+                values.append(len(port) if port != None else 0)
+
+            if setter:
+                setter(cc_params, tuple(values))
             else:
-                port_count = 0
-            setattr(
-                cc_params,
-                "port_" + port_name + "_connection_count",
-                port_count,
-            )
+                names = [param for param, is_vector in params] + [
+                    f"port_{port_name}_connection_count" for port_name in ports
+                ]
+                for name, value in zip(names, values):
+                    setattr(cc_params, name, value)
+
         self._ccParams = cc_params
         return self._ccParams
 
+    # The layout getCCParams() fills in, one entry per class from the root
+    # of the hierarchy down: the bulk setter of the class' params struct,
+    # the sorted (name, is_vector) pairs of the params it declares and the
+    # sorted names of the ports it declares. Python-only subclasses have
+    # no params struct of their own, so anything they declare is set one
+    # attribute at a time.
+    @classmethod
+    def _ccParamsLayout(cls):
+        layout = ccParamsLayouts.get(cls)
+        if layout is not None:
+            return layout
+
+        import m5.internal.params
+
+        layout = []
+        klass = cls
+        while klass is not None:
+            params = [
+                (name, isinstance(pdesc, VectorParamDesc))
+                for name, pdesc in sorted(klass._params.local.items())
+            ]
+            ports = sorted(klass._ports.local.keys())
+            setter = None
+            if "type" in klass._value_dict:
+                struct = getattr(m5.internal.params, f"{klass.type}Params")
+                setter = struct._set_local_params
+            if setter or params or ports:
+                layout.append((setter, params, ports))
+            klass = klass._base
+        layout.reverse()
+        ccParamsLayouts[cls] = layout
+        return layout
+
     # Get C++ object corresponding to this object, calling C++ if
     # necessary to construct it.  Does *not* recursively create
     # children.
@@ -275,6 +275,13 @@ def parse_options():
         help="Sets the output file for debug. Append '.gz' to the name for it"
         " to be compressed automatically [Default: %default]",
     )
+    option(
+        "--debug-binary",
+        action="store_true",
+        default=False,
+        help="Write the debug output in a compact binary format from a "
+        "background thread. Decode it with util/decode_binary_trace.py",
+    )
     option(
         "--debug-activate",
         metavar="EXPR[,EXPR]",
@@ -562,7 +569,7 @@ def main():
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    trace.output(options.debug_file, options.debug_binary)
 
     for activate in options.debug_activate:
         _check_tracing()
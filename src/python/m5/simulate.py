@@ -53,6 +53,7 @@ from . import objects
 from . import params
 from m5.util.dot_writer import do_dot, do_dvfs_dot
 from m5.util.dot_writer_ruby import do_ruby_dot
+from m5.util import partition
 
 from .util import fatal, warn
 from .util import attrdict
@@ -92,10 +93,17 @@ def instantiate(ckpt_dir=None):
     for obj in root.descendants():
         obj.unproxyParams()
 
+    if root.eventq_partitions > 1:
+        partition.partition(root, int(root.eventq_partitions))
+
+    # The hierarchy is fixed from here on, so walk it once and reuse the
+    # result for all the passes below.
+    objs = list(root.descendants())
+
     if options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), "w")
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(objs, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
@@ -120,25 +128,26 @@ def instantiate(ckpt_dir=None):
     stats.initSimStats()
 
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants():
+    for obj in objs:
         obj.createCCObject()
-    for obj in root.descendants():
+    for obj in objs:
         obj.connectPorts()
 
+    _register_lookahead(root)
+
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants():
-        obj.init()
+    _init_pass(root, objs, "init")
 
     # Do a third pass to initialize statistics
     stats._bindStatHierarchy(root)
     root.regStats()
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants():
+    for obj in objs:
         obj.regProbePoints()
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants():
+    for obj in objs:
         obj.regProbeListeners()
 
     # We want to generate the DVFS diagram for the system. This can only be
@@ -154,17 +163,37 @@ def instantiate(ckpt_dir=None):
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
-        for obj in root.descendants():
+        for obj in objs:
             obj.loadState(ckpt)
     else:
-        for obj in root.descendants():
-            obj.initState()
+        _init_pass(root, objs, "initState")
 
     # Check to see if any of the stat events are in the past after resuming from
     # a checkpoint, If so, this call will shift them to be at a valid time.
     updateStatEvents()
 
 
+def _init_pass(root, objs, phase):
+    """Call phase (init or initState) on all the objects. With more than
+    one Root.init_threads the objects whose class is thread_safe_init go
+    first, on a pool of host threads, and the rest follow in order."""
+    threads = int(root.init_threads)
+    if threads != 1:
+        parallel = [obj for obj in objs if obj.thread_safe_init]
+        if parallel:
+            _m5.core.parallelInitPhase(
+                [obj.getCCObject() for obj in parallel], phase, threads
+            )
+            objs = [obj for obj in objs if not obj.thread_safe_init]
+    for obj in objs:
+        getattr(obj, phase)()
+
+
+def _register_lookahead(root):
+    for src, dst, latency in partition.cross_queue_links(root):
+        _m5.event.registerLookahead(src, dst, latency)
+
+
 need_startup = True
 
 
@@ -262,6 +291,35 @@ def scheduleTickExitAbsolute(
     _m5.event.exitSimLoop(exit_string, 0, tick, 0, False)
 
 
+def setExitAction(
+    exit_string: str, action: str = "continue", limit: int = 0
+) -> None:
+    """Handles the exit events with `exit_string` as their cause in C++ and
+    keeps simulating, rather than returning from `simulate()`. This saves
+    a round trip through Python for frequent exits, e.g., per-iteration
+    work items.
+
+    :param exit_string: The cause of the exit events to handle.
+    :param action: What to do on each exit: "continue", "dump_stats",
+    "reset_stats" or "dump_reset_stats".
+    :param limit: The number of exits to handle before returning the next
+    ones from `simulate()` again, 0 for no limit.
+    """
+    _m5.event.registerExitAction(exit_string, action, limit)
+
+
+def clearExitAction(exit_string: str) -> None:
+    """Returns the exit events with `exit_string` as their cause from
+    `simulate()` again."""
+    _m5.event.removeExitHandler(exit_string)
+
+
+def getExitActionCount(exit_string: str) -> int:
+    """Returns the number of exit events with `exit_string` as their cause
+    handled by the action set with `setExitAction()`."""
+    return _m5.event.exitActionCount(exit_string)
+
+
 def drain():
     """Drain the simulator in preparation of a checkpoint or memory mode
     switch.
@@ -319,6 +377,36 @@ def checkpoint(dir):
     _m5.core.serializeAll(dir)
 
 
+def saveWarmState(dir):
+    """Save a snapshot of the warm microarchitectural state of the
+    simulated system (e.g., cache contents and branch predictor tables),
+    which checkpoints don't include. The snapshot can be loaded with
+    loadWarmState() into a different, but compatible, configuration, e.g.,
+    one restored from a checkpoint taken at the same point.
+    """
+    root = objects.Root.getInstance()
+    if not isinstance(root, objects.Root):
+        raise TypeError("Warm state must be saved from a root object.")
+
+    drain()
+    print("Writing warm state")
+    _m5.core.saveWarmStateAll(dir)
+
+
+def loadWarmState(dir):
+    """Load a snapshot saved by saveWarmState() into the objects of the
+    simulated system with the same names. This must be called after
+    instantiate(). Loading the caches accesses the memory system, so the
+    statistics should be reset afterwards.
+    """
+    if not _instantiated:
+        raise RuntimeError("Warm state must be loaded after instantiate().")
+
+    drain()
+    print("Loading warm state")
+    _m5.core.loadWarmStateAll(dir)
+
+
 def _changeMemoryMode(system, mode):
     if not isinstance(system, (objects.Root, objects.System)):
         raise TypeError(
@@ -448,6 +536,14 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     drain()
 
+    # The child does not inherit the handling of the memory that is
+    # still to be restored from a checkpoint on demand, so finish
+    # restoring it first.
+    root = objects.Root.getInstance()
+    for obj in root.descendants():
+        if isinstance(obj, objects.System):
+            obj.completeLazyRestore()
+
     # Terminate helper threads that service parallel event queues.
     _m5.event.terminateEventQueueThreads()
 
@@ -458,7 +554,6 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     if pid == 0:
         # In child, notify objects of the fork
-        root = objects.Root.getInstance()
         notifyFork(root)
         # Setup a new output directory
         parent = options.outdir
@@ -48,6 +48,8 @@ from m5.util import attrdict, fatal
 # Stat exports
 from _m5.stats import schedStatEvent as schedEvent
 from _m5.stats import periodicStatDump
+from _m5.stats import periodicSnapshotDump
+from _m5.stats import exportSharedMemory
 
 outputList = []
 
@@ -130,23 +132,31 @@ def _url_factory(schemes, enable=True):
 
 
 @_url_factory([None, "", "text", "file"])
-def _textFactory(fn, desc=True, spaces=True):
+def _textFactory(fn, desc=True, spaces=True, changed=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
     description. The description is enabled by default, but can be
     disabled by setting the desc parameter to False.
 
+    When changed is set, each dump only contains the stats that changed
+    since the previous dump, which makes frequent dumps much cheaper
+    for time-series studies. Stats that can't track their changes
+    (e.g., Values, Averages and the formulas using them) are always
+    output.
+
     Parameters:
       * desc (bool): Output stat descriptions (default: True)
       * spaces (bool): Output alignment spaces (default: True)
+      * changed (bool): Only output the changed stats (default: False)
 
     Example:
       text://stats.txt?desc=False;spaces=False
+      text://stats.txt?changed=True
 
     """
 
-    return _m5.stats.initText(fn, desc, spaces)
+    return _m5.stats.initText(fn, desc, spaces, changed)
 
 
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
@@ -186,6 +196,29 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
 
+@_url_factory(["col"])
+def _columnarFactory(fn):
+    """Output stats in a binary, columnar format.
+
+    The names, units and descriptions of the stats are written once to a
+    JSON schema (the stat file name with a ".json" suffix), and each dump
+    appends the raw values of the stats to the stat file. This makes the
+    dumps much cheaper than the text format when dumping large systems
+    often. The stat files are read with m5.stats.columnar, which does not
+    need gem5 to be imported.
+
+    Known limitations:
+      * Sparse histograms currently unsupported.
+      * No support for forking.
+
+    Example:
+      col://stats.col
+
+    """
+
+    return _m5.stats.initColumnar(fn)
+
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -384,6 +417,27 @@ lastDump = 0
 global_dump_roots = []
 
 
+def _clear_changed(roots=None):
+    """Clear the changes of the stats dumped from roots, so the next dump
+    can tell which of them changed."""
+
+    def clear_group(group):
+        for stat in group.getStats():
+            stat.clearChanged()
+        for g in group.getStatGroups().values():
+            clear_group(g)
+
+    if roots:
+        for root in roots:
+            clear_group(root)
+    else:
+        clear_group(Root.getInstance())
+
+        # Legacy stats
+        for stat in stats_list:
+            stat.clearChanged()
+
+
 def dump(roots=None):
     """Dump all statistics data to the registered outputs"""
 
@@ -413,6 +467,11 @@ def dump(roots=None):
             sim_root.preDumpStats()
         prepare()
 
+    _dump_outputs(all_roots)
+    _clear_changed(all_roots)
+
+
+def _dump_outputs(all_roots):
     for output in outputList:
         if isinstance(output, JsonOutputVistor):
             if not all_roots:
@@ -426,6 +485,20 @@ def dump(roots=None):
                 output.end()
 
 
+def snapshot():
+    """Dump a snapshot of all statistics data to the registered outputs
+    without stopping the other event queues.
+
+    Snapshots are taken by the first main event queue while the other
+    queues keep running, so they don't need a barrier. Sharded stats
+    (ShardedScalar and ShardedVector) are read atomically. The other stats
+    owned by other queues may be read while they are updated, and the
+    stats aren't prepared, so e.g. distributions show their values at the
+    last full dump. Snapshots don't clear the stat changes."""
+
+    _dump_outputs(list(global_dump_roots))
+
+
 def reset():
     """Reset all statistics to the base state"""
 
@@ -0,0 +1,185 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+A reader for the stat files written by the columnar stat visitor
+(`col://stats.col`). It only depends on the Python standard library, so it
+can be used outside of gem5.
+
+The data file is mapped rather than read, and the values of a stat are only
+unpacked when they are asked for.
+
+Example:
+
+```
+with ColumnarStats("m5out/stats.col") as stats:
+    ticks = stats.ticks()
+    ipc = stats.column("system.cpu.ipc")
+    misses = stats.values("system.cpu.dcache.overallMisses")
+```
+"""
+
+import json
+import mmap
+import struct
+from typing import Any, Dict, List, Tuple, Union
+
+_magic = b"gem5stat"
+_file_header = struct.Struct("=8sII")
+_record_header = struct.Struct("=IIQQ")
+_value_size = struct.calcsize("=d")
+
+
+class ColumnarStats:
+    """
+    The dumps of a columnar stat file.
+
+    Every dump has a layout, the set of stats it holds, which is the same
+    for all the dumps unless only some subtrees of the stats are dumped.
+    The stats missing in the layout of a dump are skipped for that dump.
+    """
+
+    def __init__(self, path: str):
+        """
+        :param path: The path of the data file. The schema is read from the
+        same path with a ".json" suffix.
+        """
+        with open(f"{path}.json") as f:
+            schema = json.load(f)
+
+        self._file = open(path, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+
+        magic, version, header_size = _file_header.unpack_from(self._map, 0)
+        if magic != _magic:
+            raise ValueError(f"'{path}' is not a columnar stat file.")
+        if version != schema["version"]:
+            raise ValueError(
+                f"The version of '{path}' ({version}) does not match the "
+                f"version of its schema ({schema['version']})."
+            )
+
+        self._layouts = [
+            {stat["name"]: stat for stat in layout["stats"]}
+            for layout in schema["layouts"]
+        ]
+
+        # Index the dumps, ignoring a last record that is being written
+        self._dumps = []
+        offset = header_size
+        end = len(self._map)
+        while offset + _record_header.size <= end:
+            layout, _, tick, size = _record_header.unpack_from(
+                self._map, offset
+            )
+            offset += _record_header.size
+            if offset + size * _value_size > end:
+                break
+            self._dumps.append((layout, tick, offset // _value_size))
+            offset += size * _value_size
+
+        view = memoryview(self._map)
+        self._view = view
+        self._values = view[: end - end % _value_size].cast("d")
+
+    def close(self) -> None:
+        """Unmap and close the data file."""
+        self._values.release()
+        self._view.release()
+        self._map.close()
+        self._file.close()
+
+    def __enter__(self) -> "ColumnarStats":
+        return self
+
+    def __exit__(self, *args) -> None:
+        self.close()
+
+    def __len__(self) -> int:
+        """The number of dumps."""
+        return len(self._dumps)
+
+    def ticks(self) -> List[int]:
+        """The tick of each dump."""
+        return [tick for _, tick, _ in self._dumps]
+
+    def names(self) -> List[str]:
+        """The names of all the stats, in any of the dumps."""
+        names = set()
+        for layout in self._layouts:
+            names.update(layout)
+        return sorted(names)
+
+    def stat(self, name: str) -> Dict[str, Any]:
+        """
+        The schema of a stat: its "type", "unit", "desc", number of values
+        ("size"), and its type specific fields, e.g., "subnames".
+        """
+        for layout in self._layouts:
+            if name in layout:
+                return layout[name]
+        raise KeyError(name)
+
+    def _find(self, name: str):
+        found = False
+        for layout, tick, first in self._dumps:
+            stat = self._layouts[layout].get(name)
+            if stat is not None:
+                found = True
+                yield tick, first + stat["offset"], stat["size"]
+        if not found:
+            raise KeyError(name)
+
+    def values(
+        self, name: str
+    ) -> List[Tuple[int, Union[float, List[float]]]]:
+        """
+        The values of a stat in every dump holding it, with the tick of the
+        dump. The value of a scalar is a float, and the value of any other
+        stat is the list of its values, e.g., the elements of a vector or
+        the fields and buckets of a distribution.
+        """
+        if self.stat(name)["type"] == "scalar":
+            return [(tick, self._values[i]) for tick, i, _ in self._find(name)]
+        return [
+            (tick, self._values[i : i + size].tolist())
+            for tick, i, size in self._find(name)
+        ]
+
+    def column(self, name: str, index: int = 0) -> List[float]:
+        """
+        One of the values of a stat, in every dump holding it.
+
+        :param name: The name of the stat.
+        :param index: The index of the value within the stat, e.g., of the
+        element of a vector.
+        """
+        column = []
+        for _, i, size in self._find(name):
+            if not 0 <= index < size:
+                raise IndexError(f"{name} has {size} values.")
+            column.append(self._values[i + index])
+        return column
@@ -0,0 +1,230 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Helpers to split a SimObject graph across multiple event queues.
+
+Objects that talk to each other through ports need to be on the same
+event queue unless the link between them goes through an object that
+can safely cross event queues (e.g., a Bridge or a ThreadBridge). Such
+objects name the port on which they can be cut from their peer with the
+_partition_port class attribute. Conversely, objects name the ports
+that must never be cut, even if their peer can cross event queues, with
+the _partition_bind class attribute. Objects without any ports follow
+the event queue of their parent.
+
+Only port links are considered. Objects that interact in other ways
+must not be split, so everything below a Ruby system is kept on a single
+event queue, unless its parallel_controllers parameter is set. Each
+Ruby controller is then kept together with the Ruby ports it drives,
+and the message buffers, which follow the event queue of their parent,
+are cut from the network.
+"""
+
+from m5.SimObject import SimObject
+from m5.util import fatal, inform
+
+# Relative event rate of common object types, used to balance the
+# partitions. Objects match the first entry that appears in their class
+# hierarchy, anything else has a weight of 1.
+_event_rate_weights = {
+    "BaseCPU": 100,
+    "ComputeUnit": 100,
+    "BaseCache": 20,
+    "RubyController": 20,
+    "RubyNetwork": 40,
+    "GarnetRouter": 10,
+    "BaseXBar": 10,
+    "MemCtrl": 10,
+    "AbstractMemory": 5,
+}
+
+
+# All objects below an instance of these types stay together
+_unsplittable = ("RubySystem",)
+
+
+def _weight(obj):
+    for cls in type(obj).__mro__:
+        weight = _event_rate_weights.get(cls.__name__)
+        if weight is not None:
+            return weight
+    return 1
+
+
+def _port_links(root):
+    """Yield (obj, port name, peer obj, peer port name) for every port
+    link in the hierarchy, once per link."""
+    for obj in root.descendants():
+        for port in obj._port_refs.values():
+            for ref in getattr(port, "elements", [port]):
+                # Only visit each link once, from its request side
+                if ref is None or not ref.peer or not ref.is_source:
+                    continue
+                yield obj, ref.name, ref.peer.simobj, ref.peer.name
+
+
+def _port_attr(obj, attr, port_name):
+    ports = getattr(type(obj), attr, ())
+    if isinstance(ports, str):
+        ports = (ports,)
+    return port_name in ports
+
+
+def _cuttable(obj, port_name):
+    return _port_attr(obj, "_partition_port", port_name)
+
+
+def _bound(obj, port_name):
+    return _port_attr(obj, "_partition_bind", port_name)
+
+
+def _is_a(obj, class_name):
+    return any(cls.__name__ == class_name for cls in type(obj).__mro__)
+
+
+def _follows_parent(obj):
+    return getattr(type(obj), "_partition_follow_parent", False)
+
+
+def _lookahead(obj):
+    fn = getattr(type(obj), "lookahead", None)
+    return fn(obj) if fn else 0
+
+
+def cross_queue_links(root):
+    """Find all port links between objects on different event queues.
+
+    Returns a list of (source queue, destination queue, latency) tuples,
+    with one entry per direction of each link. The latency is the
+    lookahead of the object at either end of the link (e.g., the delay
+    of a Bridge), or zero if neither end provides one.
+    """
+    links = []
+    for obj, _, peer, _ in _port_links(root):
+        src, dst = int(obj.eventq_index), int(peer.eventq_index)
+        if src == dst:
+            continue
+        latency = max(_lookahead(obj), _lookahead(peer))
+        links.append((src, dst, latency))
+        links.append((dst, src, latency))
+    return links
+
+
+def partition(root, num_queues):
+    """Assign the objects under root to num_queues event queues.
+
+    Objects connected through ports that cannot be cut are grouped
+    together, and the groups are then distributed over the queues by
+    decreasing weight, always picking the least loaded queue. This
+    overrides any eventq_index set in the configuration.
+    """
+    if int(root.sim_quantum) == 0:
+        fatal("Event queue partitioning requires Root.sim_quantum to be set")
+
+    # Union-find over all objects with port links
+    leader = {}
+
+    def find(obj):
+        leader.setdefault(obj, obj)
+        while leader[obj] is not obj:
+            leader[obj] = leader[leader[obj]]
+            obj = leader[obj]
+        return obj
+
+    for obj in root.descendants():
+        if not any(_is_a(obj, name) for name in _unsplittable):
+            continue
+        if obj.parallel_controllers:
+            for ctrl in obj.descendants():
+                if not _is_a(ctrl, "RubyController"):
+                    continue
+                find(ctrl)
+                for value in ctrl._values.values():
+                    for port in value if isinstance(value, list) else [value]:
+                        if isinstance(port, SimObject) and _is_a(
+                            port, "RubyPort"
+                        ):
+                            leader[find(port)] = find(ctrl)
+        else:
+            for child in obj.descendants():
+                leader[find(child)] = find(obj)
+
+    cuts = []
+    for obj, name, peer, peer_name in _port_links(root):
+        if _bound(obj, name) or _bound(peer, peer_name):
+            leader[find(obj)] = find(peer)
+        elif _cuttable(obj, name) or _cuttable(peer, peer_name):
+            for end in (obj, peer):
+                if not _follows_parent(end):
+                    find(end)
+            cuts.append((obj, name, peer, peer_name))
+        else:
+            leader[find(obj)] = find(peer)
+
+    groups = {}
+    for obj in leader:
+        groups.setdefault(find(obj), []).append(obj)
+    groups = sorted(
+        groups.values(),
+        key=lambda g: (-sum(_weight(o) for o in g), min(o.path() for o in g)),
+    )
+
+    load = [0] * num_queues
+    for group in groups:
+        queue = load.index(min(load))
+        load[queue] += sum(_weight(o) for o in group)
+        for obj in group:
+            obj.eventq_index = queue
+
+    # Objects without ports run on the same queue as their parent
+    for obj in root.descendants():
+        parent = obj.get_parent()
+        if obj not in leader and parent is not None:
+            obj.eventq_index = int(parent.eventq_index)
+
+    inform(
+        "Partitioned %d objects in %d groups over %d event queues",
+        len(leader),
+        len(groups),
+        num_queues,
+    )
+    for queue, weight in enumerate(load):
+        inform("  eventq %d: weight %d", queue, weight)
+    for obj, name, peer, peer_name in cuts:
+        src, dst = int(obj.eventq_index), int(peer.eventq_index)
+        if src == dst:
+            continue
+        latency = max(_lookahead(obj), _lookahead(peer))
+        inform(
+            "  cut %s.%s (eventq %d) -> %s.%s (eventq %d), lookahead %s",
+            obj.path(),
+            name,
+            src,
+            peer.path(),
+            peer_name,
+            dst,
+            f"{latency} ticks" if latency else "sim_quantum",
+        )
@@ -49,6 +49,7 @@
 #include "base/inet.hh"
 #include "base/loader/elf_object.hh"
 #include "base/logging.hh"
+#include "base/parallel.hh"
 #include "base/random.hh"
 #include "base/socket.hh"
 #include "base/temperature.hh"
@@ -56,6 +57,7 @@
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 #include "sim/drain.hh"
+#include "sim/eventq.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_object.hh"
 #include "cpu/probes/pc_count_pair.hh"
@@ -86,6 +88,33 @@ PybindSimObjectResolver::resolveSimObject(const std::string &name)
 extern const char *compileDate;
 extern const char *gem5Version;
 
+/**
+ * Run one initialization phase of the given objects on up to threads
+ * host threads. The objects' classes must have declared the phase
+ * thread safe (SimObject.thread_safe_init in Python).
+ */
+static void
+parallelInitPhase(const std::vector<SimObject *> &objects,
+                  const std::string &phase, unsigned threads)
+{
+    void (SimObject::*func)();
+    if (phase == "init")
+        func = &SimObject::init;
+    else if (phase == "initState")
+        func = &SimObject::initState;
+    else
+        throw py::value_error("No parallel initialization phase " + phase);
+
+    // Worker threads need the current queue to read the current tick
+    EventQueue *eventq = curEventQueue();
+
+    py::gil_scoped_release release;
+    parallelFor(hostThreads(threads), objects.size(), [&](size_t i) {
+        curEventQueue(eventq);
+        (objects[i]->*func)();
+    });
+}
+
 static void
 init_drain(py::module_ &m_native)
 {
@@ -311,6 +340,7 @@ pybind_init_core(py::module_ &m_native)
         .def("listenersDisabled", &ListenSocket::allDisabled)
         .def("listenersLoopbackOnly", &ListenSocket::loopbackOnly)
         .def("seedRandom", [](uint64_t seed) { random_mt.init(seed); })
+        .def("parallelInitPhase", &parallelInitPhase)
 
 
         .def("fixClockFrequency", &fixClockFrequency)
@@ -334,6 +364,8 @@ pybind_init_core(py::module_ &m_native)
      */
     m_core
         .def("serializeAll", &SimObject::serializeAll)
+        .def("saveWarmStateAll", &SimObject::saveWarmStateAll)
+        .def("loadWarmStateAll", &SimObject::loadWarmStateAll)
         .def("getCheckpoint", [](const std::string &cpt_dir) {
             SimObject::setSimObjectResolver(&pybindSimObjectResolver);
             return new CheckpointIn(cpt_dir);
@@ -45,10 +45,12 @@
 #include <map>
 #include <vector>
 
+#include "base/binary_trace.hh"
 #include "base/compiler.hh"
 #include "base/debug.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
+#include "sim/core.hh"
 #include "sim/debug.hh"
 
 namespace py = pybind11;
@@ -57,10 +59,23 @@ namespace gem5
 {
 
 static void
-output(const char *filename)
+output(const char *filename, bool binary)
 {
     OutputStream *file_stream = simout.find(filename);
 
+    if (binary) {
+        fatal_if(file_stream, "Binary debug output needs a new file, "
+                 "not '%s'.", filename);
+        file_stream = simout.create(filename, true);
+
+        // The background thread of the logger must be done writing
+        // before the file is closed
+        auto *logger = new trace::BinaryLogger(*file_stream->stream());
+        trace::setDebugLogger(logger);
+        registerExitCallback([logger]() { logger->close(); });
+        return;
+    }
+
     if (!file_stream)
         file_stream = simout.create(filename);
 
@@ -128,7 +143,8 @@ pybind_init_debug(py::module_ &m_native)
 
     py::module_ m_trace = m_native.def_submodule("trace");
     m_trace
-        .def("output", &output)
+        .def("output", &output, py::arg("filename"),
+             py::arg("binary") = false)
         .def("activate", &activate)
         .def("ignore", &ignore)
         .def("enable", &trace::enable)
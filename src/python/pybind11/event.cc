@@ -110,7 +110,15 @@ pybind_init_event(py::module_ &m_native)
     m.def("setMaxTick", &set_max_tick, py::arg("tick"));
     m.def("getMaxTick", &get_max_tick, py::return_value_policy::copy);
     m.def("terminateEventQueueThreads", &terminateEventQueueThreads);
+    m.def("registerLookahead", &registerLookahead,
+          py::arg("src"), py::arg("dst"), py::arg("latency"));
     m.def("exitSimLoop", &exitSimLoop);
+    m.def("registerExitAction", &registerExitAction,
+          py::arg("cause"), py::arg("action"), py::arg("limit") = 0);
+    m.def("removeExitHandler", [](const std::string &cause) {
+            registerExitHandler(cause, ExitHandler());
+        }, py::arg("cause"));
+    m.def("exitActionCount", &exitActionCount, py::arg("cause"));
     m.def("getEventQueue", []() { return curEventQueue(); },
           py::return_value_policy::reference);
     m.def("setEventQueue", [](EventQueue *q) { return curEventQueue(q); });
@@ -42,6 +42,7 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/columnar.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -100,6 +101,13 @@ pythonReset()
     m.attr("reset")();
 }
 
+void
+pythonSnapshot()
+{
+    py::module_ m = py::module_::import("m5.stats");
+    m.attr("snapshot")();
+}
+
 }
 
 void
@@ -114,10 +122,14 @@ pybind_init_stats(py::module_ &m_native)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
+        .def("initColumnar", &statistics::initColumnar)
         .def("registerPythonStatsHandlers",
              &statistics::registerPythonStatsHandlers)
         .def("schedStatEvent", &statistics::schedStatEvent)
         .def("periodicStatDump", &statistics::periodicStatDump)
+        .def("schedSnapshotEvent", &statistics::schedSnapshotEvent)
+        .def("periodicSnapshotDump", &statistics::periodicSnapshotDump)
+        .def("exportSharedMemory", &statistics::exportSharedMemory)
         .def("updateEvents", &statistics::updateEvents)
         .def("processResetQueue", &statistics::processResetQueue)
         .def("processDumpQueue", &statistics::processDumpQueue)
@@ -151,6 +163,8 @@ pybind_init_stats(py::module_ &m_native)
         .def("prepare", &statistics::Info::prepare)
         .def("reset", &statistics::Info::reset)
         .def("zero", &statistics::Info::zero)
+        .def("changed", &statistics::Info::changed)
+        .def("clearChanged", &statistics::Info::clearChanged)
         .def("visit", &statistics::Info::visit)
         ;
 
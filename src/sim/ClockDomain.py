@@ -44,6 +44,10 @@ class ClockDomain(SimObject):
     cxx_class = "gem5::ClockDomain"
     abstract = True
 
+    # Evaluate the running Ticked members of the domain from a single
+    # event per clock edge rather than an event per member
+    shared_ticker = Param.Bool(False, "Tick the members from one event")
+
 
 # Source clock domain with an actual clock, and a list of voltage and frequency
 # op points
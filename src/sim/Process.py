@@ -67,6 +67,21 @@ class Process(SimObject):
     drivers = VectorParam.EmulatedDriver([], "Available emulated drivers")
     release = Param.String("5.1.0", "Linux kernel uname release")
 
+    async_io = Param.Bool(
+        False,
+        "Do the host I/O of large file reads and writes in the background, "
+        "suspending the thread until it is done",
+    )
+    async_io_min_size = Param.MemorySize(
+        "64KiB", "smallest read or write done in the background"
+    )
+    io_latency = Param.Latency(
+        "20us", "simulated latency of the background file I/O"
+    )
+    io_bandwidth = Param.MemoryBandwidth(
+        "2GiB/s", "simulated bandwidth of the background file I/O"
+    )
+
     @classmethod
     def export_methods(cls, code):
         code("bool map(Addr vaddr, Addr paddr, int sz, bool cacheable=true);")
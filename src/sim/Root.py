@@ -68,6 +68,62 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Automatically assign objects to this many event queues, cutting
+    # the object graph only at links that can cross event queues. This
+    # overrides eventq_index in the configuration.
+    eventq_partitions = Param.UInt32(
+        0, "number of event queues to partition the system into"
+    )
+
+    # Synchronise multiple main event queues conservatively using the
+    # latency of the links between them instead of meeting at a global
+    # barrier every sim_quantum. The quantum still bounds the skew
+    # between any two queues.
+    conservative_sync = Param.Bool(
+        False, "use lookahead-based conservative event queue sync"
+    )
+
+    # Stretch each sim_quantum barrier interval over the ticks in which
+    # no event queue has any work. At every barrier, the next one is
+    # placed one quantum after the earliest pending event of any queue,
+    # so sparse phases skip their empty quanta without adding skew.
+    elastic_quantum = Param.Bool(
+        False, "skip quanta in which no event queue has pending events"
+    )
+
+    # Run the main event queues on this many host threads, which pick
+    # up whole quanta of the queues from a work-stealing pool. Fewer
+    # threads than queues lets a system be partitioned finely for load
+    # balance without oversubscribing the host. Zero runs every queue
+    # on a thread of its own.
+    eventq_threads = Param.Unsigned(
+        0, "host threads running the main event queues (0 for one per queue)"
+    )
+
+    # Run the init() and initState() passes of objects whose class
+    # declares thread_safe_init on this many host threads. One keeps
+    # every pass serial.
+    init_threads = Param.Unsigned(
+        1, "host threads for thread safe init passes (0 for one per core)"
+    )
+
+    # Index the main event queues with a calendar to avoid linear
+    # searches when many distinct ticks are pending. Zero buckets keeps
+    # the plain sorted bin list.
+    eventq_calendar_buckets = Param.Unsigned(
+        0, "number of event queue calendar buckets (0 to disable)"
+    )
+    eventq_calendar_width = Param.Tick(
+        1024, "width in ticks of each event queue calendar bucket"
+    )
+
+    # Profile the host time spent processing the events of each
+    # SimObject. The profile is written at exit to event_profile.folded
+    # (folded stacks for flame graph tools) and event_profile.txt.
+    event_profile = Param.Bool(
+        False, "profile the host time spent processing events"
+    )
+
     full_system = Param.Bool("if this is a full system simulation")
 
     # Time syncing prevents the simulation from running faster than real time.
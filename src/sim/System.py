@@ -50,6 +50,14 @@ class MemoryMode(Enum):
     vals = ["invalid", "atomic", "timing", "atomic_noncaching"]
 
 
+class CheckpointMemoryFormat(Enum):
+    vals = ["gzip", "chunked_gzip", "raw"]
+
+
+class BackingStoreHugePages(ScopedEnum):
+    vals = ["none", "transparent", "hugetlb"]
+
+
 class System(SimObject):
     type = "System"
     cxx_header = "sim/system.hh"
@@ -60,6 +68,7 @@ class System(SimObject):
     cxx_exports = [
         PyBindMethod("getMemoryMode"),
         PyBindMethod("setMemoryMode"),
+        PyBindMethod("completeLazyRestore"),
     ]
 
     memories = VectorParam.AbstractMemory(
@@ -80,6 +89,53 @@ class System(SimObject):
         False, "mmap the backing store without reserving swap"
     )
 
+    # Large guest memories spend a lot of host time on TLB misses when
+    # they are backed by small pages. The backing store can instead ask
+    # for transparent huge pages, or be mapped from the hugetlbfs pool,
+    # which has to be reserved on the host beforehand. Pre-faulting the
+    # backing store moves the page faults to the start of the simulation.
+    backing_store_huge_pages = Param.BackingStoreHugePages(
+        "none",
+        "Huge pages for the backing store: none, transparent (madvise) or "
+        "hugetlb (MAP_HUGETLB, transparent if the host has no hugetlb "
+        "pages reserved)",
+    )
+    prefault_backing_store = Param.Bool(
+        False,
+        "Populate the whole backing store when it is created, using the "
+        "checkpoint_threads host threads",
+    )
+
+    # Physical memory checkpoints are normally compressed as a single
+    # gzip stream. They can instead be compressed as independent chunks,
+    # which are compressed and decompressed in parallel, or be written as
+    # raw, sparse images, which are restored by mapping them copy-on-write
+    # into the backing store rather than by reading them.
+    checkpoint_memory_format = Param.CheckpointMemoryFormat(
+        "gzip", "The format of the physical memory checkpoints"
+    )
+    checkpoint_threads = Param.Unsigned(
+        0,
+        "Host threads used to compress and decompress chunked physical "
+        "memory checkpoints, 0 to use one per host CPU",
+    )
+    lazy_checkpoint_restore = Param.Bool(
+        False,
+        "Restore chunked physical memory checkpoints on demand, as the "
+        "pages are first touched, using userfaultfd",
+    )
+    shared_checkpoint_images = Param.String(
+        "",
+        "Directory, e.g., in /dev/shm, of the raw images that the processes "
+        "restoring the same compressed physical memory checkpoint share "
+        "copy-on-write, empty to not share them",
+    )
+    delta_checkpoints = Param.Bool(
+        False,
+        "Checkpoint only the physical memory pages written since the "
+        "previous checkpoint taken or restored, which must be kept",
+    )
+
     # The memory ranges are to be populated when creating the system
     # such that these can be passed from the I/O subsystem through an
     # I/O bridge or cache
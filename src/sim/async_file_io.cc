@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/async_file_io.hh"
+
+#include <unistd.h>
+
+#include <cerrno>
+
+namespace gem5
+{
+
+AsyncFileIO::AsyncFileIO()
+{
+    thread = std::thread([this]() { work(); });
+}
+
+AsyncFileIO::~AsyncFileIO()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    submitted.notify_one();
+    thread.join();
+}
+
+void
+AsyncFileIO::submit(const OpPtr &op)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(op);
+    }
+    submitted.notify_one();
+}
+
+void
+AsyncFileIO::wait(const OpPtr &op)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    completed.wait(lock, [&op]() { return op->done; });
+}
+
+void
+AsyncFileIO::work()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        submitted.wait(lock, [this]() { return stopping || !queue.empty(); });
+        // Finish the queued operations before stopping, so that no
+        // writes are lost.
+        if (queue.empty())
+            return;
+
+        OpPtr op = queue.front();
+        queue.pop_front();
+        lock.unlock();
+
+        ssize_t ret;
+        if (op->write) {
+            ret = pwrite(op->fd, op->data.data(), op->data.size(), op->offset);
+            if (ret != -1 && op->sync)
+                fsync(op->fd);
+        } else {
+            ret = pread(op->fd, op->data.data(), op->data.size(), op->offset);
+        }
+        const int64_t result = ret == -1 ? -errno : ret;
+
+        lock.lock();
+        op->result = result;
+        op->done = true;
+        completed.notify_all();
+    }
+}
+
+} // namespace gem5
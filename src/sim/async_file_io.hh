@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_ASYNC_FILE_IO_HH__
+#define __SIM_ASYNC_FILE_IO_HH__
+
+#include <sys/types.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * Host file I/O done by a background thread, so that the simulation goes
+ * on while the host reads or writes the files of the system calls. The
+ * system calls check on their operation when they are retried, until
+ * the operation is done and its simulated latency has passed.
+ */
+class AsyncFileIO
+{
+  public:
+    struct Op
+    {
+        /** The host file descriptor. */
+        int fd;
+        /** Is this a write, or a read? */
+        bool write;
+        /** Should a write be synced to the file? */
+        bool sync = false;
+        /** The offset in the file. */
+        off_t offset;
+        /** The data to write, or the buffer to read into. */
+        std::vector<uint8_t> data;
+
+        /** The number of bytes transferred, or -errno. */
+        int64_t result = 0;
+        bool done = false;
+    };
+
+    typedef std::shared_ptr<Op> OpPtr;
+
+    AsyncFileIO();
+    ~AsyncFileIO();
+
+    AsyncFileIO(const AsyncFileIO &other) = delete;
+    AsyncFileIO &operator=(const AsyncFileIO &other) = delete;
+
+    /** Start an operation. */
+    void submit(const OpPtr &op);
+
+    /** Wait until an operation is done. */
+    void wait(const OpPtr &op);
+
+  private:
+    void work();
+
+    std::mutex mutex;
+    /** Notified when there are new operations, or when stopping. */
+    std::condition_variable submitted;
+    /** Notified when operations are done. */
+    std::condition_variable completed;
+    std::deque<OpPtr> queue;
+    bool stopping = false;
+
+    std::thread thread;
+};
+
+} // namespace gem5
+
+#endif // __SIM_ASYNC_FILE_IO_HH__
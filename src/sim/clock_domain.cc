@@ -49,6 +49,7 @@
 #include "params/SrcClockDomain.hh"
 #include "sim/clocked_object.hh"
 #include "sim/serialize.hh"
+#include "sim/ticked_object.hh"
 #include "sim/voltage_domain.hh"
 
 namespace gem5
@@ -67,10 +68,112 @@ ClockDomain::ClockDomain(const Params &p, VoltageDomain *voltage_domain)
     : SimObject(p),
       _clockPeriod(0),
       _voltageDomain(voltage_domain),
+      sharedTicker(p.shared_ticker),
       stats(*this)
 {
 }
 
+ClockDomain::Ticker *
+ClockDomain::ticker(EventQueue *eventq, Event::Priority priority)
+{
+    if (!sharedTicker)
+        return nullptr;
+
+    auto &ticker = tickers[std::make_pair(eventq, priority)];
+    if (!ticker)
+        ticker = std::make_unique<Ticker>(name() + ".ticker", priority);
+    return ticker.get();
+}
+
+ClockDomain::Ticker::Ticker(const std::string &name,
+                            Event::Priority priority)
+    : event([this]{ process(); }, name, false, priority)
+{
+}
+
+void
+ClockDomain::Ticker::subscribe(Ticked *t)
+{
+    Tick when = t->object.clockEdge(Cycles(1));
+    subscribers.emplace_back(t, when);
+
+    // While processing, the event is scheduled for the next edge once
+    // the subscribers of this one are evaluated
+    if (processing)
+        return;
+    if (!event.scheduled())
+        t->object.schedule(event, when);
+    else if (when < event.when())
+        t->object.reschedule(event, when);
+}
+
+void
+ClockDomain::Ticker::unsubscribe(Ticked *t)
+{
+    auto it = std::find_if(subscribers.begin(), subscribers.end(),
+        [t](const auto &s) { return s.first == t; });
+    assert(it != subscribers.end());
+
+    if (processing) {
+        it->first = nullptr;
+        return;
+    }
+    subscribers.erase(it);
+    if (subscribers.empty() && event.scheduled())
+        t->object.deschedule(event);
+}
+
+void
+ClockDomain::Ticker::process()
+{
+    processing = true;
+    // Subscribers may come and go while being evaluated, so index the
+    // vector rather than iterate over it
+    for (size_t i = 0; i < subscribers.size(); ++i) {
+        if (subscribers[i].first && subscribers[i].second <= curTick())
+            subscribers[i].first->tick();
+    }
+    processing = false;
+
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+        [](const auto &s) { return s.first == nullptr; }),
+        subscribers.end());
+
+    if (!subscribers.empty()) {
+        ClockedObject &object = subscribers.front().first->object;
+        object.schedule(event, object.clockEdge(Cycles(1)));
+    }
+}
+
+void
+ClockDomain::changeClockPeriod(Tick clock_period)
+{
+    if (clock_period == _clockPeriod)
+        return;
+
+    if (clockChanges.size() == maxClockChanges) {
+        // Bound the history by aligning all members to the latest epoch
+        for (auto m : members)
+            m->alignClockEpoch();
+        clockChanges.clear();
+        firstEpoch = _clockEpoch;
+    }
+
+    clockChanges.push_back({curTick(), _clockPeriod});
+    _clockEpoch++;
+    _clockPeriod = clock_period;
+
+    // Notify the members which act on the change, dropping those that
+    // turn out not to
+    auto keep = notified.begin();
+    for (auto m : notified) {
+        m->updateClockPeriod();
+        if (m->clockPeriodHook)
+            *keep++ = m;
+    }
+    notified.erase(keep, notified.end());
+}
+
 double
 ClockDomain::voltage() const
 {
@@ -118,12 +221,7 @@ SrcClockDomain::clockPeriod(Tick clock_period)
         fatal("%s has a clock period of zero\n", name());
     }
 
-    // Align all members to the current tick
-    for (auto m = members.begin(); m != members.end(); ++m) {
-        (*m)->updateClockPeriod();
-    }
-
-    _clockPeriod = clock_period;
+    changeClockPeriod(clock_period);
 
     DPRINTF(ClockDomain,
             "Setting clock period to %d ticks for source clock %s\n",
@@ -208,14 +306,9 @@ DerivedClockDomain::DerivedClockDomain(const Params &p) :
 void
 DerivedClockDomain::updateClockPeriod()
 {
-    // Align all members to the current tick
-    for (auto m = members.begin(); m != members.end(); ++m) {
-        (*m)->updateClockPeriod();
-    }
-
     // recalculate the clock period, relying on the fact that changes
     // propagate downwards in the tree
-    _clockPeriod = parent.clockPeriod() * clockDivider;
+    changeClockPeriod(parent.clockPeriod() * clockDivider);
 
     DPRINTF(ClockDomain,
             "Setting clock period to %d ticks for derived clock %s\n",
@@ -45,6 +45,12 @@
 #define __SIM_CLOCK_DOMAIN_HH__
 
 #include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "params/ClockDomain.hh"
@@ -61,6 +67,7 @@ namespace gem5
 class DerivedClockDomain;
 class VoltageDomain;
 class Clocked;
+class Ticked;
 
 /**
  * The ClockDomain provides clock to group of clocked objects bundled
@@ -95,7 +102,45 @@ class ClockDomain : public SimObject
      */
     std::vector<Clocked *> members;
 
+    /**
+     * Change the clock period. Members realign their tick and cycle to
+     * the change lazily, the next time they use their clock, and only
+     * the members that act on clock period changes are notified.
+     *
+     * @param clock_period The new clock period in ticks
+     */
+    void changeClockPeriod(Tick clock_period);
+
   public:
+    /**
+     * A change of the clock period: the period that was used up to the
+     * change, and the tick at which it happened.
+     */
+    struct ClockChange
+    {
+        Tick when;
+        Tick period;
+    };
+
+    /**
+     * Get the number of times the clock period has changed. A member
+     * whose clock is aligned to a smaller epoch has to replay the
+     * changes since then.
+     */
+    uint64_t clockEpoch() const { return _clockEpoch; }
+
+    /**
+     * Get the change that ended an epoch. The changes of a limited
+     * number of epochs are kept, before all members are realigned.
+     *
+     * @param epoch The epoch, at least that of every member
+     */
+    const ClockChange &
+    clockChange(uint64_t epoch) const
+    {
+        assert(epoch >= firstEpoch && epoch < _clockEpoch);
+        return clockChanges[epoch - firstEpoch];
+    }
 
     typedef ClockDomainParams Params;
     ClockDomain(const Params &p, VoltageDomain *voltage_domain);
@@ -117,6 +162,7 @@ class ClockDomain : public SimObject
         assert(c != NULL);
         assert(std::find(members.begin(), members.end(), c) == members.end());
         members.push_back(c);
+        notified.push_back(c);
     }
 
     /**
@@ -142,7 +188,76 @@ class ClockDomain : public SimObject
     void addDerivedDomain(DerivedClockDomain *clock_domain)
     { children.push_back(clock_domain); }
 
+    /**
+     * A single event per clock edge that evaluates all the Ticked
+     * objects subscribed to it, so that running members of the domain
+     * don't each keep an event of their own in the queue.
+     */
+    class Ticker
+    {
+      public:
+        Ticker(const std::string &name, Event::Priority priority);
+
+        /**
+         * Evaluate a Ticked object on every clock edge from the next
+         * one it would have scheduled its own event for.
+         */
+        void subscribe(Ticked *t);
+
+        /** Stop evaluating a Ticked object */
+        void unsubscribe(Ticked *t);
+
+      private:
+        /** Evaluate the subscribers on this clock edge */
+        void process();
+
+        EventFunctionWrapper event;
+
+        /**
+         * Subscribers in the order they subscribed, with the first
+         * tick each is evaluated at. Unsubscribing while the edge is
+         * being processed leaves a null entry behind until the end of
+         * the edge.
+         */
+        std::vector<std::pair<Ticked *, Tick>> subscribers;
+
+        bool processing = false;
+    };
+
+    /**
+     * Get the shared ticker of the domain for the events of a queue at a
+     * priority.
+     *
+     * @return The ticker, nullptr if the domain has no shared ticker
+     */
+    Ticker *ticker(EventQueue *eventq, Event::Priority priority);
+
   private:
+    /** Whether members tick from a shared ticker */
+    const bool sharedTicker;
+
+    std::map<std::pair<EventQueue *, Event::Priority>,
+             std::unique_ptr<Ticker>> tickers;
+
+    /** Number of clock changes to keep before realigning all members */
+    static constexpr size_t maxClockChanges = 64;
+
+    /** Number of times the clock period has changed */
+    uint64_t _clockEpoch = 0;
+
+    /** The epoch ended by the first change in clockChanges */
+    uint64_t firstEpoch = 0;
+
+    /** The changes since firstEpoch */
+    std::vector<ClockChange> clockChanges;
+
+    /**
+     * Members that are notified of clock period changes. Members which
+     * don't act on the changes are dropped the first time they are
+     * notified.
+     */
+    std::vector<Clocked *> notified;
+
     struct ClockDomainStats : public statistics::Group
     {
         ClockDomainStats(ClockDomain &cd);
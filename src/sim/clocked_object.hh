@@ -71,6 +71,35 @@ class Clocked
     // 'tick'
     mutable Cycles cycle;
 
+    // The clock epoch of the domain that tick and cycle are aligned to
+    mutable uint64_t epoch;
+
+    // Whether clockPeriodUpdated() has been overridden, see below
+    bool clockPeriodHook = true;
+
+    friend class ClockDomain;
+
+    /**
+     * Replay the clock period changes of the domain since the epoch
+     * tick and cycle are aligned to. Each change aligns them to the
+     * first edge at or after the change, using the period before it,
+     * as if they had been updated when the change happened.
+     */
+    void
+    alignClockEpoch() const
+    {
+        for (; epoch < clockDomain.clockEpoch(); ++epoch) {
+            const ClockDomain::ClockChange &change =
+                clockDomain.clockChange(epoch);
+            if (tick < change.when && change.period) {
+                Cycles elapsedCycles(
+                    divCeil(change.when - tick, change.period));
+                cycle += elapsedCycles;
+                tick += elapsedCycles * change.period;
+            }
+        }
+    }
+
     /**
      *  Align cycle and tick to the next clock edge if not already done. When
      *  complete, tick must be at least curTick().
@@ -78,6 +107,11 @@ class Clocked
     void
     update() const
     {
+        // the clock period changed since the last update, which is
+        // cheaply detected by comparing epochs
+        if (epoch != clockDomain.clockEpoch())
+            alignClockEpoch();
+
         // both tick and cycle are up-to-date and we are done, note
         // that the >= is important as it captures cases where tick
         // has already passed curTick()
@@ -113,7 +147,8 @@ class Clocked
      * parameters.
      */
     Clocked(ClockDomain &clk_domain)
-        : tick(0), cycle(0), clockDomain(clk_domain)
+        : tick(0), cycle(0), epoch(clk_domain.clockEpoch()),
+          clockDomain(clk_domain)
     {
         // Register with the clock domain, so that if the clock domain
         // frequency changes, we can update this object's tick.
@@ -139,13 +174,16 @@ class Clocked
         Cycles elapsedCycles(divCeil(curTick(), clockPeriod()));
         cycle = elapsedCycles;
         tick = elapsedCycles * clockPeriod();
+        epoch = clockDomain.clockEpoch();
     }
 
     /**
      * A hook subclasses can implement so they can do any extra work that's
-     * needed when the clock rate is changed.
+     * needed when the clock rate is changed. The clock domain stops
+     * notifying objects that don't override it, so overrides must not
+     * call it.
      */
-    virtual void clockPeriodUpdated() {}
+    virtual void clockPeriodUpdated() { clockPeriodHook = false; }
 
   public:
 
@@ -218,6 +256,9 @@ class Clocked
 
     double voltage() const { return clockDomain.voltage(); }
 
+    /** The clock domain this clocked object belongs to */
+    ClockDomain &getClockDomain() const { return clockDomain; }
+
     Cycles
     ticksToCycles(Tick t) const
     {
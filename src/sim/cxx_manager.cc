@@ -45,6 +45,7 @@
 #include "debug/CxxConfig.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_object.hh"
+#include "sim/stat_control.hh"
 
 namespace gem5
 {
@@ -603,7 +604,9 @@ CxxConfigManager::instantiate(bool build_all)
     forEachObject(&SimObject::init);
 
     DPRINTF(CxxConfig, "Registering stats\n");
-    forEachObject(&SimObject::regStats);
+    bindStatHierarchy();
+    for (auto i = statRoots.begin(); i != statRoots.end(); ++i)
+        (*i)->regStats();
 
     DPRINTF(CxxConfig, "Registering probe points\n");
     forEachObject(&SimObject::regProbePoints);
@@ -612,6 +615,48 @@ CxxConfigManager::instantiate(bool build_all)
     forEachObject(&SimObject::regProbeListeners);
 }
 
+void
+CxxConfigManager::bindStatHierarchy()
+{
+    statRoots.clear();
+
+    for (auto i = objectsInOrder.begin(); i != objectsInOrder.end(); ++i) {
+        const std::string &object_name = (*i)->name();
+        std::string parent_name = object_name;
+        SimObject *parent = NULL;
+
+        /* Walk up to the nearest enclosing object in the config */
+        std::size_t dot_i;
+        while (!parent &&
+            (dot_i = parent_name.rfind('.')) != std::string::npos)
+        {
+            parent_name.resize(dot_i);
+            auto parent_i = objectsByName.find(parent_name);
+            if (parent_i != objectsByName.end())
+                parent = parent_i->second;
+        }
+
+        /* Top level objects are named without a root. prefix but are
+         *  children of the root object */
+        if (!parent && object_name != "root") {
+            auto root_i = objectsByName.find("root");
+            if (root_i != objectsByName.end())
+                parent = root_i->second;
+        }
+
+        if (parent) {
+            std::string group_name(object_name,
+                object_name.rfind('.') + 1);
+
+            DPRINTF(CxxConfig, "Binding stats of %s to %s\n", object_name,
+                parent->name());
+            parent->addStatGroup(group_name.c_str(), *i);
+        } else {
+            statRoots.push_back(*i);
+        }
+    }
+}
+
 void
 CxxConfigManager::initState()
 {
@@ -655,6 +700,22 @@ CxxConfigManager::loadState(CheckpointIn &checkpoint)
         (*i)->loadState(checkpoint);
 }
 
+void
+CxxConfigManager::restoreCheckpoint(const std::string &checkpoint_dir)
+{
+    DPRINTF(CxxConfig, "Restoring checkpoint from %s\n", checkpoint_dir);
+
+    SimObject::setSimObjectResolver(&simObjectResolver);
+    CheckpointIn checkpoint(checkpoint_dir);
+
+    DrainManager::instance().preCheckpointRestore();
+    loadState(checkpoint);
+
+    /* Periodic stats events may now be in the past of the restored
+     *  tick */
+    statistics::updateEvents();
+}
+
 void
 CxxConfigManager::deleteObjects()
 {
@@ -120,6 +120,10 @@ class CxxConfigManager
     /** SimObjects in order.  This is populated by findAllObjects */
     std::list<SimObject *> objectsInOrder;
 
+    /** SimObjects with no parent object to hold their stats.  This is
+     *  populated by bindStatHierarchy */
+    std::list<SimObject *> statRoots;
+
   protected:
     /** While configuring, inVisit contains names of SimObjects visited in
      *  this recursive configuration walk */
@@ -277,6 +281,11 @@ class CxxConfigManager
      *  instantiate */
     void instantiate(bool build_all = true);
 
+    /** Add every object's stats to its parent object's stat group, as the
+     *  Python configuration does, so that stats are named by their place
+     *  in the hierarchy.  Objects without a parent become statRoots */
+    void bindStatHierarchy();
+
     /** Call initState on all objects */
     void initState();
 
@@ -295,6 +304,13 @@ class CxxConfigManager
     /** Load all objects' state from the given Checkpoint */
     void loadState(CheckpointIn &checkpoint);
 
+    /** Restore all objects from the checkpoint in the given directory.
+     *  This performs the same steps as a checkpoint restore from Python:
+     *  resolving object names through this manager, preparing the drain
+     *  manager, loading the state of every object and rescheduling the
+     *  periodic stats events.  Call this in place of initState */
+    void restoreCheckpoint(const std::string &checkpoint_dir);
+
     /** Delete all objects and clear objectsByName and objectsByOrder */
     void deleteObjects();
 
@@ -69,18 +69,32 @@ DrainManager::tryDrain()
     panic_if(_count != 0,
              "Drain counter must be zero at the start of a drain cycle\n");
 
-    DPRINTF(Drain, "Trying to drain %u objects.\n", drainableCount());
-    _state = DrainState::Draining;
-    for (auto *obj : _allDrainable) {
-        DrainState status = obj->dmDrain();
-        if (debug::Drain && status != DrainState::Drained) {
-            Named *temp = dynamic_cast<Named*>(obj);
-            if (temp)
-                DPRINTF(Drain, "Failed to drain %s\n", temp->name());
+    // Objects that didn't drain in the previous cycle are the most
+    // likely ones to still be busy, so ask them first. If any of them
+    // needs more time, another cycle is needed regardless of the
+    // state of the other objects. Those objects are therefore left
+    // alone until the stragglers are done; they will all be queried
+    // again in the final cycle, which always covers every object.
+    if (_state == DrainState::Draining && !_notDrained.empty()) {
+        std::vector<Drainable *> stragglers;
+        stragglers.swap(_notDrained);
+        DPRINTF(Drain, "Trying to drain %u objects that were not ready.\n",
+                stragglers.size());
+        for (auto *obj : stragglers)
+            drainObject(obj);
+
+        if (_count != 0) {
+            DPRINTF(Drain, "Need another drain cycle. %u/%u objects not "
+                    "ready.\n", _count, drainableCount());
+            return false;
         }
-        _count += status == DrainState::Drained ? 0 : 1;
     }
 
+    DPRINTF(Drain, "Trying to drain %u objects.\n", drainableCount());
+    _state = DrainState::Draining;
+    for (auto *obj : _allDrainable)
+        drainObject(obj);
+
     if (_count == 0) {
         DPRINTF(Drain, "Drain done.\n");
         _state = DrainState::Drained;
@@ -92,6 +106,22 @@ DrainManager::tryDrain()
     }
 }
 
+void
+DrainManager::drainObject(Drainable *obj)
+{
+    DrainState status = obj->dmDrain();
+    if (status == DrainState::Drained)
+        return;
+
+    if (debug::Drain) {
+        Named *temp = dynamic_cast<Named*>(obj);
+        if (temp)
+            DPRINTF(Drain, "Failed to drain %s\n", temp->name());
+    }
+    _notDrained.push_back(obj);
+    ++_count;
+}
+
 void
 DrainManager::resume()
 {
@@ -116,6 +146,7 @@ DrainManager::resume()
     // DrainManager, which means we have to resume objects until all
     // objects are in the Running state.
     _state = DrainState::Resuming;
+    _notDrained.clear();
 
     do {
         DPRINTF(Drain, "Resuming %u objects.\n", drainableCount());
@@ -141,6 +172,7 @@ DrainManager::preCheckpointRestore()
     DPRINTF(Drain, "Applying pre-restore fixes to %u objects.\n",
             drainableCount());
     _state = DrainState::Drained;
+    _notDrained.clear();
     for (auto *obj : _allDrainable)
         obj->_drainState = DrainState::Drained;
 }
@@ -172,6 +204,9 @@ DrainManager::unregisterDrainable(Drainable *obj)
     auto o = std::find(_allDrainable.begin(), _allDrainable.end(), obj);
     assert(o != _allDrainable.end());
     _allDrainable.erase(o);
+    _notDrained.erase(
+        std::remove(_notDrained.begin(), _notDrained.end(), obj),
+        _notDrained.end());
 }
 
 bool
@@ -101,6 +101,11 @@ class DrainManager
      * this method should be called again. This cycle should continue
      * until this method returns true.
      *
+     * Objects that failed to drain in the previous call are queried
+     * first. If any of them is still not ready, the remaining objects
+     * are not queried again in this call since another cycle is needed
+     * anyway.
+     *
      * @return true if all objects were drained successfully, false if
      * more simulation is needed.
      *
@@ -170,6 +175,13 @@ class DrainManager
      */
     bool allInState(DrainState state) const;
 
+    /**
+     * Ask an object to drain, and account for it in the drain counter
+     * and the list of objects that are not drained if it needs more
+     * time.
+     */
+    void drainObject(Drainable *obj);
+
     /**
      * Thread-safe helper function to get the number of Drainable
      * objects in a system.
@@ -182,6 +194,9 @@ class DrainManager
     /** Set of all drainable objects */
     std::vector<Drainable *> _allDrainable;
 
+    /** Objects that were not drained in the latest drain cycle */
+    std::vector<Drainable *> _notDrained;
+
     /**
      * Number of objects still draining. This is flagged atomic since
      * it can be manipulated by SimObjects living in different
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** An event which does nothing, so only the queue's overhead is measured. */
+class NullEvent : public Event
+{
+  public:
+    using Event::Event;
+
+    void process() override {}
+};
+
+/** An event which reschedules itself a fixed period later. */
+class PeriodicEvent : public Event
+{
+  public:
+    PeriodicEvent(EventQueue &_eq, Tick _period)
+        : eq(_eq), period(_period)
+    {}
+
+    void process() override { eq.schedule(this, eq.getCurTick() + period); }
+
+  private:
+    EventQueue &eq;
+    Tick period;
+};
+
+} // anonymous namespace
+
+/**
+ * Schedule a batch of events at random ticks and service them all. The
+ * random ticks make for long bins in the queue.
+ */
+static void
+BM_EventQueueScheduleService(benchmark::State &state)
+{
+    const int num_events = state.range(0);
+    EventQueue eq("benchmark");
+    curEventQueue(&eq);
+
+    std::vector<std::unique_ptr<NullEvent>> events;
+    for (int i = 0; i < num_events; i++)
+        events.emplace_back(new NullEvent());
+
+    std::mt19937_64 rng(0);
+    for (auto _ : state) {
+        for (auto &event : events)
+            eq.schedule(event.get(), eq.getCurTick() + 1 + rng() % 10000);
+        while (!eq.empty())
+            eq.serviceOne();
+    }
+    state.SetItemsProcessed(state.iterations() * num_events);
+}
+BENCHMARK(BM_EventQueueScheduleService)->Range(8, 8 << 10);
+
+/**
+ * Service events which keep rescheduling themselves, like the clocked
+ * objects of a simulated system do. Many events share the same ticks.
+ */
+static void
+BM_EventQueuePeriodic(benchmark::State &state)
+{
+    const int num_events = state.range(0);
+    EventQueue eq("benchmark");
+    curEventQueue(&eq);
+
+    std::vector<std::unique_ptr<PeriodicEvent>> events;
+    for (int i = 0; i < num_events; i++) {
+        events.emplace_back(new PeriodicEvent(eq, 500 * (1 + i % 4)));
+        eq.schedule(events.back().get(), i % 4);
+    }
+
+    for (auto _ : state)
+        eq.serviceOne();
+    state.SetItemsProcessed(state.iterations());
+
+    for (auto &event : events)
+        eq.deschedule(event.get());
+}
+BENCHMARK(BM_EventQueuePeriodic)->Range(8, 8 << 10);
+
+/** Reschedule events already in the queue, as timeouts often are. */
+static void
+BM_EventQueueReschedule(benchmark::State &state)
+{
+    const int num_events = state.range(0);
+    EventQueue eq("benchmark");
+    curEventQueue(&eq);
+
+    std::mt19937_64 rng(0);
+    std::vector<std::unique_ptr<NullEvent>> events;
+    for (int i = 0; i < num_events; i++) {
+        events.emplace_back(new NullEvent());
+        eq.schedule(events.back().get(), 1 + rng() % 10000);
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        eq.reschedule(events[i++ % num_events].get(), 1 + rng() % 10000);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (auto &event : events)
+        eq.deschedule(event.get());
+}
+BENCHMARK(BM_EventQueueReschedule)->Range(8, 8 << 10);
@@ -30,14 +30,25 @@
 
 #include "sim/eventq.hh"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#endif
+
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "base/bitfield.hh"
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
+#include "base/refcnt.hh"
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
@@ -58,6 +69,13 @@ std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
 
+//! Calendar configuration applied to new main event queues
+static unsigned mainCalendarBuckets = 0;
+static Tick mainCalendarWidth = 0;
+
+//! Whether new main event queues are profiled
+static bool mainProfiling = false;
+
 EventQueue *
 getEventQueue(uint32_t index)
 {
@@ -65,11 +83,410 @@ getEventQueue(uint32_t index)
         numMainEventQueues++;
         mainEventQueue.push_back(
             new EventQueue(csprintf("MainEventQueue-%d", index)));
+        mainEventQueue.back()->setCalendar(mainCalendarBuckets,
+                                           mainCalendarWidth);
+        mainEventQueue.back()->setProfiling(mainProfiling);
     }
 
+    // Objects such as requests may be shared between event queues, so
+    // their reference counts must be updated atomically from now on.
+    if (numMainEventQueues > 1)
+        SharedRefCountMode::setAtomic(true);
+
     return mainEventQueue[index];
 }
 
+void
+setMainEventQueueCalendar(unsigned num_buckets, Tick bucket_width)
+{
+    mainCalendarBuckets = num_buckets;
+    mainCalendarWidth = bucket_width;
+    for (auto *eq : mainEventQueue)
+        eq->setCalendar(num_buckets, bucket_width);
+}
+
+void
+setMainEventQueueProfiling(bool enable)
+{
+    mainProfiling = enable;
+    for (auto *eq : mainEventQueue)
+        eq->setProfiling(enable);
+}
+
+void
+dumpEventProfile(std::ostream &folded, std::ostream &report)
+{
+    EventQueue::Profile profile;
+    for (auto *eq : mainEventQueue)
+        eq->addProfile(profile);
+
+    std::vector<std::pair<std::string, EventQueue::ProfileEntry>> entries(
+        profile.begin(), profile.end());
+    std::sort(entries.begin(), entries.end(),
+              [](const auto &a, const auto &b) {
+                  return a.second.cycles > b.second.cycles;
+              });
+
+    uint64_t total = 0;
+    for (const auto &entry : entries)
+        total += entry.second.cycles;
+
+    // Flame graph tools expect "frame;frame;... value" lines
+    for (const auto &[name, entry] : entries) {
+        std::string stack = name;
+        std::replace(stack.begin(), stack.end(), '.', ';');
+        std::replace(stack.begin(), stack.end(), ' ', '_');
+        ccprintf(folded, "%s %d\n", stack, entry.cycles);
+    }
+
+    ccprintf(report, "%14s %7s %12s %10s  %s\n",
+             "host cycles", "%", "events", "cycles/ev", "event");
+    for (const auto &[name, entry] : entries) {
+        ccprintf(report, "%14d %6.2f%% %12d %10.1f  %s\n",
+                 entry.cycles, total ? 100.0 * entry.cycles / total : 0.0,
+                 entry.count,
+                 entry.count ? (double)entry.cycles / entry.count : 0.0,
+                 name);
+    }
+}
+
+/**
+ * @return A host cycle count, from the time stamp counter where there is
+ * one.
+ */
+static inline uint64_t
+hostCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t count;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+    return count;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * Host time profile of the events processed by a queue.
+ */
+class EventQueue::EventProfile
+{
+  private:
+    Profile entries;
+
+    //! Entries of the events that are not deleted once processed, so
+    //! their names are only built once.
+    std::unordered_map<const Event *, ProfileEntry *> cache;
+
+  public:
+    //! @return The entry of an event, valid until the profile is dropped.
+    ProfileEntry &
+    entry(const Event *event, bool cacheable)
+    {
+        if (cacheable) {
+            auto it = cache.find(event);
+            if (it != cache.end())
+                return *it->second;
+        }
+
+        ProfileEntry &entry = entries[event->name()];
+        if (cacheable)
+            cache.emplace(event, &entry);
+        return entry;
+    }
+
+    void
+    addTo(Profile &profile) const
+    {
+        for (const auto &[name, entry] : entries) {
+            ProfileEntry &total = profile[name];
+            total.cycles += entry.cycles;
+            total.count += entry.count;
+        }
+    }
+};
+
+/**
+ * Calendar index over the bin list of an event queue.
+ *
+ * The calendar covers a window of numBuckets consecutive keys
+ * starting at baseKey, where the key of a bin is its tick divided by
+ * the bucket width. Every bin whose key falls into the window is
+ * indexed: each bucket points to the top events of the first and
+ * last bin with its key. Bins beyond the window are only reachable
+ * through the bin list. The window follows curTick() as the queue
+ * is serviced. Since no event can be scheduled before curTick(), the
+ * buckets that drop out of the window are always empty and can be
+ * reused for the keys that enter at the other end.
+ */
+class EventQueue::CalendarIndex
+{
+  public:
+    CalendarIndex(unsigned num_buckets, Tick bucket_width)
+        : widthBits(ceilLog2(std::max<Tick>(bucket_width, 1))),
+          numBuckets(1ULL << ceilLog2(std::max(num_buckets, 64U))),
+          buckets(numBuckets), occupied(numBuckets / 64, 0), baseKey(0)
+    {}
+
+    /**
+     * Find the top event of the last bin that sorts before event.
+     *
+     * @pre head is not null and sorts before event.
+     */
+    Event *
+    findPrev(const Event *event, Event *head)
+    {
+        const Tick k = key(event);
+        if (k < baseKey)
+            rebuild(head, head->when());
+
+        Event *prev;
+        if (k - baseKey >= numBuckets) {
+            // Beyond the calendar, walk from the last indexed bin.
+            prev = lastBefore(baseKey + numBuckets);
+            if (!prev)
+                prev = head;
+        } else {
+            const Bucket &b = buckets[slot(k)];
+            if (b.first && *b.first < *event)
+                prev = b.first;
+            else if (!(prev = lastBefore(k)))
+                return head;
+        }
+
+        Event *curr = prev->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
+        return prev;
+    }
+
+    /**
+     * Update the index after event was inserted between the bins
+     * starting with prev and curr (either of which may be null).
+     */
+    void
+    inserted(Event *event, Event *prev, Event *curr)
+    {
+        if (curr && *curr == *event) {
+            // The event is the new top of an existing bin
+            replaced(curr, event);
+            return;
+        }
+
+        const Tick k = key(event);
+        if (!indexed(k))
+            return;
+
+        Bucket &b = buckets[slot(k)];
+        if (!prev || key(prev) != k)
+            b.first = event;
+        if (!curr || key(curr) != k)
+            b.last = event;
+        occupied[slot(k) / 64] |= 1ULL << (slot(k) % 64);
+    }
+
+    /**
+     * Update the index after an event was removed from the bin whose
+     * top was top. next is the new top of the bin, or the top of the
+     * following bin if the bin is now empty. prev is the top of the
+     * preceding bin, if any.
+     */
+    void
+    removed(Event *top, Event *next, Event *prev)
+    {
+        if (next == top)
+            return;
+        if (next && *next == *top) {
+            replaced(top, next);
+            return;
+        }
+
+        const Tick k = key(top);
+        if (!indexed(k))
+            return;
+
+        Bucket &b = buckets[slot(k)];
+        if (b.first == top)
+            b.first = next && key(next) == k ? next : nullptr;
+        if (b.last == top)
+            b.last = prev && key(prev) == k ? prev : nullptr;
+        if (!b.first)
+            occupied[slot(k) / 64] &= ~(1ULL << (slot(k) % 64));
+    }
+
+    /** Move the window forward once the current tick has advanced. */
+    void
+    advance(Tick now, Event *head)
+    {
+        const Tick k = now >> widthBits;
+        if (k < baseKey) {
+            // Time went backwards, e.g. during cache warmup
+            rebuild(head, now);
+            return;
+        }
+        if (k - baseKey < numBuckets / 2)
+            return;
+
+        // Index the bins that enter the window. They directly follow
+        // the last bin currently in the window.
+        const Tick old_end = baseKey + numBuckets;
+        Event *curr = lastBefore(old_end);
+        Event *prev = curr;
+        curr = curr ? curr->nextBin : head;
+        baseKey = k;
+        for (; curr && indexed(key(curr)); curr = curr->nextBin) {
+            if (key(curr) >= old_end)
+                inserted(curr, prev, curr->nextBin);
+            prev = curr;
+        }
+    }
+
+    /**
+     * Re-index all bins, starting the window at tick start or at the
+     * head of the queue, whichever comes first.
+     */
+    void
+    rebuild(Event *head, Tick start)
+    {
+        std::fill(buckets.begin(), buckets.end(), Bucket());
+        std::fill(occupied.begin(), occupied.end(), 0);
+        if (head)
+            start = std::min(start, head->when());
+        baseKey = start >> widthBits;
+        Event *prev = nullptr;
+        for (Event *curr = head; curr && key(curr) < baseKey + numBuckets;
+             curr = curr->nextBin) {
+            inserted(curr, prev, curr->nextBin);
+            prev = curr;
+        }
+    }
+
+    Tick key(const Event *event) const { return event->when() >> widthBits; }
+
+  private:
+    struct Bucket
+    {
+        Event *first = nullptr;
+        Event *last = nullptr;
+    };
+
+    bool
+    indexed(Tick k) const
+    {
+        return k >= baseKey && k - baseKey < numBuckets;
+    }
+
+    size_t slot(Tick k) const { return k & (numBuckets - 1); }
+
+    /** The bin has a new top event. */
+    void
+    replaced(Event *old_top, Event *new_top)
+    {
+        const Tick k = key(old_top);
+        if (!indexed(k))
+            return;
+        Bucket &b = buckets[slot(k)];
+        if (b.first == old_top)
+            b.first = new_top;
+        if (b.last == old_top)
+            b.last = new_top;
+    }
+
+    /** Last indexed bin with a key in [baseKey, k), if any. */
+    Event *
+    lastBefore(Tick k) const
+    {
+        // Scan the occupancy bitmap backwards one word at a time
+        Tick remaining = k - baseKey;
+        while (remaining > 0) {
+            const size_t s = slot(k - 1);
+            const unsigned bit = s % 64;
+            const unsigned span = std::min<Tick>(bit + 1, remaining);
+            uint64_t word = occupied[s / 64] & mask(bit + 1);
+            word &= ~mask(bit + 1 - span);
+            if (word)
+                return buckets[(s & ~63ULL) + findMsbSet(word)].last;
+            k -= span;
+            remaining -= span;
+        }
+        return nullptr;
+    }
+
+    const unsigned widthBits;
+    const size_t numBuckets;
+    std::vector<Bucket> buckets;
+    //! One bit per bucket, set if the bucket has any bins
+    std::vector<uint64_t> occupied;
+    //! Key of the first bucket in the window
+    Tick baseKey;
+};
+
+/**
+ * Bounded single producer, single consumer ring of events scheduled on
+ * a queue by one other queue. The producer and consumer indices live
+ * on separate cache lines, and the producer keeps a cached copy of the
+ * consumer index so that it only reads the shared one when the ring
+ * looks full.
+ */
+class EventQueue::AsyncChannel
+{
+  public:
+    AsyncChannel(const EventQueue *_src, size_t capacity)
+        : src(_src),
+          slots(size_t(1) << ceilLog2(std::max<size_t>(capacity, 2))),
+          mask(slots.size() - 1), tail(0), headCache(0), head(0)
+    {
+    }
+
+    //! Queue producing the events in this channel.
+    const EventQueue *const src;
+
+    //! Add an event, returns false if the ring is full.
+    bool
+    push(Event *event)
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - headCache > mask) {
+            headCache = head.load(std::memory_order_acquire);
+            if (t - headCache > mask)
+                return false;
+        }
+        slots[t & mask] = event;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Remove all events in the ring, in the order they were added.
+    template <typename F>
+    void
+    drain(F f)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+        if (h == t)
+            return;
+        for (; h != t; h++)
+            f(slots[h & mask]);
+        head.store(h, std::memory_order_release);
+    }
+
+  private:
+    std::vector<Event *> slots;
+    const size_t mask;
+
+    //! Producer side.
+    alignas(64) std::atomic<size_t> tail;
+    size_t headCache;
+
+    //! Consumer side.
+    alignas(64) std::atomic<size_t> head;
+};
+
 #ifndef NDEBUG
 Counter Event::instanceCounter = 0;
 #endif
@@ -139,22 +556,34 @@ EventQueue::insert(Event *event)
 {
     // Deal with the head case
     if (!head || *event <= *head) {
+        Event *curr = head;
         head = Event::insertBefore(event, head);
+        if (calendar)
+            calendar->inserted(event, nullptr, curr);
         return;
     }
 
     // Figure out either which 'in bin' list we are on, or where a new list
     // needs to be inserted
-    Event *prev = head;
-    Event *curr = head->nextBin;
-    while (curr && *curr < *event) {
-        prev = curr;
-        curr = curr->nextBin;
+    Event *prev;
+    Event *curr;
+    if (calendar) {
+        prev = calendar->findPrev(event, head);
+        curr = prev->nextBin;
+    } else {
+        prev = head;
+        curr = head->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
     }
 
     // Note: this operation may render all nextBin pointers on the
     // prev 'in bin' list stale (except for the top one)
     prev->nextBin = Event::insertBefore(event, curr);
+    if (calendar)
+        calendar->inserted(event, prev, curr);
 }
 
 Event *
@@ -199,16 +628,26 @@ EventQueue::remove(Event *event)
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
+        Event *top = head;
         head = Event::removeItem(event, head);
+        if (calendar)
+            calendar->removed(top, head, nullptr);
         return;
     }
 
     // Find the 'in bin' list that this event belongs on
-    Event *prev = head;
-    Event *curr = head->nextBin;
-    while (curr && *curr < *event) {
-        prev = curr;
-        curr = curr->nextBin;
+    Event *prev;
+    Event *curr;
+    if (calendar) {
+        prev = calendar->findPrev(event, head);
+        curr = prev->nextBin;
+    } else {
+        prev = head;
+        curr = head->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
     }
 
     if (!curr || *curr != *event)
@@ -218,6 +657,8 @@ EventQueue::remove(Event *event)
     // we remove an item, it returns the new top item (which may be
     // unchanged)
     prev->nextBin = Event::removeItem(event, curr);
+    if (calendar)
+        calendar->removed(curr, prev->nextBin, prev);
 }
 
 Event *
@@ -240,13 +681,28 @@ EventQueue::serviceOne()
         head = head->nextBin;
     }
 
+    if (calendar)
+        calendar->removed(event, head, nullptr);
+
     // handle action
     if (!event->squashed()) {
         // forward current cycle to the time when this event occurs.
         setCurTick(event->when());
+        if (calendar)
+            calendar->advance(event->when(), head);
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (profile) {
+            // Find the entry first, the event may be gone once processed
+            ProfileEntry &entry = profile->entry(event,
+                !event->flags.isSet(Event::AutoDelete));
+            const uint64_t start = hostCycles();
+            event->process();
+            entry.cycles += hostCycles() - start;
+            entry.count++;
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -383,6 +839,8 @@ EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
     head = s;
+    if (calendar)
+        calendar->rebuild(head, getCurTick());
     return t;
 }
 
@@ -442,30 +900,104 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), asyncHead(nullptr)
 {
 }
 
+EventQueue::~EventQueue()
+{
+    while (!empty())
+        deschedule(getHead());
+}
+
+void
+EventQueue::setCalendar(unsigned num_buckets, Tick bucket_width)
+{
+    if (num_buckets == 0) {
+        calendar.reset();
+        return;
+    }
+
+    calendar.reset(new CalendarIndex(num_buckets, bucket_width));
+    calendar->rebuild(head, getCurTick());
+}
+
+void
+EventQueue::setProfiling(bool enable)
+{
+    if (!enable)
+        profile.reset();
+    else if (!profile)
+        profile.reset(new EventProfile);
+}
+
+void
+EventQueue::addProfile(Profile &profile) const
+{
+    if (this->profile)
+        this->profile->addTo(profile);
+}
+
+void
+EventQueue::addAsyncChannel(const EventQueue *src, size_t capacity)
+{
+    assert(src != this);
+    for (const auto &channel : asyncChannels) {
+        if (channel->src == src)
+            return;
+    }
+    asyncChannels.emplace_back(new AsyncChannel(src, capacity));
+}
+
 void
 EventQueue::asyncInsert(Event *event)
 {
-    async_queue_mutex.lock();
-    async_queue.push_back(event);
-    async_queue_mutex.unlock();
+    // The channels are only added before the simulation threads start,
+    // so they can be searched without synchronisation.
+    const EventQueue *src = curEventQueue();
+    for (const auto &channel : asyncChannels) {
+        if (channel->src == src) {
+            if (channel->push(event))
+                return;
+            break;
+        }
+    }
+
+    Event *next = asyncHead.load(std::memory_order_relaxed);
+    do {
+        event->nextBin = next;
+    } while (!asyncHead.compare_exchange_weak(next, event,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
 }
 
 void
 EventQueue::handleAsyncInsertions()
 {
     assert(this == curEventQueue());
-    async_queue_mutex.lock();
 
-    while (!async_queue.empty()) {
-        insert(async_queue.front());
-        async_queue.pop_front();
+    for (const auto &channel : asyncChannels)
+        channel->drain([this](Event *event) { insert(event); });
+
+    if (!asyncHead.load(std::memory_order_relaxed))
+        return;
+
+    // Take the whole stack at once and reverse it, so events are
+    // inserted in the order they were scheduled.
+    Event *event = asyncHead.exchange(nullptr, std::memory_order_acquire);
+    Event *ordered = nullptr;
+    while (event) {
+        Event *next = event->nextBin;
+        event->nextBin = ordered;
+        ordered = event;
+        event = next;
     }
 
-    async_queue_mutex.unlock();
+    while (ordered) {
+        Event *next = ordered->nextBin;
+        insert(ordered);
+        ordered = next;
+    }
 }
 
 } // namespace gem5
@@ -36,6 +36,7 @@
 #define __SIM_EVENTQ_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <functional>
@@ -43,6 +44,8 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -88,6 +91,20 @@ extern bool inParallelMode;
 //! is with in bounds.
 EventQueue *getEventQueue(uint32_t index);
 
+//! Enable the calendar index on all current and future main event
+//! queues. A bucket count of zero disables the index.
+//! @see EventQueue::setCalendar()
+void setMainEventQueueCalendar(unsigned num_buckets, Tick bucket_width);
+
+//! Enable or disable profiling on all current and future main event
+//! queues. @see EventQueue::setProfiling()
+void setMainEventQueueProfiling(bool enable);
+
+//! Write the profile of all the main event queues, as folded stacks for
+//! flame graphs (the SimObject hierarchy and the host cycles) and as a
+//! report sorted by host cycles.
+void dumpEventProfile(std::ostream &folded, std::ostream &report);
+
 inline EventQueue *curEventQueue() { return _curEventQueue; }
 inline void curEventQueue(EventQueue *q);
 
@@ -264,7 +281,9 @@ class Event : public EventBase, public Serializable
     // result is that the insert/removal in 'nextBin' is
     // linear/constant, and the lookup/removal in 'nextInBin' is
     // constant/constant.  Hopefully this is a significant improvement
-    // over the current fully linear insertion.
+    // over the current fully linear insertion.  The linear search for
+    // a bin can optionally be replaced by a calendar index, see
+    // EventQueue::setCalendar().
     Event *nextBin;
     Event *nextInBin;
 
@@ -621,11 +640,29 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
-    //! Mutex to protect async queue.
-    UncontendedMutex async_queue_mutex;
+    class CalendarIndex;
+
+    //! Optional index used to find bins without walking the bin list.
+    std::unique_ptr<CalendarIndex> calendar;
+
+    class EventProfile;
+
+    //! Optional host time profile of the processed events.
+    std::unique_ptr<EventProfile> profile;
+
+    class AsyncChannel;
+
+    /**
+     * Events added by other threads to this event queue. This is a
+     * lock-free stack of events linked through their nextBin pointer,
+     * which is unused until the event is inserted in the queue. Any
+     * thread may push events, only the owning thread removes them.
+     */
+    std::atomic<Event *> asyncHead;
 
-    //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    //! Single producer channels from other queues.
+    //! @see EventQueue::addAsyncChannel()
+    std::vector<std::unique_ptr<AsyncChannel>> asyncChannels;
 
     /**
      * Lock protecting event handling.
@@ -948,6 +985,74 @@ class EventQueue
     void unlock() { service_mutex.unlock(); }
     /**@}*/
 
+    /**
+     * Index the bins of this queue using a calendar.
+     *
+     * By default, finding the bin of an event walks the list of bins,
+     * which is linear in the number of distinct pending (tick,
+     * priority) pairs. The calendar splits the near future into
+     * num_buckets buckets of bucket_width ticks each (rounded up to a
+     * power of two) and remembers the first and last bin of every
+     * bucket, so that inserting and removing events that fall into
+     * the calendar takes constant time on average. The bin list itself
+     * is unchanged, so event ordering and checkpointing are identical
+     * with and without the index.
+     *
+     * @param num_buckets Number of buckets (rounded up to a power of
+     *                    two), zero disables the index.
+     * @param bucket_width Width of each bucket in ticks.
+     */
+    void setCalendar(unsigned num_buckets, Tick bucket_width);
+
+    /** Host time and number of the processed events of a name. */
+    struct ProfileEntry
+    {
+        /** Host cycles spent processing the events */
+        uint64_t cycles = 0;
+        /** Number of events processed */
+        uint64_t count = 0;
+    };
+    typedef std::unordered_map<std::string, ProfileEntry> Profile;
+
+    /**
+     * Profile the host time spent processing events.
+     *
+     * The time is measured in host cycles (the time stamp counter where
+     * there is one) and attributed to the name of each event, which
+     * starts with the name of the SimObject owning the event for
+     * EventFunctionWrapper and most other events. The name of an event
+     * is only looked up the first time it is processed, unless it is
+     * deleted after being processed.
+     *
+     * @param enable Whether to profile, disabling drops the profile.
+     */
+    void setProfiling(bool enable);
+
+    /** Add the profile of this queue to profile. */
+    void addProfile(Profile &profile) const;
+
+    /**
+     * Add a dedicated channel for events that the queue src schedules
+     * on this queue.
+     *
+     * Events scheduled by other threads are normally pushed on a
+     * lock-free stack that all producers share. For links that carry a
+     * lot of traffic, a channel is a ring buffer with a single
+     * producer, so the producer does not contend with the others. It
+     * is used by the thread currently running as src, which holds the
+     * service lock of src, so there is only ever one producer at a
+     * time. If the ring is full, events fall back to the shared
+     * stack.
+     *
+     * Channels must be added before the simulation threads start.
+     * Adding a channel that already exists has no effect.
+     *
+     * @param src Queue scheduling events on this queue.
+     * @param capacity Number of events in the ring (rounded up to a
+     *                 power of two).
+     */
+    void addAsyncChannel(const EventQueue *src, size_t capacity = 1024);
+
     /**
      * Reschedule an event after a checkpoint.
      *
@@ -961,11 +1066,7 @@ class EventQueue
      */
     void checkpointReschedule(Event *event);
 
-    virtual ~EventQueue()
-    {
-        while (!empty())
-            deschedule(getHead());
-    }
+    virtual ~EventQueue();
 };
 
 inline void
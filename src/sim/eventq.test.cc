@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Event that records its id in a log when processed. */
+class LogEvent : public Event
+{
+  public:
+    LogEvent(std::vector<int> &_log, int _id, Priority p)
+        : Event(p), log(_log), id(_id)
+    {}
+
+    void process() override { log.push_back(id); }
+
+  private:
+    std::vector<int> &log;
+    int id;
+};
+
+/**
+ * Apply the same random sequence of schedule, deschedule, reschedule
+ * and service operations to a queue and return the processing order.
+ */
+std::vector<int>
+runRandom(EventQueue &eq, unsigned seed, Tick spread)
+{
+    std::vector<int> log;
+    std::vector<std::unique_ptr<LogEvent>> events;
+    std::mt19937 rng(seed);
+    const Event::Priority prios[] = {
+        Event::Minimum_Pri, Event::Default_Pri, Event::CPU_Tick_Pri,
+        Event::Maximum_Pri
+    };
+
+    curEventQueue(&eq);
+    for (int i = 0; i < 512; i++) {
+        events.emplace_back(
+            new LogEvent(log, i, prios[rng() % 4]));
+    }
+
+    for (int step = 0; step < 20000; step++) {
+        LogEvent *e = events[rng() % events.size()].get();
+        const Tick when = eq.getCurTick() + rng() % spread;
+        switch (rng() % 4) {
+          case 0:
+          case 1:
+            if (!e->scheduled())
+                eq.schedule(e, when);
+            break;
+          case 2:
+            if (e->scheduled())
+                eq.deschedule(e);
+            else if (!eq.empty())
+                eq.serviceOne();
+            break;
+          case 3:
+            eq.reschedule(e, when, true);
+            break;
+        }
+        if (step % 64 == 0) {
+            EXPECT_TRUE(eq.debugVerify());
+        }
+    }
+
+    while (!eq.empty())
+        eq.serviceOne();
+    curEventQueue(nullptr);
+    return log;
+}
+
+} // anonymous namespace
+
+/** An event queue services events in time and priority order. */
+TEST(EventQueueTest, Ordering)
+{
+    std::vector<int> log;
+    EventQueue eq("eq");
+    LogEvent a(log, 0, Event::Default_Pri);
+    LogEvent b(log, 1, Event::Minimum_Pri);
+    LogEvent c(log, 2, Event::Default_Pri);
+
+    curEventQueue(&eq);
+    eq.schedule(&a, 10);
+    eq.schedule(&b, 10);
+    eq.schedule(&c, 5);
+    while (!eq.empty())
+        eq.serviceOne();
+    curEventQueue(nullptr);
+
+    EXPECT_EQ(log, std::vector<int>({2, 1, 0}));
+}
+
+/**
+ * The calendar index must not change the order in which events are
+ * serviced. Use narrow buckets so that events fall both inside and
+ * beyond the calendar window.
+ */
+TEST(EventQueueTest, CalendarMatchesList)
+{
+    for (unsigned seed = 0; seed < 4; seed++) {
+        for (Tick spread : {Tick(16), Tick(1000), Tick(100000)}) {
+            EventQueue reference("reference");
+            EventQueue indexed("indexed");
+            indexed.setCalendar(64, 8);
+
+            EXPECT_EQ(runRandom(reference, seed, spread),
+                      runRandom(indexed, seed, spread));
+        }
+    }
+}
+
+/** The index can be enabled and disabled with events pending. */
+TEST(EventQueueTest, CalendarToggle)
+{
+    std::vector<int> log;
+    EventQueue eq("eq");
+    LogEvent a(log, 0, Event::Default_Pri);
+    LogEvent b(log, 1, Event::Default_Pri);
+    LogEvent c(log, 2, Event::Default_Pri);
+
+    curEventQueue(&eq);
+    eq.schedule(&a, 3000);
+    eq.schedule(&b, 20);
+    eq.setCalendar(64, 16);
+    eq.schedule(&c, 100);
+    eq.setCalendar(0, 0);
+    eq.reschedule(&b, 200);
+    eq.setCalendar(128, 1);
+    while (!eq.empty())
+        eq.serviceOne();
+    curEventQueue(nullptr);
+
+    EXPECT_EQ(log, std::vector<int>({2, 1, 0}));
+}
+
+/**
+ * Events scheduled by other threads, through the shared stack or a
+ * channel, are all inserted when the owner handles async insertions.
+ */
+TEST(EventQueueTest, AsyncInsertions)
+{
+    const int producers = 4;
+    const int per_producer = 1000;
+
+    std::vector<int> log;
+    EventQueue target("target");
+    std::vector<std::unique_ptr<EventQueue>> sources;
+    std::vector<std::unique_ptr<LogEvent>> events;
+    for (int p = 0; p < producers; p++)
+        sources.emplace_back(new EventQueue("source"));
+    for (int i = 0; i < producers * per_producer; i++)
+        events.emplace_back(new LogEvent(log, i, Event::Default_Pri));
+
+    // A small ring forces some of its events onto the shared stack
+    target.addAsyncChannel(sources[0].get(), 4);
+    target.addAsyncChannel(sources[1].get());
+
+    inParallelMode = true;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            curEventQueue(sources[p].get());
+            for (int i = p; i < producers * per_producer; i += producers)
+                target.schedule(events[i].get(), i + 1);
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    inParallelMode = false;
+
+    curEventQueue(&target);
+    EXPECT_TRUE(target.empty());
+    target.handleAsyncInsertions();
+    EXPECT_TRUE(target.debugVerify());
+    while (!target.empty())
+        target.serviceOne();
+    curEventQueue(nullptr);
+
+    ASSERT_EQ(log.size(), producers * per_producer);
+    for (int i = 0; i < producers * per_producer; i++)
+        EXPECT_EQ(log[i], i);
+}
+
+/** The profile counts the processed events of each name. */
+TEST(EventQueueTest, Profile)
+{
+    std::vector<int> log;
+    EventQueue eq("eq");
+    EventFunctionWrapper a([&]() { log.push_back(0); }, "system.a");
+    EventFunctionWrapper b([&]() { log.push_back(1); }, "system.b");
+
+    curEventQueue(&eq);
+    eq.setProfiling(true);
+    for (Tick when = 10; when <= 50; when += 10) {
+        eq.schedule(&a, when);
+        if (when <= 20)
+            eq.schedule(&b, when);
+        while (!eq.empty())
+            eq.serviceOne();
+    }
+    for (int i = 0; i < 3; i++) {
+        eq.schedule(new EventFunctionWrapper([&]() { log.push_back(2); },
+                                             "system.c", true),
+                    100 + i);
+    }
+    while (!eq.empty())
+        eq.serviceOne();
+    curEventQueue(nullptr);
+
+    EXPECT_EQ(log.size(), 10);
+
+    EventQueue::Profile profile;
+    eq.addProfile(profile);
+    ASSERT_EQ(profile.size(), 3);
+    EXPECT_EQ(profile["system.a.wrapped_function_event"].count, 5);
+    EXPECT_EQ(profile["system.b.wrapped_function_event"].count, 2);
+    EXPECT_EQ(profile["system.c.wrapped_function_event"].count, 3);
+
+    // Disabling the profile drops it
+    eq.setProfiling(false);
+    profile.clear();
+    eq.addProfile(profile);
+    EXPECT_TRUE(profile.empty());
+}
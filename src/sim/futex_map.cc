@@ -28,6 +28,8 @@
 
 #include <sim/futex_map.hh>
 
+#include <sim/se_workload.hh>
+
 namespace gem5
 {
 
@@ -58,6 +60,7 @@ FutexMap::suspend(Addr addr, uint64_t tgid, ThreadContext *tc)
 int
 FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -73,7 +76,7 @@ FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
         // must only count threads that were actually
         // woken up by this syscall.
         auto& tc = waiterList.front().tc;
-        tc->activate();
+        SEWorkload::updateThread(tc, [tc]() { tc->activate(); });
         woken_up++;
         waiterList.pop_front();
         waitingTcs.erase(tc);
@@ -89,6 +92,7 @@ void
 FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
                int bitmask)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -107,6 +111,7 @@ FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
 int
 FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -122,7 +127,8 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
         WaiterState& waiter = *iter;
 
         if (waiter.checkMask(bitmask)) {
-            waiter.tc->activate();
+            ThreadContext *tc = waiter.tc;
+            SEWorkload::updateThread(tc, [tc]() { tc->activate(); });
             waitingTcs.erase(waiter.tc);
             iter = waiterList.erase(iter);
             woken_up++;
@@ -140,6 +146,7 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
 int
 FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     FutexKey key1(addr1, tgid);
     auto it1 = find(key1);
 
@@ -150,7 +157,8 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
     auto &waiterList1 = it1->second;
 
     while (!waiterList1.empty() && woken_up < count) {
-        waiterList1.front().tc->activate();
+        ThreadContext *tc = waiterList1.front().tc;
+        SEWorkload::updateThread(tc, [tc]() { tc->activate(); });
         waiterList1.pop_front();
         woken_up++;
     }
@@ -184,6 +192,7 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
 bool
 FutexMap::is_waiting(ThreadContext *tc)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return waitingTcs.find(tc) != waitingTcs.end();
 }
 
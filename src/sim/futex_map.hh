@@ -29,6 +29,7 @@
 #ifndef __FUTEX_MAP_HH__
 #define __FUTEX_MAP_HH__
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -104,7 +105,9 @@ class WaiterState
 typedef std::list<WaiterState> WaiterList;
 
 /**
- * FutexMap class holds a map of all futexes used in the system
+ * FutexMap class holds a map of all futexes used in the system. It may be
+ * used by CPUs on different event queues, and wakes threads from the
+ * queues of their CPUs.
  */
 class FutexMap : public std::unordered_map<FutexKey, WaiterList>
 {
@@ -141,6 +144,9 @@ class FutexMap : public std::unordered_map<FutexKey, WaiterList>
   private:
 
     std::unordered_set<ThreadContext *> waitingTcs;
+
+    /** Protects the map from concurrent use in parallel mode. */
+    std::mutex mutex;
 };
 
 } // namespace gem5
@@ -29,12 +29,15 @@
 
 #include "sim/global_event.hh"
 
+#include <algorithm>
+
 #include "sim/cur_tick.hh"
 
 namespace gem5
 {
 
 std::mutex BaseGlobalEvent::globalQMutex;
+bool BaseGlobalEvent::serialBarriers = false;
 
 BaseGlobalEvent::BaseGlobalEvent(Priority p, Flags f)
     : barrier(numMainEventQueues),
@@ -143,6 +146,23 @@ GlobalEvent::BarrierEvent::process()
 void
 GlobalSyncEvent::BarrierEvent::process()
 {
+    GlobalSyncEvent *sync = static_cast<GlobalSyncEvent *>(_globalEvent);
+    if (sync->elastic) {
+        // Once every queue has arrived, nothing else can be scheduled
+        // on this one until the barrier is released, so its earliest
+        // pending event is final.
+        globalBarrier();
+
+        EventQueue *eventq = curEventQueue();
+        eventq->handleAsyncInsertions();
+        const Tick next = eventq->empty() ? MaxTick : eventq->nextTick();
+        Tick pending = sync->nextPending.load(std::memory_order_relaxed);
+        while (next < pending &&
+               !sync->nextPending.compare_exchange_weak(
+                   pending, next, std::memory_order_relaxed)) {
+        }
+    }
+
     // wait for all queues to arrive at barrier, then process event
     if (globalBarrier()) {
         _globalEvent->process();
@@ -157,8 +177,16 @@ GlobalSyncEvent::BarrierEvent::process()
 void
 GlobalSyncEvent::process()
 {
+    Tick base = curTick();
+    if (elastic) {
+        // Nothing can cross between queues before the earliest pending
+        // event is serviced, so the quantum can start from there.
+        base = std::max(base, nextPending.load(std::memory_order_relaxed));
+        nextPending.store(MaxTick, std::memory_order_relaxed);
+    }
+
     if (repeat) {
-        schedule(curTick() + repeat);
+        schedule(base > MaxTick - repeat ? MaxTick : base + repeat);
     }
 }
 
@@ -30,6 +30,7 @@
 #ifndef __SIM_GLOBAL_EVENT_HH__
 #define __SIM_GLOBAL_EVENT_HH__
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -92,6 +93,12 @@ class BaseGlobalEvent : public EventBase
 
         bool globalBarrier()
         {
+            // A single thread services the local events one queue at a
+            // time, from the last queue to the first, so the event on
+            // the first queue is the last to arrive.
+            if (serialBarriers)
+                return _globalEvent->barrierEvent[0] == this;
+
             // This method will be called from the process() method in
             // the local barrier events
             // (GlobalSyncEvent::BarrierEvent).  The local event
@@ -116,6 +123,14 @@ class BaseGlobalEvent : public EventBase
     std::vector<BarrierEvent *> barrierEvent;
 
   public:
+    /**
+     * Set when the local events of a global event are serviced by a
+     * single thread, one queue at a time in descending queue order,
+     * rather than concurrently by one thread per queue. The barriers
+     * then only pick the local event that processes the global event.
+     */
+    static bool serialBarriers;
+
     BaseGlobalEvent(Priority p, Flags f);
 
     virtual ~BaseGlobalEvent();
@@ -238,6 +253,17 @@ class GlobalSyncEvent : public BaseGlobalEventTemplate<GlobalSyncEvent>
     const char *description() const;
 
     Tick repeat;
+
+    /**
+     * Reschedule a repeating event one repeat interval after the
+     * earliest event pending on any queue rather than after the
+     * current tick. This needs one more barrier per synchronisation.
+     */
+    bool elastic = false;
+
+  private:
+    /** Earliest event pending on any queue at the current barrier. */
+    std::atomic<Tick> nextPending{MaxTick};
 };
 
 } // namespace gem5
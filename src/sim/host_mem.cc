@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/host_mem.hh"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/statistics.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace host_mem
+{
+
+namespace
+{
+
+struct Account;
+
+/** The stats of an object, in its hostMem group. */
+struct AccountStats : public statistics::Group
+{
+    AccountStats(SimObject *owner, const Account &account);
+
+    void
+    addPurpose(const std::string &purpose, const int64_t &bytes)
+    {
+        auto &value = purposes.emplace_back(this, purpose.c_str(),
+            statistics::units::Byte::get(),
+            "Host memory accounted to the object for this purpose");
+        value.functor([&bytes] { return (statistics::Result)bytes; });
+    }
+
+    statistics::Value total;
+    std::list<statistics::Value> purposes;
+};
+
+/** The host memory accounted to an object. */
+struct Account
+{
+    const SimObject *owner;
+    /** The nodes of a map keep their address, the counters point there. */
+    std::map<std::string, int64_t> bytes;
+    /** The sum of the purposes when it was last computed. */
+    mutable int64_t totalBytes = 0;
+    std::unique_ptr<AccountStats> stats;
+
+    int64_t
+    total() const
+    {
+        totalBytes = 0;
+        for (const auto &[purpose, size] : bytes)
+            totalBytes += size;
+        return totalBytes;
+    }
+};
+
+AccountStats::AccountStats(SimObject *owner, const Account &account)
+  : statistics::Group(owner, "hostMem"),
+    ADD_STAT(total, statistics::units::Byte::get(),
+             "Host memory accounted to the object")
+{
+    total.functor([&account] {
+        return (statistics::Result)account.total();
+    });
+}
+
+/**
+ * The accounts of all the objects, which are never destroyed as the
+ * objects they belong to live until the end of the simulation.
+ */
+std::map<const SimObject *, Account> &
+accounts()
+{
+    static auto *accounts = new std::map<const SimObject *, Account>;
+    return *accounts;
+}
+
+std::mutex accountsLock;
+
+} // anonymous namespace
+
+Counter::Counter(const SimObject *owner, const std::string &purpose)
+{
+    std::lock_guard<std::mutex> lock(accountsLock);
+    auto [it, new_owner] = accounts().try_emplace(owner);
+    Account &account = it->second;
+    if (new_owner)
+        account.owner = owner;
+
+    auto [bytes_it, new_purpose] = account.bytes.try_emplace(purpose, 0);
+    bytes = &bytes_it->second;
+    if (!new_purpose || statistics::enabled())
+        return;
+
+    // the stats only read the counts, the object doesn't change
+    auto *object = const_cast<SimObject *>(owner);
+    if (!account.stats) {
+        account.stats = std::make_unique<AccountStats>(object, account);
+    }
+    account.stats->addPurpose(purpose, *bytes);
+}
+
+int64_t
+accounted(const SimObject *owner)
+{
+    std::lock_guard<std::mutex> lock(accountsLock);
+    if (owner) {
+        auto it = accounts().find(owner);
+        return it == accounts().end() ? 0 : it->second.total();
+    }
+
+    int64_t total = 0;
+    for (const auto &[object, account] : accounts())
+        total += account.total();
+    return total;
+}
+
+void
+summarize(std::ostream &os, unsigned max_objects)
+{
+    std::lock_guard<std::mutex> lock(accountsLock);
+    std::vector<const Account *> sorted;
+    int64_t total = 0;
+    for (const auto &[object, account] : accounts()) {
+        total += account.total();
+        sorted.push_back(&account);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+        [](const Account *a, const Account *b) {
+            return a->totalBytes > b->totalBytes;
+        });
+
+    auto mib = [](int64_t bytes) { return bytes / (1024.0 * 1024.0); };
+    ccprintf(os, "Host memory accounted to %d objects: %.1f MiB\n",
+             sorted.size(), mib(total));
+    for (unsigned i = 0; i < std::min<size_t>(max_objects, sorted.size());
+         ++i) {
+        const Account &account = *sorted[i];
+        ccprintf(os, "  %s: %.1f MiB (", account.owner->name(),
+                 mib(account.totalBytes));
+        const char *sep = "";
+        for (const auto &[purpose, size] : account.bytes) {
+            ccprintf(os, "%s%s %.1f MiB", sep, purpose, mib(size));
+            sep = ", ";
+        }
+        ccprintf(os, ")\n");
+    }
+}
+
+} // namespace host_mem
+} // namespace gem5
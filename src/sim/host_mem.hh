@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Accounting of the host memory used by the simulated objects.
+ *
+ * Objects account their large allocations, such as the data arrays of
+ * caches or the backing store of memories, for a purpose. What is
+ * accounted to an object is reported by the stats in its hostMem group,
+ * one per purpose plus a total, and a summary of the largest users is
+ * printed at startup.
+ */
+
+#ifndef __SIM_HOST_MEM_HH__
+#define __SIM_HOST_MEM_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace gem5
+{
+
+class SimObject;
+
+namespace host_mem
+{
+
+/**
+ * The host memory an object uses for a purpose. The counters of the same
+ * object and purpose share their count, so a counter can be a temporary
+ * when accounting a single allocation. Creating a counter gives its
+ * object stats only until the stats are enabled, after that its memory is
+ * still included in the summary.
+ */
+class Counter
+{
+  private:
+    int64_t *bytes;
+
+  public:
+    /**
+     * @param owner The object the memory is accounted to.
+     * @param purpose What the memory is used for, which must be a valid
+     *        stat name.
+     */
+    Counter(const SimObject *owner, const std::string &purpose);
+
+    void allocate(size_t size) { *bytes += size; }
+    void release(size_t size) { *bytes -= size; }
+
+    int64_t value() const { return *bytes; }
+};
+
+/** Account a single allocation of an object. */
+inline void
+account(const SimObject *owner, const std::string &purpose, size_t size)
+{
+    Counter(owner, purpose).allocate(size);
+}
+
+/**
+ * The host memory accounted to an object, or to all of them if the
+ * object is null.
+ */
+int64_t accounted(const SimObject *owner = nullptr);
+
+/**
+ * Print the objects with the most host memory accounted to them, from
+ * the largest, along with the total.
+ *
+ * @param os The stream to print to.
+ * @param max_objects How many objects to print at most.
+ */
+void summarize(std::ostream &os, unsigned max_objects);
+
+} // namespace host_mem
+} // namespace gem5
+
+#endif // __SIM_HOST_MEM_HH__
@@ -112,7 +112,7 @@ KernelWorkload::initState()
                     _start, _end, mapper(_start), mapper(_end));
         }
         // Load program sections into memory
-        image.write(phys_mem);
+        image.write(system->getPhysMem(), phys_mem);
 
         DPRINTF(Loader, "Kernel start = %#x\n", _start);
         DPRINTF(Loader, "Kernel end   = %#x\n", _end);
@@ -130,7 +130,7 @@ KernelWorkload::initState()
             image = image.offset(load_addr);
         else
             image = image.move(mapper);
-        image.write(phys_mem);
+        image.write(system->getPhysMem(), phys_mem);
     }
 }
 
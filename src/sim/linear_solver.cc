@@ -37,6 +37,9 @@
 
 #include "sim/linear_solver.hh"
 
+#include <algorithm>
+#include <map>
+
 namespace gem5
 {
 
@@ -87,4 +90,191 @@ LinearSystem::solve() const
     return ret;
 }
 
+void
+SparseLinearSystem::add(unsigned eq, unsigned unkw, double value)
+{
+    assert(eq < rows.size() && unkw < rows.size());
+
+    auto &r = rows[eq];
+    auto it = std::lower_bound(r.begin(), r.end(), unkw,
+        [](const Coefficient &c, unsigned u) { return c.unkw < u; });
+    if (it != r.end() && it->unkw == unkw)
+        it->value += value;
+    else
+        r.insert(it, Coefficient{unkw, value});
+}
+
+void
+SparseLinearSystem::clear()
+{
+    for (auto &r : rows) {
+        for (auto &c : r)
+            c.value = 0;
+    }
+    std::fill(cnts.begin(), cnts.end(), 0);
+}
+
+std::string
+SparseLinearSystem::toStr() const
+{
+    std::ostringstream oss;
+    for (unsigned i = 0; i < rows.size(); i++) {
+        for (const auto &c : rows[i])
+            oss << c.value << "*x" << c.unkw << " + ";
+        oss << cnts[i] << " = 0\n";
+    }
+    return oss.str();
+}
+
+bool
+SparseLinearSystem::solveCG(std::vector<double> &x, double tolerance,
+                            unsigned max_iterations) const
+{
+    const unsigned order = rows.size();
+    assert(x.size() == order);
+
+    // Work on A' = s * A and b' = -s * c, with s chosen to make the
+    // diagonal of A' positive, so that A' is positive definite
+    double sign = 1.0;
+    std::vector<double> inv_diag(order, 0.0);
+    for (unsigned i = 0; i < order; i++) {
+        for (const auto &c : rows[i]) {
+            if (c.unkw == i) {
+                if (c.value < 0)
+                    sign = -1.0;
+                if (c.value != 0)
+                    inv_diag[i] = 1.0 / c.value;
+            }
+        }
+        if (inv_diag[i] == 0)
+            return false;
+    }
+
+    auto multiply = [this, sign](const std::vector<double> &v,
+                                 std::vector<double> &res) {
+        for (unsigned i = 0; i < rows.size(); i++) {
+            double sum = 0;
+            for (const auto &c : rows[i])
+                sum += c.value * v[c.unkw];
+            res[i] = sign * sum;
+        }
+    };
+    auto dot = [](const std::vector<double> &a,
+                  const std::vector<double> &b) {
+        double sum = 0;
+        for (unsigned i = 0; i < a.size(); i++)
+            sum += a[i] * b[i];
+        return sum;
+    };
+
+    std::vector<double> r(order), z(order), p(order), ap(order);
+    double b_norm = 0;
+    multiply(x, ap);
+    for (unsigned i = 0; i < order; i++) {
+        const double b = -sign * cnts[i];
+        b_norm += b * b;
+        r[i] = b - ap[i];
+        // inv_diag of A has the sign of A, that of A' is positive
+        z[i] = sign * inv_diag[i] * r[i];
+    }
+    p = z;
+
+    const double limit = tolerance * tolerance * std::max(b_norm, 1e-300);
+    double rz = dot(r, z);
+    for (unsigned iter = 0; iter < max_iterations; iter++) {
+        if (dot(r, r) <= limit)
+            return true;
+
+        multiply(p, ap);
+        const double pap = dot(p, ap);
+        if (pap <= 0)
+            return false;
+
+        const double alpha = rz / pap;
+        for (unsigned i = 0; i < order; i++) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * ap[i];
+            z[i] = sign * inv_diag[i] * r[i];
+        }
+
+        const double rz_next = dot(r, z);
+        const double beta = rz_next / rz;
+        rz = rz_next;
+        for (unsigned i = 0; i < order; i++)
+            p[i] = z[i] + beta * p[i];
+    }
+
+    return dot(r, r) <= limit;
+}
+
+bool
+SparseLU::factorise(const SparseLinearSystem &ls)
+{
+    const unsigned order = ls.size();
+    factored.reset();
+    lower.assign(order, {});
+    upper.assign(order, {});
+    diag.assign(order, 0.0);
+
+    // Eliminate row by row (Doolittle). The eliminated row is kept in a
+    // map as it fills in to the right of the unknown being eliminated,
+    // which is visited later on in the same pass.
+    for (unsigned i = 0; i < order; i++) {
+        std::map<unsigned, double> work;
+        for (const auto &c : ls.row(i)) {
+            if (c.value != 0)
+                work[c.unkw] = c.value;
+        }
+
+        auto it = work.begin();
+        for (; it != work.end() && it->first < i; ++it) {
+            const unsigned k = it->first;
+            const double l = it->second / diag[k];
+            it->second = l;
+            for (const auto &u : upper[k])
+                work[u.unkw] -= l * u.value;
+        }
+
+        if (it == work.end() || it->first != i || it->second == 0)
+            return false;
+
+        for (const auto &w : work) {
+            if (w.first < i)
+                lower[i].push_back(Coefficient{w.first, w.second});
+            else if (w.first == i)
+                diag[i] = w.second;
+            else if (w.second != 0)
+                upper[i].push_back(Coefficient{w.first, w.second});
+        }
+    }
+
+    factored.reset(new SparseLinearSystem(ls));
+    return true;
+}
+
+std::vector<double>
+SparseLU::solve(const SparseLinearSystem &ls) const
+{
+    assert(factors(ls));
+    const unsigned order = ls.size();
+
+    // Solve L * y = -c, then U * x = y
+    std::vector<double> x(order);
+    for (unsigned i = 0; i < order; i++) {
+        double y = -ls.constant(i);
+        for (const auto &l : lower[i])
+            y -= l.value * x[l.unkw];
+        x[i] = y;
+    }
+
+    for (int i = order - 1; i >= 0; i--) {
+        double y = x[i];
+        for (const auto &u : upper[i])
+            y -= u.value * x[u.unkw];
+        x[i] = y / diag[i];
+    }
+
+    return x;
+}
+
 } // namespace gem5
@@ -39,6 +39,7 @@
 #define __SIM_LINEAR_SOLVER_HH__
 
 #include <cassert>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -134,6 +135,120 @@ class LinearSystem
     std::vector < LinearEquation > matrix;
 };
 
+/**
+ * A system of linear equations in which every equation only has a few
+ * non-zero coefficients, e.g., the nodal equations of a large circuit.
+ * Like LinearEquation, equation i is sum_j(a_ij * x_j) + c_i = 0.
+ */
+class SparseLinearSystem
+{
+  public:
+    /** A non-zero coefficient of an equation. */
+    struct Coefficient
+    {
+        unsigned unkw;
+        double value;
+
+        bool operator==(const Coefficient &rhs) const {
+            return unkw == rhs.unkw && value == rhs.value;
+        }
+    };
+
+    SparseLinearSystem(unsigned unknowns)
+        : rows(unknowns), cnts(unknowns, 0)
+    {}
+
+    unsigned size() const { return rows.size(); }
+
+    // Add a value to the coefficient of an unknown in an equation
+    void add(unsigned eq, unsigned unkw, double value);
+
+    // Add a value to the constant term of an equation
+    void addConstant(unsigned eq, double value) {
+        assert(eq < cnts.size());
+        cnts[eq] += value;
+    }
+
+    // Zero all coefficients and constant terms, keeping the equations'
+    // non-zero structure so that rebuilding them doesn't allocate
+    void clear();
+
+    // Get the coefficients of an equation, sorted by unknown
+    const std::vector<Coefficient> &row(unsigned eq) const {
+        assert(eq < rows.size());
+        return rows[eq];
+    }
+
+    double constant(unsigned eq) const {
+        assert(eq < cnts.size());
+        return cnts[eq];
+    }
+
+    // Check if two systems have the same coefficients
+    bool sameCoefficients(const SparseLinearSystem &rhs) const {
+        return rows == rhs.rows;
+    }
+
+    std::string toStr() const;
+
+    /**
+     * Solve the system using (Jacobi preconditioned) conjugate
+     * gradients. This requires the coefficients to be symmetric and
+     * either positive or negative definite, as the nodal equations of
+     * a connected passive circuit are.
+     *
+     * @param x Initial guess, replaced by the solution.
+     * @param tolerance Residual to stop at, relative to the constants.
+     * @param max_iterations Number of iterations to give up after.
+     * @return True if the solution converged.
+     */
+    bool solveCG(std::vector<double> &x, double tolerance,
+                 unsigned max_iterations) const;
+
+  private:
+    std::vector<std::vector<Coefficient>> rows;
+    std::vector<double> cnts;
+};
+
+/**
+ * The LU factorisation of the coefficients of a SparseLinearSystem.
+ * Factorising is the expensive part of a direct solve, so a system
+ * whose coefficients don't change but whose constant terms do can be
+ * solved repeatedly from the same factorisation. There is no pivoting,
+ * which is stable for diagonally dominant systems, e.g., nodal
+ * equations.
+ */
+class SparseLU
+{
+  public:
+    /**
+     * Factorise the coefficients of a system.
+     *
+     * @return False if the system is singular.
+     */
+    bool factorise(const SparseLinearSystem &ls);
+
+    // Check if this is the factorisation of the system's coefficients
+    bool factors(const SparseLinearSystem &ls) const {
+        return factored && factored->sameCoefficients(ls);
+    }
+
+    // Solve a system with the factorised coefficients
+    std::vector<double> solve(const SparseLinearSystem &ls) const;
+
+  private:
+    using Coefficient = SparseLinearSystem::Coefficient;
+
+    /** The system that was factorised, for its coefficients. */
+    std::unique_ptr<SparseLinearSystem> factored;
+    /** Strictly lower triangular factor, with a unit diagonal. */
+    std::vector<std::vector<Coefficient>> lower;
+    /** Strictly upper triangular factor. */
+    std::vector<std::vector<Coefficient>> upper;
+    /** Diagonal of the upper triangular factor. */
+    std::vector<double> diag;
+};
+
 } // namespace gem5
 
 #endif
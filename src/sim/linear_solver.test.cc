@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "sim/linear_solver.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * Build the nodal equations of a chain of n nodes through unit
+ * resistances, with both ends tied to references at 0 and 1 and a
+ * conductance g from every node to ground. Equation i is
+ * x[i-1] - (2 + g) * x[i] + x[i+1] = 0.
+ */
+SparseLinearSystem
+chain(unsigned n, double g)
+{
+    SparseLinearSystem ls(n);
+    for (unsigned i = 0; i < n; i++) {
+        ls.add(i, i, -(2.0 + g));
+        if (i > 0)
+            ls.add(i, i - 1, 1.0);
+        if (i < n - 1)
+            ls.add(i, i + 1, 1.0);
+    }
+    ls.addConstant(n - 1, 1.0);
+    return ls;
+}
+
+/** Compute the residuals of a solution. */
+std::vector<double>
+residuals(const SparseLinearSystem &ls, const std::vector<double> &x)
+{
+    std::vector<double> r(ls.size());
+    for (unsigned i = 0; i < ls.size(); i++) {
+        r[i] = ls.constant(i);
+        for (const auto &c : ls.row(i))
+            r[i] += c.value * x[c.unkw];
+    }
+    return r;
+}
+
+} // anonymous namespace
+
+TEST(SparseLinearSystemTest, AddMergesCoefficients)
+{
+    SparseLinearSystem ls(3);
+    ls.add(0, 2, 1.0);
+    ls.add(0, 0, 2.0);
+    ls.add(0, 2, 0.5);
+    ls.addConstant(0, 4.0);
+
+    const auto &row = ls.row(0);
+    ASSERT_EQ(2, row.size());
+    EXPECT_EQ(0, row[0].unkw);
+    EXPECT_EQ(2.0, row[0].value);
+    EXPECT_EQ(2, row[1].unkw);
+    EXPECT_EQ(1.5, row[1].value);
+    EXPECT_EQ(4.0, ls.constant(0));
+    EXPECT_TRUE(ls.row(1).empty());
+}
+
+TEST(SparseLinearSystemTest, ClearKeepsStructure)
+{
+    SparseLinearSystem a = chain(4, 0.1);
+    SparseLinearSystem b = a;
+    b.clear();
+    EXPECT_FALSE(a.sameCoefficients(b));
+    EXPECT_EQ(0.0, b.constant(3));
+    EXPECT_EQ(a.row(1).size(), b.row(1).size());
+
+    b = chain(4, 0.1);
+    EXPECT_TRUE(a.sameCoefficients(b));
+}
+
+/** The sparse factorisation matches the dense solver. */
+TEST(SparseLUTest, MatchesDenseSolve)
+{
+    const unsigned n = 8;
+    SparseLinearSystem sparse = chain(n, 0.3);
+    LinearSystem dense(n);
+    for (unsigned i = 0; i < n; i++) {
+        for (const auto &c : sparse.row(i))
+            dense[i][c.unkw] = c.value;
+        dense[i][n] = sparse.constant(i);
+    }
+
+    SparseLU lu;
+    ASSERT_TRUE(lu.factorise(sparse));
+    EXPECT_TRUE(lu.factors(sparse));
+
+    std::vector<double> expected = dense.solve();
+    std::vector<double> x = lu.solve(sparse);
+    ASSERT_EQ(n, x.size());
+    for (unsigned i = 0; i < n; i++)
+        EXPECT_NEAR(expected[i], x[i], 1e-9);
+}
+
+/** A factorisation can be reused for new constant terms. */
+TEST(SparseLUTest, ReuseFactorisation)
+{
+    SparseLinearSystem ls = chain(16, 0.0);
+    SparseLU lu;
+    ASSERT_TRUE(lu.factorise(ls));
+
+    ls.clear();
+    for (unsigned i = 0; i < 16; i++) {
+        ls.add(i, i, -2.0);
+        if (i > 0)
+            ls.add(i, i - 1, 1.0);
+        if (i < 15)
+            ls.add(i, i + 1, 1.0);
+    }
+    ls.addConstant(0, 2.0);
+    ls.addConstant(15, 2.0);
+    ASSERT_TRUE(lu.factors(ls));
+
+    // Both ends at 2 with no losses, so every node is at 2
+    for (auto v : lu.solve(ls))
+        EXPECT_NEAR(2.0, v, 1e-9);
+
+    ls.add(3, 3, -1.0);
+    EXPECT_FALSE(lu.factors(ls));
+}
+
+/** Fill-in is handled when eliminating a non-banded system. */
+TEST(SparseLUTest, FillIn)
+{
+    // A star of four nodes around node 0, which fills in completely
+    SparseLinearSystem ls(5);
+    ls.add(0, 0, -5.0);
+    for (unsigned i = 1; i < 5; i++) {
+        ls.add(0, i, 1.0);
+        ls.add(i, 0, 1.0);
+        ls.add(i, i, -2.0);
+        ls.addConstant(i, i);
+    }
+
+    SparseLU lu;
+    ASSERT_TRUE(lu.factorise(ls));
+    for (auto r : residuals(ls, lu.solve(ls)))
+        EXPECT_NEAR(0.0, r, 1e-12);
+}
+
+TEST(SparseLUTest, Singular)
+{
+    // A floating node, without any connection
+    SparseLinearSystem ls(2);
+    ls.add(0, 0, -1.0);
+    ls.add(1, 1, 0.0);
+
+    SparseLU lu;
+    EXPECT_FALSE(lu.factorise(ls));
+    EXPECT_FALSE(lu.factors(ls));
+}
+
+TEST(SparseLinearSystemTest, ConjugateGradients)
+{
+    const unsigned n = 64;
+    SparseLinearSystem ls = chain(n, 0.01);
+
+    SparseLU lu;
+    ASSERT_TRUE(lu.factorise(ls));
+    std::vector<double> expected = lu.solve(ls);
+
+    std::vector<double> x(n, 0.0);
+    ASSERT_TRUE(ls.solveCG(x, 1e-12, n));
+    for (unsigned i = 0; i < n; i++)
+        EXPECT_NEAR(expected[i], x[i], 1e-9);
+
+    // Starting from the solution converges immediately
+    EXPECT_TRUE(ls.solveCG(x, 1e-9, 0));
+}
+
+TEST(SparseLinearSystemTest, ConjugateGradientsGiveUp)
+{
+    SparseLinearSystem ls = chain(64, 0.0);
+    std::vector<double> x(64, 0.0);
+    EXPECT_FALSE(ls.solveCG(x, 1e-12, 2));
+}
@@ -177,6 +177,37 @@ MathExpr::toStr(Node *n, std::string prefix) const {
     return ret;
 }
 
+MathExpr::Program
+MathExpr::compile(ResolveCallback fn) const
+{
+    Program prog;
+    compile(root, fn, prog, 1);
+    return prog;
+}
+
+void
+MathExpr::compile(const Node *n, ResolveCallback &fn, Program &prog,
+                  unsigned depth) const
+{
+    panic_if(!n || n->op == nInvalid, "Invalid node!\n");
+    prog.maxDepth = std::max(prog.maxDepth, depth);
+
+    if (n->op == sValue) {
+        prog.code.push_back({sValue, 0, n->value});
+        return;
+    } else if (n->op == sVariable) {
+        prog.code.push_back({sVariable, fn(n->variable), 0});
+        return;
+    }
+
+    // Unary operators only have a right hand side. For binary ones, the
+    // left hand side stays on the stack while the right one is built.
+    if (n->l)
+        compile(n->l, fn, prog, depth);
+    compile(n->r, fn, prog, n->l ? depth + 1 : depth);
+    prog.code.push_back({n->op, 0, 0});
+}
+
 void
 MathExpr::getVariables(const Node *n,
                        std::vector<std::string> &variables) const
@@ -40,6 +40,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
+#include <cmath>
 #include <functional>
 #include <string>
 #include <vector>
@@ -55,6 +57,22 @@ class MathExpr
 
     typedef std::function<double(std::string)> EvalCallback;
 
+    /** Map a variable to the index it is passed to Program::eval by */
+    typedef std::function<unsigned(const std::string &)> ResolveCallback;
+
+    class Program;
+
+    /**
+     * Compile the expression into a flat program, which can be
+     * evaluated repeatedly without walking the tree or looking up
+     * variables by name.
+     *
+     * @param fn A callback function to resolve variables to indices
+     *
+     * @return The compiled program
+     */
+    Program compile(ResolveCallback fn) const;
+
     /**
      * Prints an ASCII representation of the expression tree
      *
@@ -147,6 +165,86 @@ class MathExpr
     /** Return all variable reachable from a node to a vector of
      * strings */
     void getVariables(const Node *n, std::vector<std::string> &vars) const;
+
+    /** Append the instructions of a node to a program */
+    void compile(const Node *n, ResolveCallback &fn, Program &prog,
+                 unsigned depth) const;
+
+  public:
+    /**
+     * A compiled expression: the nodes of the tree in post-order, to be
+     * run on a stack, with variables replaced by the indices they were
+     * resolved to.
+     */
+    class Program
+    {
+      public:
+        /**
+         * Evaluates the program
+         *
+         * @param fn A callable returning the value of the variable
+         *           resolved to a given index
+         *
+         * @return The value for the expression
+         */
+        template <class Fn>
+        double
+        eval(Fn &&fn) const
+        {
+            double small[16];
+            std::vector<double> large;
+            double *stack = small;
+            if (maxDepth > 16) {
+                large.resize(maxDepth);
+                stack = large.data();
+            }
+
+            unsigned sp = 0;
+            for (const auto &i : code) {
+                switch (i.op) {
+                  case sValue:
+                    stack[sp++] = i.value;
+                    continue;
+                  case sVariable:
+                    stack[sp++] = fn(i.index);
+                    continue;
+                  case uNeg:
+                    stack[sp - 1] = -stack[sp - 1];
+                    continue;
+                  default:
+                    break;
+                }
+
+                const double b = stack[--sp];
+                double &a = stack[sp - 1];
+                switch (i.op) {
+                  case bAdd: a = a + b; break;
+                  case bSub: a = a - b; break;
+                  case bMul: a = a * b; break;
+                  case bDiv: a = a / b; break;
+                  case bPow: a = std::pow(a, b); break;
+                  default: assert(false);
+                }
+            }
+
+            assert(sp == 1);
+            return stack[0];
+        }
+
+      private:
+        friend class MathExpr;
+
+        struct Instruction
+        {
+            Operator op;
+            unsigned index;
+            double value;
+        };
+
+        std::vector<Instruction> code;
+        /** Stack depth needed to evaluate the program */
+        unsigned maxDepth = 0;
+    };
 };
 
 } // namespace gem5
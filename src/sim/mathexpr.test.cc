@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sim/mathexpr.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const std::map<std::string, double> values = {
+    {"a", 3.0}, {"b", -2.0}, {"sys.cpu.numCycles", 1000.0},
+};
+
+/** Evaluate an expression both by walking it and compiled, checking
+ * that both agree. */
+double
+evalBoth(const std::string &str)
+{
+    MathExpr expr(str);
+    const double walked = expr.eval(
+        [](std::string name) { return values.at(name); });
+
+    std::vector<std::string> names;
+    MathExpr::Program prog = expr.compile(
+        [&names](const std::string &name) {
+            names.push_back(name);
+            return names.size() - 1;
+        });
+    const double compiled = prog.eval(
+        [&names](unsigned index) { return values.at(names.at(index)); });
+
+    EXPECT_DOUBLE_EQ(walked, compiled) << str;
+    return compiled;
+}
+
+} // anonymous namespace
+
+TEST(MathExprTest, CompiledConstants)
+{
+    EXPECT_DOUBLE_EQ(7.0, evalBoth("1+2*3"));
+    EXPECT_DOUBLE_EQ(9.0, evalBoth("(1+2)*3"));
+    EXPECT_DOUBLE_EQ(-1.0, evalBoth("1-2"));
+    EXPECT_DOUBLE_EQ(0.25, evalBoth("1/4"));
+    EXPECT_DOUBLE_EQ(8.0, evalBoth("2^3"));
+}
+
+TEST(MathExprTest, CompiledVariables)
+{
+    EXPECT_DOUBLE_EQ(1.0, evalBoth("a+b"));
+    EXPECT_DOUBLE_EQ(-9.0, evalBoth("a*a*b/2"));
+    EXPECT_DOUBLE_EQ(2.0, evalBoth("-b"));
+    EXPECT_DOUBLE_EQ(3.0, evalBoth("sys.cpu.numCycles * a / 1000"));
+    EXPECT_DOUBLE_EQ(3.0, evalBoth("a - b - 2"));
+}
+
+/** Expressions deeper than the evaluation stack kept in place. */
+TEST(MathExprTest, CompiledDeepExpression)
+{
+    std::string str = "a";
+    for (int i = 0; i < 40; i++)
+        str = "(" + str + "+(a*b))";
+    EXPECT_DOUBLE_EQ(3.0 - 40 * 6.0, evalBoth(str));
+
+    str = "a";
+    for (int i = 0; i < 40; i++)
+        str = "b+(" + str + ")";
+    EXPECT_DOUBLE_EQ(3.0 - 40 * 2.0, evalBoth(str));
+}
@@ -56,30 +56,81 @@ MathExprPowerModel::MathExprPowerModel(const Params &p)
 void
 MathExprPowerModel::startup()
 {
-    for (auto expr: {dyn_expr, st_expr}) {
-        std::vector<std::string> vars = expr.getVariables();
-
-        for (auto var: vars) {
-            // Automatic variables:
-            if (var == "temp" || var == "voltage" || var == "clock_period") {
-                continue;
-            }
-
-            auto *info = statistics::resolve(var);
-            fatal_if(!info, "Failed to evaluate %s in expression:\n%s\n",
-                     var, expr.toStr());
-            statsMap[var] = info;
+    // Compile the expressions once, so that sampling the power doesn't
+    // walk the expression trees or look up stats by name
+    dyn_prog = dyn_expr.compile([this](const std::string &name) {
+        return resolve(dyn_expr, name);
+    });
+    st_prog = st_expr.compile([this](const std::string &name) {
+        return resolve(st_expr, name);
+    });
+}
+
+unsigned
+MathExprPowerModel::resolve(const MathExpr &expr, const std::string &name)
+{
+    using namespace statistics;
+
+    auto it = variableIndex.find(name);
+    if (it != variableIndex.end())
+        return it->second;
+
+    Variable var{Variable::Temp, nullptr, nullptr};
+
+    // Automatic variables:
+    if (name == "temp") {
+        var.kind = Variable::Temp;
+    } else if (name == "voltage") {
+        var.kind = Variable::Voltage;
+    } else if (name == "clock_period") {
+        var.kind = Variable::ClockPeriod;
+    } else {
+        auto *info = statistics::resolve(name);
+        fatal_if(!info, "Failed to evaluate %s in expression:\n%s\n",
+                 name, expr.toStr());
+        statsMap[name] = info;
+
+        // Try to cast the stat, only these are supported right now
+        if ((var.scalar = dynamic_cast<const ScalarInfo *>(info))) {
+            var.kind = Variable::Scalar;
+        } else if ((var.formula = dynamic_cast<const FormulaInfo *>(info))) {
+            var.kind = Variable::Formula;
+        } else {
+            fatal("Unsupported type of stat %s in expression:\n%s\n",
+                  name, expr.toStr());
         }
     }
+
+    variables.push_back(var);
+    variableIndex[name] = variables.size() - 1;
+    return variables.size() - 1;
+}
+
+double
+MathExprPowerModel::eval(const MathExpr::Program &prog) const
+{
+    return prog.eval([this](unsigned index) {
+        return getValue(variables[index]);
+    });
 }
 
 double
-MathExprPowerModel::eval(const MathExpr &expr) const
+MathExprPowerModel::getValue(const Variable &var) const
 {
-    return expr.eval(
-        std::bind(&MathExprPowerModel::getStatValue,
-                  this, std::placeholders::_1)
-        );
+    switch (var.kind) {
+      case Variable::Temp:
+        return _temp.toCelsius();
+      case Variable::Voltage:
+        return clocked_object->voltage();
+      case Variable::ClockPeriod:
+        return clocked_object->clockPeriod();
+      case Variable::Scalar:
+        return var.scalar->value();
+      case Variable::Formula:
+        return var.formula->total();
+    }
+
+    panic("Unknown variable kind!\n");
 }
 
 double
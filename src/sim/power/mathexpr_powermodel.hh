@@ -39,6 +39,7 @@
 #define __SIM_MATHEXPR_POWERMODEL_PM_HH__
 
 #include <unordered_map>
+#include <vector>
 
 #include "params/MathExprPowerModel.hh"
 #include "sim/mathexpr.hh"
@@ -49,7 +50,9 @@ namespace gem5
 
 namespace statistics
 {
+    class FormulaInfo;
     class Info;
+    class ScalarInfo;
 }
 
 /**
@@ -68,14 +71,14 @@ class MathExprPowerModel : public PowerModelState
      *
      * @return Power (Watts) consumed by this object (dynamic component)
      */
-    double getDynamicPower() const override { return eval(dyn_expr); }
+    double getDynamicPower() const override { return eval(dyn_prog); }
 
     /**
      * Get the static power consumption.
      *
      * @return Power (Watts) consumed by this object (static component)
      */
-    double getStaticPower() const override { return eval(st_expr); }
+    double getStaticPower() const override { return eval(st_prog); }
 
     /**
      * Get the value for a variable (maps to a stat)
@@ -90,20 +93,47 @@ class MathExprPowerModel : public PowerModelState
     void regStats() override;
 
   private:
+    /** A variable of the expressions, resolved at startup */
+    struct Variable
+    {
+        enum Kind
+        {
+            Temp, Voltage, ClockPeriod, Scalar, Formula
+        };
+
+        Kind kind;
+        const statistics::ScalarInfo *scalar;
+        const statistics::FormulaInfo *formula;
+    };
+
     /**
-     * Evaluate an expression in the context of this object, fatal if
-     * evaluation fails.
+     * Evaluate a compiled expression in the context of this object.
      *
-     * @param expr Expression to evaluate
+     * @param prog Program to evaluate
      * @return Value of expression.
      */
-    double eval(const MathExpr &expr) const;
+    double eval(const MathExpr::Program &prog) const;
+
+    /** Get the value of a resolved variable */
+    double getValue(const Variable &var) const;
+
+    /** Resolve a variable to its index in variables, adding it if new */
+    unsigned resolve(const MathExpr &expr, const std::string &name);
 
     // Math expressions for dynamic and static power
     MathExpr dyn_expr, st_expr;
 
+    // Expressions compiled at startup, with variables resolved
+    MathExpr::Program dyn_prog, st_prog;
+
+    // Variables of the compiled expressions
+    std::vector<Variable> variables;
+
     // Map that contains relevant stats for this power model
     std::unordered_map<std::string, const statistics::Info*> statsMap;
+
+    // Index of each variable in variables
+    std::unordered_map<std::string, unsigned> variableIndex;
 };
 
 } // namespace gem5
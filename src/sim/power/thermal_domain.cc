@@ -83,14 +83,14 @@ ThermalDomain::emitUpdate()
 }
 
 
-LinearEquation
-ThermalDomain::getEquation(ThermalNode * tn, unsigned n, double step) const
+void
+ThermalDomain::addEquations(SparseLinearSystem &ls, double step) const
 {
-    LinearEquation eq(n);
+    if (node->isref)
+        return;
+
     double power = subsystem->getDynamicPower() + subsystem->getStaticPower();
-    if (tn == node)
-        eq[eq.cnt()] = power;
-    return eq;
+    ls.addConstant(node->id, power);
 }
 
 } // namespace gem5
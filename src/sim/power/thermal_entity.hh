@@ -43,7 +43,7 @@
 namespace gem5
 {
 
-class LinearEquation;
+class SparseLinearSystem;
 class ThermalNode;
 
 /**
@@ -54,9 +54,11 @@ class ThermalNode;
 class ThermalEntity
 {
   public:
-    // Get the equation given a node and a step in seconds (assuming N nodes)
-    virtual LinearEquation getEquation(ThermalNode *tn, unsigned n,
-                                       double step) const = 0;
+    // Add the entity's terms to the nodal equations of the nodes it
+    // connects, given a step in seconds. Equation i is the one of the
+    // node with id i, reference nodes do not have an equation.
+    virtual void addEquations(SparseLinearSystem &ls,
+                              double step) const = 0;
 };
 
 } // namespace gem5
@@ -37,6 +37,7 @@
 
 #include "sim/power/thermal_model.hh"
 
+#include "base/logging.hh"
 #include "base/statistics.hh"
 #include "params/ThermalCapacitor.hh"
 #include "params/ThermalModel.hh"
@@ -58,11 +59,10 @@ ThermalReference::ThermalReference(const Params &p)
 {
 }
 
-LinearEquation
-ThermalReference::getEquation(ThermalNode * n, unsigned nnodes,
-                              double step) const {
-    // Just return an empty equation
-    return LinearEquation(nnodes);
+void
+ThermalReference::addEquations(SparseLinearSystem &ls, double step) const
+{
+    // The temperature of the node is fixed, so it has no equation
 }
 
 /**
@@ -73,31 +73,28 @@ ThermalResistor::ThermalResistor(const Params &p)
 {
 }
 
-LinearEquation
-ThermalResistor::getEquation(ThermalNode * n, unsigned nnodes,
-                             double step) const
+void
+ThermalResistor::addEquations(SparseLinearSystem &ls, double step) const
 {
-    // i[n] = (Vn2 - Vn1)/R
-    LinearEquation eq(nnodes);
-
-    if (n != node1 && n != node2)
-        return eq;
-
-    if (node1->isref)
-        eq[eq.cnt()] += -node1->temp.toKelvin() / _resistance;
-    else
-        eq[node1->id] += -1.0f / _resistance;
-
-    if (node2->isref)
-        eq[eq.cnt()] += node2->temp.toKelvin() / _resistance;
-    else
-        eq[node2->id] += 1.0f / _resistance;
-
-    // We've assumed n was node1, reverse if necessary
-    if (n == node2)
-        eq *= -1.0f;
-
-    return eq;
+    // i[n1] = (Vn2 - Vn1)/R, i[n2] = -i[n1]
+    for (auto n : {node1, node2}) {
+        if (n->isref)
+            continue;
+
+        const double sign = n == node1 ? 1.0 : -1.0;
+
+        if (node1->isref)
+            ls.addConstant(n->id, sign * -node1->temp.toKelvin() /
+                           _resistance);
+        else
+            ls.add(n->id, node1->id, sign * -1.0f / _resistance);
+
+        if (node2->isref)
+            ls.addConstant(n->id, sign * node2->temp.toKelvin() /
+                           _resistance);
+        else
+            ls.add(n->id, node2->id, sign * 1.0f / _resistance);
+    }
 }
 
 /**
@@ -108,42 +105,40 @@ ThermalCapacitor::ThermalCapacitor(const Params &p)
 {
 }
 
-LinearEquation
-ThermalCapacitor::getEquation(ThermalNode * n, unsigned nnodes,
-                              double step) const
+void
+ThermalCapacitor::addEquations(SparseLinearSystem &ls, double step) const
 {
     // i(t) = C * d(Vn2 - Vn1)/dt
-    // i[n] = C/step * (Vn2 - Vn1 - Vn2[n-1] + Vn1[n-1])
-    LinearEquation eq(nnodes);
-
-    if (n != node1 && n != node2)
-        return eq;
-
-    eq[eq.cnt()] += _capacitance / step *
-        (node1->temp - node2->temp).toKelvin();
-
-    if (node1->isref)
-        eq[eq.cnt()] += _capacitance / step * (-node1->temp.toKelvin());
-    else
-        eq[node1->id] += -1.0f * _capacitance / step;
-
-    if (node2->isref)
-        eq[eq.cnt()] += _capacitance / step * (node2->temp.toKelvin());
-    else
-        eq[node2->id] += 1.0f * _capacitance / step;
-
-    // We've assumed n was node1, reverse if necessary
-    if (n == node2)
-        eq *= -1.0f;
-
-    return eq;
+    // i[n1] = C/step * (Vn2 - Vn1 - Vn2[n-1] + Vn1[n-1]), i[n2] = -i[n1]
+    for (auto n : {node1, node2}) {
+        if (n->isref)
+            continue;
+
+        const double sign = n == node1 ? 1.0 : -1.0;
+
+        ls.addConstant(n->id, sign * _capacitance / step *
+                       (node1->temp - node2->temp).toKelvin());
+
+        if (node1->isref)
+            ls.addConstant(n->id, sign * _capacitance / step *
+                           (-node1->temp.toKelvin()));
+        else
+            ls.add(n->id, node1->id, sign * -1.0f * _capacitance / step);
+
+        if (node2->isref)
+            ls.addConstant(n->id, sign * _capacitance / step *
+                           (node2->temp.toKelvin()));
+        else
+            ls.add(n->id, node2->id, sign * 1.0f * _capacitance / step);
+    }
 }
 
 /**
  * ThermalModel
  */
 ThermalModel::ThermalModel(const Params &p)
-    : ClockedObject(p), stepEvent([this]{ doStep(); }, name()), _step(p.step)
+    : ClockedObject(p), stepEvent([this]{ doStep(); }, name()), _step(p.step),
+      system(0), conductancesChanged(false)
 {
 }
 
@@ -151,20 +146,36 @@ void
 ThermalModel::doStep()
 {
     // Calculate new temperatures!
-    // For each node in the system, create the kirchhoff nodal equation
-    LinearSystem ls(eq_nodes.size());
-    for (unsigned i = 0; i < eq_nodes.size(); i++) {
-        auto n = eq_nodes[i];
-        LinearEquation node_equation (eq_nodes.size());
-        for (auto e : entities) {
-            LinearEquation eq = e->getEquation(n, eq_nodes.size(), _step);
-            node_equation = node_equation + eq;
+    // Each entity adds its terms to the kirchhoff nodal equations of
+    // the nodes it connects
+    system.clear();
+    for (auto e : entities)
+        e->addEquations(system, _step);
+
+    // Get temperatures for this iteration. The factorisation can be
+    // reused for as long as the conductances stay the same. If they
+    // keep changing, iterate from the current temperatures instead.
+    std::vector <double> temps;
+    if (factorisation.factors(system)) {
+        conductancesChanged = false;
+        temps = factorisation.solve(system);
+    } else {
+        bool solved = false;
+        if (conductancesChanged) {
+            for (auto n : eq_nodes)
+                temps.push_back(n->temp.toKelvin());
+            solved = system.solveCG(temps, 1e-9, eq_nodes.size());
+        }
+
+        if (!solved) {
+            fatal_if(!factorisation.factorise(system),
+                     "%s: Singular thermal network, check that every node "
+                     "is connected to a reference.\n", name());
+            temps = factorisation.solve(system);
         }
-        ls[i] = node_equation;
+        conductancesChanged = true;
     }
 
-    // Get temperatures for this iteration
-    std::vector <double> temps = ls.solve();
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->temp = Temperature::fromKelvin(temps[i]);
 
@@ -204,6 +215,7 @@ ThermalModel::startup()
     // Assign each node an ID
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->id = i;
+    system = SparseLinearSystem(eq_nodes.size());
 
     // Schedule first thermal update
     schedule(stepEvent, curTick() + sim_clock::as_int::s * _step);
@@ -41,6 +41,7 @@
 #include <vector>
 
 #include "base/temperature.hh"
+#include "sim/linear_solver.hh"
 #include "sim/clocked_object.hh"
 #include "sim/power/thermal_domain.hh"
 #include "sim/power/thermal_entity.hh"
@@ -71,8 +72,8 @@ class ThermalResistor : public SimObject, public ThermalEntity
         node2 = n2;
     }
 
-    LinearEquation getEquation(ThermalNode * tn, unsigned n,
-                               double step) const override;
+    void addEquations(SparseLinearSystem &ls,
+                      double step) const override;
 
   private:
     /* Resistance value in K/W */
@@ -92,8 +93,8 @@ class ThermalCapacitor : public SimObject, public ThermalEntity
     typedef ThermalCapacitorParams Params;
     ThermalCapacitor(const Params &p);
 
-    LinearEquation getEquation(ThermalNode * tn, unsigned n,
-                               double step) const override;
+    void addEquations(SparseLinearSystem &ls,
+                      double step) const override;
 
     void setNodes(ThermalNode * n1, ThermalNode * n2) {
         node1 = n1;
@@ -123,8 +124,8 @@ class ThermalReference : public SimObject, public ThermalEntity
         node = n;
     }
 
-    LinearEquation getEquation(ThermalNode * tn, unsigned n,
-                               double step) const override;
+    void addEquations(SparseLinearSystem &ls,
+                      double step) const override;
 
     /* Fixed temperature value */
     const Temperature _temperature;
@@ -178,6 +179,13 @@ class ThermalModel : public ClockedObject
 
     /** Step in seconds for thermal updates */
     const double _step;
+
+    /** Nodal equations of eq_nodes, rebuilt every step */
+    SparseLinearSystem system;
+    /** Factorisation for as long as the conductances don't change */
+    SparseLU factorisation;
+    /** Whether the conductances changed at the previous step */
+    bool conductancesChanged;
 };
 
 } // namespace gem5
@@ -131,6 +131,9 @@ Process::Process(const ProcessParams &params, EmulationPageTable *pTable,
       fds(std::make_shared<FDArray>(
                   params.input, params.output, params.errout)),
       childClearTID(0),
+      asyncIO(params.async_io ? new AsyncFileIO : nullptr),
+      asyncIOMinSize(params.async_io_min_size),
+      ioLatency(params.io_latency), ioTicksPerByte(params.io_bandwidth),
       ADD_STAT(numSyscalls, statistics::units::Count::get(),
                "Number of system calls")
 {
@@ -364,6 +367,7 @@ Process::replicatePage(Addr vaddr, Addr new_paddr, ThreadContext *old_tc,
 bool
 Process::fixupFault(Addr vaddr)
 {
+    auto lock = seWorkload->lockEmulation();
     return memState->fixupFault(vaddr);
 }
 
@@ -35,12 +35,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/loader/memory_image.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/se_translating_port_proxy.hh"
+#include "sim/async_file_io.hh"
 #include "sim/fd_array.hh"
 #include "sim/fd_entry.hh"
 #include "sim/mem_state.hh"
@@ -300,6 +302,25 @@ class Process : public SimObject
     // Contexts to wake up when this thread exits or calls execve
     std::vector<ContextID> vforkContexts;
 
+    /**
+     * Background host I/O for the large file reads and writes, if the
+     * process does asynchronous I/O.
+     */
+    std::unique_ptr<AsyncFileIO> asyncIO;
+    uint64_t asyncIOMinSize;
+    /** The simulated latency and bandwidth of the background I/O. */
+    Tick ioLatency;
+    double ioTicksPerByte;
+
+    /** A background I/O operation of a thread's system call. */
+    struct PendingIO
+    {
+        AsyncFileIO::OpPtr op;
+        /** When the operation is done in simulated time. */
+        Tick ready;
+    };
+    std::unordered_map<ContextID, PendingIO> pendingIO;
+
     // Track how many system calls are executed
     statistics::Scalar numSyscalls;
 };
@@ -39,15 +39,20 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sstream>
+
 #include "base/hostinfo.hh"
 #include "base/logging.hh"
+#include "base/output.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 #include "sim/eventq.hh"
 #include "sim/full_system.hh"
+#include "sim/host_mem.hh"
 #include "sim/root.hh"
+#include "sim/simulate.hh"
 
 namespace gem5
 {
@@ -187,6 +192,22 @@ Root::Root(const RootParams &p, int)
     lastTime.setTimer();
 
     simQuantum = p.sim_quantum;
+    conservativeSync = p.conservative_sync;
+    elasticQuantum = p.elastic_quantum;
+    eventQueueThreads = p.eventq_threads;
+    setMainEventQueueCalendar(p.eventq_calendar_buckets,
+                              p.eventq_calendar_width);
+
+    if (p.event_profile) {
+        setMainEventQueueProfiling(true);
+        registerExitCallback([]() {
+            OutputStream *folded = simout.create("event_profile.folded");
+            OutputStream *report = simout.create("event_profile.txt");
+            dumpEventProfile(*folded->stream(), *report->stream());
+            simout.close(folded);
+            simout.close(report);
+        });
+    }
 
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
@@ -199,6 +220,12 @@ void
 Root::startup()
 {
     timeSyncEnable(params().time_sync_enable);
+
+    if (host_mem::accounted() > 0) {
+        std::ostringstream summary;
+        host_mem::summarize(summary, 10);
+        inform("%s", summary.str());
+    }
 }
 
 void
@@ -27,8 +27,10 @@
 
 #include "sim/se_workload.hh"
 
+#include "cpu/base.hh"
 #include "cpu/thread_context.hh"
 #include "params/SEWorkload.hh"
+#include "sim/eventq.hh"
 #include "sim/process.hh"
 #include "sim/system.hh"
 
@@ -71,6 +73,21 @@ SEWorkload::syscall(ThreadContext *tc)
     tc->getProcessPtr()->syscall(tc);
 }
 
+bool
+SEWorkload::updateThread(ThreadContext *tc,
+                         const std::function<void()> &update)
+{
+    EventQueue *eq = tc->getCpuPtr()->eventQueue();
+    if (!inParallelMode || eq == curEventQueue()) {
+        update();
+        return true;
+    }
+
+    eq->schedule(new EventFunctionWrapper(update,
+                "SEWorkload.updateThread", true), curTick() + simQuantum);
+    return false;
+}
+
 Addr
 SEWorkload::allocPhysPages(int npages, int pool_id)
 {
@@ -28,6 +28,9 @@
 #ifndef __SIM_SE_WORKLOAD_HH__
 #define __SIM_SE_WORKLOAD_HH__
 
+#include <functional>
+#include <mutex>
+
 #include "params/SEWorkload.hh"
 #include "sim/mem_pool.hh"
 #include "sim/workload.hh"
@@ -41,6 +44,14 @@ class SEWorkload : public Workload
     /** Memory allocation objects for all physical memories in the system. */
     MemPools memPools;
 
+    /**
+     * Serializes the emulation of system calls and page faults, which
+     * CPUs on different event queues may start at the same time. The
+     * mutex is recursive since emulating a system call may fault in
+     * pages.
+     */
+    std::recursive_mutex emulationMutex;
+
   public:
     using Params = SEWorkloadParams;
 
@@ -89,6 +100,23 @@ class SEWorkload : public Workload
     // For now, assume the only type of events are system calls.
     void event(ThreadContext *tc) override { syscall(tc); }
 
+    /** Hold off other emulation until the returned lock is released. */
+    std::unique_lock<std::recursive_mutex>
+    lockEmulation()
+    {
+        return std::unique_lock<std::recursive_mutex>(emulationMutex);
+    }
+
+    /**
+     * Change the state of a thread context, e.g. activate or halt it.
+     * If the simulation runs on several event queues and the CPU of the
+     * thread is on another one, the change is made from that queue at
+     * the start of the next quantum.
+     * @return Whether the change was made right away.
+     */
+    static bool updateThread(ThreadContext *tc,
+                             const std::function<void()> &update);
+
     Addr allocPhysPages(int npages, int pool_id=0);
     Addr memSize(int pool_id=0) const;
     Addr freeMemSize(int pool_id=0) const;
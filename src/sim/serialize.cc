@@ -42,12 +42,16 @@
 
 #include "sim/serialize.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include <cassert>
 #include <cerrno>
+#include <cstdlib>
 
 #include "base/trace.hh"
 #include "debug/Checkpoint.hh"
@@ -98,6 +102,105 @@ Serializable::generateCheckpointOut(const std::string &cpt_dir,
     if (!outstream)
         fatal("Unable to open file %s for writing\n", cpt_file.c_str());
     outstream << "## checkpoint generated: " << ctime(&t);
+
+    CheckpointBinary::open(dir, outstream);
+}
+
+namespace
+{
+
+/** The header of a binary checkpoint file */
+struct BinaryHeader
+{
+    char magic[8];
+    uint32_t version;
+    /** 0x01020304 in the byte order of the host that wrote the file */
+    uint32_t byteOrder;
+};
+
+constexpr char BinaryMagic[8] = "gem5bin";
+constexpr uint32_t BinaryVersion = 1;
+constexpr uint32_t BinaryByteOrder = 0x01020304;
+constexpr char BinaryPrefix[] = "!bin:";
+
+} // anonymous namespace
+
+const char *CheckpointBinary::filename = "m5.cpt.bin";
+size_t CheckpointBinary::minElements = 256;
+const CheckpointOut *CheckpointBinary::cpt = nullptr;
+std::string CheckpointBinary::dir;
+std::ofstream CheckpointBinary::file;
+uint64_t CheckpointBinary::offset = 0;
+
+void
+CheckpointBinary::open(const std::string &cpt_dir, CheckpointOut &cp)
+{
+    close();
+    cpt = &cp;
+    dir = cpt_dir;
+}
+
+void
+CheckpointBinary::close()
+{
+    if (file.is_open()) {
+        file.close();
+        fatal_if(!file, "Failed to write %s%s.\n", dir, filename);
+    }
+    cpt = nullptr;
+    offset = 0;
+}
+
+std::string
+CheckpointBinary::write(const void *data, char kind, unsigned bytes,
+                        size_t count)
+{
+    if (!file.is_open()) {
+        std::string path = dir + filename;
+        file.open(path, std::ios::binary | std::ios::trunc);
+        fatal_if(!file, "Unable to open file %s for writing\n", path);
+
+        BinaryHeader header = {};
+        std::memcpy(header.magic, BinaryMagic, sizeof(BinaryMagic));
+        header.version = BinaryVersion;
+        header.byteOrder = BinaryByteOrder;
+        file.write((const char *)&header, sizeof(header));
+        offset = sizeof(header);
+    }
+
+    // Keep the arrays aligned to their elements
+    static const char padding[8] = {};
+    uint64_t pad = (8 - offset % 8) % 8;
+    file.write(padding, pad);
+    offset += pad;
+
+    std::string ref = csprintf("%s%c%d:%d:%d", BinaryPrefix, kind,
+                               bytes * 8, offset, count);
+    file.write((const char *)data, bytes * count);
+    offset += bytes * count;
+    return ref;
+}
+
+bool
+CheckpointBinary::parse(const std::string &entry, Ref &ref)
+{
+    const size_t prefix_len = sizeof(BinaryPrefix) - 1;
+    if (entry.compare(0, prefix_len, BinaryPrefix) != 0)
+        return false;
+
+    const char *str = entry.c_str() + prefix_len;
+    char *end;
+    ref.kind = *str++;
+    unsigned bits = strtoul(str, &end, 10);
+    ref.bytes = bits / 8;
+    bool ok = (ref.kind == 'u' || ref.kind == 'i' || ref.kind == 'f') &&
+        *end == ':';
+    ref.offset = strtoull(end + 1, &end, 10);
+    ok = ok && *end == ':';
+    ref.count = strtoull(end + 1, &end, 10);
+    fatal_if(!ok || *end != '\0' || bits % 8 != 0 || bits == 0,
+             "Malformed binary array entry \"%s\".", entry);
+    return true;
 }
 
 Serializable::ScopedCheckpointSection::~ScopedCheckpointSection()
@@ -165,6 +268,47 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
     }
 }
 
+CheckpointIn::~CheckpointIn()
+{
+    if (binData)
+        munmap(binData, binLen);
+}
+
+const uint8_t *
+CheckpointIn::binaryArray(const CheckpointBinary::Ref &ref)
+{
+    std::string path = getCptDir() + "/" + CheckpointBinary::filename;
+    if (!binData) {
+        int fd = open(path.c_str(), O_RDONLY);
+        fatal_if(fd < 0, "Can't open binary checkpoint file '%s'\n", path);
+        struct stat st;
+        fatal_if(fstat(fd, &st) != 0 ||
+                 st.st_size < (off_t)sizeof(BinaryHeader),
+                 "Binary checkpoint file '%s' is truncated\n", path);
+        binLen = st.st_size;
+        void *map = mmap(NULL, binLen, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        fatal_if(map == MAP_FAILED, "Can't map binary checkpoint file "
+                 "'%s'\n", path);
+        binData = (uint8_t *)map;
+
+        BinaryHeader header;
+        std::memcpy(&header, binData, sizeof(header));
+        fatal_if(std::memcmp(header.magic, BinaryMagic,
+                             sizeof(BinaryMagic)) != 0 ||
+                 header.version != BinaryVersion,
+                 "'%s' is not a binary checkpoint file\n", path);
+        fatal_if(header.byteOrder != BinaryByteOrder,
+                 "Binary checkpoint file '%s' was written by a host with "
+                 "another byte order\n", path);
+    }
+
+    fatal_if(ref.offset > binLen || ref.count > (binLen - ref.offset) /
+             ref.bytes, "Binary array at %d is beyond the end of '%s'\n",
+             ref.offset, path);
+    return binData + ref.offset;
+}
+
 /**
  * @param section Here we mention the section we are looking for
  * (example: currentsection).
@@ -47,6 +47,8 @@
 
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -65,6 +67,109 @@ namespace gem5
 
 typedef std::ostream CheckpointOut;
 
+/**
+ * Large arrays of numbers are stored in a binary file next to the
+ * checkpoint rather than as text. The entry of such an array in the
+ * checkpoint names the type of its elements and refers to where they
+ * are in the binary file, e.g. "!bin:u64:4096:512".
+ */
+class CheckpointBinary
+{
+  public:
+    /** Name of the binary file within the checkpoint directory */
+    static const char *filename;
+
+    /** Arrays with fewer elements are stored as text */
+    static size_t minElements;
+
+    /** Whether the elements of an array can be stored in binary */
+    template <class T>
+    static constexpr bool storable =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+        std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    /** An array in the binary file */
+    struct Ref
+    {
+        /** 'u', 'i' or 'f' for unsigned, signed and floating point */
+        char kind;
+        unsigned bytes;
+        uint64_t offset;
+        uint64_t count;
+    };
+
+    /**
+     * Store the large arrays of a checkpoint being created in a dir in
+     * the binary file of the dir, which is created on the first array.
+     */
+    static void open(const std::string &dir, CheckpointOut &cp);
+
+    /** Finish the binary file of the checkpoint being created */
+    static void close();
+
+    /** Whether an array written to a stream goes to the binary file */
+    static bool
+    accepts(const CheckpointOut &os, size_t count)
+    {
+        return &os == cpt && count >= minElements && count > 0;
+    }
+
+    /**
+     * Append the elements of an array to the binary file.
+     *
+     * @return The checkpoint entry that refers to them
+     */
+    template <class T>
+    static std::string
+    write(const std::vector<T> &values)
+    {
+        static_assert(storable<T>);
+        char kind = std::is_floating_point_v<T> ? 'f' :
+            std::is_signed_v<T> ? 'i' : 'u';
+        return write(values.data(), kind, sizeof(T), values.size());
+    }
+
+    /** Parse an entry, returning whether it refers to the binary file */
+    static bool parse(const std::string &entry, Ref &ref);
+
+    /** Convert the elements of an array that starts at data */
+    template <class T, class InsertIterator>
+    static void
+    read(const Ref &ref, const uint8_t *data, InsertIterator &inserter)
+    {
+        auto convert = [&](auto elem) {
+            for (uint64_t i = 0; i < ref.count; ++i) {
+                std::memcpy(&elem, data + i * sizeof(elem), sizeof(elem));
+                *inserter = static_cast<T>(elem);
+            }
+        };
+        switch (ref.kind * 16 + ref.bytes) {
+          case 'u' * 16 + 1: convert(uint8_t()); break;
+          case 'u' * 16 + 2: convert(uint16_t()); break;
+          case 'u' * 16 + 4: convert(uint32_t()); break;
+          case 'u' * 16 + 8: convert(uint64_t()); break;
+          case 'i' * 16 + 1: convert(int8_t()); break;
+          case 'i' * 16 + 2: convert(int16_t()); break;
+          case 'i' * 16 + 4: convert(int32_t()); break;
+          case 'i' * 16 + 8: convert(int64_t()); break;
+          case 'f' * 16 + 4: convert(float()); break;
+          case 'f' * 16 + 8: convert(double()); break;
+          default: panic("Unexpected binary array type.");
+        }
+    }
+
+  private:
+    static std::string write(const void *data, char kind, unsigned bytes,
+                             size_t count);
+
+    /** The checkpoint being created, and the dir it is created in */
+    static const CheckpointOut *cpt;
+    static std::string dir;
+
+    static std::ofstream file;
+    static uint64_t offset;
+};
+
 class CheckpointIn
 {
   private:
@@ -72,9 +177,24 @@ class CheckpointIn
 
     const std::string _cptDir;
 
+    /** The binary file of the checkpoint, mapped in on first use */
+    uint8_t *binData = nullptr;
+    size_t binLen = 0;
+
   public:
     CheckpointIn(const std::string &cpt_dir);
-    ~CheckpointIn() = default;
+    ~CheckpointIn();
+
+    CheckpointIn(const CheckpointIn &) = delete;
+    CheckpointIn &operator=(const CheckpointIn &) = delete;
+
+    /**
+     * Get the elements of an array stored in the binary file.
+     *
+     * @param ref The array, as parsed from its entry
+     * @return Where its elements start
+     */
+    const uint8_t *binaryArray(const CheckpointBinary::Ref &ref);
 
     /**
      * @return Returns the current directory being used for creating
@@ -391,6 +511,13 @@ arrayParamOut(CheckpointOut &os, const std::string &name,
     os << name << "=";
     auto it = start;
     using Elem = std::remove_cv_t<std::remove_reference_t<decltype(*it)>>;
+    if constexpr (CheckpointBinary::storable<Elem>) {
+        if (CheckpointBinary::accepts(os, std::distance(start, end))) {
+            os << CheckpointBinary::write(std::vector<Elem>(start, end))
+               << "\n";
+            return;
+        }
+    }
     if (it != end)
         ShowParam<Elem>::show(os, *it++);
     while (it != end) {
@@ -446,6 +573,17 @@ arrayParamIn(CheckpointIn &cp, const std::string &name,
     fatal_if(!cp.find(section, name, str),
         "Can't unserialize '%s:%s'.", section, name);
 
+    if constexpr (CheckpointBinary::storable<T>) {
+        CheckpointBinary::Ref ref;
+        if (CheckpointBinary::parse(str, ref)) {
+            fatal_if(fixed_size >= 0 && ref.count != fixed_size,
+                     "Array size mismatch on %s:%s (Got %u, expected %u)'\n",
+                     section, name, ref.count, fixed_size);
+            CheckpointBinary::read<T>(ref, cp.binaryArray(ref), inserter);
+            return;
+        }
+    }
+
     std::vector<std::string> tokens;
     tokenize(tokens, str, ' ');
 
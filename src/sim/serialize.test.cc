@@ -897,6 +897,66 @@ TEST_F(SerializeFixture, ArrayParamOutIn)
     }
 }
 
+/**
+ * Test that large arrays of numbers are stored in the binary file of the
+ * checkpoint, and that they can be read back into other element types.
+ */
+TEST_F(SerializeFixture, BinaryArrayParamOutIn)
+{
+    const size_t size = CheckpointBinary::minElements;
+    std::vector<uint64_t> uint64(size);
+    std::vector<int16_t> int16(size);
+    std::vector<double> real(size);
+    for (size_t i = 0; i < size; i++) {
+        uint64[i] = 0x100000000ULL * i + 7;
+        int16[i] = -(int16_t)i;
+        real[i] = i / 3.0;
+    }
+    const int small[] = {5, 10, 15};
+
+    // Serialization
+    {
+        std::ofstream cpt;
+        Serializable::generateCheckpointOut(getDirName(), cpt);
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        arrayParamOut(cpt, "Param1", uint64);
+        arrayParamOut(cpt, "Param2", int16);
+        arrayParamOut(cpt, "Param3", real);
+        arrayParamOut(cpt, "Param4", small);
+        CheckpointBinary::close();
+    }
+
+    // Unserialization
+    {
+        CheckpointIn cpt(getDirName());
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+
+        std::string entry;
+        ASSERT_TRUE(cpt.find("Section1", "Param1", entry));
+        ASSERT_EQ(entry.rfind("!bin:u64:", 0), 0);
+        ASSERT_TRUE(cpt.find("Section1", "Param4", entry));
+        ASSERT_EQ(entry, "5 10 15");
+
+        std::vector<uint64_t> unserialized_uint64;
+        arrayParamIn(cpt, "Param1", unserialized_uint64);
+        ASSERT_EQ(uint64, unserialized_uint64);
+
+        std::vector<int64_t> unserialized_int64;
+        arrayParamIn(cpt, "Param2", unserialized_int64);
+        ASSERT_THAT(unserialized_int64, testing::ElementsAreArray(int16));
+
+        std::vector<double> unserialized_real(size);
+        arrayParamIn(cpt, "Param3", unserialized_real.data(), size);
+        ASSERT_EQ(real, unserialized_real);
+
+        int unserialized_small[3];
+        arrayParamIn(cpt, "Param4", unserialized_small, 3);
+        ASSERT_THAT(unserialized_small, testing::ElementsAre(5, 10, 15));
+    }
+
+    std::remove((getDirName() + "/" + CheckpointBinary::filename).c_str());
+}
+
 /**
  * Test arrayParamOut and arrayParamIn for strings with spaces.
  * @todo This is broken because spaces are delimiters between array
@@ -55,6 +55,24 @@ void exitSimLoop(const std::string &message, int exit_code = 0,
 void exitSimLoopNow(const std::string &message, int exit_code = 0,
                     Tick repeat = 0, bool serialize = false);
 
+/// A handler of the exits with a given cause, called by simulate() in
+/// place of returning to Python. It returns whether to keep simulating.
+using ExitHandler = std::function<bool(const std::string &cause, int code)>;
+
+/// Handle the exits with a cause in C++. An empty handler removes the
+/// handler of the cause. The exit at the simulate() limit always returns.
+void registerExitHandler(const std::string &cause,
+                         const ExitHandler &handler);
+
+/// Handle up to limit (0 for no limit) exits with a cause in C++, and
+/// keep simulating after them. The action is "continue", "dump_stats",
+/// "reset_stats" or "dump_reset_stats". Defined in sim/simulate.cc.
+void registerExitAction(const std::string &cause,
+                        const std::string &action, uint64_t limit = 0);
+
+/// The number of exits with a cause handled by an exit action.
+uint64_t exitActionCount(const std::string &cause);
+
 } // namespace gem5
 
 #endif // __SIM_EXIT_HH__
@@ -143,6 +143,37 @@ SimObject::serializeAll(const std::string &cpt_dir)
         // since we are at the top level.
         obj->serializeSection(cp, obj->name());
    }
+
+    CheckpointBinary::close();
+}
+
+void
+SimObject::saveWarmStateAll(const std::string &dir)
+{
+    std::ofstream cp;
+    Serializable::generateCheckpointOut(dir, cp);
+
+    for (auto ri = simObjectList.rbegin(); ri != simObjectList.rend(); ++ri) {
+        SimObject *obj = *ri;
+        Serializable::ScopedCheckpointSection sec(cp, obj->name());
+        obj->saveWarmState(cp);
+    }
+
+    CheckpointBinary::close();
+}
+
+void
+SimObject::loadWarmStateAll(const std::string &dir)
+{
+    CheckpointIn cp(dir);
+
+    for (auto ri = simObjectList.rbegin(); ri != simObjectList.rend(); ++ri) {
+        SimObject *obj = *ri;
+        if (!cp.sectionExists(obj->name()))
+            continue;
+        Serializable::ScopedCheckpointSection sec(cp, obj->name());
+        obj->loadWarmState(cp);
+    }
 }
 
 SimObject *
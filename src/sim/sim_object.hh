@@ -315,6 +315,25 @@ class SimObject : public EventManager, public Serializable, public Drainable,
     void serialize(CheckpointOut &cp) const override {};
     void unserialize(CheckpointIn &cp) override {};
 
+    /**
+     * Write out the warm microarchitectural state of the object, such as
+     * cache contents or predictor tables, which isn't part of a checkpoint.
+     *
+     * A warm state snapshot may be loaded into a different, but compatible,
+     * configuration, so the state should be written in a form that doesn't
+     * depend on the object's geometry where possible.
+     */
+    virtual void saveWarmState(CheckpointOut &cp) const {};
+
+    /**
+     * Load the warm microarchitectural state written by saveWarmState().
+     * This is called once the simulation has been instantiated and drained,
+     * and must leave the object in a state consistent with the rest of the
+     * system. State which does not fit the object's configuration should be
+     * skipped.
+     */
+    virtual void loadWarmState(CheckpointIn &cp) {};
+
     /**
      * Create a checkpoint by serializing all SimObjects in the system.
      *
@@ -329,6 +348,23 @@ class SimObject : public EventManager, public Serializable, public Drainable,
      */
     static void serializeAll(const std::string &cpt_dir);
 
+    /**
+     * Save a warm state snapshot of all SimObjects. The snapshot is laid
+     * out like a checkpoint, with a section per SimObject, but is
+     * independent of one.
+     *
+     * @param dir The directory to write the snapshot to.
+     */
+    static void saveWarmStateAll(const std::string &dir);
+
+    /**
+     * Load a warm state snapshot into the SimObjects which have a section
+     * in it.
+     *
+     * @param dir The directory the snapshot was written to.
+     */
+    static void loadWarmStateAll(const std::string &dir);
+
     /**
      * Find the SimObject with the given name and return a pointer to
      * it.  Primarily used for interactive debugging.  Argument is
@@ -42,14 +42,23 @@
 
 #include "sim/simulate.hh"
 
+#include <algorithm>
 #include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/pollevent.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "sim/async.hh"
 #include "sim/eventq.hh"
+#include "sim/global_event.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
 #include "sim/stat_control.hh"
@@ -59,9 +68,124 @@ namespace gem5
 
 //! forward declaration
 Event *doSimLoop(EventQueue *);
+static bool serviceAsyncEvents(EventQueue *eventq);
 
 GlobalSimLoopExitEvent *simulate_limit_event = nullptr;
 
+bool conservativeSync = false;
+bool elasticQuantum = false;
+unsigned eventQueueThreads = 0;
+
+/** Minimum link latency between pairs of (source, destination) queues. */
+static std::map<std::pair<uint32_t, uint32_t>, Tick> linkLookahead;
+
+void
+registerLookahead(uint32_t src, uint32_t dst, Tick latency)
+{
+    if (src == dst)
+        return;
+
+    getEventQueue(dst)->addAsyncChannel(getEventQueue(src));
+
+    if (latency == 0)
+        return;
+
+    auto it = linkLookahead.find({src, dst});
+    if (it == linkLookahead.end())
+        linkLookahead.emplace(std::make_pair(src, dst), latency);
+    else
+        it->second = std::min(it->second, latency);
+}
+
+/**
+ * Conservative synchronisation of the main event queues.
+ *
+ * Every queue publishes a lower bound on the time of any event it may
+ * still service (its clock). An event serviced by queue j at time t
+ * can only schedule events on queue i at or after t + lookahead(j, i),
+ * so queue i can safely service all events strictly before its
+ * horizon, min over j of clock(j) + lookahead(j, i). Queues only wait
+ * for the neighbours that actually constrain them rather than meeting
+ * at a global barrier every quantum.
+ */
+class ConservativeSync
+{
+  public:
+    ConservativeSync(uint32_t num_queues)
+        : numQueues(num_queues), clocks(num_queues),
+          lookahead(num_queues * num_queues, simQuantum)
+    {
+        for (const auto &link : linkLookahead) {
+            const uint32_t src = link.first.first;
+            const uint32_t dst = link.first.second;
+            fatal_if(src >= numQueues || dst >= numQueues,
+                     "Lookahead registered for non-existent event queue.");
+            Tick &l = lookahead[src * numQueues + dst];
+            l = std::min(l, link.second);
+        }
+    }
+
+    /** Reset all clocks when (re-)entering the simulation loop. */
+    void
+    reset()
+    {
+        for (uint32_t i = 0; i < numQueues; i++)
+            publish(i, mainEventQueue[i]->getCurTick());
+    }
+
+    /** Publish a new lower bound on the time of queue index. */
+    void
+    publish(uint32_t index, Tick when)
+    {
+        clocks[index].tick.store(when, std::memory_order_release);
+    }
+
+    /**
+     * Compute the current safe horizon of a queue, pull in the events
+     * other queues have scheduled on it and publish its new clock.
+     *
+     * The horizon must be computed before the asynchronous insertions
+     * are handled: any event that has not been inserted yet is
+     * guaranteed to be scheduled at or after the horizon.
+     */
+    Tick
+    update(uint32_t index, EventQueue *eventq)
+    {
+        Tick horizon = MaxTick;
+        for (uint32_t src = 0; src < numQueues; src++) {
+            if (src == index)
+                continue;
+            const Tick clock =
+                clocks[src].tick.load(std::memory_order_acquire);
+            const Tick l = lookahead[src * numQueues + index];
+            horizon = std::min(horizon,
+                               clock > MaxTick - l ? MaxTick : clock + l);
+        }
+
+        {
+            std::lock_guard<EventQueue> lock(*eventq);
+            eventq->handleAsyncInsertions();
+        }
+
+        publish(index, std::min(eventq->nextTick(), horizon));
+        return horizon;
+    }
+
+  private:
+    /** Per-queue clock, padded to avoid false sharing between threads. */
+    struct alignas(64) Clock
+    {
+        std::atomic<Tick> tick{0};
+    };
+
+    const uint32_t numQueues;
+    std::vector<Clock> clocks;
+    /** Flattened lookahead(src, dst) matrix. */
+    std::vector<Tick> lookahead;
+};
+
+static std::unique_ptr<ConservativeSync> conservative;
+
 class SimulatorThreads
 {
   public:
@@ -166,6 +290,288 @@ class SimulatorThreads
 
 static std::unique_ptr<SimulatorThreads> simulatorThreads;
 
+/**
+ * A work-stealing pool of host threads running more main event queues
+ * than there are threads.
+ *
+ * The simulation proceeds in rounds. In every round, each queue is run
+ * by one of the threads until the next event at its head is the local
+ * event of a global event, e.g., the end of the quantum. Every thread
+ * has a deque of the queues it should run, which is refilled at the
+ * start of a round with the queues it ran in the previous one to keep
+ * their state in its caches. A thread without work left steals queues
+ * from the back of the other threads' deques. The thread finishing the
+ * last queue of a round services the global event on every queue on
+ * its own, without blocking on the barriers of the global event, and
+ * starts the next round.
+ */
+class SimulatorPool
+{
+  public:
+    SimulatorPool() = delete;
+    SimulatorPool(const SimulatorPool &) = delete;
+    SimulatorPool &operator=(SimulatorPool &) = delete;
+
+    SimulatorPool(uint32_t num_threads, uint32_t num_queues)
+        : numThreads(num_threads), numQueues(num_queues),
+          workers(num_threads), owner(num_queues), barrier(num_threads)
+    {
+        assert(num_threads > 0 && num_threads < num_queues);
+        for (uint32_t q = 0; q < numQueues; q++)
+            owner[q] = q % numThreads;
+        threads.reserve(num_threads);
+    }
+
+    ~SimulatorPool()
+    {
+        terminateThreads();
+    }
+
+    /**
+     * Run all queues from the main thread and the helper threads until
+     * a global exit event is serviced.
+     *
+     * @return The local event that caused the simulation loop to exit.
+     */
+    Event *
+    runUntilLocalExit()
+    {
+        assert(!terminate);
+
+        if (threads.empty()) {
+            for (uint32_t i = 1; i < numThreads; i++)
+                threads.emplace_back([this, i]() { threadMain(i); });
+        }
+
+        exitEvent = nullptr;
+        done.store(false, std::memory_order_relaxed);
+        startRound();
+
+        // Release the helper threads, work alongside them and wait for
+        // all of them to run out of work before returning.
+        barrier.wait();
+        work(0);
+        barrier.wait();
+
+        curEventQueue(mainEventQueue[0]);
+        return exitEvent;
+    }
+
+    void
+    terminateThreads()
+    {
+        assert(!terminate);
+        if (threads.empty())
+            return;
+
+        // The helper threads are waiting for the start of the next
+        // simulate() call, which they now see as a request to exit.
+        terminate = true;
+        barrier.wait();
+
+        for (auto &t : threads)
+            t.join();
+
+        terminate = false;
+        threads.clear();
+    }
+
+  protected:
+    /** The queues a thread should run, stolen from at the back. */
+    struct alignas(64) Worker
+    {
+        std::mutex lock;
+        std::deque<uint32_t> queues;
+    };
+
+    void
+    threadMain(uint32_t id)
+    {
+        while (true) {
+            barrier.wait();
+            if (terminate)
+                return;
+            work(id);
+            barrier.wait();
+        }
+    }
+
+    /** Run queues until the simulation loop exits. */
+    void
+    work(uint32_t id)
+    {
+        while (!done.load(std::memory_order_acquire)) {
+            uint32_t q;
+            if (!take(id, q)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            owner[q] = id;
+            if (!runQueue(q))
+                continue;
+
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+                !done.load(std::memory_order_acquire)) {
+                finishRound();
+            }
+        }
+    }
+
+    /** Take a queue from this thread's deque or steal one. */
+    bool
+    take(uint32_t id, uint32_t &q)
+    {
+        {
+            Worker &self = workers[id];
+            std::lock_guard<std::mutex> lock(self.lock);
+            if (!self.queues.empty()) {
+                q = self.queues.front();
+                self.queues.pop_front();
+                return true;
+            }
+        }
+
+        for (uint32_t i = 1; i < numThreads; i++) {
+            Worker &victim = workers[(id + i) % numThreads];
+            std::lock_guard<std::mutex> lock(victim.lock);
+            if (!victim.queues.empty()) {
+                q = victim.queues.back();
+                victim.queues.pop_back();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** Hand a queue to the thread that ran it last. */
+    void
+    give(uint32_t q)
+    {
+        Worker &worker = workers[owner[q]];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        worker.queues.push_back(q);
+    }
+
+    void
+    startRound()
+    {
+        for (auto &worker : workers) {
+            std::lock_guard<std::mutex> lock(worker.lock);
+            worker.queues.clear();
+        }
+
+        pending.store(numQueues, std::memory_order_relaxed);
+        for (uint32_t q = 0; q < numQueues; q++)
+            give(q);
+    }
+
+    /** Stop all threads, returning event from runUntilLocalExit(). */
+    void
+    stop(Event *event)
+    {
+        if (!done.exchange(true, std::memory_order_acq_rel))
+            exitEvent = event;
+    }
+
+    /**
+     * Run a queue until the next event is the local event of a global
+     * event.
+     *
+     * @return False if the simulation loop exited early.
+     */
+    bool
+    runQueue(uint32_t q)
+    {
+        EventQueue *eventq = mainEventQueue[q];
+        curEventQueue(eventq);
+        eventq->handleAsyncInsertions();
+
+        while (true) {
+            assert(!eventq->empty());
+
+            if (q == 0 && async_event && !serviceAsyncEvents(eventq)) {
+                stop(nullptr);
+                return false;
+            }
+
+            if (eventq->getHead()->globalEvent())
+                return true;
+
+            Event *exit_event = eventq->serviceOne();
+            if (exit_event) {
+                stop(exit_event);
+                return false;
+            }
+        }
+    }
+
+    /**
+     * Service the global event every queue has stopped at. Only called
+     * by the thread finishing the last queue of a round, so no other
+     * thread touches any queue.
+     */
+    void
+    finishRound()
+    {
+        // Events other queues scheduled while running may come before
+        // the global event, in which case the queue must run again.
+        BaseGlobalEvent *global = nullptr;
+        std::vector<uint32_t> runnable;
+        for (uint32_t q = 0; q < numQueues; q++) {
+            EventQueue *eventq = mainEventQueue[q];
+            curEventQueue(eventq);
+            eventq->handleAsyncInsertions();
+
+            BaseGlobalEvent *head = eventq->getHead()->globalEvent();
+            if (!head) {
+                runnable.push_back(q);
+            } else if (!global) {
+                global = head;
+            } else {
+                panic_if(head != global,
+                         "Event queues stopped at different global events.");
+            }
+        }
+
+        if (!runnable.empty()) {
+            pending.store(runnable.size(), std::memory_order_relaxed);
+            for (auto q : runnable)
+                give(q);
+            return;
+        }
+
+        BaseGlobalEvent::serialBarriers = true;
+        Event *exit_event = nullptr;
+        for (uint32_t q = numQueues; q-- > 0;) {
+            curEventQueue(mainEventQueue[q]);
+            exit_event = mainEventQueue[q]->serviceOne();
+        }
+        BaseGlobalEvent::serialBarriers = false;
+
+        if (exit_event)
+            stop(exit_event);
+        else
+            startRound();
+    }
+
+    std::atomic<bool> terminate{false};
+    const uint32_t numThreads;
+    const uint32_t numQueues;
+    std::vector<std::thread> threads;
+    std::vector<Worker> workers;
+    /** The thread that ran each queue last. */
+    std::vector<uint32_t> owner;
+    /** Number of queues left to run in the current round. */
+    std::atomic<uint32_t> pending{0};
+    std::atomic<bool> done{false};
+    Event *exitEvent = nullptr;
+    Barrier barrier;
+};
+
+static std::unique_ptr<SimulatorPool> simulatorPool;
+
 struct DescheduleDeleter
 {
     void operator()(BaseGlobalEvent *event)
@@ -178,6 +584,53 @@ struct DescheduleDeleter
     }
 };
 
+namespace
+{
+
+std::unordered_map<std::string, ExitHandler> exitHandlers;
+std::unordered_map<std::string, uint64_t> exitActionCounts;
+
+} // anonymous namespace
+
+void
+registerExitHandler(const std::string &cause, const ExitHandler &handler)
+{
+    if (handler)
+        exitHandlers[cause] = handler;
+    else
+        exitHandlers.erase(cause);
+}
+
+void
+registerExitAction(const std::string &cause, const std::string &action,
+                   uint64_t limit)
+{
+    bool dump = action == "dump_stats" || action == "dump_reset_stats";
+    bool reset = action == "reset_stats" || action == "dump_reset_stats";
+    fatal_if(!dump && !reset && action != "continue",
+             "Unknown exit action '%s' for '%s'.", action, cause);
+
+    exitActionCounts[cause] = 0;
+    registerExitHandler(cause, [=](const std::string &, int) {
+        uint64_t &count = exitActionCounts[cause];
+        if (limit && count >= limit)
+            return false;
+        ++count;
+        if (dump)
+            statistics::dump();
+        if (reset)
+            statistics::reset();
+        return true;
+    });
+}
+
+uint64_t
+exitActionCount(const std::string &cause)
+{
+    auto it = exitActionCounts.find(cause);
+    return it == exitActionCounts.end() ? 0 : it->second;
+}
+
 /** Simulate for num_cycles additional cycles.  If num_cycles is -1
  * (the default), we simulate to MAX_TICKS unless the max ticks has been set
  * via the 'set_max_tick' function prior. This function is exported to Python.
@@ -193,8 +646,14 @@ simulate(Tick num_cycles)
 
     inform("Entering event queue @ %d.  Starting simulation...\n", curTick());
 
-    if (!simulatorThreads)
+    const bool use_pool = eventQueueThreads != 0 &&
+        eventQueueThreads < numMainEventQueues;
+    if (use_pool && !simulatorPool) {
+        simulatorPool.reset(
+            new SimulatorPool(eventQueueThreads, numMainEventQueues));
+    } else if (!use_pool && !simulatorThreads) {
         simulatorThreads.reset(new SimulatorThreads(numMainEventQueues));
+    }
 
     if (!simulate_limit_event) {
         // If the simulate_limit_event is not set, we set it to MaxTick.
@@ -218,26 +677,56 @@ simulate(Tick num_cycles)
         fatal_if(simQuantum == 0,
                  "Quantum for multi-eventq simulation not specified");
 
-        quantum_event.reset(
-            new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
-                                EventBase::Progress_Event_Pri, 0));
+        if (conservativeSync) {
+            fatal_if(use_pool, "Conservative event queue synchronisation "
+                     "needs a host thread for every event queue.");
+            if (!conservative)
+                conservative.reset(new ConservativeSync(numMainEventQueues));
+            conservative->reset();
+        } else {
+            quantum_event.reset(
+                new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
+                                    EventBase::Progress_Event_Pri, 0));
+            quantum_event->elastic = elasticQuantum;
+        }
 
         inParallelMode = true;
     }
 
-    simulatorThreads->runUntilLocalExit();
-    Event *local_event = doSimLoop(mainEventQueue[0]);
-    assert(local_event);
-
-    inParallelMode = false;
-
-    // locate the global exit event and return it to Python
-    BaseGlobalEvent *global_event = local_event->globalEvent();
-    assert(global_event);
+    while (true) {
+        Event *local_event;
+        if (use_pool) {
+            local_event = simulatorPool->runUntilLocalExit();
+        } else {
+            simulatorThreads->runUntilLocalExit();
+            local_event = doSimLoop(mainEventQueue[0]);
+        }
+        assert(local_event);
+
+        inParallelMode = false;
+
+        // locate the global exit event
+        BaseGlobalEvent *global_event = local_event->globalEvent();
+        assert(global_event);
+
+        global_exit_event =
+            dynamic_cast<GlobalSimLoopExitEvent *>(global_event);
+        assert(global_exit_event);
+
+        // Exits with a handler in C++ go straight back to simulating,
+        // the others are returned to Python
+        if (global_exit_event == simulate_limit_event)
+            break;
+        auto it = exitHandlers.find(global_exit_event->getCause());
+        if (it == exitHandlers.end() ||
+            !it->second(global_exit_event->getCause(),
+                        global_exit_event->getCode())) {
+            break;
+        }
 
-    global_exit_event =
-        dynamic_cast<GlobalSimLoopExitEvent *>(global_event);
-    assert(global_exit_event);
+        global_exit_event->clean();
+        inParallelMode = numMainEventQueues > 1;
+    }
 
     return global_exit_event;
 }
@@ -268,7 +757,48 @@ Tick get_max_tick()
 void
 terminateEventQueueThreads()
 {
-    simulatorThreads->terminateThreads();
+    if (simulatorThreads)
+        simulatorThreads->terminateThreads();
+    if (simulatorPool)
+        simulatorPool->terminateThreads();
+}
+
+
+/**
+ * Service the asynchronous requests (e.g., signals) flagged by
+ * async_event. Only called for the main event queue.
+ *
+ * @return False if the simulation loop should exit on an exception.
+ */
+static bool
+serviceAsyncEvents(EventQueue *eventq)
+{
+    async_event = false;
+    // Take the event queue lock in case any of the service
+    // routines want to schedule new events.
+    std::lock_guard<EventQueue> lock(*eventq);
+    if (async_statdump || async_statreset) {
+        statistics::schedStatEvent(async_statdump, async_statreset);
+        async_statdump = false;
+        async_statreset = false;
+    }
+
+    if (async_io) {
+        async_io = false;
+        pollQueue.service();
+    }
+
+    if (async_exit) {
+        async_exit = false;
+        exitSimLoop("user interrupt received");
+    }
+
+    if (async_exception) {
+        async_exception = false;
+        return false;
+    }
+
+    return true;
 }
 
 
@@ -286,6 +816,17 @@ doSimLoop(EventQueue *eventq)
 
     bool mainQueue = eventq == getEventQueue(0);
 
+    // Index of this queue and its current safe horizon when using
+    // conservative synchronisation.
+    uint32_t index = 0;
+    Tick horizon = 0;
+    Tick published = MaxTick;
+    ConservativeSync *sync = inParallelMode ? conservative.get() : nullptr;
+    if (sync) {
+        while (mainEventQueue[index] != eventq)
+            index++;
+    }
+
     while (1) {
         // there should always be at least one event (the SimLoopExitEvent
         // we just scheduled) in the queue
@@ -293,30 +834,24 @@ doSimLoop(EventQueue *eventq)
         assert(curTick() <= eventq->nextTick() &&
                "event scheduled in the past");
 
-        if (mainQueue && async_event) {
-            async_event = false;
-            // Take the event queue lock in case any of the service
-            // routines want to schedule new events.
-            std::lock_guard<EventQueue> lock(*eventq);
-            if (async_statdump || async_statreset) {
-                statistics::schedStatEvent(async_statdump, async_statreset);
-                async_statdump = false;
-                async_statreset = false;
-            }
-
-            if (async_io) {
-                async_io = false;
-                pollQueue.service();
-            }
-
-            if (async_exit) {
-                async_exit = false;
-                exitSimLoop("user interrupt received");
-            }
-
-            if (async_exception) {
-                async_exception = false;
-                return NULL;
+        if (mainQueue && async_event && !serviceAsyncEvents(eventq))
+            return NULL;
+
+        if (sync) {
+            if (eventq->nextTick() >= horizon) {
+                horizon = sync->update(index, eventq);
+                if (eventq->nextTick() >= horizon) {
+                    // Blocked on a neighbour, give it a chance to run.
+                    std::this_thread::yield();
+                    continue;
+                }
+                published = eventq->nextTick();
+            } else if (eventq->nextTick() != published) {
+                // Keep the clock up to date so that neighbours are
+                // never held back by a stale value, e.g. while this
+                // queue waits on the barrier of a global event.
+                published = eventq->nextTick();
+                sync->publish(index, published);
             }
         }
 
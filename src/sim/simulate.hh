@@ -75,6 +75,57 @@ Tick get_max_tick();
  */
 void terminateEventQueueThreads();
 
+/**
+ * Use conservative lookahead-based synchronisation between the main
+ * event queues instead of a global barrier every simulation quantum.
+ * Set from the Root object.
+ */
+extern bool conservativeSync;
+
+/**
+ * Place the next quantum barrier one simulation quantum after the
+ * earliest event pending on any main event queue, rather than one
+ * quantum after the current barrier. Nothing can cross between queues
+ * before that event is serviced, so quanta in which every queue is
+ * idle are skipped without relaxing the bound on the skew. Only used
+ * without conservativeSync. Set from the Root object.
+ */
+extern bool elasticQuantum;
+
+/**
+ * Number of host threads running the main event queues. When it is
+ * smaller than the number of queues, the queues are not pinned to
+ * threads. Instead, a pool of threads repeatedly takes the quantum of
+ * one queue to run, up to the queue's next global event, preferring
+ * the queues it ran before and stealing from other threads when it
+ * runs out. Zero runs every queue on a thread of its own. Set from the
+ * Root object.
+ */
+extern unsigned eventQueueThreads;
+
+/**
+ * Register a link between two main event queues.
+ *
+ * Any event that the source queue schedules on the destination queue
+ * through this link is at least latency ticks in the future. When
+ * conservativeSync is set, this lets the destination queue run ahead
+ * of the source queue by up to the minimum latency of all links
+ * between them. The lookahead between any two queues is never larger
+ * than simQuantum, since global events are scheduled at least one
+ * quantum into the future. Links with zero latency do not tighten the
+ * default and are ignored.
+ *
+ * Every link also gets a dedicated single producer channel on the
+ * destination queue, so that events crossing the link do not contend
+ * with events scheduled by other threads.
+ * @see EventQueue::addAsyncChannel()
+ *
+ * @param src Index of the queue the events originate from.
+ * @param dst Index of the queue the events are scheduled on.
+ * @param latency Minimum latency of the link in ticks.
+ */
+void registerLookahead(uint32_t src, uint32_t dst, Tick latency);
+
 extern GlobalSimLoopExitEvent *simulate_limit_event;
 
 } // namespace gem5
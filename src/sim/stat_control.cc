@@ -48,10 +48,13 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
 
 #include "base/callback.hh"
 #include "base/statistics.hh"
+#include "base/stats/shm_export.hh"
 #include "base/time.hh"
+#include "sim/eventq.hh"
 #include "sim/global_event.hh"
 
 namespace gem5
@@ -61,6 +64,9 @@ namespace statistics
 {
 
 GlobalEvent *dumpEvent;
+Event *snapshotEvent;
+Event *exportEvent;
+std::unique_ptr<SharedMemoryExport> sharedMemoryExport;
 
 void
 initSimStats()
@@ -102,6 +108,64 @@ class StatEvent : public GlobalEvent
     const char *description() const { return "GlobalStatEvent"; }
 };
 
+/**
+ * Event to dump a snapshot of the statistics from the first main event
+ * queue. This doesn't synchronise the event queues, so the other queues
+ * keep running while the snapshot is taken.
+ */
+class SnapshotEvent : public Event
+{
+  private:
+    Tick repeat;
+
+  public:
+    SnapshotEvent(Tick _repeat)
+        : Event(Stat_Event_Pri, AutoDelete), repeat(_repeat)
+    {
+    }
+
+    void
+    process() override
+    {
+        // This event is deleted once processed
+        snapshotEvent = nullptr;
+
+        statistics::snapshot();
+
+        if (repeat)
+            statistics::schedSnapshotEvent(curTick() + repeat, repeat);
+    }
+
+    const char *description() const override { return "SnapshotStatEvent"; }
+};
+
+/**
+ * Event to update the shared memory export of the statistics from the
+ * first main event queue.
+ */
+class ExportEvent : public Event
+{
+  private:
+    Tick repeat;
+
+  public:
+    ExportEvent(Tick _repeat)
+        : Event(Stat_Event_Pri, AutoDelete), repeat(_repeat)
+    {
+    }
+
+    void
+    process() override
+    {
+        sharedMemoryExport->update(curTick());
+
+        exportEvent = new ExportEvent(repeat);
+        getEventQueue(0)->schedule(exportEvent, curTick() + repeat);
+    }
+
+    const char *description() const override { return "ExportStatEvent"; }
+};
+
 void
 schedStatEvent(bool dump, bool reset, Tick when, Tick repeat)
 {
@@ -142,6 +206,46 @@ periodicStatDump(Tick period)
     }
 }
 
+void
+schedSnapshotEvent(Tick when, Tick repeat)
+{
+    snapshotEvent = new SnapshotEvent(repeat);
+    getEventQueue(0)->schedule(snapshotEvent, when);
+}
+
+void
+periodicSnapshotDump(Tick period)
+{
+    if (snapshotEvent) {
+        // The event is deleted when it is descheduled
+        getEventQueue(0)->deschedule(snapshotEvent);
+        snapshotEvent = nullptr;
+    }
+
+    if (period != 0)
+        schedSnapshotEvent(curTick() + period, period);
+}
+
+void
+exportSharedMemory(const std::string &segment,
+                   const std::vector<std::string> &stats, Tick period)
+{
+    if (exportEvent) {
+        // The event is deleted when it is descheduled
+        getEventQueue(0)->deschedule(exportEvent);
+        exportEvent = nullptr;
+    }
+    sharedMemoryExport.reset();
+
+    if (period != 0) {
+        sharedMemoryExport.reset(new SharedMemoryExport(segment, stats));
+        sharedMemoryExport->update(curTick());
+
+        exportEvent = new ExportEvent(period);
+        getEventQueue(0)->schedule(exportEvent, curTick() + period);
+    }
+}
+
 void
 updateEvents()
 {
@@ -156,6 +260,16 @@ updateEvents()
         Tick _when = dumpEvent->when();
         dumpEvent->reschedule(_when + curTick());
     }
+
+    if (snapshotEvent && snapshotEvent->when() < curTick()) {
+        getEventQueue(0)->reschedule(snapshotEvent,
+                                     snapshotEvent->when() + curTick());
+    }
+
+    if (exportEvent && exportEvent->when() < curTick()) {
+        getEventQueue(0)->reschedule(exportEvent,
+                                     exportEvent->when() + curTick());
+    }
 }
 
 } // namespace statistics
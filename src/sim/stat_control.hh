@@ -41,6 +41,9 @@
 #ifndef __SIM_STAT_CONTROL_HH__
 #define __SIM_STAT_CONTROL_HH__
 
+#include <string>
+#include <vector>
+
 #include "base/compiler.hh"
 #include "base/types.hh"
 #include "sim/cur_tick.hh"
@@ -81,6 +84,33 @@ void schedStatEvent(bool dump, bool reset, Tick when = curTick(),
  * @param period The period at which the dumping should occur.
  */
 void periodicStatDump(Tick period = 0);
+
+/**
+ * Schedule a snapshot dump of the statistics. Unlike the events scheduled
+ * by schedStatEvent(), the snapshot is taken by the first main event queue
+ * alone, without a barrier, while the other queues keep running.
+ */
+void schedSnapshotEvent(Tick when = curTick(), Tick repeat = 0);
+
+/**
+ * Periodically dump snapshots of the statistics, or stop if the period
+ * is 0. @sa schedSnapshotEvent()
+ */
+void periodicSnapshotDump(Tick period = 0);
+
+/**
+ * Export the live values of a set of stats into a POSIX shared memory
+ * segment (see SharedMemoryExport), updated by the first main event
+ * queue every period ticks. Stop the current export and remove its
+ * segment if the period is 0.
+ * @param segment The name of the segment, e.g., "/gem5-stats".
+ * @param stats The names of the scalars, vectors and formulas to export.
+ * @param period The period at which the segment should be updated.
+ */
+void exportSharedMemory(const std::string &segment,
+                        const std::vector<std::string> &stats,
+                        Tick period);
+
 } // namespace statistics
 } // namespace gem5
 
@@ -47,10 +47,11 @@ namespace statistics
 
 extern void pythonDump();
 extern void pythonReset();
+extern void pythonSnapshot();
 
 void registerPythonStatsHandlers()
 {
-    registerHandlers(pythonReset, pythonDump);
+    registerHandlers(pythonReset, pythonDump, pythonSnapshot);
 }
 
 } // namespace statistics
@@ -30,18 +30,20 @@
 #include "sim/syscall_desc.hh"
 
 #include "base/types.hh"
+#include "cpu/thread_context.hh"
 #include "sim/eventq.hh"
+#include "sim/process.hh"
+#include "sim/se_workload.hh"
 #include "sim/syscall_debug_macros.hh"
 
 namespace gem5
 {
 
-class ThreadContext;
-
 void
 SyscallDesc::doSyscall(ThreadContext *tc)
 {
     DPRINTF_SYSCALL(Base, "Calling %s...\n", dumper(name(), tc));
+    auto lock = tc->getProcessPtr()->seWorkload->lockEmulation();
 
     SyscallReturn retval = executor(this, tc);
 
@@ -50,7 +52,7 @@ SyscallDesc::doSyscall(ThreadContext *tc)
         tc->suspend();
 
         DPRINTF_SYSCALL(Base, "%s needs retry.\n", name());
-        setupRetry(tc);
+        setupRetry(tc, retval.retryTick());
         return;
     }
 
@@ -61,12 +63,13 @@ void
 SyscallDesc::retrySyscall(ThreadContext *tc)
 {
     DPRINTF_SYSCALL(Base, "Retrying %s...\n", dumper(name(), tc));
+    auto lock = tc->getProcessPtr()->seWorkload->lockEmulation();
 
     SyscallReturn retval = executor(this, tc);
 
     if (retval.needsRetry()) {
         DPRINTF_SYSCALL(Base, "%s still needs retry.\n", name());
-        setupRetry(tc);
+        setupRetry(tc, retval.retryTick());
         return;
     }
 
@@ -77,17 +80,20 @@ SyscallDesc::retrySyscall(ThreadContext *tc)
 }
 
 void
-SyscallDesc::setupRetry(ThreadContext *tc)
+SyscallDesc::setupRetry(ThreadContext *tc, Tick when)
 {
     // Create an event which will retry the system call later.
     auto retry = [this, tc]() { retrySyscall(tc); };
     auto *event = new EventFunctionWrapper(retry, name(), true);
 
-    // Schedule it in about 100 CPU cycles. That will give other contexts
-    // a chance to execute a bit of code before trying again.
-    auto *cpu = tc->getCpuPtr();
-    curEventQueue()->schedule(event,
-            curTick() + cpu->cyclesToTicks(Cycles(100)));
+    // Unless the system call knows when it can finish, schedule it in
+    // about 100 CPU cycles. That will give other contexts a chance to
+    // execute a bit of code before trying again.
+    if (when <= curTick()) {
+        auto *cpu = tc->getCpuPtr();
+        when = curTick() + cpu->cyclesToTicks(Cycles(100));
+    }
+    curEventQueue()->schedule(event, when);
 }
 
 void
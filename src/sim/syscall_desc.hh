@@ -102,7 +102,7 @@ class SyscallDesc
     std::string _name;
     int _num;
 
-    void setupRetry(ThreadContext *tc);
+    void setupRetry(ThreadContext *tc, Tick when);
     void handleReturn(ThreadContext *tc, const SyscallReturn &ret);
 
     /** Mechanism for ISAs to connect to the emul function definitions */
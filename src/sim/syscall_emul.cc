@@ -47,6 +47,7 @@
 #include "sim/byteswap.hh"
 #include "sim/process.hh"
 #include "sim/proxy_ptr.hh"
+#include "sim/se_workload.hh"
 #include "sim/sim_exit.hh"
 #include "sim/syscall_debug_macros.hh"
 #include "sim/syscall_desc.hh"
@@ -118,6 +119,8 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
         exitFutexWake(tc, p->childClearTID, p->tgid());
 
     bool last_thread = true;
+    // Halts of threads on other event queues which are still to happen
+    int pending_halts = 0;
     Process *parent = nullptr, *tg_lead = nullptr;
     for (int i = 0; last_thread && i < sys->threads.size(); i++) {
         Process *walk;
@@ -157,7 +160,16 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
                  * all threads in the group.
                  */
                 if (*(p->exitGroup)) {
-                    tc->halt();
+                    // The thread may have exited itself by the time a
+                    // halt from another event queue happens.
+                    auto halt = [tc]() {
+                        if (tc->status() != ThreadContext::Halted &&
+                            tc->status() != ThreadContext::Halting) {
+                            tc->halt();
+                        }
+                    };
+                    if (!SEWorkload::updateThread(tc, halt))
+                        pending_halts++;
                 } else {
                     last_thread = false;
                 }
@@ -201,7 +213,7 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
     if (!p->vforkContexts.empty()) {
         ThreadContext *vtc = sys->threads[p->vforkContexts.front()];
         assert(vtc->status() == ThreadContext::Suspended);
-        vtc->activate();
+        SEWorkload::updateThread(vtc, [vtc]() { vtc->activate(); });
     }
 
     tc->halt();
@@ -213,6 +225,7 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
     int activeContexts = 0;
     for (auto &system: sys->systemList)
         activeContexts += system->threads.numRunning();
+    activeContexts -= pending_halts;
 
     if (activeContexts == 0) {
         /**
@@ -1500,4 +1513,59 @@ getcpuFunc(SyscallDesc *desc, ThreadContext *tc,
     return 0;
 }
 
+bool
+asyncFileIO(ThreadContext *tc, int sim_fd, Addr buf_ptr, int nbytes,
+            off_t offset, bool write, bool sync, SyscallReturn &ret)
+{
+    auto p = tc->getProcessPtr();
+
+    auto it = p->pendingIO.find(tc->contextId());
+    if (it == p->pendingIO.end()) {
+        if (!p->asyncIO || nbytes <= 0 ||
+                (uint64_t)nbytes < p->asyncIOMinSize) {
+            return false;
+        }
+
+        auto op = std::make_shared<AsyncFileIO::Op>();
+        op->fd = sim_fd;
+        op->write = write;
+        op->sync = sync;
+        op->offset = offset < 0 ? lseek(sim_fd, 0, SEEK_CUR) : offset;
+        if (op->offset == -1)
+            return false;
+        op->data.resize(nbytes);
+        if (write)
+            SETranslatingPortProxy(tc).readBlob(buf_ptr, op->data.data(),
+                                                nbytes);
+
+        const Tick ready = curTick() + p->ioLatency +
+            (Tick)(nbytes * p->ioTicksPerByte);
+        DPRINTF_SYSCALL(Verbose, "%s of %d bytes in the background, done "
+                        "at %d.\n", write ? "Write" : "Read", nbytes, ready);
+        p->asyncIO->submit(op);
+        p->pendingIO[tc->contextId()] = { op, ready };
+        ret = SyscallReturn::retry(ready);
+        return true;
+    }
+
+    const Process::PendingIO pending = it->second;
+    if (curTick() < pending.ready) {
+        ret = SyscallReturn::retry(pending.ready);
+        return true;
+    }
+    p->pendingIO.erase(it);
+
+    // Only wait on the host if it's slower than the simulated I/O.
+    p->asyncIO->wait(pending.op);
+    const int64_t result = pending.op->result;
+    if (!write && result > 0)
+        SETranslatingPortProxy(tc).writeBlob(buf_ptr,
+                                             pending.op->data.data(), result);
+    if (offset < 0 && result > 0)
+        lseek(sim_fd, pending.op->offset + result, SEEK_SET);
+
+    ret = result;
+    return true;
+}
+
 } // namespace gem5
@@ -104,10 +104,12 @@
 #include "sim/guest_abi.hh"
 #include "sim/process.hh"
 #include "sim/proxy_ptr.hh"
+#include "sim/se_workload.hh"
 #include "sim/syscall_debug_macros.hh"
 #include "sim/syscall_desc.hh"
 #include "sim/syscall_emul_buf.hh"
 #include "sim/syscall_return.hh"
+#include "sim/system.hh"
 
 #if defined(__APPLE__) && defined(__MACH__) && !defined(CMSG_ALIGN)
 #define CMSG_ALIGN(len) (((len) + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1))
@@ -354,6 +356,21 @@ SyscallReturn getcpuFunc(SyscallDesc *desc, ThreadContext *tc,
 SyscallReturn getsocknameFunc(SyscallDesc *desc, ThreadContext *tc,
                               int tgt_fd, VPtr<> addrPtr, VPtr<> lenPtr);
 
+/**
+ * Do the host I/O of a file read or write in the background, if the
+ * process does asynchronous I/O and the access is large enough. The
+ * system call is retried until the I/O is done, and the simulated
+ * latency of the I/O has passed.
+ *
+ * @param offset The offset in the file, or -1 to use and move the file
+ * position.
+ * @param sync Sync a write to the file.
+ * @param ret Set to the return value of the system call.
+ * @return False if the I/O has to be done by the system call.
+ */
+bool asyncFileIO(ThreadContext *tc, int sim_fd, Addr buf_ptr, int nbytes,
+                 off_t offset, bool write, bool sync, SyscallReturn &ret);
+
 template <class OS>
 SyscallReturn
 atSyscallPath(ThreadContext *tc, int dirfd, std::string &path)
@@ -1657,6 +1674,10 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     pp->ppid = (flags & OS::TGT_CLONE_THREAD) ? p->ppid() : p->pid();
     pp->useArchPT = p->useArchPT;
     pp->kvmInSE = p->kvmInSE;
+    pp->async_io = p->asyncIO != nullptr;
+    pp->async_io_min_size = p->asyncIOMinSize;
+    pp->io_latency = p->ioLatency;
+    pp->io_bandwidth = p->ioTicksPerByte;
     Process *cp = pp->create();
     // TODO: there is no way to know when the Process SimObject is done with
     // the params pointer. Both the params pointer (pp) and the process
@@ -1707,7 +1728,19 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
 
     desc->returnInto(ctc, 0);
 
-    ctc->activate();
+    /**
+     * If the child runs on another event queue, it only starts with the
+     * next quantum. Keep its context from being handed out again until
+     * then.
+     */
+    System *sys = tc->getSystemPtr();
+    auto start = [sys, ctc]() {
+        auto lock = ctc->getProcessPtr()->seWorkload->lockEmulation();
+        sys->threads.markStarting(ctc->contextId(), false);
+        ctc->activate();
+    };
+    if (!SEWorkload::updateThread(ctc, start))
+        sys->threads.markStarting(ctc->contextId(), true);
 
     if (flags & OS::TGT_CLONE_VFORK) {
         tc->suspend();
@@ -2001,6 +2034,10 @@ pread64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    SyscallReturn ret;
+    if (asyncFileIO(tc, sim_fd, bufPtr, nbytes, offset, false, false, ret))
+        return ret;
+
     BufferArg bufArg(bufPtr, nbytes);
 
     int bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
@@ -2022,6 +2059,10 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    SyscallReturn ret;
+    if (asyncFileIO(tc, sim_fd, bufPtr, nbytes, offset, true, false, ret))
+        return ret;
+
     BufferArg bufArg(bufPtr, nbytes);
     bufArg.copyIn(SETranslatingPortProxy(tc));
 
@@ -2234,7 +2275,7 @@ execveFunc(SyscallDesc *desc, ThreadContext *tc,
     if (!p->vforkContexts.empty()) {
         ThreadContext *vtc = p->system->threads[p->vforkContexts.front()];
         assert(vtc->status() == ThreadContext::Suspended);
-        vtc->activate();
+        SEWorkload::updateThread(vtc, [vtc]() { vtc->activate(); });
     }
 
     /**
@@ -2259,6 +2300,10 @@ execveFunc(SyscallDesc *desc, ThreadContext *tc,
     pp->cwd.assign(p->tgtCwd);
     pp->system = p->system;
     pp->release = p->release;
+    pp->async_io = p->asyncIO != nullptr;
+    pp->async_io_min_size = p->asyncIOMinSize;
+    pp->io_latency = p->ioLatency;
+    pp->io_bandwidth = p->ioTicksPerByte;
     /**
      * Prevent process object creation with identical PIDs (which will trip
      * a fatal check in Process constructor). The execve call is supposed to
@@ -2655,6 +2700,12 @@ readFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
+    SyscallReturn ret;
+    if (std::dynamic_pointer_cast<FileFDEntry>(hbfdp) &&
+            asyncFileIO(tc, sim_fd, buf_ptr, nbytes, -1, false, false, ret)) {
+        return ret;
+    }
+
     struct pollfd pfd;
     pfd.fd = sim_fd;
     pfd.events = POLLIN | POLLPRI;
@@ -2683,6 +2734,12 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
+    SyscallReturn ret;
+    if (std::dynamic_pointer_cast<FileFDEntry>(hbfdp) &&
+            asyncFileIO(tc, sim_fd, buf_ptr, nbytes, -1, true, true, ret)) {
+        return ret;
+    }
+
     BufferArg buf_arg(buf_ptr, nbytes);
     buf_arg.copyIn(SETranslatingPortProxy(tc));
 
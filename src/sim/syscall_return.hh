@@ -31,6 +31,8 @@
 
 #include <inttypes.h>
 
+#include "base/types.hh"
+
 namespace gem5
 {
 
@@ -76,11 +78,13 @@ class SyscallReturn
     {}
 
     /// Pseudo-constructor to create an instance with the retry flag set.
+    /// The retry is at the given tick, or after a short delay if none.
     static SyscallReturn
-    retry()
+    retry(Tick when=0)
     {
         SyscallReturn s(0);
         s.retryFlag = true;
+        s._retryTick = when;
         return s;
     }
 
@@ -96,6 +100,9 @@ class SyscallReturn
     /// Does the syscall need to be retried?
     bool needsRetry() const { return retryFlag; }
 
+    /// When to retry the syscall, 0 if it doesn't matter.
+    Tick retryTick() const { return _retryTick; }
+
     /// Should returning this value be suppressed?
     bool suppressed() const { return _count == 0; }
 
@@ -127,6 +134,7 @@ class SyscallReturn
     int _count;
 
     bool retryFlag = false;
+    Tick _retryTick = 0;
 };
 
 } // namespace gem5
@@ -121,8 +121,10 @@ ThreadContext *
 System::Threads::findFree()
 {
     for (auto &thread: threads) {
-        if (thread.context->status() == ThreadContext::Halted)
+        if (thread.context->status() == ThreadContext::Halted &&
+                !thread.starting) {
             return thread.context;
+        }
     }
     return nullptr;
 }
@@ -133,8 +135,8 @@ System::Threads::numRunning() const
     int count = 0;
     for (auto &thread: threads) {
         auto status = thread.context->status();
-        if (status != ThreadContext::Halted &&
-                status != ThreadContext::Halting) {
+        if (thread.starting || (status != ThreadContext::Halted &&
+                status != ThreadContext::Halting)) {
             count++;
         }
     }
@@ -145,9 +147,18 @@ void
 System::Threads::quiesce(ContextID id)
 {
     auto &t = thread(id);
-    [[maybe_unused]] BaseCPU *cpu = t.context->getCpuPtr();
+    BaseCPU *cpu = t.context->getCpuPtr();
     DPRINTFS(Quiesce, cpu, "quiesce()\n");
     t.quiesce();
+
+    // A timed quiesce left over from before the thread was woken up
+    // early (e.g. by an interrupt) would otherwise wake it up again
+    // just to have the idle loop put it back to sleep.
+    if (t.resumeEvent->scheduled()) {
+        DPRINTFS(Quiesce, cpu, "cancelling stale resume at %u\n",
+                 t.resumeEvent->when());
+        cpu->deschedule(t.resumeEvent);
+    }
 }
 
 void
@@ -171,7 +182,11 @@ System::System(const Params &p)
       physProxy(_systemPort, p.cache_line_size),
       workload(p.workload),
       physmem(name() + ".physmem", p.memories, p.mmap_using_noreserve,
-              p.shared_backstore, p.auto_unlink_shared_backstore),
+              p.shared_backstore, p.auto_unlink_shared_backstore,
+              p.checkpoint_memory_format, p.checkpoint_threads,
+              p.lazy_checkpoint_restore, p.delta_checkpoints,
+              p.backing_store_huge_pages, p.prefault_backing_store,
+              p.shared_checkpoint_images),
       ShadowRomRanges(p.shadow_rom_ranges.begin(),
                       p.shadow_rom_ranges.end()),
       memoryMode(p.mem_mode),
@@ -120,6 +120,8 @@ class System : public SimObject, public PCEventScope
         {
             ThreadContext *context = nullptr;
             bool active = false;
+            /** Activated from another event queue, and not running yet. */
+            bool starting = false;
             Event *resumeEvent = nullptr;
 
             void resume();
@@ -206,6 +208,11 @@ class System : public SimObject, public PCEventScope
         }
 
         void markActive(ContextID id) { thread(id).active = true; }
+        void
+        markStarting(ContextID id, bool starting)
+        {
+            thread(id).starting = starting;
+        }
 
         int size() const { return threads.size(); }
         bool empty() const { return threads.empty(); }
@@ -302,6 +309,15 @@ class System : public SimObject, public PCEventScope
     void setMemoryMode(enums::MemoryMode mode);
     /** @} */
 
+    /**
+     * Finish restoring the memory that is restored from a checkpoint on
+     * demand.
+     *
+     * \warn This should only be called by the Python, before forking
+     * the simulator.
+     */
+    void completeLazyRestore() { physmem.completeLazyRestore(); }
+
     /**
      * Get the cache line size of the system.
      */
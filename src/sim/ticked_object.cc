@@ -49,6 +49,9 @@ Ticked::Ticked(ClockedObject &object_,
     Event::Priority priority) :
     object(object_),
     event([this]{ processClockEvent(); }, object_.name(), false, priority),
+    ticker(nullptr),
+    tickerLookedUp(false),
+    subscribed(false),
     running(false),
     lastStopped(0),
     /* Allocate numCycles if an external stat wasn't passed in */
@@ -58,15 +61,34 @@ Ticked::Ticked(ClockedObject &object_,
 { }
 
 void
-Ticked::processClockEvent() {
+Ticked::tick()
+{
     ++tickCycles;
     ++numCycles;
     countCycles(Cycles(1));
     evaluate();
-    if (running)
+}
+
+void
+Ticked::processClockEvent() {
+    tick();
+    if (running && !subscribed)
         object.schedule(event, object.clockEdge(Cycles(1)));
 }
 
+ClockDomain::Ticker *
+Ticked::domainTicker()
+{
+    // The event queue of the object is only known once the simulation
+    // is set up, so look the ticker up on the first start
+    if (!tickerLookedUp) {
+        ticker = object.getClockDomain().ticker(object.eventQueue(),
+                                             event.priority());
+        tickerLookedUp = true;
+    }
+    return ticker;
+}
+
 void
 Ticked::regStats()
 {
@@ -70,6 +70,19 @@ class Ticked : public Serializable
     /** Evaluate and reschedule */
     void processClockEvent();
 
+    /** Count the cycle and evaluate */
+    void tick();
+
+    /** Get the shared ticker of the clock domain, if it has one */
+    ClockDomain::Ticker *domainTicker();
+
+    /** The shared ticker of the clock domain, once looked up */
+    ClockDomain::Ticker *ticker;
+    bool tickerLookedUp;
+
+    /** Am I evaluated by the ticker of the clock domain? */
+    bool subscribed;
+
     /** Have I been started? and am not stopped */
     bool running;
 
@@ -106,8 +119,14 @@ class Ticked : public Serializable
     start()
     {
         if (!running) {
-            if (!event.scheduled())
-                object.schedule(event, object.clockEdge(Cycles(1)));
+            if (!event.scheduled()) {
+                if (ClockDomain::Ticker *t = domainTicker()) {
+                    t->subscribe(this);
+                    subscribed = true;
+                } else {
+                    object.schedule(event, object.clockEdge(Cycles(1)));
+                }
+            }
             running = true;
             numCycles += cyclesSinceLastStopped();
             countCycles(cyclesSinceLastStopped());
@@ -133,6 +152,10 @@ class Ticked : public Serializable
     stop()
     {
         if (running) {
+            if (subscribed) {
+                ticker->unsubscribe(this);
+                subscribed = false;
+            }
             if (event.scheduled())
                 object.deschedule(event);
             running = false;
@@ -159,6 +182,8 @@ class Ticked : public Serializable
      * @param delta Number of cycles since the previous call.
      */
     virtual void countCycles(Cycles delta) {}
+
+    friend class ClockDomain::Ticker;
 };
 
 /** TickedObject attaches Ticked to ClockedObject and can be used as
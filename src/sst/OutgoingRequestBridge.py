@@ -37,3 +37,8 @@ class OutgoingRequestBridge(SimObject):
     physical_address_ranges = VectorParam.AddrRange(
         [AddrRange(0x80000000, MaxAddr)], "Physical address ranges."
     )
+    batch_packets = Param.Bool(
+        False,
+        "Hand the requests gem5 makes, and the responses SST returns, "
+        "across the bridge once per SST clock tick",
+    )
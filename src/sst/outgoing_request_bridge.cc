@@ -41,7 +41,8 @@ OutgoingRequestBridge::OutgoingRequestBridge(
     outgoingPort(std::string(name()), this),
     sstResponder(nullptr),
     physicalAddressRanges(params.physical_address_ranges.begin(),
-                          params.physical_address_ranges.end())
+                          params.physical_address_ranges.end()),
+    batchPackets(params.batch_packets)
 {
 }
 
@@ -99,6 +100,24 @@ OutgoingRequestBridge::sendTimingResp(gem5::PacketPtr pkt)
     return outgoingPort.sendTimingResp(pkt);
 }
 
+size_t
+OutgoingRequestBridge::sendTimingResps(const std::vector<PacketPtr> &pkts)
+{
+    size_t sent = 0;
+    while (sent < pkts.size() && outgoingPort.sendTimingResp(pkts[sent]))
+        sent++;
+    return sent;
+}
+
+void
+OutgoingRequestBridge::flushRequests()
+{
+    if (pendingRequests.empty())
+        return;
+    sstResponder->handleRecvTimingReqs(pendingRequests);
+    pendingRequests.clear();
+}
+
 void
 OutgoingRequestBridge::sendTimingSnoopReq(gem5::PacketPtr pkt)
 {
@@ -133,7 +152,10 @@ bool
 OutgoingRequestBridge::
 OutgoingRequestPort::recvTimingReq(PacketPtr pkt)
 {
-    owner->sstResponder->handleRecvTimingReq(pkt);
+    if (owner->batchPackets)
+        owner->pendingRequests.push_back(pkt);
+    else
+        owner->sstResponder->handleRecvTimingReq(pkt);
     return true;
 }
 
@@ -79,6 +79,11 @@ class OutgoingRequestBridge: public SimObject
 
     AddrRangeList physicalAddressRanges;
 
+    // whether requests are buffered until the end of the SST clock tick
+    const bool batchPackets;
+    // requests received from gem5 since the last flushRequests()
+    std::vector<PacketPtr> pendingRequests;
+
   public:
     OutgoingRequestBridge(const OutgoingRequestBridgeParams &params);
     ~OutgoingRequestBridge();
@@ -108,6 +113,19 @@ class OutgoingRequestBridge: public SimObject
     // This function is called when SST wants to sent a timing response to gem5
     bool sendTimingResp(PacketPtr pkt);
 
+    // This function is called when SST wants to hand a batch of timing
+    // responses to gem5. The responses are sent in order until gem5 refuses
+    // one, and the number of responses accepted is returned.
+    size_t sendTimingResps(const std::vector<PacketPtr> &pkts);
+
+    // Whether the SST side should batch the requests and the responses
+    // crossing the bridge per SST clock tick.
+    bool batching() const { return batchPackets; }
+
+    // gem5 Component (from SST) calls this function at the end of an SST
+    // clock tick to forward the requests buffered while batching.
+    void flushRequests();
+
     // This function is called when SST sends response having an invalidate .
     void sendTimingSnoopReq(PacketPtr pkt);
 
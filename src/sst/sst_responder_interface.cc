@@ -33,4 +33,12 @@ SSTResponderInterface::SSTResponderInterface()
 {
 }
 
+void
+SSTResponderInterface::handleRecvTimingReqs(
+    const std::vector<PacketPtr> &pkts)
+{
+    for (auto pkt: pkts)
+        handleRecvTimingReq(pkt);
+}
+
 }; // namespace gem5
@@ -29,6 +29,7 @@
 #define __SST_RESPONDER_INTERFACE_HH__
 
 #include <string>
+#include <vector>
 
 #include "mem/port.hh"
 
@@ -54,6 +55,11 @@ class SSTResponderInterface
     // is called.
     virtual bool handleRecvTimingReq(PacketPtr pkt) = 0;
 
+    // This function is called when OutgoingRequestBridge forwards all the
+    // requests gem5 made during an SST clock tick at once. The default
+    // implementation hands them over one at a time.
+    virtual void handleRecvTimingReqs(const std::vector<PacketPtr> &pkts);
+
     // This function is called when OutogingRequestPort::recvRespRetry() is
     // called.
     virtual void handleRecvRespRetry() = 0;
@@ -23,6 +23,7 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+from m5.params import *
 from m5.SimObject import SimObject, cxxMethod
 
 # This class represents the systemc kernel. There should be exactly one in the
@@ -33,6 +34,18 @@ class SystemC_Kernel(SimObject):
     cxx_class = "sc_gem5::Kernel"
     cxx_header = "systemc/core/kernel.hh"
 
+    thread_stack_size = Param.MemorySize(
+        "320KiB",
+        "Stack size of SC_THREAD and SC_CTHREAD processes which don't set "
+        "one with set_stack_size",
+    )
+    batch_delta_cycles = Param.Bool(
+        False,
+        "Run all the delta cycles of a timestamp back to back from one gem5 "
+        "event. gem5 events scheduled for the same tick then run after "
+        "the SystemC deltas instead of between them.",
+    )
+
 
 # This class represents systemc sc_object instances in python config files. It
 # inherits from SimObject in python, but the c++ version, sc_core::sc_object,
@@ -60,6 +60,8 @@ Kernel::Kernel(const Params &params, int) :
 {
     // Install ourselves as the scheduler's event manager.
     ::sc_gem5::scheduler.setEventQueue(eventQueue());
+    ::sc_gem5::Process::setDefaultStackSize(params.thread_stack_size);
+    ::sc_gem5::scheduler.batchDeltas(params.batch_delta_cycles);
 }
 
 void
@@ -382,7 +382,7 @@ Process::Process(const char *name, ProcessFuncWrapper *func, bool internal) :
     _needsStart(true), _isUnwinding(false), _terminated(false),
     _scheduled(false), _suspended(false), _disabled(false),
     _syncReset(false), syncResetCount(0), asyncResetCount(0), _waitCount(0),
-    refCount(0), stackSize(gem5::Fiber::DefaultStackSize),
+    refCount(0), stackSize(0),
     dynamicSensitivity(nullptr)
 {
     _dynamic =
@@ -414,6 +414,7 @@ Process::terminate()
 }
 
 Process *Process::_newest;
+size_t Process::defaultStackSize = gem5::Fiber::DefaultStackSize;
 
 void
 throw_it_wrapper(Process *p, ExceptionWrapperBase &exc, bool inc_kids)
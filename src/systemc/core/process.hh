@@ -103,6 +103,9 @@ class Process : public ::sc_core::sc_process_b, public ListNode
 
     void setStackSize(size_t size) { stackSize = size; }
 
+    // Stack size of thread processes which don't ask for a specific size.
+    static void setDefaultStackSize(size_t size) { defaultStackSize = size; }
+
     void run();
 
     void addStatic(StaticSensitivity *);
@@ -190,7 +193,9 @@ class Process : public ::sc_core::sc_process_b, public ListNode
 
     int refCount;
 
+    // Requested stack size, or 0 to use defaultStackSize.
     size_t stackSize;
+    static size_t defaultStackSize;
 
     StaticSensitivities staticSensitivities;
     DynamicSensitivity *dynamicSensitivity;
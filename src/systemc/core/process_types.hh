@@ -71,7 +71,7 @@ class Thread : public Process
     fiber() override
     {
         if (!ctx)
-            ctx = new Context(this, stackSize);
+            ctx = new Context(this, stackSize ? stackSize : defaultStackSize);
         return ctx;
     }
 
@@ -98,6 +98,10 @@ class Thread : public Process
                 return;
             }
             thread->terminate();
+            // This context will never run again. Hand it to the scheduler,
+            // which frees its stack once another fiber is running.
+            thread->ctx = nullptr;
+            scheduler.retireFiber(this);
             scheduler.yield();
         }
     };
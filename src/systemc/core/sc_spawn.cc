@@ -52,8 +52,6 @@ spawnWork(ProcessFuncWrapper *func, const char *name,
             method = true;
         if (opts->_dontInitialize)
             dontInitialize = true;
-        if (opts->_stackSize != -1)
-            warn_once("Ignoring request to set stack size.\n");
     }
 
     if (!name || name[0] == '\0') {
@@ -71,6 +69,10 @@ spawnWork(ProcessFuncWrapper *func, const char *name,
 
     proc->dontInitialize(dontInitialize);
 
+    // Stack sizes only apply to thread processes.
+    if (opts && opts->_stackSize > 0 && !method)
+        proc->setStackSize(opts->_stackSize);
+
     if (opts) {
         for (auto e: opts->_events)
             newStaticSensitivityEvent(proc, e);
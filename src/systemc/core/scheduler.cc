@@ -53,7 +53,7 @@ Scheduler::Scheduler() :
     maxTickEvent(*this, false, MaxTickPriority),
     timeAdvancesEvent(*this, false, TimeAdvancesPriority), _numCycles(0),
     _changeStamp(0), _current(nullptr), initDone(false), runToTime(true),
-    runOnce(false)
+    runOnce(false), _batchDeltas(false)
 {}
 
 Scheduler::~Scheduler()
@@ -170,6 +170,8 @@ Scheduler::yield()
         // Switch to whatever Fiber is supposed to run this process. All
         // Fibers which aren't running should be parked at this line.
         _current->fiber()->run();
+        if (!retiredFibers.empty())
+            reapFibers();
         // If the current process needs to be manually started, start it.
         if (_current && _current->needsStart()) {
             _current->needsStart(false);
@@ -195,6 +197,21 @@ Scheduler::yield()
     }
 }
 
+void
+Scheduler::reapFibers()
+{
+    gem5::Fiber *current = gem5::Fiber::currentFiber();
+    auto it = retiredFibers.begin();
+    while (it != retiredFibers.end()) {
+        if (*it == current) {
+            ++it;
+        } else {
+            delete *it;
+            it = retiredFibers.erase(it);
+        }
+    }
+}
+
 void
 Scheduler::ready(Process *p)
 {
@@ -288,30 +305,42 @@ Scheduler::runReady()
 {
     scheduleTimeAdvancesEvent();
 
-    bool empty = readyListMethods.empty() && readyListThreads.empty();
-    lastReadyTick = getCurTick();
+    while (true) {
+        bool empty = readyListMethods.empty() && readyListThreads.empty();
+        lastReadyTick = getCurTick();
 
-    // The evaluation phase.
-    status(StatusEvaluate);
-    do {
-        yield();
-    } while (getNextReady());
-    _current = nullptr;
+        // The evaluation phase.
+        status(StatusEvaluate);
+        do {
+            yield();
+        } while (getNextReady());
+        _current = nullptr;
 
-    if (!empty) {
-        _numCycles++;
-        _changeStamp++;
-    }
+        if (!empty) {
+            _numCycles++;
+            _changeStamp++;
+        }
 
-    if (_stopNow) {
-        status(StatusOther);
-        return;
-    }
+        if (_stopNow) {
+            status(StatusOther);
+            return;
+        }
 
-    runUpdate();
-    if (!traceFiles.empty())
-        trace(true);
-    runDelta();
+        runUpdate();
+        if (!traceFiles.empty())
+            trace(true);
+        runDelta();
+
+        // If the update and delta notification phases made more processes
+        // ready, they rescheduled the ready event for this same tick. When
+        // batching, start the next delta cycle right away instead, unless
+        // a pause or stop was requested for the end of this one.
+        if (!_batchDeltas || runOnce || !readyEvent.scheduled() ||
+                pauseEvent.scheduled() || stopEvent.scheduled()) {
+            break;
+        }
+        deschedule(&readyEvent);
+    }
 
     if (!runToTime && starved())
         scheduleStarvationEvent();
@@ -192,6 +192,9 @@ class Scheduler
     // Run the next process, if there is one.
     void yield();
 
+    // Free the fiber of a terminated thread once it's no longer running.
+    void retireFiber(gem5::Fiber *fiber) { retiredFibers.push_back(fiber); }
+
     // Put a process on the ready list.
     void ready(Process *p);
 
@@ -239,6 +242,10 @@ class Scheduler
     // Set an event queue for scheduling events.
     void setEventQueue(gem5::EventQueue *_eq) { eq = _eq; }
 
+    // Run all the delta cycles of a timestamp from a single ready event,
+    // rather than going back through the gem5 event queue between them.
+    void batchDeltas(bool batch) { _batchDeltas = batch; }
+
     // Get the current time according to gem5.
     gem5::Tick getCurTick() { return eq ? eq->getCurTick() : 0; }
 
@@ -457,6 +464,10 @@ class Scheduler
     TimeSlots timeSlots;
     std::stack<TimeSlot*> freeTimeSlots;
 
+    // Fibers of terminated threads waiting to have their stacks freed.
+    std::vector<gem5::Fiber *> retiredFibers;
+    void reapFibers();
+
     Process *
     getNextReady()
     {
@@ -521,6 +532,7 @@ class Scheduler
     bool initDone;
     bool runToTime;
     bool runOnce;
+    bool _batchDeltas;
 
     ProcessList initList;
 
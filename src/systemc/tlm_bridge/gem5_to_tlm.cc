@@ -174,9 +174,16 @@ packet2payload(PacketPtr packet)
         trans->set_command(tlm::TLM_IGNORE_COMMAND);
     }
 
-    // Attach the packet pointer to the TLM transaction to keep track.
-    auto *extension = new Gem5SystemC::Gem5Extension(packet);
-    trans->set_auto_extension(extension);
+    // Attach the packet pointer to the TLM transaction to keep track. The
+    // extension stays attached to the pooled payload when it is freed, so
+    // it only needs to be allocated the first time the payload is used.
+    Gem5SystemC::Gem5Extension *extension = nullptr;
+    trans->get_extension(extension);
+    if (extension) {
+        extension->setPacket(packet);
+    } else {
+        trans->set_extension(new Gem5SystemC::Gem5Extension(packet));
+    }
 
     if (packet->isAtomicOp()) {
         auto *atomic_ex = new Gem5SystemC::AtomicExtension(
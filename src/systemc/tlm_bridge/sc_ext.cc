@@ -137,6 +137,12 @@ Gem5Extension::getPacket()
     return packet;
 }
 
+void
+Gem5Extension::setPacket(PacketPtr p)
+{
+    packet = p;
+}
+
 tlm::tlm_extension_base *
 Gem5Extension::clone() const
 {
@@ -32,6 +32,8 @@
 
 #include "systemc/tlm_bridge/sc_mm.hh"
 
+#include "systemc/tlm_bridge/sc_ext.hh"
+
 namespace Gem5SystemC
 {
 
@@ -61,7 +63,16 @@ MemoryManager::allocate()
 void
 MemoryManager::free(gp *payload)
 {
-    payload->reset(); // clears all extensions
+    payload->reset(); // clears all auto extensions
+
+    // The gem5 extension is a regular extension that is kept with the
+    // payload for its next use; just drop the stale packet pointer.
+    Gem5Extension *extension = nullptr;
+    payload->get_extension(extension);
+    if (extension) {
+        extension->setPacket(nullptr);
+    }
+
     freePayloads.push_back(payload);
 }
 
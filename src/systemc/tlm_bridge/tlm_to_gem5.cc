@@ -113,8 +113,9 @@ payload2packet(RequestorID _id, tlm::tlm_generic_payload &trans)
 
     // If there is an extension, this transaction was initiated by the gem5
     // world and we can pipe through the original packet. Otherwise, we
-    // generate a new packet based on the transaction.
-    if (extension != nullptr) {
+    // generate a new packet based on the transaction. Pooled payloads keep
+    // their extension between uses, with no packet while they carry none.
+    if (extension != nullptr && extension->getPacket() != nullptr) {
         auto pkt = extension->getPacket();
         // Sync the address which could have changed.
         pkt->setAddr(trans.get_address());
@@ -138,7 +139,7 @@ payload2packet(RequestorID _id, tlm::tlm_generic_payload &trans)
         AtomicOpFunctorPtr amo_op = AtomicOpFunctorPtr(
             atomic_ex->getAtomicOpFunctor()->clone());
         // FIXME: correct the context_id and pc state.
-        req = std::make_shared<Request>(
+        req = Request::make(
             trans.get_address(), trans.get_data_length(), flags, _id,
             0, 0, std::move(amo_op));
         req->setPaddr(trans.get_address());
@@ -158,7 +159,7 @@ payload2packet(RequestorID _id, tlm::tlm_generic_payload &trans)
                             "command");
         }
         Request::Flags flags;
-        req = std::make_shared<Request>(
+        req = Request::make(
             trans.get_address(), trans.get_data_length(), flags, _id);
     }
 
@@ -508,7 +509,7 @@ TlmToGem5Bridge<BITWIDTH>::recvTimingResp(PacketPtr pkt)
 
     // If there is an extension the packet was piped through and we must not
     // delete it. The packet travels back with the transaction.
-    if (extension == nullptr)
+    if (extension == nullptr || extension->getPacket() == nullptr)
         destroyPacket(pkt);
 
     trans.release();
@@ -0,0 +1,90 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+A multi-core KVM boot of Ubuntu used by the host performance benchmarks (see
+tests/host_perf/run.py), to measure how the KVM cores scale when they run on
+parallel host threads. It exits once the guest has booted.
+"""
+
+import argparse
+
+from gem5.components.boards.x86_board import X86Board
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.memory import SingleChannelDDR4_2400
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.resources.workload import Workload
+from gem5.simulate.simulator import Simulator
+from gem5.utils.requires import requires
+
+parser = argparse.ArgumentParser(
+    description="Boot Ubuntu on a multi-core KVM system."
+)
+parser.add_argument(
+    "--num-cores", type=int, default=8, help="The number of cores."
+)
+parser.add_argument(
+    "--serial",
+    action="store_true",
+    help="Run all the cores on a single host thread.",
+)
+parser.add_argument(
+    "--sim-quantum",
+    default="1ms",
+    help="The simulated time between the synchronizations of the cores.",
+)
+args = parser.parse_args()
+
+requires(isa_required=ISA.X86, kvm_required=True)
+
+processor = SimpleProcessor(
+    cpu_type=CPUTypes.KVM, num_cores=args.num_cores, isa=ISA.X86
+)
+processor.set_kvm_options(
+    parallel=not args.serial, sim_quantum=args.sim_quantum
+)
+
+board = X86Board(
+    clk_freq="3GHz",
+    processor=processor,
+    memory=SingleChannelDDR4_2400(size="3GiB"),
+    cache_hierarchy=NoCache(),
+)
+
+workload = Workload("x86-ubuntu-18.04-boot")
+workload.set_parameter("readfile_contents", "m5 exit")
+board.set_workload(workload)
+
+simulator = Simulator(board=board)
+simulator.run()
+
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
@@ -0,0 +1,129 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+A single core SE mode system used by the host performance benchmarks (see
+tests/host_perf/run.py). It runs a binary with the chosen CPU model and
+cache hierarchy for a maximum number of instructions.
+"""
+
+import argparse
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.memory import SingleChannelDDR4_2400
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.resources.resource import BinaryResource, Resource
+from gem5.simulate.simulator import Simulator
+
+parser = argparse.ArgumentParser(
+    description="Run a binary on a simple SE mode system."
+)
+parser.add_argument(
+    "--cpu",
+    choices=["atomic", "timing", "minor", "o3"],
+    default="atomic",
+    help="The CPU model.",
+)
+parser.add_argument(
+    "--cache",
+    choices=["none", "classic", "mesi_two_level", "chi"],
+    default="none",
+    help="The cache hierarchy.",
+)
+parser.add_argument(
+    "--binary", help="The binary to run, instead of the resource."
+)
+parser.add_argument(
+    "--resource",
+    default="x86-hello64-static",
+    help="The gem5 resource of the binary to run.",
+)
+parser.add_argument(
+    "--max-insts",
+    type=int,
+    default=10**7,
+    help="Stop after this many instructions.",
+)
+args = parser.parse_args()
+
+
+def cache_factory(cache):
+    if cache == "none":
+        from gem5.components.cachehierarchies.classic.no_cache import NoCache
+
+        return NoCache()
+    elif cache == "classic":
+        from gem5.components.cachehierarchies.classic.private_l1_private_l2_cache_hierarchy import (
+            PrivateL1PrivateL2CacheHierarchy,
+        )
+
+        return PrivateL1PrivateL2CacheHierarchy(
+            l1d_size="32KiB", l1i_size="32KiB", l2_size="256KiB"
+        )
+    elif cache == "mesi_two_level":
+        from gem5.components.cachehierarchies.ruby.mesi_two_level_cache_hierarchy import (
+            MESITwoLevelCacheHierarchy,
+        )
+
+        return MESITwoLevelCacheHierarchy(
+            l1i_size="32KiB",
+            l1i_assoc="8",
+            l1d_size="32KiB",
+            l1d_assoc="8",
+            l2_size="256KiB",
+            l2_assoc="4",
+            num_l2_banks=1,
+        )
+    else:
+        from gem5.components.cachehierarchies.chi.private_l1_cache_hierarchy import (
+            PrivateL1CacheHierarchy,
+        )
+
+        return PrivateL1CacheHierarchy(size="32KiB", assoc=8)
+
+
+board = SimpleBoard(
+    clk_freq="3GHz",
+    processor=SimpleProcessor(cpu_type=CPUTypes(args.cpu), num_cores=1),
+    memory=SingleChannelDDR4_2400(size="1GiB"),
+    cache_hierarchy=cache_factory(args.cache),
+)
+
+if args.binary:
+    board.set_se_binary_workload(BinaryResource(local_path=args.binary))
+else:
+    board.set_se_binary_workload(Resource(args.resource))
+
+simulator = Simulator(board=board)
+simulator.schedule_max_insts(args.max_insts)
+simulator.run()
+
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
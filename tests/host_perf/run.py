@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Host performance benchmarks of gem5.
+
+Each benchmark runs one representative configuration with a gem5 binary
+and reports, as JSON, the host seconds, the simulated instructions per
+host second, the host seconds per simulated millisecond, and the peak
+resident memory of the gem5 process. The binaries are looked up as
+<build-dir>/<build>/gem5.<variant>, and the benchmarks without a binary
+are skipped:
+
+    tests/host_perf/run.py --output results.json
+
+A previous output can be used as a baseline to catch slowdowns. The
+runner then fails if a benchmark is slower or uses more memory than the
+baseline by more than the tolerance:
+
+    tests/host_perf/run.py --baseline results.json
+
+The CPU benchmarks run a hello world resource by default, which is too
+short for stable numbers. Pass a longer binary with, e.g.,
+--binary X86=/path/to/benchmark.
+
+The KVM benchmarks boot Ubuntu with 1, 8 and 32 cores, with the cores on a
+single host thread (serial) or on a thread each (parallel). They are
+skipped when the host doesn't have KVM.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+base_dir = os.path.dirname(os.path.abspath(__file__))
+gem5_root = os.path.dirname(os.path.dirname(base_dir))
+
+
+def se_cpu(cpu, cache, isa):
+    return (
+        os.path.join(base_dir, "configs", "se_cpu.py"),
+        ["--cpu", cpu, "--cache", cache],
+        isa,
+    )
+
+
+def kvm_boot(num_cores, parallel):
+    return (
+        os.path.join(base_dir, "configs", "kvm_boot.py"),
+        [f"--num-cores={num_cores}"] + ([] if parallel else ["--serial"]),
+        None,
+    )
+
+
+def gem5_config(*path_and_args):
+    path, *args = path_and_args
+    return (os.path.join(gem5_root, path), list(args), None)
+
+
+# name: (build, (config, config arguments, ISA of the workload))
+benchmarks = {
+    "atomic-fast-forward": ("X86", se_cpu("atomic", "none", "X86")),
+    "o3-classic-caches": ("X86", se_cpu("o3", "classic", "X86")),
+    "minor-classic-caches": ("ARM", se_cpu("minor", "classic", "ARM")),
+    "ruby-mesi-two-level": (
+        "X86_MESI_Two_Level",
+        se_cpu("timing", "mesi_two_level", "X86"),
+    ),
+    "ruby-chi": ("ARM", se_cpu("timing", "chi", "ARM")),
+    "garnet-synthetic-traffic": (
+        "NULL",
+        gem5_config(
+            "configs/example/garnet_synth_traffic.py",
+            "--network=garnet",
+            "--num-cpus=16",
+            "--num-dirs=16",
+            "--topology=Mesh_XY",
+            "--mesh-rows=4",
+            "--synthetic=uniform_random",
+            "--injectionrate=0.1",
+            "--sim-cycles=1000000",
+        ),
+    ),
+    "traffic-gen-dram": (
+        "NULL",
+        gem5_config(
+            "tests/gem5/traffic_gen/simple_traffic_run.py",
+            "RandomGenerator",
+            "1",
+            "NoCache",
+            "gem5.components.memory",
+            "SingleChannelDDR4_2400",
+            "512MiB",
+        ),
+    ),
+    "gpu-ruby-random": (
+        "VEGA_X86",
+        gem5_config(
+            "configs/example/ruby_gpu_random_test.py",
+            "--test-length",
+            "5000000",
+            "--num-dmas",
+            "0",
+        ),
+    ),
+}
+
+# The scaling of KVM boots with the number of cores, on one host thread or one
+# per core
+for num_cores in (1, 8, 32):
+    for parallel in (False, True):
+        mode = "parallel" if parallel else "serial"
+        benchmarks[f"kvm-boot-{num_cores}-{mode}"] = (
+            "X86",
+            kvm_boot(num_cores, parallel),
+        )
+
+default_resources = {
+    "X86": "x86-hello64-static",
+    "ARM": "arm-hello64-static",
+}
+
+
+def read_stats(path):
+    """Read the scalar stats of the first dump of a stats.txt file."""
+
+    stats = {}
+    if not os.path.exists(path):
+        return stats
+    with open(path) as f:
+        for line in f:
+            if line.startswith("---------- End"):
+                break
+            match = re.match(r"^(\S+)\s+(-?[0-9.eE+-]+|nan|inf)\s", line)
+            if match:
+                stats[match.group(1)] = float(match.group(2))
+    return stats
+
+
+def run(name, gem5, config, args):
+    """Run a benchmark and return its results."""
+
+    with tempfile.TemporaryDirectory(prefix=f"gem5-{name}-") as outdir:
+        cmd = [gem5, "--quiet", f"--outdir={outdir}", config] + args
+        start = time.monotonic()
+        with open(os.path.join(outdir, "output.log"), "w") as log:
+            proc = subprocess.Popen(
+                cmd, stdout=log, stderr=subprocess.STDOUT, cwd=outdir
+            )
+            _, status, usage = os.wait4(proc.pid, 0)
+        host_seconds = time.monotonic() - start
+        code = os.waitstatus_to_exitcode(status)
+        if code != 0:
+            with open(os.path.join(outdir, "output.log")) as log:
+                sys.stderr.write(log.read()[-4000:])
+            raise RuntimeError(f"{name} failed with exit code {code}")
+
+        stats = read_stats(os.path.join(outdir, "stats.txt"))
+
+    sim_insts = stats.get("simInsts")
+    sim_seconds = stats.get("simSeconds")
+    return {
+        "host_seconds": host_seconds,
+        "sim_insts": sim_insts,
+        "sim_seconds": sim_seconds,
+        "sim_ips": sim_insts / host_seconds if sim_insts else None,
+        "host_seconds_per_sim_ms": (
+            host_seconds / (sim_seconds * 1000) if sim_seconds else None
+        ),
+        # ru_maxrss is in KiB on Linux
+        "peak_rss_mib": usage.ru_maxrss / 1024,
+    }
+
+
+def compare(results, baseline, tolerance):
+    """Return the regressions of the results against a baseline."""
+
+    regressions = []
+    for name, result in results.items():
+        if name not in baseline:
+            continue
+        for key in ("host_seconds", "peak_rss_mib"):
+            new, old = result[key], baseline[name][key]
+            if old and new > old * (1 + tolerance):
+                regressions.append(
+                    f"{name}: {key} went from {old:.3f} to {new:.3f} "
+                    f"(+{100 * (new / old - 1):.1f}%)"
+                )
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the gem5 host performance benchmarks.",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog=__doc__,
+    )
+    parser.add_argument(
+        "benchmarks",
+        nargs="*",
+        help=f"The benchmarks to run, all by default: "
+        f"{', '.join(benchmarks)}.",
+    )
+    parser.add_argument(
+        "--build-dir",
+        default=os.path.join(gem5_root, "build"),
+        help="The directory with the gem5 builds.",
+    )
+    parser.add_argument(
+        "--variant", default="opt", help="The variant of the gem5 binaries."
+    )
+    parser.add_argument(
+        "--binary",
+        action="append",
+        default=[],
+        metavar="ISA=PATH",
+        help="The binary run by the CPU benchmarks of an ISA.",
+    )
+    parser.add_argument(
+        "--max-insts",
+        type=int,
+        default=10**7,
+        help="Instructions run by the CPU benchmarks.",
+    )
+    parser.add_argument(
+        "--repeat",
+        type=int,
+        default=1,
+        help="Run each benchmark this many times and keep the fastest.",
+    )
+    parser.add_argument("--output", help="Write the results to this file.")
+    parser.add_argument(
+        "--baseline", help="Fail on regressions against these results."
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.1,
+        help="The relative slowdown allowed against the baseline.",
+    )
+    args = parser.parse_args()
+
+    binaries = dict(binary.split("=", 1) for binary in args.binary)
+    names = args.benchmarks or list(benchmarks)
+    for name in names:
+        if name not in benchmarks:
+            parser.error(f"Unknown benchmark {name}")
+
+    results = {}
+    for name in names:
+        build, (config, config_args, isa) = benchmarks[name]
+        gem5 = os.path.join(args.build_dir, build, f"gem5.{args.variant}")
+        if not os.path.exists(gem5):
+            print(f"Skipping {name}, {gem5} doesn't exist", file=sys.stderr)
+            continue
+        if name.startswith("kvm-") and not os.access(
+            "/dev/kvm", os.R_OK | os.W_OK
+        ):
+            print(f"Skipping {name}, KVM isn't available", file=sys.stderr)
+            continue
+
+        if isa:
+            config_args = config_args + [f"--max-insts={args.max_insts}"]
+            if isa in binaries:
+                config_args.append(f"--binary={binaries[isa]}")
+            else:
+                config_args.append(f"--resource={default_resources[isa]}")
+
+        print(f"Running {name}", file=sys.stderr)
+        runs = [
+            run(name, gem5, config, config_args) for _ in range(args.repeat)
+        ]
+        results[name] = min(runs, key=lambda result: result["host_seconds"])
+
+    output = json.dumps(results, indent=4, sort_keys=True)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(output + "\n")
+    else:
+        print(output)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            regressions = compare(results, json.load(f), args.tolerance)
+        for regression in regressions:
+            print(f"Regression: {regression}", file=sys.stderr)
+        if regressions:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
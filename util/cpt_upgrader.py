@@ -189,6 +189,46 @@ class Upgrader:
                     sys.exit(1)
 
 
+def inline_binary_arrays(cpt, path):
+    """Replace the entries of the arrays stored in the binary file of a
+    checkpoint with their values as text, which is what upgraders expect.
+    gem5 reads both forms."""
+    import struct
+
+    formats = {
+        "u8": "B",
+        "u16": "H",
+        "u32": "I",
+        "u64": "Q",
+        "i8": "b",
+        "i16": "h",
+        "i32": "i",
+        "i64": "q",
+        "f32": "f",
+        "f64": "d",
+    }
+    data = None
+    for sec in cpt.sections():
+        for opt, value in cpt.items(sec):
+            if not value.startswith("!bin:"):
+                continue
+            if data is None:
+                bin_path = osp.join(osp.dirname(path), "m5.cpt.bin")
+                with open(bin_path, "rb") as f:
+                    data = f.read()
+                if data[:8] != b"gem5bin\0":
+                    print(f"fatal: {bin_path} is not a binary checkpoint")
+                    exit(1)
+                # The byte order marker is written in the host order
+                order = "<" if data[12] == 0x04 else ">"
+            elem, offset, count = value[len("!bin:") :].split(":")
+            values = struct.unpack_from(
+                f"{order}{count}{formats[elem]}", data, int(offset)
+            )
+            cpt.set(sec, opt, " ".join(str(v) for v in values))
+            verboseprint("inlined binary array", sec, opt)
+
+
 def process_file(path, **kwargs):
     if not osp.isfile(path):
         import errno
@@ -252,6 +292,8 @@ def process_file(path, **kwargs):
     # Apply migrations for tags not in checkpoint and tags present for which
     # downgraders are present, respecting dependences
     to_apply = (Upgrader.tag_set - tags) | (Upgrader.untag_set & tags)
+    if to_apply:
+        inline_binary_arrays(cpt, path)
     while to_apply:
         ready = set([t for t in to_apply if Upgrader.get(t).ready(tags)])
         if not ready:
@@ -93,6 +93,8 @@ usage(const std::string &prog_name)
         "    -c <from> <to> <ticks>       -- switch from cpu 'from' to cpu"
         " 'to' after\n"
         "                                    the given number of ticks\n"
+        "    -t <ticks>                   -- stop after the given number of"
+        " ticks\n"
         "\n"
         );
 
@@ -141,6 +143,7 @@ main(int argc, char **argv)
     std::string to_cpu = "";
     Tick pre_run_time = 1000000;
     Tick pre_switch_time = 1000000;
+    Tick run_time = MaxTick;
 
     try {
         while (arg_ptr < argc) {
@@ -192,6 +195,11 @@ main(int argc, char **argv)
                 to_cpu = argv[arg_ptr + 1];
                 std::istringstream(argv[arg_ptr + 2]) >> pre_switch_time;
                 arg_ptr += 3;
+            } else if (option == "-t") {
+                if (num_args < 1)
+                    usage(prog_name);
+                std::istringstream(argv[arg_ptr]) >> run_time;
+                arg_ptr++;
             } else {
                 usage(prog_name);
             }
@@ -257,12 +265,14 @@ main(int argc, char **argv)
     if (checkpoint_restore) {
         std::cerr << "Restoring checkpoint\n";
 
-        SimObject::setSimObjectResolver(
-            &config_manager->getSimObjectResolver());
-        CheckpointIn *checkpoint = new CheckpointIn(checkpoint_dir);
+        try {
+            config_manager->restoreCheckpoint(checkpoint_dir);
+        } catch (CxxConfigManager::Exception &e) {
+            std::cerr << "Checkpoint problem in sim object " << e.name
+                << ": " << e.message << "\n";
 
-        DrainManager::instance().preCheckpointRestore();
-        config_manager->loadState(*checkpoint);
+            return EXIT_FAILURE;
+        }
         config_manager->startup();
 
         config_manager->drainResume();
@@ -299,7 +309,7 @@ main(int argc, char **argv)
         std::cerr << "Switched CPU\n";
     }
 
-    exit_event = simulate();
+    exit_event = simulate(run_time);
 
     std::cerr << "Exit at tick " << curTick()
         << ", cause: " << exit_event->getCause() << '\n';
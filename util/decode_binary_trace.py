@@ -0,0 +1,183 @@
+#! /usr/bin/env python3
+#
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Decode the binary traces written by the BinaryExeTracer instruction
+tracer and by the --debug-binary debug output, and print them as text.
+
+    decode_binary_trace.py m5out/exetrace.bin.gz
+
+The format is described in src/base/binary_trace.hh.
+"""
+
+import argparse
+import gzip
+import struct
+import sys
+
+MAGIC = b"gem5btrc"
+VERSION = 1
+MAX_TICK = 2**64 - 1
+
+STRING, MESSAGE, INST = range(3)
+STRING_HEADER = struct.Struct("=II")
+MESSAGE_HEADER = struct.Struct("=QIII")
+INST_DATA = struct.Struct("=QQQQQQIIIIHBB")
+
+MICRO_OP = 0x01
+MEM_VALID = 0x02
+PREDICATE = 0x04
+FAULTING = 0x08
+FETCH_SEQ_VALID = 0x10
+CP_SEQ_VALID = 0x20
+
+# InstRecord::DataStatus
+DATA_INVALID = 0
+DATA_DOUBLE = 3
+DATA_REG = 5
+
+
+def read(f, size):
+    data = f.read(size)
+    if len(data) != size:
+        raise EOFError("Truncated trace")
+    return data
+
+
+def format_inst(strings, fields, args):
+    (
+        tick,
+        pc,
+        fetch_seq,
+        cp_seq,
+        addr,
+        data,
+        size,
+        cpu,
+        mnemonic,
+        op_class,
+        micro_pc,
+        flags,
+        data_status,
+    ) = fields
+
+    line = f"{tick:7d}: " if args.ticks else ""
+    if args.flags:
+        line += "ExecEnable: "
+    line += f"{strings[cpu]}: {pc:#x}"
+    line += f".{micro_pc:2d}" if flags & MICRO_OP else "   "
+    line += f" : {strings[mnemonic]:<26} : {strings[op_class]} :"
+
+    if not flags & PREDICATE:
+        line += " Predicated False"
+    if data_status == DATA_DOUBLE:
+        value = struct.unpack("=d", struct.pack("=Q", data))[0]
+        line += f" D={value}"
+    elif data_status != DATA_INVALID:
+        line += f" D={data:#018x}"
+    if flags & MEM_VALID:
+        line += f" A={addr:#x} S={size}"
+    if flags & FETCH_SEQ_VALID:
+        line += f"  FetchSeq={fetch_seq}"
+    if flags & CP_SEQ_VALID:
+        line += f"  CPSeq={cp_seq}"
+    if flags & FAULTING:
+        line += "  Faulting"
+    return line + "\n"
+
+
+def format_message(strings, fields, message, args):
+    tick, name, flag, _ = fields
+
+    line = ""
+    if args.ticks and tick != MAX_TICK:
+        line += f"{tick:7d}: "
+    if args.flags and strings[flag]:
+        line += f"{strings[flag]}: "
+    if strings[name]:
+        line += f"{strings[name]}: "
+    return line + message
+
+
+def decode(f, out, args):
+    if read(f, len(MAGIC)) != MAGIC:
+        sys.exit("Not a gem5 binary trace")
+    (version,) = struct.unpack("=I", read(f, 4))
+    if version != VERSION:
+        sys.exit(f"Unsupported trace version {version}")
+
+    strings = []
+    while True:
+        record_type = f.read(1)
+        if not record_type:
+            break
+        record_type = record_type[0]
+
+        if record_type == STRING:
+            _, length = STRING_HEADER.unpack(read(f, STRING_HEADER.size))
+            strings.append(read(f, length).decode(errors="replace"))
+        elif record_type == MESSAGE:
+            fields = MESSAGE_HEADER.unpack(read(f, MESSAGE_HEADER.size))
+            message = read(f, fields[3]).decode(errors="replace")
+            out.write(format_message(strings, fields, message, args))
+        elif record_type == INST:
+            fields = INST_DATA.unpack(read(f, INST_DATA.size))
+            out.write(format_inst(strings, fields, args))
+        else:
+            sys.exit(f"Unknown record type {record_type}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Print a gem5 binary trace as text."
+    )
+    parser.add_argument(
+        "trace", help="The trace, decompressed if it ends with .gz."
+    )
+    parser.add_argument(
+        "--no-ticks",
+        dest="ticks",
+        action="store_false",
+        help="Don't print the ticks.",
+    )
+    parser.add_argument(
+        "--flags", action="store_true", help="Print the debug flags."
+    )
+    args = parser.parse_args()
+
+    opener = gzip.open if args.trace.endswith(".gz") else open
+    with opener(args.trace, "rb") as f:
+        try:
+            decode(f, sys.stdout, args)
+        except EOFError as e:
+            sys.exit(str(e))
+        except BrokenPipeError:
+            pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script builds a statistical profile of a protobuf data dependency
+# trace recorded by the ElasticTrace probe. The TraceCPU synthesizes a data
+# trace from the profile (see src/cpu/trace/dep_profile.hh for the format)
+# when it is given as its dataTraceFile.
+#
+# The reuse distances are counted in distinct lines of --line-size bytes,
+# and the weight of the records, i.e. the number of filtered out compute
+# records preceding them, is not kept.
+#
+# usage: dep_trace_profile.py [--line-size N] <protobuf input> <profile>
+
+import argparse
+from collections import Counter
+
+import protolib
+
+# Import the packet proto definitions. If they are not found, attempt
+# to generate them automatically. This assumes that the script is
+# executed from the gem5 root.
+try:
+    import inst_dep_record_pb2
+except:
+    print("Did not find proto definition, attempting to generate")
+    from subprocess import call
+
+    error = call(
+        [
+            "protoc",
+            "--python_out=util",
+            "--proto_path=src/proto",
+            "src/proto/inst_dep_record.proto",
+        ]
+    )
+    if not error:
+        import inst_dep_record_pb2
+
+        print("Generated proto definitions for instruction dependency record")
+    else:
+        print("Failed to import proto definitions")
+        exit(-1)
+
+
+class ReuseDistance:
+    """
+    Counts the distinct lines accessed between two accesses to a line, in
+    O(log n) per access with a Fenwick tree over the access times where
+    only the last access to every line is set.
+    """
+
+    def __init__(self):
+        self.tree = [0]
+        self.last_access = {}
+
+    def _add(self, index, value):
+        while index < len(self.tree):
+            self.tree[index] += value
+            index += index & -index
+
+    def _sum(self, index):
+        total = 0
+        while index > 0:
+            total += self.tree[index]
+            index -= index & -index
+        return total
+
+    def access(self, line):
+        """
+        Returns the reuse distance of an access to a line, or None if the
+        line has not been accessed before.
+        """
+        now = len(self.tree)
+        # Grow the tree by one node, which covers the range of its lowest
+        # set bit
+        low = now & -now
+        self.tree.append(self._sum(now - 1) - self._sum(now - low))
+
+        last = self.last_access.get(line)
+        distance = None
+        if last is not None:
+            distance = self._sum(now - 1) - self._sum(last)
+            self._add(last, -1)
+        self._add(now, 1)
+        self.last_access[line] = now
+        return distance
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Build a statistical profile of a data dependency trace"
+    )
+    parser.add_argument("trace", help="protobuf data dependency trace")
+    parser.add_argument("profile", help="profile to write")
+    parser.add_argument(
+        "--line-size",
+        type=int,
+        default=64,
+        help="line size in bytes the reuse distances are counted in",
+    )
+    args = parser.parse_args()
+
+    proto_in = protolib.openFileRd(args.trace)
+
+    # Read the magic number in 4-byte Little Endian
+    magic_number = proto_in.read(4)
+    if magic_number != b"gem5":
+        print("Unrecognized file")
+        exit(-1)
+
+    header = inst_dep_record_pb2.InstDepRecordHeader()
+    protolib.decodeMessage(proto_in, header)
+
+    record_type = inst_dep_record_pb2.InstDepRecord
+    type_names = {
+        record_type.LOAD: "load",
+        record_type.STORE: "store",
+        record_type.COMP: "comp",
+    }
+
+    dists = {
+        name: Counter()
+        for name in (
+            "mix",
+            "comp_delay",
+            "rob_deps",
+            "rob_dep",
+            "reg_deps",
+            "reg_dep",
+            "size",
+            "reuse",
+        )
+    }
+    reuse = ReuseDistance()
+    base_line = None
+
+    num_records = 0
+    record = record_type()
+    while protolib.decodeMessage(proto_in, record):
+        num_records += 1
+        if record.type not in type_names:
+            print(
+                "Seq. num", record.seq_num, "has unsupported type", record.type
+            )
+            exit(-1)
+
+        dists["mix"][type_names[record.type]] += 1
+        dists["comp_delay"][record.comp_delay] += 1
+        dists["rob_deps"][len(record.rob_dep)] += 1
+        for dep in record.rob_dep:
+            dists["rob_dep"][record.seq_num - dep] += 1
+        # As when replaying a trace, a register dependency which is also an
+        # order dependency is omitted
+        reg_deps = [dep for dep in record.reg_dep if dep not in record.rob_dep]
+        dists["reg_deps"][len(reg_deps)] += 1
+        for dep in reg_deps:
+            dists["reg_dep"][record.seq_num - dep] += 1
+
+        if record.type in (record_type.LOAD, record_type.STORE):
+            dists["size"][record.size] += 1
+            line = record.p_addr // args.line_size
+            if base_line is None or line < base_line:
+                base_line = line
+            distance = reuse.access(line)
+            dists["reuse"]["cold" if distance is None else distance] += 1
+
+    proto_in.close()
+
+    with open(args.profile, "w") as out:
+        out.write("gem5-dep-profile 1\n")
+        out.write(f"# Profile of {args.trace}, {num_records} records\n")
+        out.write(f"tick_freq {header.tick_freq}\n")
+        out.write(f"window {header.window_size}\n")
+        out.write(f"line_size {args.line_size}\n")
+        out.write(f"base_addr {(base_line or 0) * args.line_size:#x}\n")
+        for name, dist in dists.items():
+            # The numeric values first, in order, then "cold"
+            for value, weight in sorted(
+                dist.items(), key=lambda i: (isinstance(i[0], str), i[0])
+            ):
+                out.write(f"{name} {value} {weight}\n")
+
+    print("Profiled records:", num_records)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+#! /usr/bin/env python3
+#
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Monitor the stats that a running simulation exports to shared memory.
+
+The simulation exports the stats with m5.stats.exportSharedMemory(), e.g.:
+
+    m5.stats.exportSharedMemory(
+        "/gem5-stats", ["system.cpu.numCycles", "system.cpu.ipc"], 10**9
+    )
+
+and this script prints their values while it runs:
+
+    stats_monitor.py /gem5-stats
+
+The SharedStats class can also be used to read the segment from other
+tools.
+"""
+
+import argparse
+import mmap
+import os
+import struct
+import sys
+import time
+
+# See src/base/stats/shm_export.hh for the layout of the segment
+HEADER = struct.Struct("=8s6IQQQ")
+ENTRY = struct.Struct("=4I")
+MAGIC = b"gem5live"
+VERSION = 1
+
+
+class SharedStats:
+    """A read-only view of the stats exported to a shared memory segment."""
+
+    def __init__(self, segment):
+        path = os.path.join("/dev/shm", segment.lstrip("/"))
+        with open(path, "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+        (
+            magic,
+            version,
+            num_stats,
+            self._num_values,
+            table_offset,
+            self._values_offset,
+            _,
+            _,
+            _,
+            _,
+        ) = HEADER.unpack_from(self._map)
+        if magic != MAGIC:
+            raise ValueError(f"{segment} isn't a gem5 stats segment")
+        if version != VERSION:
+            raise ValueError(f"Unsupported segment version {version}")
+
+        self._values = struct.Struct(f"={self._num_values}d")
+        self.stats = {}
+        for i in range(num_stats):
+            offset, size, name_offset, name_length = ENTRY.unpack_from(
+                self._map, table_offset + i * ENTRY.size
+            )
+            name = self._map[name_offset : name_offset + name_length]
+            self.stats[name.decode()] = (offset, size)
+
+    def close(self):
+        self._map.close()
+
+    def read(self):
+        """Return the tick of the last update and the values of the stats,
+        as a dictionary of lists of values."""
+
+        while True:
+            _, _, _, _, _, _, _, before, tick, _ = HEADER.unpack_from(
+                self._map
+            )
+            if before & 1:
+                time.sleep(0)
+                continue
+            values = self._values.unpack_from(self._map, self._values_offset)
+            after = HEADER.unpack_from(self._map)[7]
+            if before == after:
+                break
+
+        return tick, {
+            name: list(values[offset : offset + size])
+            for name, (offset, size) in self.stats.items()
+        }
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Print the stats that a simulation exports to shared "
+        "memory."
+    )
+    parser.add_argument(
+        "segment", help='The name of the segment, e.g., "/gem5-stats".'
+    )
+    parser.add_argument(
+        "-i",
+        "--interval",
+        default=1.0,
+        type=float,
+        help="Seconds between two prints.",
+    )
+    parser.add_argument(
+        "-n",
+        "--count",
+        default=0,
+        type=int,
+        help="Number of prints, 0 to print until interrupted.",
+    )
+    parser.add_argument(
+        "stats",
+        nargs="*",
+        help="The stats to print, all the exported stats by default.",
+    )
+    args = parser.parse_intermixed_args()
+
+    shared = SharedStats(args.segment)
+    for stat in args.stats:
+        if stat not in shared.stats:
+            sys.exit(f"{stat} isn't exported to {args.segment}")
+    names = args.stats or list(shared.stats)
+
+    printed = 0
+    try:
+        while args.count == 0 or printed < args.count:
+            tick, values = shared.read()
+            print(f"tick {tick}")
+            for name in names:
+                print(f"  {name} {' '.join(map(str, values[name]))}")
+            sys.stdout.flush()
+            printed += 1
+            if args.count == 0 or printed < args.count:
+                time.sleep(args.interval)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        shared.close()
+
+
+if __name__ == "__main__":
+    main()